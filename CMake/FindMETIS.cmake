@@ -9,13 +9,6 @@ FIND_PATH(
 
 #MESSAGE( STATUS "METIS_INCLUDE_DIR: ${METIS_INCLUDE_DIR}")
 
-IF (METIS_INCLUDE_DIR)
-  SET( METIS_FOUND 1 )
-  MESSAGE( STATUS "Found METIS: ${METIS_INCLUDE_DIR}")
-ELSE (METIS_INCLUDE_DIR)
-  MESSAGE(FATAL_ERROR "No se encontró metis.h")
-ENDIF (METIS_INCLUDE_DIR)
-
 FIND_LIBRARY(
   METIS_LIB
   metis 
@@ -23,4 +16,12 @@ FIND_LIBRARY(
   PATHS /usr/local/lib
   )
 
-SET(METIS_LIBRARIES ${METIS_LIB} )
+IF (METIS_INCLUDE_DIR AND METIS_LIB)
+  SET( METIS_FOUND 1 )
+  SET(METIS_LIBRARIES ${METIS_LIB} )
+  ADD_DEFINITIONS( -DHAVE_METIS )
+  MESSAGE( STATUS "Found METIS: ${METIS_INCLUDE_DIR}")
+ELSE (METIS_INCLUDE_DIR AND METIS_LIB)
+  SET(METIS_LIBRARIES "")
+  MESSAGE( STATUS "METIS not found; the built-in multilevel partitioner will be used.")
+ENDIF (METIS_INCLUDE_DIR AND METIS_LIB)
@@ -38,6 +38,6 @@ find_package(LAPACK REQUIRED)
 find_package(BLAS REQUIRED)
 find_package(SuperLU REQUIRED)
 find_package(BerkeleyDB REQUIRED)
-find_package(METIS REQUIRED)
+find_package(METIS)
 find_package(TCL REQUIRED)
 find_package(ORACLE)
@@ -0,0 +1,88 @@
+# -*- coding: utf-8 -*-
+# Benchmark of the memory arena of the mesh: builds and solves a square
+# plate meshed with quad elements allocating the elements from the
+# arena (useObjectArena= True) and from the global heap, and prints
+# the time spent meshing, solving and deleting the model.
+#
+# Usage: python object_arena_benchmark.py [numDiv] [numRepetitions]
+
+from __future__ import division
+import sys
+import time
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+numDiv= int(sys.argv[1]) if len(sys.argv)>1 else 200
+numRepetitions= int(sys.argv[2]) if len(sys.argv)>2 else 3
+
+E= 30e6 # Young modulus (psi)
+nu= 0.3 # Poisson's ratio
+rho= 0.0 # Density
+
+def run(useObjectArena):
+  ''' Return the time spent meshing, solving and deleting the model
+      and the memory reserved by the arena.'''
+  feProblem= xc.FEProblem()
+  feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+  preprocessor=  feProblem.getPreprocessor
+  mesh= feProblem.getDomain.getMesh
+  mesh.useObjectArena= useObjectArena
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+  nodes.newSeedNode()
+  elast2d= typical_materials.defElasticIsotropicPlaneStress(preprocessor, "elast2d",E,nu,rho)
+  seedElemHandler= preprocessor.getElementHandler.seedElemHandler
+  seedElemHandler.defaultMaterial= "elast2d"
+  elem= seedElemHandler.newElement("FourNodeQuad",xc.ID([0,0,0,0]))
+  points= preprocessor.getMultiBlockTopology.getPoints
+  pt1= points.newPntFromPos3d(geom.Pos3d(0.0,0.0,0.0))
+  pt2= points.newPntFromPos3d(geom.Pos3d(1.0,0.0,0.0))
+  pt3= points.newPntFromPos3d(geom.Pos3d(1.0,1.0,0.0))
+  pt4= points.newPntFromPos3d(geom.Pos3d(0.0,1.0,0.0))
+  surfaces= preprocessor.getMultiBlockTopology.getSurfaces
+  s= surfaces.newQuadSurfacePts(pt1.tag,pt2.tag,pt3.tag,pt4.tag)
+  s.nDivI= numDiv
+  s.nDivJ= numDiv
+
+  t0= time.time()
+  s.genMesh(xc.meshDir.I)
+  t1= time.time()
+  bytesReserved= mesh.objectArena.bytesReserved
+
+  for n in s.getEdges[0].getEdge.getNodeTags():
+    spc= modelSpace.constraints.newSPConstraint(n,0,0.0)
+    spc= modelSpace.constraints.newSPConstraint(n,1,0.0)
+  loadHandler= preprocessor.getLoadHandler
+  lPatterns= loadHandler.getLoadPatterns
+  ts= lPatterns.newTimeSeries("constant_ts","ts")
+  lPatterns.currentTimeSeries= "ts"
+  lp0= lPatterns.newLoadPattern("default","0")
+  for n in s.getEdges[2].getEdge.getNodeTags():
+    lp0.newNodalLoad(n,xc.Vector([0,-1.0]))
+  lPatterns.addToDomain("0")
+  analisis= predefined_solutions.simple_static_linear(feProblem)
+  t2= time.time()
+  result= analisis.analyze(1)
+  t3= time.time()
+  feProblem.clearAll()
+  t4= time.time()
+  return t1-t0, t3-t2, t4-t3, bytesReserved
+
+print "number of elements: ", numDiv*numDiv
+for useObjectArena in [False, True]:
+  best= None
+  for i in range(0,numRepetitions):
+    times= run(useObjectArena)
+    if(not best or (sum(times[0:3])<sum(best[0:3]))):
+      best= times
+  print "useObjectArena= ", useObjectArena, " mesh: ", best[0], "s solve: ", best[1], "s delete: ", best[2], "s arena bytes reserved: ", best[3]
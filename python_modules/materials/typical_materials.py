@@ -413,6 +413,49 @@ def defElasticMembranePlateSection(preprocessor,name,E,nu,rho,h):
   retval.h= h
   return retval
 
+#J2 plasticity material for plate fibers.
+def defJ2PlateFibre(preprocessor,name,E,nu,fy,alpha):
+  '''Constructs a J2 (Von Mises) plasticity material with linear
+     hardening appropiate for the fibers of a plate section.
+
+  :param  preprocessor: preprocessor
+  :param  name:         name identifying the material
+  :param  E:            Young’s modulus of the material
+  :param  nu:           Poisson’s ratio
+  :param  fy:           yield stress
+  :param  alpha:        strain-hardening ratio: ratio between post-yield
+                        tangent and initial elastic tangent (uniaxial)
+  '''
+  materials= preprocessor.getMaterialHandler
+  materials.newMaterial("J2_plate_fiber",name)
+  retval= materials.getMaterial(name)
+  retval.name= name
+  retval.bulkModulus= E/(3*(1-2*nu))
+  retval.shearModulus= E/(2*(1+nu))
+  retval.sigma0= fy
+  retval.sigmaInfty= fy
+  retval.delta= 0.0
+  retval.H= alpha*E/(1-alpha)
+  return retval
+
+#Membrane plate fiber section.
+def defMembranePlateFiberSection(preprocessor,name,h,nDMaterialName):
+  '''Constructs a membrane plate section made of five fibers
+     of the nD material being passed as parameter.
+
+  :param  preprocessor:   preprocessor
+  :param  name:           name identifying the section
+  :param  h:              overall depth of the section
+  :param  nDMaterialName: name of the material of the fibers
+  '''
+  materials= preprocessor.getMaterialHandler
+  materials.newMaterial("membrane_plate_fiber_section",name)
+  retval= materials.getMaterial(name)
+  retval.name= name
+  retval.h= h
+  retval.setMaterial(nDMaterialName)
+  return retval
+
 class MaterialData(object):
   '''Base class to construct some material definition classes
   
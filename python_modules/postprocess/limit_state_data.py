@@ -8,6 +8,7 @@ __email__= "l.pereztato@ciccp.es, ana.Ortega@ciccp.es"
 
 import pickle
 import os
+import xc
 from solution import predefined_solutions
 from postprocess.reports import export_internal_forces as eif
 from postprocess.reports import export_displacements as edisp
@@ -39,6 +40,18 @@ class LimitStateData(object):
     '''Return the file name to read: combination name, node number and 
     displacements (ux,uy,uz,rotX,rotY,rotZ).'''
     return self.internal_forces_results_directory+'displ_'+ self.label +'.csv'
+  def getResultsStoreFileName(self):
+    '''Return the name of the binary file containing the internal forces
+    and displacements for each combination (see results_store module).'''
+    return self.internal_forces_results_directory+'results_'+ self.label +'.xcr'
+  def getInternalForcesSource(self):
+    '''Return the name of the file to read the internal forces from:
+    the binary results store if it exists, otherwise the CSV file
+    (results written by previous versions).'''
+    retval= self.getResultsStoreFileName()
+    if(not os.path.exists(retval)):
+      retval= self.getInternalForcesFileName()
+    return retval
   def getOutputDataBaseFileName(self):
     '''Return the output file name without extension.'''
     return self.check_results_directory+self.outputDataBaseFileName
@@ -49,8 +62,11 @@ class LimitStateData(object):
     '''Read a Python object from a pickle file.'''
     with open(name + '.pkl', 'r') as f:
       return pickle.load(f)
-  def saveAll(self,feProblem,combContainer,setCalc,fConvIntForc= 1.0,analysisToPerform= defaultAnalysis):
+  def saveAll(self,feProblem,combContainer,setCalc,fConvIntForc= 1.0,analysisToPerform= defaultAnalysis,writeCSV= True,writeResultsStore= True):
     '''Write internal forces, displacements, .., for each combination
+    into CSV files (see getInternalForcesFileName and
+    getDisplacementsFileName) and into the binary results store
+    (see getResultsStoreFileName).
      
     :param feProblem: XC finite element problem to deal with.
     :param setCalc: set of entities for which the verification is 
@@ -60,6 +76,8 @@ class LimitStateData(object):
                            one desired for the displaying of internal forces
                            (The use of this factor won't be allowed in
                             future versions)
+    :param writeCSV: if True write the CSV files.
+    :param writeResultsStore: if True write the binary results store.
     '''
     if fConvIntForc != 1.0:
       lmsg.warning('fConvIntForc= ' + fConvIntForc + 'conversion factor between units is DEPRECATED' )
@@ -71,14 +89,25 @@ class LimitStateData(object):
     nodSet= setCalc.getNodes
     fNameInfForc= self.getInternalForcesFileName()
     fNameDispl= self.getDisplacementsFileName()
+    fNameStore= self.getResultsStoreFileName()
     os.system("rm -f " + fNameInfForc) #Clear obsolete files.
     os.system("rm -f " + fNameDispl)
-    fIntF= open(fNameInfForc,"a")
-    fDisp= open(fNameDispl,"a")
-    fIntF.write(" Comb. , Elem. , Sect. , N , Vy , Vz , T , My , Mz \n")
-    fDisp.write(" Comb. , Node , Ux , Uy , Uz , ROTx , ROTy , ROTz \n")
-    fIntF.close()
-    fDisp.close()
+    os.system("rm -f " + fNameStore)
+    if(writeCSV):
+      fIntF= open(fNameInfForc,"a")
+      fDisp= open(fNameDispl,"a")
+      fIntF.write(" Comb. , Elem. , Sect. , N , Vy , Vz , T , My , Mz \n")
+      fDisp.write(" Comb. , Node , Ux , Uy , Uz , ROTx , ROTy , ROTz \n")
+      fIntF.close()
+      fDisp.close()
+    store= None
+    if(writeResultsStore):
+      store= xc.ResultsStore(fNameStore)
+      # Angles of the axes used to express the internal forces
+      # in shell elements.
+      for e in elemSet:
+        if(('Shell' in e.type()) and e.hasProp('theta')):
+          store.setShellRotation(e.tag,e.getProp('theta'))
     for key in loadCombinations.getKeys():
       comb= loadCombinations[key]
       feProblem.getPreprocessor.resetLoadCase()
@@ -86,13 +115,19 @@ class LimitStateData(object):
       #Solution
       result= analysisToPerform(feProblem)
       #Writing results.
-      fIntF= open(fNameInfForc,"a")
-      fDisp= open(fNameDispl,"a")
-      eif.exportInternalForces(comb.getName,elemSet,fIntF)
-      edisp.exportDisplacements(comb.getName,nodSet,fDisp)
-      fIntF.close()
-      fDisp.close()
+      if(writeCSV):
+        fIntF= open(fNameInfForc,"a")
+        fDisp= open(fNameDispl,"a")
+        eif.exportInternalForces(comb.getName,elemSet,fIntF)
+        edisp.exportDisplacements(comb.getName,nodSet,fDisp)
+        fIntF.close()
+        fDisp.close()
+      if(store):
+        store.writeInternalForces(comb.getName,setCalc)
+        store.writeDisplacements(comb.getName,setCalc)
       comb.removeFromDomain() #Remove combination from the model.
+    if(store):
+      store.close()
 
 class NormalStressesRCLimitStateData(LimitStateData):
   ''' Reinforced concrete normal stresses data for limit state checking.'''
@@ -29,6 +29,7 @@ from postprocess import control_vars as cv
 from solution import predefined_solutions
 from miscUtils import LogMessages as lmsg
 from materials.sections import internal_forces
+from postprocess import results_store
 from collections import defaultdict
 
 # Fake section (elements must have a stiffness)
@@ -62,6 +63,9 @@ class PhantomModel(object):
     '''
     self.elementTags= set()
     self.idCombs= set()
+    if(intForcCombFileName.endswith('.xcr')):
+      self.readInternalForcesFromStore(intForcCombFileName,setCalc)
+      return
     f= open(intForcCombFileName,"r")
     self.internalForcesValues= defaultdict(list)
     internalForcesListing= csv.reader(f)
@@ -99,6 +103,32 @@ class PhantomModel(object):
             self.internalForcesValues[tagElem].append(crossSectionInternalForces)
     f.close()
 
+  def readInternalForcesFromStore(self,storeFileName,setCalc=None):
+    '''Extracts element and combination identifiers from the binary
+       results store (see results_store module).
+    
+    :param storeFileName: name of the file containing the internal
+                          forces obtained for each element for 
+                          the combinations analyzed
+    :param setCalc: set of elements to be analyzed (defaults to None which 
+                    means that all the elements in the file of internal forces
+                    results are analyzed) 
+    '''
+    self.internalForcesValues= defaultdict(list)
+    reader= results_store.ResultsStoreReader(storeFileName)
+    elemTags= None
+    if(setCalc!=None):
+      elemTags= setCalc.getElementTags()
+    (combNames,combIndexes,tags,sections,values)= reader.getInternalForces(elemTags)
+    self.idCombs.update(combNames)
+    self.elementTags.update(tags.tolist())
+    for idx,tagElem,idSection,v in zip(combIndexes.tolist(),tags.tolist(),sections.tolist(),values.tolist()):
+      crossSectionInternalForces= internal_forces.CrossSectionInternalForces(v[0],v[1],v[2],v[3],v[4],v[5])
+      crossSectionInternalForces.idComb= combNames[idx]
+      crossSectionInternalForces.tagElem= tagElem
+      crossSectionInternalForces.idSection= idSection
+      self.internalForcesValues[tagElem].append(crossSectionInternalForces)
+
   def createPhantomElement(self,idElem,sectionName,sectionDefinition,sectionIndex,interactionDiagram,fakeSection):
     '''Creates a phantom element (that represents a section to check) 
 
@@ -258,7 +288,7 @@ class PhantomModel(object):
                     means that all the elements in the file of internal forces
                     results are analyzed) 
      '''
-    intForcCombFileName= limitStateData.getInternalForcesFileName()
+    intForcCombFileName= limitStateData.getInternalForcesSource()
     controller= limitStateData.controller
     meanCFs= -1.0
     if(controller):
@@ -0,0 +1,146 @@
+# -*- coding: utf-8 -*-
+''' Reading of the binary files written by xc.ResultsStore (internal forces
+    and displacements for each load combination) using memory mapping.'''
+
+__author__= "Luis C. Pérez Tato (LCPT), Ana Ortega(AO_O)"
+__copyright__= "Copyright 2016,LCPT, AO_O"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@ciccp.es, ana.Ortega@ciccp.es"
+
+import struct
+import numpy
+from miscUtils import LogMessages as lmsg
+
+INTERNAL_FORCES= 1 # Block types (see ResultsStore.h)
+DISPLACEMENTS= 2
+
+internalForcesComponents= ['N','Vy','Vz','T','My','Mz']
+
+def padded(numBytes):
+  '''Return the number of bytes rounded up to a multiple of 8.'''
+  return (numBytes+7)//8*8
+
+class ResultsBlock(object):
+  '''Block of results (one combination and type of results).
+
+  :ivar blockType: type of the results (INTERNAL_FORCES or DISPLACEMENTS).
+  :ivar name: name of the load combination.
+  :ivar tags: tags of the elements (or nodes).
+  :ivar sections: section indexes.
+  :ivar values: values (one row for each tag and section).
+  '''
+  def __init__(self,blockType,name,tags,sections,values):
+    self.blockType= blockType
+    self.name= name
+    self.tags= tags
+    self.sections= sections
+    self.values= values
+
+class ResultsStoreReader(object):
+  '''Reader for the files written by xc.ResultsStore. The file is
+     mapped in memory so only the data used by the queries is read.'''
+  def __init__(self,fileName):
+    '''Constructor.
+
+    :param fileName: name of the file to read.
+    '''
+    self.fileName= fileName
+    self.data= numpy.memmap(fileName, dtype= numpy.uint8, mode= 'r')
+    self.blocks= list()
+    self.readBlocks()
+
+  def readBlocks(self):
+    '''Reads the headers of the blocks.'''
+    data= self.data
+    if(data[0:8].tostring()!='XCRSTORE'):
+      lmsg.error('ResultsStoreReader; file: \''+self.fileName+'\' is not a results store.')
+      return
+    offset= 16
+    sz= len(data)
+    while(offset+32<=sz):
+      magic= data[offset:offset+4].tostring()
+      if(magic!='XCBK'):
+        lmsg.error('ResultsStoreReader; corrupted block at offset: '+str(offset))
+        break
+      blockType,numRows,numComponents,nameLength= struct.unpack('=IQQQ',data[offset+4:offset+32].tostring())
+      offset+= 32
+      name= data[offset:offset+nameLength].tostring()
+      offset+= padded(nameLength)
+      tags= data[offset:offset+4*numRows].view(numpy.int32)
+      offset+= padded(4*numRows)
+      sections= data[offset:offset+4*numRows].view(numpy.int32)
+      offset+= padded(4*numRows)
+      valuesSize= 8*numRows*numComponents
+      # values are stored by columns.
+      values= data[offset:offset+valuesSize].view(numpy.float64).reshape(numComponents,numRows).T
+      offset+= valuesSize
+      self.blocks.append(ResultsBlock(blockType,name,tags,sections,values))
+
+  def getBlocks(self,blockType,combNames= None):
+    '''Return the blocks of the type argument.
+
+    :param blockType: type of the results (INTERNAL_FORCES or DISPLACEMENTS).
+    :param combNames: names of the combinations (if None return all the
+                      combinations).
+    '''
+    retval= [b for b in self.blocks if b.blockType==blockType]
+    if(combNames!=None):
+      retval= [b for b in retval if b.name in combNames]
+    return retval
+
+  def getCombinationNames(self,blockType= INTERNAL_FORCES):
+    '''Return the names of the combinations.'''
+    return [b.name for b in self.getBlocks(blockType)]
+
+  def query(self,blockType,tags= None,combNames= None):
+    '''Return the results of all the combinations for the tags argument.
+
+    Return a tuple (combNames, combIndexes, tags, sections, values) where
+    combIndexes is an array containing the index (in combNames) of the
+    combination that corresponds to each row.
+
+    :param blockType: type of the results (INTERNAL_FORCES or DISPLACEMENTS).
+    :param tags: tags of the elements or nodes (if None return all).
+    :param combNames: names of the combinations (if None return all).
+    '''
+    blocks= self.getBlocks(blockType,combNames)
+    names= [b.name for b in blocks]
+    if(tags!=None):
+      tags= numpy.asarray(list(tags),dtype= numpy.int32)
+    lIdx= list(); lTags= list(); lSections= list(); lValues= list()
+    numComponents= 0
+    for i, b in enumerate(blocks):
+      numComponents= max(numComponents,b.values.shape[1])
+      if(tags is None):
+        mask= slice(None)
+        n= len(b.tags)
+      else:
+        mask= numpy.in1d(b.tags,tags)
+        n= numpy.count_nonzero(mask)
+      lIdx.append(numpy.full(n,i,dtype= numpy.int32))
+      lTags.append(b.tags[mask])
+      lSections.append(b.sections[mask])
+      lValues.append(b.values[mask])
+    if(len(blocks)>0):
+      return (names,numpy.concatenate(lIdx),numpy.concatenate(lTags),numpy.concatenate(lSections),numpy.concatenate(lValues))
+    else:
+      return (names,numpy.zeros(0,dtype= numpy.int32),numpy.zeros(0,dtype= numpy.int32),numpy.zeros(0,dtype= numpy.int32),numpy.zeros((0,numComponents)))
+
+  def getInternalForces(self,elementTags= None,combNames= None):
+    '''Return the internal forces (N, Vy, Vz, T, My, Mz) for all the
+       combinations (see query).
+
+    :param elementTags: tags of the elements (if None return all).
+    :param combNames: names of the combinations (if None return all).
+    '''
+    return self.query(INTERNAL_FORCES,elementTags,combNames)
+
+  def getDisplacements(self,nodeTags= None,combNames= None):
+    '''Return the displacements of the nodes for all the
+       combinations (see query).
+
+    :param nodeTags: tags of the nodes (if None return all).
+    :param combNames: names of the combinations (if None return all).
+    '''
+    return self.query(DISPLACEMENTS,nodeTags,combNames)
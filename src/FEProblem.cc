@@ -34,7 +34,10 @@
 #include "utility/handler/DataOutputFileHandler.h"
 #include "utility/handler/DataOutputDatabaseHandler.h"
 #include "utility/handler/DataOutputStreamHandler.h"
+#include "utility/handler/DataOutputBinaryHandler.h"
 #include "utility/database/FE_Datastore.h"
+#include "utility/actor/actor/CommParameters.h"
+#include "utility/actor/channel/Channel.h"
 
 
 #include "utility/actor/objectBroker/FEM_ObjectBrokerAllClasses.h"
@@ -81,12 +84,70 @@ XC::FE_Datastore *XC::FEProblem::defineDatabase(const std::string &type, const s
     return dataBase; 
   }
 
+//! @brief Creates a new output handler for the recorders. The handler
+//! is owned by the problem (it is deleted by clearAll).
+//!
+//! @param type: handler type (binary_handler, file_handler or stream_handler).
+//! @param name: handler name (and file name for the file based handlers).
+XC::DataOutputHandler *XC::FEProblem::newOutputHandler(const std::string &type, const std::string &name)
+  {
+    DataOutputHandler *retval= nullptr;
+    DataOutputHandler::map_output_handlers::iterator i= output_handlers.find(name);
+    if(i!=output_handlers.end())
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; handler: '" << name
+                  << "' already exists." << std::endl;
+        return (*i).second;
+      }
+    if(type == "binary_handler")
+      retval= new DataOutputBinaryHandler(name);
+    else if(type == "file_handler")
+      retval= new DataOutputFileHandler(name);
+    else if(type == "stream_handler")
+      retval= new DataOutputStreamHandler();
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; handler type: '" << type
+                << "' unknown (binary_handler, file_handler or stream_handler)."
+                << std::endl;
+    if(retval)
+      output_handlers[name]= retval;
+    return retval;
+  }
+
+//! @brief Sends the model through the channel (the process at the
+//! other side receives it with receiveModel).
+int XC::FEProblem::sendModel(Channel &theChannel,const int &commitTag)
+  {
+    CommParameters cp(commitTag,theChannel);
+    const int retval= preprocessor.sendSelf(cp);
+    if(retval<0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; preprocessor failed to sendSelf.\n";
+    return retval;
+  }
+
+//! @brief Receives the model sent with sendModel through the channel.
+int XC::FEProblem::receiveModel(Channel &theChannel,const int &commitTag)
+  {
+    CommParameters cp(commitTag,theChannel,theBroker);
+    const int retval= preprocessor.recvSelf(cp);
+    if(retval<0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; preprocessor failed to recvSelf.\n";
+    return retval;
+  }
+
 XC::FEProblem::~FEProblem(void)
   { clearAll(); }
 
 //! @brief Delete all entities in the FE problem
 void XC::FEProblem::clearAll(void)
   {
+    Domain *dom= getDomain();
+    if(dom) // the recorders write through the output handlers.
+      dom->removeRecorders();
     for(DataOutputHandler::map_output_handlers::iterator i= output_handlers.begin();i!=output_handlers.end();i++)
       {
         DataOutputHandler *tmp= (*i).second;
@@ -41,6 +41,7 @@ namespace XC {
 class Domain;
 class FE_Datastore;
 class FEM_ObjectBrokerAllClasses;
+class Channel;
 
 //! @mainpage <a href="https://sites.google.com/site/xcfemanalysis/" target="_new">XC</a> Open source finite element analysis program.
 //! @author Luis C. Pérez Tato/Ana Ortega.
@@ -98,6 +99,9 @@ class FEProblem: public CommandEntity
       { return gVERSION_SHORT; }
     void clearAll(void);
     FE_Datastore *defineDatabase(const std::string &, const std::string &);
+    DataOutputHandler *newOutputHandler(const std::string &, const std::string &);
+    int sendModel(Channel &,const int &commitTag= 0);
+    int receiveModel(Channel &,const int &commitTag= 0);
     inline FE_Datastore *getDataBase(void)
       { return dataBase; }
     inline const Preprocessor &getPreprocessor(void) const
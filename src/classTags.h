@@ -389,6 +389,7 @@
 #define EquiALGORITHM_TAGS_PeriodicNewton       9
 #define EquiALGORITHM_TAGS_SecantNewton         10
 #define EquiALGORITHM_TAGS_AccelNewton          11
+#define EquiALGORITHM_TAGS_AdaptiveNewton       12
 
 #define ACCELERATOR_TAGS_Krylov		1
 #define ACCELERATOR_TAGS_Secant		2
@@ -456,6 +457,7 @@
 #define LinSOE_TAGS_SparseGenRowLinSOE		20
 #define LinSOE_TAGS_DistributedSparseGenRowLinSOE       21
 #define LinSOE_TAGS_DistributedDiagonalSOE 22
+#define LinSOE_TAGS_ElementByElementLinSOE 23
 
 #define SOLVER_TAGS_FullGenLinLapackSolver  	1
 #define SOLVER_TAGS_BandGenLinLapackSolver  	2
@@ -479,6 +481,7 @@
 #define SOLVER_TAGS_DiagonalDirectSolver 20
 #define SOLVER_TAGS_PetscSparseSeqSolver 21
 #define SOLVER_TAGS_DistributedDiagonalSolver 22
+#define SOLVER_TAGS_PCG_LinSolver 23
 
 
 #define RECORDER_TAGS_ElementRecorder		1
@@ -498,10 +501,12 @@
 #define RECORDER_TAGS_NodePropRecorder		115
 #define RECORDER_TAGS_ElementPropRecorder	215
 #define RECORDER_TAGS_EnvelopeData              16
+#define RECORDER_TAGS_VtuRecorder               17
 
 #define DATAHANDLER_TAGS_DataOutputStreamHandler		1
 #define DATAHANDLER_TAGS_DataOutputFileHandler		2
 #define DATAHANDLER_TAGS_DataOutputDatabaseHandler		3
+#define DATAHANDLER_TAGS_DataOutputBinaryHandler		4
 
 #define DomDecompALGORITHM_TAGS_DomainDecompAlgo 1
 
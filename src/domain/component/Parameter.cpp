@@ -179,7 +179,7 @@ int XC::Parameter::addObject(int paramID, MovableObject *object)
     if(numObjects == maxNumObjects)
       {
         maxNumObjects+= expandSize;
-        theComponents.resize(maxNumObjects, nullptr);
+        theObjects.resize(maxNumObjects, nullptr);
         parameterID.resize(maxNumObjects,0);
       }
     parameterID[numObjects]= paramID;
@@ -118,8 +118,9 @@ void XC::Domain::free_mem(void)
 //! @param owr: object that contains this one.
 XC::Domain::Domain(CommandEntity *owr,DataOutputHandler::map_output_handlers *oh)
   :ObjWithRecorders(owr,oh),timeTracker(),CallbackCommit(""), dbTag(0),
-   currentGeoTag(0), hasDomainChangedFlag(false), commitTag(0),
-   mesh(this), constraints(this), theRegions(nullptr),
+   currentGeoTag(0), hasDomainChangedFlag(false), hasTopologyChangedFlag(false),
+   lastTopologyGeoTag(0), commitTag(0),
+   recordOnCommit(true), mesh(this), constraints(this), theRegions(nullptr),
    nmbCombActual(""), lastChannel(0), lastGeoSendTag(-1) {}
 
 //! @brief Constructor.
@@ -136,7 +137,9 @@ XC::Domain::Domain(CommandEntity *owr,DataOutputHandler::map_output_handlers *oh
 //! @param numNodeLockers: number of node lockers.
 XC::Domain::Domain(CommandEntity *owr,int numNodes, int numElements, int numSPs, int numMPs, int numLoadPatterns,int numNodeLockers,DataOutputHandler::map_output_handlers *oh)
   :ObjWithRecorders(owr,oh),timeTracker(), CallbackCommit(""), dbTag(0),
-   currentGeoTag(0), hasDomainChangedFlag(false), commitTag(0), mesh(this),
+   currentGeoTag(0), hasDomainChangedFlag(false), hasTopologyChangedFlag(false),
+   lastTopologyGeoTag(0), commitTag(0),
+   recordOnCommit(true), mesh(this),
    constraints(this), theRegions(nullptr), nmbCombActual(""), lastChannel(0),
    lastGeoSendTag(-1) {}
 
@@ -176,8 +179,10 @@ void XC::Domain::clearAll(void)
 
     // rest the flag to be as initial
     hasDomainChangedFlag = false;
+    hasTopologyChangedFlag = false;
 
     currentGeoTag = 0;
+    lastTopologyGeoTag = 0;
     lastGeoSendTag = -1;
     lastChannel = 0;
   }
@@ -210,10 +215,18 @@ void XC::Domain::setDeadSRF(const double &d)
 bool XC::Domain::addElement(Element *element)
   { return mesh.addElement(element); }
 
+//! @brief Adds to the domain the elements being passed as parameter.
+bool XC::Domain::addElements(const std::vector<Element *> &elements)
+  { return mesh.addElements(elements); }
+
 //! @brief Adds to the domain the node being passed as parameter.
 bool XC::Domain::addNode(Node * node)
   { return mesh.addNode(node); }
 
+//! @brief Adds to the domain the nodes being passed as parameter.
+bool XC::Domain::addNodes(const std::vector<Node *> &nodes)
+  { return mesh.addNodes(nodes); }
+
 //! @brief Adds a single freedom constraint to the domain.
 //!
 //! To add the single point constraint pointed to by spConstraint to the
@@ -227,7 +240,7 @@ bool XC::Domain::addSFreedom_Constraint(SFreedom_Constraint *spConstraint)
     if(result)
       {
         spConstraint->setDomain(this);
-        this->domainChange();
+        this->domainConstraintChange();
       }
     return true;
   }
@@ -280,7 +293,7 @@ bool XC::Domain::addSFreedom_Constraint(SFreedom_Constraint *spConstraint, int p
       }
 
     spConstraint->setDomain(this);
-    this->domainChange();
+    this->domainConstraintChange();
     return true;
   }
 
@@ -302,10 +315,9 @@ bool XC::Domain::addNodalLoad(NodalLoad *load, int pattern)
   {
     bool result= constraints.addNodalLoad(load,pattern);
     if(result)
-      {
-        load->setDomain(this); // done in LoadPattern::addNodalLoad()
-        this->domainChange();
-      }
+      load->setDomain(this); // done in LoadPattern::addNodalLoad()
+    // loads don't change the analysis model so domainChange()
+    // is not invoked.
     return result;
   }
 
@@ -337,7 +349,8 @@ bool XC::Domain::addElementalLoad(ElementalLoad *load, int pattern)
       }
 
     // load->setDomain(this); // done in LoadPattern::addElementalLoad()
-    this->domainChange();
+    // loads don't change the analysis model so domainChange()
+    // is not invoked.
     return result;
   }
 
@@ -357,7 +370,7 @@ bool XC::Domain::removeNode(int tag)
 //! removeComponent(tag)} on the container for the single point
 //! constraints. Returns \f$0\f$ if the constraint was not in the domain,
 //! otherwise the domain invokes {\em setDomain(nullptr)} on the constraint and
-//! domainChange() on itself before a pointer to the constraint is
+//! domainConstraintChange() on itself before a pointer to the constraint is
 //! returned. Note this will only remove SFreedom\_Constraints which have been
 //! added to the domain and not directly to LoadPatterns.
 //!
@@ -369,7 +382,7 @@ bool XC::Domain::removeSFreedom_Constraint(int theNode, int theDOF, int loadPatt
   {
     bool retval= constraints.removeSFreedom_Constraint(theNode,theDOF,loadPatternTag);
     if(retval)
-      domainChange();
+      domainConstraintChange();
     return retval;
   }
 
@@ -381,7 +394,7 @@ bool XC::Domain::removeSFreedom_Constraint(int tag)
   {
     bool retval= constraints.removeSFreedom_Constraint(tag);
     if(retval)
-      domainChange();
+      domainConstraintChange();
     return retval;
   }
 
@@ -432,7 +445,10 @@ bool XC::Domain::addLoadPattern(LoadPattern *load)
     if(result)
       {
         load->setDomain(this);
-        domainChange();
+        // only the single freedom constraints of the pattern
+        // (if any) need to be handled by the analysis.
+        if(load->getNumSPs()>0)
+          domainConstraintChange();
       }
     else
       {
@@ -451,7 +467,8 @@ bool XC::Domain::addNodeLocker(NodeLocker *nl)
     if(result)
       {
         nl->setDomain(this);
-        domainChange();
+        if(nl->getNumSPs()>0)
+          domainConstraintChange();
       }
     return result;
   }
@@ -498,7 +515,7 @@ bool XC::Domain::removeLoadPattern(int tag)
         // mark the domain has having changed if numSPs > 0
         // as the constraint handlers have to be redone
         if(numSPs>0)
-          domainChange();
+          domainConstraintChange();
       }
     // finally return the load pattern
     return result;
@@ -514,7 +531,7 @@ bool XC::Domain::removeNodeLocker(int tag)
         // mark the domain has having changed if numSPs > 0
         // as the constraint handlers have to be redone
         if(numSPs>0)
-          domainChange();
+          domainConstraintChange();
       }
     // finally return the node locker
     return result;
@@ -568,7 +585,7 @@ void XC::Domain::removeLPs(void)
     // mark the domain has having changed if numSPs > 0
     // as the constraint handlers have to be redone
     if(numSPs>0)
-      domainChange();
+      domainConstraintChange();
   }
 
 //! @brief Remove all node lockers from domain.
@@ -578,7 +595,7 @@ void XC::Domain::removeNLs(void)
     // mark the domain has having changed if numSPs > 0
     // as the constraint handlers have to be redone
     if(numSPs>0)
-      domainChange();
+      domainConstraintChange();
   }
 
 //! @brief Removes from domain the nodal load being passed as parameter.
@@ -601,7 +618,7 @@ bool XC::Domain::removeSFreedom_Constraint(int singleFreedomTag, int loadPattern
   {
     bool removed= constraints.removeSFreedom_Constraint(singleFreedomTag,loadPattern);
     if(removed)
-      this->domainChange();
+      this->domainConstraintChange();
     return removed;
   }
 
@@ -802,13 +819,23 @@ int XC::Domain::commit(void)
     // set the new committed time in the domain
     setCommittedTime(timeTracker.getCurrentTime());
 
-    ObjWithRecorders::record(commitTag,timeTracker.getCurrentTime()); //Llama al método record de todos los recorders.
+    if(recordOnCommit)
+      ObjWithRecorders::record(commitTag,timeTracker.getCurrentTime()); //Llama al método record de todos los recorders.
 
     // update the commitTag
     commitTag++;
     return 0;
   }
 
+//! @brief Enable or disable the call to the recorders on each commit
+//! (used by analyses that record at times other than the step ends).
+void XC::Domain::setRecordOnCommit(const bool &b)
+  { recordOnCommit= b; }
+
+//! @brief Return true if the recorders are called on each commit.
+bool XC::Domain::getRecordOnCommit(void) const
+  { return recordOnCommit; }
+
 //! @brief Return the domain to its last commited state.
 //!
 //! To return the domain to the state it was in at the last commit. The
@@ -986,7 +1013,10 @@ double XC::Domain::getTotalMass(void) const
 //! @brief Set the domain stamp to be \p newStamp. Domain stamp is the
 //! integer returned by hasDomainChanged(). 
 void XC::Domain::setDomainChangeStamp(int newStamp)
-  { currentGeoTag= newStamp; }
+  {
+    currentGeoTag= newStamp;
+    lastTopologyGeoTag= newStamp; // assume the worst.
+  }
 
 
 //! @brief Sets a flag indicating that the integer returned in the next call to 
@@ -994,9 +1024,23 @@ void XC::Domain::setDomainChangeStamp(int newStamp)
 //! 
 //! Sets a flag indicating that the integer returned in the next call to 
 //! hasDomainChanged() must be incremented by \f$1\f$. This method is
-//! invoked whenever a Node, Element or Constraint object is added to the
-//! domain.  
+//! invoked whenever a Node, Element or multi-freedom constraint is added
+//! to (or removed from) the domain.  
 void XC::Domain::domainChange(void)
+  {
+    hasDomainChangedFlag= true;
+    hasTopologyChangedFlag= true;
+  }
+
+//! @brief Marks a change in the single freedom constraints of the domain.
+//!
+//! Like domainChange() the domain stamp will be incremented in the next
+//! call to hasDomainChanged() but, as the nodes, elements and
+//! multi-freedom constraints remain the same, the analysis can update
+//! only the objects that enforce the single freedom constraints (see
+//! getTopologyChangeStamp()). Changes that affect only the loads don't
+//! modify the stamp at all.
+void XC::Domain::domainConstraintChange(void)
   { hasDomainChangedFlag= true; }
 
 //! @brief Returns true if the model has changed.
@@ -1016,8 +1060,13 @@ int XC::Domain::hasDomainChanged(void)
     if(result)
       {
         currentGeoTag++;
-        mesh.setGraphBuiltFlags(false);
+        if(hasTopologyChangedFlag)
+          {
+            lastTopologyGeoTag= currentGeoTag;
+            mesh.setGraphBuiltFlags(false);
+          }
       }
+    hasTopologyChangedFlag= false;
     // return the integer so user can determine if domain has changed
     // since their last call to this method
     return currentGeoTag;
@@ -1154,6 +1203,8 @@ int XC::Domain::recvData(const CommParameters &cp)
         // this way if restoring froma a database and domain has not changed for the analysis
         // the analysis will not have to to do a domainChanged() operation
         hasDomainChangedFlag= false;
+        hasTopologyChangedFlag= false;
+        lastTopologyGeoTag= geoTag;
       }
 
     res+= cp.receiveMovable(mesh,getDbTagData(),CommMetaData(4));
@@ -122,7 +122,10 @@ class Domain: public ObjWithRecorders, public DistributedBase
     int dbTag; //!< Tag for the database.
     int currentGeoTag; //!< an integer used to mark if domain has changed
     bool hasDomainChangedFlag; //!< a bool flag used to indicate if GeoTag needs to be ++
+    bool hasTopologyChangedFlag; //!< true if the pending change affects nodes, elements or multi-freedom constraints.
+    int lastTopologyGeoTag; //!< value of currentGeoTag after the last topology change.
     int commitTag;
+    bool recordOnCommit; //!< if true, commit calls the recorders.
     Mesh mesh; //!< Nodes and element container.
     ConstrContainer constraints;//!< Constraint container.
     Vector theEigenvalues; //!< Eigenvalues.
@@ -151,7 +154,9 @@ class Domain: public ObjWithRecorders, public DistributedBase
 
     // methods to populate a domain
     virtual bool addElement(Element *);
+    bool addElements(const std::vector<Element *> &);
     virtual bool addNode(Node *);
+    bool addNodes(const std::vector<Node *> &);
     virtual bool addSFreedom_Constraint(SFreedom_Constraint *);
     virtual bool addMFreedom_Constraint(MFreedom_Constraint *);
     virtual bool addMRMFreedom_Constraint(MRMFreedom_Constraint *);
@@ -233,6 +238,8 @@ class Domain: public ObjWithRecorders, public DistributedBase
     virtual int setRayleighDampingFactors(const RayleighDampingFactors &rF);
 
     virtual int commit(void);
+    void setRecordOnCommit(const bool &);
+    bool getRecordOnCommit(void) const;
     virtual int revertToLastCommit(void);
     virtual int revertToStart(void);
     virtual int update(void);
@@ -261,7 +268,13 @@ class Domain: public ObjWithRecorders, public DistributedBase
 
      // methods for other objects to determine if model has changed
     virtual void domainChange(void);
+    virtual void domainConstraintChange(void);
     virtual int hasDomainChanged(void);
+    //! @brief Return the domain stamp of the last change that affected
+    //! the topology of the model (nodes, elements or multi-freedom
+    //! constraints).
+    inline int getTopologyChangeStamp(void) const
+      { return lastTopologyGeoTag; }
     virtual void setDomainChangeStamp(int newStamp);
 
     virtual int addRegion(MeshRegion &theRegion);
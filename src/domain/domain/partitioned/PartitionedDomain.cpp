@@ -85,6 +85,7 @@
 #include <domain/constraints/SFreedom_Constraint.h>
 #include <utility/recorder/Recorder.h>
 #include "domain/mesh/element/utils/NodePtrsWithIDs.h"
+#include <algorithm>
 
 void XC::PartitionedDomain::free_mem(void)
   {
@@ -120,13 +121,18 @@ void XC::PartitionedDomain::alloc(void)
       }
   }
 
+//! @brief Number of threads used by default to process the subdomains
+//! (one: the subdomains are processed sequentially unless more threads
+//! are requested with setDefaultNumThreads or setNumThreads).
+size_t XC::PartitionedDomain::defaultNumThreads= 1;
+
 //! @brief Constructor.
 //!
 //! @param owr: object that encloses this one.
 //! @param oh: to DEPRECATE.
 XC::PartitionedDomain::PartitionedDomain(CommandEntity *owr,DataOutputHandler::map_output_handlers *oh)
   :Domain(owr,oh), theSubdomains(nullptr),theDomainPartitioner(nullptr),
-   theSubdomainIter(nullptr), mySubdomainGraph()
+   theSubdomainIter(nullptr), mySubdomainGraph(), numThreads(defaultNumThreads)
   { alloc(); }
 
 
@@ -141,7 +147,7 @@ XC::PartitionedDomain::PartitionedDomain(CommandEntity *owr,DataOutputHandler::m
 //! @param oh: to DEPRECATE.
 XC::PartitionedDomain::PartitionedDomain(CommandEntity *owr,DomainPartitioner &thePartitioner,DataOutputHandler::map_output_handlers *oh)
   :Domain(owr,oh), theSubdomains(nullptr),theDomainPartitioner(&thePartitioner),
- theSubdomainIter(nullptr), mySubdomainGraph()
+ theSubdomainIter(nullptr), mySubdomainGraph(), numThreads(defaultNumThreads)
   { alloc(); }
 
 
@@ -163,7 +169,7 @@ XC::PartitionedDomain::PartitionedDomain(CommandEntity *owr,int numNodes, int nu
 
   : Domain(owr,numNodes,0,numSPs,numMPs,numLoadPatterns,numNodeLockers,oh),
     theSubdomains(nullptr),theDomainPartitioner(&thePartitioner),theSubdomainIter(nullptr),
-    mySubdomainGraph()
+    mySubdomainGraph(), numThreads(defaultNumThreads)
   { alloc(); }
 
 //! @brief Destructor.
@@ -924,12 +930,12 @@ int XC::PartitionedDomain::update(void)
     // do the same for all the subdomains
     if(theSubdomains != 0)
       {
+        computeSubdomainsNodalResponse();
         ArrayOfTaggedObjectsIter theSubsIter(*theSubdomains);
         TaggedObject *theObject;
         while((theObject= theSubsIter()) != 0)
           {
             Subdomain *theSub= dynamic_cast<Subdomain *>(theObject);
-            theSub->computeNodalResponse();
             theSub->update();
           }
       }
@@ -980,12 +986,12 @@ int XC::PartitionedDomain::update(double newTime, double dT)
     // do the same for all the subdomains
     if(theSubdomains != 0)
       {
+        computeSubdomainsNodalResponse();
         ArrayOfTaggedObjectsIter theSubsIter(*theSubdomains);
         TaggedObject *theObject;
         while((theObject= theSubsIter()) != 0)
           {
             Subdomain *theSub= dynamic_cast<Subdomain *>(theObject);
-            theSub->computeNodalResponse();
             theSub->update(newTime, dT);
           }
       }
@@ -1292,6 +1298,160 @@ int XC::PartitionedDomain::getNumSubdomains(void)
     return theSubdomains->getNumComponents();
   }
 
+//! @brief Sets the number of threads used to condense the subdomains
+//! and to compute their internal response (if less than two the
+//! subdomains are processed sequentially).
+void XC::PartitionedDomain::setNumThreads(const size_t &nt)
+  { numThreads= std::max(nt,size_t(1)); }
+
+//! @brief Returns the number of threads used to process the subdomains.
+size_t XC::PartitionedDomain::getNumThreads(void) const
+  { return numThreads; }
+
+//! @brief Sets the number of threads used to process the subdomains
+//! by the partitioned domains created from now on (one to process
+//! them sequentially).
+void XC::PartitionedDomain::setDefaultNumThreads(const size_t &nt)
+  { defaultNumThreads= std::max(nt,size_t(1)); }
+
+//! @brief Returns the number of threads used to process the subdomains
+//! by the partitioned domains created from now on.
+size_t XC::PartitionedDomain::getDefaultNumThreads(void)
+  { return defaultNumThreads; }
+
+//! @brief Returns the subdomains whose tangent and residual are
+//! condensed into this domain (those that don't do an independent analysis).
+std::vector<XC::Subdomain *> XC::PartitionedDomain::getCondensedSubdomains(void)
+  {
+    std::vector<Subdomain *> retval;
+    if(theSubdomains)
+      {
+        ArrayOfTaggedObjectsIter theSubsIter(*theSubdomains);
+        TaggedObject *theObject;
+        while((theObject= theSubsIter()) != 0)
+          {
+            Subdomain *theSub= dynamic_cast<Subdomain *>(theObject);
+            if(theSub && !theSub->doesIndependentAnalysis())
+              retval.push_back(theSub);
+          }
+      }
+    return retval;
+  }
+
+//! @brief Invokes the method on each of the subdomains. The subdomains
+//! are distributed among the threads of a pool that is created on first
+//! use and kept alive between calls. Returns the first negative result
+//! (if any).
+int XC::PartitionedDomain::forEachSubdomain(std::vector<Subdomain *> &subdomains,int (Subdomain::*method)(void))
+  {
+    const size_t sz= subdomains.size();
+    std::vector<int> results(sz,0);
+    if((numThreads<2) || (sz<2))
+      {
+        for(size_t i= 0;i<sz;i++)
+          results[i]= (subdomains[i]->*method)();
+      }
+    else
+      {
+        if(workers.getNumThreads()!=numThreads)
+          workers.resize(numThreads);
+        workers.run(sz,[&subdomains,method,&results](size_t i)
+          { results[i]= (subdomains[i]->*method)(); });
+      }
+    int retval= 0;
+    for(size_t i= 0;i<sz;i++)
+      if(results[i]<0)
+        {
+          std::cerr << getClassName() << "::" << __FUNCTION__
+                    << "; subdomain: " << subdomains[i]->getTag()
+                    << " failed.\n";
+          if(retval==0)
+            retval= results[i];
+        }
+    return retval;
+  }
+
+//! @brief Forms the condensed tangents of the subdomains before they
+//! are assembled into the interface system.
+//!
+//! The tangents are assembled sequentially (the element code is not
+//! thread safe) and then the subdomains are factorized and condensed
+//! concurrently. The FE_Elements of the subdomains will use the
+//! precomputed results (see Subdomain::computeTang). If there is only
+//! one thread or one subdomain it does nothing (the tangents are
+//! computed by the FE_Elements as usual).
+int XC::PartitionedDomain::formSubdomainTangents(void)
+  {
+    int retval= 0;
+    std::vector<Subdomain *> subdomains= getCondensedSubdomains();
+    if((numThreads>1) && (subdomains.size()>1))
+      {
+        for(std::vector<Subdomain *>::iterator i= subdomains.begin();i!=subdomains.end();i++)
+          {
+            const int res= (*i)->assembleTang();
+            if(res<0)
+              return res;
+          }
+        retval= forEachSubdomain(subdomains,&Subdomain::condenseTang);
+      }
+    return retval;
+  }
+
+//! @brief Forms the condensed residuals of the subdomains before they
+//! are assembled into the interface system (see formSubdomainTangents).
+int XC::PartitionedDomain::formSubdomainResiduals(void)
+  {
+    int retval= 0;
+    std::vector<Subdomain *> subdomains= getCondensedSubdomains();
+    if((numThreads>1) && (subdomains.size()>1))
+      {
+        for(std::vector<Subdomain *>::iterator i= subdomains.begin();i!=subdomains.end();i++)
+          {
+            const int res= (*i)->assembleResidual();
+            if(res<0)
+              return res;
+          }
+        retval= forEachSubdomain(subdomains,&Subdomain::condenseResidual);
+      }
+    return retval;
+  }
+
+//! @brief Computes the response of the subdomains from the solution
+//! of the interface system. The back substitution of the internal
+//! dofs is done concurrently, the update of the nodes and the elements
+//! is done sequentially.
+int XC::PartitionedDomain::computeSubdomainsNodalResponse(void)
+  {
+    int retval= 0;
+    std::vector<Subdomain *> subdomains;
+    if(theSubdomains)
+      {
+        ArrayOfTaggedObjectsIter theSubsIter(*theSubdomains);
+        TaggedObject *theObject;
+        while((theObject= theSubsIter()) != 0)
+          subdomains.push_back(dynamic_cast<Subdomain *>(theObject));
+      }
+    if((numThreads>1) && (subdomains.size()>1))
+      {
+        for(std::vector<Subdomain *>::iterator i= subdomains.begin();i!=subdomains.end();i++)
+          {
+            const int res= (*i)->setExternalResponse();
+            if(res<0) retval= res;
+          }
+        const int res= forEachSubdomain(subdomains,&Subdomain::solveInternalResponse);
+        if(res<0) retval= res;
+        for(std::vector<Subdomain *>::iterator i= subdomains.begin();i!=subdomains.end();i++)
+          {
+            const int res= (*i)->updateInternalResponse();
+            if(res<0) retval= res;
+          }
+      }
+    else
+      for(std::vector<Subdomain *>::iterator i= subdomains.begin();i!=subdomains.end();i++)
+        (*i)->computeNodalResponse();
+    return retval;
+  }
+
 //! @brief Return the Subdomain whose tag is given by \p tag.
 XC::Subdomain *XC::PartitionedDomain::getSubdomainPtr(int tag)
   {
@@ -68,6 +68,8 @@
 
 #include <domain/domain/Domain.h>
 #include "solution/graph/graph/Graph.h"
+#include "utility/WorkerPool.h"
+#include <vector>
 
 namespace XC {
 class DomainPartitioner;
@@ -99,12 +101,17 @@ class PartitionedDomain: public Domain
     PartitionedDomainEleIter   *theEleIter;
     
     Graph mySubdomainGraph; //! Grafo de conectividad de subdomains.
+    size_t numThreads; //!< number of threads used to process the subdomains.
+    WorkerPool workers; //!< threads that process the subdomains.
+    static size_t defaultNumThreads; //!< number of threads for new partitioned domains.
     void alloc(void);
     void free_mem(void);
   protected:
     int barrierCheck(int result);
     DomainPartitioner *getPartitioner(void) const;
     virtual int buildEleGraph(Graph &theEleGraph);
+    std::vector<Subdomain *> getCondensedSubdomains(void);
+    int forEachSubdomain(std::vector<Subdomain *> &,int (Subdomain::*)(void));
   public:
     PartitionedDomain(CommandEntity *owr,DataOutputHandler::map_output_handlers *oh);    
     PartitionedDomain(CommandEntity *owr,DomainPartitioner &thePartitioner,DataOutputHandler::map_output_handlers *oh);    
@@ -172,6 +179,15 @@ class PartitionedDomain: public Domain
     virtual bool removeExternalNode(int tag);        
     virtual Graph &getSubdomainGraph(void);
 
+    // shared memory execution of the subdomain computations.
+    void setNumThreads(const size_t &);
+    size_t getNumThreads(void) const;
+    static void setDefaultNumThreads(const size_t &);
+    static size_t getDefaultNumThreads(void);
+    int formSubdomainTangents(void);
+    int formSubdomainResiduals(void);
+    int computeSubdomainsNodalResponse(void);
+
     // nodal methods required in domain interface for parallel interprter
     virtual double getNodeDisp(int nodeTag, int dof, int &errorFlag);
     virtual int setMass(const Matrix &mass, int nodeTag);
@@ -47,3 +47,9 @@ class_<XC::Domain, bases<XC::ObjWithRecorders>, boost::noncopyable >("Domain", n
   .def("calculateNodalReactions",&XC::Domain::calculateNodalReactions,"triggers nodal reaction calculation.")  
   .def("checkNodalReactions",&XC::Domain::checkNodalReactions,"checkNodalReactions(tolerande): check that reactions at nodes correspond to constrained degrees of freedom.")  
   ;
+
+class_<XC::PartitionedDomain, bases<XC::Domain>, boost::noncopyable >("PartitionedDomain", no_init)
+  .add_property("numThreads",&XC::PartitionedDomain::getNumThreads,&XC::PartitionedDomain::setNumThreads,"number of threads used to condense the subdomains and to compute their internal response (one: sequential).")
+  .def("getDefaultNumThreads",&XC::PartitionedDomain::getDefaultNumThreads,"Return the number of threads used to process the subdomains of the partitioned domains created from now on.").staticmethod("getDefaultNumThreads")
+  .def("setDefaultNumThreads",&XC::PartitionedDomain::setDefaultNumThreads,"Set the number of threads used to process the subdomains of the partitioned domains created from now on (one: sequential, the default).").staticmethod("setDefaultNumThreads")
+  ;
@@ -156,6 +156,18 @@ int XC::ActorSubdomain::run(void)
 	    this->sendVector(theVect);
 	    break;	    
 
+	  case ShadowActorSubdomain_getElementCosts:
+	    {
+	      ID eleTags(msgData(1));
+	      this->recvID(eleTags);
+	      this->sendVector(this->getElementCosts(eleTags));
+	    }
+	    break;
+
+	  case ShadowActorSubdomain_resetElementCosts:
+	    this->resetElementCosts();
+	    break;
+
  	  case ShadowActorSubdomain_addElement:
 	    theType = msgData(1);
 	    dbTag = msgData(2);
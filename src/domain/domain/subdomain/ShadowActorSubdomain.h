@@ -104,6 +104,8 @@ static const int ShadowActorSubdomain_getResistingForce = 54;
 static const int ShadowActorSubdomain_computeTang = 55;
 static const int ShadowActorSubdomain_computeResidual = 56;
 static const int ShadowActorSubdomain_getCost = 60;
+static const int ShadowActorSubdomain_getElementCosts = 61;
+static const int ShadowActorSubdomain_resetElementCosts = 62;
 static const int ShadowActorSubdomain_setCommitTag = 25;
 static const int ShadowActorSubdomain_setCurrentTime = 26;
 static const int ShadowActorSubdomain_setCommittedTime = 27;
@@ -1208,6 +1208,30 @@ double XC::ShadowSubdomain::getCost(void)
   }
 
 
+//! @brief Asks the remote subdomain for the time spent in the update
+//! of each of the elements whose tags are passed as parameter.
+XC::Vector XC::ShadowSubdomain::getElementCosts(const ID &eleTags)
+  {
+    const int sz= eleTags.Size();
+    Vector retval(sz);
+    if(sz>0)
+      {
+        msgData(0)= ShadowActorSubdomain_getElementCosts;
+        msgData(1)= sz;
+        this->sendID(msgData);
+        this->sendID(eleTags);
+        this->recvVector(retval);
+      }
+    return retval;
+  }
+
+//! @brief Discards the element costs measured by the remote subdomain.
+void XC::ShadowSubdomain::resetElementCosts(void)
+  {
+    msgData(0)= ShadowActorSubdomain_resetElementCosts;
+    this->sendID(msgData);
+  }
+
 int XC::ShadowSubdomain::sendSelf(CommParameters &cp)
   {
     std::cerr << "XC::ShadowSubdomain::sendSelf() ";
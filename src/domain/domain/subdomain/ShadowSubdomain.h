@@ -216,6 +216,8 @@ class ShadowSubdomain: public Shadow, public Subdomain
     virtual int recvSelf(const CommParameters &);    
 
     virtual double getCost(void);
+    virtual Vector getElementCosts(const ID &);
+    virtual void resetElementCosts(void);
     
     virtual  void Print(std::ostream &s, int flag =0);
 
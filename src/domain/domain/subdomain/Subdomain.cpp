@@ -106,6 +106,7 @@ XC::Subdomain::Subdomain(int tag,DataOutputHandler::map_output_handlers *oh,Comm
   realCost(0.0),cpuCost(0.0),pageCost(0),
   theAnalysis(nullptr), extNodes(nullptr), theFEele(nullptr),
   thePartitionedModelBuilder(nullptr),
+  tangPrecomputed(false), residualPrecomputed(false),
   mapBuilt(false),map(0),mappedVect(0),mappedMatrix(0)
   {
     // init the arrays.
@@ -345,6 +346,7 @@ int XC::Subdomain::getNumNodes(void) const
 //! all the Nodes in the Subdomain, invoking commitState() on the Nodes.
 int XC::Subdomain::commit(void)
   {
+    clearPrecomputed();
     Domain::commit();
 
     NodeIter &theNodes = this->getNodes();
@@ -356,6 +358,7 @@ int XC::Subdomain::commit(void)
 
 int XC::Subdomain::revertToLastCommit(void)
   {
+    clearPrecomputed();
     Domain::revertToLastCommit();
 
     NodeIter &theNodes = this->getNodes();
@@ -367,6 +370,7 @@ int XC::Subdomain::revertToLastCommit(void)
 
 int XC::Subdomain::revertToStart(void)
   {
+    clearPrecomputed();
     Domain::revertToLastCommit();
 
     NodeIter &theNodes = this->getNodes();
@@ -377,10 +381,16 @@ int XC::Subdomain::revertToStart(void)
   }
 
 int XC::Subdomain::update(void)
-  { return Domain::update(); }
+  {
+    clearPrecomputed();
+    return Domain::update();
+  }
 
 int XC::Subdomain::update(double newTime, double dT)
-  { return Domain::update(newTime, dT); }
+  {
+    clearPrecomputed();
+    return Domain::update(newTime, dT);
+  }
 
 //! @brief Print stuff.
 void XC::Subdomain::Print(std::ostream &os, int flag)
@@ -470,6 +480,7 @@ int XC::Subdomain::setAnalysisConvergenceTest(ConvergenceTest &theTest)
 int XC::Subdomain::invokeChangeOnAnalysis(void)
   {
     int result = 0;
+    clearPrecomputed();
     if(theAnalysis)
       result = theAnalysis->domainChanged();
 
@@ -670,6 +681,11 @@ int XC::Subdomain::setRayleighDampingFactors(const RayleighDampingFactors &rF)
 //! Returns the result of invoking \p formTang.
 int XC::Subdomain::computeTang(void)
   {
+    if(tangPrecomputed) // already computed by condenseTang.
+      {
+        tangPrecomputed= false;
+        return 0;
+      }
     if(theAnalysis)
       {
         theTimer.start();
@@ -692,6 +708,11 @@ int XC::Subdomain::computeTang(void)
 //! Returns the result of invoking \p formResidual.
 int XC::Subdomain::computeResidual(void)
   {
+    if(residualPrecomputed) // already computed by condenseResidual.
+      {
+        residualPrecomputed= false;
+        return 0;
+      }
     if(theAnalysis)
       {
         theTimer.start();
@@ -788,6 +809,7 @@ const XC::Vector &XC::Subdomain::getLastExternalSysResponse(void)
 int XC::Subdomain::computeNodalResponse(void)
   {
     int res =0;
+    clearPrecomputed();
     if(theAnalysis)
       res= theAnalysis->computeInternalResponse();
     else
@@ -797,8 +819,106 @@ int XC::Subdomain::computeNodalResponse(void)
   }
 
 
+//! @brief Forgets the tangent and residual condensed by condenseTang
+//! and condenseResidual (called when the state of the subdomain
+//! changes, so the next computeTang or computeResidual does not
+//! return the results of a previous state).
+void XC::Subdomain::clearPrecomputed(void)
+  {
+    tangPrecomputed= false;
+    residualPrecomputed= false;
+  }
+
+//! @brief First step of computeTang: assembles the tangent of
+//! the subdomain (it calls the element code so it must not be
+//! called concurrently).
+int XC::Subdomain::assembleTang(void)
+  {
+    int res= 0;
+    tangPrecomputed= false;
+    if(theAnalysis)
+      res= theAnalysis->assembleTangent();
+    return res;
+  }
+
+//! @brief Second step of computeTang: condenses the tangent
+//! assembled by assembleTang. It can be called concurrently for
+//! different subdomains. The next call to computeTang will
+//! do nothing.
+int XC::Subdomain::condenseTang(void)
+  {
+    int res= 0;
+    if(theAnalysis)
+      {
+        res= theAnalysis->condenseTangent();
+        tangPrecomputed= (res>=0);
+      }
+    return res;
+  }
+
+//! @brief First step of computeResidual: assembles the residual of
+//! the subdomain (it calls the element code so it must not be
+//! called concurrently).
+int XC::Subdomain::assembleResidual(void)
+  {
+    int res= 0;
+    residualPrecomputed= false;
+    if(theAnalysis)
+      res= theAnalysis->assembleResidual();
+    return res;
+  }
+
+//! @brief Second step of computeResidual: condenses the residual
+//! assembled by assembleResidual. It can be called concurrently for
+//! different subdomains. The next call to computeResidual will
+//! do nothing.
+int XC::Subdomain::condenseResidual(void)
+  {
+    int res= 0;
+    if(theAnalysis)
+      {
+        res= theAnalysis->condenseResidual();
+        residualPrecomputed= (res>=0);
+      }
+    return res;
+  }
+
+//! @brief First step of computeNodalResponse: passes the
+//! response of the external nodes to the solver. If there is no
+//! local analysis it invokes computeNodalResponse.
+int XC::Subdomain::setExternalResponse(void)
+  {
+    if(theAnalysis)
+      return theAnalysis->setExternalResponse();
+    else
+      return this->computeNodalResponse();
+  }
+
+//! @brief Second step of computeNodalResponse: computes the
+//! response of the internal dofs. It can be called concurrently
+//! for different subdomains.
+int XC::Subdomain::solveInternalResponse(void)
+  {
+    int res= 0;
+    if(theAnalysis)
+      res= theAnalysis->solveInternalResponse();
+    return res;
+  }
+
+//! @brief Last step of computeNodalResponse: updates the
+//! response of the nodes of the subdomain.
+int XC::Subdomain::updateInternalResponse(void)
+  {
+    int res= 0;
+    clearPrecomputed();
+    if(theAnalysis)
+      res= theAnalysis->updateInternalResponse();
+    return res;
+  }
+
 int XC::Subdomain::newStep(double dT)
   {
+    clearPrecomputed();
     if(theAnalysis)
       return theAnalysis->newStep(dT);
     return 0;
@@ -862,6 +982,22 @@ double XC::Subdomain::getCost(void)
   }
 
 
+//! @brief Return the time spent in the update of each of the elements
+//! whose tags are passed as parameter (see Mesh::getElementCost).
+XC::Vector XC::Subdomain::getElementCosts(const ID &eleTags)
+  {
+    const int sz= eleTags.Size();
+    Vector retval(sz);
+    const Mesh &mesh= getMesh();
+    for(int i= 0;i<sz;i++)
+      retval(i)= mesh.getElementCost(eleTags(i));
+    return retval;
+  }
+
+//! @brief Discards the measured element costs.
+void XC::Subdomain::resetElementCosts(void)
+  { getMesh().resetElementCosts(); }
+
 int XC::Subdomain::buildMap(void) const
   {
     if(mapBuilt == false)
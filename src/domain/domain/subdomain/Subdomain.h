@@ -114,7 +114,10 @@ class Subdomain: public Element, public Domain
     SubdomainNodIter *theNodIter;
 
     PartitionedModelBuilder *thePartitionedModelBuilder;
+    bool tangPrecomputed; //!< true if the condensed tangent has been computed by condenseTang.
+    bool residualPrecomputed; //!< true if the condensed residual has been computed by condenseResidual.
     static Matrix badResult;
+    void clearPrecomputed(void);
   protected:
     virtual int buildMap(void) const;
     mutable bool mapBuilt;
@@ -206,12 +209,24 @@ class Subdomain: public Element, public Domain
     virtual const Vector &getLastExternalSysResponse(void);
     virtual int computeNodalResponse(void);
     virtual int newStep(double deltaT);
+
+    // steps of computeTang, computeResidual and computeNodalResponse
+    // (used by PartitionedDomain to process the subdomains concurrently).
+    int assembleTang(void);
+    int condenseTang(void);
+    int assembleResidual(void);
+    int condenseResidual(void);
+    int setExternalResponse(void);
+    int solveInternalResponse(void);
+    int updateInternalResponse(void);
     virtual bool doesIndependentAnalysis(void);
 
     virtual int sendSelf(CommParameters &);
     virtual int recvSelf(const CommParameters &);
 
     virtual double getCost(void);
+    virtual Vector getElementCosts(const ID &);
+    virtual void resetElementCosts(void);
   };
 } // end of XC namespace
 
@@ -22,6 +22,7 @@
 //utils_python_interface.cxx
 
 #include "python_interface.h"
+#include "domain/domain/partitioned/PartitionedDomain.h"
 
 void export_domain(void)
   {
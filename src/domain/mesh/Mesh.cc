@@ -38,17 +38,22 @@
 #include "domain/mesh/element/ElementIter.h"
 #include "domain/mesh/node/NodeIter.h"
 #include <domain/domain/single/SingleDomEleIter.h>
+#include <chrono>
 #include <domain/domain/single/SingleDomNodIter.h>
 
 #include <utility/tagged/storage/MapOfTaggedObjects.h>
 #include <utility/tagged/storage/MapOfTaggedObjectsIter.h>
 
 #include <solution/graph/graph/Vertex.h>
+#include <solution/graph/graph/VertexIter.h>
+#include "solution/graph/partitioner/GraphPartitioner.h"
 #include <utility/actor/objectBroker/FEM_ObjectBroker.h>
 
 
 #include "domain/mesh/element/utils/NodePtrsWithIDs.h"
+#include "utility/ObjectArena.h"
 #include <climits>
+#include <set>
 #include "xc_utils/src/geom/pos_vec/Pos3d.h"
 
 #include "utility/actor/actor/MovableVector.h"
@@ -74,6 +79,9 @@ void XC::Mesh::free_mem(void)
     theNodIter= nullptr;
     if(theNodes) delete theNodes;
     theNodes= nullptr;
+    // the arena is deleted with its last object.
+    ObjectArena::detach(objectArena);
+    objectArena= nullptr;
   }
 
 //! @brief Allocates memory for containers.
@@ -113,7 +121,10 @@ void XC::Mesh::init_bounds(void)
 //! @brief Constructor.
 XC::Mesh::Mesh(CommandEntity *owr)
   :MeshComponentContainer(owr,DOMAIN_TAG_Mesh), eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false),
-   theBounds(6), lockers(this)
+   theBounds(6), lockers(this), elementTiming(false),
+    useMaterialStateStore(false), useNodalStateStore(false),
+    useSharedElementMatrices(false), useObjectArena(true),
+    objectArena(new ObjectArena("mesh"))
   {
     alloc_containers();
     alloc_iters();
@@ -125,7 +136,11 @@ XC::Mesh::Mesh(CommandEntity *owr)
 //! @brief Constructor.
 XC::Mesh::Mesh(CommandEntity *owr,TaggedObjectStorage &theNodesStorage,TaggedObjectStorage &theElementsStorage)
   : MeshComponentContainer(owr,DOMAIN_TAG_Mesh), eleGraphBuiltFlag(false),
-    nodeGraphBuiltFlag(false), theNodes(&theNodesStorage), theElements(&theElementsStorage), theBounds(6), lockers(this)
+    nodeGraphBuiltFlag(false), theNodes(&theNodesStorage), theElements(&theElementsStorage), theBounds(6), lockers(this),
+    elementTiming(false),
+    useMaterialStateStore(false), useNodalStateStore(false),
+    useSharedElementMatrices(false), useObjectArena(true),
+    objectArena(new ObjectArena("mesh"))
   {
     // init the iters
     alloc_iters();
@@ -144,7 +159,10 @@ XC::Mesh::Mesh(CommandEntity *owr,TaggedObjectStorage &theNodesStorage,TaggedObj
 XC::Mesh::Mesh(CommandEntity *owr,TaggedObjectStorage &theStorage)
   : MeshComponentContainer(owr,DOMAIN_TAG_Mesh),
     eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false),
-    theBounds(6), lockers(this)
+    theBounds(6), lockers(this), elementTiming(false),
+    useMaterialStateStore(false), useNodalStateStore(false),
+    useSharedElementMatrices(false), useObjectArena(true),
+    objectArena(new ObjectArena("mesh"))
   {
     // init the arrays for storing the mesh components
     theStorage.clearAll(); // clear the storage just in case populated
@@ -170,6 +188,13 @@ void XC::Mesh::clearAll(void)
     if(theElements) theElements->clearAll();
     if(theNodes) theNodes->clearAll();
     lockers.clearAll();
+    // release the memory of the arena (if no other
+    // object is using it).
+    if(objectArena)
+      objectArena->release();
+    stateStore.clear();
+    nodalStateStore.clear();
+    sharedMatrices.clear();
 
     // set the bounds around the origin
     theBounds.Zero();
@@ -260,6 +285,63 @@ bool XC::Mesh::addElement(Element *element)
     return result;
   }
 
+//! @brief Appends to the mesh the elements being passed as parameter
+//! (bulk version of addElement).
+//!
+//! The tags are checked in one pass before adding any element
+//! so, if the call fails, no element is added. The domain is marked as
+//! changed and the elements are inserted in the KD tree only once.
+bool XC::Mesh::addElements(const std::vector<Element *> &elements)
+  {
+    bool retval= true;
+    std::set<int> tags;
+    for(std::vector<Element *>::const_iterator i= elements.begin();i!=elements.end();i++)
+      {
+        const Element *element= *i;
+        if(!element)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; pointer to element is null." << std::endl;
+            retval= false;
+            break;
+          }
+        const int eleTag= element->getTag();
+        if(theElements->getComponentPtr(eleTag) || !tags.insert(eleTag).second)
+          {
+            std::clog << getClassName() << "::" << __FUNCTION__
+                      << "; element with tag " << eleTag
+                      << " already exists in model.\n";
+            retval= false;
+            break;
+          }
+      }
+    if(retval)
+      {
+        theElements->setSize(theElements->getNumComponents()+elements.size());
+        Domain *dom= getDomain();
+        for(std::vector<Element *>::const_iterator i= elements.begin();i!=elements.end();i++)
+          {
+            Element *element= *i;
+            if(theElements->addComponent(element))
+              {
+                element->setDomain(dom);
+                element->update();
+              }
+            else
+              {
+                std::cerr << getClassName() << "::" << __FUNCTION__
+                          << "; element " << element->getTag()
+                          << " could not be added to container.\n";
+                retval= false;
+              }
+          }
+        // mark the domain as having been changed
+        dom->domainChange();
+        kdtreeElements.insert(elements.begin(),elements.end());
+      }
+    return retval;
+  }
+
 //! @brief Actualiza los límites del domain.
 void XC::Mesh::update_bounds(const Vector &crds)
   {
@@ -292,6 +374,7 @@ void XC::Mesh::add_node_to_domain(Node *node)
     dom->domainChange();
     update_bounds(node->getCrds());
     kdtreeNodes.insert(*node);
+    nodalStateStore.invalidate();
   }
 
 //! @brief Must only to be called from recvSelf.
@@ -307,6 +390,7 @@ void XC::Mesh::add_nodes_to_domain(void)
         update_bounds(nodePtr->getCrds());
         kdtreeNodes.insert(*nodePtr);
       }
+    nodalStateStore.invalidate();
   }
 
 //! @brief Adds to the domain the node being passed as parameter.
@@ -342,6 +426,63 @@ bool XC::Mesh::addNode(Node * node)
   }
 
 
+//! @brief Adds to the mesh the nodes being passed as parameter
+//! (bulk version of addNode).
+//!
+//! The tags are checked in one pass before adding any node
+//! so, if the call fails, no node is added. The domain is marked as
+//! changed and the nodes are inserted in the KD tree only once.
+bool XC::Mesh::addNodes(const std::vector<Node *> &nodes)
+  {
+    bool retval= true;
+    std::set<int> tags;
+    for(std::vector<Node *>::const_iterator i= nodes.begin();i!=nodes.end();i++)
+      {
+        const Node *node= *i;
+        if(!node)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; pointer to node is null." << std::endl;
+            retval= false;
+            break;
+          }
+        const int nodTag= node->getTag();
+        if(theNodes->getComponentPtr(nodTag) || !tags.insert(nodTag).second)
+          {
+            std::clog << getClassName() << "::" << __FUNCTION__
+                      << "; node with tag " << nodTag
+                      << " already exists in model.\n";
+            retval= false;
+            break;
+          }
+      }
+    if(retval)
+      {
+        theNodes->setSize(theNodes->getNumComponents()+nodes.size());
+        Domain *dom= getDomain();
+        for(std::vector<Node *>::const_iterator i= nodes.begin();i!=nodes.end();i++)
+          {
+            Node *node= *i;
+            if(theNodes->addComponent(node))
+              {
+                node->setDomain(dom);
+                update_bounds(node->getCrds());
+              }
+            else
+              {
+                std::cerr << getClassName() << "::" << __FUNCTION__
+                          << "; node with tag " << node->getTag()
+                          << " could not be added to container.\n";
+                retval= false;
+              }
+          }
+        dom->domainChange();
+        kdtreeNodes.insert(nodes.begin(),nodes.end());
+        nodalStateStore.invalidate();
+      }
+    return retval;
+  }
+
 //! @brief Deletes the element identified by the tag being passed as parameter.
 //!
 //! To remove the element whose tag is given by \p tag from the
@@ -389,6 +530,7 @@ bool XC::Mesh::removeNode(int tag)
 
         Node *nod= dom->getNode(tag);
         if(nod) kdtreeNodes.erase(*nod);
+        nodalStateStore.invalidate();
 
         // mark the domain has having changed
         dom->domainChange();
@@ -679,6 +821,38 @@ XC::Graph &XC::Mesh::getElementGraph(void)
   }
 
 
+//! @brief Partitions the element graph in numParts parts using the
+//! partitioner being passed as parameter. Returns the part (1 through
+//! numParts) assigned to each element (indexed by element tag); if the
+//! partitioner fails the returned map is empty.
+std::map<int,int> XC::Mesh::getElementPartitions(GraphPartitioner &partitioner, const int &numParts)
+  {
+    std::map<int,int> retval;
+    Graph &theGraph= getElementGraph();
+    if(partitioner.partition(theGraph,numParts)<0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; the graph partitioner failed.\n";
+    else
+      {
+        Vertex *vertexPtr= nullptr;
+        VertexIter &theVertices= theGraph.getVertices();
+        while((vertexPtr= theVertices()) != nullptr)
+          retval[vertexPtr->getRef()]= vertexPtr->getColor();
+      }
+    return retval;
+  }
+
+//! @brief Return a Python dictionary with the part assigned to each
+//! element (see getElementPartitions).
+boost::python::dict XC::Mesh::getElementPartitionsPy(GraphPartitioner &partitioner, const int &numParts)
+  {
+    boost::python::dict retval;
+    const std::map<int,int> parts= getElementPartitions(partitioner,numParts);
+    for(std::map<int,int>::const_iterator i= parts.begin();i!=parts.end();i++)
+      retval[i->first]= i->second;
+    return retval;
+  }
+
 //! @brief Builds (if needed) the graph of the domain nodes and
 //! returns a reference to it.
 //!
@@ -768,38 +942,90 @@ int XC::Mesh::setRayleighDampingFactors(const RayleighDampingFactors &rF)
   }
 
 //! @brief Commits mesh state.
+//!
+//! If the material state store is in use, the materials already
+//! attached to it are committed first with a few memory copies. The
+//! elements whose whole state is in the store (see
+//! Element::isStateInStore) are skipped; the other ones commit
+//! their own state (the attached materials skip their copy).
 int XC::Mesh::commit(void)
   {
+    MaterialStateStore *store= nullptr;
+    if(useMaterialStateStore)
+      {
+        store= &stateStore;
+        store->commit();
+      }
+    MaterialStateStore::BulkOperation bulk(store);
+
     // invoke commit on all nodes and elements in the mesh
-    Node *nodePtr= nullptr;
-    NodeIter &theNodeIter = this->getNodes();
-    while((nodePtr = theNodeIter()) != 0)
-      { nodePtr->commitState(); }
+    NodalStateStore *nodalStore= getNodalStateStore();
+    if(nodalStore)
+      nodalStore->commit(); // all the nodes at once.
+    else
+      {
+        Node *nodePtr= nullptr;
+        NodeIter &theNodeIter = this->getNodes();
+        while((nodePtr = theNodeIter()) != 0)
+          { nodePtr->commitState(); }
+      }
 
     Element *elePtr= nullptr;
     ElementIter &theElemIter = this->getElements();
-    while((elePtr = theElemIter()) != 0)
-      { elePtr->commitState(); }
+    if(store)
+      {
+        while((elePtr = theElemIter()) != 0)
+          if(!elePtr->isStateInStore())
+            elePtr->commitState();
+      }
+    else
+      while((elePtr = theElemIter()) != 0)
+        { elePtr->commitState(); }
 
     return 0;
   }
 
-//! @brief Returns the mesh to its last commited state.
+//! @brief Returns the mesh to its last commited state (the
+//! elements whose whole state is in the material state store
+//! are reverted by the store, see commit). If the nodal state store
+//! is in use, the nodes are reverted all at once.
 int XC::Mesh::revertToLastCommit(void)
   {
     //
     // first invoke revertToLastCommit  on all nodes and elements in the mesh
     //
+    MaterialStateStore *store= nullptr;
+    if(useMaterialStateStore)
+      {
+        store= &stateStore;
+        store->revertToLastCommit();
+      }
+    MaterialStateStore::BulkOperation bulk(store);
 
-    Node *nodePtr;
-    NodeIter &theNodeIter = this->getNodes();
-    while((nodePtr = theNodeIter()) != 0)
-      nodePtr->revertToLastCommit();
+    NodalStateStore *nodalStore= getNodalStateStore();
+    if(nodalStore)
+      nodalStore->revertToLastCommit(); // all the nodes at once (the
+                                        // reactions are not zeroed, they're
+                                        // recomputed by calculateNodalReactions).
+    else
+      {
+        Node *nodePtr;
+        NodeIter &theNodeIter = this->getNodes();
+        while((nodePtr = theNodeIter()) != 0)
+          nodePtr->revertToLastCommit();
+      }
 
     Element *elePtr;
     ElementIter &theElemIter = this->getElements();
-    while((elePtr = theElemIter()) != 0)
-      { elePtr->revertToLastCommit(); }
+    if(store)
+      {
+        while((elePtr = theElemIter()) != 0)
+          if(!elePtr->isStateInStore())
+            elePtr->revertToLastCommit();
+      }
+    else
+      while((elePtr = theElemIter()) != 0)
+        { elePtr->revertToLastCommit(); }
 
     return update();
   }
@@ -836,8 +1062,17 @@ int XC::Mesh::update(void)
     // invoke update on all the ele's
     ElementIter &theEles = this->getElements();
     Element *theEle;
-    while((theEle = theEles()) != 0)
-      { ok += theEle->update(); }
+    if(elementTiming)
+      while((theEle = theEles()) != 0)
+        {
+          const std::chrono::steady_clock::time_point start= std::chrono::steady_clock::now();
+          ok += theEle->update();
+          const std::chrono::duration<double> elapsed= std::chrono::steady_clock::now()-start;
+          elementCosts[theEle->getTag()]+= elapsed.count();
+        }
+    else
+      while((theEle = theEles()) != 0)
+        { ok += theEle->update(); }
 
     if(ok != 0)
       std::cerr << getClassName() << "::" << __FUNCTION__
@@ -854,6 +1089,168 @@ void XC::Mesh::setGraphBuiltFlags(const bool &f)
     eleGraphBuiltFlag= f;
   }
 
+//! @brief If the argument is true the time spent in the update
+//! (state determination) of each element is measured, so the
+//! partitioners and load balancers can use it as the element cost.
+void XC::Mesh::setElementTiming(const bool &b)
+  { elementTiming= b; }
+
+//! @brief Return true if the time spent in the update of each element
+//! is measured.
+bool XC::Mesh::getElementTiming(void) const
+  { return elementTiming; }
+
+//! @brief If the argument is true the state variables of the
+//! materials that support it are kept in contiguous memory blocks, so
+//! the commit (and revert) of those materials is made with a few
+//! memory copies instead of a virtual call for each material.
+void XC::Mesh::setUseMaterialStateStore(const bool &b)
+  {
+    useMaterialStateStore= b;
+    if(!useMaterialStateStore)
+      stateStore.clear();
+  }
+
+//! @brief Return true if the state variables of the materials are
+//! kept in contiguous memory blocks.
+bool XC::Mesh::getUseMaterialStateStore(void) const
+  { return useMaterialStateStore; }
+
+//! @brief Return the number of materials whose state variables are
+//! kept in contiguous memory blocks.
+size_t XC::Mesh::getNumMaterialsInStateStore(void) const
+  { return stateStore.getNumClients(); }
+
+//! @brief If the argument is true the displacements, velocities and
+//! accelerations of the nodes are kept in contiguous arrays (see
+//! NodalStateStore) so the nodes are committed all at once
+//! and the analysis updates their trial values with a single loop.
+void XC::Mesh::setUseNodalStateStore(const bool &b)
+  {
+    useNodalStateStore= b;
+    if(useNodalStateStore)
+      nodalStateStore.pack(getNodes());
+    else
+      nodalStateStore.clear();
+  }
+
+//! @brief Return true if the displacements, velocities and
+//! accelerations of the nodes are kept in contiguous arrays.
+bool XC::Mesh::getUseNodalStateStore(void) const
+  { return useNodalStateStore; }
+
+//! @brief Return the contiguous storage of the displacements,
+//! velocities and accelerations of the nodes (nullptr if not used).
+//! The nodes are packed again if some of them have been added
+//! or removed since the last call.
+XC::NodalStateStore *XC::Mesh::getNodalStateStore(void)
+  {
+    NodalStateStore *retval= nullptr;
+    if(useNodalStateStore)
+      {
+        if(!nodalStateStore.isPacked())
+          nodalStateStore.pack(getNodes());
+        retval= &nodalStateStore;
+      }
+    return retval;
+  }
+
+//! @brief If the argument is true the elements that support it
+//! (ShellMITC4 with linear transformation and elastic sections, Brick
+//! with elastic isotropic materials)
+//! share their stiffness and mass matrices with the identical elements
+//! of the mesh. The matrices are computed once and stored in local axes,
+//! so the elements only need to rotate them.
+void XC::Mesh::setUseSharedElementMatrices(const bool &b)
+  {
+    useSharedElementMatrices= b;
+    if(!useSharedElementMatrices)
+      sharedMatrices.clear();
+  }
+
+//! @brief Return true if the identical elements share their stiffness
+//! and mass matrices.
+bool XC::Mesh::getUseSharedElementMatrices(void) const
+  { return useSharedElementMatrices; }
+
+//! @brief If true, the elements created by the meshers and their
+//! materials are allocated from the memory arena of the mesh (so
+//! they are contiguous in memory), otherwise they come from the
+//! global heap.
+void XC::Mesh::setUseObjectArena(const bool &b)
+  { useObjectArena= b; }
+
+//! @brief Return true if the elements created by the meshers
+//! are allocated from the memory arena of the mesh.
+bool XC::Mesh::getUseObjectArena(void) const
+  { return useObjectArena; }
+
+//! @brief Return the arena to allocate the elements of the mesh
+//! from (nullptr if not used).
+XC::ObjectArena *XC::Mesh::getObjectArena(void)
+  {
+    ObjectArena *retval= nullptr;
+    if(useObjectArena)
+      retval= objectArena;
+    return retval;
+  }
+
+//! @brief Return the memory arena of the mesh.
+const XC::ObjectArena &XC::Mesh::getObjectArenaRef(void) const
+  { return *objectArena; }
+
+//! @brief Return the matrices shared by the identical elements
+//! (nullptr if not used).
+XC::SharedMatrixCache *XC::Mesh::getSharedMatrixCache(void)
+  {
+    SharedMatrixCache *retval= nullptr;
+    if(useSharedElementMatrices)
+      retval= &sharedMatrices;
+    return retval;
+  }
+
+//! @brief Discards the shared matrices. Must be called after
+//! modifying the materials of the elements.
+void XC::Mesh::clearSharedElementMatrices(void)
+  { sharedMatrices.clear(); }
+
+//! @brief Return the number of matrices shared by the elements.
+size_t XC::Mesh::getNumSharedElementMatrices(void) const
+  { return sharedMatrices.size(); }
+
+//! @brief Return the number of times an element has found its
+//! matrix already computed.
+size_t XC::Mesh::getNumSharedElementMatricesHits(void) const
+  { return sharedMatrices.getNumHits(); }
+
+//! @brief Return the time (in seconds) spent in the update of the element
+//! since the last call to resetElementCosts (zero if not measured).
+double XC::Mesh::getElementCost(const int &tag) const
+  {
+    double retval= 0.0;
+    std::map<int,double>::const_iterator i= elementCosts.find(tag);
+    if(i!=elementCosts.end())
+      retval= i->second;
+    return retval;
+  }
+
+//! @brief Discards the measured element costs.
+void XC::Mesh::resetElementCosts(void)
+  { elementCosts.clear(); }
+
+//! @brief If the argument is true the nodes and the elements are
+//! serialized in a single buffer when sending the mesh
+//! (see TaggedObjectStorage::setBufferedComm).
+void XC::Mesh::setBufferedComm(const bool &b)
+  {
+    theNodes->setBufferedComm(b);
+    theElements->setBufferedComm(b);
+  }
+
+//! @brief Returns true if the nodes are sent in a single buffer.
+bool XC::Mesh::getBufferedComm(void) const
+  { return theNodes->getBufferedComm(); }
+
 //! @brief Imprime el domain.
 void XC::Mesh::Print(std::ostream &s, int flag)
   {
@@ -873,6 +1270,61 @@ std::ostream &XC::operator<<(std::ostream &s, Mesh &M)
     return s;
   }
 
+//! @brief Returns the weight (computational cost) of each element
+//! for the partitioners and load balancers.
+//!
+//! The weight of an element is the time spent in its update (see
+//! setElementTiming). The elements without measurements take the mean
+//! time of the measured elements of the same class. If no element of
+//! the class has been measured the weight is estimated as proportional
+//! to the square of the number of degrees of freedom of the element
+//! (scaled with the measured elements, if any). The elements are not
+//! asked to compute anything, so their state is left untouched.
+std::map<int,double> XC::Mesh::getElementWeights(void)
+  {
+    std::map<std::string,double> classTime;
+    std::map<std::string,size_t> classCount;
+    double totalTime= 0.0;
+    double totalDOF2= 0.0;
+    Element *elePtr;
+    ElementIter &eleIter= this->getElements();
+    while((elePtr = eleIter()) != 0)
+      {
+        const double cost= getElementCost(elePtr->getTag());
+        if(cost>0.0)
+          {
+            const std::string className= elePtr->getClassName();
+            const double nDOF= std::max(elePtr->getNumDOF(),1);
+            classTime[className]+= cost;
+            classCount[className]++;
+            totalTime+= cost;
+            totalDOF2+= nDOF*nDOF;
+          }
+      }
+    const double timePerDOF2= ((totalTime>0.0) ? totalTime/totalDOF2 : 1.0);
+    std::map<int,double> retval;
+    ElementIter &eleIter2= this->getElements();
+    while((elePtr = eleIter2()) != 0)
+      {
+        const int tag= elePtr->getTag();
+        double w= getElementCost(tag);
+        if(w<=0.0)
+          {
+            const std::string className= elePtr->getClassName();
+            std::map<std::string,size_t>::const_iterator i= classCount.find(className);
+            if(i!=classCount.end())
+              w= classTime[className]/i->second;
+            else
+              {
+                const double nDOF= std::max(elePtr->getNumDOF(),1);
+                w= timePerDOF2*nDOF*nDOF;
+              }
+          }
+        retval[tag]= w;
+      }
+    return retval;
+  }
+
 //! @brief Builds the element's graph.
 //!
 //! A method which will cause the mesh to discard the current element
@@ -907,12 +1359,16 @@ int XC::Mesh::buildEleGraph(Graph &theEleGraph)
     // now create the vertices with a reference equal to the element number.
     // and a tag which ranges from 0 through numVertex-1
 
+    // the weight of each vertex is the cost of the element (see
+    // getElementWeights) so the partitioners can balance the work
+    // of the subdomains.
+    std::map<int,double> weights= getElementWeights();
     ElementIter &eleIter2 = this->getElements();
     int count = START_VERTEX_NUM;
     while((elePtr = eleIter2()) != 0)
       {
         int ElementTag = elePtr->getTag();
-        Vertex vrt(count,ElementTag);
+        Vertex vrt(count,ElementTag,weights[ElementTag]);
         theEleGraph.addVertex(vrt);
         theElementTagVertices[ElementTag] = count++;
       }
@@ -34,11 +34,17 @@
 #include "NodeLockers.h"
 #include "solution/graph/graph/Graph.h"
 #include "node/KDTreeNodes.h"
+#include "node/NodalStateStore.h"
 #include "element/utils/KDTreeElements.h"
+#include "element/utils/SharedMatrixCache.h"
+#include "material/MaterialStateStore.h"
+#include <map>
+#include <boost/python/dict.hpp>
 
 class Pos3d;
 
 namespace XC {
+class ObjectArena;
 class Element;
 class Node;
 
@@ -50,6 +56,7 @@ class SingleDomNodIter;
 class Graph;
 class NodeGraph;
 class ElementGraph;
+class GraphPartitioner;
 class FEM_ObjectBroker;
 class TaggedObjectStorage;
 class RayleighDampingFactors;
@@ -85,6 +92,18 @@ class Mesh: public MeshComponentContainer
 
     NodeLockers lockers; //!< To block deactivated (dead) nodes.
 
+    bool elementTiming; //!< if true, measure the time spent in the update of each element.
+    std::map<int,double> elementCosts; //!< time spent in the update of each element (element tag -> seconds).
+
+    bool useMaterialStateStore; //!< if true, keep the state variables of the materials in stateStore.
+    MaterialStateStore stateStore; //!< contiguous storage for the state variables of the materials.
+    bool useNodalStateStore; //!< if true, keep the displacements, velocities and accelerations of the nodes in nodalStateStore.
+    NodalStateStore nodalStateStore; //!< contiguous storage for the displacements, velocities and accelerations of the nodes.
+    bool useSharedElementMatrices; //!< if true, identical linear elements share their stiffness and mass matrices (see sharedMatrices).
+    SharedMatrixCache sharedMatrices; //!< stiffness and mass matrices shared by identical linear elements.
+    bool useObjectArena; //!< if true, the elements created by the meshers (and their materials) are allocated from objectArena.
+    ObjectArena *objectArena; //!< memory pool for the elements of the mesh and their materials.
+
     void alloc_containers(void);
     void alloc_iters(void);
     bool check_containers(void) const;
@@ -110,9 +129,11 @@ class Mesh: public MeshComponentContainer
 
     // methods to populate a mesh
     virtual bool addNode(Node *);
+    bool addNodes(const std::vector<Node *> &);
     virtual bool removeNode(int tag);
 
     virtual bool addElement(Element *);
+    bool addElements(const std::vector<Element *> &);
     virtual bool removeElement(int tag);
 
     virtual void clearAll(void);
@@ -123,6 +144,28 @@ class Mesh: public MeshComponentContainer
     void clearDOF_GroupPtr(void);
 
     void setGraphBuiltFlags(const bool &f);
+    void setBufferedComm(const bool &);
+    bool getBufferedComm(void) const;
+    void setElementTiming(const bool &);
+    bool getElementTiming(void) const;
+    double getElementCost(const int &) const;
+    void resetElementCosts(void);
+    void setUseMaterialStateStore(const bool &);
+    bool getUseMaterialStateStore(void) const;
+    size_t getNumMaterialsInStateStore(void) const;
+    void setUseNodalStateStore(const bool &);
+    bool getUseNodalStateStore(void) const;
+    NodalStateStore *getNodalStateStore(void);
+    void setUseSharedElementMatrices(const bool &);
+    bool getUseSharedElementMatrices(void) const;
+    void setUseObjectArena(const bool &);
+    bool getUseObjectArena(void) const;
+    ObjectArena *getObjectArena(void);
+    const ObjectArena &getObjectArenaRef(void) const;
+    SharedMatrixCache *getSharedMatrixCache(void);
+    void clearSharedElementMatrices(void);
+    size_t getNumSharedElementMatrices(void) const;
+    size_t getNumSharedElementMatricesHits(void) const;
 
     int initialize(void);
     virtual int setRayleighDampingFactors(const RayleighDampingFactors &rF);
@@ -172,10 +215,13 @@ class Mesh: public MeshComponentContainer
 
 
      // methods to get element and node graphs
+    std::map<int,double> getElementWeights(void);
     virtual int buildEleGraph(Graph &theEleGraph);
     virtual int buildNodeGraph(Graph &theNodeGraph);
     virtual Graph &getElementGraph(void);
     virtual Graph &getNodeGraph(void);
+    std::map<int,int> getElementPartitions(GraphPartitioner &, const int &);
+    boost::python::dict getElementPartitionsPy(GraphPartitioner &, const int &);
 
     virtual int commit(void);
     virtual int revertToLastCommit(void);
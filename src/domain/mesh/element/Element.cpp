@@ -82,6 +82,7 @@
 #include "utility/matrix/DqMatrices.h"
 #include "utility/matrix/DqVectors.h"
 #include "utility/tagged/DefaultTag.h"
+#include "utility/ObjectArena.h"
 
 #include "domain/mesh/element/utils/gauss_models/GaussModel.h"
 #include "utility/actor/actor/CommMetaData.h"
@@ -102,6 +103,15 @@ XC::Element::Element(int tag, int cTag)
   :MeshComponent(tag, cTag), nodeIndex(-1), rayFactors() 
   { defaultTag= tag+1; }
 
+//! @brief Allocates the element from the current memory arena
+//! (see ObjectArena).
+void *XC::Element::operator new(size_t sz)
+  { return ObjectArena::allocate(sz); }
+
+//! @brief Returns the memory of the element to its arena.
+void XC::Element::operator delete(void *p,size_t sz)
+  { ObjectArena::deallocate(p,sz); }
+
 //! @brief Returns next element's tag value by default.
 XC::DefaultTag &XC::Element::getDefaultTag(void)
   { return defaultTag; }
@@ -241,6 +251,18 @@ const XC::Matrix &XC::Element::getDamp(void) const
   }
 
 
+//! @brief Return the matrices shared by the identical elements of the
+//! mesh (nullptr if the element is not in a domain or the mesh doesn't
+//! share them, see Mesh::setUseSharedElementMatrices).
+XC::SharedMatrixCache *XC::Element::getSharedMatrixCache(void) const
+  {
+    SharedMatrixCache *retval= nullptr;
+    Domain *dom= getDomain();
+    if(dom)
+      retval= dom->getMesh().getSharedMatrixCache();
+    return retval;
+  }
+
 //! @brief Returns the mass matrix.
 //!
 //! Returns the mass matrix. The element is to compute its
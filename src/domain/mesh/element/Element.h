@@ -96,6 +96,7 @@ class DqMatrices;
 class DefaultTag;
 class GaussModel;
 class ParticlePos3d;
+class SharedMatrixCache;
 
 //! @ingroup Mesh
 //!
@@ -130,6 +131,7 @@ class Element: public MeshComponent
     virtual ElemPtrArray3d cose(const SetEstruct &f1,const SetEstruct &f2) const;
 
     const Vector &getRayleighDampingForces(void) const;
+    SharedMatrixCache *getSharedMatrixCache(void) const;
 
     Vector load;//!< vector for applying loads
     mutable RayleighDampingFactors rayFactors; //!< Rayleigh damping factors
@@ -143,6 +145,9 @@ class Element: public MeshComponent
     Element(int tag, int classTag);
     virtual Element *getCopy(void) const= 0;
 
+    static void *operator new(size_t);
+    static void operator delete(void *,size_t);
+
     static DefaultTag &getDefaultTag(void);
 
     // methods dealing with nodes and number of external dof
@@ -172,6 +177,12 @@ class Element: public MeshComponent
     //! state. To return 0 if sucessfull, a negative number if not.
     virtual int revertToLastCommit(void) = 0;
     virtual int revertToStart(void);
+    //! @brief Return true if all the state of the element is committed
+    //! (and reverted) by the material state store of the mesh (see
+    //! MaterialStateStore), so the mesh can skip the calls to
+    //! commitState and revertToLastCommit.
+    virtual bool isStateInStore(void) const
+      { return false; }
     virtual int update(void);
     virtual bool isSubdomain(void);
 
@@ -186,6 +197,12 @@ class Element: public MeshComponent
     //! \f[ K_e = {\frac{\partial f_{R_i}}{\partial U} \vert}_{U_{trial}} \f]
     virtual const Matrix &getTangentStiff(void) const= 0;
     virtual const Matrix &getInitialStiff(void) const= 0;
+    //! @brief Return true if the tangent stiffness doesn't change
+    //! with the element state (linear elastic material and geometry)
+    //! so it can be cached by the integrator (see
+    //! IncrementalIntegrator::formTangent).
+    virtual bool hasConstantTangent(void) const
+      { return false; }
     virtual const Matrix &getDamp(void) const;
     virtual const Matrix &getMass(void) const;
 
@@ -149,9 +149,7 @@ int XC::FourNodeQuad::update(void)
     u[0][3] = disp4(0);
     u[1][3] = disp4(1);
 
-    static XC::Vector eps(3);
-
-    int ret = 0;
+    NDMaterialBatch &batch= physicalProperties.getBatch();
 
     // Loop over the integration points
     for(size_t i= 0;i<physicalProperties.size();i++)
@@ -163,17 +161,17 @@ int XC::FourNodeQuad::update(void)
         // Interpolate strains
         //eps = B*u;
         //eps.addMatrixVector(0.0, B, u, 1.0);
-        eps.Zero();
+        double *eps= batch.getStrainPtr(i);
+        eps[0]= 0.0; eps[1]= 0.0; eps[2]= 0.0;
         for(int beta= 0;beta<4;beta++)
           {
-            eps(0)+= shp[0][beta]*u[0][beta];
-            eps(1)+= shp[1][beta]*u[1][beta];
-            eps(2)+= shp[0][beta]*u[1][beta] + shp[1][beta]*u[0][beta];
+            eps[0]+= shp[0][beta]*u[0][beta];
+            eps[1]+= shp[1][beta]*u[1][beta];
+            eps[2]+= shp[0][beta]*u[1][beta] + shp[1][beta]*u[0][beta];
           }
-        // Set the material strain
-        ret += physicalProperties[i]->setTrialStrain(eps);
       }
-    return ret;
+    // Set the material strains
+    return physicalProperties.setTrialStrains();
   }
 
 //! @brief Return the tangent stiffness matrix.
@@ -183,6 +181,7 @@ const XC::Matrix &XC::FourNodeQuad::getTangentStiff(void) const
 
     double dvol;
     double DB[3][2];
+    const NDMaterialBatch &batch= physicalProperties.getUpdatedBatch();
 
     //Loop over the integration points
     for(size_t i = 0;i<physicalProperties.size();i++)
@@ -192,16 +191,16 @@ const XC::Matrix &XC::FourNodeQuad::getTangentStiff(void) const
         dvol= this->shapeFunction(gp);
         dvol*= (physicalProperties.getThickness()*gp.weight());
 
-        // Get the material tangent
-        const XC::Matrix &D = physicalProperties[i]->getTangent();
+        // Get the material tangent (stored by columns)
+        const double *D = batch.getTangentPtr(i);
 
         // Perform numerical integration
         //K = K + (B^ D * B) * intWt(i)*intWt(j) * detJ;
         //K.addMatrixTripleProduct(1.0, B, D, intWt(i)*intWt(j)*detJ);
 
-        double D00 = D(0,0); double D01 = D(0,1); double D02 = D(0,2);
-        double D10 = D(1,0); double D11 = D(1,1); double D12 = D(1,2);
-        double D20 = D(2,0); double D21 = D(2,1); double D22 = D(2,2);
+        double D00 = D[0]; double D01 = D[3]; double D02 = D[6];
+        double D10 = D[1]; double D11 = D[4]; double D12 = D[7];
+        double D20 = D[2]; double D21 = D[5]; double D22 = D[8];
 
         //          for(int beta = 0, ib = 0, colIb =0, colIbP1 = 8;
         //   beta < 4;
@@ -390,6 +389,7 @@ const XC::Vector &XC::FourNodeQuad::getResistingForce(void) const
     P.Zero();
 
     double dvol;
+    const NDMaterialBatch &batch= physicalProperties.getUpdatedBatch();
 
     // Loop over the integration points
     for(size_t i= 0;i<physicalProperties.size();i++)
@@ -400,7 +400,7 @@ const XC::Vector &XC::FourNodeQuad::getResistingForce(void) const
         dvol*= (physicalProperties.getThickness()*gp.weight());
 
         // Get material stress response
-        const Vector &sigma = physicalProperties[i]->getStress();
+        const double *sigma = batch.getStressPtr(i);
 
         // Perform numerical integration on internal force
         //P = P + (B^ sigma) * intWt(i)*intWt(j) * detJ;
@@ -408,8 +408,8 @@ const XC::Vector &XC::FourNodeQuad::getResistingForce(void) const
         for(int alpha = 0,ia = 0;alpha<numNodes(); alpha++,ia += 2)
           {
 
-            P(ia)+= dvol*(shp[0][alpha]*sigma(0) + shp[1][alpha]*sigma(2));
-            P(ia+1)+= dvol*(shp[1][alpha]*sigma(1) + shp[0][alpha]*sigma(2));
+            P(ia)+= dvol*(shp[0][alpha]*sigma[0] + shp[1][alpha]*sigma[2]);
+            P(ia+1)+= dvol*(shp[1][alpha]*sigma[1] + shp[0][alpha]*sigma[2]);
 
             // Subtract equiv. body forces from the nodes
             //P = P - (N^ b) * intWt(i)*intWt(j) * detJ;
@@ -0,0 +1,354 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ShellKernel.h
+
+#ifndef ShellKernel_h
+#define ShellKernel_h
+
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/Matrix.h"
+#include "material/section/SectionForceDeformation.h"
+
+namespace XC {
+
+//! @ingroup PlaneElements
+//
+//! @brief Fixed size computation of the B-operators of the shell
+//! elements (membrane, bending, shear and drilling) and of their
+//! contributions to the residual and the tangent stiffness matrix.
+//!
+//! All the arrays are dimensioned at compile time (number of nodes
+//! NN and number of Gauss points NG) so no memory is allocated
+//! from the heap. The Gauss point is the innermost index of the arrays
+//! so the loops over the Gauss points can be vectorized by the
+//! compiler. The operations are made in the same order than the
+//! old code based on Matrix objects so the results are the same.
+//!
+//!  six(6) nodal dof's ordered: u1, u2 (membrane), w= u3, theta1, theta2
+//!  (bending) and theta3 (drill).
+//!
+//!  eight(8) strains ordered: eps00, eps11, gamma01 (membrane),
+//!  kappa00, kappa11, 2*kappa01 (bending), gamma02, gamma12 (shear).
+template <int NN, int NG>
+class ShellKernel
+  {
+  public:
+    static const int ndf= 6; //!< two membrane plus three bending plus one drill
+    static const int nstress= 8; //!< three membrane, three moment, two shear
+  private:
+    double g1[3]; //!< first local axis.
+    double g2[3]; //!< second local axis.
+    double g3[3]; //!< third local axis.
+    double dvol[NG]; //!< volume element at each Gauss point.
+    double shp[3][NN][NG]; //!< shape function derivatives and values at each Gauss point.
+    double B[NN][nstress][ndf][NG]; //!< B matrix of each node.
+    double Bdrill[NN][ndf][NG]; //!< drilling B matrix of each node.
+    double strain[nstress][NG]; //!< generalized strains.
+    double epsDrill[NG]; //!< drilling "strain".
+    double stress[nstress][NG]; //!< stress resultants (multiplied by the volume element).
+    double tauDrill[NG]; //!< drilling "stress" (multiplied by the volume element).
+    double dd[nstress][nstress][NG]; //!< material tangent (multiplied by the volume element).
+  public:
+    ShellKernel(const Vector &G1,const Vector &G2,const Vector &G3);
+
+    void setShapeFunctions(const int &gp,const double shpGP[3][NN],const double &dv);
+    void computeB(void);
+    void setShearB(const int &gp,const int &node,const double Bshear[2][3]);
+    void computeStandardShearB(void);
+
+    void computeStrains(const double ul[NN][ndf]);
+    int setTrialSectionDeformation(const int &gp,SectionForceDeformation &) const;
+    void setStress(const int &gp,const Vector &,const double &Ktt);
+    void setTangent(const int &gp,const Matrix &);
+
+    void addResid(Vector &resid) const;
+    void addTangent(Matrix &stiff,const double &Ktt) const;
+  };
+
+//! @brief Constructor.
+//!
+//! @param G1: first local axis.
+//! @param G2: second local axis.
+//! @param G3: third local axis.
+template <int NN, int NG>
+ShellKernel<NN,NG>::ShellKernel(const Vector &G1,const Vector &G2,const Vector &G3)
+  {
+    for(int i= 0;i<3;i++)
+      {
+        g1[i]= G1[i];
+        g2[i]= G2[i];
+        g3[i]= G3[i];
+      }
+  }
+
+//! @brief Stores the values of the shape functions (shpGP[2]) and its
+//! derivatives (shpGP[0] and shpGP[1]) at the Gauss point.
+//!
+//! @param gp: index of the Gauss point.
+//! @param shpGP: shape functions (see ShellMITC4Base::shape2d).
+//! @param dv: volume element.
+template <int NN, int NG>
+void ShellKernel<NN,NG>::setShapeFunctions(const int &gp,const double shpGP[3][NN],const double &dv)
+  {
+    dvol[gp]= dv;
+    for(int i= 0;i<3;i++)
+      for(int n= 0;n<NN;n++)
+        shp[i][n][gp]= shpGP[i][n];
+  }
+
+//! @brief Computes the membrane, bending and drilling terms of the
+//! B matrices for all the nodes and Gauss points.
+//!
+//! Shell B matrix of a node in standard {1,2,3} mechanics notation:
+//!
+//!        | Bmembrane*Gmem |       0      |
+//!   B=   |       0        |  Bbend*Gmem  |   (8x6)
+//!        |         Bshear*Gshear         |
+//!
+//! where Bmembrane= [[N,1 0][0 N,2][N,2 N,1]],
+//! Bbend= [[0 -N,1][N,2 0][N,1 -N,2]] and Gmem= [g1 g2]^T.
+//! The drilling B matrix is:
+//!
+//!   Bdrill= [-0.5*N,2*g1+0.5*N,1*g2  -N*g3]   (1x6)
+template <int NN, int NG>
+void ShellKernel<NN,NG>::computeB(void)
+  {
+    for(int n= 0;n<NN;n++)
+      {
+        const double *N1= shp[0][n];
+        const double *N2= shp[1][n];
+        const double *N= shp[2][n];
+        for(int c= 0;c<3;c++)
+          {
+            const double g1c= g1[c];
+            const double g2c= g2[c];
+            const double g3c= g3[c];
+            for(int gp= 0;gp<NG;gp++)
+              {
+                //membrane terms.
+                B[n][0][c][gp]= N1[gp]*g1c;
+                B[n][1][c][gp]= N2[gp]*g2c;
+                B[n][2][c][gp]= N2[gp]*g1c + N1[gp]*g2c;
+                B[n][0][c+3][gp]= 0.0;
+                B[n][1][c+3][gp]= 0.0;
+                B[n][2][c+3][gp]= 0.0;
+                //bending terms.
+                B[n][3][c][gp]= 0.0;
+                B[n][4][c][gp]= 0.0;
+                B[n][5][c][gp]= 0.0;
+                B[n][3][c+3][gp]= -N1[gp]*g2c;
+                B[n][4][c+3][gp]= N2[gp]*g1c;
+                B[n][5][c+3][gp]= N1[gp]*g1c + (-N2[gp])*g2c;
+                //drilling terms.
+                Bdrill[n][c][gp]= (-0.5*N2[gp])*g1c + (0.5*N1[gp])*g2c;
+                Bdrill[n][c+3][gp]= (-N[gp])*g3c;
+              }
+          }
+      }
+  }
+
+//! @brief Sets the shear terms of the B matrix of the node at the
+//! Gauss point from the plate shear B matrix (2x3) (assumed strain
+//! interpolation of the MITC elements).
+//!
+//! @param gp: index of the Gauss point.
+//! @param node: index of the node.
+//! @param Bshear: plate shear B matrix (one displacement and two rotations).
+template <int NN, int NG>
+void ShellKernel<NN,NG>::setShearB(const int &gp,const int &node,const double Bshear[2][3])
+  {
+    //Gshear= [[g3 0][0 g1][0 g2]] (3x6)
+    for(int r= 0;r<2;r++)
+      for(int c= 0;c<3;c++)
+        {
+          B[node][6+r][c][gp]= Bshear[r][0]*g3[c];
+          B[node][6+r][c+3][gp]= Bshear[r][1]*g1[c] + Bshear[r][2]*g2[c];
+        }
+  }
+
+//! @brief Computes the shear terms of the B matrices from the
+//! standard (not assumed strain) plate shear B matrix:
+//!
+//!   Bshear= [[N,1 0 N][N,2 -N 0]]   (2x3)
+template <int NN, int NG>
+void ShellKernel<NN,NG>::computeStandardShearB(void)
+  {
+    for(int n= 0;n<NN;n++)
+      {
+        const double *N1= shp[0][n];
+        const double *N2= shp[1][n];
+        const double *N= shp[2][n];
+        for(int c= 0;c<3;c++)
+          for(int gp= 0;gp<NG;gp++)
+            {
+              B[n][6][c][gp]= N1[gp]*g3[c];
+              B[n][6][c+3][gp]= 0.0*g1[c] + N[gp]*g2[c];
+              B[n][7][c][gp]= N2[gp]*g3[c];
+              B[n][7][c+3][gp]= (-N[gp])*g1[c] + 0.0*g2[c];
+            }
+      }
+  }
+
+//! @brief Computes the strains at the Gauss points.
+//!
+//! @param ul: displacements of the nodes.
+template <int NN, int NG>
+void ShellKernel<NN,NG>::computeStrains(const double ul[NN][ndf])
+  {
+    for(int r= 0;r<nstress;r++)
+      for(int gp= 0;gp<NG;gp++)
+        strain[r][gp]= 0.0;
+    for(int gp= 0;gp<NG;gp++)
+      epsDrill[gp]= 0.0;
+    for(int n= 0;n<NN;n++)
+      {
+        for(int c= 0;c<ndf;c++)
+          {
+            const double u= ul[n][c];
+            for(int r= 0;r<nstress;r++)
+              for(int gp= 0;gp<NG;gp++)
+                strain[r][gp]+= B[n][r][c][gp]*u;
+          }
+        for(int c= 0;c<ndf;c++)
+          {
+            const double u= ul[n][c];
+            for(int gp= 0;gp<NG;gp++)
+              epsDrill[gp]+= Bdrill[n][c][gp]*u;
+          }
+      }
+  }
+
+//! @brief Sends the strains of the Gauss point to the section.
+template <int NN, int NG>
+int ShellKernel<NN,NG>::setTrialSectionDeformation(const int &gp,SectionForceDeformation &section) const
+  {
+    double e[nstress];
+    for(int r= 0;r<nstress;r++)
+      e[r]= strain[r][gp];
+    const Vector eps(e,nstress); // no copy.
+    return section.setTrialSectionDeformation(eps);
+  }
+
+//! @brief Stores the stress resultants at the Gauss point.
+//!
+//! @param gp: index of the Gauss point.
+//! @param s: stress resultants.
+//! @param Ktt: drilling stiffness.
+template <int NN, int NG>
+void ShellKernel<NN,NG>::setStress(const int &gp,const Vector &s,const double &Ktt)
+  {
+    for(int r= 0;r<nstress;r++)
+      stress[r][gp]= s[r]*dvol[gp];
+    tauDrill[gp]= (Ktt*epsDrill[gp])*dvol[gp];
+  }
+
+//! @brief Stores the material tangent at the Gauss point.
+//!
+//! @param gp: index of the Gauss point.
+//! @param D: section tangent.
+template <int NN, int NG>
+void ShellKernel<NN,NG>::setTangent(const int &gp,const Matrix &D)
+  {
+    for(int r= 0;r<nstress;r++)
+      for(int c= 0;c<nstress;c++)
+        dd[r][c][gp]= D(r,c)*dvol[gp];
+  }
+
+//! @brief Adds the contribution of the Gauss points to the residual.
+//!
+//! The bending terms are multiplied by (-1.0) for correct statement
+//! of equilibrium.
+template <int NN, int NG>
+void ShellKernel<NN,NG>::addResid(Vector &resid) const
+  {
+    for(int j= 0;j<NN;j++)
+      for(int p= 0;p<ndf;p++)
+        {
+          const bool bendingCol= (p>=3);
+          double residJ[NG];
+          for(int gp= 0;gp<NG;gp++)
+            residJ[gp]= 0.0;
+          for(int r= 0;r<nstress;r++)
+            {
+              const double sgn= (bendingCol && (r>=3) && (r<6)) ? -1.0 : 1.0;
+              for(int gp= 0;gp<NG;gp++)
+                residJ[gp]+= (B[j][r][p][gp]*sgn)*stress[r][gp];
+            }
+          double &rslt= resid(j*ndf+p);
+          for(int gp= 0;gp<NG;gp++)
+            rslt+= residJ[gp] + Bdrill[j][p][gp]*tauDrill[gp];
+        }
+  }
+
+//! @brief Adds the contribution of the Gauss points to the
+//! tangent stiffness matrix (B^T*D*B plus the drilling terms). As in
+//! the residual, the bending terms of BJ are multiplied by (-1.0).
+//!
+//! @param stiff: tangent stiffness matrix.
+//! @param Ktt: drilling stiffness.
+template <int NN, int NG>
+void ShellKernel<NN,NG>::addTangent(Matrix &stiff,const double &Ktt) const
+  {
+    double BJtranD[ndf][nstress][NG];
+    double BdrillJ[ndf][NG];
+    for(int j= 0;j<NN;j++)
+      {
+        //BJtranD= BJtran * dd
+        for(int p= 0;p<ndf;p++)
+          {
+            const bool bendingCol= (p>=3);
+            for(int q= 0;q<nstress;q++)
+              {
+                double *aux= BJtranD[p][q];
+                for(int gp= 0;gp<NG;gp++)
+                  aux[gp]= 0.0;
+                for(int r= 0;r<nstress;r++)
+                  {
+                    const double sgn= (bendingCol && (r>=3) && (r<6)) ? -1.0 : 1.0;
+                    for(int gp= 0;gp<NG;gp++)
+                      aux[gp]+= (B[j][r][p][gp]*sgn)*dd[r][q][gp];
+                  }
+              }
+            for(int gp= 0;gp<NG;gp++)
+              BdrillJ[p][gp]= Bdrill[j][p][gp]*(Ktt*dvol[gp]);
+          }
+        for(int k= 0;k<NN;k++)
+          for(int p= 0;p<ndf;p++)
+            for(int q= 0;q<ndf;q++)
+              {
+                //stiffJK= BJtranD * BK
+                double stiffJK[NG];
+                for(int gp= 0;gp<NG;gp++)
+                  stiffJK[gp]= 0.0;
+                for(int r= 0;r<nstress;r++)
+                  for(int gp= 0;gp<NG;gp++)
+                    stiffJK[gp]+= BJtranD[p][r][gp]*B[k][r][q][gp];
+                double &kjk= stiff(j*ndf+p,k*ndf+q);
+                for(int gp= 0;gp<NG;gp++)
+                  kjk+= stiffJK[gp] + BdrillJ[p][gp]*Bdrill[k][q][gp];
+              }
+      }
+  }
+
+} // end of XC namespace
+
+#endif
@@ -56,6 +56,8 @@
 #include "preprocessor/multi_block_topology/aux_meshing.h"
 #include <domain/mesh/node/Node.h>
 #include <material/section/SectionForceDeformation.h>
+#include "material/section/plate_section/ElasticPlateBase.h"
+#include "ShellLinearCrdTransf3d.h"
 #include <domain/domain/Domain.h>
 #include <domain/mesh/element/plane/shell/R3vectors.h>
 
@@ -347,20 +349,154 @@ int XC::ShellMITC4Base::update(void)
     return QuadBase4N<SectionFDPhysicalProperties>::update();
   }
 
+//! @brief Return true if the tangent stiffness doesn't change
+//! with the element state (linear coordinate transformation and
+//! elastic plate sections).
+bool XC::ShellMITC4Base::hasConstantTangent(void) const
+  {
+    bool retval= (dynamic_cast<const ShellLinearCrdTransf3d *>(theCoordTransf)!=nullptr);
+    for(size_t i= 0;retval && (i<physicalProperties.size());i++)
+      retval= (dynamic_cast<const ElasticPlateBase *>(physicalProperties[i])!=nullptr);
+    return retval;
+  }
+
+//! @brief Return the key of the stiffness (kind= 0) or the mass (kind= 1)
+//! matrix in the cache of shared matrices: local coordinates of the nodes
+//! and material parameters.
+XC::SharedMatrixCache::Key XC::ShellMITC4Base::getSharedMatrixKey(const int &kind) const
+  {
+    static const int ngauss= 4;
+    SharedMatrixCache::Key retval;
+    retval.reserve(11+ngauss*64);
+    retval.push_back(getClassTag());
+    retval.push_back(kind);
+    for(int i= 0;i<2;i++)
+      for(int j= 0;j<4;j++)
+        retval.push_back(xl[i][j]);
+    SharedMatrixCache *cache= getSharedMatrixCache();
+    if(cache)
+      cache->snapToZero(retval,2,retval.size());
+    if(kind==0)
+      {
+        retval.push_back(Ktt);
+        for(int i= 0;i<ngauss;i++)
+          {
+            const Matrix &dd= physicalProperties[i]->getInitialTangent();
+            for(int k= 0;k<dd.noCols();k++)
+              for(int j= 0;j<dd.noRows();j++)
+                retval.push_back(dd(j,k));
+          }
+      }
+    else
+      for(int i= 0;i<ngauss;i++)
+        retval.push_back(physicalProperties[i]->getRho());
+    return retval;
+  }
+
+//! @brief Return the stiffness matrix in local axes shared with the
+//! identical elements of the mesh (nullptr if the matrices are not
+//! shared or the stiffness of the element is not constant).
+const XC::Matrix *XC::ShellMITC4Base::getSharedLocalStiff(void) const
+  {
+    const Matrix *retval= nullptr;
+    SharedMatrixCache *cache= getSharedMatrixCache();
+    if(cache)
+      {
+        retval= sharedStiff.get(*cache);
+        if(!retval && hasConstantTangent())
+          {
+            const SharedMatrixCache::Key key= getSharedMatrixKey(0);
+            SharedMatrixCache::MatrixPtr ptr= cache->find(key);
+            if(!ptr)
+              {
+                static const int ngauss= 4;
+                static const Vector e1(1.0,0.0,0.0);
+                static const Vector e2(0.0,1.0,0.0);
+                static const Vector e3(0.0,0.0,1.0);
+                ShellKernel<4,4> kernel(e1,e2,e3);
+                setupKernel(kernel);
+                for(int i= 0;i<ngauss;i++)
+                  kernel.setTangent(i,physicalProperties[i]->getInitialTangent());
+                Matrix kl(24,24);
+                kernel.addTangent(kl,Ktt);
+                ptr= cache->intern(key,kl);
+              }
+            retval= sharedStiff.set(*cache,ptr);
+          }
+      }
+    return retval;
+  }
+
+//! @brief Return the mass matrix shared with the identical elements
+//! of the mesh (nullptr if the matrices are not shared or the stiffness
+//! of the element is not constant). The mass matrix doesn't depend on
+//! the orientation of the element.
+const XC::Matrix *XC::ShellMITC4Base::getSharedMass(void) const
+  {
+    const Matrix *retval= nullptr;
+    SharedMatrixCache *cache= getSharedMatrixCache();
+    if(cache)
+      {
+        retval= sharedMass.get(*cache);
+        if(!retval && hasConstantTangent())
+          {
+            const SharedMatrixCache::Key key= getSharedMatrixKey(1);
+            SharedMatrixCache::MatrixPtr ptr= cache->find(key);
+            if(!ptr)
+              {
+                formInertiaTerms(1);
+                ptr= cache->intern(key,mass);
+              }
+            retval= sharedMass.set(*cache,ptr);
+          }
+      }
+    return retval;
+  }
+
+//! @brief Compute the stiffness matrix in global axes from the
+//! one in local axes (kg= T^t*kl*T where T is block diagonal with
+//! the rows of each block being the local axes).
+void XC::ShellMITC4Base::localToGlobalStiff(const Matrix &kl,Matrix &kg) const
+  {
+    const Vector &g1= theCoordTransf->G1();
+    const Vector &g2= theCoordTransf->G2();
+    const Vector &g3= theCoordTransf->G3();
+    const double R[3][3]= {{g1(0),g1(1),g1(2)},{g2(0),g2(1),g2(2)},{g3(0),g3(1),g3(2)}};
+    double tmp[3][3];
+    for(int a= 0;a<24;a+=3)
+      for(int b= 0;b<24;b+=3)
+        {
+          //tmp= kl_ab*R
+          for(int k= 0;k<3;k++)
+            for(int j= 0;j<3;j++)
+              tmp[k][j]= kl(a+k,b)*R[0][j]+kl(a+k,b+1)*R[1][j]+kl(a+k,b+2)*R[2][j];
+          //kg_ab= R^t*tmp
+          for(int i= 0;i<3;i++)
+            for(int j= 0;j<3;j++)
+              kg(a+i,b+j)= R[0][i]*tmp[0][j]+R[1][i]*tmp[1][j]+R[2][i]*tmp[2][j];
+        }
+  }
+
 //! @brief return stiffness matrix
 const XC::Matrix &XC::ShellMITC4Base::getTangentStiff(void) const
   {
-    theCoordTransf->update();
+    const Matrix *kl= getSharedLocalStiff();
+    if(kl) // constant stiffness shared with other elements.
+      localToGlobalStiff(*kl,stiff);
+    else
+      {
+        theCoordTransf->update();
 
-    const int tang_flag= 1; //get the tangent
-    formResidAndTangent(tang_flag); //do tangent and residual here
+        const int tang_flag= 1; //get the tangent
+        formResidAndTangent(tang_flag); //do tangent and residual here
+      }
     if(isDead())
       stiff*=dead_srf;
     return stiff;
   }
 
 //! @brief Computes the matrix G.
-const XC::Matrix XC::ShellMITC4Base::calculateG(void) const
+void XC::ShellMITC4Base::calculateG(double G[4][12]) const
   {
     const double dx34= xl[0][2]-xl[0][3];
     const double dy34= xl[1][2]-xl[1][3];
@@ -374,89 +510,46 @@ const XC::Matrix XC::ShellMITC4Base::calculateG(void) const
     const double dx41= xl[0][3]-xl[0][0];
     const double dy41= xl[1][3]-xl[1][0];
 
-    Matrix G(4,12);
-    G.Zero();
-    double one_over_four= 0.25;
-    G(0,0)=-0.5;
-    G(0,1)=-dy41*one_over_four;
-    G(0,2)=dx41*one_over_four;
-    G(0,9)=0.5;
-    G(0,10)=-dy41*one_over_four;
-    G(0,11)=dx41*one_over_four;
-    G(1,0)=-0.5;
-    G(1,1)=-dy21*one_over_four;
-    G(1,2)=dx21*one_over_four;
-    G(1,3)=0.5;
-    G(1,4)=-dy21*one_over_four;
-    G(1,5)=dx21*one_over_four;
-    G(2,3)=-0.5;
-    G(2,4)=-dy32*one_over_four;
-    G(2,5)=dx32*one_over_four;
-    G(2,6)=0.5;
-    G(2,7)=-dy32*one_over_four;
-    G(2,8)=dx32*one_over_four;
-    G(3,6)=0.5;
-    G(3,7)=-dy34*one_over_four;
-    G(3,8)=dx34*one_over_four;
-    G(3,9)=-0.5;
-    G(3,10)=-dy34*one_over_four;
-    G(3,11)=dx34*one_over_four;
-    return G;
+    for(int i= 0;i<4;i++)
+      for(int j= 0;j<12;j++)
+        G[i][j]= 0.0;
+    const double one_over_four= 0.25;
+    G[0][0]=-0.5;
+    G[0][1]=-dy41*one_over_four;
+    G[0][2]=dx41*one_over_four;
+    G[0][9]=0.5;
+    G[0][10]=-dy41*one_over_four;
+    G[0][11]=dx41*one_over_four;
+    G[1][0]=-0.5;
+    G[1][1]=-dy21*one_over_four;
+    G[1][2]=dx21*one_over_four;
+    G[1][3]=0.5;
+    G[1][4]=-dy21*one_over_four;
+    G[1][5]=dx21*one_over_four;
+    G[2][3]=-0.5;
+    G[2][4]=-dy32*one_over_four;
+    G[2][5]=dx32*one_over_four;
+    G[2][6]=0.5;
+    G[2][7]=-dy32*one_over_four;
+    G[2][8]=dx32*one_over_four;
+    G[3][6]=0.5;
+    G[3][7]=-dy34*one_over_four;
+    G[3][8]=dx34*one_over_four;
+    G[3][9]=-0.5;
+    G[3][10]=-dy34*one_over_four;
+    G[3][11]=dx34*one_over_four;
   }
 
-//! @brief return secant matrix
-const XC::Matrix &XC::ShellMITC4Base::getInitialStiff(void) const
+//! @brief Computes the shape functions and the B matrices (including
+//! the assumed strain interpolation of the shear terms) at all the
+//! Gauss points.
+void XC::ShellMITC4Base::setupKernel(ShellKernel<4,4> &kernel) const
   {
-    if(!Ki.isEmpty())
-      return Ki;
-
-    static const int ndf= 6; //two membrane plus three bending plus one drill
-    static const int nstress= 8; //three membrane, three moment, two shear
     static const int ngauss= 4;
     static const int numnodes= 4;
 
-    int i,  j,  k, p, q;
-    int jj, kk;
-
-    double volume= 0.0;
-
-    static double xsj;  // determinant of the jacobian matrix 
-    static double dvol[ngauss]; //volume element
-    static double shp[3][numnodes];  //shape functions at a gauss point
-
-    //  static double Shape[3][numnodes][ngauss]; //all the shape functions
-
-    static Matrix stiffJK(ndf,ndf); //nodeJK stiffness 
-    static Matrix dd(nstress,nstress);  //material tangent
-    static Matrix J0(2,2);  //Jacobian at center
-    static Matrix J0inv(2,2); //inverse of Jacobian at center
-
-    //---------B-matrices------------------------------------
-    static Matrix BJ(nstress,ndf);      // B matrix node J
-    static Matrix BJtran(ndf,nstress);
-    static Matrix BK(nstress,ndf);      // B matrix node k
-    static Matrix BJtranD(ndf,nstress);
-    static Matrix Bbend(3,3);  // bending B matrix
-    static Matrix Bshear(2,3); // shear B matrix
-    static Matrix Bmembrane(3,2); // membrane B matrix
-    static double BdrillJ[ndf]; //drill B matrix
-    static double BdrillK[ndf];  
-
-    double *drillPointer;
-
-    static double saveB[nstress][ndf][numnodes];
-
-    //-------------------------------------------------------
-
-    stiff.Zero( );
- 
-    Matrix G= calculateG();
-
-
-    Matrix Ms(2,4);
-    Ms.Zero();
-    Matrix Bsv(2,12);
-    Bsv.Zero();
+    double G[4][12];
+    calculateG(G);
 
     const double Ax= -xl[0][0]+xl[0][1]+xl[0][2]-xl[0][3];
     const double Bx=  xl[0][0]-xl[0][1]+xl[0][2]-xl[0][3];
@@ -466,29 +559,24 @@ const XC::Matrix &XC::ShellMITC4Base::getInitialStiff(void) const
     const double By=  xl[1][0]-xl[1][1]+xl[1][2]-xl[1][3];
     const double Cy= -xl[1][0]-xl[1][1]+xl[1][2]+xl[1][3];
 
-    double alph= atan2(Ay,Ax);
-    double beta= 3.141592653589793/2-atan2(Cx,Cy);
-    Matrix Rot(2,2);
-    Rot.Zero();
-    Rot(0,0)=sin(beta);
-    Rot(0,1)=-sin(alph);
-    Rot(1,0)=-cos(beta);
-    Rot(1,1)=cos(alph);
-    Matrix Bs(2,12);
-  
-    double r1= 0;
-    double r2= 0;
-    double r3= 0;
+    const double alph= atan2(Ay,Ax);
+    const double beta= 3.141592653589793/2-atan2(Cx,Cy);
+    const double Rot[2][2]= {{sin(beta),-sin(alph)},{-cos(beta),cos(alph)}};
 
+    double xsj;  // determinant jacobian matrix 
+    double shp[3][numnodes];  //shape functions at a gauss point
+    double Ms[2][4]= {{0.0,0.0,0.0,0.0},{0.0,0.0,0.0,0.0}};
+    double Bsv[2][12];
+    double Bshear[2][3]; // shear B matrix
     //gauss loop 
-    for(i=0;i<ngauss;i++)
+    for(int i= 0;i<ngauss;i++)
       {
         const GaussPoint &gp= getGaussModel().getGaussPoints()[i];
-        r1= Cx + gp.r_coordinate()*Bx;
-        r3= Cy + gp.r_coordinate()*By;
+        double r1= Cx + gp.r_coordinate()*Bx;
+        double r3= Cy + gp.r_coordinate()*By;
         r1= r1*r1 + r3*r3;
         r1= sqrt (r1);
-        r2= Ax + gp.s_coordinate()*Bx;
+        double r2= Ax + gp.s_coordinate()*Bx;
         r3= Ay + gp.s_coordinate()*By;
         r2= r2*r2 + r3*r3;
         r2= sqrt (r2);
@@ -496,132 +584,61 @@ const XC::Matrix &XC::ShellMITC4Base::getInitialStiff(void) const
         //get shape functions    
         shape2d( gp.r_coordinate(), gp.s_coordinate(), xl, shp, xsj );
         //volume element to also be saved
-        dvol[i]= gp.weight() * xsj;  
-        volume += dvol[i];
-
-        Ms(1,0)=1-gp.r_coordinate();
-        Ms(0,1)=1-gp.s_coordinate();
-        Ms(1,2)=1+gp.r_coordinate();
-        Ms(0,3)=1+gp.s_coordinate();
-        Bsv= Ms*G;
-
-        for( j= 0; j < 12; j++ )
+        kernel.setShapeFunctions(i,shp,gp.weight() * xsj);
+
+        Ms[1][0]=1-gp.r_coordinate();
+        Ms[0][1]=1-gp.s_coordinate();
+        Ms[1][2]=1+gp.r_coordinate();
+        Ms[0][3]=1+gp.s_coordinate();
+        //Bsv= Ms*G;
+        for(int j= 0;j<12;j++)
+          for(int p= 0;p<2;p++)
+            {
+              double tmp= 0.0;
+              for(int k= 0;k<4;k++)
+                tmp+= Ms[p][k]*G[k][j];
+              Bsv[p][j]= tmp;
+            }
+
+        for(int j= 0;j<12;j++)
           {
-            Bsv(0,j)=Bsv(0,j)*r1/(8*xsj);
-            Bsv(1,j)=Bsv(1,j)*r2/(8*xsj);
+            Bsv[0][j]= Bsv[0][j]*r1/(8*xsj);
+            Bsv[1][j]= Bsv[1][j]*r2/(8*xsj);
           }
-        Bs=Rot*Bsv;
-    
-        // j-node loop to compute strain 
-        for( j= 0; j < numnodes; j++ )
-          {
-            //compute B matrix 
-            Bmembrane= computeBmembrane( j, shp );
-            Bbend= computeBbend( j, shp );
-            for(p= 0; p < 3; p++)
-              {
-                Bshear(0,p)= Bs(0,j*3+p);
-                Bshear(1,p)= Bs(1,j*3+p);
-              }//end for p
-            BJ= assembleB( Bmembrane, Bbend, Bshear );
-
-	    //save the B-matrix
-           for(p=0; p<nstress; p++)
-             {
-               for(q=0; q<ndf; q++ )
-                 saveB[p][q][j]= BJ(p,q);
-             }//end for p
-
-           //drilling B matrix
-           drillPointer= computeBdrill( j, shp );
-           for(p=0; p<ndf; p++ )
-             {
-               //BdrillJ[p]= *drillPointer++;
-               BdrillJ[p]= *drillPointer; //set p-th component
-               drillPointer++;             //pointer arithmetic
-             }//end for p
-          } // end for j
-
-        dd= physicalProperties[i]->getInitialTangent( );
-        dd*= dvol[i];
-
-        //tangent calculations node loops
-
-        jj= 0;
-        for(j=0;j<numnodes;j++)
+        //Bs= Rot*Bsv;
+        for(int j= 0;j<numnodes;j++)
           {
-            //extract BJ
-            for(p=0; p<nstress; p++)
-              {
-                for(q=0; q<ndf; q++ )
-                  BJ(p,q)= saveB[p][q][j];
-              }//end for p
+            for(int p= 0;p<3;p++)
+              for(int q= 0;q<2;q++)
+                Bshear[q][p]= Rot[q][0]*Bsv[0][j*3+p]+Rot[q][1]*Bsv[1][j*3+p];
+            kernel.setShearB(i,j,Bshear);
+          }
+      } //end for i gauss loop
+    kernel.computeB();
+  }
 
-            //multiply bending terms by (-1.0) for correct statement
-            // of equilibrium  
-            for(p=3;p<6;p++)
-              {
-                for(q=3;q<6;q++)
-                  BJ(p,q) *= (-1.0);
-              } //end for p
+//! @brief return secant matrix
+const XC::Matrix &XC::ShellMITC4Base::getInitialStiff(void) const
+  {
+    const Matrix *kl= getSharedLocalStiff();
+    if(kl) // shared with other elements (no need to store Ki).
+      {
+        localToGlobalStiff(*kl,stiff);
+        return stiff;
+      }
+    if(!Ki.isEmpty())
+      return Ki;
 
-            //transpose 
-            //BJtran= transpose( 8, ndf, BJ );
-            for(p=0; p<ndf; p++)
-              {
-                for(q=0; q<nstress; q++) 
-                  BJtran(p,q)= BJ(q,p);
-              }//end for p
+    static const int ngauss= 4;
+
+    stiff.Zero( );
+
+    ShellKernel<4,4> kernel(theCoordTransf->G1(),theCoordTransf->G2(),theCoordTransf->G3());
+    setupKernel(kernel);
+    for(int i= 0;i<ngauss;i++)
+      kernel.setTangent(i,physicalProperties[i]->getInitialTangent());
+    kernel.addTangent(stiff,Ktt);
 
-            //drilling B matrix
-            drillPointer= computeBdrill( j, shp );
-            for(p=0; p<ndf; p++ )
-              {
-                BdrillJ[p]= *drillPointer;
-                drillPointer++;
-              }//end for p
-
-            //BJtranD= BJtran * dd;
-            BJtranD.addMatrixProduct(0.0, BJtran,dd,1.0 );
-      
-            for(p=0; p<ndf; p++) 
-              BdrillJ[p]*= ( Ktt*dvol[i] );
-      
-            kk= 0;
-            for(k= 0; k < numnodes; k++ )
-              {
-                //extract BK
-                for(p=0; p<nstress; p++)
-                  {
-                    for(q=0; q<ndf; q++ )
-                      BK(p,q)= saveB[p][q][k];
-                  }//end for p
-       
-                //stiffJK= BJtranD * BK;
-                // +  transpose( 1,ndf,BdrillJ ) * BdrillK; 
-                stiffJK.addMatrixProduct(0.0, BJtranD,BK,1.0 );
-
-                //drilling B matrix
-                drillPointer= computeBdrill( k, shp );
-                for(p=0; p<ndf; p++ )
-                  {
-                    BdrillK[p]= *drillPointer;
-                    drillPointer++;
-                  }//end for p
-        
-                for(p=0;p<ndf;p++)
-                  {
-                   for(q=0;q<ndf;q++)
-                     {
-                       stiff(jj+p,kk+q)+=stiffJK(p,q) + (BdrillJ[p]*BdrillK[q]);
-                     }//end for q
-                  }//end for p   
-                kk += ndf;
-              } // end for k loop
-          jj += ndf;
-        } // end for j loop
- 
-      } //end for i gauss loop
     theCoordTransf->getGlobalTangent(stiff);
     Ki= stiff;
     return stiff;
@@ -631,8 +648,14 @@ const XC::Matrix &XC::ShellMITC4Base::getInitialStiff(void) const
 //! @brief return mass matrix
 const XC::Matrix& XC::ShellMITC4Base::getMass(void) const
   {
-    int tangFlag= 1;
-    formInertiaTerms( tangFlag );
+    const Matrix *m= getSharedMass();
+    if(m) // shared with other elements.
+      mass= *m;
+    else
+      {
+        int tangFlag= 1;
+        formInertiaTerms( tangFlag );
+      }
     if(isDead())
       mass*=dead_srf;
     return mass;
@@ -966,263 +989,41 @@ void XC::ShellMITC4Base::formResidAndTangent(int tang_flag) const
     //
 
     static const int ndf= 6; //two membrane plus three bending plus one drill
-    static const int nstress= 8; //three membrane, three moment, two shear
     static const int ngauss= 4;
     static const int numnodes= 4;
 
-    int i,  j,  k, p, q;
-    int jj, kk;
-
-    int success;
-    
-    double volume= 0.0;
-
-    static double xsj;  // determinant jacaobian matrix 
-    static double dvol[ngauss]; //volume element
-    static Vector strain(nstress);  //strain
-    static double shp[3][numnodes];  //shape functions at a gauss point
-
-    //  static double Shape[3][numnodes][ngauss]; //all the shape functions
-    static Vector residJ(ndf); //nodeJ residual 
-    static Matrix stiffJK(ndf,ndf); //nodeJK stiffness 
-    static Vector stress(nstress);  //stress resultants
-    static Matrix dd(nstress,nstress);  //material tangent
-    static Matrix J0(2,2);  //Jacobian at center
-    static Matrix J0inv(2,2); //inverse of Jacobian at center
-
-    double epsDrill= 0.0;  //drilling "strain"
-    double tauDrill= 0.0; //drilling "stress"
-
-    //---------B-matrices------------------------------------
-    static Matrix BJ(nstress,ndf);      // B matrix node J
-    static Matrix BJtran(ndf,nstress);
-    static Matrix BK(nstress,ndf);      // B matrix node k
-    static Matrix BJtranD(ndf,nstress);
-    static Matrix Bbend(3,3);  // bending B matrix
-    static Matrix Bshear(2,3); // shear B matrix
-    static Matrix Bmembrane(3,2); // membrane B matrix
-    static double BdrillJ[ndf]; //drill B matrix
-    static double BdrillK[ndf];  
-
-    double *drillPointer;
-
-    static double saveB[nstress][ndf][numnodes];
-
-    //------------------------------------------------------- 
-
     //zero stiffness and residual 
     stiff.Zero( );
     resid.Zero( );
 
-    const Matrix G= calculateG();
-
-    Matrix Ms(2,4);
-    Ms.Zero();
-    Matrix Bsv(2,12);
-    Bsv.Zero();
-
-    const double Ax= -xl[0][0]+xl[0][1]+xl[0][2]-xl[0][3];
-    const double Bx=  xl[0][0]-xl[0][1]+xl[0][2]-xl[0][3];
-    const double Cx= -xl[0][0]-xl[0][1]+xl[0][2]+xl[0][3];
-
-    const double Ay= -xl[1][0]+xl[1][1]+xl[1][2]-xl[1][3];
-    const double By=  xl[1][0]-xl[1][1]+xl[1][2]-xl[1][3];
-    const double Cy= -xl[1][0]-xl[1][1]+xl[1][2]+xl[1][3];
-
-    const double alph= atan2(Ay,Ax);
-    const double beta= 3.141592653589793/2-atan2(Cx,Cy);
-    Matrix Rot(2,2);
-    Rot.Zero();
-    Rot(0,0)=sin(beta);
-    Rot(0,1)=-sin(alph);
-    Rot(1,0)=-cos(beta);
-    Rot(1,1)=cos(alph);
-    Matrix Bs(2,12);
-    
-    double r1= 0;
-    double r2= 0;
-    double r3= 0;
+    ShellKernel<4,4> kernel(theCoordTransf->G1(),theCoordTransf->G2(),theCoordTransf->G3());
+    setupKernel(kernel);
 
-    //gauss loop 
-    for(i= 0;i<ngauss;i++)
+    //nodal "displacements" 
+    double ul[numnodes][ndf];
+    for(int j= 0;j<numnodes;j++)
       {
-        const GaussPoint &gp= getGaussModel().getGaussPoints()[i];
-        r1= Cx + gp.r_coordinate()*Bx;
-        r3= Cy + gp.r_coordinate()*By;
-        r1= r1*r1 + r3*r3;
-        r1= sqrt (r1);
-        r2= Ax + gp.s_coordinate()*Bx;
-        r3= Ay + gp.s_coordinate()*By;
-        r2= r2*r2 + r3*r3;
-        r2= sqrt (r2);
-
-        //get shape functions    
-        shape2d( gp.r_coordinate(), gp.s_coordinate(), xl, shp, xsj );
-        //volume element to also be saved
-        dvol[i]= gp.weight() * xsj;  
-        volume += dvol[i];
-
-        Ms(1,0)=1-gp.r_coordinate();
-        Ms(0,1)=1-gp.s_coordinate();
-        Ms(1,2)=1+gp.r_coordinate();
-        Ms(0,3)=1+gp.s_coordinate();
-        Bsv= Ms*G;
-
-        for(j=0;j<12;j++)
-          {
-            Bsv(0,j)=Bsv(0,j)*r1/(8*xsj);
-            Bsv(1,j)=Bsv(1,j)*r2/(8*xsj);
-          }
-        Bs=Rot*Bsv;
-
-        //zero the strains
-        strain.Zero( );
-        epsDrill= 0.0;
-
-        // j-node loop to compute strain 
-        for(j=0;j<numnodes;j++)
-          {
-            //compute B matrix 
-            Bmembrane= computeBmembrane( j, shp );
-            Bbend= computeBbend( j, shp );
-
-            for(p=0;p<3;p++)
-              {
-                Bshear(0,p)= Bs(0,j*3+p);
-                Bshear(1,p)= Bs(1,j*3+p);
-              }//end for p
-            BJ= assembleB( Bmembrane, Bbend, Bshear );
-
-            //save the B-matrix
-            for(p=0; p<nstress; p++)
-              {
-                for(q=0; q<ndf; q++ )
-                  saveB[p][q][j]= BJ(p,q);
-              }//end for p
-
-            //nodal "displacements" 
-            const Vector &ul= theCoordTransf->getBasicTrialDisp(j);
-
-            //compute the strain
-            //strain += (BJ*ul); 
-            strain.addMatrixVector(1.0, BJ,ul,1.0 );
-
-            //drilling B matrix
-            drillPointer= computeBdrill( j, shp );
-            for(p=0; p<ndf; p++ )
-              {
-                BdrillJ[p]= *drillPointer; //set p-th component
-                drillPointer++;             //pointer arithmetic
-              }//end for p
-
-            //drilling "strain" 
-            for(p=0;p<ndf;p++)
-              epsDrill +=  BdrillJ[p]*ul(p);
-          } // end for j
-    
+        const Vector disp= theCoordTransf->getBasicTrialDisp(j);
+        for(int p= 0;p<ndf;p++)
+          ul[j][p]= disp(p);
+      }
+    kernel.computeStrains(ul);
 
+    for(int i= 0;i<ngauss;i++)
+      {
+        SectionForceDeformation *section= const_cast<SectionForceDeformation *>(physicalProperties[i]);
         //send the strain to the material
-        success= const_cast<SectionForceDeformation *>(physicalProperties[i])->setTrialSectionDeformation( strain );
-
+        kernel.setTrialSectionDeformation(i,*section);
         //compute the stress
-        stress= physicalProperties[i]->getStressResultant( );
-
-        //drilling "stress" 
-        tauDrill= Ktt * epsDrill;
-
-        //multiply by volume element
-        stress*= dvol[i];
-        tauDrill*= dvol[i];
-
-        if( tang_flag == 1 )
-          {
-            dd= physicalProperties[i]->getSectionTangent( );
-            dd *= dvol[i];
-          } //end if tang_flag
-
-
-        //residual and tangent calculations node loops
-
-        jj= 0;
-        for(j=0;j<numnodes;j++)
-          {
-            //extract BJ
-            for(p=0; p<nstress;p++)
-              {
-                for(q=0;q<ndf;q++)
-                  BJ(p,q)= saveB[p][q][j];
-              }//end for p
-
-            //multiply bending terms by (-1.0) for correct statement
-            // of equilibrium  
-            for(p= 3;p<6;p++)
-              {
-                for(q=3;q<6;q++) 
-                  BJ(p,q) *= (-1.0);
-              } //end for p
-
-            //transpose 
-            for(p=0; p<ndf; p++)
-              {
-                for(q=0; q<nstress; q++) 
-                  BJtran(p,q)= BJ(q,p);
-              }//end for p
-
-            residJ.addMatrixVector(0.0, BJtran,stress,1.0 );
-
-            //drilling B matrix
-            drillPointer= computeBdrill( j, shp );
-            for(p=0; p<ndf; p++ )
-              {
-                BdrillJ[p]= *drillPointer;
-                drillPointer++;
-              }//end for p
-
-            //residual including drill
-            for(p=0;p<ndf;p++)
-              resid( jj + p ) += ( residJ(p) + BdrillJ[p]*tauDrill );
+        kernel.setStress(i,section->getStressResultant(),Ktt);
+        if(tang_flag == 1)
+          kernel.setTangent(i,section->getSectionTangent());
+      }
 
-            if(tang_flag==1)
-              {
-                BJtranD.addMatrixProduct(0.0, BJtran,dd,1.0 );
-                for(p=0; p<ndf; p++) 
-                  BdrillJ[p] *= ( Ktt*dvol[i] );
-
-                kk= 0;
-                for(k=0;k<numnodes;k++)
-                  {
-                    //extract BK
-                    for(p=0; p<nstress; p++)
-                      {
-                        for(q=0; q<ndf; q++ )
-                          BK(p,q)= saveB[p][q][k];
-                      }//end for p
-            
-                     //drilling B matrix
-                     drillPointer= computeBdrill( k, shp );
-                     for(p=0; p<ndf; p++ )
-                       {
-                         BdrillK[p]= *drillPointer;
-                         drillPointer++;
-                       }//end for p
- 
-                    //stiffJK= BJtranD * BK;
-                    // +  transpose( 1,ndf,BdrillJ ) * BdrillK; 
-                    stiffJK.addMatrixProduct(0.0, BJtranD,BK,1.0);
-
-                    for(p=0;p<ndf;p++)
-                      {
-                        for(q=0;q<ndf;q++)
-                          {
-                            stiff(jj+p,kk+q) += stiffJK(p,q) + (BdrillJ[p]*BdrillK[q]);
-                          }//end for q
-                      }//end for p
-                    kk+= ndf;
-                  } // end for k loop
-              } // end if tang_flag 
-          jj+= ndf;
-        } // end for j loop
-      } //end for i gauss loop     
+    //residual and tangent calculations node loops
+    kernel.addResid(resid);
+    if(tang_flag == 1)
+      kernel.addTangent(stiff,Ktt);
     theCoordTransf->getGlobalResidAndTangent(resid,stiff);
     return;
   }
@@ -1232,215 +1033,9 @@ void XC::ShellMITC4Base::computeBasis(void)
   {
     theCoordTransf->initialize(theNodes);
     theCoordTransf->setup_nodal_local_coordinates(xl);
-  }
-
-//! @brief compute Bdrill
-double *XC::ShellMITC4Base::computeBdrill( int node, const double shp[3][4]) const
-  {
-
-    //static Matrix Bdrill(1,6);
-    static double Bdrill[6];
-
-    static double B1;
-    static double B2;
-    static double B6;
-
-
-//---Bdrill Matrix in standard {1,2,3} mechanics notation---------
-//
-//             -                                       -
-//   Bdrill= | -0.5*N,2   +0.5*N,1    0    0    0   -N |   (1x6)
-//             -                                       -
-//
-//----------------------------------------------------------------
-
-    //  Bdrill.Zero( );
-
-    //Bdrill(0,0)= -0.5*shp[1][node];
-
-    //Bdrill(0,1)= +0.5*shp[0][node];
-
-    //Bdrill(0,5)=     -shp[2][node];
-
-
-    B1= -0.5*shp[1][node];
-    B2= +0.5*shp[0][node];
-    B6= -shp[2][node];
-   
-    const Vector &g1= theCoordTransf->G1();
-    const Vector &g2= theCoordTransf->G2();
-
-    Bdrill[0]= B1*g1[0] + B2*g2[0];
-    Bdrill[1]= B1*g1[1] + B2*g2[1];
-    Bdrill[2]= B1*g1[2] + B2*g2[2];
-
-    const Vector &g3= theCoordTransf->G3();
-    Bdrill[3]= B6*g3[0];
-    Bdrill[4]= B6*g3[1];
-    Bdrill[5]= B6*g3[2];
-
-    return Bdrill;
-  }
-
-//! @brief compute Bmembrane matrix
-const XC::Matrix &XC::ShellMITC4Base::computeBmembrane( int node, const double shp[3][4] ) const
-  {
-
-    static Matrix Bmembrane(3,2);
-
-//---Bmembrane matrix in standard {1,2,3} mechanics notation---------
-//
-//                -             -
-//               | +N,1      0   |
-// Bmembrane=    |   0     +N,2  |    (3x2)
-//               | +N,2    +N,1  |
-//                -             -
-//
-//  three(3) strains and two(2) displacements (for plate)
-//-------------------------------------------------------------------
-
-    Bmembrane.Zero( );
-
-    Bmembrane(0,0)= shp[0][node];
-    Bmembrane(1,1)= shp[1][node];
-    Bmembrane(2,0)= shp[1][node];
-    Bmembrane(2,1)= shp[0][node];
-
-    return Bmembrane;
-  }
-
-//! @brief assemble a B matrix
-//! @param Bmembrane: membrane B matrix (3x2)
-//! @param Bbend:  plate bending B matrix (3x2)
-//! @param Bshear: plate shear B matrix (2x3)
-const XC::Matrix &XC::ShellMITC4Base::assembleB(const Matrix &Bmembrane, const Matrix &Bbend, const Matrix &Bshear) const
-  {
-
-    static Matrix B(8,6);
-    static Matrix BmembraneShell(3,3);
-    static Matrix BbendShell(3,3);
-    static Matrix BshearShell(2,6);
-    static Matrix Gmem(2,3);
-    static Matrix Gshear(3,6);
-
-//
-// For Shell :
-//
-//---B Matrices in standard {1,2,3} mechanics notation---------
-//
-//            -                     _
-//           | Bmembrane  |     0    |
-//           | --------------------- |
-//    B=     |     0      |  Bbend   |   (8x6)
-//           | --------------------- |
-//           |         Bshear        |
-//            -           -         -
-//
-//-------------------------------------------------------------
-//
-//
-
-
-    //shell modified membrane terms
-
-    const Vector &g1= theCoordTransf->G1();
-    Gmem(0,0)= g1[0];
-    Gmem(0,1)= g1[1];
-    Gmem(0,2)= g1[2];
-
-    const Vector &g2= theCoordTransf->G2();
-    Gmem(1,0)= g2[0];
-    Gmem(1,1)= g2[1];
-    Gmem(1,2)= g2[2];
-
-    //BmembraneShell= Bmembrane * Gmem;
-    BmembraneShell.addMatrixProduct(0.0, Bmembrane,Gmem,1.0 );
-
-
-    //shell modified bending terms
-    Matrix &Gbend= Gmem;
-
-    //BbendShell= Bbend * Gbend;
-    BbendShell.addMatrixProduct(0.0, Bbend,Gbend,1.0 );
-
-
-    //shell modified shear terms
-    Gshear.Zero( );
-
-    const Vector &g3= theCoordTransf->G3();
-    Gshear(0,0)= g3[0];
-    Gshear(0,1)= g3[1];
-    Gshear(0,2)= g3[2];
-
-    Gshear(1,3)= g1[0];
-    Gshear(1,4)= g1[1];
-    Gshear(1,5)= g1[2];
-
-    Gshear(2,3)= g2[0];
-    Gshear(2,4)= g2[1];
-    Gshear(2,5)= g2[2];
-
-    //BshearShell= Bshear * Gshear;
-    BshearShell.addMatrixProduct(0.0, Bshear,Gshear,1.0 );
-
-    B.Zero( );
-
-    //assemble B from sub-matrices
-
-    //membrane terms
-    for(int p= 0; p < 3; p++ )
-      {
-        for(int q= 0; q < 3; q++ )
-          B(p,q)= BmembraneShell(p,q);
-      } //end for p
-
-
-    //bending terms
-    int pp;
-    for(int p= 3; p < 6; p++ )
-      {
-        pp= p - 3;
-        for(int q= 3; q < 6; q++ )
-          B(p,q)= BbendShell(pp,q-3);
-      } // end for p
-
-
-    //shear terms
-    for(int p= 0; p < 2; p++ )
-      {
-        pp= p + 6;
-        for(int q= 0; q < 6; q++ )
-          { B(pp,q)= BshearShell(p,q); } // end for q
-      } //end for p
-
-    return B;
-  }
-
-//! @brief compute Bbend matrix
-const XC::Matrix &XC::ShellMITC4Base::computeBbend( int node, const double shp[3][4] ) const
-  {
-
-      static XC::Matrix Bbend(3,2);
-
-//---Bbend matrix in standard {1,2,3} mechanics notation---------
-//
-//            -             -
-//   Bbend=  |    0    -N,1  |
-//           |  +N,2     0   |    (3x2)
-//           |  +N,1   -N,2  |
-//            -             -
-//
-//  three(3) curvatures and two(2) rotations (for plate)
-//----------------------------------------------------------------
-
-      Bbend.Zero( );
-
-      Bbend(0,1)= -shp[0][node];
-      Bbend(1,0)=  shp[1][node];
-      Bbend(2,0)=  shp[0][node];
-      Bbend(2,1)= -shp[1][node];
-
-      return Bbend;
+    // the geometry may have changed.
+    sharedStiff.reset();
+    sharedMass.reset();
   }
 
 //! @brief shape function routine for MITC4 elements.
@@ -1455,8 +1050,8 @@ void XC::ShellMITC4Base::shape2d(const double &ss, const double &tt,const double
     static const double s[]= { -0.5,  0.5, 0.5, -0.5 };
     static const double t[]= { -0.5, -0.5, 0.5,  0.5 };
 
-    static double xs[2][2];
-    static double sx[2][2];
+    double xs[2][2];
+    double sx[2][2];
 
     for(int i= 0; i < 4; i++ )
       {
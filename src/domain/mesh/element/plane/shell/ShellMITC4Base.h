@@ -33,9 +33,11 @@
 #include "domain/mesh/element/utils/physical_properties/SectionFDPhysicalProperties.h"
 #include "ShellCrdTransf3dBase.h"
 #include "ShellBData.h"
+#include "ShellKernel.h"
 #include <utility/matrix/Vector.h>
 #include <utility/matrix/Matrix.h>
 #include "domain/mesh/element/utils/fvectors/FVectorShell.h"
+#include "domain/mesh/element/utils/SharedMatrixCache.h"
 
 class Polygon3d;
 
@@ -57,6 +59,8 @@ class ShellMITC4Base : public QuadBase4N<SectionFDPhysicalProperties>
     FVectorShell p0; //!< Reactions in the basic system due to element loads
 
     mutable Matrix Ki;
+    mutable SharedMatrixRef sharedStiff; //!< stiffness in local axes shared with the identical elements.
+    mutable SharedMatrixRef sharedMass; //!< mass matrix shared with the identical elements.
 
     std::vector<Vector> inicDisp; //!< Initial displacements.
 
@@ -77,11 +81,12 @@ class ShellMITC4Base : public QuadBase4N<SectionFDPhysicalProperties>
 
     void formInertiaTerms(int tangFlag) const;
     void formResidAndTangent(int tang_flag) const;
-    const Matrix calculateG(void) const;
-    double *computeBdrill(int node, const double shp[3][4]) const;
-    const Matrix& assembleB(const Matrix &Bmembrane, const Matrix &Bbend, const Matrix &Bshear) const;
-    const Matrix& computeBmembrane(int node, const double shp[3][4] ) const;
-    const Matrix& computeBbend(int node, const double shp[3][4] ) const;
+    void calculateG(double G[4][12]) const;
+    void setupKernel(ShellKernel<4,4> &) const;
+    SharedMatrixCache::Key getSharedMatrixKey(const int &) const;
+    const Matrix *getSharedLocalStiff(void) const;
+    const Matrix *getSharedMass(void) const;
+    void localToGlobalStiff(const Matrix &,Matrix &) const;
     static void shape2d(const double &,const double &, const double x[2][4], double shp[3][4], double &xsj);
     int sendCoordTransf(int posFlag,const int &,const int &,CommParameters &);
     int recvCoordTransf(int posFlag,const int &posClassTag,const int &posDbTag,const CommParameters &);
@@ -108,6 +113,7 @@ class ShellMITC4Base : public QuadBase4N<SectionFDPhysicalProperties>
 
     //return stiffness matrix 
     const Matrix &getTangentStiff(void) const;
+    bool hasConstantTangent(void) const;
     const Matrix &getInitialStiff(void) const;
     const Matrix &getMass(void) const;
 
@@ -135,165 +135,44 @@ const XC::Matrix &XC::ShellNL::getTangentStiff(void) const
     return stiff;
   }
 
-//! @brief return secant matrix 
-const XC::Matrix &XC::ShellNL::getInitialStiff(void) const 
+//! @brief Computes the shape functions and the B matrices at all the
+//! Gauss points.
+void XC::ShellNL::setupKernel(ShellKernel<9,9> &kernel) const
   {
-    if(Ki)
-      return *Ki;
-
-    static const int ndf= 6; //two membrane plus three bending plus one drill
-    static const int nstress= 8; //three membrane, three moment, two shear
-    static const int ngauss= 9; 
+    static const int ngauss= 9;
     static const int numnodes= 9;
 
-    double volume= 0.0;
-
-    static double xsj;  // determinant jacaobian matrix 
-    static double dvol[ngauss]; //volume element
-    static double shp[3][numnodes];  //shape functions at a gauss point
-
-    static Matrix stiffJK(ndf,ndf); //nodeJK stiffness 
-    static Matrix dd(nstress,nstress);  //material tangent
-
-    //static Matrix J0(2,2);  //Jacobian at center
- 
-    //static Matrix J0inv(2,2); //inverse of Jacobian at center
-
-    //---------B-matrices------------------------------------
-    static Matrix BJ(nstress,ndf);      // B matrix node J
-    static Matrix BJtran(ndf,nstress);
-    static Matrix BK(nstress,ndf);      // B matrix node k
-    static Matrix BJtranD(ndf,nstress);
-    static Matrix Bbend(3,3);  // bending B matrix
-    static Matrix Bshear(2,3); // shear B matrix
-    static Matrix Bmembrane(3,2); // membrane B matrix
-    static double BdrillJ[ndf]; //drill B matrix
-    static double BdrillK[ndf];  
-
-    double *drillPointer;
-
-    static double saveB[nstress][ndf][numnodes];
-
-    //-------------------------------------------------------
-    stiff.Zero();
-
-    //compute Jacobian and inverse at center
-    //double L1= 0.0;
-    //double L2= 0.0;
-    //computeJacobian( L1, L2, xl, J0, J0inv ); 
-
+    double xsj;  // determinant jacobian matrix 
+    double shp[3][numnodes];  //shape functions at a gauss point
     //gauss loop 
     for(int i= 0;i<ngauss;i++)
       {
         //get shape functions
         const GaussPoint &gp= getGaussModel().getGaussPoints()[i];
         shape2d(gp.r_coordinate(), gp.s_coordinate(),xl,shp,xsj);
-
         //volume element to also be saved
-        dvol[i]= gp.weight()*xsj;  
-        volume+= dvol[i];
-
-        // j-node loop to compute strain 
-        for(int j=0;j<numnodes;j++)
-          {
-            //compute B matrix 
-            Bmembrane= computeBmembrane( j, shp );
-            Bbend= computeBbend( j, shp );
-            Bshear= computeBshear( j, shp );
-            BJ= assembleB(Bmembrane,Bbend,Bshear);
-
-            //save the B-matrix
-            for(int p=0; p<nstress; p++)
-              for(int q=0;q<ndf;q++)
-                saveB[p][q][j]= BJ(p,q);
-
-            //drilling B matrix
-            drillPointer= computeBdrill( j, shp );
-            for(int p=0; p<ndf; p++ )
-              {
-                //BdrillJ[p]= *drillPointer++;
-	        BdrillJ[p]= *drillPointer; //set p-th component
-	        drillPointer++;             //pointer arithmetic
-	      }//end for p
-          } // end for j
-
-        dd= physicalProperties[i]->getInitialTangent();
-        dd*= dvol[i];
-
-        //residual and tangent calculations node loops
-
-        int jj= 0;
-        for(int j= 0;j<numnodes;j++)
-          {
-            //extract BJ
-            for(int p=0; p<nstress;p++)
-              {
-	        for(int q=0;q<ndf;q++)
-                  BJ(p,q)= saveB[p][q][j];
-              }//end for p
-
-            //multiply bending terms by (-1.0) for correct statement
-            // of equilibrium  
-            for(int p= 3;p<6;p++)
-              {
-	        for(int q= 3;q<6;q++) 
-                BJ(p,q)*= (-1.0);
-               } //end for p
-
-            //transpose 
-            //BJtran= transpose( 8, ndf, BJ );
-            for(int p=0; p<ndf; p++)
-              {
-                for(int q=0; q<nstress; q++) 
-                  BJtran(p,q)= BJ(q,p);
-              }//end for p
+        kernel.setShapeFunctions(i,shp,gp.weight()*xsj);
+      }
+    kernel.computeB();
+    kernel.computeStandardShearB();
+  }
 
-            //drilling B matrix
-            drillPointer= computeBdrill( j, shp );
-            for(int p=0;p<ndf;p++)
-              {
-	        BdrillJ[p]= *drillPointer;
-	        drillPointer++;
-              }//end for p
+//! @brief return secant matrix 
+const XC::Matrix &XC::ShellNL::getInitialStiff(void) const 
+  {
+    if(Ki)
+      return *Ki;
 
-            //BJtranD= BJtran * dd;
-            BJtranD.addMatrixProduct(0.0, BJtran,dd,1.0 );
-	  
+    static const int ngauss= 9; 
 
-            for(int p=0; p<ndf; p++) 
-	      BdrillJ[p]*= (Ktt*dvol[i]);
+    stiff.Zero();
 
+    ShellKernel<9,9> kernel(theCoordTransf.G1(),theCoordTransf.G2(),theCoordTransf.G3());
+    setupKernel(kernel);
+    for(int i= 0;i<ngauss;i++)
+      kernel.setTangent(i,physicalProperties[i]->getInitialTangent());
+    kernel.addTangent(stiff,Ktt);
 
-            int kk= 0;
-            for(int k= 0;k<numnodes;k++)
-              {
-                //extract BK
-	        for(int p=0;p<nstress;p++)
-                  {
-                    for(int q=0; q<ndf; q++ )
-	              BK(p,q)= saveB[p][q][k];
-		  }//end for p
-	
-                //drilling B matrix
-	        drillPointer= computeBdrill( k, shp );
-	        for(int p=0; p<ndf; p++)
-                  {
-                    BdrillK[p]= *drillPointer;
-	            drillPointer++;
-	          }//end for p
-	
-                //stiffJK= BJtranD * BK ;
-                // +  transpose( 1,ndf,BdrillJ ) * BdrillK; 
-	        stiffJK.addMatrixProduct(0.0, BJtranD,BK,1.0 );
-	
-	        for(int p= 0;p<ndf;p++)
-                  for(int q= 0;q<ndf;q++)
-                    stiff( jj+p, kk+q )+= stiffJK(p,q) + ( BdrillJ[p]*BdrillK[q] );
-                kk+= ndf;
-	      } // end for k loop
-            jj+= ndf;
-          } // end for j loop
-      } //end for i gauss loop 
     Ki= new Matrix(stiff);
     return stiff;
   }
@@ -502,193 +381,41 @@ void XC::ShellNL::formResidAndTangent(int tang_flag) const
     //
 
     static const int ndf= 6; //two membrane plus three bending plus one drill
-    static const int nstress= 8; //three membrane, three moment, two shear
     static const int ngauss= 9;
     static const int numnodes= 9;
 
-
-    int success;
-  
-    double volume= 0.0;
-
-    static double xsj;  // determinant jacaobian matrix 
-    static double dvol[ngauss]; //volume element
-    static Vector strain(nstress);  //strain
-    static double shp[3][numnodes];  //shape functions at a gauss point
-    static Vector residJ(ndf); //nodeJ residual 
-    static Matrix stiffJK(ndf,ndf); //nodeJK stiffness 
-    static Vector stress(nstress);  //stress resultants
-    static Matrix dd(nstress,nstress);  //material tangent
-
-    double epsDrill= 0.0;  //drilling "strain"
-    double tauDrill= 0.0; //drilling "stress"
-
-    //---------B-matrices------------------------------------
-
-    static Matrix BJ(nstress,ndf);      // B matrix node J
-    static Matrix BJtran(ndf,nstress);
-    static Matrix BK(nstress,ndf);      // B matrix node k
-    static Matrix BJtranD(ndf,nstress);
-    static Matrix Bbend(3,3);  // bending B matrix
-    static Matrix Bshear(2,3); // shear B matrix
-    static Matrix Bmembrane(3,2); // membrane B matrix
-    static double BdrillJ[ndf]; //drill B matrix
-    static double BdrillK[ndf];  
-
-    double *drillPointer;
-
-    static double saveB[nstress][ndf][numnodes];
-
-    //-------------------------------------------------------
-   
     //zero stiffness and residual 
     stiff.Zero();
     resid.Zero();
 
-    //gauss loop 
-    for(int i= 0; i < ngauss; i++ )
-      {
-        //get shape functions
-        const GaussPoint &gp= getGaussModel().getGaussPoints()[i];
-        shape2d( gp.r_coordinate(), gp.s_coordinate(), xl, shp, xsj );
+    ShellKernel<9,9> kernel(theCoordTransf.G1(),theCoordTransf.G2(),theCoordTransf.G3());
+    setupKernel(kernel);
 
-        //volume element to also be saved
-        dvol[i]= gp.weight() * xsj;
-	volume += dvol[i];
+    //nodal "displacements" 
+    double ul[numnodes][ndf];
+    for(int j= 0;j<numnodes;j++)
+      {
+        const Vector &disp= theNodes[j]->getTrialDisp();
+        for(int p= 0;p<ndf;p++)
+          ul[j][p]= disp(p);
+      }
+    kernel.computeStrains(ul);
 
-        //zero the strains
-        strain.Zero();
-        epsDrill= 0.0;
+    for(int i= 0;i<ngauss;i++)
+      {
+        SectionForceDeformation *section= const_cast<SectionForceDeformation *>(physicalProperties[i]);
+        //send the strain to the material 
+        kernel.setTrialSectionDeformation(i,*section);
+        //compute the stress
+        kernel.setStress(i,section->getStressResultant(),Ktt);
+        if(tang_flag == 1)
+          kernel.setTangent(i,section->getSectionTangent());
+      }
 
-        // j-node loop to compute strain 
-        for(int j= 0; j < numnodes; j++ )
-          {
-            //compute B matrix 
-            Bmembrane= computeBmembrane( j, shp );
-            Bbend= computeBbend( j, shp );
-            Bshear= computeBshear( j, shp );
-	  
-            BJ= assembleB( Bmembrane, Bbend, Bshear );
-
- 	    //save the B-matrix
-	    for(int p=0; p<nstress; p++)
-              for(int q=0; q<ndf; q++ )
-                saveB[p][q][j]= BJ(p,q);
-
-            //nodal "displacements" 
-            const Vector &ul= theNodes[j]->getTrialDisp();
-
-            //compute the strain
-            //strain += (BJ*ul); 
-            strain.addMatrixVector(1.0, BJ,ul,1.0 );
-
-            //drilling B matrix
-            drillPointer= computeBdrill( j, shp );
-            for(int p=0; p<ndf; p++)
-              {
-	        //BdrillJ[p]= *drillPointer++;
-	        BdrillJ[p]= *drillPointer; //set p-th component
-	        drillPointer++;             //pointer arithmetic
-              }//end for p
-
-            //drilling "strain" 
-            for(int p= 0; p < ndf; p++ )
-	      epsDrill +=  BdrillJ[p]*ul(p);
-	  } // end for j
-      //send the strain to the material 
-	success= const_cast<SectionForceDeformation *>(physicalProperties[i])->setTrialSectionDeformation( strain );
-      //compute the stress
-      stress= physicalProperties[i]->getStressResultant();
-      //drilling "stress" 
-      tauDrill= Ktt * epsDrill;
-
-      //multiply by volume element
-      stress*= dvol[i];
-      tauDrill *= dvol[i];
-
-      if(tang_flag == 1)
-        {
-          dd= physicalProperties[i]->getSectionTangent();
-          dd*= dvol[i];
-        } //end if tang_flag
-
-
-      //residual and tangent calculations node loops
-      int jj= 0;
-      for(int j= 0; j < numnodes; j++ )
-        {
-          //extract BJ
-          for(int p=0; p<nstress; p++)
-            {
-	      for(int q=0; q<ndf; q++ )
-	        BJ(p,q)= saveB[p][q][j];
-            }//end for p
-
-          //multiply bending terms by (-1.0) for correct statement
-          // of equilibrium  
-          for(int p= 3; p < 6; p++)
-            for(int q= 3; q < 6; q++ ) 
-              BJ(p,q) *= (-1.0);
-
-          //transpose 
-          //BJtran= transpose( 8, ndf, BJ );
-          for(int p=0; p<ndf; p++)
-	    for(int q=0; q<nstress; q++) 
-	      BJtran(p,q)= BJ(q,p);
-
-          //residJ= BJtran * stress;
-          residJ.addMatrixVector(0.0, BJtran,stress,1.0 );
-
-          //drilling B matrix
-          drillPointer= computeBdrill( j, shp );
-          for(int p=0; p<ndf; p++ )
-            {
-	      BdrillJ[p]= *drillPointer;
-	      drillPointer++;
-            }//end for p
-
-          //residual including drill
-          for(int p= 0; p < ndf; p++ )
-            resid( jj + p ) += ( residJ(p) + BdrillJ[p]*tauDrill );
-
-          if(tang_flag == 1 )
-            {
-              //BJtranD= BJtran * dd;
-              BJtranD.addMatrixProduct(0.0, BJtran,dd,1.0 );
-        
-	      for(int p=0; p<ndf; p++)
-                { BdrillJ[p]*= ( Ktt*dvol[i] ); }
-
-          int kk= 0;
-          for(int k= 0; k < numnodes; k++ )
-            {
-              //extract BK
-	      for(int p=0; p<nstress; p++)
-                for(int q=0; q<ndf; q++ )
-                  BK(p,q)= saveB[p][q][k];
-	  
-              //drilling B matrix
-	      drillPointer= computeBdrill( k, shp );
-	      for(int p=0; p<ndf; p++ )
-                {
-	          BdrillK[p]= *drillPointer;
-	          drillPointer++;
-		}//end for p
-  
-              //stiffJK= BJtranD * BK ;
-	      // +  transpose( 1,ndf,BdrillJ ) * BdrillK; 
-	      stiffJK.addMatrixProduct(0.0, BJtranD,BK,1.0 );
-
-              for(int p= 0;p<ndf;p++)
-	        for(int q= 0; q < ndf; q++ )
-                  stiff( jj+p, kk+q ) += stiffJK(p,q) + ( BdrillJ[p]*BdrillK[q] );
-
-              kk += ndf;
-	    } // end for k loop
-	  } // end if tang_flag 
-        jj += ndf;
-      } // end for j loop
-    } //end for i gauss loop
+    //residual and tangent calculations node loops
+    kernel.addResid(resid);
+    if(tang_flag == 1)
+      kernel.addTangent(stiff,Ktt);
   }
 
 //! @brief compute local coordinates and basis
@@ -704,207 +431,13 @@ void XC::ShellNL::computeBasis(void)
       }  //end for i
   }
 
-//! @brief compute Bdrill
-double *XC::ShellNL::computeBdrill( int node, const double shp[3][9] ) const
-  {
-    static double Bdrill[6];
-    static double B1;
-    static double B2;
-    static double B6;
-
-    //---Bdrill Matrix in standard {1,2,3} mechanics notation---------
-    //             -                                       -
-    //   Bdrill= | -0.5*N,2   +0.5*N,1    0    0    0   -N |   (1x6) 
-    //             -                                       -  
-    //----------------------------------------------------------------
-
-    B1=-0.5*shp[1][node]; 
-    B2=+0.5*shp[0][node];
-    B6=-shp[2][node];
-
-    const Vector &g1= theCoordTransf.G1();
-    const Vector &g2= theCoordTransf.G2();
-
-    Bdrill[0]= B1*g1[0] + B2*g2[0];
-    Bdrill[1]= B1*g1[1] + B2*g2[1]; 
-    Bdrill[2]= B1*g1[2] + B2*g2[2];
-
-    const Vector &g3= theCoordTransf.G3();
-    Bdrill[3]= B6*g3[0];
-    Bdrill[4]= B6*g3[1]; 
-    Bdrill[5]= B6*g3[2];
-    return Bdrill;
-  }
-
-//! @brief assemble a B matrix
-const XC::Matrix &XC::ShellNL::assembleB( const Matrix &Bmembrane, const Matrix &Bbend, const Matrix &Bshear) const
-  {
-    //Matrix Bbend(3,3);  // plate bending B matrix
-    //Matrix Bshear(2,3); // plate shear B matrix
-    //Matrix Bmembrane(3,2); // plate membrane B matrix
-
-    static Matrix B(8,6);
-    static Matrix BmembraneShell(3,3); 
-    static Matrix BbendShell(3,3); 
-    static Matrix BshearShell(2,6);
-    static Matrix Gmem(2,3);
-    static Matrix Gshear(3,6);
-    int pp;
-
-    // For Shell : 
-    //
-    //---B Matrices in standard {1,2,3} mechanics notation---------
-    //            -                     _          
-    //           | Bmembrane  |     0    |
-    //           | --------------------- |     
-    //    B=     |     0      |  Bbend   |   (8x6) 
-    //           | --------------------- |
-    //           |         Bshear        |
-    //            -           -         -
-    //-------------------------------------------------------------
-
-    const Vector &g1= theCoordTransf.G1();
-    const Vector &g2= theCoordTransf.G2();
-    const Vector &g3= theCoordTransf.G3();
-    //shell modified membrane terms
-    Gmem(0,0)= g1[0];
-    Gmem(0,1)= g1[1];
-    Gmem(0,2)= g1[2];
-
-    Gmem(1,0)= g2[0];
-    Gmem(1,1)= g2[1];
-    Gmem(1,2)= g2[2];
-
-    //BmembraneShell= Bmembrane * Gmem;
-    BmembraneShell.addMatrixProduct(0.0, Bmembrane,Gmem,1.0 );
-
-    //shell modified bending terms 
-    Matrix &Gbend= Gmem;
-
-    //BbendShell= Bbend * Gbend;
-    BbendShell.addMatrixProduct(0.0, Bbend,Gbend,1.0 ); 
-
-    //shell modified shear terms 
-    Gshear.Zero();
-
-    Gshear(0,0)= g3[0];
-    Gshear(0,1)= g3[1];
-    Gshear(0,2)= g3[2];
-
-    Gshear(1,3)= g1[0];
-    Gshear(1,4)= g1[1];
-    Gshear(1,5)= g1[2];
-
-    Gshear(2,3)= g2[0];
-    Gshear(2,4)= g2[1];
-    Gshear(2,5)= g2[2];
-
-    //BshearShell= Bshear * Gshear;
-    BshearShell.addMatrixProduct(0.0, Bshear,Gshear,1.0 );
-  
-    B.Zero();
-
-    //assemble B from sub-matrices 
-
-    //membrane terms 
-    for(int p= 0; p < 3; p++ )
-      for(int q= 0; q < 3; q++ ) 
-        B(p,q)= BmembraneShell(p,q);
-
-    //bending terms
-    for(int p= 3; p < 6; p++ )
-      {
-        pp= p - 3;
-        for(int q= 3; q < 6; q++ ) 
-          B(p,q)= BbendShell(pp,q-3); 
-      } // end for p
-
-    //shear terms 
-    for(int p= 0; p < 2; p++ )
-      {
-        pp= p + 6;
-        for(int q= 0; q < 6; q++ )
-          B(pp,q)= BshearShell(p,q); 
-      } //end for p
-    return B;
-  }
-
-//! @brief compute Bmembrane matrix
-const XC::Matrix &XC::ShellNL::computeBmembrane( int node, const double shp[3][9] ) const
-  {
-    static Matrix Bmembrane(3,2);
-
-    //---Bmembrane Matrix in standard {1,2,3} mechanics notation---------
-    //                -             -
-    //               | +N,1      0   | 
-    // Bmembrane=   |   0     +N,2  |    (3x2)
-    //               | +N,2    +N,1  |
-    //                -             -  
-    //  three(3) strains and two(2) displacements (for plate)
-    //-------------------------------------------------------------------
-
-    Bmembrane.Zero();
-
-    Bmembrane(0,0)= shp[0][node];
-    Bmembrane(1,1)= shp[1][node];
-    Bmembrane(2,0)= shp[1][node];
-    Bmembrane(2,1)= shp[0][node];
-    return Bmembrane;
-  }
-
-
-//! @brief compute Bbend matrix
-const XC::Matrix &XC::ShellNL::computeBbend( int node, const double shp[3][9] ) const
-  {
-    static Matrix Bbend(3,2);
-
-    //---Bbend Matrix in standard {1,2,3} mechanics notation---------
-    //            -             -
-    //   Bbend= |    0    -N,1  | 
-    //           |  +N,2     0   |    (3x2)
-    //           |  +N,1   -N,2  |
-    //            -             -  
-    //  three(3) curvatures and two(2) rotations (for plate)
-    //----------------------------------------------------------------
-
-    Bbend.Zero();
-
-    Bbend(0,1)= -shp[0][node];
-    Bbend(1,0)=  shp[1][node];
-    Bbend(2,0)=  shp[0][node];
-    Bbend(2,1)= -shp[1][node]; 
-    return Bbend;
-  }
-
-//! @brief compute standard Bshear matrix
-const XC::Matrix &XC::ShellNL::computeBshear( int node, const double shp[3][9] ) const
-  {
-    static Matrix Bshear(2,3);
-
-    //---Bshear Matrix in standard {1,2,3} mechanics notation------
-    //             -                -
-    //   Bshear= | +N,1      0    +N |  (2x3)
-    //            | +N,2     -N     0 |
-    //             -                -  
-    //  two(2) shear strains, one(1) displacement and two(2) rotations for plate 
-    //-----------------------------------------------------------------------
-
-    Bshear.Zero();
-
-    Bshear(0,0)=  shp[0][node];
-    Bshear(0,2)=  shp[2][node];
-    Bshear(1,0)=  shp[1][node];
-    Bshear(1,1)= -shp[2][node];
-    return Bshear;
-  }
-
 //! @brief shape function routine for four node quads
 void XC::ShellNL::shape2d( double ss, double tt,const double x[2][9], double shp[3][9],double &xsj)
   {
     static const double s[]= { -0.5,  0.5, 0.5, -0.5 };
     static const double t[]= { -0.5, -0.5, 0.5,  0.5 };
-    static double xs[2][2];
-    static double sx[2][2];
+    double xs[2][2];
+    double sx[2][2];
 
     for(int i= 0; i < 4; i++ )
       {
@@ -27,6 +27,7 @@
 #include "domain/mesh/element/plane/QuadBase9N.h"
 #include "domain/mesh/element/utils/physical_properties/SectionFDPhysicalProperties.h"
 #include "ShellLinearCrdTransf3d.h"
+#include "ShellKernel.h"
 #include "domain/mesh/element/utils/fvectors/FVectorShell.h"
 
 namespace XC {
@@ -66,11 +67,7 @@ class ShellNL : public QuadBase9N<SectionFDPhysicalProperties>
     //void  computeJacobian( double L1, double L2,const double x[2][9], 
     //                       Matrix &JJ,Matrix &JJinv );
 
-    double* computeBdrill(int node,const double shp[3][9]) const;
-    const Matrix& assembleB(const Matrix &Bmembrane, const Matrix &Bbend, const Matrix &Bshear) const;
-    const Matrix& computeBmembrane(int node, const double shp[3][9]) const;
-    const Matrix& computeBbend(int node, const double shp[3][9]) const;
-    const Matrix& computeBshear(int node, const double shp[3][9]) const;
+    void setupKernel(ShellKernel<9,9> &) const;
     
     //Matrix transpose
     Matrix transpose( int dim1, int dim2, const Matrix &M);
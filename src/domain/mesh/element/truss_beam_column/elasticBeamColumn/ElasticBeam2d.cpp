@@ -68,6 +68,7 @@
 #include <utility/actor/objectBroker/FEM_ObjectBroker.h>
 
 #include <domain/mesh/element/utils/coordTransformation/CrdTransf2d.h>
+#include <domain/mesh/element/utils/coordTransformation/LinearCrdTransf2d.h>
 #include <domain/mesh/element/utils/Information.h>
 #include <utility/recorder/response/ElementResponse.h>
 #include <domain/mesh/node/Node.h>
@@ -332,6 +333,11 @@ const XC::Vector &XC::ElasticBeam2d::getVDirWeakAxisGlobalCoord(bool initialGeom
   }
 
 
+//! @brief Return true if the tangent stiffness doesn't change
+//! with the element state (linear coordinate transformation).
+bool XC::ElasticBeam2d::hasConstantTangent(void) const
+  { return (dynamic_cast<const LinearCrdTransf2d *>(theCoordTransf)!=nullptr); }
+
 const XC::Matrix &XC::ElasticBeam2d::getTangentStiff(void) const
   {
     const Vector &v= getSectionDeformation();
@@ -140,6 +140,7 @@ class ElasticBeam2d: public ProtoBeam2d
     
     int update(void);
     const Matrix &getTangentStiff(void) const;
+    bool hasConstantTangent(void) const;
     const Matrix &getInitialStiff(void) const;
     const Matrix &getMass(void) const;
 
@@ -63,6 +63,7 @@
 #include <utility/actor/objectBroker/FEM_ObjectBroker.h>
 
 #include <domain/mesh/element/utils/coordTransformation/CrdTransf3d.h>
+#include <domain/mesh/element/utils/coordTransformation/LinearCrdTransf3d.h>
 #include <domain/mesh/element/utils/Information.h>
 #include <utility/recorder/response/ElementResponse.h>
 #include "domain/load/beam_loads/BeamMecLoad.h"
@@ -304,6 +305,11 @@ int XC::ElasticBeam3d::update(void)
   { return theCoordTransf->update(); }
 
 //! @brief Return the tangent stiffness matrix expresada en coordenadas globales.
+//! @brief Return true if the tangent stiffness doesn't change
+//! with the element state (linear coordinate transformation).
+bool XC::ElasticBeam3d::hasConstantTangent(void) const
+  { return (dynamic_cast<const LinearCrdTransf3d *>(theCoordTransf)!=nullptr); }
+
 const XC::Matrix &XC::ElasticBeam3d::getTangentStiff(void) const
   {
     const Vector &v= getSectionDeformation();
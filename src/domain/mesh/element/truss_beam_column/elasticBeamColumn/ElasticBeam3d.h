@@ -133,6 +133,7 @@ class ElasticBeam3d : public ProtoBeam3d
     
     int update(void);
     const Matrix &getTangentStiff(void) const;
+    bool hasConstantTangent(void) const;
     const Matrix &getInitialStiff(void) const;
     const Matrix &getMass(void) const;    
 
@@ -28,6 +28,7 @@
 
 #include "ProtoTruss.h"
 #include <utility/matrix/Matrix.h>
+#include "material/Material.h"
 
 #include "utility/actor/actor/MatrixCommMetaData.h"
 
@@ -82,6 +83,15 @@ XC::Material &XC::ProtoTruss::getMaterialRef(void)
     return *ptr;
   }
 
+//! @brief Return true if the state of the material is in the store
+//! of the mesh and there is no committed stiffness matrix to update
+//! (Rayleigh damping), the truss elements have no other state.
+bool XC::ProtoTruss::isStateInStore(void) const
+  {
+    const Material *ptr= getMaterial();
+    return (Kc.isEmpty() && ptr && ptr->isStateInStore());
+  }
+
 //! @brief Set the number of dof for element and set matrix and vector pointers.
 void XC::ProtoTruss::setup_matrix_vector_ptrs(int dofNd1)
   {
@@ -73,6 +73,7 @@ class ProtoTruss : public Element1D
     virtual const Material *getMaterial(void) const= 0;
     virtual Material *getMaterial(void)= 0;
     Material &getMaterialRef(void);
+    bool isStateInStore(void) const;
     virtual double getRho(void) const= 0;
 
     // public methods to obtain inforrmation about dof & connectivity    
@@ -64,6 +64,8 @@ class KDTreeElements: protected kd_tree::KDTree<3, ElemPos, std::pointer_to_bina
     KDTreeElements(void);
 
     void insert(const Element &);
+    template <class InputIterator>
+    void insert(InputIterator first,InputIterator last);
     void erase(const Element &);
     void clear(void);
 
@@ -71,6 +73,23 @@ class KDTreeElements: protected kd_tree::KDTree<3, ElemPos, std::pointer_to_bina
     const Element *getNearest(const Pos3d &pos, const double &r) const;
   };
 
+//! @brief Inserts the objects pointed by the iterators (bulk insertion).
+//! The tree is rebalanced only when the batch is at least as big as
+//! the tree was, so repeated bulk insertions cost O(n log n) overall.
+template <class InputIterator>
+void KDTreeElements::insert(InputIterator first,InputIterator last)
+  {
+    const size_t sz0= tree_type::size();
+    size_t count= 0;
+    for(InputIterator i= first;i!=last;i++,count++)
+      tree_type::insert(ElemPos(**i));
+    if(count>=sz0)
+      {
+        tree_type::optimise();
+        pend_optimizar= 0;
+      }
+  }
+
 } // end of XC namespace 
 
 
@@ -0,0 +1,174 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SharedMatrixCache.cc
+
+#include "SharedMatrixCache.h"
+#include "utility/matrix/Matrix.h"
+#include <cmath>
+#include <functional>
+#include <algorithm>
+
+//! @brief Hash function for the keys.
+size_t XC::SharedMatrixCache::KeyHash::operator()(const Key &k) const
+  {
+    size_t retval= k.size();
+    std::hash<double> hasher;
+    for(Key::const_iterator i= k.begin();i!=k.end();i++)
+      retval^= hasher(*i) + 0x9e3779b9 + (retval<<6) + (retval>>2);
+    return retval;
+  }
+
+//! @brief Constructor.
+//!
+//! @param digits: number of significant digits of the key values.
+XC::SharedMatrixCache::SharedMatrixCache(const int &digits)
+  : numDigits(digits), generation(0), numHits(0), numMisses(0) {}
+
+//! @brief Return the key with its values rounded to the number
+//! of significant digits of the cache.
+XC::SharedMatrixCache::Key XC::SharedMatrixCache::round(const Key &k) const
+  {
+    Key retval(k);
+    for(Key::iterator i= retval.begin();i!=retval.end();i++)
+      {
+        const double v= *i;
+        if(v==0.0)
+          *i= 0.0; // -0.0 and 0.0 are the same value.
+        else if(std::isfinite(v))
+          {
+            const int e= static_cast<int>(std::floor(std::log10(std::abs(v))));
+            if(e>-280) // otherwise the scale overflows.
+              {
+                const double scale= std::pow(10.0,numDigits-1-e);
+                *i= std::round(v*scale)/scale;
+              }
+          }
+      }
+    return retval;
+  }
+
+//! @brief Set to zero the values of the key in the range [first,last)
+//! that are negligible with respect to the biggest one in that range
+//! (i.e. nodal coordinates that are zero except for the round-off).
+void XC::SharedMatrixCache::snapToZero(Key &k,const size_t &first,const size_t &last) const
+  {
+    double vMax= 0.0;
+    for(size_t i= first;i<last;i++)
+      vMax= std::max(vMax,std::abs(k[i]));
+    const double tol= vMax*std::pow(10.0,-numDigits);
+    for(size_t i= first;i<last;i++)
+      if(std::abs(k[i])<tol)
+        k[i]= 0.0;
+  }
+
+//! @brief Return the matrix that corresponds to the key (null
+//! if there is none).
+XC::SharedMatrixCache::MatrixPtr XC::SharedMatrixCache::find(const Key &k) const
+  {
+    MatrixPtr retval;
+    map_type::const_iterator i= matrices.find(round(k));
+    if(i!=matrices.end())
+      {
+        retval= i->second;
+        numHits++;
+      }
+    return retval;
+  }
+
+//! @brief Store a copy of the matrix for the key (if there is no
+//! matrix already stored for it) and return the stored one.
+XC::SharedMatrixCache::MatrixPtr XC::SharedMatrixCache::intern(const Key &k,const Matrix &m)
+  {
+    MatrixPtr &retval= matrices[round(k)];
+    if(!retval)
+      {
+        retval= std::make_shared<const Matrix>(m);
+        numMisses++;
+      }
+    return retval;
+  }
+
+//! @brief Remove all the matrices (the elements will compute and
+//! intern them again).
+void XC::SharedMatrixCache::clear(void)
+  {
+    matrices.clear();
+    generation++;
+    numHits= 0;
+    numMisses= 0;
+  }
+
+//! @brief Return the number of stored matrices.
+size_t XC::SharedMatrixCache::size(void) const
+  { return matrices.size(); }
+
+//! @brief Return the number of lookups that found the matrix
+//! in the cache.
+size_t XC::SharedMatrixCache::getNumHits(void) const
+  { return numHits; }
+
+//! @brief Return the number of matrices computed and stored.
+size_t XC::SharedMatrixCache::getNumMisses(void) const
+  { return numMisses; }
+
+//! @brief Return the (approximate) number of bytes used by the
+//! stored matrices and its keys.
+size_t XC::SharedMatrixCache::getBytesInUse(void) const
+  {
+    size_t retval= 0;
+    for(map_type::const_iterator i= matrices.begin();i!=matrices.end();i++)
+      {
+        retval+= i->first.size()*sizeof(double);
+        retval+= i->second->noRows()*i->second->noCols()*sizeof(double);
+      }
+    return retval;
+  }
+
+//! @brief Constructor.
+XC::SharedMatrixRef::SharedMatrixRef(void)
+  : cache(nullptr), generation(0) {}
+
+//! @brief Return the referenced matrix if it comes from the cache
+//! argument and it has not been cleared since (null otherwise).
+const XC::Matrix *XC::SharedMatrixRef::get(const SharedMatrixCache &c) const
+  {
+    const Matrix *retval= nullptr;
+    if(ptr && (cache==&c) && (generation==c.getGeneration()))
+      retval= ptr.get();
+    return retval;
+  }
+
+//! @brief Set the referenced matrix and return a pointer to it.
+const XC::Matrix *XC::SharedMatrixRef::set(const SharedMatrixCache &c,const SharedMatrixCache::MatrixPtr &p)
+  {
+    ptr= p;
+    cache= &c;
+    generation= c.getGeneration();
+    return ptr.get();
+  }
+
+//! @brief Release the referenced matrix.
+void XC::SharedMatrixRef::reset(void)
+  {
+    ptr.reset();
+    cache= nullptr;
+  }
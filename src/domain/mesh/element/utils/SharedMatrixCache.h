@@ -0,0 +1,103 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SharedMatrixCache.h
+
+#ifndef SharedMatrixCache_h
+#define SharedMatrixCache_h
+
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <cstddef>
+
+namespace XC {
+class Matrix;
+
+//! @ingroup FEMisc
+//
+//! @brief Hash-consed store of read-only element matrices.
+//!
+//! Elements with the same geometry (up to a rigid body motion) and
+//! the same material parameters have the same stiffness (or mass)
+//! matrix in local axes. Those matrices are stored only once, keyed
+//! by the values they depend on, and shared by all the elements that
+//! only need to rotate them to global axes. The values of the keys
+//! are rounded to a number of significant digits so the round-off
+//! of the mesh generation doesn't prevent the sharing.
+class SharedMatrixCache
+  {
+  public:
+    typedef std::vector<double> Key;
+    typedef std::shared_ptr<const Matrix> MatrixPtr;
+  private:
+    struct KeyHash
+      { size_t operator()(const Key &) const; };
+    typedef std::unordered_map<Key,MatrixPtr,KeyHash> map_type;
+    map_type matrices; //!< interned matrices.
+    int numDigits; //!< significant digits of the key values.
+    size_t generation; //!< incremented each time the cache is cleared.
+    mutable size_t numHits; //!< number of lookups that found the matrix.
+    size_t numMisses; //!< number of interned matrices.
+
+    SharedMatrixCache(const SharedMatrixCache &);
+    SharedMatrixCache &operator=(const SharedMatrixCache &);
+  public:
+    SharedMatrixCache(const int &digits= 12);
+
+    Key round(const Key &) const;
+    void snapToZero(Key &,const size_t &,const size_t &) const;
+    MatrixPtr find(const Key &) const;
+    MatrixPtr intern(const Key &,const Matrix &);
+    void clear(void);
+
+    //! @brief Return a number that changes each time the cache is cleared.
+    inline size_t getGeneration(void) const
+      { return generation; }
+    size_t size(void) const;
+    size_t getNumHits(void) const;
+    size_t getNumMisses(void) const;
+    size_t getBytesInUse(void) const;
+  };
+
+//! @ingroup FEMisc
+//
+//! @brief Reference from an element to a matrix of a
+//! SharedMatrixCache.
+//!
+//! The reference becomes stale when the cache is cleared (i.e. after
+//! modifying the materials of the elements).
+class SharedMatrixRef
+  {
+  private:
+    SharedMatrixCache::MatrixPtr ptr; //!< interned matrix.
+    const SharedMatrixCache *cache; //!< cache that contains the matrix.
+    size_t generation; //!< generation of the cache when the reference was set.
+  public:
+    SharedMatrixRef(void);
+    const Matrix *get(const SharedMatrixCache &) const;
+    const Matrix *set(const SharedMatrixCache &,const SharedMatrixCache::MatrixPtr &);
+    void reset(void);
+  };
+
+} // end of XC namespace
+
+#endif
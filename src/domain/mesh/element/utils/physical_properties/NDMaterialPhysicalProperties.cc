@@ -135,6 +135,49 @@ double XC::NDMaterialPhysicalProperties::getCommittedAvgStrain(const size_t &iCo
     return retval;
   }
 
+//! @brief Return the batch used to evaluate the materials of the
+//! integration points with a single call (see setTrialStrains). The
+//! caller writes the trial strains of the points in the batch.
+XC::NDMaterialBatch &XC::NDMaterialPhysicalProperties::getBatch(void)
+  {
+    const size_t numMaterials= theMaterial.size();
+    const size_t order= (numMaterials>0 ? theMaterial[0]->getOrder() : 0);
+    if((batch.size()!=numMaterials) || (batch.getOrder()!=order))
+      batch.resize(numMaterials,order);
+    return batch;
+  }
+
+//! @brief Set the trial strains written in the batch to the materials
+//! and compute their stresses and tangents.
+int XC::NDMaterialPhysicalProperties::setTrialStrains(void)
+  { return getBatch().setTrialStrains(theMaterial.data()); }
+
+//! @brief Return the batch with the stresses and tangents that
+//! correspond to the current trial state of the materials.
+const XC::NDMaterialBatch &XC::NDMaterialPhysicalProperties::getUpdatedBatch(void) const
+  {
+    if(!batch.isValid() || (batch.size()!=theMaterial.size()))
+      {
+        const_cast<NDMaterialPhysicalProperties *>(this)->getBatch();
+        batch.update(theMaterial.data());
+      }
+    return batch;
+  }
+
+//! @brief Revert the materials to its last committed state.
+int XC::NDMaterialPhysicalProperties::revertToLastCommit(void)
+  {
+    batch.invalidate();
+    return PhysicalProperties<NDMaterial>::revertToLastCommit();
+  }
+
+//! @brief Revert the materials to its initial state.
+int XC::NDMaterialPhysicalProperties::revertToStart(void)
+  {
+    batch.invalidate();
+    return PhysicalProperties<NDMaterial>::revertToStart();
+  }
+
 // check to see if have mass
 bool XC::NDMaterialPhysicalProperties::haveRho(void) const
   {
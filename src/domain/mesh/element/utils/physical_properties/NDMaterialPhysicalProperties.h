@@ -28,6 +28,7 @@
                                                                         
 #include "PhysicalProperties.h"
 #include "material/nD/NDMaterial.h"
+#include "material/nD/NDMaterialBatch.h"
 
 #ifndef NDMaterialPhysicalProperties_h
 #define NDMaterialPhysicalProperties_h
@@ -39,6 +40,7 @@ namespace XC {
 class NDMaterialPhysicalProperties: public PhysicalProperties<NDMaterial>
   {
   protected:
+    mutable NDMaterialBatch batch; //!< strains, stresses and tangents at the integration points.
     virtual bool check_material_type(const std::string &type) const;
   public:
     static bool check_material_elast_plana(const std::string &type);
@@ -58,6 +60,12 @@ class NDMaterialPhysicalProperties: public PhysicalProperties<NDMaterial>
     Matrix getCommittedStrain(void) const;
     Matrix getCommittedStress(void) const;
 
+    NDMaterialBatch &getBatch(void);
+    int setTrialStrains(void);
+    const NDMaterialBatch &getUpdatedBatch(void) const;
+    int revertToLastCommit(void);
+    int revertToStart(void);
+
     bool haveRho(void) const;
     Vector getRhoi(const double &rhoDefault= 0.0) const;
  };
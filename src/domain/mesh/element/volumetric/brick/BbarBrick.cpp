@@ -678,6 +678,9 @@ void  XC::BbarBrick::formResidAndTangent( int tang_flag ) const
   } // end for p
 
 
+  //strains of the gauss points
+  NDMaterialBatch &batch= const_cast<NDMaterialPhysicalProperties &>(physicalProperties).getBatch() ;
+
   //gauss loop
   for( i = 0; i < numberGauss; i++ ) {
 
@@ -710,19 +713,38 @@ void  XC::BbarBrick::formResidAndTangent( int tang_flag ) const
 
 
 
-    //send the strain to the material
-    success= const_cast<NDMaterial *>(physicalProperties[i])->setTrialStrain( strain ) ;
+    //store the strain in the batch
+    double *eps= batch.getStrainPtr(i) ;
+    for( p = 0; p < nstress; p++ )
+      eps[p] = strain(p) ;
+
+  } //end for i gauss loop
+
 
-    //compute the stress
-    stress = physicalProperties[i]->getStress( ) ;
+  //send the strains to the materials
+  success= const_cast<NDMaterialPhysicalProperties &>(physicalProperties).setTrialStrains( ) ;
 
 
-    //multiply by volume element
-    stress  *= dvol[i] ;
+  //gauss loop
+  for( i = 0; i < numberGauss; i++ ) {
+
+    //extract shape functions from saved array
+    for( p = 0; p < nShape; p++ ) {
+       for( q = 0; q < numberNodes; q++ )
+          shp[p][q]  = Shape[p][q][i] ;
+    } // end for p
+
+    //compute the stress multiplied by volume element
+    const double *sigma = batch.getStressPtr(i) ;
+    for( p = 0; p < nstress; p++ )
+      stress(p) = sigma[p]*dvol[i] ;
 
     if( tang_flag == 1 ) {
-      dd = physicalProperties[i]->getTangent( ) ;
-      dd *= dvol[i] ;
+      const double *tangent = batch.getTangentPtr(i) ;
+      for( q = 0; q < nstress; q++ ) {
+        for( p = 0; p < nstress; p++ )
+          dd(p,q) = tangent[q*nstress+p]*dvol[i] ;
+      } //end for q
     } //end if tang_flag
 
 
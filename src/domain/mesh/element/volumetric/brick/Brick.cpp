@@ -65,6 +65,7 @@
 
 #include "utility/actor/actor/MatrixCommMetaData.h"
 #include "domain/mesh/element/utils/gauss_models/GaussModel.h"
+#include "material/nD/elastic_isotropic/ElasticIsotropic3D.h"
 
 //static data
 double  XC::Brick::xl[3][8] ;
@@ -132,6 +133,104 @@ XC::Brick::~Brick(void)
 void  XC::Brick::setDomain(Domain *theDomain)
   {
     BrickBase::setDomain(theDomain);
+    // the nodes may have changed.
+    sharedStiff.reset();
+    sharedMass.reset();
+  }
+
+//! @brief Return true if the tangent stiffness doesn't change
+//! with the element state (elastic isotropic materials).
+bool XC::Brick::hasConstantTangent(void) const
+  {
+    bool retval= true;
+    for(size_t i= 0;retval && (i<physicalProperties.size());i++)
+      retval= (dynamic_cast<const ElasticIsotropic3D *>(physicalProperties[i])!=nullptr);
+    return retval;
+  }
+
+//! @brief Return the key of the stiffness (kind= 0) or the mass (kind= 1)
+//! matrix in the cache of shared matrices: coordinates of the nodes
+//! relative to the first one and material parameters. Only the elements
+//! that are translated copies of each other share their matrices.
+XC::SharedMatrixCache::Key XC::Brick::getSharedMatrixKey(const int &kind) const
+  {
+    static const int numberGauss= 8;
+    SharedMatrixCache::Key retval;
+    retval.reserve(23+numberGauss*36);
+    retval.push_back(getClassTag());
+    retval.push_back(kind);
+    const Vector &origin= theNodes[0]->getCrds();
+    for(int i= 1;i<8;i++)
+      {
+        const Vector &coorI= theNodes[i]->getCrds();
+        for(int j= 0;j<3;j++)
+          retval.push_back(coorI(j)-origin(j));
+      }
+    SharedMatrixCache *cache= getSharedMatrixCache();
+    if(cache)
+      cache->snapToZero(retval,2,retval.size());
+    if(kind==0)
+      for(int i= 0;i<numberGauss;i++)
+        {
+          const Matrix &dd= physicalProperties[i]->getInitialTangent();
+          for(int k= 0;k<dd.noCols();k++)
+            for(int j= 0;j<dd.noRows();j++)
+              retval.push_back(dd(j,k));
+        }
+    else
+      for(int i= 0;i<numberGauss;i++)
+        retval.push_back(physicalProperties[i]->getRho());
+    return retval;
+  }
+
+//! @brief Return the stiffness matrix shared with the identical
+//! elements of the mesh (nullptr if the matrices are not shared or
+//! the stiffness of the element is not constant).
+const XC::Matrix *XC::Brick::getSharedStiff(void) const
+  {
+    const Matrix *retval= nullptr;
+    SharedMatrixCache *cache= getSharedMatrixCache();
+    if(cache)
+      {
+        retval= sharedStiff.get(*cache);
+        if(!retval && hasConstantTangent())
+          {
+            const SharedMatrixCache::Key key= getSharedMatrixKey(0);
+            SharedMatrixCache::MatrixPtr ptr= cache->find(key);
+            if(!ptr)
+              {
+                formResidAndTangent(1);
+                ptr= cache->intern(key,stiff);
+              }
+            retval= sharedStiff.set(*cache,ptr);
+          }
+      }
+    return retval;
+  }
+
+//! @brief Return the mass matrix shared with the identical elements
+//! of the mesh (nullptr if the matrices are not shared or the stiffness
+//! of the element is not constant).
+const XC::Matrix *XC::Brick::getSharedMass(void) const
+  {
+    const Matrix *retval= nullptr;
+    SharedMatrixCache *cache= getSharedMatrixCache();
+    if(cache)
+      {
+        retval= sharedMass.get(*cache);
+        if(!retval && hasConstantTangent())
+          {
+            const SharedMatrixCache::Key key= getSharedMatrixKey(1);
+            SharedMatrixCache::MatrixPtr ptr= cache->find(key);
+            if(!ptr)
+              {
+                formInertiaTerms(1);
+                ptr= cache->intern(key,mass);
+              }
+            retval= sharedMass.set(*cache,ptr);
+          }
+      }
+    return retval;
   }
 
 
@@ -247,9 +346,15 @@ void  XC::Brick::Print( std::ostream &s, int flag )
 //return stiffness matrix
 const XC::Matrix&  XC::Brick::getTangentStiff(void) const
   {
-    int tang_flag = 1; //get the tangent
-    //do tangent and residual here
-    formResidAndTangent( tang_flag );
+    const Matrix *k= getSharedStiff();
+    if(k) // constant stiffness shared with other elements.
+      stiff= *k;
+    else
+      {
+        int tang_flag = 1; //get the tangent
+        //do tangent and residual here
+        formResidAndTangent( tang_flag );
+      }
     if(isDead())
       stiff*=dead_srf;
     return stiff;
@@ -261,6 +366,14 @@ const XC::Matrix&  XC::Brick::getTangentStiff(void) const
 
 const XC::Matrix&  XC::Brick::getInitialStiff(void) const
   {
+    const Matrix *k= getSharedStiff();
+    if(k) // shared with other elements (no need to store Ki).
+      {
+        stiff= *k;
+        if(isDead())
+          stiff*=dead_srf;
+        return stiff;
+      }
     if(!Ki)
       {
 
@@ -402,8 +515,14 @@ const XC::Matrix&  XC::Brick::getInitialStiff(void) const
 //return mass matrix
 const XC::Matrix &XC::Brick::getMass(void) const
   {
-    int tangFlag = 1;
-    formInertiaTerms(tangFlag);
+    const Matrix *m= getSharedMass();
+    if(m) // shared with other elements.
+      mass= *m;
+    else
+      {
+        int tangFlag = 1;
+        formInertiaTerms(tangFlag);
+      }
     if(isDead())
       mass*=dead_srf;
     return mass;
@@ -716,6 +835,9 @@ XC::Brick::update(void)
   } // end for i
 
 
+  //strains of the gauss points
+  NDMaterialBatch &batch= physicalProperties.getBatch();
+
   //gauss loop
   for( i = 0; i < numberGauss; i++ ) {
 
@@ -787,11 +909,16 @@ XC::Brick::update(void)
 
     } // end for j
 
-    //send the strain to the material
-    success = physicalProperties[i]->setTrialStrain( strain );
+    //store the strain in the batch
+    double *eps= batch.getStrainPtr(i);
+    for( p = 0; p < brick_nstress; p++ )
+      eps[p] = strain(p);
 
   } //end for i gauss loop
 
+  //send the strains to the materials
+  success = physicalProperties.setTrialStrains( );
+
   return 0;
 }
 
@@ -893,6 +1020,9 @@ void  XC::Brick::formResidAndTangent( int tang_flag ) const
   } // end for i
 
 
+  //stresses and tangents of the gauss points
+  const NDMaterialBatch &batch= physicalProperties.getUpdatedBatch();
+
   //gauss loop
   for( i = 0; i < numberGauss; i++ ) {
 
@@ -903,16 +1033,17 @@ void  XC::Brick::formResidAndTangent( int tang_flag ) const
     } // end for p
 
 
-    //compute the stress
-    stress = physicalProperties[i]->getStress( );
-
-
-    //multiply by volume element
-    stress  *= dvol[i];
+    //compute the stress multiplied by volume element
+    const double *sigma = batch.getStressPtr(i);
+    for( p = 0; p < brick_nstress; p++ )
+      stress(p) = sigma[p]*dvol[i];
 
     if( tang_flag == 1 ) {
-      dd = physicalProperties[i]->getTangent( );
-      dd *= dvol[i];
+      const double *tangent = batch.getTangentPtr(i);
+      for( q = 0; q < brick_nstress; q++ ) {
+        for( p = 0; p < brick_nstress; p++ )
+          dd(p,q) = tangent[q*brick_nstress+p]*dvol[i];
+      } //end for q
     } //end if tang_flag
 
 
@@ -55,6 +55,7 @@
 
 #include <domain/mesh/element/volumetric/BrickBase.h>
 #include "domain/mesh/element/utils/body_forces/BodyForces3D.h"
+#include "domain/mesh/element/utils/SharedMatrixCache.h"
 
 namespace XC {
 //! @ingroup ElemVol
@@ -65,6 +66,8 @@ class Brick : public BrickBase
   private : 
     BodyForces3D bf; //!< Body forces
     mutable Matrix *Ki;
+    mutable SharedMatrixRef sharedStiff; //!< stiffness shared with the identical elements.
+    mutable SharedMatrixRef sharedMass; //!< mass matrix shared with the identical elements.
 
     //
     // static attributes
@@ -100,6 +103,10 @@ class Brick : public BrickBase
     //Matrix transpose
     Matrix transpose( int dim1, int dim2, const Matrix &M );
     static size_t getVectorIndex(const size_t &,const size_t &);
+
+    SharedMatrixCache::Key getSharedMatrixKey(const int &) const;
+    const Matrix *getSharedStiff(void) const;
+    const Matrix *getSharedMass(void) const;
   protected:
     int sendData(CommParameters &cp);
     int recvData(const CommParameters &cp);
@@ -117,6 +124,7 @@ class Brick : public BrickBase
 
     //set domain
     void setDomain( Domain *theDomain );
+    bool hasConstantTangent(void) const;
 
     //return number of dofs
     int getNumDOF(void) const;
@@ -63,6 +63,8 @@ class KDTreeNodes: protected kd_tree::KDTree<3, NodePos, std::pointer_to_binary_
     KDTreeNodes(void);
 
     void insert(const Node &);
+    template <class InputIterator>
+    void insert(InputIterator first,InputIterator last);
     void erase(const Node &);
     void clear(void);
 
@@ -70,6 +72,23 @@ class KDTreeNodes: protected kd_tree::KDTree<3, NodePos, std::pointer_to_binary_
     const Node *getNearest(const Pos3d &pos, const double &r) const;
   };
 
+//! @brief Inserts the objects pointed by the iterators (bulk insertion).
+//! The tree is rebalanced only when the batch is at least as big as
+//! the tree was, so repeated bulk insertions cost O(n log n) overall.
+template <class InputIterator>
+void KDTreeNodes::insert(InputIterator first,InputIterator last)
+  {
+    const size_t sz0= tree_type::size();
+    size_t count= 0;
+    for(InputIterator i= first;i!=last;i++,count++)
+      tree_type::insert(NodePos(**i));
+    if(count>=sz0)
+      {
+        tree_type::optimise();
+        pend_optimizar= 0;
+      }
+  }
+
 } // end of XC namespace 
 
 
@@ -0,0 +1,315 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//NodalStateStore.cc
+
+#include "NodalStateStore.h"
+#include "Node.h"
+#include "NodeIter.h"
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/ID.h"
+#include "utility/xc_python_utils.h"
+#include <algorithm>
+
+//! @brief Constructor.
+//! @param nv: number of vectors (trial, committed,...).
+XC::NodeVectorsBuffer::NodeVectorsBuffer(const size_t &nv,NodalStateStore *o)
+  : numVectors(nv), size(0), owner(o) {}
+
+//! @brief Destructor (copy back the values to the objects).
+XC::NodeVectorsBuffer::~NodeVectorsBuffer(void)
+  { clear(); }
+
+//! @brief Moves the values of the objects being passed as parameter
+//! (and its number of DOFs) to the buffer, one after another.
+void XC::NodeVectorsBuffer::pack(const std::vector<std::pair<NodeVectors *,size_t> > &items)
+  {
+    size_t sz= 0;
+    for(std::vector<std::pair<NodeVectors *,size_t> >::const_iterator i= items.begin();i!=items.end();i++)
+      sz+= i->second;
+    // the objects copy its values from the old arrays
+    // (if they're already here) to the new ones.
+    std::vector<double> tmp(numVectors*sz,0.0);
+    std::map<NodeVectors *,size_t> newClients;
+    size_t offset= 0;
+    for(std::vector<std::pair<NodeVectors *,size_t> >::const_iterator i= items.begin();i!=items.end();i++)
+      {
+        NodeVectors *nv= i->first;
+        const size_t &nDOF= i->second;
+        if(nDOF>0)
+          {
+            nv->attach(*this,&tmp[offset],sz,nDOF);
+            newClients[nv]= nDOF;
+          }
+        offset+= nDOF;
+      }
+    // objects no longer in the buffer.
+    for(std::map<NodeVectors *,size_t>::iterator i= clients.begin();i!=clients.end();i++)
+      i->first->detach(i->second);
+    values.swap(tmp); // the pointers to tmp remain valid.
+    clients.swap(newClients);
+    size= sz;
+  }
+
+//! @brief The object no longer uses the buffer (it's being destroyed,
+//! copied or received), so the store that owns the buffer no longer
+//! contains all the nodes.
+void XC::NodeVectorsBuffer::release(NodeVectors &nv)
+  {
+    if(nv.buffer==this)
+      {
+        clients.erase(&nv);
+        nv.buffer= nullptr;
+        if(owner)
+          owner->invalidate();
+      }
+  }
+
+//! @brief Copy back the values to the objects and free the memory.
+void XC::NodeVectorsBuffer::clear(void)
+  {
+    for(std::map<NodeVectors *,size_t>::iterator i= clients.begin();i!=clients.end();i++)
+      i->first->detach(i->second);
+    clients.clear();
+    values.clear();
+    size= 0;
+  }
+
+//! @brief Committed values= trial values (the rest of
+//! the vectors -increments- are set to zero).
+void XC::NodeVectorsBuffer::commit(void)
+  {
+    if(size>0)
+      {
+        std::copy(values.begin(),values.begin()+size,values.begin()+size);
+        std::fill(values.begin()+2*size,values.end(),0.0);
+      }
+  }
+
+//! @brief Trial values= committed values (the rest of
+//! the vectors -increments- are set to zero).
+void XC::NodeVectorsBuffer::revertToLastCommit(void)
+  {
+    if(size>0)
+      {
+        std::copy(values.begin()+size,values.begin()+2*size,values.begin());
+        std::fill(values.begin()+2*size,values.end(),0.0);
+      }
+  }
+
+//! @brief Return the position of the values of the object in the
+//! vectors (-1 if the object is not in the buffer).
+long XC::NodeVectorsBuffer::getOffset(const NodeVectors &nv) const
+  {
+    long retval= -1;
+    if(nv.buffer==this)
+      retval= nv.data-&values[0];
+    return retval;
+  }
+
+//! @brief Return a read-only view (Python memoryview) of the i-th
+//! vector. The view is no longer valid if the nodes are packed again.
+boost::python::object XC::NodeVectorsBuffer::getPyVector(const size_t &i) const
+  {
+    if(i<numVectors)
+      return py_memoryview_from_doubles(getVector(i),size);
+    else
+      {
+        std::cerr << "NodeVectorsBuffer::" << __FUNCTION__
+                  << "; index: " << i << " out of range (number of vectors: "
+                  << numVectors << ")." << std::endl;
+        return py_memoryview_from_doubles(nullptr,0);
+      }
+  }
+
+//! @brief Constructor.
+XC::NodalStateStore::NodalStateStore(void)
+  : disp(4,this), vel(2,this), accel(2,this), version(0), packed(false) {}
+
+//! @brief Moves the displacements, velocities and accelerations of
+//! the nodes to the store.
+void XC::NodalStateStore::pack(NodeIter &theNodes)
+  {
+    std::vector<std::pair<NodeVectors *,size_t> > dispItems, velItems, accelItems;
+    nodeTags.clear();
+    nodeOffsets.clear();
+    size_t offset= 0;
+    Node *nodePtr= nullptr;
+    while((nodePtr= theNodes()) != nullptr)
+      {
+        const size_t nDOF= nodePtr->getNumberDOF();
+        dispItems.push_back(std::make_pair(&nodePtr->disp,nDOF));
+        velItems.push_back(std::make_pair(&nodePtr->vel,nDOF));
+        accelItems.push_back(std::make_pair(&nodePtr->accel,nDOF));
+        nodeTags.push_back(nodePtr->getTag());
+        nodeOffsets.push_back(offset);
+        offset+= nDOF;
+      }
+    disp.pack(dispItems);
+    vel.pack(velItems);
+    accel.pack(accelItems);
+    version++;
+    packed= true;
+  }
+
+//! @brief Copy back the values to the nodes and free the memory.
+void XC::NodalStateStore::clear(void)
+  {
+    disp.clear();
+    vel.clear();
+    accel.clear();
+    nodeTags.clear();
+    nodeOffsets.clear();
+    version++;
+    packed= false;
+  }
+
+//! @brief Commit the state of all the nodes in the store.
+void XC::NodalStateStore::commit(void)
+  {
+    disp.commit();
+    vel.commit();
+    accel.commit();
+  }
+
+//! @brief Return all the nodes in the store to its last committed state.
+void XC::NodalStateStore::revertToLastCommit(void)
+  {
+    disp.revertToLastCommit();
+    vel.revertToLastCommit();
+    accel.revertToLastCommit();
+  }
+
+//! @brief Return the number of nodes in the store.
+size_t XC::NodalStateStore::getNumNodes(void) const
+  { return nodeTags.size(); }
+
+//! @brief Return the number of DOFs (components of each vector).
+size_t XC::NodalStateStore::getNumDOFs(void) const
+  { return disp.getSize(); }
+
+//! @brief Return the position of the values of the node in the
+//! vectors (-1 if the node is not in the store).
+long XC::NodalStateStore::getNodeOffset(const Node &n) const
+  { return disp.getOffset(n.disp); }
+
+//! @brief Return the tags of the nodes in the store.
+XC::ID XC::NodalStateStore::getNodeTags(void) const
+  {
+    const size_t sz= nodeTags.size();
+    ID retval(sz);
+    for(size_t i= 0;i<sz;i++)
+      retval[i]= nodeTags[i];
+    return retval;
+  }
+
+//! @brief Return the position of the values of each node
+//! (in the same order than getNodeTags).
+XC::ID XC::NodalStateStore::getNodeOffsets(void) const
+  {
+    const size_t sz= nodeOffsets.size();
+    ID retval(sz);
+    for(size_t i= 0;i<sz;i++)
+      retval[i]= nodeOffsets[i];
+    return retval;
+  }
+
+//! @brief Set the trial displacements from the values of the vector
+//! (i.e. the solution of the system of equations).
+//!
+//! @param pos: positions in the store of the DOFs to set.
+//! @param eqn: equation number of each DOF (the trial value is kept if it's negative).
+//! @param u: vector of values.
+void XC::NodalStateStore::setTrialDisp(const std::vector<size_t> &pos,const std::vector<int> &eqn,const Vector &u)
+  {
+    double *trial= disp.getVector(0);
+    const double *commit= disp.getVector(1);
+    double *incr= disp.getVector(2);
+    double *incrDelta= disp.getVector(3);
+    const double *values= u.getDataPtr();
+    const size_t sz= pos.size();
+    for(size_t k= 0;k<sz;k++)
+      {
+        const size_t p= pos[k];
+        const int eq= eqn[k];
+        const double t= (eq>=0 ? values[eq] : trial[p]);
+        incr[p]= t - commit[p];
+        incrDelta[p]= t - trial[p];
+        trial[p]= t;
+      }
+  }
+
+//! @brief Increments the trial displacements with the values of the
+//! vector (see setTrialDisp).
+void XC::NodalStateStore::incrTrialDisp(const std::vector<size_t> &pos,const std::vector<int> &eqn,const Vector &u)
+  {
+    double *trial= disp.getVector(0);
+    double *incr= disp.getVector(2);
+    double *incrDelta= disp.getVector(3);
+    const double *values= u.getDataPtr();
+    const size_t sz= pos.size();
+    for(size_t k= 0;k<sz;k++)
+      {
+        const size_t p= pos[k];
+        const int eq= eqn[k];
+        const double d= (eq>=0 ? values[eq] : 0.0);
+        trial[p]+= d;
+        incr[p]+= d;
+        incrDelta[p]= d;
+      }
+  }
+
+//! @brief Set the trial velocities from the values of the vector
+//! (see setTrialDisp).
+void XC::NodalStateStore::setTrialVel(const std::vector<size_t> &pos,const std::vector<int> &eqn,const Vector &v)
+  {
+    double *trial= vel.getVector(0);
+    const double *values= v.getDataPtr();
+    const size_t sz= pos.size();
+    for(size_t k= 0;k<sz;k++)
+      {
+        const int eq= eqn[k];
+        if(eq>=0)
+          trial[pos[k]]= values[eq];
+      }
+  }
+
+//! @brief Set the trial accelerations from the values of the vector
+//! (see setTrialDisp).
+void XC::NodalStateStore::setTrialAccel(const std::vector<size_t> &pos,const std::vector<int> &eqn,const Vector &a)
+  {
+    double *trial= accel.getVector(0);
+    const double *values= a.getDataPtr();
+    const size_t sz= pos.size();
+    for(size_t k= 0;k<sz;k++)
+      {
+        const int eq= eqn[k];
+        if(eq>=0)
+          trial[pos[k]]= values[eq];
+      }
+  }
+
+//! @brief Print stuff.
+void XC::NodalStateStore::Print(std::ostream &os) const
+  {
+    os << "NodalStateStore; nodes: " << getNumNodes()
+       << " DOFs: " << getNumDOFs() << std::endl;
+  }
@@ -0,0 +1,155 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//NodalStateStore.h
+
+#ifndef NodalStateStore_h
+#define NodalStateStore_h
+
+#include <cstddef>
+#include <vector>
+#include <map>
+#include <iostream>
+#include <boost/python/object.hpp>
+
+namespace XC {
+
+class Vector;
+class ID;
+class Node;
+class NodeIter;
+class NodeVectors;
+class NodalStateStore;
+
+//! @ingroup Nod
+//
+//! @brief Contiguous storage for the vectors (trial, committed,...)
+//! of a set of NodeVectors objects (i.e. the displacements of the
+//! nodes of a mesh).
+//!
+//! Each vector is stored in a contiguous array that contains the
+//! values of all the nodes (the trial values of all the nodes, then
+//! the committed ones and so on).
+class NodeVectorsBuffer
+  {
+  private:
+    size_t numVectors; //!< number of vectors (trial, committed,...).
+    size_t size; //!< number of components of each vector.
+    std::vector<double> values; //!< the vectors one after another.
+    std::map<NodeVectors *,size_t> clients; //!< objects stored in the buffer (and its number of DOFs).
+    NodalStateStore *owner; //!< store to invalidate when an object leaves the buffer.
+
+    NodeVectorsBuffer(const NodeVectorsBuffer &);
+    NodeVectorsBuffer &operator=(const NodeVectorsBuffer &);
+  public:
+    NodeVectorsBuffer(const size_t &,NodalStateStore *owner= nullptr);
+    ~NodeVectorsBuffer(void);
+
+    void pack(const std::vector<std::pair<NodeVectors *,size_t> > &);
+    void release(NodeVectors &);
+    void clear(void);
+
+    void commit(void);
+    void revertToLastCommit(void);
+
+    //! @brief Return the number of components of each vector.
+    inline size_t getSize(void) const
+      { return size; }
+    //! @brief Return a pointer to the first component of the i-th vector.
+    inline double *getVector(const size_t &i)
+      { return (size>0 ? &values[i*size] : nullptr); }
+    //! @brief Return a pointer to the first component of the i-th vector.
+    inline const double *getVector(const size_t &i) const
+      { return (size>0 ? &values[i*size] : nullptr); }
+    long getOffset(const NodeVectors &) const;
+    boost::python::object getPyVector(const size_t &) const;
+  };
+
+//! @ingroup Nod
+//
+//! @brief Displacements, velocities and accelerations of the nodes
+//! of a mesh stored in contiguous arrays (a structure of arrays).
+//!
+//! The nodes keep using its Vector objects, but they point to the
+//! arrays of the store, so commit and the update of the trial values
+//! from the analysis (see AnalysisModel::setResponse) are loops over
+//! contiguous memory. The nodes are stored in the order of the
+//! iterator passed to pack, the values of each node start at the
+//! position given by getNodeOffset.
+class NodalStateStore
+  {
+  private:
+    NodeVectorsBuffer disp; //!< trial, committed, incremental and incremental delta displacements.
+    NodeVectorsBuffer vel; //!< trial and committed velocities.
+    NodeVectorsBuffer accel; //!< trial and committed accelerations.
+    std::vector<int> nodeTags; //!< tags of the nodes in the store.
+    std::vector<size_t> nodeOffsets; //!< position of the values of each node.
+    size_t version; //!< incremented each time the nodes are (re)packed.
+    bool packed; //!< true if all the nodes are in the store.
+
+    NodalStateStore(const NodalStateStore &);
+    NodalStateStore &operator=(const NodalStateStore &);
+  public:
+    NodalStateStore(void);
+
+    void pack(NodeIter &);
+    void clear(void);
+    //! @brief Marks the store as outdated (nodes added or removed).
+    inline void invalidate(void)
+      { packed= false; }
+    //! @brief Return true if the store contains all the nodes.
+    inline bool isPacked(void) const
+      { return packed; }
+    //! @brief Return a number that changes each time the nodes are packed
+    //! (the positions of the nodes change).
+    inline size_t getVersion(void) const
+      { return version; }
+
+    void commit(void);
+    void revertToLastCommit(void);
+
+    size_t getNumNodes(void) const;
+    size_t getNumDOFs(void) const;
+    long getNodeOffset(const Node &) const;
+    ID getNodeTags(void) const;
+    ID getNodeOffsets(void) const;
+
+    void setTrialDisp(const std::vector<size_t> &,const std::vector<int> &,const Vector &);
+    void incrTrialDisp(const std::vector<size_t> &,const std::vector<int> &,const Vector &);
+    void setTrialVel(const std::vector<size_t> &,const std::vector<int> &,const Vector &);
+    void setTrialAccel(const std::vector<size_t> &,const std::vector<int> &,const Vector &);
+
+    //! @brief Return the displacement vectors.
+    inline const NodeVectorsBuffer &getDisp(void) const
+      { return disp; }
+    //! @brief Return the velocity vectors.
+    inline const NodeVectorsBuffer &getVel(void) const
+      { return vel; }
+    //! @brief Return the acceleration vectors.
+    inline const NodeVectorsBuffer &getAccel(void) const
+      { return accel; }
+
+    void Print(std::ostream &) const;
+  };
+
+} // end of XC namespace
+
+#endif
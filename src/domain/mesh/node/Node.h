@@ -109,6 +109,7 @@ class DqPtrsElem;
 //! retrieve these quantities.
 class Node: public MeshComponent
   {
+    friend class NodalStateStore;
   private:
     // private data associated with each node object
     int numberDOF; //!< number of DOFs at Node
@@ -121,9 +121,9 @@ int XC::NodeDispVectors::setTrialDispComponent(const size_t &nDOF,const double &
     // perform the assignment .. we dont't go through Vector interface
     // as we are sure of size and this way is quicker
     const double tDisp = value;
-    values[dof+2*nDOF]= tDisp - values[dof+nDOF];
-    values[dof+3*nDOF]= tDisp - values[dof];
-    values[dof]= tDisp;
+    data[dof+2*stride]= tDisp - data[dof+stride];
+    data[dof+3*stride]= tDisp - data[dof];
+    data[dof]= tDisp;
 
     return 0;
   }
@@ -157,9 +157,9 @@ int XC::NodeDispVectors::setTrialDisp(const size_t &nDOF,const Vector &newTrialD
     for(size_t i=0;i<nDOF;i++)
       {
         const double tDisp = newTrialDisp(i);
-        values[i+2*nDOF]= tDisp - values[i+nDOF];
-        values[i+3*nDOF]= tDisp - values[i];
-        values[i] = tDisp;
+        data[i+2*stride]= tDisp - data[i+stride];
+        data[i+3*stride]= tDisp - data[i];
+        data[i] = tDisp;
       }
     return 0;
   }
@@ -188,9 +188,9 @@ int XC::NodeDispVectors::incrTrialDisp(const size_t &nDOF,const Vector &incrDisp
         for(size_t i=0;i<nDOF;i++)
           {
             const double incrDispI = incrDispl(i);
-            values[i]= incrDispI;
-            values[i+2*nDOF]= incrDispI;
-            values[i+3*nDOF]= incrDispI;
+            data[i]= incrDispI;
+            data[i+2*stride]= incrDispI;
+            data[i+3*stride]= incrDispI;
           }
         return 0;
       }
@@ -199,9 +199,9 @@ int XC::NodeDispVectors::incrTrialDisp(const size_t &nDOF,const Vector &incrDisp
     for(size_t i= 0;i<nDOF;i++)
       {
         double incrDispI = incrDispl(i);
-        values[i]+= incrDispI;
-        values[i+2*nDOF]+= incrDispI;
-        values[i+3*nDOF]= incrDispI;
+        data[i]+= incrDispI;
+        data[i+2*stride]+= incrDispI;
+        data[i+3*stride]= incrDispI;
       }
     return 0;
   }
@@ -215,9 +215,9 @@ int XC::NodeDispVectors::commitState(const size_t &nDOF)
       {
         for(size_t i=0; i<nDOF; i++)
           {
-            values[i+nDOF]= values[i];
-            values[i+2*nDOF]= 0.0;
-            values[i+3*nDOF]= 0.0;
+            data[i+stride]= data[i];
+            data[i+2*stride]= 0.0;
+            data[i+3*stride]= 0.0;
           }
       }
     return 0;
@@ -229,13 +229,13 @@ int XC::NodeDispVectors::commitState(const size_t &nDOF)
 int XC::NodeDispVectors::revertToLastCommit(const size_t &nDOF)
   {
     // check disp exists, if does set trial = last commit, incr = 0
-    if(!values.isEmpty())
+    if(data)
       {
         for(size_t i=0;i<nDOF;i++)
           {
-            values[i] = values[i+nDOF];
-            values[i+2*nDOF]= 0.0;
-            values[i+3*nDOF]= 0.0;
+            data[i] = data[i+stride];
+            data[i+2*stride]= 0.0;
+            data[i+3*stride]= 0.0;
           }
       }
     return 0;
@@ -255,16 +255,28 @@ void XC::NodeDispVectors::Print(std::ostream &s,int flag)
 int XC::NodeDispVectors::createDisp(const size_t &nDOF)
   {
     // trial , committed, incr = (committed-trial)
-    NodeVectors::createData(nDOF);
-
-    incrDisp = new Vector(&values[2*nDOF], nDOF);
-    incrDeltaDisp = new Vector(&values[3*nDOF], nDOF);
-
+    const int retval= NodeVectors::createData(nDOF);
     if(incrDisp == nullptr || incrDeltaDisp == nullptr)
       {
         std::cerr << "WARNING - NodeDispVectors::createDisp() "
                   << "ran out of memory creating Vectors(double *,int)";
         return -2;
       }
-    return 0;
+    return retval;
+  }
+
+//! @brief Makes the Vector objects (trial, committed and increments)
+//! point to its components.
+//! @param nDOF: number of degrees of freedom.
+void XC::NodeDispVectors::set_views(const size_t &nDOF)
+  {
+    NodeVectors::set_views(nDOF);
+    if(incrDisp)
+      incrDisp->setData(data+2*stride,nDOF);
+    else
+      incrDisp= new Vector(data+2*stride, nDOF);
+    if(incrDeltaDisp)
+      incrDeltaDisp->setData(data+3*stride,nDOF);
+    else
+      incrDeltaDisp= new Vector(data+3*stride, nDOF);
   }
@@ -27,6 +27,7 @@
 //NodeVectors.cpp
 
 #include <domain/mesh/node/NodeVectors.h>
+#include <domain/mesh/node/NodalStateStore.h>
 #include <utility/tagged/TaggedObject.h>
 #include <utility/matrix/Vector.h>
 #include <utility/matrix/ID.h>
@@ -35,11 +36,14 @@
 
 void XC::NodeVectors::free_mem(void)
   {
+    if(buffer)
+      buffer->release(*this);
     // delete anything that we created with new
     if(commitData) delete commitData;
     commitData= nullptr;
     if(trialData) delete trialData;
     trialData= nullptr;
+    data= nullptr;
   }
 
 void XC::NodeVectors::copy(const NodeVectors &other)
@@ -55,19 +59,20 @@ void XC::NodeVectors::copy(const NodeVectors &other)
             std::cerr << " FATAL NodeVectors::Node(node *) - ran out of memory for data\n";
             exit(-1);
           }
-        for(register size_t i=0;i<sz;i++)
-          values[i] = other.values[i];
+        for(size_t k= 0;k<numVectors;k++)
+          for(size_t i= 0;i<nDOF;i++)
+            data[i+k*stride]= other.data[i+k*other.stride];
       }
   }
 
 //! @brief Constructor.
 XC::NodeVectors::NodeVectors(const size_t &nv)
-  :CommandEntity(),MovableObject(NOD_TAG_NodeVectors), numVectors(nv), commitData(nullptr),trialData(nullptr), values() {}
+  :CommandEntity(),MovableObject(NOD_TAG_NodeVectors), numVectors(nv), commitData(nullptr),trialData(nullptr), values(), data(nullptr), stride(0), buffer(nullptr) {}
 
 
 //! @brief Copy constructor.
 XC::NodeVectors::NodeVectors(const NodeVectors &other)
-  : CommandEntity(other),MovableObject(NOD_TAG_NodeVectors), numVectors(other.numVectors), commitData(nullptr), trialData(nullptr), values()
+  : CommandEntity(other),MovableObject(NOD_TAG_NodeVectors), numVectors(other.numVectors), commitData(nullptr), trialData(nullptr), values(), data(nullptr), stride(0), buffer(nullptr)
   { copy(other); }
 
 XC::NodeVectors &XC::NodeVectors::operator=(const NodeVectors &other)
@@ -147,8 +152,8 @@ int XC::NodeVectors::setTrialData(const size_t &nDOF,const double &value,const s
 
     // perform the assignment .. we dont't go through Vector interface
     // as we are sure of size and this way is quicker
-    if(!values.isEmpty())
-      values[dof]= value;
+    if(data)
+      data[dof]= value;
     return 0;
   }
 
@@ -165,7 +170,7 @@ int XC::NodeVectors::setTrialData(const size_t &nDOF,const Vector &newTrialData)
     // construct memory and Vectors for trial and committed
     // accel on first call to this method, getTrialData(),
     // getData(), or incrTrialData()
-    if(values.isEmpty())
+    if(!data)
       {
         if(this->createData(nDOF) < 0)
           {
@@ -177,7 +182,7 @@ int XC::NodeVectors::setTrialData(const size_t &nDOF,const Vector &newTrialData)
     // perform the assignment .. we dont't go through XC::Vector interface
     // as we are sure of size and this way is quicker
     for(size_t i=0;i<nDOF;i++)
-      values[i]= newTrialData(i);
+      data[i]= newTrialData(i);
     return 0;
   }
 
@@ -192,7 +197,7 @@ int XC::NodeVectors::incrTrialData(const size_t &nDOF,const Vector &incrData)
       }
 
     // create a copy if no trial exists andd add committed
-    if(values.isEmpty())
+    if(!data)
       {
         if(this->createData(nDOF) < 0)
           {
@@ -202,7 +207,7 @@ int XC::NodeVectors::incrTrialData(const size_t &nDOF,const Vector &incrData)
       }
     // set trial = incr + trial
     for(size_t i= 0;i<nDOF;i++)
-      values[i]+= incrData(i);
+      data[i]+= incrData(i);
     return 0;
   }
 
@@ -213,7 +218,7 @@ int XC::NodeVectors::commitState(const size_t &nDOF)
     if(trialData)
       {
         for(register size_t i=0; i<nDOF; i++)
-          values[i+nDOF] = values[i];
+          data[i+stride] = data[i];
       }
     return 0;
   }
@@ -223,10 +228,10 @@ int XC::NodeVectors::commitState(const size_t &nDOF)
 int XC::NodeVectors::revertToLastCommit(const size_t &nDOF)
   {
     // check data exists, if does set trial = last commit, incr = 0
-    if(!values.isEmpty())
+    if(data)
       {
         for(size_t i=0;i<nDOF;i++)
-          values[i] = values[nDOF+i];
+          data[i] = data[stride+i];
       }
     return 0;
   }
@@ -236,11 +241,11 @@ int XC::NodeVectors::revertToLastCommit(const size_t &nDOF)
 int XC::NodeVectors::revertToStart(const size_t &nDOF)
   {
     // check data exists, if does set all to zero
-    const size_t sz= numVectors*nDOF;
-    if(!values.isEmpty())
+    if(data)
       {
-        for(size_t i=0;i<sz;i++)
-          values[i]= 0.0;
+        for(size_t k= 0;k<numVectors;k++)
+          for(size_t i=0;i<nDOF;i++)
+            data[i+k*stride]= 0.0;
       }
     return 0;
   }
@@ -259,9 +264,9 @@ int XC::NodeVectors::createData(const size_t &nDOF)
       {
         for(size_t i=0;i<sz;i++)
           values[i]= 0.0;
-
-        trialData= new Vector(&values[0], nDOF);
-        commitData= new Vector(&values[nDOF], nDOF);
+        data= values.getDataPtr();
+        stride= nDOF;
+        set_views(nDOF);
 
         if(!commitData || !trialData)
           {
@@ -278,6 +283,60 @@ int XC::NodeVectors::createData(const size_t &nDOF)
       }
   }
 
+//! @brief Makes the trial and committed Vector objects point
+//! to its components (the objects are reused if they already exist
+//! so the references to them remain valid).
+void XC::NodeVectors::set_views(const size_t &nDOF)
+  {
+    if(trialData)
+      trialData->setData(data,nDOF);
+    else
+      trialData= new Vector(data, nDOF);
+    if(commitData)
+      commitData->setData(data+stride,nDOF);
+    else
+      commitData= new Vector(data+stride, nDOF);
+  }
+
+//! @brief Moves the values to the memory of the buffer being passed
+//! as parameter.
+//!
+//! @param b: buffer that will contain the values.
+//! @param ptr: position of the first trial component in the buffer.
+//! @param bStride: distance between the components of consecutive vectors in the buffer.
+//! @param nDOF: number of degrees of freedom.
+void XC::NodeVectors::attach(NodeVectorsBuffer &b,double *ptr,const size_t &bStride,const size_t &nDOF)
+  {
+    for(size_t k= 0;k<numVectors;k++)
+      for(size_t i= 0;i<nDOF;i++)
+        ptr[i+k*bStride]= (data ? data[i+k*stride] : 0.0);
+    if(buffer)
+      buffer->release(*this);
+    values= Vector();
+    data= ptr;
+    stride= bStride;
+    buffer= &b;
+    set_views(nDOF);
+  }
+
+//! @brief Copy back the values from the buffer to the object's own memory.
+//! @param nDOF: number of degrees of freedom.
+void XC::NodeVectors::detach(const size_t &nDOF)
+  {
+    if(buffer)
+      {
+        values= Vector(numVectors*nDOF);
+        double *ptr= values.getDataPtr();
+        for(size_t k= 0;k<numVectors;k++)
+          for(size_t i= 0;i<nDOF;i++)
+            ptr[i+k*nDOF]= data[i+k*stride];
+        buffer= nullptr;
+        data= ptr;
+        stride= nDOF;
+        set_views(nDOF);
+      }
+  }
+
 //! @brief Returns a vector to store the dbTags
 //! de los miembros of the clase.
 XC::DbTagData &XC::NodeVectors::getDbTagData(void) const
@@ -332,7 +391,7 @@ int XC::NodeVectors::recvData(const CommParameters &cp)
 
         // set the trial quantities equal to committed
         for(int i=0; i<nDOF; i++)
-          values[i]= values[i+nDOF]; // set trial equal commited
+          data[i]= data[i+stride]; // set trial equal commited
       }
     else if(commitData)
       {
@@ -39,6 +39,7 @@ namespace XC {
 class Vector;
 class Channel;
 class FEM_ObjectBroker;
+class NodeVectorsBuffer;
 
 //! @ingroup Nod
 //
@@ -46,17 +47,24 @@ class FEM_ObjectBroker;
 //! values of node displacement, velocity, etc.
 class NodeVectors: public CommandEntity, public MovableObject
   {
+    friend class NodeVectorsBuffer;
   protected:
     size_t numVectors; //!< number of vectors.
     Vector *commitData; //!< commited quantities
     Vector *trialData; //!< trial quantities
     
     Vector values; //!< double array holding the displacement/velocity/acceleration.
+    double *data; //!< first component of the trial values (in values or in a NodeVectorsBuffer).
+    size_t stride; //!< distance between the components of consecutive vectors (trial, committed,...).
+    NodeVectorsBuffer *buffer; //!< buffer that contains the values (if any).
 
     DbTagData &getDbTagData(void) const;
     int sendData(CommParameters &);
     int recvData(const CommParameters &);
     int createData(const size_t &);
+    virtual void set_views(const size_t &);
+    void attach(NodeVectorsBuffer &,double *,const size_t &,const size_t &);
+    void detach(const size_t &);
     void free_mem(void);
     void copy(const NodeVectors &);
   public:
@@ -68,6 +76,9 @@ class NodeVectors: public CommandEntity, public MovableObject
 
     // public methods dealing with the DOF at the node
     size_t getVectorsSize(void) const;
+    //! @brief Return true if the values are stored in a NodeVectorsBuffer.
+    inline bool isInBuffer(void) const
+      { return (buffer!=nullptr); }
 
     // public methods for obtaining committed and trial 
     // response quantities of the node
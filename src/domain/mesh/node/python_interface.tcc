@@ -64,6 +64,8 @@ class_<XC::Node, XC::Node *, bases<XC::MeshComponent>, boost::noncopyable >("Nod
   .add_property("getAccel", make_function( &XC::Node::getAccel, return_value_policy<copy_const_reference>() ), "Return the acceleration vector.")
   .add_property("getAccelXYZ", &XC::Node::getAccelXYZ, "Return the translational components of the displacement vector.")
   .add_property("getAlphaXYZ", &XC::Node::getAlphaXYZ)
+  .def("getDispSensitivity", &XC::Node::getDispSensitivity,"getDispSensitivity(dof,gradNum): return the sensitivity of the displacement at the dof (1 based) with respect to the gradNum-th random variable or parameter.")
+  .def("getVelSensitivity", &XC::Node::getVelSensitivity,"getVelSensitivity(dof,gradNum): return the sensitivity of the velocity at the dof (1 based) with respect to the gradNum-th random variable or parameter.")
   .add_property("isAlive",&XC::Node::isAlive,"True if node is active.")
   .add_property("isDead",&XC::Node::isDead,"True if node is dead.")
   .add_property("isFrozen",&XC::Node::isFrozen,"True if node is frozen.")
@@ -123,3 +125,18 @@ class_<XC::Node, XC::Node *, bases<XC::MeshComponent>, boost::noncopyable >("Nod
 class_<XC::NodeIter, boost::noncopyable >("NodeIter", no_init)
   .def("next", &XC::NodeIter::operator(), return_internal_reference<>(),"Returns next node.")
    ;
+
+class_<XC::NodeVectorsBuffer, boost::noncopyable >("NodeVectorsBuffer", no_init)
+  .add_property("size", &XC::NodeVectorsBuffer::getSize,"Return the number of components of each vector.")
+  .def("getVector", &XC::NodeVectorsBuffer::getPyVector,"getVector(i): return a read-only memoryview of the i-th vector (0: trial values, 1: committed values; for displacements 2: incremental and 3: incremental delta displacements). Use numpy.frombuffer(view, dtype= numpy.float64) to read it.")
+   ;
+
+class_<XC::NodalStateStore, boost::noncopyable >("NodalStateStore", no_init)
+  .add_property("numNodes", &XC::NodalStateStore::getNumNodes,"Return the number of nodes in the store.")
+  .add_property("numDOFs", &XC::NodalStateStore::getNumDOFs,"Return the number of DOFs (components of each vector).")
+  .add_property("nodeTags", &XC::NodalStateStore::getNodeTags,"Return the tags of the nodes in the store.")
+  .add_property("nodeOffsets", &XC::NodalStateStore::getNodeOffsets,"Return the position of the first DOF of each node in the vectors.")
+  .add_property("disp", make_function(&XC::NodalStateStore::getDisp, return_internal_reference<>() ),"Displacement vectors.")
+  .add_property("vel", make_function(&XC::NodalStateStore::getVel, return_internal_reference<>() ),"Velocity vectors.")
+  .add_property("accel", make_function(&XC::NodalStateStore::getAccel, return_internal_reference<>() ),"Acceleration vectors.")
+   ;
@@ -53,6 +53,21 @@ class_<XC::Mesh, bases<XC::MeshComponentContainer>, boost::noncopyable >("Mesh",
   .def("getNumLiveElements", &XC::Mesh::getNumLiveElements,"Returns the number of live elements.")
   .def("getNumDeadElements", &XC::Mesh::getNumDeadElements,"Returns the number of dead elements.")
   .def("getNearestElement",make_function(getNearestElementPtrMesh, return_internal_reference<>() ),"Returns nearest node.")
+  .add_property("bufferedComm", &XC::Mesh::getBufferedComm, &XC::Mesh::setBufferedComm,"If true the nodes and elements are serialized in a single buffer when the mesh is sent (or stored in a database).")
+  .add_property("elementTiming", &XC::Mesh::getElementTiming, &XC::Mesh::setElementTiming,"If true the time spent in the update of each element is measured (see getElementCost).")
+  .def("getElementCost", &XC::Mesh::getElementCost,"Return the time (in seconds) spent in the update of the element whose tag is passed as parameter.")
+  .def("resetElementCosts", &XC::Mesh::resetElementCosts,"Discards the measured element costs.")
+  .add_property("useMaterialStateStore", &XC::Mesh::getUseMaterialStateStore, &XC::Mesh::setUseMaterialStateStore,"If true the state variables of the materials that support it are kept in contiguous memory blocks (faster commit and revert).")
+  .add_property("getNumMaterialsInStateStore", &XC::Mesh::getNumMaterialsInStateStore,"Return the number of materials whose state variables are kept in contiguous memory blocks.")
+  .add_property("useNodalStateStore", &XC::Mesh::getUseNodalStateStore, &XC::Mesh::setUseNodalStateStore,"If true the displacements, velocities and accelerations of the nodes are kept in contiguous arrays (see getNodalStateStore).")
+  .add_property("getNodalStateStore", make_function(&XC::Mesh::getNodalStateStore, return_internal_reference<>() ),"Return the arrays that contain the displacements, velocities and accelerations of the nodes (None if useNodalStateStore is false).")
+  .add_property("useObjectArena", &XC::Mesh::getUseObjectArena, &XC::Mesh::setUseObjectArena,"If true the elements created by the meshers and their materials are allocated from the memory arena of the mesh.")
+  .add_property("objectArena", make_function(&XC::Mesh::getObjectArenaRef, return_internal_reference<>()),"Return the memory arena of the mesh.")
+  .add_property("useSharedElementMatrices", &XC::Mesh::getUseSharedElementMatrices, &XC::Mesh::setUseSharedElementMatrices,"If true the identical linear elements (ShellMITC4 with linear transformation and elastic sections, Brick with elastic isotropic materials) share their stiffness and mass matrices.")
+  .def("clearSharedElementMatrices", &XC::Mesh::clearSharedElementMatrices,"Discards the matrices shared by the elements (must be called after modifying their materials).")
+  .add_property("getNumSharedElementMatrices", &XC::Mesh::getNumSharedElementMatrices,"Return the number of matrices shared by the elements.")
+  .add_property("getNumSharedElementMatricesHits", &XC::Mesh::getNumSharedElementMatricesHits,"Return the number of times an element has found its matrix already computed.")
+  .def("getElementPartitions", &XC::Mesh::getElementPartitionsPy,"getElementPartitions(partitioner, numParts): partition the element graph (weighted with the element costs) and return a dictionary with the part (1 through numParts) assigned to each element tag.")
   .def("setDeadSRF",XC::Mesh::setDeadSRF,"Assigns Stress Reduction Factor for element deactivation. Syntax: setDeadSRF(factor)")
   .staticmethod("setDeadSRF")
   ;
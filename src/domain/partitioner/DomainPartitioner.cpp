@@ -89,6 +89,9 @@
 #include <utility/tagged/storage/MapOfTaggedObjects.h>
 #include "domain/mesh/element/utils/NodePtrsWithIDs.h"
 #include "NodeLocations.h"
+#include "domain/mesh/Mesh.h"
+#include <algorithm>
+#include <map>
 
 //! @brief Constructor.
 //! 
@@ -98,7 +101,8 @@
 //! currently set at 8. 
 XC::DomainPartitioner::DomainPartitioner(GraphPartitioner &theGraphPartitioner)
 :myDomain(0),thePartitioner(theGraphPartitioner),theBalancer(0),
- theElementGraph(0), theBoundaryElements(0), theNodeLocations(0), elementPlace(0), numPartitions(0), partitionFlag(false), usingMainDomain(false)
+ theElementGraph(0), theBoundaryElements(0), theNodeLocations(0), elementPlace(0), numPartitions(0), partitionFlag(false), usingMainDomain(false),
+ imbalanceThreshold(1.1)
   {}
 
 //! @brief Constructor.
@@ -111,7 +115,8 @@ XC::DomainPartitioner::DomainPartitioner(GraphPartitioner &theGraphPartitioner)
 XC::DomainPartitioner::DomainPartitioner(GraphPartitioner &theGraphPartitioner,
                                  LoadBalancer &theLoadBalancer)
 :myDomain(0),thePartitioner(theGraphPartitioner),theBalancer(&theLoadBalancer),
- theElementGraph(0), theBoundaryElements(0),theNodeLocations(0), elementPlace(0), numPartitions(0), partitionFlag(false), usingMainDomain(false)
+ theElementGraph(0), theBoundaryElements(0),theNodeLocations(0), elementPlace(0), numPartitions(0), partitionFlag(false), usingMainDomain(false),
+ imbalanceThreshold(1.1)
   {
     // set the links the loadBalancer needs
     theLoadBalancer.setLinks(*this);
@@ -577,7 +582,9 @@ int XC::DomainPartitioner::partition(int numParts, bool usingMain, int mainParti
 //! Method which invokes {\em setPartitioner(this)} on the
 //! LoadBalancingAlgo. It then invokes {\em balance(load)} on this
 //! object, where \p load is vector of size \p numParts
-//! containing the load of each subdomain. 
+//! containing the load of each subdomain. While the element
+//! migration is disabled (see swapVertex) the subdomains are
+//! not modified; only the imbalance is measured and reported.
 int XC::DomainPartitioner::balance(Graph &theWeightedPGraph)
   {
     int res = 0;
@@ -594,9 +601,38 @@ int XC::DomainPartitioner::balance(Graph &theWeightedPGraph)
 
     if(theBalancer)
       {
+        // if the element costs have been measured, the load of each
+        // subdomain is the sum of the costs of its elements.
+        const bool measured= updateElementWeights();
+        std::vector<double> loads(numPartitions,0.0);
+        if(measured)
+          {
+            loads= getPartitionCosts();
+            VertexIter &theVertices= theWeightedPGraph.getVertices();
+            Vertex *vertexPtr= nullptr;
+            while((vertexPtr= theVertices()) != 0)
+              vertexPtr->setWeight(loads[vertexPtr->getTag()-1]);
+          }
+        else
+          {
+            VertexIter &theVertices= theWeightedPGraph.getVertices();
+            Vertex *vertexPtr= nullptr;
+            while((vertexPtr= theVertices()) != 0)
+              loads[vertexPtr->getTag()-1]= vertexPtr->getWeight();
+          }
+        const double imbalanceBefore= getImbalance(loads);
+        if(imbalanceBefore<=imbalanceThreshold)
+          return 0;
+
         // call on the LoadBalancer to partition
         res = theBalancer->balance(theWeightedPGraph);
 
+        std::clog << getClassName() << "::" << __FUNCTION__
+                  << "; imbalance before: " << imbalanceBefore;
+        if(measured)
+          std::clog << " after: " << getImbalance(getPartitionCosts());
+        std::clog << std::endl;
+
         // now invoke domainChanged on Subdomains and XC::PartitionedDomain
         SubdomainIter &theSubDomains = myDomain->getSubdomains();
         Subdomain *theSubDomain= nullptr;
@@ -609,6 +645,90 @@ int XC::DomainPartitioner::balance(Graph &theWeightedPGraph)
     return res;
   }
 
+//! @brief Sets the element graph weights to the element costs measured
+//! by the subdomains during the state determination (see
+//! Mesh::setElementTiming) and resets those costs. The costs are
+//! requested to the subdomains (that may be remote ones) with
+//! Subdomain::getElementCosts. Returns false if no costs have been
+//! measured.
+bool XC::DomainPartitioner::updateElementWeights(void)
+  {
+    bool retval= false;
+    // vertices of the element graph in each partition.
+    std::map<int, std::vector<Vertex *> > partitionVertices;
+    VertexIter &theVertices= theElementGraph->getVertices();
+    Vertex *vertexPtr= nullptr;
+    while((vertexPtr= theVertices()) != 0)
+      {
+        const int partition= vertexPtr->getColor();
+        if(partition!=mainPartition)
+          partitionVertices[partition].push_back(vertexPtr);
+      }
+    for(std::map<int, std::vector<Vertex *> >::const_iterator i= partitionVertices.begin(); i!=partitionVertices.end(); i++)
+      {
+        Subdomain *theSubdomain= myDomain->getSubdomainPtr(i->first);
+        const std::vector<Vertex *> &vertices= i->second;
+        const size_t sz= vertices.size();
+        ID eleTags(sz);
+        for(size_t j= 0;j<sz;j++)
+          eleTags(j)= vertices[j]->getRef();
+        const Vector costs= theSubdomain->getElementCosts(eleTags);
+        for(size_t j= 0;j<sz;j++)
+          if(costs(j)>0.0)
+            {
+              vertices[j]->setWeight(costs(j));
+              retval= true;
+            }
+      }
+    SubdomainIter &theSubDomains= myDomain->getSubdomains();
+    Subdomain *theSubDomain= nullptr;
+    while((theSubDomain= theSubDomains()) != 0)
+      theSubDomain->resetElementCosts();
+    return retval;
+  }
+
+//! @brief Return the sum of the element graph weights for each
+//! partition (partition i is at position i-1).
+std::vector<double> XC::DomainPartitioner::getPartitionCosts(void) const
+  {
+    std::vector<double> retval(numPartitions,0.0);
+    VertexIter &theVertices= theElementGraph->getVertices();
+    Vertex *vertexPtr= nullptr;
+    while((vertexPtr= theVertices()) != 0)
+      retval[vertexPtr->getColor()-1]+= vertexPtr->getWeight();
+    return retval;
+  }
+
+//! @brief Return the ratio between the maximum and the mean load.
+double XC::DomainPartitioner::getImbalance(const std::vector<double> &loads)
+  {
+    double retval= 1.0;
+    if(!loads.empty())
+      {
+        double maxLoad= 0.0;
+        double sum= 0.0;
+        for(std::vector<double>::const_iterator i= loads.begin();i!=loads.end();i++)
+          {
+            maxLoad= std::max(maxLoad,*i);
+            sum+= *i;
+          }
+        if(sum>0.0)
+          retval= maxLoad*loads.size()/sum;
+      }
+    return retval;
+  }
+
+//! @brief Set the imbalance (maximum load/mean load) that triggers the
+//! load balancing.
+void XC::DomainPartitioner::setImbalanceThreshold(const double &d)
+  { imbalanceThreshold= d; }
+
+//! @brief Return the imbalance (maximum load/mean load) that triggers the
+//! load balancing.
+double XC::DomainPartitioner::getImbalanceThreshold(void) const
+  { return imbalanceThreshold; }
+
+
 
 //! @brief Returns the number of partitions in the PartitionedDomain.
 int XC::DomainPartitioner::getNumPartitions(void) const
@@ -651,768 +771,53 @@ XC::Graph &XC::DomainPartitioner::getColoredGraph(void)
 
 //! @brief Moves a vertes from subdomain from to subdomain to.
 //!
-//! Method which will take the element given by vertex reference of the
+//! Method which would take the element given by vertex reference of the
 //! vertex whose tag is given by \p vertexTag from subdomain \p from
-//! and place it in subdomain \p to. If \p notAdjacentOther is {\em
-//! true} a check is made to ensure that the vertex to be swapped is not
-//! adjacent to a vertex in any other partition. Returns \f$0\f$ if
-//! successfull, returns an error message and \f$-1\f$ if PartitionedDomain
-//! has not been partitioned, \f$-2\f$ if \p from Subdomain does not exist,
-//! \f$-3\f$ if {\em to Subdomain} does not exist, \f$-4\f$ if a vertex given by
-//! \p tag does not exist, returns \f$-5\f$ if \p notAdjacentOther was
-//! true and the vertex was adjacent to a vertex in another partition, and
-//! returns \f$-6\f$ if no Element with a tag similar to \p tag exists
-//! (this should not happen if element graph is built correctly).
-//! The Element, Nodes, NodalLoads, SFreedom\_Constraints and MP\_Constraints
-//! that need to be moved between the two Subdomains, or between the
-//! PartitionedDomain and Subdomains are also moved. NO ELEMENTAL LOADS 
-//! are moved yet.
+//! and place it in subdomain \p to. The migration of the elements
+//! (with their nodes, constraints and loads) between subdomains is
+//! disabled until it can be checked against an unpartitioned
+//! solution, so it returns \f$-8\f$ and the load balancing only
+//! measures and reports the imbalance (see balance).
 int XC::DomainPartitioner::swapVertex(int from, int to, int vertexTag, bool adjacentVertexNotInOther)
   {
     std::cerr << getClassName() << "::" << __FUNCTION__
-	      << "() " << from << " " << to << " " << vertexTag
-	      << std::endl;
-
-    /*
-    // check that the object did the partitioning
-    if (partitionFlag == false) {
-      std::cerr << getClassName() << "::" << __FUNCTION__
-		<< "(const XC::Vector &load)"
-                << "; not partitioned or DomainPartitioner did not partition.\n";
-      return -1;
-    }
-
-    // check that the subdomain exist in partitioned domain
-    Subdomain *fromSubdomain = myDomain->getSubdomainPtr(from);
-    if (fromSubdomain == 0) {
-      std::cerr << getClassName() << "::" << __FUNCTION__
-		<< "; no from XC::Subdomain: ";
-      std::cerr << from << " exists\n";
-      return -2;
-    }
-    Subdomain *toSubdomain = myDomain->getSubdomainPtr(to);
-    if (toSubdomain == 0) {
-      std::cerr << getClassName() << "::" << __FUNCTION__
-		<< "; no to Subdomain: " << to << " exists.\n";
-      return -3;
-    }
-
-    // remove the vertex from the boundary if there
-    // if not there we have to get a pointer to it from the ele graph.
-
-    //    Graph &theEleGraph = myDomain->getElementGraph();
-    Graph *fromBoundary = theBoundaryElements[from-1];
-    Graph *toBoundary = theBoundaryElements[to-1];
-    Vertex *vertexPtr;
-
-    // get a pointer to the vertex in the element graph
-    if (adjacentVertexNotInOther  == false) {
-      vertexPtr = fromBoundary->removeVertex(vertexTag,false);
-      if (vertexPtr == 0)
-	vertexPtr = theElementGraph->getVertexPtr(vertexTag);
-
-      if (vertexPtr == 0)  // if still 0 no vertex given by tag exists
-	return -4;
-    } else { // get a pointer and check vertex not adjacent to another partition
-      vertexPtr = fromBoundary->getVertexPtr(vertexTag);
-      if (vertexPtr == 0)
-	vertexPtr = theElementGraph->getVertexPtr(vertexTag);
-      if (vertexPtr == 0)  // if still 0 no vertex given by tag exists
-	return -4;
-      const std::set<int> &adjacent= vertexPtr->getAdjacency();
-      bool inTo = false;
-      bool inOther = false;
-      int adjacentSize = adjacent.size();
-      for(std::set<int>::const_iterator i= adjacent.begin(); i!= adjacent.end(); i++)
-	{
-	Vertex *other = theElementGraph->getVertexPtr(*i);
-	if (other->getColor() == to)
-	  inTo = true;
-	else if (other->getColor() != from) {
-	  inOther = true;
-	  i = adjacentSize;
-	}
-      }
-      if (inTo != true || inOther == true) // we cannot remove the vertex
-	return -5;
-      // if can remove the vertex from the fromBoundary
-      Vertex *theVertex = fromBoundary->removeVertex(vertexTag,false);
-    }
-
-    int eleTag = vertexPtr->getRef();
-
-    //
-    // in the FROM subdomain we:
-    //  1. remove the element
-    //  2. remove all nodes connected to the element divide color by prime
-    //  3. see if have to add nodes back as external
-    //  4. remove from the XC::PartitionedDomain if node was external
-    //  5. add new_ elements to the boundary vertices for from
-
-    //  1. remove the element from the fromSubdomain
-      //          this gives us a pointer to the element as well.
-
-      Element *elePtr = fromSubdomain->removeElement(eleTag);
-      if (elePtr == 0) // if ele not there we can just return but ERROR it should be
-    return -6;
-
-      //  2. remove all nodes connected to the element divide color by prime
-      //  3. add back if still in subdomain
-      //  4. if node external remove from PartitionedDomains external nodes
-      int primeFrom = primes(from);
-      const XC::ID  &nodes1 = elePtr->getNodePtrs().getExternalNodes(); // create a copy, need after send ele
-      ID  nodes(nodes1);
-
-      int nodesSize = nodes.Size();
-      std::vector<Node *> nodesArray(nodesSize);
-      for (int i=0; i<nodesSize; i++) {
-    int nodeTag = nodes(i);
-
-    // remove the node
-    Node *nodePtr = fromSubdomain->removeNode(nodeTag);
-
-    (*nodePlace)(nodeTag) /= primeFrom;
-    nodesArray[i] = nodePtr;
-	  // std::cerr << getClassName() << "::" << __FUNCTION__
-		       << "; NODE " << *nodePtr;
-    // add back as external if still needed
-    if ((*nodePlace)(nodeTag)%primeFrom == 0)
-	fromSubdomain->addExternalNode(nodePtr);
-
-    // if it was external remove from PartitionedDomains external nodes
-    int partition = (*nodePlace)(nodeTag);
-    for (int j=1; j<=numPartitions; j++)
-	if (j != from) {
-      int prime = primes(j);
-      if (partition%prime == 0) {
-	  myDomain->removeExternalNode(nodeTag);
-	  j = numPartitions+1;
-      }
-	}
-      }
-
-      // 5. add new_ elements to boundary vertices of from if connected to
-      //    vertex we just removed and of color of from and not already in boundary
-
-      const std::set<int> &eleAdjacent= vertexPtr->getAdjacency();
-      int eleAdjacentSize = eleAdjacent.size();
-
-      for(std::set<int>::const_iterator a= eleAdjacent.begin(); a!= eleAdjacent.end(); a++)
-	{
-	  int otherEleVertexTag= *a;
-	  Vertex *other = fromBoundary->getVertexPtr(otherEleVertexTag);
-	  if (other == 0) {
-	      other = theElementGraph->getVertexPtr(otherEleVertexTag);
-	      if (other->getColor() == from)
-		  fromBoundary->addVertex(other,false);
-	  }
-      }
-
-
-
-      // in the TO subdomain we:
-      //  1. remove all nodes connected to the element, may or may not be there
-      //     if there don't divide by primeTo.
-      //  2. mark all connecting nodes of elements as belonging to To
-      //  3. add the nodes, checking if external or internal
-      //  3. add the element
-      //  4. change the vertex color to be to and add vertex to boundary
-      //     also see if we can reduce the size of boundary
-      //     of boundary of to vertices
-
-      //  1. remove all nodes connected to the element, may or may not be there
-      //      if there divide by primeTo, do this as may have been added as extnl
-      int primeTo = primes(to);
-      for (int l=0; l<nodesSize; l++) {
-    int nodeTag = nodesArray[l]->getTag();
-    int nodeColor = (*nodePlace)(nodeTag);
-    if (nodeColor % primeTo == 0) {
-	Node *nodePtr;
-	nodePtr = toSubdomain->removeNode(nodes(l));
-    }
-      }
-
-
-      for (int m=0; m<nodesSize; m++) {
-    Node *nodePtr = nodesArray[m];
-    int nodeTag = nodePtr->getTag();
-
-    //  2. mark all connecting nodes of elements as belonging to To
-    (*nodePlace)(nodeTag) *= primeTo;
-
-    //  3. add the nodes, checking if external or internal
-    int internal = 0;
-    for (int n=1; n<=numPartitions; n++)
-	if (n != to) {
-      int prime = primes(n);
-      if ((*nodePlace)(nodeTag)%prime == 0) { // its external
-	  internal = 1;
-	  n = numPartitions+1;
-      }
-	}
-
-    if (internal == 0)
-	toSubdomain->addNode(nodePtr);
-    else {
-	toSubdomain->addExternalNode(nodePtr);
-	myDomain->addNode(nodePtr);
-    }
-      }
-
-      delete [] nodesArray; // DELETE nodesArray here should not use nodePtrs
-			    // after here as node objects deleted if parallel
-
-      //  3. add the element
-
-      toSubdomain->addElement(elePtr);
-
-      //  4. change the vertex color to be to and add vertex to boundary
-      //     also see if we can reduce the size of to's boundary vertices
-
-
-      vertexPtr->setColor(to);
-      toBoundary->addVertex(vertexPtr,false);
-
-      for (int n=0; n<eleAdjacentSize; n++) {
-	  int otherEleVertexTag = eleAdjacent(n);
-	  Vertex *other = toBoundary->removeVertex(otherEleVertexTag,false);
-	  if (other != 0) {
-	      const std::set<int> &othersAdjacency= other->getAdjacency();
-	      int otherSize = othersAdjacency.size();
-	      for(std::set<int>::const_iterator b= othersAdjacency.begin(); b!=othersAdjacency.end(); b++)
-		 {
-		    int anotherEleVertexTag= *b;
-		  Vertex *otherOther = theElementGraph->getVertexPtr(anotherEleVertexTag);
-		  if(otherOther->getColor() != to)
-		    {
-		      toBoundary->addVertex(other,false);
-		      b=otherSize;
-		  }
-	      }
-	  }
-      }
-
-
-      // now remove any SFreedom_Constraints that may have been external to
-      // PartitionedDomain and are now internal to toSubdomain
-      SFreedom_ConstraintIter &theSPs = myDomain->getSPs();
-      SFreedom_Constraint *spPtr;
-      while ((spPtr = theSPs()) != 0) {
-    int nodeTag = spPtr->getNodeTag();
-    for (int i=0; i<nodesSize; i++) {
-	if (nodeTag == nodes(i)) {
-      int internal = 0;
-      for (int j=1; j<=numPartitions; j++)
-	  if (j != to) {
-	int prime = primes(j);
-	if ((*nodePlace)(nodeTag)%prime == 0) {
-	    internal = 1;
-	    j = numPartitions+1;
-	}
-	  }
-      if (internal == 0) { // add to toSubdomain if inteernal
-	  myDomain->removeSFreedom_Constraint(spPtr->getTag());
-	  toSubdomain->addSFreedom_Constraint(spPtr);
-      }
-	}
-    }
-      }
-
-
-
-      // now remove any SFreedom_Constraints that may have been internal to fromSubdomain
-      // and are now external to XC::PartitionedDomain or internal to toSubdomain
-      SFreedom_ConstraintIter &theSPs2 = fromSubdomain->getSPs();
-      while ((spPtr = theSPs2()) != 0) {
-    int nodeTag = spPtr->getNodeTag();
-    for (int i=0; i<nodesSize; i++) {
-	if (nodeTag == nodes(i)) {
-      fromSubdomain->removeSFreedom_Constraint(spPtr->getTag());
-      int internal = 0;
-      for (int j=1; j<=numPartitions; j++)
-	  if (j != to) {
-	int prime = primes(j);
-	if ((*nodePlace)(nodeTag)%prime == 0) {
-	    internal = 1;
-	    j = numPartitions+1;
-	}
-	  }
-      if (internal == 0)
-	  toSubdomain->addSFreedom_Constraint(spPtr);
-      else
-	  myDomain->addSFreedom_Constraint(spPtr);
-	}
-    }
-      }
-
-
-
-    */
-      /*
-      // now remove any NodalLoads that may have been external to
-      // PartitionedDomain and are now internal to toSubdomain
-      NodalLoadIter &theNodalLoads = myDomain->getNodalLoads();
-      NodalLoad *loadPtr;
-      while ((loadPtr = theNodalLoads()) != 0) {
-    int nodeTag = loadPtr->getNodeTag();
-    for (int i=0; i<nodesSize; i++) {
-	if (nodeTag == nodes(i)) {
-      int internal = 0;
-      for (int j=1; j<=numPartitions; j++)
-	  if (j != to) {
-	int prime = primes(j);
-	if ((*nodePlace)(nodeTag)%prime == 0) {
-	    internal = 1;
-	    j = numPartitions+1;
-	}
-	  }
-      if (internal == 0) { // add to toSubdomain if inteernal
-	  myDomain->removeNodalLoad(loadPtr->getTag());
-	  toSubdomain->addNodalLoad(loadPtr);
-      }
-	}
-    }
-      }
-
+              << "; element migration is disabled (vertex: "
+              << vertexTag << " from: " << from << " to: " << to
+              << ")." << std::endl;
+    return -8;
+  }
 
-      // now remove any NodalLoads that may have been internal to fromSubdomain
-      // and are now external to XC::PartitionedDomain or internal to toSubdomain
-
-      NodalLoadIter &theNodalLoads2 = myDomain->getNodalLoads();
-      while ((loadPtr = theNodalLoads2()) != 0) {
-    int nodeTag = loadPtr->getNodeTag();
-    for (int i=0; i<nodesSize; i++) {
-	if (nodeTag == nodes(i)) {
-      fromSubdomain->removeNodalLoad(loadPtr->getTag());
-      int internal = 0;
-      for (int j=1; j<=numPartitions; j++)
-	  if (j != to) {
-	int prime = primes(j);
-	if ((*nodePlace)(nodeTag)%prime == 0) {
-	    internal = 1;
-	    j = numPartitions+1;
-	}
-	  }
-      if (internal == 0)
-	  toSubdomain->addNodalLoad(loadPtr);
-      else
-	  myDomain->addNodalLoad(loadPtr);
-	}
-    }
+//! @brief Moves the vertex as swapVertex(from,to,vertexTag,adjacentVertexNotInOther)
+//! and transfers its weight (the element cost) from the \p from
+//! vertex to the \p to vertex of the weighted partition graph.
+int XC::DomainPartitioner::swapVertex(int from, int to, int vertexTag, Graph &theWeightedPartitionGraph, bool adjacentVertexNotInOther)
+  {
+    const int retval= swapVertex(from,to,vertexTag,adjacentVertexNotInOther);
+    if(retval==0)
+      {
+        const double w= theElementGraph->getVertexPtr(vertexTag)->getWeight();
+        Vertex *fromVertex= theWeightedPartitionGraph.getVertexPtr(from);
+        Vertex *toVertex= theWeightedPartitionGraph.getVertexPtr(to);
+        if(fromVertex && toVertex)
+          {
+            fromVertex->setWeight(fromVertex->getWeight()-w);
+            toVertex->setWeight(toVertex->getWeight()+w);
+          }
       }
-      */
-
-    return 0;
-
+    return retval;
   }
 
-
-
 //! @brief Method to move from from to to, all elements on the interface of
 //! from that are adjacent with to.
 //! 
-//! Method which when invoked will take all the boundary elements in
-//! subdomain \p from that are connected to elements in subdomain {\em
-//! to} and place them in subdomain \p to. If \p adjacentVertexOther is
-//! \p true no Elements which are connected to elements in subdomains other 
-//! than \p to and \p from are moved. Returns \f$0\f$ if successfull, returns 
-//! an error message and \f$-1\f$ if PartitionedDomain has not been partitioned,
-//! \f$-2\f$ if \p from Subdomain does not exist, \f$-3\f$ if {\em to Subdomain}
-//! does not exist. The Elements, Nodes, NodalLoads, SFreedom\_Constraints
-//! and MP\_Constraints that need to be moved between the two Subdomains,
-//! or between the PartitionedDomain and Subdomains are also moved. NO
-//! ELEMENTAL LOADS are moved yet. It performs the operation by creating
-//! an ID of vertices and then using code similar to that used in {\em
-//! swapVertex()}; swapVErtex() is not called repeatedly as this was
-//! found to be too slow. 
+//! Element migration is disabled (see swapVertex), so it returns \f$-8\f$.
 int XC::DomainPartitioner::swapBoundary(int from, int to, bool adjacentVertexNotInOther)
   {
     std::cerr << getClassName() << "::" << __FUNCTION__
-	      << "; from "  << from << " to " << to << std::endl;
-  /***********************************************************************************
-    std::cerr << getClassName() << "::" << __FUNCTION__
-              << " from " << from << "  to " << to << std::endl;
-    Timer timer;
-    timer.start();
-
-    // check that the object did the partitioning
-    if (partitionFlag == false) {
-  std::cerr << getClassName() << "::" << __FUNCTION__
-            << "(const XC::Vector &load)"
-            << "; not partitioned or DomainPartitioner did not partition.\n";
-  return -1;
-    }
-
-    // check that the subdomains exist in partitioned domain
-    Subdomain *fromSubdomain = myDomain->getSubdomainPtr(from);
-    if (fromSubdomain == 0) {
-  std::cerr << getClassName() << "::" << __FUNCTION__
-            << "; no from subdomain: "
-            << from << " exists.\n";
-  return -2;
-    }
-
-    Subdomain *toSubdomain = myDomain->getSubdomainPtr(to);
-    if (toSubdomain == 0) {
-  std::cerr << getClassName() << "::" << __FUNCTION__
-            << "; no to subdomain: " << to << " exists\n";
-  return -3;
-    }
-
-    // get the element graph
-    //    Graph &theEleGraph = myDomain->getElementGraph();
-    Graph *fromBoundary = theBoundaryElements[from-1];
-    Graph *toBoundary = theBoundaryElements[to-1];
-
-    // into a new_ graph place the vertices that are to be swapped
-    Graph swapVertices(fromBoundary->getNumVertex());
-
-    VertexIter &swappableVertices = fromBoundary->getVertices();
-    Vertex *vertexPtr;
-
-    while ((vertexPtr = swappableVertices()) != 0) {
-        if (adjacentVertexNotInOther == false) {
-            const std::set<int> &adjacency= vertexPtr->getAdjacency();
-            const int size= adjacency.size();
-            for(std::set<int>::const_iterator i= adjacency.begin(); i!=adjacency.end(); i++)
-              {
-                int otherTag= *i;
-                Vertex *otherVertex = toBoundary->getVertexPtr(otherTag);
-                if (otherVertex != 0) {
-                    swapVertices->addVertex(vertexPtr,false);
-                    i = size;
-                }
-            }
-        }
-        else
-          {
-            const std::set<int> &adjacent= vertexPtr->getAdjacency();
-            bool inTo = false;
-            bool inOther = false;
-            int adjacentSize = adjacent.Size();
-            for(std::set<int>::const_iterator i=adjacent.begin(); i!=adjacent.end(); i++)
-              {
-                Vertex *other = theElementGraph->getVertexPtr(*i);
-                if (other->getColor() == to)
-                    inTo = true;
-                else if (other->getColor() != from) {
-                    inOther = true;
-                    i = adjacentSize;
-                }
-            }
-            if (inTo == true && inOther == false) { // we remove the vertex
-                swapVertices->addVertex(vertexPtr,false);
-                vertexPtr->setColor(to);
-            }
-        }
-    }
-
-    //
-    // in the FROM subdomain we:
-    //  1. remove the elements corresponding to the vertices
-    //  2. remove all nodes connected to the elements divide color by prime
-    //  3. see if have to add nodes back as external
-    //  4. remove from the XC::PartitionedDomain if node was external
-    //  5. add new_ elements to the boundary vertices for from
-
-    // 1. first remove all the elements from from subdomain
-    VertexIter &verticesToSwap = swapVertices->getVertices();
-
-    int numEleToSwap = swapVertices->getNumVertex();
-    std::vector<Element *> elementsArray(numEleToSwap);
-
-    int count =0;
-    int numCannotRemove =0;
-    for (int i=0; i<numEleToSwap; i++) {
-      vertexPtr = verticesToSwap();
-  if (vertexPtr == 0)
-      return -1;
-
-  int vertexTag = vertexPtr->getTag();
-  int eleTag = vertexPtr->getRef();
-
-  // remove the vertex from fromBoundary, set color to to
-  // and add to toBoundary
-  bool inFrom = true;
-  vertexPtr = fromBoundary->removeVertex(vertexTag,false);
-
-
-  if (inFrom == true) {
-      vertexPtr->setColor(to);
-      toBoundary->addVertex(vertexPtr,false);
-      Element *elePtr = fromSubdomain->removeElement(eleTag);
-      if (elePtr == 0) // if ele not there we can just return IT SHOULD BE
-    return -4;
-      elementsArray[count] = elePtr;
-      count++;
-  }
-  else  // we cannot remove the element
-      numCannotRemove++;
-    }
-    numEleToSwap -= numCannotRemove;
-
-    //  2. remove all nodes connected to the elements divide color by prime
-    //     for each element and add back if still in subdomain
-    //  3. add back if still in subdomain
-    //  4. if node external remove from PartitionedDomains external nodes
-
-    // first determine which nodes to remove
-    int primeFrom = primes(from);
-    int primeTo = primes(to);
-    int numNodToSwap = 0;
-    ID nodesToRemove(0,128);
-    for (int j=0; j<numEleToSwap; j++) {
-  Element *elePtr = elementsArray[j];
-  const XC::ID  &nodes = elePtr->getNodePtrs().getExternalNodes();
-
-  int nodesSize = nodes.Size();
-
-  for (int k=0; k<nodesSize; k++) {
-      int nodeTag = nodes(k);
-      int loc = nodesToRemove.getLocation(nodeTag);
-      if (loc < 0) {
-    nodesToRemove[numNodToSwap] = nodeTag;
-    numNodToSwap++;
-      }
-      (*nodePlace)(nodeTag) /= primeFrom;
-      (*nodePlace)(nodeTag) *= primeTo;
+              << "; element migration is disabled (from: " << from
+              << " to: " << to << ")." << std::endl;
+    return -8;
   }
-    }
-
-    // remove the nodes
-    std::vector<Node *> nodesArray(numNodToSwap);
-    for (int k=0; k<numNodToSwap; k++) {
-  int nodeTag = nodesToRemove(k);
-  Node *nodePtr = fromSubdomain->removeNode(nodeTag);
-  nodesArray[k] = nodePtr;
-
-  // add the node back to from if still external
-  if ((*nodePlace)(nodeTag)%primeFrom == 0)
-      fromSubdomain->addExternalNode(nodePtr);
-
-  // if it was external remove from PartitionedDomains external nodes
-  int partition = (*nodePlace)(nodeTag);
-  for (int j=1; j<=numPartitions; j++)
-      if (j != from) {
-    int prime = primes(j);
-    if (partition%prime == 0) {
-        myDomain->removeExternalNode(nodeTag);
-        j = numPartitions+1;
-    }
-      }
-    }
-
-    // 5. add new_ vertices to boundary vertices of from if connected to
-    //    vertex we just removed and of color of from and not already in boundary
-
-    VertexIter &verticesToSwap2 = swapVertices->getVertices();
-    while ((vertexPtr = verticesToSwap2()) != 0) {
-  const std::set<int> &vertexAdjacent= vertexPtr->getAdjacency();
-  int vertexAdjacentSize = vertexAdjacent.size();
-
-        for(std::set<int>::const_iterator a=vertexAdjacent.begin(); a!=vertexAdjacent.end(); a++)
-          {
-            const int otherEleVertexTag= *a;
-            Vertex *other = fromBoundary->getVertexPtr(otherEleVertexTag);
-            if (other == 0) {
-                other = theElementGraph->getVertexPtr(otherEleVertexTag);
-                if (other->getColor() == from)
-                    fromBoundary->addVertex(other,false);
-            }
-        }
-    }
-
-
-    // in the TO subdomain we:
-    //  1. remove all nodes connected to the element, may or may not be there
-    //     if there don't divide by primeTo.
-    //  2. mark all connecting nodes of elements as belonging to To
-    //  3. add the nodes, checking if external or internal
-    //  3. add the element
-    //  4. change the vertex color to be to and add vertex to boundary
-    //     also see if we can reduce the size of boundary
-    //     of boundary of to vertices
-
-    //  1. remove all nodes connected to the element, may or may not be there
-    //      if there divide by primeTo, do this as may have been added as extnl
-
-    for (int l=0; l<numNodToSwap; l++) {
-  int nodeTag = nodesArray[l]->getTag();
-  Node *nodePtr;
-  nodePtr = toSubdomain->removeNode(nodesToRemove(l));
-    }
-
-
-    for (int m=0; m<numNodToSwap; m++) {
-  Node *nodePtr = nodesArray[m];
-  int nodeTag = nodePtr->getTag();
-
-  //  3. add the nodes, checking if external or internal
-  int internal = 0;
-  for (int n=1; n<=numPartitions; n++)
-      if (n != to) {
-    int prime = primes(n);
-    if ((*nodePlace)(nodeTag)%prime == 0) { // its external
-        internal = 1;
-        n = numPartitions+1;
-    }
-      }
-
-  if (internal == 0)
-      toSubdomain->addNode(nodePtr);
-  else {
-      toSubdomain->addExternalNode(nodePtr);
-      myDomain->addNode(nodePtr);
-  }
-    }
-
-
-    delete [] nodesArray; // DELETE nodesArray here should not use nodePtrs
-                          // after here as node objects deleted if parallel
-
-    //  3. add the elements
-    for (int a=0; a<numEleToSwap; a++)
-  toSubdomain->addElement(elementsArray[a]);
-
-
-    //  4. change the vertex color to be to and add vertex to boundary
-    //     also see if we can reduce the size of to's boundary vertices
-
-    VertexIter &verticesToSwap3 = swapVertices->getVertices();
-    while ((vertexPtr = verticesToSwap3()) != 0) {
-        const std::set<int> &vertexAdjacent= vertexPtr->getAdjacency();
-        int vertexAdjacentSize= vertexAdjacent.size();
-        for(std::set<int>::const_iterator n= vertexAdjacent.begin(); n!=vertexAdjacent.end(); n++)
-          {
-            const int otherEleVertexTag= *n;
-            Vertex *other = toBoundary->removeVertex(otherEleVertexTag,false);
-            if (other != 0) {
-                const std::set<int> &othersAdjacency = other->getAdjacency();
-                int otherSize = othersAdjacency.Size();
-                for(std::set<int>::const_iterator b= othersAdjacency.begin(); b!=othersAdjacency.end(); b++)
-                   {
-                    int anotherEleVertexTag = *b;
-                    Vertex *otherOther
-                        = theElementGraph->getVertexPtr(anotherEleVertexTag);
-                    if (otherOther->getColor() != to) {
-                        toBoundary->addVertex(other,false);
-                        b=otherSize;
-                    }
-                }
-            }
-        }
-    }
-
-    // now remove any SFreedom_Constraints that may have been external to
-    // PartitionedDomain and are now internal to toSubdomain
-    SFreedom_ConstraintIter &theSPs = myDomain->getSPs();
-    SFreedom_Constraint *spPtr;
-    while ((spPtr = theSPs()) != 0) {
-  int nodeTag = spPtr->getNodeTag();
-  int loc = nodesToRemove.getLocation(nodeTag);
-  if (loc >= 0) {
-      int internal = 0;
-      for (int j=1; j<=numPartitions; j++)
-    if (j != to) {
-        int prime = primes(j);
-        if ((*nodePlace)(nodeTag)%prime == 0) {
-      internal = 1;
-      j = numPartitions+1;
-        }
-    }
-      if (internal == 0) { // add to toSubdomain if inteernal
-    myDomain->removeSFreedom_Constraint(spPtr->getTag());
-    toSubdomain->addSFreedom_Constraint(spPtr);
-      }
-  }
-    }
-
-
-    // now remove any SFreedom_Constraints that may have been internal to fromSubdomain
-    // and are now external to XC::PartitionedDomain or internal to toSubdomain
-    SFreedom_ConstraintIter &theSPs2 = fromSubdomain->getSPs();
-    while ((spPtr = theSPs2()) != 0) {
-  int nodeTag = spPtr->getNodeTag();
-  int loc = nodesToRemove.getLocation(nodeTag);
-  if (loc >= 0) {
-      fromSubdomain->removeSFreedom_Constraint(spPtr->getTag());
-      int internal = 0;
-      for (int j=1; j<=numPartitions; j++)
-    if (j != to) {
-        int prime = primes(j);
-        if ((*nodePlace)(nodeTag)%prime == 0) {
-      internal = 1;
-      j = numPartitions+1;
-        }
-    }
-      if (internal == 0)
-    toSubdomain->addSFreedom_Constraint(spPtr);
-      else
-    myDomain->addSFreedom_Constraint(spPtr);
-  }
-    }
-
-    // now remove any NodalLoads that may have been external to
-    // PartitionedDomain and are now internal to toSubdomain
-    NodalLoadIter &theNodalLoads = myDomain->getNodalLoads();
-    NodalLoad *loadPtr;
-    while ((loadPtr = theNodalLoads()) != 0) {
-  int nodeTag = loadPtr->getNodeTag();
-  int loc = nodesToRemove.getLocation(nodeTag);
-  if (loc >= 0) {
-
-      int internal = 0;
-      for (int j=1; j<=numPartitions; j++)
-    if (j != to) {
-        int prime = primes(j);
-        if ((*nodePlace)(nodeTag)%prime == 0) {
-      internal = 1;
-      j = numPartitions+1;
-        }
-    }
-      if (internal == 0) { // add to toSubdomain if inteernal
-    myDomain->removeNodalLoad(loadPtr->getTag());
-    toSubdomain->addNodalLoad(loadPtr);
-      }
-  }
-    }
-
-
-    // now remove any NodalLoads that may have been internal to fromSubdomain
-    // and are now external to XC::PartitionedDomain or internal to toSubdomain
-
-    NodalLoadIter &theNodalLoads2 = myDomain->getNodalLoads();
-    while ((loadPtr = theNodalLoads2()) != 0) {
-  int nodeTag = loadPtr->getNodeTag();
-  int loc = nodesToRemove.getLocation(nodeTag);
-  if (loc >= 0) {
-      fromSubdomain->removeNodalLoad(loadPtr->getTag());
-      int internal = 0;
-      for (int j=1; j<=numPartitions; j++)
-    if (j != to) {
-        int prime = primes(j);
-        if ((*nodePlace)(nodeTag)%prime == 0) {
-      internal = 1;
-      j = numPartitions+1;
-        }
-    }
-      if (internal == 0)
-    toSubdomain->addNodalLoad(loadPtr);
-      else
-    myDomain->addNodalLoad(loadPtr);
-  }
-    }
-
-
-    delete swapVertices;
-
-    timer.pause();
-    std::cerr << getClassName() << "::" << __FUNCTION__
-              << " DONE" << timer.getReal() << std::endl;
-
-  ***************************************************************************/
-    return 0;
-}
 
 
 //! Method which when invoked will take the element given by vertex
@@ -1492,7 +897,7 @@ int XC::DomainPartitioner::releaseVertex(int from,
 
   // swap the vertex
   if (mustReleaseToLighter == false)
-    return swapVertex(from, partition, vertexTag, adjacentVertexNotInOther);
+    return swapVertex(from, partition, vertexTag, theWeightedPartitionGraph, adjacentVertexNotInOther);
 
   else { // check the other partition has a lighter load
     Vertex *fromVertex = theWeightedPartitionGraph.getVertexPtr(from);
@@ -1508,9 +913,9 @@ int XC::DomainPartitioner::releaseVertex(int from,
     if (fromWeight >= toWeight)
       {
       if (toWeight == 0.0)
-        return swapVertex(from,partition,vertexTag,adjacentVertexNotInOther);
+        return swapVertex(from,partition,vertexTag,theWeightedPartitionGraph,adjacentVertexNotInOther);
       if (fromWeight/toWeight > factorGreater)
-        return swapVertex(from,partition,vertexTag,adjacentVertexNotInOther);
+        return swapVertex(from,partition,vertexTag,theWeightedPartitionGraph,adjacentVertexNotInOther);
     }
   }
 
@@ -62,6 +62,7 @@
 
 #include <utility/matrix/ID.h>
 #include "xc_utils/src/kernel/CommandEntity.h"
+#include <set>
 
 namespace XC {
 class GraphPartitioner;
@@ -69,6 +70,9 @@ class LoadBalancer;
 class PartitionedDomain;
 class Vector;
 class Graph;
+class Vertex;
+class Domain;
+class Subdomain;
 class TaggedObjectStorage;
 
 //! @ingroup Dom
@@ -102,8 +106,10 @@ class DomainPartitioner: public CommandEntity
     
     bool usingMainDomain;
     int mainPartition;
+    double imbalanceThreshold; //!< imbalance (maximum load/mean load) that triggers the load balancing.
 
     int inic(const size_t &);
+    bool updateElementWeights(void);
   public:   
     DomainPartitioner(GraphPartitioner &theGraphPartitioner,
     		      LoadBalancer &theLoadBalancer);
@@ -114,6 +120,10 @@ class DomainPartitioner: public CommandEntity
     virtual int partition(int numParts, bool useMainDomain = false, int mainPartition = 0);
 
     virtual int balance(Graph &theWeightedSubdomainGraph);
+    std::vector<double> getPartitionCosts(void) const;
+    static double getImbalance(const std::vector<double> &);
+    void setImbalanceThreshold(const double &);
+    double getImbalanceThreshold(void) const;
 
     // public member functions needed by the load balancer
     virtual int getNumPartitions(void) const;
@@ -124,6 +134,9 @@ class DomainPartitioner: public CommandEntity
 			    int to, 
 			    int vertexTag,
 			    bool adjacentVertexNotInOther = true);
+    int swapVertex(int from, int to, int vertexTag,
+                   Graph &theWeightedPartitionGraph,
+                   bool adjacentVertexNotInOther = true);
 
     virtual int	 swapBoundary(int from, 
 			      int to,
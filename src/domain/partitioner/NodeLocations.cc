@@ -45,3 +45,10 @@ int XC::NodeLocations::addPartition(int partition)
     numPartitions= nodePartitions.size();
     return 0;
   }
+
+int XC::NodeLocations::removePartition(int partition)
+  {
+    nodePartitions.erase(partition);
+    numPartitions= nodePartitions.size();
+    return 0;
+  }
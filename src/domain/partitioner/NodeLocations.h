@@ -43,6 +43,7 @@ class NodeLocations: public TaggedObject
     NodeLocations(int tag);
     void Print(std::ostream &s, int flag =0);
     int addPartition(int partition);
+    int removePartition(int partition);
   };
 } //namespace XC
 
@@ -63,6 +63,7 @@
 #include "preprocessor/prep_handlers/MaterialHandler.h"
 #include "utility/matrix/Vector.h"
 #include "utility/matrix/ID.h"
+#include "utility/ObjectArena.h"
 
 //! @brief Constructor.
 //!
@@ -73,6 +74,15 @@
 XC::Material::Material(int tag, int clasTag)
   :TaggedObject(tag), MovableObject(clasTag) {}
 
+//! @brief Allocates the material from the current memory arena
+//! (see ObjectArena).
+void *XC::Material::operator new(size_t sz)
+  { return ObjectArena::allocate(sz); }
+
+//! @brief Returns the memory of the material to its arena.
+void XC::Material::operator delete(void *p,size_t sz)
+  { ObjectArena::deallocate(p,sz); }
+
 //! @brief Returns (if possible) a pointer to the material handler (owner).
 const XC::MaterialHandler *XC::Material::getMaterialHandler(void) const
   {
@@ -93,6 +93,9 @@ class Material: public TaggedObject, public MovableObject
   public:
     Material(int tag, int classTag);
 
+    static void *operator new(size_t);
+    static void operator delete(void *,size_t);
+
     const MaterialHandler *getMaterialHandler(void) const;
     MaterialHandler *getMaterialHandler(void);
     std::string getName(void) const;
@@ -120,6 +123,12 @@ class Material: public TaggedObject, public MovableObject
     virtual int commitState(void) = 0;
     virtual int revertToLastCommit(void) = 0;
     virtual int revertToStart(void) = 0;
+    //! @brief Return true if all the state variables of the material
+    //! are committed (and reverted) by the store of the mesh (see
+    //! MaterialStateStore), so the mesh doesn't need to call
+    //! commitState and revertToLastCommit.
+    virtual bool isStateInStore(void) const
+      { return false; }
 
   };
 
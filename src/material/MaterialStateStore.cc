@@ -0,0 +1,184 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MaterialStateStore.cc
+
+#include "MaterialStateStore.h"
+#include <cstring>
+
+thread_local XC::MaterialStateStore *XC::MaterialStateStore::current= nullptr;
+
+//! @brief Constructor.
+XC::MaterialStateClient::MaterialStateClient(void)
+  : store(nullptr) {}
+
+//! @brief Copy constructor (the copy is not attached to any store).
+XC::MaterialStateClient::MaterialStateClient(const MaterialStateClient &)
+  : store(nullptr) {}
+
+//! @brief Assignment operator (keeps the attachment of this object).
+XC::MaterialStateClient &XC::MaterialStateClient::operator=(const MaterialStateClient &)
+  { return *this; }
+
+//! @brief Destructor (releases the slot of the store).
+XC::MaterialStateClient::~MaterialStateClient(void)
+  {
+    if(store)
+      store->release(*this);
+  }
+
+//! @brief Attach the object to the store of the bulk operation in
+//! progress (if any).
+void XC::MaterialStateClient::attachToCurrentStore(void)
+  {
+    if(!store)
+      {
+        MaterialStateStore *tmp= MaterialStateStore::getCurrent();
+        if(tmp)
+          tmp->attach(*this);
+      }
+  }
+
+//! @brief Return true if the state variables have been already
+//! committed (reverted) by the store doing a bulk operation.
+bool XC::MaterialStateClient::isUpdatedByStore(void) const
+  { return (store && (store==MaterialStateStore::getCurrent())); }
+
+//! @brief Constructor.
+//! @param s: store to use during the operation (if null the
+//! objects are not attached to any store).
+XC::MaterialStateStore::BulkOperation::BulkOperation(MaterialStateStore *s)
+  : previous(current)
+  { current= s; }
+
+//! @brief Destructor.
+XC::MaterialStateStore::BulkOperation::~BulkOperation(void)
+  { current= previous; }
+
+//! @brief Constructor.
+XC::MaterialStateStore::MaterialStateStore(void)
+  : used(blockSize) {}
+
+//! @brief Destructor.
+XC::MaterialStateStore::~MaterialStateStore(void)
+  { clear(); }
+
+//! @brief Return the store doing a bulk operation in this thread (if any).
+XC::MaterialStateStore *XC::MaterialStateStore::getCurrent(void)
+  { return current; }
+
+//! @brief Allocates a slot for the state variables of the object
+//! and copy them into it.
+bool XC::MaterialStateStore::attach(MaterialStateClient &c)
+  {
+    if(c.store)
+      return (c.store==this);
+    const size_t sz= (c.getStateSize()+alignment-1)/alignment*alignment;
+    if((sz==0) || (sz>blockSize))
+      return false;
+    if(used+sz>blockSize) // new block.
+      {
+        blocks.push_back(new char[2*blockSize]);
+        used= 0;
+      }
+    char *trial= blocks.back()+used;
+    used+= sz;
+    c.attach(trial,trial+blockSize);
+    c.store= this;
+    clients.insert(&c);
+    return true;
+  }
+
+//! @brief The object no longer uses its slot (it's being destroyed).
+//! The slot is not reused until the store is cleared.
+void XC::MaterialStateStore::release(MaterialStateClient &c)
+  {
+    if(c.store==this)
+      {
+        clients.erase(&c);
+        c.store= nullptr;
+      }
+  }
+
+//! @brief Copy back the state variables to the attached objects and
+//! free the memory.
+void XC::MaterialStateStore::clear(void)
+  {
+    for(std::set<MaterialStateClient *>::iterator i= clients.begin();i!=clients.end();i++)
+      {
+        (*i)->detach();
+        (*i)->store= nullptr;
+      }
+    clients.clear();
+    for(std::vector<char *>::iterator i= blocks.begin();i!=blocks.end();i++)
+      delete[] *i;
+    blocks.clear();
+    used= blockSize;
+  }
+
+//! @brief Commit the state of all the attached objects
+//! (committed values= trial values).
+void XC::MaterialStateStore::commit(void)
+  {
+    const size_t nb= blocks.size();
+    for(size_t i= 0;i<nb;i++)
+      {
+        const size_t sz= (i==nb-1 ? used : blockSize);
+        memcpy(blocks[i]+blockSize,blocks[i],sz);
+      }
+  }
+
+//! @brief Return all the attached objects to its last committed state
+//! (trial values= committed values).
+void XC::MaterialStateStore::revertToLastCommit(void)
+  {
+    const size_t nb= blocks.size();
+    for(size_t i= 0;i<nb;i++)
+      {
+        const size_t sz= (i==nb-1 ? used : blockSize);
+        memcpy(blocks[i],blocks[i]+blockSize,sz);
+      }
+  }
+
+//! @brief Return the number of attached objects.
+size_t XC::MaterialStateStore::getNumClients(void) const
+  { return clients.size(); }
+
+//! @brief Return the memory used by the slots (trial and committed values).
+size_t XC::MaterialStateStore::getBytesInUse(void) const
+  {
+    size_t retval= 0;
+    if(!blocks.empty())
+      retval= 2*((blocks.size()-1)*blockSize+used);
+    return retval;
+  }
+
+//! @brief Return the memory reserved by the store.
+size_t XC::MaterialStateStore::getBytesReserved(void) const
+  { return 2*blocks.size()*blockSize; }
+
+//! @brief Print stuff.
+void XC::MaterialStateStore::Print(std::ostream &os) const
+  {
+    os << "MaterialStateStore; attached objects: " << getNumClients()
+       << " bytes in use: " << getBytesInUse()
+       << " bytes reserved: " << getBytesReserved() << std::endl;
+  }
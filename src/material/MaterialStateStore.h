@@ -0,0 +1,121 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MaterialStateStore.h
+
+#ifndef MaterialStateStore_h
+#define MaterialStateStore_h
+
+#include <cstddef>
+#include <vector>
+#include <set>
+#include <iostream>
+
+namespace XC {
+
+class MaterialStateStore;
+
+//! @ingroup Mat
+//
+//! @brief Object whose trial and committed state variables can be
+//! stored in the contiguous arrays of a MaterialStateStore.
+class MaterialStateClient
+  {
+    friend class MaterialStateStore;
+  private:
+    MaterialStateStore *store; //!< store that contains the state variables (if any).
+  protected:
+    //! @brief Return the size (in bytes) of the trial (or committed) values.
+    virtual size_t getStateSize(void) const= 0;
+    //! @brief Copy the values to the storage being passed as parameter
+    //! and use it from now on.
+    virtual void attach(void *trial,void *committed)= 0;
+    //! @brief Copy the values back to the object's own storage.
+    virtual void detach(void)= 0;
+    void attachToCurrentStore(void);
+    bool isUpdatedByStore(void) const;
+  public:
+    MaterialStateClient(void);
+    MaterialStateClient(const MaterialStateClient &);
+    MaterialStateClient &operator=(const MaterialStateClient &);
+    virtual ~MaterialStateClient(void);
+    //! @brief Return true if the state variables are in a store.
+    inline bool isAttached(void) const
+      { return (store!=nullptr); }
+  };
+
+//! @ingroup Mat
+//
+//! @brief Contiguous storage of the trial and committed state
+//! variables of the materials of a mesh.
+//!
+//! The values of each material occupy a slot in big blocks of memory,
+//! the trial values of the block first and then the committed ones.
+//! This way the commit (revert) of the whole mesh is a copy of the
+//! trial (committed) part of each block. The materials are attached
+//! the first time they are committed (or reverted) inside a bulk
+//! operation (see BulkOperation), then their own commitState and
+//! revertToLastCommit do nothing inside bulk operations.
+class MaterialStateStore
+  {
+  public:
+    static const size_t blockSize= 32*1024; //!< size (in bytes) of the trial (or committed) part of a block.
+    static const size_t alignment= 8; //!< alignment of the slots.
+
+    //! @brief Makes the store the current one for the calling thread
+    //! while the object exists (the materials committed or reverted
+    //! in the meantime are attached to it).
+    class BulkOperation
+      {
+        MaterialStateStore *previous;
+      public:
+        BulkOperation(MaterialStateStore *);
+        ~BulkOperation(void);
+      };
+  private:
+    std::vector<char *> blocks; //!< memory blocks.
+    size_t used; //!< bytes used in the last block.
+    std::set<MaterialStateClient *> clients; //!< attached objects.
+    static thread_local MaterialStateStore *current; //!< store doing a bulk operation in this thread.
+
+    MaterialStateStore(const MaterialStateStore &);
+    MaterialStateStore &operator=(const MaterialStateStore &);
+  public:
+    MaterialStateStore(void);
+    ~MaterialStateStore(void);
+
+    bool attach(MaterialStateClient &);
+    void release(MaterialStateClient &);
+    void clear(void);
+
+    void commit(void);
+    void revertToLastCommit(void);
+
+    static MaterialStateStore *getCurrent(void);
+    size_t getNumClients(void) const;
+    size_t getBytesInUse(void) const;
+    size_t getBytesReserved(void) const;
+    void Print(std::ostream &) const;
+  };
+
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,97 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MaterialStateVars.h
+
+#ifndef MaterialStateVars_h
+#define MaterialStateVars_h
+
+#include "material/MaterialStateStore.h"
+
+namespace XC {
+
+//! @ingroup Mat
+//
+//! @brief Trial (T) and committed (C) values of the state variables
+//! of a material. The values (plain structure S) are stored in the
+//! object itself or, once attached, in a MaterialStateStore.
+template <class S>
+class MaterialStateVars: public MaterialStateClient
+  {
+  private:
+    S own[2]; //!< own storage (trial and committed).
+  protected:
+    size_t getStateSize(void) const
+      { return sizeof(S); }
+    void attach(void *trial,void *committed)
+      {
+        S *t= static_cast<S *>(trial);
+        S *c= static_cast<S *>(committed);
+        *t= *T; *c= *C;
+        T= t; C= c;
+      }
+    void detach(void)
+      {
+        own[0]= *T; own[1]= *C;
+        T= &own[0]; C= &own[1];
+      }
+  public:
+    S *T; //!< trial values.
+    S *C; //!< committed values.
+
+    MaterialStateVars(void)
+      : MaterialStateClient(), T(&own[0]), C(&own[1])
+      { own[0]= own[1]= S(); }
+    MaterialStateVars(const MaterialStateVars &other)
+      : MaterialStateClient(other), T(&own[0]), C(&own[1])
+      { own[0]= *other.T; own[1]= *other.C; }
+    MaterialStateVars &operator=(const MaterialStateVars &other)
+      {
+        MaterialStateClient::operator=(other);
+        *T= *other.T; *C= *other.C;
+        return *this;
+      }
+
+    //! @brief Commit the state (committed values= trial values) unless
+    //! it's already done by the store.
+    void commit(void)
+      {
+        if(!isUpdatedByStore())
+          {
+            *C= *T;
+            attachToCurrentStore();
+          }
+      }
+    //! @brief Return to the last committed state (trial values=
+    //! committed values) unless it's already done by the store.
+    void revert(void)
+      {
+        if(!isUpdatedByStore())
+          {
+            *T= *C;
+            attachToCurrentStore();
+          }
+      }
+  };
+
+} // end of XC namespace
+
+#endif
@@ -80,6 +80,7 @@
 #include <material/nD/j2_plasticity/J2PlateFiber.h>
 #include <material/nD/j2_plasticity/J2ThreeDimensional.h> 
 #include "material/nD/NDMaterialType.h"
+#include "material/nD/NDMaterialBatch.h"
 
 //this is mike's problem
 XC::Tensor XC::J2Plasticity::rank2(2, def_dim_2, 0.0 ) ;
@@ -458,6 +459,8 @@ void XC::J2Plasticity::plastic_integrator( )
   {
     const double tolerance = (1.0e-8)*sigma_0 ;
     const double dt= FEProblem::theActiveDomain->getTimeTracker().getDt(); //time step
+    // viscosity term (zero for the rate independent case, even if dt is zero).
+    const double eta_dt= (eta!=0.0) ? eta/dt : 0.0;
 
     static XC::Matrix dev_strain(3,3) ; //deviatoric strain
     static XC::Matrix dev_stress(3,3) ; //deviatoric stress
@@ -538,11 +541,11 @@ void XC::J2Plasticity::plastic_integrator( )
         resid = norm_tau 
               - (2.0*shear) * gamma 
               - root23 * q( xi_n + root23*gamma ) 
-              - (eta/dt) * gamma ;
+              - eta_dt * gamma ;
 
         tang =  - (2.0*shear)  
                 - two3 * qprime( xi_n + root23*gamma )
-                - (eta/dt) ;
+                - eta_dt ;
 
         gamma -= ( resid / tang ) ;
 
@@ -572,7 +575,7 @@ void XC::J2Plasticity::plastic_integrator( )
 
      theta =  (2.0*shear)  
            +  two3 * qprime( xi_nplus1 )
-           +  (eta/dt) ;
+           +  eta_dt ;
 
      theta_inv = 1.0/theta ;
 
@@ -688,6 +691,36 @@ double XC::J2Plasticity::qprime( double xi )
 }
 
 
+//! @brief Set the trial strains of the materials of the points
+//! [begin,end) of the batch (all of them of the class of this object)
+//! and copy their stresses and tangents in matrix notation.
+//!
+//! @param batch: strains, stresses and tangents of the points.
+//! @param mats: materials of the points.
+//! @param begin: first point of the group.
+//! @param end: one past the last point of the group.
+//! @param ti: first tensor index for each matrix index.
+//! @param tj: second tensor index for each matrix index.
+int XC::J2Plasticity::setTrialStrainGroup(NDMaterialBatch &batch, NDMaterial *const *mats, const size_t &begin, const size_t &end, const int *ti, const int *tj) const
+  {
+    int retval= 0;
+    const int order= batch.getOrder();
+    for(size_t p= begin;p<end;p++)
+      {
+        J2Plasticity *m= static_cast<J2Plasticity *>(mats[p]);
+        const Vector strain(batch.getStrainPtr(p),order);
+        retval+= m->setTrialStrain(strain);
+        double *s= batch.getStressPtr(p);
+        for(int ii= 0;ii<order;ii++)
+          s[ii]= m->stress(ti[ii],tj[ii]);
+        double *t= batch.getTangentPtr(p);
+        for(int jj= 0;jj<order;jj++)
+          for(int ii= 0;ii<order;ii++)
+            t[jj*order+ii]= m->tangent[ti[ii]][tj[ii]][ti[jj]][tj[jj]];
+      }
+    return retval;
+  }
+
 //matrix_index ---> BJtensor indices i,j
 void XC::J2Plasticity::index_map( int matrix_index, int &i, int &j ) const
 {
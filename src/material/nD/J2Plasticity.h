@@ -135,6 +135,7 @@ class J2Plasticity: public NDMaterial
 
     //matrix index to tensor index mapping
     virtual void index_map( int matrix_index, int &i, int &j ) const;
+    int setTrialStrainGroup(NDMaterialBatch &, NDMaterial *const *, const size_t &, const size_t &, const int *, const int *) const;
 
     int sendData(CommParameters &);
     int recvData(const CommParameters &);
@@ -156,6 +157,35 @@ class J2Plasticity: public NDMaterial
 
     virtual NDMaterial* getCopy(const std::string &) const;
 
+    inline double getBulkModulus(void) const
+      { return bulk; }
+    void setBulkModulus(const double &d)
+      { bulk= d; }
+    inline double getShearModulus(void) const
+      { return shear; }
+    void setShearModulus(const double &d)
+      { shear= d; }
+    inline double getInitialYieldStress(void) const
+      { return sigma_0; }
+    void setInitialYieldStress(const double &d)
+      { sigma_0= d; }
+    inline double getFinalYieldStress(void) const
+      { return sigma_infty; }
+    void setFinalYieldStress(const double &d)
+      { sigma_infty= d; }
+    inline double getExponentialHardening(void) const
+      { return delta; }
+    void setExponentialHardening(const double &d)
+      { delta= d; }
+    inline double getLinearHardening(void) const
+      { return Hard; }
+    void setLinearHardening(const double &d)
+      { Hard= d; }
+    inline double getViscosity(void) const
+      { return eta; }
+    void setViscosity(const double &d)
+      { eta= d; }
+
     //swap history variables
     virtual int commitState(void);
     //revert to last saved state
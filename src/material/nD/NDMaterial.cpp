@@ -63,6 +63,7 @@
 // What: "@(#) XC::NDMaterial.C, revA"
 
 #include <material/nD/NDMaterial.h>
+#include <material/nD/NDMaterialBatch.h>
 #include <domain/mesh/element/utils/Information.h>
 #include <utility/matrix/Matrix.h>
 #include <utility/matrix/Vector.h>
@@ -136,6 +137,32 @@ int XC::NDMaterial::setTrialStrain(const Vector &v, const Vector &r)
     return -1;    
   }
 
+//! @brief Set the trial strains of the materials of the points
+//! [begin,end) of the batch and store their stresses and tangents.
+//!
+//! The materials of these points must be objects of the same class
+//! than this one; the subclasses redefine this method to evaluate the
+//! whole group without a virtual call per point. The default
+//! implementation calls setTrialStrain, getStress and getTangent
+//! on each material.
+//!
+//! @param batch: strains, stresses and tangents of the points.
+//! @param mats: materials of the points.
+//! @param begin: first point of the group.
+//! @param end: one past the last point of the group.
+int XC::NDMaterial::setTrialStrainBatch(NDMaterialBatch &batch, NDMaterial *const *mats, const size_t &begin, const size_t &end) const
+  {
+    int retval= 0;
+    const int order= batch.getOrder();
+    for(size_t i= begin;i<end;i++)
+      {
+        const Vector strain(batch.getStrainPtr(i),order);
+        retval+= mats[i]->setTrialStrain(strain);
+        batch.getState(i,*mats[i]);
+      }
+    return retval;
+  }
+
 //! @brief Set trial strain increment.
 int XC::NDMaterial::setTrialStrainIncr(const Vector &v)
   {
@@ -80,6 +80,7 @@ class Vector;
 class Tensor;
 class Information;
 class Response;
+class NDMaterialBatch;
 
 //! @ingroup Mat
 //!
@@ -121,6 +122,7 @@ class NDMaterial: public Material
     virtual int setTrialStrain(const Vector &v, const Vector &r);
     virtual int setTrialStrainIncr(const Vector &v);
     virtual int setTrialStrainIncr(const Vector &v, const Vector &r);
+    virtual int setTrialStrainBatch(NDMaterialBatch &, NDMaterial *const *, const size_t &, const size_t &) const;
     virtual const Matrix &getTangent(void) const;
     inline virtual const Matrix &getInitialTangent(void) const
       {return this->getTangent();};
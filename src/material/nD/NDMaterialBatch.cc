@@ -0,0 +1,99 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//NDMaterialBatch.cc
+
+#include "NDMaterialBatch.h"
+#include "material/nD/NDMaterial.h"
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/Matrix.h"
+
+//! @brief Constructor.
+//!
+//! @param n: number of material points.
+//! @param ord: number of strain (and stress) components.
+XC::NDMaterialBatch::NDMaterialBatch(const size_t &n,const size_t &ord)
+  : numPoints(0), order(0), valid(false)
+  { resize(n,ord); }
+
+//! @brief Set the number of points and the number of strain components.
+void XC::NDMaterialBatch::resize(const size_t &n,const size_t &ord)
+  {
+    if((n!=numPoints) || (ord!=order))
+      {
+        numPoints= n;
+        order= ord;
+        strains.assign(numPoints*order,0.0);
+        stresses.assign(numPoints*order,0.0);
+        tangents.assign(numPoints*order*order,0.0);
+      }
+    valid= false;
+  }
+
+//! @brief Copy the stress and the tangent of the i-th point.
+void XC::NDMaterialBatch::setState(const size_t &i,const Vector &stress,const Matrix &tangent)
+  {
+    double *s= getStressPtr(i);
+    for(size_t j= 0;j<order;j++)
+      s[j]= stress(j);
+    double *t= getTangentPtr(i);
+    for(size_t k= 0;k<order;k++)
+      for(size_t j= 0;j<order;j++)
+        t[k*order+j]= tangent(j,k);
+  }
+
+//! @brief Copy the stress and the tangent of the material
+//! into the i-th point.
+void XC::NDMaterialBatch::getState(const size_t &i,const NDMaterial &mat)
+  { setState(i,mat.getStress(),mat.getTangent()); }
+
+//! @brief Set the trial strains of the materials (one for each point)
+//! and compute their stresses and tangents.
+//!
+//! @param mats: pointers to the materials (at least size() of them).
+int XC::NDMaterialBatch::setTrialStrains(NDMaterial *const *mats)
+  {
+    int retval= 0;
+    size_t begin= 0;
+    while(begin<numPoints)
+      {
+        // Group of consecutive points with the same material class.
+        const int classTag= mats[begin]->getClassTag();
+        size_t end= begin+1;
+        while((end<numPoints) && (mats[end]->getClassTag()==classTag))
+          end++;
+        retval+= mats[begin]->setTrialStrainBatch(*this,mats,begin,end);
+        begin= end;
+      }
+    valid= true;
+    return retval;
+  }
+
+//! @brief Read the stresses and tangents from the materials (i.e. after
+//! reverting their state).
+//!
+//! @param mats: pointers to the materials (at least size() of them).
+void XC::NDMaterialBatch::update(const NDMaterial *const *mats)
+  {
+    for(size_t i= 0;i<numPoints;i++)
+      getState(i,*mats[i]);
+    valid= true;
+  }
@@ -0,0 +1,104 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//NDMaterialBatch.h
+
+#ifndef NDMaterialBatch_h
+#define NDMaterialBatch_h
+
+#include <vector>
+#include <cstddef>
+
+namespace XC {
+class NDMaterial;
+class Vector;
+class Matrix;
+
+//! @ingroup NDMat
+//
+//! @brief Trial strains, stresses and tangents of a group of material
+//! points (the integration points of an element or the fibers of
+//! a section).
+//!
+//! The values are stored contiguously, point by point (tangents
+//! by columns). The materials are evaluated with a single call to
+//! setTrialStrains; consecutive points whose materials have the same
+//! class are evaluated by the NDMaterial::setTrialStrainBatch method
+//! of that class, which avoids a virtual call per point and per
+//! returned value.
+class NDMaterialBatch
+  {
+  private:
+    size_t numPoints; //!< number of material points.
+    size_t order; //!< number of strain (and stress) components.
+    std::vector<double> strains; //!< trial strains.
+    std::vector<double> stresses; //!< stresses for the trial strains.
+    std::vector<double> tangents; //!< tangents for the trial strains.
+    bool valid; //!< true if the stresses and tangents correspond to the trial state of the materials.
+  public:
+    NDMaterialBatch(const size_t &n= 0,const size_t &ord= 0);
+
+    void resize(const size_t &,const size_t &);
+    inline size_t size(void) const
+      { return numPoints; }
+    inline size_t getOrder(void) const
+      { return order; }
+
+    //! @brief Return a pointer to the strain of the i-th point.
+    inline double *getStrainPtr(const size_t &i)
+      { return &strains[i*order]; }
+    //! @brief Return a pointer to the strain of the i-th point.
+    inline const double *getStrainPtr(const size_t &i) const
+      { return &strains[i*order]; }
+    //! @brief Return a pointer to the stress of the i-th point.
+    inline double *getStressPtr(const size_t &i)
+      { return &stresses[i*order]; }
+    //! @brief Return a pointer to the stress of the i-th point.
+    inline const double *getStressPtr(const size_t &i) const
+      { return &stresses[i*order]; }
+    //! @brief Return a pointer to the tangent of the i-th point (stored by columns).
+    inline double *getTangentPtr(const size_t &i)
+      { return &tangents[i*order*order]; }
+    //! @brief Return a pointer to the tangent of the i-th point (stored by columns).
+    inline const double *getTangentPtr(const size_t &i) const
+      { return &tangents[i*order*order]; }
+    //! @brief Return the (j,k) component of the tangent of the i-th point.
+    inline double getTangent(const size_t &i,const size_t &j,const size_t &k) const
+      { return tangents[i*order*order+k*order+j]; }
+
+    //! @brief Return true if the stresses and tangents correspond
+    //! to the trial state of the materials.
+    inline bool isValid(void) const
+      { return valid; }
+    //! @brief Mark the stresses and tangents as outdated (i.e. after
+    //! reverting the state of the materials).
+    inline void invalidate(void)
+      { valid= false; }
+
+    void setState(const size_t &,const Vector &,const Matrix &);
+    void getState(const size_t &,const NDMaterial &);
+    int setTrialStrains(NDMaterial *const *);
+    void update(const NDMaterial *const *);
+  };
+
+} // end of XC namespace
+
+#endif
@@ -55,6 +55,8 @@
 
 #include "utility/matrix/Matrix.h"
 #include "material/nD/NDMaterialType.h"
+#include "material/nD/NDMaterialBatch.h"
+#include <algorithm>
 
 XC::Matrix XC::ElasticIsotropic3D::D(6,6);	  // global for XC::ElasticIsotropic3D only
 XC::Vector XC::ElasticIsotropic3D::sigma(6);	 // global for XC::ElasticIsotropic3D onyl
@@ -146,6 +148,41 @@ const XC::Vector &XC::ElasticIsotropic3D::getStress(void) const
     return sigma;
   }
 
+//! @brief Set the trial strains of the materials of the points
+//! [begin,end) of the batch and compute their stresses and tangents
+//! (see NDMaterial::setTrialStrainBatch).
+int XC::ElasticIsotropic3D::setTrialStrainBatch(NDMaterialBatch &batch, NDMaterial *const *mats, const size_t &begin, const size_t &end) const
+  {
+    for(size_t i= begin;i<end;i++)
+      {
+        ElasticIsotropic3D *m= static_cast<ElasticIsotropic3D *>(mats[i]);
+        const double *eps= batch.getStrainPtr(i);
+        double *e= m->epsilon.getDataPtr();
+        for(size_t j= 0;j<6;j++)
+          e[j]= eps[j];
+
+        const double mu2= m->E/(1.0+m->v);
+        const double lam= m->v*mu2/(1.0-2.0*m->v);
+        const double mu= 0.50*mu2;
+        const double lam2mu= mu2+lam;
+
+        double *s= batch.getStressPtr(i);
+        s[0]= lam2mu*eps[0] + lam*(eps[1]+eps[2]);
+        s[1]= lam2mu*eps[1] + lam*(eps[2]+eps[0]);
+        s[2]= lam2mu*eps[2] + lam*(eps[0]+eps[1]);
+        s[3]= mu*eps[3];
+        s[4]= mu*eps[4];
+        s[5]= mu*eps[5];
+
+        double *t= batch.getTangentPtr(i);
+        std::fill(t,t+36,0.0);
+        t[0]= t[7]= t[14]= lam2mu; // D(0,0), D(1,1), D(2,2)
+        t[1]= t[2]= t[6]= t[8]= t[12]= t[13]= lam; // D(i,j) i!=j, i,j<3
+        t[21]= t[28]= t[35]= mu; // D(3,3), D(4,4), D(5,5)
+      }
+    return 0;
+  }
+
 //! @brief Sets the value of the current trial strain tensor, \f$\epsilon\f$,
 //! to be \p strain. Returns \f$0\f$.
 int XC::ElasticIsotropic3D::setTrialStrain(const Tensor &v)
@@ -86,6 +86,7 @@ class ElasticIsotropic3D : public ElasticIsotropicMaterial
     const Matrix &getInitialTangent(void) const;
 
     const Vector &getStress(void) const;
+    int setTrialStrainBatch(NDMaterialBatch &, NDMaterial *const *, const size_t &, const size_t &) const;
     
     int setTrialStrain(const Tensor &v);
     int setTrialStrain(const Tensor &v, const Tensor &r);
@@ -53,6 +53,7 @@
 
 #include <utility/matrix/Matrix.h>
 #include "material/nD/NDMaterialType.h"
+#include "material/nD/NDMaterialBatch.h"
 
 XC::Vector XC::ElasticIsotropicPlaneStrain2D::sigma(3);
 
@@ -159,6 +160,38 @@ const XC::Vector &XC::ElasticIsotropicPlaneStrain2D::getStress(void) const
     return sigma;
   }
 
+//! @brief Set the trial strains of the materials of the points
+//! [begin,end) of the batch and compute their stresses and tangents
+//! (see NDMaterial::setTrialStrainBatch).
+int XC::ElasticIsotropicPlaneStrain2D::setTrialStrainBatch(NDMaterialBatch &batch, NDMaterial *const *mats, const size_t &begin, const size_t &end) const
+  {
+    for(size_t i= begin;i<end;i++)
+      {
+        ElasticIsotropicPlaneStrain2D *m= static_cast<ElasticIsotropicPlaneStrain2D *>(mats[i]);
+        const double *eps= batch.getStrainPtr(i);
+        double *e= m->epsilon.getDataPtr();
+        for(size_t j= 0;j<3;j++)
+          e[j]= eps[j];
+
+        const double mu2= m->E/(1.0+m->v);
+        const double lam= m->v*mu2/(1.0-2.0*m->v);
+        const double mu= 0.50*mu2;
+        const double lam2mu= mu2+lam;
+
+        double *s= batch.getStressPtr(i);
+        s[0]= lam2mu*eps[0] + lam*eps[1];
+        s[1]= lam*eps[0] + lam2mu*eps[1];
+        s[2]= mu*eps[2];
+
+        double *t= batch.getTangentPtr(i);
+        t[0]= t[4]= lam2mu; // D(0,0), D(1,1)
+        t[1]= t[3]= lam; // D(1,0), D(0,1)
+        t[8]= mu; // D(2,2)
+        t[2]= t[5]= t[6]= t[7]= 0.0;
+      }
+    return 0;
+  }
+
 int XC::ElasticIsotropicPlaneStrain2D::commitState(void)
   { return 0; }
 
@@ -76,7 +76,6 @@ class ElasticIsotropicPlaneStrain2D : public ElasticIsotropic2D
   {
   private:
     static Vector sigma;        // Stress vector ... class-wide for returns
-    Vector epsilon;	        // Trial strains
   public:
     ElasticIsotropicPlaneStrain2D(int tag, double E, double nu, double rho);
     ElasticIsotropicPlaneStrain2D(int tag= 0);
@@ -87,6 +86,7 @@ class ElasticIsotropicPlaneStrain2D : public ElasticIsotropic2D
     const Matrix &getInitialTangent(void) const;
 
     const Vector &getStress(void) const;
+    int setTrialStrainBatch(NDMaterialBatch &, NDMaterial *const *, const size_t &, const size_t &) const;
     
     int commitState (void);
     int revertToLastCommit (void);
@@ -54,6 +54,8 @@
 
 #include "utility/matrix/Matrix.h"
 #include "material/nD/NDMaterialType.h"
+#include "material/nD/NDMaterialBatch.h"
+#include <algorithm>
 
 XC::Vector XC::ElasticIsotropicPlateFiber::sigma(5);
 XC::Matrix XC::ElasticIsotropicPlateFiber::D(5,5);
@@ -132,6 +134,39 @@ const XC::Vector &XC::ElasticIsotropicPlateFiber::getStress(void) const
     return sigma;
   }
 
+//! @brief Set the trial strains of the materials of the points
+//! [begin,end) of the batch and compute their stresses and tangents
+//! (see NDMaterial::setTrialStrainBatch).
+int XC::ElasticIsotropicPlateFiber::setTrialStrainBatch(NDMaterialBatch &batch, NDMaterial *const *mats, const size_t &begin, const size_t &end) const
+  {
+    for(size_t i= begin;i<end;i++)
+      {
+        ElasticIsotropicPlateFiber *m= static_cast<ElasticIsotropicPlateFiber *>(mats[i]);
+        const double *eps= batch.getStrainPtr(i);
+        double *e= m->epsilon.getDataPtr();
+        for(size_t j= 0;j<5;j++)
+          e[j]= eps[j];
+
+        const double d00= m->E/(1.0-m->v*m->v);
+        const double d01= m->v*d00;
+        const double d22= 0.5*(d00-d01);
+
+        double *s= batch.getStressPtr(i);
+        s[0]= d00*eps[0] + d01*eps[1];
+        s[1]= d01*eps[0] + d00*eps[1];
+        s[2]= d22*eps[2];
+        s[3]= d22*eps[3];
+        s[4]= d22*eps[4];
+
+        double *t= batch.getTangentPtr(i);
+        std::fill(t,t+25,0.0);
+        t[0]= t[6]= d00; // D(0,0), D(1,1)
+        t[1]= t[5]= d01; // D(1,0), D(0,1)
+        t[12]= t[18]= t[24]= d22; // D(2,2), D(3,3), D(4,4)
+      }
+    return 0;
+  }
+
 int XC::ElasticIsotropicPlateFiber::commitState(void)
 {
   return 0;
@@ -84,6 +84,7 @@ class ElasticIsotropicPlateFiber : public ElasticIsotropicMaterial
     const Matrix &getInitialTangent(void) const;
 
     const Vector &getStress(void) const;
+    int setTrialStrainBatch(NDMaterialBatch &, NDMaterial *const *, const size_t &, const size_t &) const;
         
     int commitState(void);
     int revertToLastCommit(void);
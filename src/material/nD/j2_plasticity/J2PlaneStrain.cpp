@@ -85,6 +85,7 @@
 #include <utility/matrix/Vector.h>
 #include <utility/matrix/Matrix.h>
 #include "material/nD/NDMaterialType.h"
+#include "material/nD/NDMaterialBatch.h"
 
 //static vectors and matrices
 XC::Vector XC::J2PlaneStrain::strain_vec(3) ;
@@ -202,6 +203,17 @@ const XC::Vector &XC::J2PlaneStrain::getStress(void) const
   return stress_vec ;
 }
 
+//! @brief Set the trial strains of the materials of the points
+//! [begin,end) of the batch and compute their stresses and tangents
+//! (see NDMaterial::setTrialStrainBatch).
+int XC::J2PlaneStrain::setTrialStrainBatch(NDMaterialBatch &batch, NDMaterial *const *mats, const size_t &begin, const size_t &end) const
+  {
+    // matrix index to tensor indices (see getTangent).
+    static const int ti[]= {0,1,0};
+    static const int tj[]= {0,1,1};
+    return setTrialStrainGroup(batch,mats,begin,end,ti,tj);
+  }
+
 //send back the tangent 
 const XC::Matrix &XC::J2PlaneStrain::getTangent(void) const
 {
@@ -84,6 +84,7 @@
 #include <utility/matrix/Vector.h>
 #include <utility/matrix/Matrix.h>
 #include "material/nD/NDMaterialType.h"
+#include "material/nD/NDMaterialBatch.h"
 
 XC::Vector XC::J2PlateFiber::strain_vec(5) ;
 XC::Vector XC::J2PlateFiber::stress_vec(5) ;
@@ -256,6 +257,17 @@ const XC::Vector &XC::J2PlateFiber::getStress(void) const
   return stress_vec ;
 }
 
+//! @brief Set the trial strains of the materials of the points
+//! [begin,end) of the batch and compute their stresses and tangents
+//! (see NDMaterial::setTrialStrainBatch).
+int XC::J2PlateFiber::setTrialStrainBatch(NDMaterialBatch &batch, NDMaterial *const *mats, const size_t &begin, const size_t &end) const
+  {
+    // matrix index to tensor indices (see getTangent).
+    static const int ti[]= {0,1,0,1,2};
+    static const int tj[]= {0,1,1,2,0};
+    return setTrialStrainGroup(batch,mats,begin,end,ti,tj);
+  }
+
 //send back the tangent 
 const XC::Matrix &XC::J2PlateFiber::getTangent(void) const
 {
@@ -87,6 +87,7 @@
 #include <utility/matrix/Vector.h>
 #include <utility/matrix/Matrix.h>
 #include "material/nD/NDMaterialType.h"
+#include "material/nD/NDMaterialBatch.h"
 
 //static vectors and matrices
 XC::Vector XC::J2ThreeDimensional::strain_vec(6) ;
@@ -229,6 +230,17 @@ const XC::Vector &XC::J2ThreeDimensional::getStress(void) const
   return stress_vec ;
 }
 
+//! @brief Set the trial strains of the materials of the points
+//! [begin,end) of the batch and compute their stresses and tangents
+//! (see NDMaterial::setTrialStrainBatch).
+int XC::J2ThreeDimensional::setTrialStrainBatch(NDMaterialBatch &batch, NDMaterial *const *mats, const size_t &begin, const size_t &end) const
+  {
+    // matrix index to tensor indices (see getTangent).
+    static const int ti[]= {0,1,2,0,1,2};
+    static const int tj[]= {0,1,2,1,2,0};
+    return setTrialStrainGroup(batch,mats,begin,end,ti,tj);
+  }
+
 //send back the tangent 
 const XC::Matrix& XC::J2ThreeDimensional::getTangent(void) const
 {
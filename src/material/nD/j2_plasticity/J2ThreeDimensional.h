@@ -139,6 +139,7 @@ class J2ThreeDimensional : public J2Plasticity {
 
   //send back the tangent 
   const Matrix& getTangent(void) const;
+  int setTrialStrainBatch(NDMaterialBatch &, NDMaterial *const *, const size_t &, const size_t &) const;
   const Matrix& getInitialTangent(void) const;
 
   //this is mike's problem
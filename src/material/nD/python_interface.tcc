@@ -21,11 +21,16 @@
 //----------------------------------------------------------------------------
 //python_interface.tcc
 
+int (XC::NDMaterial::*setTrialStrainVector)(const XC::Vector &)= &XC::NDMaterial::setTrialStrain;
 class_<XC::NDMaterial, XC::NDMaterial *, bases<XC::Material>, boost::noncopyable >("NDMaterial", no_init)
     .add_property("getRho", &XC::NDMaterial::getRho,"Return the material density.")
     .add_property("getE", &XC::NDMaterial::getE)
     .add_property("getnu", &XC::NDMaterial::getnu)
     .add_property("getpsi", &XC::NDMaterial::getpsi)
+    .def("setTrialStrain", setTrialStrainVector,"Assigns trial strain.")
+    .def("getStrain", make_function(&XC::NDMaterial::getStrain, return_internal_reference<>()),"Returns material strain.")
+    .def("getStress", make_function(&XC::NDMaterial::getStress, return_internal_reference<>()),"Returns material stress.")
+    .def("getTangent", make_function(&XC::NDMaterial::getTangent, return_internal_reference<>()),"Returns material tangent stiffness.")
        ;
 
 class_<XC::ElasticIsotropicMaterial, bases<XC::NDMaterial>, boost::noncopyable >("ElasticIsotropicMaterial", no_init)
@@ -40,7 +45,15 @@ class_<XC::ElasticIsotropicMaterial, bases<XC::NDMaterial>, boost::noncopyable >
 
 //#include "FiniteDeformation/python_interface.tcc"
 
-class_<XC::J2Plasticity, bases<XC::NDMaterial>, boost::noncopyable >("J2Plasticity", no_init);
+class_<XC::J2Plasticity, bases<XC::NDMaterial>, boost::noncopyable >("J2Plasticity", no_init)
+    .add_property("bulkModulus", &XC::J2Plasticity::getBulkModulus, &XC::J2Plasticity::setBulkModulus,"Bulk modulus.")
+    .add_property("shearModulus", &XC::J2Plasticity::getShearModulus, &XC::J2Plasticity::setShearModulus,"Shear modulus.")
+    .add_property("sigma0", &XC::J2Plasticity::getInitialYieldStress, &XC::J2Plasticity::setInitialYieldStress,"Initial yield stress.")
+    .add_property("sigmaInfty", &XC::J2Plasticity::getFinalYieldStress, &XC::J2Plasticity::setFinalYieldStress,"Final saturation yield stress.")
+    .add_property("delta", &XC::J2Plasticity::getExponentialHardening, &XC::J2Plasticity::setExponentialHardening,"Exponential hardening parameter.")
+    .add_property("H", &XC::J2Plasticity::getLinearHardening, &XC::J2Plasticity::setLinearHardening,"Linear hardening parameter.")
+    .add_property("eta", &XC::J2Plasticity::getViscosity, &XC::J2Plasticity::setViscosity,"Viscosity (zero for the rate independent case).")
+       ;
 #include "j2_plasticity/python_interface.tcc"
 
 class_<XC::NDAdaptorMaterial, bases<XC::NDMaterial>, boost::noncopyable >("NDAdaptorMaterial", no_init);
@@ -64,6 +64,7 @@
 #include "Fiber.h"
 #include "boost/any.hpp"
 #include "material/uniaxial/UniaxialMaterial.h"
+#include "utility/ObjectArena.h"
 
 #include "xc_utils/src/geom/pos_vec/Pos2d.h"
 
@@ -71,6 +72,15 @@
 XC::Fiber::Fiber(int tag, int classTag)
   : TaggedObject(tag), MovableObject(classTag), dead(false) {}
 
+//! @brief Allocates the fiber from the current memory arena
+//! (see ObjectArena).
+void *XC::Fiber::operator new(size_t sz)
+  { return ObjectArena::allocate(sz); }
+
+//! @brief Returns the memory of the fiber to its arena.
+void XC::Fiber::operator delete(void *p,size_t sz)
+  { ObjectArena::deallocate(p,sz); }
+
 XC::Response *XC::Fiber::setResponse(const std::vector<std::string> &argv, Information &info)
   { return nullptr; }
 
@@ -96,6 +96,9 @@ class Fiber: public TaggedObject, public MovableObject
   public:
     Fiber(int tag, int classTag);
 
+    static void *operator new(size_t);
+    static void operator delete(void *,size_t);
+
     virtual int setTrialFiberStrain(const Vector &vs)=0;
     virtual Vector &getFiberStressResultants(void) =0;
     virtual Matrix &getFiberTangentStiffContr(void) =0;
@@ -57,6 +57,7 @@
 #include <material/section/plate_section/MembranePlateFiberSection.h>
 #include <material/nD/NDMaterial.h>
 #include "material/section/ResponseId.h"
+#include "preprocessor/prep_handlers/MaterialHandler.h"
 
 
 //parameters
@@ -97,7 +98,7 @@ const double  XC::MembranePlateFiberSection::wg[] = { 0.1,
 
 
 XC::MembranePlateFiberSection::MembranePlateFiberSection(int tag)
-  : XC::PlateBase( 0, SEC_TAG_MembranePlateFiberSection ), strainResultant(8) 
+  : XC::PlateBase( 0, SEC_TAG_MembranePlateFiberSection ), strainResultant(8), batch(5,5)
   { 
     for(int i= 0;i<5;i++ )
       theFibers[i]= nullptr;
@@ -105,7 +106,7 @@ XC::MembranePlateFiberSection::MembranePlateFiberSection(int tag)
 
 //! @brief null constructor
 XC::MembranePlateFiberSection::MembranePlateFiberSection(void)
-  : XC::PlateBase(0, SEC_TAG_MembranePlateFiberSection ), strainResultant(8) 
+  : XC::PlateBase(0, SEC_TAG_MembranePlateFiberSection ), strainResultant(8), batch(5,5)
   { 
     for(int i= 0;i<5;i++)
       theFibers[i]= nullptr;
@@ -115,7 +116,7 @@ XC::MembranePlateFiberSection::MembranePlateFiberSection(void)
 
 //! @brief full constructor
 XC::MembranePlateFiberSection::MembranePlateFiberSection(int tag, double thickness, XC::NDMaterial &Afiber )
-  : XC::PlateBase( tag, SEC_TAG_MembranePlateFiberSection,thickness), strainResultant(8)
+  : XC::PlateBase( tag, SEC_TAG_MembranePlateFiberSection,thickness), strainResultant(8), batch(5,5)
   {
     for(int i= 0; i < 5; i++)
       theFibers[i]= Afiber.getCopy("PlateFiber");
@@ -137,6 +138,34 @@ XC::SectionForceDeformation  *XC::MembranePlateFiberSection::getCopy(void) const
 
 
 
+//! @brief Assign a copy of the material whose name is being passed
+//! as parameter to each of the fibers.
+void XC::MembranePlateFiberSection::setMaterial(const std::string &nmbMat)
+  {
+    const MaterialHandler *ldr= getMaterialHandler();
+    if(ldr)
+      {
+        const NDMaterial *mat= dynamic_cast<const NDMaterial *>(ldr->find_ptr(nmbMat));
+        if(mat)
+          {
+            for(int i= 0;i<5;i++)
+              {
+                if(theFibers[i])
+                  delete theFibers[i];
+                theFibers[i]= mat->getCopy("PlateFiber");
+              }
+            batch.invalidate();
+          }
+        else
+          std::cerr << getClassName() << "::" << __FUNCTION__
+                    << "; nD material: '" << nmbMat
+                    << "' not found." << std::endl;
+      }
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; material handler not set." << std::endl;
+  }
+
 //! @brief send back order of strainResultant in vector form
 int XC::MembranePlateFiberSection::getOrder(void) const
   { return 8; }
@@ -167,6 +196,7 @@ int XC::MembranePlateFiberSection::revertToLastCommit(void)
 
     for(int i= 0; i < 5; i++ )
       success+= theFibers[i]->revertToLastCommit();
+    batch.invalidate();
     return success;
   }
 
@@ -176,6 +206,7 @@ int XC::MembranePlateFiberSection::revertToStart(void)
     int success = 0;
     for(int i= 0;i<5;i++ )
       success += theFibers[i]->revertToStart( );
+    batch.invalidate();
     return success;
   }
 
@@ -221,22 +252,20 @@ int XC::MembranePlateFiberSection::setTrialSectionDeformation(const Vector &stra
   {
     this->strainResultant = strainResultant_from_element;
 
-    static Vector strain(5);
-
-    int success= 0;
     double z;
 
     for(int i = 0; i < 5; i++ )
       {
         z= ( 0.5*h ) * sg[i];
-        strain(0)=  strainResultant(0)  - z*strainResultant(3);
-        strain(1)=  strainResultant(1)  - z*strainResultant(4);
-        strain(2)=  strainResultant(2)  - z*strainResultant(5);
-        strain(3)=  root56*strainResultant(6);
-        strain(4)=  root56*strainResultant(7);
-        success += theFibers[i]->setTrialStrain( strain );
+        double *strain= batch.getStrainPtr(i);
+        strain[0]=  strainResultant(0)  - z*strainResultant(3);
+        strain[1]=  strainResultant(1)  - z*strainResultant(4);
+        strain[2]=  strainResultant(2)  - z*strainResultant(5);
+        strain[3]=  root56*strainResultant(6);
+        strain[4]=  root56*strainResultant(7);
       } //end for i
-    return success;
+    // all the fibers with a single call.
+    return batch.setTrialStrains(theFibers);
   }
 
 
@@ -245,10 +274,19 @@ const XC::Vector &XC::MembranePlateFiberSection::getSectionDeformation(void) con
   { return strainResultant; }
 
 
+//! @brief Return the stresses and tangents of the fibers (reading them
+//! from the materials if they are outdated).
+const XC::NDMaterialBatch &XC::MembranePlateFiberSection::getUpdatedBatch(void) const
+  {
+    if(!batch.isValid())
+      batch.update(theFibers);
+    return batch;
+  }
+
 //! @brief Return stress resultant.
 const XC::Vector &XC::MembranePlateFiberSection::getStressResultant(void) const
   {
-    static Vector stress(5);
+    const NDMaterialBatch &fibers= getUpdatedBatch();
     double z= 0.0, weight= 0.0;
     stressResultant.Zero( );
 
@@ -256,18 +294,18 @@ const XC::Vector &XC::MembranePlateFiberSection::getStressResultant(void) const
       {
         z= ( 0.5*h ) * sg[i];
         weight= ( 0.5*h ) * wg[i];
-        stress= theFibers[i]->getStress( );
+        const double *stress= fibers.getStressPtr(i);
         //membrane
-        stressResultant(0)+= stress(0)*weight;
-        stressResultant(1)+= stress(1)*weight;
-        stressResultant(2)+= stress(2)*weight;
+        stressResultant(0)+= stress[0]*weight;
+        stressResultant(1)+= stress[1]*weight;
+        stressResultant(2)+= stress[2]*weight;
         //bending moments
-        stressResultant(3)+= ( z*stress(0) ) * weight;
-        stressResultant(4)+= ( z*stress(1) ) * weight;
-        stressResultant(5)+= ( z*stress(2) ) * weight;
+        stressResultant(3)+= ( z*stress[0] ) * weight;
+        stressResultant(4)+= ( z*stress[1] ) * weight;
+        stressResultant(5)+= ( z*stress[2] ) * weight;
         //shear
-        stressResultant(6)+= stress(3)*weight;
-        stressResultant(7)+= stress(4)*weight;
+        stressResultant(6)+= stress[3]*weight;
+        stressResultant(7)+= stress[4]*weight;
       } //end for i
     //modify shear 
     stressResultant(6)*= root56;  
@@ -283,6 +321,7 @@ const XC::Matrix &XC::MembranePlateFiberSection::getSectionTangent(void) const
     static Matrix Aeps(5,8);
     static Matrix Asig(8,5);
 
+    const NDMaterialBatch &fibers= getUpdatedBatch();
     double z, weight;
     tangent.Zero( );
 
@@ -324,8 +363,10 @@ const XC::Matrix &XC::MembranePlateFiberSection::getSectionTangent(void) const
       Asig(7,4)= root56;
 */
       //compute the tangent
-      dd = theFibers[i]->getTangent( );
-      dd *= weight;
+      const double *fiberTangent= fibers.getTangentPtr(i);
+      for(int k= 0;k<5;k++)
+        for(int j= 0;j<5;j++)
+          dd(j,k)= fiberTangent[k*5+j]*weight;
 
       //tangent +=  ( Asig * dd * Aeps );   
 
@@ -345,7 +386,7 @@ const XC::Matrix &XC::MembranePlateFiberSection::getSectionTangent(void) const
       tangent(0,1) +=  dd(0,1);
       tangent(0,2) +=  dd(0,2);      
       tangent(0,3) +=  -z*dd(0,0);      
-      tangent(0,3) +=  -z*dd(0,1);
+      tangent(0,4) +=  -z*dd(0,1);
       tangent(0,5) +=  -z*dd(0,2);
       tangent(0,6) +=  root56*dd(0,3);
       tangent(0,7) +=  root56*dd(0,4);
@@ -466,6 +507,7 @@ int XC::MembranePlateFiberSection::recvData(const CommParameters &cp)
     theFibers[3]= cp.getBrokedMaterial(theFibers[3],getDbTagData(),BrokedPtrCommMetaData(16,17,18));
     theFibers[4]= cp.getBrokedMaterial(theFibers[4],getDbTagData(),BrokedPtrCommMetaData(19,20,21));
     res+= cp.receiveVector(strainResultant,getDbTagData(),CommMetaData(22));
+    batch.invalidate();
     return res;
   }
 
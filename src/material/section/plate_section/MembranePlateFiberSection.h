@@ -59,6 +59,7 @@
 #include <utility/matrix/Vector.h>
 #include <utility/matrix/Matrix.h>
 #include "PlateBase.h"
+#include "material/nD/NDMaterialBatch.h"
 
 
 namespace XC {
@@ -77,8 +78,10 @@ class MembranePlateFiberSection: public PlateBase
     NDMaterial *theFibers[5];  //pointers to five materials (fibers)
     static const double root56; // =sqrt(5/6) 
     Vector strainResultant;
+    mutable NDMaterialBatch batch; //!< strains, stresses and tangents of the fibers.
     static Vector stressResultant;
     static Matrix tangent;
+    const NDMaterialBatch &getUpdatedBatch(void) const;
   protected:
     int sendData(CommParameters &);
     int recvData(const CommParameters &);
@@ -89,6 +92,7 @@ class MembranePlateFiberSection: public PlateBase
     virtual ~MembranePlateFiberSection(void);
 
     SectionForceDeformation *getCopy(void) const;
+    void setMaterial(const std::string &);
     double getRho(void) const;
     int getOrder(void) const;
     const ResponseId &getType(void) const;
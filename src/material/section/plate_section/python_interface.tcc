@@ -39,5 +39,8 @@ typedef XC::ElasticPlateProto<5> ElasticPlateProto5;
 class_<ElasticPlateProto5, bases<XC::ElasticPlateBase>, boost::noncopyable >("ElasticPlateProto5", no_init);
 class_<XC::ElasticPlateSection, bases<ElasticPlateProto5>, boost::noncopyable >("ElasticPlateSection", no_init);
 
-class_<XC::MembranePlateFiberSection, bases<XC::SectionForceDeformation>, boost::noncopyable >("MembranePlateFiberSection", no_init);
+class_<XC::MembranePlateFiberSection, bases<XC::SectionForceDeformation>, boost::noncopyable >("MembranePlateFiberSection", no_init)
+  .add_property("h", &XC::MembranePlateFiberSection::getH, &XC::MembranePlateFiberSection::setH,"material thickness.")
+  .def("setMaterial", &XC::MembranePlateFiberSection::setMaterial,"setMaterial(name): assign a copy of the nD material to each fiber.")
+  ;
 
@@ -161,29 +161,29 @@ mom1n(0.0), rot1n(0.0), mom2n(0.0), rot2n(0.0), mom3n(0.0), rot3n(0.0)
 
 int XC::HystereticMaterial::setTrialStrain(double strain, double strainRate)
   {
-    TrotMax = CrotMax;
-    TrotMin = CrotMin;
-    TenergyD = CenergyD;
-    TrotPu = CrotPu;
-    TrotNu = CrotNu;
+    hstv.T->rotMax = hstv.C->rotMax;
+    hstv.T->rotMin = hstv.C->rotMin;
+    hstv.T->energyD = hstv.C->energyD;
+    hstv.T->rotPu = hstv.C->rotPu;
+    hstv.T->rotNu = hstv.C->rotNu;
 
-        trial.Strain() = strain;
-        double dStrain = trial.getStrain() - converged.getStrain();
+        hstv.T->strain = strain;
+        double dStrain = hstv.T->strain - hstv.C->strain;
 
-        TloadIndicator = CloadIndicator;
+        hstv.T->loadIndicator = hstv.C->loadIndicator;
         
-        if(TloadIndicator == 0)
-                TloadIndicator = (dStrain < 0.0) ? 2 : 1;
+        if(hstv.T->loadIndicator == 0)
+                hstv.T->loadIndicator = (dStrain < 0.0) ? 2 : 1;
 
-        if(trial.getStrain() >= CrotMax) {
-                TrotMax = trial.getStrain();
-                trial.Tangent()= posEnvlpTangent(trial.getStrain());
-                trial.Stress()= posEnvlpStress(trial.getStrain());
+        if(hstv.T->strain >= hstv.C->rotMax) {
+                hstv.T->rotMax = hstv.T->strain;
+                hstv.T->tangent= posEnvlpTangent(hstv.T->strain);
+                hstv.T->stress= posEnvlpStress(hstv.T->strain);
         }
-        else if(trial.getStrain() <= CrotMin) {
-                TrotMin = trial.getStrain();
-                trial.Tangent()= negEnvlpTangent(trial.getStrain());
-                trial.Stress()= negEnvlpStress(trial.getStrain());
+        else if(hstv.T->strain <= hstv.C->rotMin) {
+                hstv.T->rotMin = hstv.T->strain;
+                hstv.T->tangent= negEnvlpTangent(hstv.T->strain);
+                hstv.T->stress= negEnvlpStress(hstv.T->strain);
         }
         else {
           if(dStrain < 0.0)
@@ -192,219 +192,209 @@ int XC::HystereticMaterial::setTrialStrain(double strain, double strainRate)
             positiveIncrement(dStrain);
         }
 
-        TenergyD = CenergyD + 0.5*(converged.getStress()+trial.getStress())*dStrain;
+        hstv.T->energyD = hstv.C->energyD + 0.5*(hstv.C->stress+hstv.T->stress)*dStrain;
 
         return 0;
 }
 
 
 double XC::HystereticMaterial::getStrain(void) const
-  { return trial.getStrain(); }
+  { return hstv.T->strain; }
 
 double XC::HystereticMaterial::getStress(void) const
-  { return trial.getStress(); }
+  { return hstv.T->stress; }
 
 double XC::HystereticMaterial::getTangent(void) const
-  { return trial.getTangent(); }
+  { return hstv.T->tangent; }
 
 void XC::HystereticMaterial::positiveIncrement(double dStrain)
   {
-        double kn = pow(CrotMin/rot1n,beta);
+        double kn = pow(hstv.C->rotMin/rot1n,beta);
         kn = (kn < 1.0) ? 1.0 : 1.0/kn;
-        double kp = pow(CrotMax/rot1p,beta);
+        double kp = pow(hstv.C->rotMax/rot1p,beta);
         kp = (kp < 1.0) ? 1.0 : 1.0/kp;
 
-        if(TloadIndicator == 2) {
-                TloadIndicator = 1;
-                if(converged.getStress() <= 0.0) {
-                        TrotNu = converged.getStrain() - converged.getStress()/(E1n*kn);
-                        double energy = CenergyD - 0.5*converged.getStress()/(E1n*kn)*converged.getStress();
+        if(hstv.T->loadIndicator == 2) {
+                hstv.T->loadIndicator = 1;
+                if(hstv.C->stress <= 0.0) {
+                        hstv.T->rotNu = hstv.C->strain - hstv.C->stress/(E1n*kn);
+                        double energy = hstv.C->energyD - 0.5*hstv.C->stress/(E1n*kn)*hstv.C->stress;
                         double damfc = 0.0;
-                        if(CrotMin < rot1n) {
+                        if(hstv.C->rotMin < rot1n) {
                                 damfc = damfc2*energy/energyA;
-                                damfc += damfc1*(CrotMin-rot1n)/rot1n;
+                                damfc += damfc1*(hstv.C->rotMin-rot1n)/rot1n;
                         }
 
-                        TrotMax = CrotMax*(1.0+damfc);
+                        hstv.T->rotMax = hstv.C->rotMax*(1.0+damfc);
                 }
         }
 
-  TloadIndicator = 1;
+  hstv.T->loadIndicator = 1;
 
-        TrotMax = (TrotMax > rot1p) ? TrotMax : rot1p;
+        hstv.T->rotMax = (hstv.T->rotMax > rot1p) ? hstv.T->rotMax : rot1p;
 
-        double maxmom = posEnvlpStress(TrotMax);
-        double rotlim = negEnvlpRotlim(CrotMin);
-        double rotrel = (rotlim > TrotNu) ? rotlim : TrotNu;
-        rotrel = TrotNu;
-        if(negEnvlpStress(CrotMin) >= 0.0)
+        double maxmom = posEnvlpStress(hstv.T->rotMax);
+        double rotlim = negEnvlpRotlim(hstv.C->rotMin);
+        double rotrel = (rotlim > hstv.T->rotNu) ? rotlim : hstv.T->rotNu;
+        rotrel = hstv.T->rotNu;
+        if(negEnvlpStress(hstv.C->rotMin) >= 0.0)
           rotrel = rotlim;
 
-        double rotmp1 = rotrel + pinchY*(TrotMax-rotrel);
-        double rotmp2 = TrotMax - (1.0-pinchY)*maxmom/(E1p*kp);
+        double rotmp1 = rotrel + pinchY*(hstv.T->rotMax-rotrel);
+        double rotmp2 = hstv.T->rotMax - (1.0-pinchY)*maxmom/(E1p*kp);
         double rotch = rotmp1 + (rotmp2-rotmp1)*pinchX;
 
         double tmpmo1;
         double tmpmo2;
 
-        if(trial.getStrain() < TrotNu) {
-                trial.Tangent()= E1n*kn;
-                trial.Stress() = converged.getStress() + trial.getTangent()*dStrain;
-                if(trial.getStress() >= 0.0)
+        if(hstv.T->strain < hstv.T->rotNu) {
+                hstv.T->tangent= E1n*kn;
+                hstv.T->stress = hstv.C->stress + hstv.T->tangent*dStrain;
+                if(hstv.T->stress >= 0.0)
                   {
-                        trial.Stress() = 0.0;
-                        trial.Tangent()= E1n*1.0e-9;
+                        hstv.T->stress = 0.0;
+                        hstv.T->tangent= E1n*1.0e-9;
                 }
         }
 
-        else if(trial.getStrain() >= TrotNu && trial.getStrain() < rotch) {
-                if(trial.getStrain() <= rotrel) {
-                        trial.Stress()= 0.0;
-                        trial.Tangent()= E1p*1.0e-9;
+        else if(hstv.T->strain >= hstv.T->rotNu && hstv.T->strain < rotch) {
+                if(hstv.T->strain <= rotrel) {
+                        hstv.T->stress= 0.0;
+                        hstv.T->tangent= E1p*1.0e-9;
                 }
                 else {
-                        trial.Tangent()= maxmom*pinchY/(rotch-rotrel);
-                        tmpmo1 = converged.getStress() + E1p*kp*dStrain;
-                        tmpmo2 = (trial.getStrain()-rotrel)*trial.getTangent();
+                        hstv.T->tangent= maxmom*pinchY/(rotch-rotrel);
+                        tmpmo1 = hstv.C->stress + E1p*kp*dStrain;
+                        tmpmo2 = (hstv.T->strain-rotrel)*hstv.T->tangent;
                         if(tmpmo1 < tmpmo2) {
-                                trial.Stress()= tmpmo1;
-                                trial.Tangent()= E1p*kp;
+                                hstv.T->stress= tmpmo1;
+                                hstv.T->tangent= E1p*kp;
                         }
                         else
-                                trial.Stress()= tmpmo2;
+                                hstv.T->stress= tmpmo2;
                 }
         }
 
         else {
-                trial.Tangent()= (1.0-pinchY)*maxmom/(TrotMax-rotch);
-                tmpmo1 = converged.getStress() + E1p*kp*dStrain;
-                tmpmo2 = pinchY*maxmom + (trial.getStrain()-rotch)*trial.getTangent();
+                hstv.T->tangent= (1.0-pinchY)*maxmom/(hstv.T->rotMax-rotch);
+                tmpmo1 = hstv.C->stress + E1p*kp*dStrain;
+                tmpmo2 = pinchY*maxmom + (hstv.T->strain-rotch)*hstv.T->tangent;
                 if(tmpmo1 < tmpmo2) {
-                        trial.Stress()= tmpmo1;
-                        trial.Tangent()= E1p*kp;
+                        hstv.T->stress= tmpmo1;
+                        hstv.T->tangent= E1p*kp;
                 }
                 else
-                        trial.Stress()= tmpmo2;
+                        hstv.T->stress= tmpmo2;
         }
 }
 
 void XC::HystereticMaterial::negativeIncrement(double dStrain)
 {
-        double kn = pow(CrotMin/rot1n,beta);
+        double kn = pow(hstv.C->rotMin/rot1n,beta);
         kn = (kn < 1.0) ? 1.0 : 1.0/kn;
-        double kp = pow(CrotMax/rot1p,beta);
+        double kp = pow(hstv.C->rotMax/rot1p,beta);
         kp = (kp < 1.0) ? 1.0 : 1.0/kp;
 
-        if(TloadIndicator == 1) {
-                TloadIndicator = 2;
-                if(converged.getStress() >= 0.0) {
-                        TrotPu = converged.getStrain() - converged.getStress()/(E1p*kp);
-                        double energy = CenergyD - 0.5*converged.getStress()/(E1p*kp)*converged.getStress();
+        if(hstv.T->loadIndicator == 1) {
+                hstv.T->loadIndicator = 2;
+                if(hstv.C->stress >= 0.0) {
+                        hstv.T->rotPu = hstv.C->strain - hstv.C->stress/(E1p*kp);
+                        double energy = hstv.C->energyD - 0.5*hstv.C->stress/(E1p*kp)*hstv.C->stress;
                         double damfc = 0.0;
-                        if(CrotMax > rot1p) {
+                        if(hstv.C->rotMax > rot1p) {
                                 damfc = damfc2*energy/energyA;
-                                damfc += damfc1*(CrotMax-rot1p)/rot1p;
+                                damfc += damfc1*(hstv.C->rotMax-rot1p)/rot1p;
                         }
 
-                        TrotMin = CrotMin*(1.0+damfc);
+                        hstv.T->rotMin = hstv.C->rotMin*(1.0+damfc);
                 }
         }
 
-  TloadIndicator = 2;
+  hstv.T->loadIndicator = 2;
 
-        TrotMin = (TrotMin < rot1n) ? TrotMin : rot1n;
+        hstv.T->rotMin = (hstv.T->rotMin < rot1n) ? hstv.T->rotMin : rot1n;
 
-        double minmom = negEnvlpStress(TrotMin);
-        double rotlim = posEnvlpRotlim(CrotMax);
-        double rotrel = (rotlim < TrotPu) ? rotlim : TrotPu;
-        rotrel = TrotPu;
-        if(posEnvlpStress(CrotMax) <= 0.0)
+        double minmom = negEnvlpStress(hstv.T->rotMin);
+        double rotlim = posEnvlpRotlim(hstv.C->rotMax);
+        double rotrel = (rotlim < hstv.T->rotPu) ? rotlim : hstv.T->rotPu;
+        rotrel = hstv.T->rotPu;
+        if(posEnvlpStress(hstv.C->rotMax) <= 0.0)
           rotrel = rotlim;
 
-        double rotmp1 = rotrel + pinchY*(TrotMin-rotrel);
-        double rotmp2 = TrotMin - (1.0-pinchY)*minmom/(E1n*kn);
+        double rotmp1 = rotrel + pinchY*(hstv.T->rotMin-rotrel);
+        double rotmp2 = hstv.T->rotMin - (1.0-pinchY)*minmom/(E1n*kn);
         double rotch = rotmp1 + (rotmp2-rotmp1)*pinchX;
 
         double tmpmo1;
         double tmpmo2;
 
-        if(trial.getStrain() > TrotPu) {
-                trial.Tangent()= E1p*kp;
-                trial.Stress()= converged.getStress() + trial.getTangent()*dStrain;
-                if(trial.getStress() <= 0.0) {
-                        trial.Stress()= 0.0;
-                        trial.Tangent()= E1p*1.0e-9;
+        if(hstv.T->strain > hstv.T->rotPu) {
+                hstv.T->tangent= E1p*kp;
+                hstv.T->stress= hstv.C->stress + hstv.T->tangent*dStrain;
+                if(hstv.T->stress <= 0.0) {
+                        hstv.T->stress= 0.0;
+                        hstv.T->tangent= E1p*1.0e-9;
                 }
         }
 
-        else if(trial.getStrain() <= TrotPu && trial.getStrain() > rotch) {
-                if(trial.getStrain() >= rotrel) {
-                        trial.Stress()= 0.0;
-                        trial.Tangent()= E1n*1.0e-9;
+        else if(hstv.T->strain <= hstv.T->rotPu && hstv.T->strain > rotch) {
+                if(hstv.T->strain >= rotrel) {
+                        hstv.T->stress= 0.0;
+                        hstv.T->tangent= E1n*1.0e-9;
                 }
                 else {
-                        trial.Tangent()= minmom*pinchY/(rotch-rotrel);
-                        tmpmo1 = converged.getStress() + E1n*kn*dStrain;
-                        tmpmo2 = (trial.getStrain()-rotrel)*trial.getTangent();
+                        hstv.T->tangent= minmom*pinchY/(rotch-rotrel);
+                        tmpmo1 = hstv.C->stress + E1n*kn*dStrain;
+                        tmpmo2 = (hstv.T->strain-rotrel)*hstv.T->tangent;
                         if(tmpmo1 > tmpmo2) {
-                                trial.Stress()= tmpmo1;
-                                trial.Tangent()= E1n*kn;
+                                hstv.T->stress= tmpmo1;
+                                hstv.T->tangent= E1n*kn;
                         }
                         else
-                                trial.Stress()= tmpmo2;
+                                hstv.T->stress= tmpmo2;
                 }
         }
 
         else {
-                trial.Tangent()= (1.0-pinchY)*minmom/(TrotMin-rotch);
-                tmpmo1 = converged.getStress() + E1n*kn*dStrain;
-                tmpmo2 = pinchY*minmom + (trial.getStrain()-rotch)*trial.getTangent();
+                hstv.T->tangent= (1.0-pinchY)*minmom/(hstv.T->rotMin-rotch);
+                tmpmo1 = hstv.C->stress + E1n*kn*dStrain;
+                tmpmo2 = pinchY*minmom + (hstv.T->strain-rotch)*hstv.T->tangent;
                 if(tmpmo1 > tmpmo2) {
-                        trial.Stress()= tmpmo1;
-                        trial.Tangent()= E1n*kn;
+                        hstv.T->stress= tmpmo1;
+                        hstv.T->tangent= E1n*kn;
                 }
                 else
-                        trial.Stress()= tmpmo2;
+                        hstv.T->stress= tmpmo2;
         }
 }
 
 int XC::HystereticMaterial::commitState(void)
   {
-    CrotMax = TrotMax;
-    CrotMin = TrotMin;
-    CrotPu = TrotPu;
-    CrotNu = TrotNu;
-    CenergyD = TenergyD;
-    CloadIndicator = TloadIndicator;
-        
-    converged= trial;
+    hstv.commit(); // History and state variables
     return 0;
   }
 
 int XC::HystereticMaterial::revertToLastCommit(void)
   {
-    TrotMax = CrotMax;
-    TrotMin = CrotMin;
-    TrotPu = CrotPu;
-    TrotNu = CrotNu;
-    TenergyD = CenergyD;
-    TloadIndicator = CloadIndicator;
-
-    trial= converged;
+    hstv.revert(); // History and state variables
     return 0;
   }
 
 int XC::HystereticMaterial::revertToStart(void)
   {
-    CrotMax = 0.0;
-    CrotMin = 0.0;
-    CrotPu = 0.0;
-    CrotNu = 0.0;
-    CenergyD = 0.0;
-    CloadIndicator = 0;
-
-    converged.revertToStart(E1p);
-    trial.revertToStart(E1p);
+    hstv.C->rotMax = 0.0;
+    hstv.C->rotMin = 0.0;
+    hstv.C->rotPu = 0.0;
+    hstv.C->rotNu = 0.0;
+    hstv.C->energyD = 0.0;
+    hstv.C->loadIndicator = 0;
+
+    hstv.C->strain= 0.0;
+    hstv.C->stress= 0.0;
+    hstv.C->tangent= E1p;
+    hstv.T->strain= 0.0;
+    hstv.T->stress= 0.0;
+    hstv.T->tangent= E1p;
     return 0;
   }
 
@@ -418,12 +408,11 @@ int XC::HystereticMaterial::sendData(CommParameters &cp)
     res+= cp.sendDoubles(pinchX,pinchY,damfc1,damfc2,beta,energyA,getDbTagData(),CommMetaData(2));
     res+= cp.sendDoubles(mom1p,rot1p,mom2p,rot2p,mom3p,rot3p,getDbTagData(),CommMetaData(3));
     res+= cp.sendDoubles(mom1n,rot1n,mom2n,rot2n,mom3n,rot3n,getDbTagData(),CommMetaData(4));
-    res+= cp.sendDoubles(CrotMax,CrotMin,CrotPu,CrotNu,CenergyD,getDbTagData(),CommMetaData(5));
-    res+= cp.sendDoubles(TrotMax,TrotMin,TrotPu,TrotNu,TenergyD,getDbTagData(),CommMetaData(6));
-    res+= cp.sendMovable(converged,getDbTagData(),CommMetaData(7));
-    res+= cp.sendMovable(trial,getDbTagData(),CommMetaData(8));
-    res+= cp.sendDoubles(E1p,E1n,E2p,E2n,E3p,E3n,getDbTagData(),CommMetaData(9));
-    res+= cp.sendInts(CloadIndicator,TloadIndicator,getDbTagData(),CommMetaData(10));
+    res+= cp.sendDoubles(hstv.C->rotMax,hstv.C->rotMin,hstv.C->rotPu,hstv.C->rotNu,hstv.C->energyD,getDbTagData(),CommMetaData(5));
+    res+= cp.sendDoubles(hstv.T->rotMax,hstv.T->rotMin,hstv.T->rotPu,hstv.T->rotNu,hstv.T->energyD,getDbTagData(),CommMetaData(6));
+    res+= cp.sendDoubles(hstv.C->strain,hstv.C->stress,hstv.C->tangent,hstv.T->strain,hstv.T->stress,hstv.T->tangent,getDbTagData(),CommMetaData(7));
+    res+= cp.sendDoubles(E1p,E1n,E2p,E2n,E3p,E3n,getDbTagData(),CommMetaData(8));
+    res+= cp.sendInts(hstv.C->loadIndicator,hstv.T->loadIndicator,getDbTagData(),CommMetaData(9));
     return res;
   }
 
@@ -434,12 +423,11 @@ int XC::HystereticMaterial::recvData(const CommParameters &cp)
     res+= cp.receiveDoubles(pinchX,pinchY,damfc1,damfc2,beta,energyA,getDbTagData(),CommMetaData(2));
     res+= cp.receiveDoubles(mom1p,rot1p,mom2p,rot2p,mom3p,rot3p,getDbTagData(),CommMetaData(3));
     res+= cp.receiveDoubles(mom1n,rot1n,mom2n,rot2n,mom3n,rot3n,getDbTagData(),CommMetaData(4));
-    res+= cp.receiveDoubles(CrotMax,CrotMin,CrotPu,CrotNu,CenergyD,getDbTagData(),CommMetaData(5));
-    res+= cp.receiveDoubles(TrotMax,TrotMin,TrotPu,TrotNu,TenergyD,getDbTagData(),CommMetaData(6));
-    res+= cp.receiveMovable(converged,getDbTagData(),CommMetaData(7));
-    res+= cp.receiveMovable(trial,getDbTagData(),CommMetaData(8));
-    res+= cp.receiveDoubles(E1p,E1n,E2p,E2n,E3p,E3n,getDbTagData(),CommMetaData(9));
-    res+= cp.receiveInts(CloadIndicator,TloadIndicator,getDbTagData(),CommMetaData(10));
+    res+= cp.receiveDoubles(hstv.C->rotMax,hstv.C->rotMin,hstv.C->rotPu,hstv.C->rotNu,hstv.C->energyD,getDbTagData(),CommMetaData(5));
+    res+= cp.receiveDoubles(hstv.T->rotMax,hstv.T->rotMin,hstv.T->rotPu,hstv.T->rotNu,hstv.T->energyD,getDbTagData(),CommMetaData(6));
+    res+= cp.receiveDoubles(hstv.C->strain,hstv.C->stress,hstv.C->tangent,hstv.T->strain,hstv.T->stress,hstv.T->tangent,getDbTagData(),CommMetaData(7));
+    res+= cp.receiveDoubles(E1p,E1n,E2p,E2n,E3p,E3n,getDbTagData(),CommMetaData(8));
+    res+= cp.receiveInts(hstv.C->loadIndicator,hstv.T->loadIndicator,getDbTagData(),CommMetaData(9));
     return res;
   }
 
@@ -62,9 +62,26 @@
 #define HystereticMaterial_h
 
 #include "UniaxialMaterial.h"
-#include "UniaxialStateVars.h"
+#include "material/MaterialStateVars.h"
 
 namespace XC {
+
+//! @ingroup MatUnx
+//
+//! @brief History and state variables of the hysteretic material.
+struct HystereticMaterialState
+  {
+    double rotMax;
+    double rotMin;
+    double rotPu;
+    double rotNu;
+    double energyD;
+    int loadIndicator;
+    double strain;
+    double stress;
+    double tangent;
+  };
+
 //! @ingroup MatUnx
 //
 //! @brief HystereticMaterial provides the implementation
@@ -86,27 +103,8 @@ class HystereticMaterial: public UniaxialMaterial
     // Unloading parameter
     double beta;
 
-    // Trial history variables
-    double TrotMax;
-    double TrotMin;
-    double TrotPu;
-    double TrotNu;
-    double TenergyD;
-    int TloadIndicator;
-
-    // Trial state variables
-    UniaxialStateVars trial;
-
-    // Converged history variables
-    double CrotMax;
-    double CrotMin;
-    double CrotPu;
-    double CrotNu;
-    double CenergyD;
-    int CloadIndicator;
-
-    // Converged state variables
-    UniaxialStateVars converged;
+    // History and state variables (converged: hstv.C, trial: hstv.T)
+    MaterialStateVars<HystereticMaterialState> hstv;
 
     // Backbone parameters
     double mom1p, rot1p;
@@ -164,6 +162,9 @@ class HystereticMaterial: public UniaxialMaterial
 
     int commitState(void);
     int revertToLastCommit(void);
+    //! @brief Return true if the state variables are in the store of the mesh.
+    bool isStateInStore(void) const
+      { return hstv.isAttached(); }
     int revertToStart(void);
 
     UniaxialMaterial *getCopy(void) const;
@@ -87,9 +87,9 @@ void XC::Concrete01::setup_parameters(void)
   {
     // Initial tangent
     const double Ec0= 2*fpc/epsc0;
-    convergedState.Tangent()= Ec0;
-    convergedHistory.UnloadSlope()= Ec0;
-    trialState.Tangent()= Ec0;
+    hstv.C->tangent= Ec0;
+    hstv.C->unloadSlope= Ec0;
+    hstv.T->tangent= Ec0;
     // Set trial values
     revertToLastCommit();
   }
@@ -144,30 +144,30 @@ XC::Concrete01::~Concrete01(void)
 //! @brief Calculate the trial state given the change in strain
 void XC::Concrete01::calcula_trial_state(const double &dStrain)
   {
-    trialHistory.UnloadSlope()= convergedHistory.getUnloadSlope(); //Reset unload slope.
+    hstv.T->unloadSlope= hstv.C->unloadSlope; //Reset unload slope.
   
-    const double unloadStress= convergedState.getStress() + trialHistory.getUnloadSlope()*dStrain; //Stress when unloading.
+    const double unloadStress= hstv.C->stress + hstv.T->unloadSlope*dStrain; //Stress when unloading.
   
     if(dStrain <= 0.0) // Material goes further into compression
       {
-        trialHistory.MinStrain()= convergedHistory.getMinStrain(); //Reset min strain.
-        trialHistory.EndStrain()= convergedHistory.getEndStrain(); //Reset end strain.
+        hstv.T->minStrain= hstv.C->minStrain; //Reset min strain.
+        hstv.T->endStrain= hstv.C->endStrain; //Reset end strain.
         reload();
-        if(unloadStress > trialState.getStress() )
+        if(unloadStress > hstv.T->stress )
           {
-            trialState.Stress()= unloadStress;
-            trialState.Tangent()= trialHistory.getUnloadSlope();
+            hstv.T->stress= unloadStress;
+            hstv.T->tangent= hstv.T->unloadSlope;
           }
       }
     else if(unloadStress <= 0.0) // Material goes TOWARD tension (dStrain>0 and unloadStress<0.0)
       {
-        trialState.Stress()= unloadStress;
-        trialState.Tangent()= trialHistory.getUnloadSlope();
+        hstv.T->stress= unloadStress;
+        hstv.T->tangent= hstv.T->unloadSlope;
       }
     else // Made it into tension
       {
-        trialState.Stress()= 0.0;
-        trialState.Tangent()= 0.0;
+        hstv.T->stress= 0.0;
+        hstv.T->tangent= 0.0;
       }
   }
 //! @brief Sets the trial strain value.
@@ -177,19 +177,19 @@ int XC::Concrete01::setTrialStrain(double strain, double strainRate)
     commit_to_trial_state();
 
     // Determine change in strain from last converged state
-    const double dStrain= strain - convergedState.getStrain();
+    const double dStrain= strain - hstv.C->strain;
 
     if(fabs(dStrain) < DBL_EPSILON)
       return 0; //If the change is very small we do nothing.
 
     // Set trial strain
-    trialState.Strain()= strain;
+    hstv.T->strain= strain;
   
     // check for a quick return
-    if(trialState.getStrain() > 0.0)
+    if(hstv.T->strain > 0.0)
       {
-        trialState.Stress()= 0;
-        trialState.Tangent()= 0;
+        hstv.T->stress= 0;
+        hstv.T->tangent= 0;
         return 0;
       }
   
@@ -206,23 +206,23 @@ int XC::Concrete01::setTrial(double strain, double &stress, double &tangent, dou
     commit_to_trial_state();
 
     // Determine change in strain from last converged state
-    const double dStrain= strain - convergedState.getStrain();
+    const double dStrain= strain - hstv.C->strain;
 
     if(fabs(dStrain) < DBL_EPSILON)
       {
-        stress= trialState.getStress();
-        tangent= trialState.getTangent();
+        stress= hstv.T->stress;
+        tangent= hstv.T->tangent;
         return 0;
       }
 
     // Set trial strain
-    trialState.Strain()= strain;
+    hstv.T->strain= strain;
   
     // check for a quick return
-    if(trialState.getStrain() > 0.0)
+    if(hstv.T->strain > 0.0)
       {
-        trialState.Stress()= 0;
-        trialState.Tangent()= 0;
+        hstv.T->stress= 0;
+        hstv.T->tangent= 0;
         stress= 0;
         tangent= 0;
         return 0;
@@ -232,88 +232,88 @@ int XC::Concrete01::setTrial(double strain, double &stress, double &tangent, dou
     // Calculate the trial state given the change in strain
     // determineTrialState (dStrain);
     calcula_trial_state(dStrain);
-    stress= trialState.getStress();
-    tangent=  trialState.getTangent();
+    stress= hstv.T->stress;
+    tangent=  hstv.T->tangent;
     return 0;
   }
 
 //! @brief ??
 void XC::Concrete01::determineTrialState(double dStrain)
   {
-    trialHistory= convergedHistory;
+    commit_to_trial_history();
 
-    const double tempStress= convergedState.getStress() + trialHistory.getUnloadSlope()*dStrain;
+    const double tempStress= hstv.C->stress + hstv.T->unloadSlope*dStrain;
 
     // Material goes further into compression
-    if(trialState.getStrain() <= convergedState.getStrain())
+    if(hstv.T->strain <= hstv.C->strain)
       {
         reload();
-        if(tempStress > trialState.getStress() )
+        if(tempStress > hstv.T->stress )
           {
-            trialState.Stress()= tempStress;
-            trialState.Tangent()= trialHistory.getUnloadSlope();
+            hstv.T->stress= tempStress;
+            hstv.T->tangent= hstv.T->unloadSlope;
           }
       }
     else if(tempStress <= 0.0) // Material goes TOWARD tension
       {
-        trialState.Stress()= tempStress;
-        trialState.Tangent()= trialHistory.getUnloadSlope();
+        hstv.T->stress= tempStress;
+        hstv.T->tangent= hstv.T->unloadSlope;
       }
     else // Made it into tension
       {
-        trialState.Stress()= 0.0;
-        trialState.Tangent()= 0.0;
+        hstv.T->stress= 0.0;
+        hstv.T->tangent= 0.0;
       }
   }
 
 //! @brief ??
 void XC::Concrete01::reload(void)
   {
-    if(trialState.getStrain() <= trialHistory.MinStrain())
+    if(hstv.T->strain <= hstv.T->minStrain)
       {
-        trialHistory.MinStrain()= trialState.getStrain();
+        hstv.T->minStrain= hstv.T->strain;
         // Determine point on envelope
         envelope();
         unload();
       }
-    else if(trialState.getStrain() <= trialHistory.EndStrain())
+    else if(hstv.T->strain <= hstv.T->endStrain)
       {
-        trialState.Tangent()= trialHistory.getUnloadSlope();
-        trialState.Stress()= trialState.getTangent()*(trialState.getStrain()-trialHistory.EndStrain());
+        hstv.T->tangent= hstv.T->unloadSlope;
+        hstv.T->stress= hstv.T->tangent*(hstv.T->strain-hstv.T->endStrain);
       }
     else
       {
-        trialState.Stress()= 0.0;
-        trialState.Tangent()= 0.0;
+        hstv.T->stress= 0.0;
+        hstv.T->tangent= 0.0;
       }
   }
 
 //! @brief Determine point on envelope
 void XC::Concrete01::envelope(void)
   {
-     if(trialState.getStrain() > epsc0)
+     if(hstv.T->strain > epsc0)
        {
-         const double eta= trialState.getStrain()/epsc0;
-         trialState.Stress()= fpc*(2*eta-eta*eta);
+         const double eta= hstv.T->strain/epsc0;
+         hstv.T->stress= fpc*(2*eta-eta*eta);
          const double Ec0= 2.0*fpc/epsc0;
-         trialState.Tangent()= Ec0*(1.0-eta);
+         hstv.T->tangent= Ec0*(1.0-eta);
        }
-     else if(trialState.getStrain() > epscu)
+     else if(hstv.T->strain > epscu)
        {
-         trialState.Tangent()= (fpc-fpcu)/(epsc0-epscu);
-         trialState.Stress()= fpc + trialState.getTangent()*(trialState.getStrain()-epsc0);
+         hstv.T->tangent= (fpc-fpcu)/(epsc0-epscu);
+         hstv.T->stress= fpc + hstv.T->tangent*(hstv.T->strain-epsc0);
        }
      else
        {
-         trialState.Stress()= fpcu;
-         trialState.Tangent()= 0.0;
+         hstv.T->stress= fpcu;
+         hstv.T->tangent= 0.0;
        }
   }
 
 //! @brief ??
 void XC::Concrete01::unload(void)
   {
-    double tempStrain= trialHistory.getMinStrain();
+    double tempStrain= hstv.T->minStrain;
     if(tempStrain < epscu) tempStrain= epscu;
 
     const double eta= tempStrain/epsc0;
@@ -321,38 +321,37 @@ void XC::Concrete01::unload(void)
 
     if(eta < 2.0) ratio= 0.145*eta*eta + 0.13*eta;
 
-    trialHistory.EndStrain()= ratio*epsc0;
+    hstv.T->endStrain= ratio*epsc0;
 
-    const double temp1= trialHistory.getMinStrain() - trialHistory.getEndStrain();
+    const double temp1= hstv.T->minStrain - hstv.T->endStrain;
     const double Ec0= 2.0*fpc/epsc0;
-    const double temp2= trialState.getStress()/Ec0;
+    const double temp2= hstv.T->stress/Ec0;
 
     if(temp1 > -DBL_EPSILON) // temp1 should always be negative
-      { trialHistory.UnloadSlope()= Ec0; }
+      { hstv.T->unloadSlope= Ec0; }
     else if(temp1 <= temp2)
       {
-        trialHistory.EndStrain()= trialHistory.getMinStrain() - temp1;
-        trialHistory.UnloadSlope()= trialState.getStress() /temp1;
+        hstv.T->endStrain= hstv.T->minStrain - temp1;
+        hstv.T->unloadSlope= hstv.T->stress /temp1;
       }
     else
       {
-        trialHistory.EndStrain()= trialHistory.getMinStrain() - temp2;
-        trialHistory.UnloadSlope()= Ec0;
+        hstv.T->endStrain= hstv.T->minStrain - temp2;
+        hstv.T->unloadSlope= Ec0;
       }
   }
 
 //! @brief Commits material state.
 int XC::Concrete01::commitState(void)
   {
-    convergedHistory= trialHistory;// History variables
-    convergedState= trialState;// State variables
+    hstv.commit(); // History and state variables
     return 0;
   }
 
 //! @brief Returns to the last commited state.
 int XC::Concrete01::revertToLastCommit(void)
   {
-    commit_to_trial();
+    hstv.revert();
     return 0;
   }
 
@@ -360,8 +359,7 @@ int XC::Concrete01::revertToLastCommit(void)
 int XC::Concrete01::revertToStart(void)
   {
     const double Ec0= 2.0*fpc/epsc0;
-    convergedHistory.revertToStart(Ec0); // History variables
-    convergedState.revertToStart(Ec0);// State variables
+    revert_to_start(Ec0); // History and state variables
 
     // Reset trial variables and state
     revertToLastCommit();
@@ -529,24 +527,24 @@ double XC::Concrete01::getStressSensitivity(int gradNumber, bool conditional)
 
 
     // Strain increment
-    const double dStrain= trialState.getStrain() - convergedState.getStrain();
+    const double dStrain= hstv.T->strain - hstv.C->strain;
 
     // Evaluate stress sensitivity
     if(dStrain < 0.0)
       { // applying more compression to the material
-        if(trialState.getStrain() < convergedHistory.MinStrain())
+        if(hstv.T->strain < hstv.C->minStrain)
           { // loading along the backbone curve
-            if(trialState.getStrain() > epsc0)
+            if(hstv.T->strain > epsc0)
               { //on the parabola
 
-                trialStateSensitivity.Stress()= fpcSensitivity*(2.0*trialState.getStrain() /epsc0-(trialState.getStrain() /epsc0)*(trialState.getStrain() /epsc0))
-                 + fpc*( (2.0*trialStateSensitivity.Strain()*epsc0-2.0*trialState.getStrain() *epsc0Sensitivity)/(epsc0*epsc0)
-			 - 2.0*(trialState.getStrain() /epsc0)*(trialStateSensitivity.getStrain()*epsc0-trialState.getStrain() *epsc0Sensitivity)/(epsc0*epsc0));
+                trialStateSensitivity.Stress()= fpcSensitivity*(2.0*hstv.T->strain /epsc0-(hstv.T->strain /epsc0)*(hstv.T->strain /epsc0))
+                 + fpc*( (2.0*trialStateSensitivity.Strain()*epsc0-2.0*hstv.T->strain *epsc0Sensitivity)/(epsc0*epsc0)
+			 - 2.0*(hstv.T->strain /epsc0)*(trialStateSensitivity.getStrain()*epsc0-hstv.T->strain *epsc0Sensitivity)/(epsc0*epsc0));
                  dktdh= 2.0*((fpcSensitivity*epsc0-fpc*epsc0Sensitivity)/(epsc0*epsc0))
-                 * (1.0-trialState.getStrain() /epsc0)
-                 - 2.0*(fpc/epsc0)*(trialStateSensitivity.getStrain()*epsc0-trialState.getStrain() *epsc0Sensitivity) / (epsc0*epsc0);
+                 * (1.0-hstv.T->strain /epsc0)
+                 - 2.0*(fpc/epsc0)*(trialStateSensitivity.getStrain()*epsc0-hstv.T->strain *epsc0Sensitivity) / (epsc0*epsc0);
               }
-            else if(trialState.getStrain() > epscu)
+            else if(hstv.T->strain > epscu)
               {                // on the straight inclined line
 //cerr << "ON THE STRAIGHT INCLINED LINE" << endl;
                 dktdh= ( (fpcSensitivity-fpcuSensitivity)
@@ -556,7 +554,7 @@ double XC::Concrete01::getStressSensitivity(int gradNumber, bool conditional)
                          / ((epsc0-epscu)*(epsc0-epscu));
 
                 const double kt= (fpc-fpcu)/(epsc0-epscu);
-                trialStateSensitivity.Stress()= fpcSensitivity + dktdh*(trialState.getStrain() -epsc0)
+                trialStateSensitivity.Stress()= fpcSensitivity + dktdh*(hstv.T->strain -epsc0)
                                      + kt*(trialStateSensitivity.getStrain()-epsc0Sensitivity);
               }
             else
@@ -566,11 +564,11 @@ double XC::Concrete01::getStressSensitivity(int gradNumber, bool conditional)
                 dktdh= 0.0;
               }
          }
-       else if(trialState.getStrain() < convergedHistory.getEndStrain())
+       else if(hstv.T->strain < hstv.C->endStrain)
          {        // reloading after an unloading that didn't go all the way to zero stress
 //cerr << "RELOADING AFTER AN UNLOADING THAT DIDN'T GO ALL THE WAY DOWN" << endl;
-           trialStateSensitivity.Stress()= convergedHistorySensitivity.UnloadSlope() * (trialState.getStrain() -convergedHistory.getEndStrain())
-	     + convergedHistory.getUnloadSlope() * (trialStateSensitivity.getStrain()-convergedHistorySensitivity.getEndStrain());
+           trialStateSensitivity.Stress()= convergedHistorySensitivity.UnloadSlope() * (hstv.T->strain -hstv.C->endStrain)
+	     + hstv.C->unloadSlope * (trialStateSensitivity.getStrain()-convergedHistorySensitivity.getEndStrain());
            dktdh= convergedHistorySensitivity.getUnloadSlope();
          }
        else
@@ -579,12 +577,12 @@ double XC::Concrete01::getStressSensitivity(int gradNumber, bool conditional)
            dktdh= 0.0;
          }
      }
-   else if(convergedState.getStress()+convergedHistory.getUnloadSlope()*dStrain<0.0)
+   else if(hstv.C->stress+hstv.C->unloadSlope*dStrain<0.0)
      {// unloading, but not all the way down to zero stress
 //cerr << "UNLOADING, BUT NOT ALL THE WAY DOWN" << endl;
        trialStateSensitivity.Stress()= convergedStateSensitivity.getStress()
                             + convergedHistorySensitivity.getUnloadSlope()*dStrain
-	 + convergedHistory.getUnloadSlope()*(trialStateSensitivity.getStrain()-convergedStateSensitivity.getStrain());
+	 + hstv.C->unloadSlope*(trialStateSensitivity.getStrain()-convergedStateSensitivity.getStrain());
        dktdh= convergedHistorySensitivity.getUnloadSlope();
      }
    else
@@ -639,25 +637,25 @@ int XC::Concrete01::commitSensitivity(const double &strainGradient, int gradNumb
       }
 
     // Strain increment
-    const double dStrain= trialState.getStrain() - convergedState.getStrain();
+    const double dStrain= hstv.T->strain - hstv.C->strain;
 
     // Evaluate stress sensitivity
     if(dStrain < 0.0)
       { // applying more compression to the material
-        if(trialState.getStrain() < convergedHistory.MinStrain())
+        if(hstv.T->strain < hstv.C->minStrain)
           { // loading along the backbone curve
-            if(trialState.getStrain() > epsc0)
+            if(hstv.T->strain > epsc0)
               { //on the parabola
-                trialStateSensitivity.Stress()= fpcSensitivity*(2.0*trialState.getStrain() /epsc0-(trialState.getStrain() /epsc0)*(trialState.getStrain() /epsc0))
-                                     + fpc*( (2.0*trialStateSensitivity.Strain()*epsc0-2.0*trialState.getStrain() *epsc0Sensitivity)/(epsc0*epsc0)
-                                     - 2.0*(trialState.getStrain() /epsc0)*(trialStateSensitivity.Strain()*epsc0-trialState.getStrain() *epsc0Sensitivity)/(epsc0*epsc0));
+                trialStateSensitivity.Stress()= fpcSensitivity*(2.0*hstv.T->strain /epsc0-(hstv.T->strain /epsc0)*(hstv.T->strain /epsc0))
+                                     + fpc*( (2.0*trialStateSensitivity.Strain()*epsc0-2.0*hstv.T->strain *epsc0Sensitivity)/(epsc0*epsc0)
+                                     - 2.0*(hstv.T->strain /epsc0)*(trialStateSensitivity.Strain()*epsc0-hstv.T->strain *epsc0Sensitivity)/(epsc0*epsc0));
 
                 dktdh= 2.0*((fpcSensitivity*epsc0-fpc*epsc0Sensitivity)/(epsc0*epsc0))
-                           * (1.0-trialState.getStrain() /epsc0)
-                      - 2.0*(fpc/epsc0)*(trialStateSensitivity.Strain()*epsc0-trialState.getStrain() *epsc0Sensitivity)
+                           * (1.0-hstv.T->strain /epsc0)
+                      - 2.0*(fpc/epsc0)*(trialStateSensitivity.Strain()*epsc0-hstv.T->strain *epsc0Sensitivity)
                         / (epsc0*epsc0);
               }
-            else if(trialState.getStrain() > epscu)
+            else if(hstv.T->strain > epscu)
               { // on the straight inclined line
 
                 dktdh= ( (fpcSensitivity-fpcuSensitivity) * (epsc0-epscu)
@@ -666,7 +664,7 @@ int XC::Concrete01::commitSensitivity(const double &strainGradient, int gradNumb
                         / ((epsc0-epscu)*(epsc0-epscu));
                 const double kt= (fpc-fpcu)/(epsc0-epscu);
                 trialStateSensitivity.Stress()= fpcSensitivity
-                                     + dktdh*(trialState.getStrain() -epsc0)
+                                     + dktdh*(hstv.T->strain -epsc0)
                                      + kt*(trialStateSensitivity.Strain()-epsc0Sensitivity);
               }
             else
@@ -675,10 +673,10 @@ int XC::Concrete01::commitSensitivity(const double &strainGradient, int gradNumb
                 dktdh= 0.0;
               }
           }
-        else if(trialState.getStrain() < convergedHistory.getEndStrain())
+        else if(hstv.T->strain < hstv.C->endStrain)
           { // reloading after an unloading that didn't go all the way to zero stress
-            trialStateSensitivity.Stress()= convergedHistorySensitivity.getUnloadSlope() * (trialState.getStrain() -convergedHistory.getEndStrain())
-                                 + convergedHistory.getUnloadSlope() * (trialStateSensitivity.Strain()-convergedHistorySensitivity.EndStrain());
+            trialStateSensitivity.Stress()= convergedHistorySensitivity.getUnloadSlope() * (hstv.T->strain -hstv.C->endStrain)
+                                 + hstv.C->unloadSlope * (trialStateSensitivity.Strain()-convergedHistorySensitivity.EndStrain());
             dktdh= convergedHistorySensitivity.getUnloadSlope();
           }
         else
@@ -687,11 +685,11 @@ int XC::Concrete01::commitSensitivity(const double &strainGradient, int gradNumb
             dktdh= 0.0;
           }
       }
-    else if(convergedState.getStress()+convergedHistory.getUnloadSlope()*dStrain<0.0)
+    else if(hstv.C->stress+hstv.C->unloadSlope*dStrain<0.0)
       {// unloading, but not all the way down to zero stress
 	trialStateSensitivity.Stress()= convergedStateSensitivity.getStress()
 	  + convergedHistorySensitivity.UnloadSlope()*dStrain
-	  + convergedHistory.getUnloadSlope()*(trialStateSensitivity.getStrain()-convergedState.getStrain());
+	  + hstv.C->unloadSlope*(trialStateSensitivity.getStrain()-hstv.C->strain);
 	dktdh= convergedHistorySensitivity.UnloadSlope();
       }
     else
@@ -712,17 +710,17 @@ int XC::Concrete01::commitSensitivity(const double &strainGradient, int gradNumb
     double temp2, temp2Sensitivity;
     UniaxialHistoryVars trialHistorySensitivity;
 
-    if(dStrain<0.0 && trialState.getStrain() <convergedHistory.MinStrain())
+    if(dStrain<0.0 && hstv.T->strain <hstv.C->minStrain)
       {
         trialHistorySensitivity.MinStrain()= trialStateSensitivity.Strain();
-        if(trialState.getStrain() < epscu)
+        if(hstv.T->strain < epscu)
           {
             epsTemp= epscu;
             epsTempSensitivity= epscuSensitivity;
           }
         else
           {
-            epsTemp= trialState.getStrain() ;
+            epsTemp= hstv.T->strain ;
             epsTempSensitivity= trialStateSensitivity.Strain();
           }
         eta= epsTemp/epsc0;
@@ -737,11 +735,11 @@ int XC::Concrete01::commitSensitivity(const double &strainGradient, int gradNumb
             ratio= 0.707*(eta-2.0) + 0.834;
             ratioSensitivity= 0.707 * etaSensitivity;
           }
-        temp1= trialState.getStrain() - ratio * epsc0;
+        temp1= hstv.T->strain - ratio * epsc0;
         temp1Sensitivity= trialStateSensitivity.Strain() - ratioSensitivity * epsc0 - ratio * epsc0Sensitivity;
-        temp2= trialState.getStress()  * epsc0 / (2.0*fpc);
-        temp2Sensitivity= (2.0*fpc*(trialStateSensitivity.Stress()*epsc0+trialState.getStress() *epsc0Sensitivity)
-                        -2.0*trialState.getStress() *epsc0*fpcSensitivity) / (4.0*fpc*fpc);
+        temp2= hstv.T->stress  * epsc0 / (2.0*fpc);
+        temp2Sensitivity= (2.0*fpc*(trialStateSensitivity.Stress()*epsc0+hstv.T->stress *epsc0Sensitivity)
+                        -2.0*hstv.T->stress *epsc0*fpcSensitivity) / (4.0*fpc*fpc);
         if(temp1 == 0.0)
           {
             trialHistorySensitivity.UnloadSlope()= (2.0*fpcSensitivity*epsc0-2.0*fpc*epsc0Sensitivity) / (epsc0*epsc0);
@@ -749,7 +747,7 @@ int XC::Concrete01::commitSensitivity(const double &strainGradient, int gradNumb
         else if(temp1 < temp2)
           {
             trialHistorySensitivity.EndStrain()= trialStateSensitivity.Strain() - temp1Sensitivity;
-            trialHistorySensitivity.UnloadSlope()= (trialStateSensitivity.Stress()*temp1-trialState.getStress()*temp1Sensitivity) / (temp1*temp1);
+            trialHistorySensitivity.UnloadSlope()= (trialStateSensitivity.Stress()*temp1-hstv.T->stress*temp1Sensitivity) / (temp1*temp1);
           }
         else
           {
@@ -775,16 +773,16 @@ double XC::Concrete01::getStressSensitivity(int gradNumber, bool conditional)
         if( parameterID == 0 ) {
                 // Leave the gradient as zero if nothing is random here;
         }
-        else if(trialState.getStrain() > 0.0 ) {
+        else if(hstv.T->strain > 0.0 ) {
                 gradient= 0.0;
         }
-        else if(trialState.getStrain() > epsc0) {                                        // IN PARABOLIC AREA
+        else if(hstv.T->strain > epsc0) {                                        // IN PARABOLIC AREA
 
                 if( parameterID == 1 ) {                // d{sigma}d{fpc}
-                        gradient= 2.0*trialState.getStrain() /epsc0-trialState.getStrain() *trialState.getStrain() /(epsc0*epsc0);
+                        gradient= 2.0*hstv.T->strain /epsc0-hstv.T->strain *hstv.T->strain /(epsc0*epsc0);
                 }
                 else if( parameterID == 2  ) {        // d{sigma}d{epsc0}
-                        gradient= 2.0*fpc/(epsc0*epsc0)*(trialState.getStrain() *trialState.getStrain() /epsc0-trialState.getStrain() );
+                        gradient= 2.0*fpc/(epsc0*epsc0)*(hstv.T->strain *hstv.T->strain /epsc0-hstv.T->strain );
                 }
                 else if( parameterID == 3  ) {        // d{sigma}d{fpcu}
                         gradient= 0.0;
@@ -796,19 +794,19 @@ double XC::Concrete01::getStressSensitivity(int gradNumber, bool conditional)
                         gradient= 0.0;
                 }
         }
-        else if(trialState.getStrain() > epscu) {                                        // IN LINEAR AREA
+        else if(hstv.T->strain > epscu) {                                        // IN LINEAR AREA
 
                 if( parameterID == 1 ) {                // d{sigma}d{fpc}
-                        gradient= (epscu-trialState.getStrain() )/(epscu-epsc0);
+                        gradient= (epscu-hstv.T->strain )/(epscu-epsc0);
                 }
                 else if( parameterID == 2  ) {        // d{sigma}d{epsc0}
-                        gradient= (fpc-fpcu)*(epscu-trialState.getStrain() )/((epscu-epsc0)*(epscu-epsc0));
+                        gradient= (fpc-fpcu)*(epscu-hstv.T->strain )/((epscu-epsc0)*(epscu-epsc0));
                 }
                 else if( parameterID == 3  ) {        // d{sigma}d{fpcu}
-                        gradient= (trialState.getStrain() -epsc0)/(epscu-epsc0);
+                        gradient= (hstv.T->strain -epsc0)/(epscu-epsc0);
                 }
                 else if( parameterID == 4  ) {        // d{sigma}d{epscu}
-                        gradient= (trialState.getStrain() -epsc0)*(fpc-fpcu)/((epsc0-epscu)*(epsc0-epscu));
+                        gradient= (hstv.T->strain -epsc0)*(fpc-fpcu)/((epsc0-epscu)*(epsc0-epscu));
                 }
                 else {
                         gradient= 0.0;
@@ -119,6 +119,9 @@ class Concrete01: public ConcreteBase
 
     int commitState(void);
     int revertToLastCommit(void);    
+    //! @brief Return true if the state variables are in the store of the mesh.
+    bool isStateInStore(void) const
+      { return hstv.isAttached(); }
     int revertToStart(void);        
 
     UniaxialMaterial *getCopy(void) const;
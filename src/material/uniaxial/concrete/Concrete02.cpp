@@ -67,12 +67,12 @@
 
 void XC::Concrete02::setup_parameters(void)
   {
-    hstvP.ecmin= 0.0;
-    hstvP.dept= 0.0;
+    hstv.C->ecmin= 0.0;
+    hstv.C->dept= 0.0;
 
     const double initTang= getInitialTangent();
-    hstvP.setup_parameters(initTang);
-    hstv.setup_parameters(initTang);
+    hstv.C->setup_parameters(initTang);
+    hstv.T->setup_parameters(initTang);
   }
 
 XC::Concrete02::Concrete02(int tag, double _fpc, double _epsc0, double _fpcu,
@@ -153,19 +153,19 @@ int XC::Concrete02::setTrialStrain(double trialStrain, double strainRate)
     const double ec0= getInitialTangent();
 
     // retrieve commited history variables
-    hstv.ecmin= hstvP.ecmin;
-    hstv.dept= hstvP.dept;
+    hstv.T->ecmin= hstv.C->ecmin;
+    hstv.T->dept= hstv.C->dept;
 
     // calculate current strain
-    hstv.eps= trialStrain;
-    const double deps= hstv.eps - hstvP.eps;
+    hstv.T->eps= trialStrain;
+    const double deps= hstv.T->eps - hstv.C->eps;
 
     // if the current strain is less than the smallest previous strain 
     // call the monotonic envelope in compression and reset minimum strain 
-    if(hstv.eps < hstv.ecmin)
+    if(hstv.T->eps < hstv.T->ecmin)
       {
-        this->Compr_Envlp(hstv.eps, hstv.sig, hstv.e);
-        hstv.ecmin= hstv.eps;
+        this->Compr_Envlp(hstv.T->eps, hstv.T->sig, hstv.T->e);
+        hstv.T->ecmin= hstv.T->eps;
       }
     else
       {
@@ -182,26 +182,26 @@ int XC::Concrete02::setTrialStrain(double trialStrain, double strainRate)
         const double sigmr= ec0 * epsr;
     
         // calculate the previous minimum stress sigmm from the minimum 
-        // previous strain hstv.ecmin and the monotonic envelope in compression 
+        // previous strain hstv.T->ecmin and the monotonic envelope in compression 
     
         double sigmm;
         double dumy;
-        this->Compr_Envlp(hstv.ecmin, sigmm, dumy);
+        this->Compr_Envlp(hstv.T->ecmin, sigmm, dumy);
     
         // calculate current reloading slope Er (Eq. 2.35 in EERC Report) 
         // calculate the intersection of the current reloading slope Er 
         // with the zero stress axis (variable ept) (Eq. 2.36 in EERC Report) 
     
-        const double er= (sigmm - sigmr) / (hstv.ecmin - epsr);
-        const double ept= hstv.ecmin - sigmm / er;
+        const double er= (sigmm - sigmr) / (hstv.T->ecmin - epsr);
+        const double ept= hstv.T->ecmin - sigmm / er;
     
-        if(hstv.eps <= ept)
+        if(hstv.T->eps <= ept)
           {
-            const double sigmin= sigmm + er * (hstv.eps - hstv.ecmin);
-            const double sigmax= er * .5f * (hstv.eps - ept);
-            hstv.sig= hstvP.sig + ec0 * deps;
-            hstv.e= ec0;
-	    hstv.cutStress(sigmin,sigmax,er);
+            const double sigmin= sigmm + er * (hstv.T->eps - hstv.T->ecmin);
+            const double sigmax= er * .5f * (hstv.T->eps - ept);
+            hstv.T->sig= hstv.C->sig + ec0 * deps;
+            hstv.T->e= ec0;
+	    hstv.T->cutStress(sigmin,sigmax,er);
           }
         else
           {
@@ -214,24 +214,24 @@ int XC::Concrete02::setTrialStrain(double trialStrain, double strainRate)
             // calculate first the strain at the peak of the tensile stress-strain 
             // relation epn (Eq. 2.42 in EERC Report) 
       
-            const double epn= ept + hstv.dept;
+            const double epn= ept + hstv.T->dept;
             double sicn;
-            if(hstv.eps <= epn)
+            if(hstv.T->eps <= epn)
               {
-                this->Tens_Envlp(hstv.dept, sicn, hstv.e);
-                if(hstv.dept != 0.0)
-                  { hstv.e= sicn / hstv.dept; }
+                this->Tens_Envlp(hstv.T->dept, sicn, hstv.T->e);
+                if(hstv.T->dept != 0.0)
+                  { hstv.T->e= sicn / hstv.T->dept; }
                 else
-                  { hstv.e= ec0; }
-                hstv.sig= hstv.e * (hstv.eps - ept);
+                  { hstv.T->e= ec0; }
+                hstv.T->sig= hstv.T->e * (hstv.T->eps - ept);
               }
             else
               {
                 // else, if the current strain is larger than epn the response 
                 // corresponds to the tensile envelope curve shifted by ept 
-                const double epstmp= hstv.eps - ept;
-                this->Tens_Envlp(epstmp, hstv.sig, hstv.e);
-                hstv.dept= hstv.eps - ept;
+                const double epstmp= hstv.T->eps - ept;
+                this->Tens_Envlp(epstmp, hstv.T->sig, hstv.T->e);
+                hstv.T->dept= hstv.T->eps - ept;
               }
           }
       }
@@ -242,13 +242,13 @@ int XC::Concrete02::setTrialStrain(double trialStrain, double strainRate)
 
 int XC::Concrete02::commitState(void)
   {
-    hstvP= hstv;
+    hstv.commit();
     return 0;
   }
 
 int XC::Concrete02::revertToLastCommit(void)
   {
-    hstv= hstvP;
+    hstv.revert();
     return 0;
   }
 
@@ -263,9 +263,9 @@ int XC::Concrete02::sendData(CommParameters &cp)
   {
     int res= RawConcrete::sendData(cp);
     res+= cp.sendDoubles(fpc,epsc0,fpcu,epscu,getDbTagData(),CommMetaData(2));
-    res+= cp.sendDoubles(rat,ft,Ets,hstvP.ecmin,hstvP.dept,getDbTagData(),CommMetaData(3));
-    res+= cp.sendDoubles(hstvP.eps,hstvP.sig,hstvP.e,hstv.ecmin,hstv.dept,hstv.sig,getDbTagData(),CommMetaData(4));
-    res+= cp.sendDoubles(hstv.e,hstv.eps,getDbTagData(),CommMetaData(5));
+    res+= cp.sendDoubles(rat,ft,Ets,hstv.C->ecmin,hstv.C->dept,getDbTagData(),CommMetaData(3));
+    res+= cp.sendDoubles(hstv.C->eps,hstv.C->sig,hstv.C->e,hstv.T->ecmin,hstv.T->dept,hstv.T->sig,getDbTagData(),CommMetaData(4));
+    res+= cp.sendDoubles(hstv.T->e,hstv.T->eps,getDbTagData(),CommMetaData(5));
     return res;
   }
 
@@ -274,9 +274,9 @@ int XC::Concrete02::recvData(const CommParameters &cp)
   {
     int res= RawConcrete::recvData(cp);
     res+= cp.receiveDoubles(fpc,epsc0,fpcu,epscu,getDbTagData(),CommMetaData(2));
-    res+= cp.receiveDoubles(rat,ft,Ets,hstvP.ecmin,hstvP.dept,getDbTagData(),CommMetaData(3));
-    res+= cp.receiveDoubles(hstvP.eps,hstvP.sig,hstvP.e,hstv.ecmin,hstv.dept,hstv.sig,getDbTagData(),CommMetaData(4));
-    res+= cp.receiveDoubles(hstv.e,hstv.eps,getDbTagData(),CommMetaData(5));
+    res+= cp.receiveDoubles(rat,ft,Ets,hstv.C->ecmin,hstv.C->dept,getDbTagData(),CommMetaData(3));
+    res+= cp.receiveDoubles(hstv.C->eps,hstv.C->sig,hstv.C->e,hstv.T->ecmin,hstv.T->dept,hstv.T->sig,getDbTagData(),CommMetaData(4));
+    res+= cp.receiveDoubles(hstv.T->e,hstv.T->eps,getDbTagData(),CommMetaData(5));
     return res;
   }
 
@@ -313,7 +313,7 @@ int XC::Concrete02::recvSelf(const CommParameters &cp)
 
 void XC::Concrete02::Print(std::ostream &s, int flag)
   {
-    hstv.Print(s);
+    hstv.T->Print(s);
   }
 
 
@@ -325,10 +325,10 @@ void XC::Concrete02::Tens_Envlp(double epsc, double &sigc, double &Ect)
     !   ft = concrete tensile strength
     !   Ec0= initial tangent modulus of concrete 
     !   Ets= tension softening modulus
-    !   hstv.eps= strain
+    !   hstv.T->eps= strain
     !
     !   returned variables
-    !    sigc= stress corresponding to hstv.eps
+    !    sigc= stress corresponding to hstv.T->eps
     !    Ect= tangent concrete modulus
     !-----------------------------------------------------------------------*/
   
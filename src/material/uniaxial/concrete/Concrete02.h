@@ -67,6 +67,7 @@
 #define Concrete02_h
 
 #include <material/uniaxial/concrete/RawConcrete.h>
+#include "material/MaterialStateVars.h"
 
 namespace XC {
 
@@ -135,10 +136,8 @@ class Concrete02: public RawConcrete
     double ft;    //!< concrete tensile strength               : mp(6)
     double Ets;   //!< tension stiffening slope                : mp(7)
 
-    // hstvP : Concrete HISTORY VARIABLES last committed step
-    Conc02HistoryVars hstvP; //!< = values at previous converged step
-    // hstv : Concrete HISTORY VARIABLES  current step
-    Conc02HistoryVars hstv; //!< = values at current step (trial values)
+    // Concrete HISTORY VARIABLES (committed: hstv.C, trial: hstv.T)
+    MaterialStateVars<Conc02HistoryVars> hstv; //!< History variables.
 
     void Tens_Envlp(double epsc, double &sigc, double &Ect);
     void Compr_Envlp(double epsc, double &sigc, double &Ect);
@@ -166,14 +165,17 @@ class Concrete02: public RawConcrete
 
     int setTrialStrain(double strain, double strainRate = 0.0); 
     inline double getStrain(void) const
-      { return hstv.getStrain(); }
+      { return hstv.T->getStrain(); }
     inline double getStress(void) const
-      { return hstv.getStress(); }
+      { return hstv.T->getStress(); }
     inline double getTangent(void) const
-      { return hstv.getTangent(); }
+      { return hstv.T->getTangent(); }
     
     int commitState(void);
     int revertToLastCommit(void);    
+    //! @brief Return true if the history variables are in the store of the mesh.
+    bool isStateInStore(void) const
+      { return hstv.isAttached(); }
     int revertToStart(void);
     
     int sendSelf(CommParameters &);  
@@ -85,8 +85,8 @@ void XC::Concrete04::setup_parameters(void)
         std::cerr << "warning: fct less than 0.0 so the tensile response part is being set to 0"
                   << std::endl;
       }
-    convergedState.Tangent()= Ec0;
-    convergedHistory.UnloadSlope()= Ec0;
+    hstv.C->tangent= Ec0;
+    hstv.C->unloadSlope= Ec0;
     CUtenSlope= Ec0;
   
     // Set trial values
@@ -125,63 +125,63 @@ XC::Concrete04::Concrete04(int tag)
 int XC::Concrete04::setTrialStrain(double strain, double strainRate)
   {
     // Reset trial history variables to last committed state
-    trialHistory= convergedHistory;
+    commit_to_trial_history();
     TmaxStrain= CmaxStrain;   
     TUtenSlope= CUtenSlope;
-    trialState= convergedState;   
+    commit_to_trial_state();
 
 
     /* // Set trial strain*/  
     if(fct == 0.0 && strain > 0.0)
       {    
-        trialState.Strain()= strain;
-        trialState.Stress()= 0.0;    
-        trialState.Tangent()= 0.0;    
+        hstv.T->strain= strain;
+        hstv.T->stress= 0.0;    
+        hstv.T->tangent= 0.0;    
         TUtenSlope= 0.0;    
         return 0;  
       }
 
     /*// Determine change in strain from last converged state*/  
-    const double dStrain= strain - convergedState.getStrain();
+    const double dStrain= strain - hstv.C->strain;
 
     if(fabs(dStrain) < DBL_EPSILON)       
       return 0;
 
-    trialState.Strain()= strain;  
+    hstv.T->strain= strain;  
 
   /*// Calculate the trial state given the change in strain  // determineTrialState (dStrain);*/
-     trialHistory.UnloadSlope()= convergedHistory.getUnloadSlope();  
+     hstv.T->unloadSlope= hstv.C->unloadSlope;  
   TUtenSlope= CUtenSlope;
   if (dStrain <= 0.0) {	  /*// Material can be either in Compression-Reloading	  // or Tension-Unloading state.*/
-    if (trialState.getStrain() > 0.0) {         
+    if (hstv.T->strain > 0.0) {         
       /*// Material is in Tension-Unloading State*/		  
-      trialState.Tangent()= TUtenSlope;		  
-      trialState.Stress()= trialState.getStrain() * TUtenSlope; 	  
+      hstv.T->tangent= TUtenSlope;		  
+      hstv.T->stress= hstv.T->strain * TUtenSlope; 	  
     } else {
       // Material is in Compression-Reloading State
-      trialHistory= convergedHistory;      
+      commit_to_trial_history();
       CompReload();
     }
   } else {
     /*// Material can be either in Compression-Unloading	  // or Tension-Reloading State.*/
-    if (trialState.getStrain() >= 0.0) {    /*// Material is in Tension-Reloading State*/      
+    if (hstv.T->strain >= 0.0) {    /*// Material is in Tension-Reloading State*/      
       TmaxStrain= CmaxStrain;                  
-      if (trialState.getStrain() < TmaxStrain) {        
-	trialState.Stress()= trialState.getStrain() * CUtenSlope;        
-	trialState.Tangent()= CUtenSlope;        
+      if (hstv.T->strain < TmaxStrain) {        
+	hstv.T->stress= hstv.T->strain * CUtenSlope;        
+	hstv.T->tangent= CUtenSlope;        
 	TUtenSlope= CUtenSlope;      
       } else {        
-	TmaxStrain= trialState.getStrain();        
+	TmaxStrain= hstv.T->strain;        
 	TensEnvelope();        
 	setTenUnload();      
       }        
     } else {
-       if(trialState.getStrain() <= trialHistory.getEndStrain()) {          
-	trialState.Tangent()= trialHistory.getUnloadSlope();          
-	trialState.Stress()= trialState.getTangent() * (trialState.getStrain() - trialHistory.getEndStrain());        
+       if(hstv.T->strain <= hstv.T->endStrain) {          
+	hstv.T->tangent= hstv.T->unloadSlope;          
+	hstv.T->stress= hstv.T->tangent * (hstv.T->strain - hstv.T->endStrain);        
       } else {          
-	trialState.Stress()= 0.0;          
-	trialState.Tangent()= 0.0;        
+	hstv.T->stress= 0.0;          
+	hstv.T->tangent= 0.0;        
       }        
     }  
   }    
@@ -190,28 +190,28 @@ int XC::Concrete04::setTrialStrain(double strain, double strainRate)
 
 void XC::Concrete04::CompReload()
 {
-  if (trialState.getStrain() <= trialHistory.getMinStrain()) {
+  if (hstv.T->strain <= hstv.T->minStrain) {
     
-    trialHistory.MinStrain()= trialState.getStrain();
+    hstv.T->minStrain= hstv.T->strain;
     
     /*// Determine point on envelope*/
     CompEnvelope ();
     setCompUnloadEnv ();
     
   }
-  else if (trialState.getStrain() < trialHistory.getEndStrain()) {
-    trialState.Tangent()= trialHistory.getUnloadSlope();
-    trialState.Stress()= trialState.getTangent()*(trialState.getStrain()-trialHistory.getEndStrain());
+  else if (hstv.T->strain < hstv.T->endStrain) {
+    hstv.T->tangent= hstv.T->unloadSlope;
+    hstv.T->stress= hstv.T->tangent*(hstv.T->strain-hstv.T->endStrain);
   }
-  else if (trialState.getStrain() <= 0.0) {
-    trialState.Stress()= 0.0;
-    trialState.Tangent()= 0.0;
+  else if (hstv.T->strain <= 0.0) {
+    hstv.T->stress= 0.0;
+    hstv.T->tangent= 0.0;
   }
 }
 
 void XC::Concrete04::CompEnvelope()
 {
-  if (trialState.getStrain() >= epscu) {
+  if (hstv.T->strain >= epscu) {
     double Esec= fpc/epsc0;
     double r= 0.0;
     if (Esec >= Ec0) {
@@ -219,19 +219,19 @@ void XC::Concrete04::CompEnvelope()
     } else {
       r= Ec0/(Ec0-Esec);
     }
-    double eta= trialState.getStrain()/epsc0;
-    trialState.Stress()= fpc*eta*r/(r-1+pow(eta,r));
-    trialState.Tangent()= fpc*r*(r-1)*(1-pow(eta,r))/(pow((r-1+pow(eta,r)),2)*epsc0);
+    double eta= hstv.T->strain/epsc0;
+    hstv.T->stress= fpc*eta*r/(r-1+pow(eta,r));
+    hstv.T->tangent= fpc*r*(r-1)*(1-pow(eta,r))/(pow((r-1+pow(eta,r)),2)*epsc0);
   } else {
-    trialState.Stress()= 0.0;
-    trialState.Tangent()= 0.0;
+    hstv.T->stress= 0.0;
+    hstv.T->tangent= 0.0;
   }
   
 }
 
 void XC::Concrete04::setCompUnloadEnv()
   {
-    double tempStrain= trialHistory.getMinStrain();
+    double tempStrain= hstv.T->minStrain;
   
   if (tempStrain < epscu)
     tempStrain= epscu;
@@ -243,28 +243,28 @@ void XC::Concrete04::setCompUnloadEnv()
   if (eta < 2.0)
     ratio= 0.145*eta*eta + 0.13*eta;
   
-  trialHistory.EndStrain()= ratio*epsc0;
+  hstv.T->endStrain= ratio*epsc0;
   
-  double temp1= trialHistory.getMinStrain() - trialHistory.getEndStrain();
+  double temp1= hstv.T->minStrain - hstv.T->endStrain;
   
-  double temp2= trialState.getStress()/Ec0;
+  double temp2= hstv.T->stress/Ec0;
   
   if (temp1 > -DBL_EPSILON) {	// temp1 should always be negative
-    trialHistory.UnloadSlope()= Ec0;
+    hstv.T->unloadSlope= Ec0;
   }
   else if (temp1 <= temp2) {
-    trialHistory.EndStrain()= trialHistory.getMinStrain() - temp1;
-    trialHistory.UnloadSlope()= trialState.getStress()/temp1;
+    hstv.T->endStrain= hstv.T->minStrain - temp1;
+    hstv.T->unloadSlope= hstv.T->stress/temp1;
   }
   else {
-    trialHistory.EndStrain()= trialHistory.getMinStrain() - temp2;
-    trialHistory.UnloadSlope()= Ec0;
+    hstv.T->endStrain= hstv.T->minStrain - temp2;
+    hstv.T->unloadSlope= Ec0;
   }
   
   
-  if (trialState.getStrain() >= 0.0) {
+  if (hstv.T->strain >= 0.0) {
     /*std::cerr << "actually made it in here" << std::endl;*/
-    /*trialHistory.UnloadSlope()= Ec0;*/
+    /*hstv.T->unloadSlope= Ec0;*/
   }
   
 }
@@ -274,49 +274,44 @@ void XC::Concrete04::TensReload()
 
 void XC::Concrete04::TensEnvelope()
 {  double ect= fct / Ec0;    
-  if (trialState.getStrain() <= ect) {    
-    trialState.Stress()= trialState.getStrain() * Ec0;    
-    trialState.Tangent()= Ec0;
-  } else if (trialState.getStrain() > etu) {    
-    trialState.Stress()= 0.0;    
-    trialState.Tangent()= 0.0;  
+  if (hstv.T->strain <= ect) {    
+    hstv.T->stress= hstv.T->strain * Ec0;    
+    hstv.T->tangent= Ec0;
+  } else if (hstv.T->strain > etu) {    
+    hstv.T->stress= 0.0;    
+    hstv.T->tangent= 0.0;  
   } else {    
-    trialState.Stress()= fct * pow(beta, (trialState.getStrain() - ect) / (etu - ect));    
-    trialState.Tangent()= fct * pow(beta, (trialState.getStrain() - ect) / (etu - ect)) * log(beta) / (etu - ect);  
+    hstv.T->stress= fct * pow(beta, (hstv.T->strain - ect) / (etu - ect));    
+    hstv.T->tangent= fct * pow(beta, (hstv.T->strain - ect) / (etu - ect)) * log(beta) / (etu - ect);  
   }
 }
 
 void XC::Concrete04::setTenUnload(){
-  TUtenStress= trialState.getStress();
-  TUtenSlope= trialState.getStress() / trialState.getStrain();
+  TUtenStress= hstv.T->stress;
+  TUtenSlope= hstv.T->stress / hstv.T->strain;
 }
 
 int XC::Concrete04::commitState(void)
   {
-    convergedHistory= trialHistory; 
+    hstv.commit(); // History and state variables
     CmaxStrain= TmaxStrain;   
     CUtenSlope= TUtenSlope;
-    convergedState= trialState;
     return 0;
   }
 
 int XC::Concrete04::revertToLastCommit(void)
   {
-    trialHistory= convergedHistory;
+    hstv.revert(); // History and state variables
     TmaxStrain= CmaxStrain;   
     TUtenSlope= CUtenSlope;  
-    trialState= convergedState;   
     return 0;
   }
 
 int XC::Concrete04::revertToStart(void)
   {
-    // History variables
-    convergedHistory.revertToStart(Ec0); // History variables
+    revert_to_start(Ec0); // History and state variables
     CmaxStrain= 0.0;   
     CUtenSlope= Ec0;
-    // State variables
-    convergedState.revertToStart(Ec0);
     revertToLastCommit();
     return 0;
   }
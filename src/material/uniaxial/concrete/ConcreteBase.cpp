@@ -45,25 +45,24 @@ XC::ConcreteBase::ConcreteBase(int tag, int classTag)
 
 //! @brief Returns the material stress.
 double XC::ConcreteBase::getStress(void) const
-  { return trialState.getStress(); }
+  { return hstv.T->stress; }
 
 //! @breif Returns material strain.
 double XC::ConcreteBase::getStrain(void) const
-  { return trialState.getStrain(); }
+  { return hstv.T->strain; }
 
 //! @breif Returns the tangent to stress-strain diagram.
 double XC::ConcreteBase::getTangent(void) const
-  { return trialState.getTangent(); }
+  { return hstv.T->tangent; }
 
 //! @brief Send object members through the channel being passed as parameter.
 int XC::ConcreteBase::sendData(CommParameters &cp)
   {
     int res= RawConcrete::sendData(cp);
-    res+= cp.sendMovable(convergedState,getDbTagData(),CommMetaData(2));
-    res+= cp.sendMovable(trialState,getDbTagData(),CommMetaData(3));
-    res+= cp.sendMovable(convergedHistory,getDbTagData(),CommMetaData(4));
-    res+= cp.sendMovable(trialHistory,getDbTagData(),CommMetaData(5));
-    res+= cp.sendDoubles(fpc,epsc0,epscu,getDbTagData(),CommMetaData(6));
+    res+= cp.sendDoubles(hstv.C->strain,hstv.C->stress,hstv.C->tangent,hstv.T->strain,hstv.T->stress,hstv.T->tangent,getDbTagData(),CommMetaData(2));
+    res+= cp.sendDoubles(hstv.C->minStrain,hstv.C->unloadSlope,hstv.C->endStrain,getDbTagData(),CommMetaData(3));
+    res+= cp.sendDoubles(hstv.T->minStrain,hstv.T->unloadSlope,hstv.T->endStrain,getDbTagData(),CommMetaData(4));
+    res+= cp.sendDoubles(fpc,epsc0,epscu,getDbTagData(),CommMetaData(5));
     return res;
   }
 
@@ -71,11 +70,10 @@ int XC::ConcreteBase::sendData(CommParameters &cp)
 int XC::ConcreteBase::recvData(const CommParameters &cp)
   {
     int res= RawConcrete::recvData(cp);
-    res+= cp.receiveMovable(convergedState,getDbTagData(),CommMetaData(2));
-    res+= cp.receiveMovable(trialState,getDbTagData(),CommMetaData(3));
-    res+= cp.receiveMovable(convergedHistory,getDbTagData(),CommMetaData(4));
-    res+= cp.receiveMovable(trialHistory,getDbTagData(),CommMetaData(5));
-    res+= cp.receiveDoubles(fpc,epsc0,epscu,getDbTagData(),CommMetaData(6));
+    res+= cp.receiveDoubles(hstv.C->strain,hstv.C->stress,hstv.C->tangent,hstv.T->strain,hstv.T->stress,hstv.T->tangent,getDbTagData(),CommMetaData(2));
+    res+= cp.receiveDoubles(hstv.C->minStrain,hstv.C->unloadSlope,hstv.C->endStrain,getDbTagData(),CommMetaData(3));
+    res+= cp.receiveDoubles(hstv.T->minStrain,hstv.T->unloadSlope,hstv.T->endStrain,getDbTagData(),CommMetaData(4));
+    res+= cp.receiveDoubles(fpc,epsc0,epscu,getDbTagData(),CommMetaData(5));
     return res;
   }
 
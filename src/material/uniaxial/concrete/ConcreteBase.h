@@ -31,21 +31,29 @@
 
 
 #include "material/uniaxial/concrete/RawConcrete.h"
-#include "material/uniaxial/UniaxialStateVars.h"
-#include "material/uniaxial/UniaxialHistoryVars.h"
+#include "material/MaterialStateVars.h"
 
 namespace XC {
+//! @ingroup MatUnx
+//
+//! @brief State and history variables of the concrete materials.
+struct ConcreteBaseState
+  {
+    double strain;
+    double stress;
+    double tangent;
+    double minStrain; //!< Smallest previous strain (compression)
+    double unloadSlope; //!< Unloading (reloading) slope from minStrain
+    double endStrain; //!< Strain at the end of unloading from minStrain
+  };
+
 //! @ingroup MatUnx
 //
 //! @brief Base class for concrete materials.
 class ConcreteBase: public RawConcrete
   {
   protected:
-    UniaxialHistoryVars convergedHistory; //!< CONVERGED history Variables
-    UniaxialStateVars convergedState; //!< CONVERGED state Variables
-
-    UniaxialHistoryVars trialHistory; //!< TRIAL history Variables
-    UniaxialStateVars trialState;//!< TRIAL state Variables
+    MaterialStateVars<ConcreteBaseState> hstv; //!< trial (T) and converged (C) state and history variables.
 
     int sendData(CommParameters &);
     int recvData(const CommParameters &);
@@ -53,6 +61,7 @@ class ConcreteBase: public RawConcrete
     void commit_to_trial_history(void);
     void commit_to_trial_state(void);
     void commit_to_trial(void);
+    void revert_to_start(const double &);
   public:
     ConcreteBase(int tag, int classTag, double fpc, double eco, double ecu);
     ConcreteBase(int tag, int classTag);
@@ -64,19 +73,34 @@ class ConcreteBase: public RawConcrete
 
 //! @brief Reset trial history variables to last committed state
 inline void ConcreteBase::commit_to_trial_history(void)
-  { trialHistory= convergedHistory; }
+  {
+    hstv.T->minStrain= hstv.C->minStrain;
+    hstv.T->unloadSlope= hstv.C->unloadSlope;
+    hstv.T->endStrain= hstv.C->endStrain;
+  }
 
 //! @brief Reset trial state variables to last committed state
 inline void ConcreteBase::commit_to_trial_state(void)
-  { trialState= convergedState; }
+  {
+    hstv.T->strain= hstv.C->strain;
+    hstv.T->stress= hstv.C->stress;
+    hstv.T->tangent= hstv.C->tangent;
+  }
 
 //! @brief Reset trial state and history variables to last committed state
 inline void ConcreteBase::commit_to_trial(void)
+  { *hstv.T= *hstv.C; }
+
+//! @brief Set the committed state and history variables to its initial values.
+//! @param Ec0: initial tangent.
+inline void ConcreteBase::revert_to_start(const double &Ec0)
   {
-    // Reset trial history variables to last committed state
-    commit_to_trial_history();
-    // Reset trial state variables to last committed state
-    commit_to_trial_state();
+    hstv.C->strain= 0.0;
+    hstv.C->stress= 0.0;
+    hstv.C->tangent= Ec0;
+    hstv.C->minStrain= 0.0;
+    hstv.C->unloadSlope= Ec0;
+    hstv.C->endStrain= 0.0;
   }
 
 } // end of XC namespace
@@ -73,26 +73,26 @@
 int XC::Steel01::setup_parameters(void)
   {
     // History variables
-    CminStrain= 0.0;
-    CmaxStrain= 0.0;
-    CshiftP= 1.0;
-    CshiftN= 1.0;
-    Cloading= 0;
-
-    TminStrain= 0.0;
-    TmaxStrain= 0.0;
-    TshiftP= 1.0;
-    TshiftN= 1.0;
-    Tloading= 0;
+    hstv.C->minStrain= 0.0;
+    hstv.C->maxStrain= 0.0;
+    hstv.C->shiftP= 1.0;
+    hstv.C->shiftN= 1.0;
+    hstv.C->loading= 0;
+
+    hstv.T->minStrain= 0.0;
+    hstv.T->maxStrain= 0.0;
+    hstv.T->shiftP= 1.0;
+    hstv.T->shiftN= 1.0;
+    hstv.T->loading= 0;
 
     // State variables
-    Cstrain= 0.0;
-    Cstress= 0.0;
-    Ctangent= E0;
+    hstv.C->strain= 0.0;
+    hstv.C->stress= 0.0;
+    hstv.C->tangent= E0;
 
-    Tstrain= 0.0;
-    Tstress= 0.0;
-    Ttangent= E0;
+    hstv.T->strain= 0.0;
+    hstv.T->stress= 0.0;
+    hstv.T->tangent= E0;
     return 0;
   }
 
@@ -122,10 +122,10 @@ void XC::Steel01::determineTrialState(double dStrain)
     const double Esh= getEsh();
     const double epsy= getEpsy();
 
-    const double c1= Esh*Tstrain;
-    const double c2= TshiftN*fyOneMinusB;
-    const double c3= TshiftP*fyOneMinusB;
-    const double c= Cstress + E0*dStrain;
+    const double c1= Esh*hstv.T->strain;
+    const double c2= hstv.T->shiftN*fyOneMinusB;
+    const double c3= hstv.T->shiftP*fyOneMinusB;
+    const double c= hstv.C->stress + E0*dStrain;
 
 //     /**********************************************************
 //        removal of the following lines due to problems with
@@ -138,25 +138,25 @@ void XC::Steel01::determineTrialState(double dStrain)
 //     const double c1c3= c1 + c3;
 
 //     if(c1c3<c)
-//       Tstress = c1c3;
+//       hstv.T->stress = c1c3;
 //     else
-//       Tstress = c;
+//       hstv.T->stress = c;
 
 //     const double c1c2= c1-c2;
 
-//     if(c1c2 > Tstress)
-//       Tstress = c1c2;
+//     if(c1c2 > hstv.T->stress)
+//       hstv.T->stress = c1c2;
 
 //     /* ***********************************************************
 //     and replace them with:
-//     Tstress = fmax((c1-c2), fmin((c1+c3),c));
+//     hstv.T->stress = fmax((c1-c2), fmin((c1+c3),c));
 //     **************************************************************/
-    Tstress= std::max((c1-c2), std::min((c1+c3),c));
+    hstv.T->stress= std::max((c1-c2), std::min((c1+c3),c));
 
-    if(fabs(Tstress-c)<DBL_EPSILON)
-      Ttangent = E0;
+    if(fabs(hstv.T->stress-c)<DBL_EPSILON)
+      hstv.T->tangent = E0;
     else
-      Ttangent = Esh;
+      hstv.T->tangent = Esh;
 
     //
     // Determine if a load reversal has occurred due to the trial strain
@@ -165,32 +165,32 @@ void XC::Steel01::determineTrialState(double dStrain)
     // Determine initial loading condition:  1 = loading (positive strain increment)
                                          // -1 = unloading (negative strain increment)
                                          // 0 initially
-    if(Tloading == 0 && dStrain != 0.0)
+    if(hstv.T->loading == 0 && dStrain != 0.0)
       {
         if(dStrain > 0.0)
-          Tloading = 1;
+          hstv.T->loading = 1;
         else
-          Tloading = -1;
+          hstv.T->loading = -1;
       }
 
     // Transition from loading to unloading, i.e. positive strain increment
     // to negative strain increment
-    if(Tloading == 1 && dStrain < 0.0)
+    if(hstv.T->loading == 1 && dStrain < 0.0)
       {
-        Tloading = -1;
-        if(Cstrain > TmaxStrain)
-          TmaxStrain = Cstrain;
-        TshiftN= 1 + a1*pow((TmaxStrain-TminStrain)/(2.0*a2*epsy),0.8);
+        hstv.T->loading = -1;
+        if(hstv.C->strain > hstv.T->maxStrain)
+          hstv.T->maxStrain = hstv.C->strain;
+        hstv.T->shiftN= 1 + a1*pow((hstv.T->maxStrain-hstv.T->minStrain)/(2.0*a2*epsy),0.8);
       }
 
     // Transition from unloading to loading, i.e. negative strain increment
     // to positive strain increment
-    if(Tloading == -1 && dStrain > 0.0)
+    if(hstv.T->loading == -1 && dStrain > 0.0)
       {
-        Tloading = 1;
-        if(Cstrain < TminStrain)
-          TminStrain = Cstrain;
-        TshiftP = 1 + a3*pow((TmaxStrain-TminStrain)/(2.0*a4*epsy),0.8);
+        hstv.T->loading = 1;
+        if(hstv.C->strain < hstv.T->minStrain)
+          hstv.T->minStrain = hstv.C->strain;
+        hstv.T->shiftP = 1 + a3*pow((hstv.T->maxStrain-hstv.T->minStrain)/(2.0*a4*epsy),0.8);
       }
   }
 
@@ -198,34 +198,34 @@ void XC::Steel01::determineTrialState(double dStrain)
 void XC::Steel01::detectLoadReversal(double dStrain)
   {
     // Determine initial loading condition
-    if(Tloading == 0 && dStrain != 0.0)
+    if(hstv.T->loading == 0 && dStrain != 0.0)
       {
         if(dStrain > 0.0)
-          Tloading = 1;
+          hstv.T->loading = 1;
         else
-          Tloading = -1;
+          hstv.T->loading = -1;
       }
 
    const double epsy= getEpsy();
 
    // Transition from loading to unloading, i.e. positive strain increment
    // to negative strain increment
-   if(Tloading == 1 && dStrain < 0.0)
+   if(hstv.T->loading == 1 && dStrain < 0.0)
      {
-       Tloading = -1;
-       if(Cstrain > TmaxStrain)
-         TmaxStrain = Cstrain;
-       TshiftN= 1 + a1*pow((TmaxStrain-TminStrain)/(2.0*a2*epsy),0.8);
+       hstv.T->loading = -1;
+       if(hstv.C->strain > hstv.T->maxStrain)
+         hstv.T->maxStrain = hstv.C->strain;
+       hstv.T->shiftN= 1 + a1*pow((hstv.T->maxStrain-hstv.T->minStrain)/(2.0*a2*epsy),0.8);
      }
 
    // Transition from unloading to loading, i.e. negative strain increment
    // to positive strain increment
-   if(Tloading == -1 && dStrain > 0.0)
+   if(hstv.T->loading == -1 && dStrain > 0.0)
      {
-       Tloading = 1;
-       if(Cstrain < TminStrain)
-         TminStrain = Cstrain;
-       TshiftP = 1 + a3*pow((TmaxStrain-TminStrain)/(2.0*a4*epsy),0.8);
+       hstv.T->loading = 1;
+       if(hstv.C->strain < hstv.T->minStrain)
+         hstv.T->minStrain = hstv.C->strain;
+       hstv.T->shiftP = 1 + a3*pow((hstv.T->maxStrain-hstv.T->minStrain)/(2.0*a4*epsy),0.8);
      }
   }
 
@@ -364,7 +364,7 @@ int XC::Steel01::updateParameter(int parameterID, Information &info)
       default:
         return -1;
       }
-    Ttangent = E0;          // Initial stiffness
+    hstv.T->tangent = E0;          // Initial stiffness
     return 0;
   }
 
@@ -406,13 +406,13 @@ double XC::Steel01::getStressSensitivity(int gradNumber, bool conditional)
 
     // Compute min and max stress
     double Tstress;
-    const double dStrain = Tstrain-Cstrain;
-    const double sigmaElastic = Cstress + E0*dStrain;
+    const double dStrain = hstv.T->strain-hstv.C->strain;
+    const double sigmaElastic = hstv.C->stress + E0*dStrain;
     const double fyOneMinusB = fy * (1.0 - b);
     const double Esh = b*E0;
-    const double c1 = Esh*Tstrain;
-    const double c2 = TshiftN*fyOneMinusB;
-    const double c3 = TshiftP*fyOneMinusB;
+    const double c1 = Esh*hstv.T->strain;
+    const double c2 = hstv.T->shiftN*fyOneMinusB;
+    const double c3 = hstv.T->shiftP*fyOneMinusB;
     const double sigmaMax = c1+c3;
     const double sigmaMin = c1-c2;
 
@@ -420,22 +420,22 @@ double XC::Steel01::getStressSensitivity(int gradNumber, bool conditional)
     if( (sigmaMax < sigmaElastic) && (fabs(sigmaMax-sigmaElastic)>1e-5) )
       {
         Tstress = sigmaMax;
-        gradient = E0Sensitivity*b*Tstrain
-                   + E0*bSensitivity*Tstrain
-                   + TshiftP*(fySensitivity*(1-b)-fy*bSensitivity);
+        gradient = E0Sensitivity*b*hstv.T->strain
+                   + E0*bSensitivity*hstv.T->strain
+                   + hstv.T->shiftP*(fySensitivity*(1-b)-fy*bSensitivity);
       }
     else
       {
         Tstress = sigmaElastic;
         gradient = CstressSensitivity
-                   + E0Sensitivity*(Tstrain-Cstrain)
+                   + E0Sensitivity*(hstv.T->strain-hstv.C->strain)
                    - E0*CstrainSensitivity;
       }
     if(sigmaMin > Tstress)
       {
-        gradient = E0Sensitivity*b*Tstrain
-                   + E0*bSensitivity*Tstrain
-                   - TshiftN*(fySensitivity*(1-b)-fy*bSensitivity);
+        gradient = E0Sensitivity*b*hstv.T->strain
+                   + E0*bSensitivity*hstv.T->strain
+                   - hstv.T->shiftN*(fySensitivity*(1-b)-fy*bSensitivity);
       }
     return gradient;
   }
@@ -481,13 +481,13 @@ int XC::Steel01::commitSensitivity(double TstrainSensitivity, int gradNumber, in
 
     // Compute min and max stress
     double Tstress;
-    const double dStrain = Tstrain-Cstrain;
-    const double sigmaElastic = Cstress + E0*dStrain;
+    const double dStrain = hstv.T->strain-hstv.C->strain;
+    const double sigmaElastic = hstv.C->stress + E0*dStrain;
     const double fyOneMinusB = fy * (1.0 - b);
     const double Esh = b*E0;
-    const double c1 = Esh*Tstrain;
-    const double c2 = TshiftN*fyOneMinusB;
-    const double c3 = TshiftP*fyOneMinusB;
+    const double c1 = Esh*hstv.T->strain;
+    const double c2 = hstv.T->shiftN*fyOneMinusB;
+    const double c3 = hstv.T->shiftP*fyOneMinusB;
     const double sigmaMax = c1+c3;
     const double sigmaMin = c1-c2;
 
@@ -495,24 +495,24 @@ int XC::Steel01::commitSensitivity(double TstrainSensitivity, int gradNumber, in
     if( (sigmaMax < sigmaElastic) && (fabs(sigmaMax-sigmaElastic)>1e-5) )
       {
         Tstress = sigmaMax;
-        gradient = E0Sensitivity*b*Tstrain
-                   + E0*bSensitivity*Tstrain
+        gradient = E0Sensitivity*b*hstv.T->strain
+                   + E0*bSensitivity*hstv.T->strain
                    + E0*b*TstrainSensitivity
-                   + TshiftP*(fySensitivity*(1-b)-fy*bSensitivity);
+                   + hstv.T->shiftP*(fySensitivity*(1-b)-fy*bSensitivity);
       }
     else
       {
         Tstress = sigmaElastic;
         gradient = CstressSensitivity
-                   + E0Sensitivity*(Tstrain-Cstrain)
+                   + E0Sensitivity*(hstv.T->strain-hstv.C->strain)
                    + E0*(TstrainSensitivity-CstrainSensitivity);
       }
     if(sigmaMin > Tstress)
       {
-        gradient = E0Sensitivity*b*Tstrain
-                   + E0*bSensitivity*Tstrain
+        gradient = E0Sensitivity*b*hstv.T->strain
+                   + E0*bSensitivity*hstv.T->strain
                    + E0*b*TstrainSensitivity
-                   - TshiftN*(fySensitivity*(1-b)-fy*bSensitivity);
+                   - hstv.T->shiftN*(fySensitivity*(1-b)-fy*bSensitivity);
       }
 
     // Commit history variables
@@ -71,25 +71,25 @@
 //! @brief Sets all history and state variables to initial values
 int XC::Steel02::setup_parameters(void)
   {
-    eP= E0;
-    epsP= 0.0;
-    sigP= 0.0;
-    sig= 0.0;
-    eps= 0.0;
-    e= E0;
-
-    epsmaxP= fy/E0;
-    epsminP= -epsmaxP;
-    epsplP= 0.0;
-    epss0P= 0.0;
-    sigs0P= 0.0;
-    epssrP= 0.0;
-    sigsrP= 0.0;
+    hstv.C->e= E0;
+    hstv.C->eps= 0.0;
+    hstv.C->sig= 0.0;
+    hstv.T->sig= 0.0;
+    hstv.T->eps= 0.0;
+    hstv.T->e= E0;
+
+    hstv.C->epsmax= fy/E0;
+    hstv.C->epsmin= -hstv.C->epsmax;
+    hstv.C->epspl= 0.0;
+    hstv.C->epss0= 0.0;
+    hstv.C->sigs0= 0.0;
+    hstv.C->epsr= 0.0;
+    hstv.C->sigr= 0.0;
 
     if(sigini!=0.0)
       {
-        epsP= sigini/E0;
-        sigP= sigini;
+        hstv.C->eps= sigini/E0;
+        hstv.C->sig= sigini;
       }
     return 0;
   }
@@ -98,26 +98,26 @@ XC::Steel02::Steel02(int tag, double _fy, double _E0, double _b,
                  double _R0, double _cR1, double _cR2,
                  double _a1, double _a2, double _a3, double _a4, double sigInit)
   : SteelBase(tag,MAT_TAG_Steel02,_fy,_E0,_b,_a1,_a2,_a3,_a4), 
-    sigini(sigInit), R0(_R0), cR1(_cR1), cR2(_cR2), konP(0), kon(0)
+    sigini(sigInit), R0(_R0), cR1(_cR1), cR2(_cR2)
   { setup_parameters(); }
 
 XC::Steel02::Steel02(int tag, double _fy, double _E0, double _b, double _R0, double _cR1, double _cR2)
   : SteelBase(tag, MAT_TAG_Steel02,_fy,_E0,_b,0.0,1.0,0.0,1.0),
-    sigini(0.0), R0(_R0), cR1(_cR1), cR2(_cR2), konP(0)
+    sigini(0.0), R0(_R0), cR1(_cR1), cR2(_cR2)
   { setup_parameters(); }
 
 XC::Steel02::Steel02(int tag, double _fy, double _E0,double _b)
   : SteelBase(tag, MAT_TAG_Steel02,_fy,_E0,_b,0.0,1.0,0.0,1.0),
-    sigini(0.0), R0(15.0), cR1(0.925), cR2(0.15),konP(0) //Default values for elastic to hardening transitions
+    sigini(0.0), R0(15.0), cR1(0.925), cR2(0.15) //Default values for elastic to hardening transitions
   { setup_parameters(); }
 
 XC::Steel02::Steel02(int tag)
   : SteelBase(tag, MAT_TAG_Steel02,0.0,0.0,0.0,0.0,1.0,0.0,1.0),
-    sigini(0.0), R0(15.0), cR1(0.925), cR2(0.15), konP(0) // Default values for elastic to hardening transitions
+    sigini(0.0), R0(15.0), cR1(0.925), cR2(0.15) // Default values for elastic to hardening transitions
   { setup_parameters(); }
 
 XC::Steel02::Steel02(void)
-  : SteelBase(0, MAT_TAG_Steel02),sigini(0.0), konP(0) {}
+  : SteelBase(0, MAT_TAG_Steel02),sigini(0.0) {}
 
 //! @brief Sets the initial stress value.
 void XC::Steel02::setInitialStress(const double &d)
@@ -138,50 +138,50 @@ int XC::Steel02::setTrialStrain(double trialStrain, double strainRate)
     if(sigini != 0.0)
       {
         const double epsini= sigini/E0;
-        eps= trialStrain+epsini;
+        hstv.T->eps= trialStrain+epsini;
       }
     else
-        eps= trialStrain;
+        hstv.T->eps= trialStrain;
     // modified C-P. Lamarche 2006
 
-    double deps= eps - epsP;
+    double deps= hstv.T->eps - hstv.C->eps;
 
 
-    epsmax= epsmaxP;
-    epsmin= epsminP;
-    epspl = epsplP;
-    epss0 = epss0P;  
-    sigs0 = sigs0P; 
-    epsr  = epssrP;  
-    sigr  = sigsrP;  
-    kon= konP;
+    hstv.T->epsmax= hstv.C->epsmax;
+    hstv.T->epsmin= hstv.C->epsmin;
+    hstv.T->epspl = hstv.C->epspl;
+    hstv.T->epss0 = hstv.C->epss0;  
+    hstv.T->sigs0 = hstv.C->sigs0; 
+    hstv.T->epsr  = hstv.C->epsr;  
+    hstv.T->sigr  = hstv.C->sigr;  
+    hstv.T->kon= hstv.C->kon;
 
-    if(kon == 0 || kon == 3) // modified C-P. Lamarche 2006
+    if(hstv.T->kon == 0 || hstv.T->kon == 3) // modified C-P. Lamarche 2006
       {
         if(fabs(deps) < 10.0*DBL_EPSILON)
           {
-            e= E0;
-            sig= sigini; // modified C-P. Lamarche 2006
-            kon= 3; // modified C-P. Lamarche 2006 flag to impose initial stess/strain
+            hstv.T->e= E0;
+            hstv.T->sig= sigini; // modified C-P. Lamarche 2006
+            hstv.T->kon= 3; // modified C-P. Lamarche 2006 flag to impose initial stess/strain
             return 0;
           }
         else
           {
-            epsmax= epsy;
-            epsmin= -epsy;
+            hstv.T->epsmax= epsy;
+            hstv.T->epsmin= -epsy;
             if(deps < 0.0)
               {
-                kon= 2;
-                epss0= epsmin;
-                sigs0= -fy;
-                epspl= epsmin;
+                hstv.T->kon= 2;
+                hstv.T->epss0= hstv.T->epsmin;
+                hstv.T->sigs0= -fy;
+                hstv.T->epspl= hstv.T->epsmin;
               }
             else
               {
-                kon= 1;
-                epss0= epsmax;
-                sigs0= fy;
-                epspl= epsmax;
+                hstv.T->kon= 1;
+                hstv.T->epss0= hstv.T->epsmax;
+                hstv.T->sigs0= fy;
+                hstv.T->epspl= hstv.T->epsmax;
               }
           }
        }
@@ -194,21 +194,21 @@ int XC::Steel02::setTrialStrain(double trialStrain, double strainRate)
     // asymptote by sigsft before calculating the intersection point 
     // Constants a3 and a4 control this stress shift on the tension side 
   
-    if(kon == 2 && deps > 0.0)
+    if(hstv.T->kon == 2 && deps > 0.0)
       {
-        kon= 1;
-        epsr= epsP;
-        sigr= sigP;
+        hstv.T->kon= 1;
+        hstv.T->epsr= hstv.C->eps;
+        hstv.T->sigr= hstv.C->sig;
         //epsmin= min(epsP, epsmin);
-        if(epsP < epsmin)
-          epsmin= epsP;
-        double d1= (epsmax - epsmin) / (2.0*(a4 * epsy));
+        if(hstv.C->eps < hstv.T->epsmin)
+          hstv.T->epsmin= hstv.C->eps;
+        double d1= (hstv.T->epsmax - hstv.T->epsmin) / (2.0*(a4 * epsy));
         double shft= 1.0 + a3 * pow(d1, 0.8);
-        epss0= (fy * shft - Esh * epsy * shft - sigr + E0 * epsr) / (E0 - Esh);
-        sigs0= fy * shft + Esh * (epss0 - epsy * shft);
-        epspl= epsmax;
+        hstv.T->epss0= (fy * shft - Esh * epsy * shft - hstv.T->sigr + E0 * hstv.T->epsr) / (E0 - Esh);
+        hstv.T->sigs0= fy * shft + Esh * (hstv.T->epss0 - epsy * shft);
+        hstv.T->epspl= hstv.T->epsmax;
       }
-    else if (kon == 1 && deps < 0.0)
+    else if (hstv.T->kon == 1 && deps < 0.0)
       {
     
         // update the maximum previous strain, store the last load reversal 
@@ -218,86 +218,64 @@ int XC::Steel02::setTrialStrain(double trialStrain, double strainRate)
         // asymptote by sigsft before calculating the intersection point 
         // Constants a1 and a2 control this stress shift on compression side 
 
-          kon= 2;
-          epsr= epsP;
-          sigr= sigP;
+          hstv.T->kon= 2;
+          hstv.T->epsr= hstv.C->eps;
+          hstv.T->sigr= hstv.C->sig;
           //      epsmax= max(epsP, epsmax);
-          if(epsP > epsmax)
-            epsmax= epsP;
+          if(hstv.C->eps > hstv.T->epsmax)
+            hstv.T->epsmax= hstv.C->eps;
 
-          double d1= (epsmax - epsmin) / (2.0*(a2 * epsy));
+          double d1= (hstv.T->epsmax - hstv.T->epsmin) / (2.0*(a2 * epsy));
           double shft= 1.0 + a1 * pow(d1, 0.8);
-          epss0= (-fy * shft + Esh * epsy * shft - sigr + E0 * epsr) / (E0 - Esh);
-          sigs0= -fy * shft + Esh * (epss0 + epsy * shft);
-          epspl= epsmin;
+          hstv.T->epss0= (-fy * shft + Esh * epsy * shft - hstv.T->sigr + E0 * hstv.T->epsr) / (E0 - Esh);
+          hstv.T->sigs0= -fy * shft + Esh * (hstv.T->epss0 + epsy * shft);
+          hstv.T->epspl= hstv.T->epsmin;
       }
   
     // calculate current stress sig and tangent modulus E 
 
-    double xi    = fabs((epspl-epss0)/epsy);
+    double xi    = fabs((hstv.T->epspl-hstv.T->epss0)/epsy);
     double R     = R0*(1.0 - (cR1*xi)/(cR2+xi));
-    double epsrat= (eps-epsr)/(epss0-epsr);
+    double epsrat= (hstv.T->eps-hstv.T->epsr)/(hstv.T->epss0-hstv.T->epsr);
     double dum1 = 1.0 + pow(fabs(epsrat),R);
     double dum2 = pow(dum1,(1/R));
 
-    sig  = b*epsrat +(1.0-b)*epsrat/dum2;
-    sig  = sig*(sigs0-sigr)+sigr;
+    hstv.T->sig  = b*epsrat +(1.0-b)*epsrat/dum2;
+    hstv.T->sig  = hstv.T->sig*(hstv.T->sigs0-hstv.T->sigr)+hstv.T->sigr;
 
-    e= b + (1.0-b)/(dum1*dum2);
-    e= e*(sigs0-sigr)/(epss0-epsr);
+    hstv.T->e= b + (1.0-b)/(dum1*dum2);
+    hstv.T->e= hstv.T->e*(hstv.T->sigs0-hstv.T->sigr)/(hstv.T->epss0-hstv.T->epsr);
     return 0;
   }
 
 
 
 double XC::Steel02::getStrain(void) const
-  { return eps; }
+  { return hstv.T->eps; }
 
 double XC::Steel02::getStress(void) const
-  { return sig; }
+  { return hstv.T->sig; }
 
 double XC::Steel02::getTangent(void) const
-  { return e; }
+  { return hstv.T->e; }
 
 int XC::Steel02::commitState(void)
-{
-  epsminP= epsmin;
-  epsmaxP= epsmax;
-  epsplP= epspl;
-  epss0P= epss0;
-  sigs0P= sigs0;
-  epssrP= epsr;
-  sigsrP= sigr;
-  konP= kon;
-  
-  eP= e;
-  sigP= sig;
-  epsP= eps;
-
-  return 0;
-}
+  {
+    hstv.commit();
+    return 0;
+  }
 
 int XC::Steel02::revertToLastCommit(void)
   {
-    epsmin= epsminP;
-    epsmax= epsmaxP;
-    epspl= epsplP;
-    epss0= epss0P;
-    sigs0= sigs0P;
-    epsr= epssrP;
-    sigr= sigsrP;
-    kon= konP;
-  
-    e= eP;
-    sig= sigP;
-    eps= epsP;
+    hstv.revert();
     return 0;
   }
 
 int XC::Steel02::revertToStart(void)
   {
     setup_parameters();
-    konP= 0;
+    hstv.C->kon= 0;
+    hstv.T->kon= 0;
     return 0;
   }
 
@@ -313,11 +291,11 @@ XC::DbTagData &XC::Steel02::getDbTagData(void) const
 int XC::Steel02::sendData(CommParameters &cp)
   {
     int res= SteelBase::sendData(cp);
-    res+= cp.sendDoubles(sigini,R0,cR1,cR2,epsminP,epsmaxP,getDbTagData(),CommMetaData(4));
-    res+= cp.sendDoubles(epsplP,epss0P,sigs0P,epssrP,sigsrP,epsP,getDbTagData(),CommMetaData(5));
-    res+= cp.sendInts(konP,kon,getDbTagData(),CommMetaData(6));
-    res+= cp.sendDoubles(sigP,eP,epsmin,epsmax,epspl,epss0,getDbTagData(),CommMetaData(7));
-    res+= cp.sendDoubles(sigs0,epsr,sigr,sig,e,eps,getDbTagData(),CommMetaData(8));
+    res+= cp.sendDoubles(sigini,R0,cR1,cR2,hstv.C->epsmin,hstv.C->epsmax,getDbTagData(),CommMetaData(4));
+    res+= cp.sendDoubles(hstv.C->epspl,hstv.C->epss0,hstv.C->sigs0,hstv.C->epsr,hstv.C->sigr,hstv.C->eps,getDbTagData(),CommMetaData(5));
+    res+= cp.sendInts(hstv.C->kon,hstv.T->kon,getDbTagData(),CommMetaData(6));
+    res+= cp.sendDoubles(hstv.C->sig,hstv.C->e,hstv.T->epsmin,hstv.T->epsmax,hstv.T->epspl,hstv.T->epss0,getDbTagData(),CommMetaData(7));
+    res+= cp.sendDoubles(hstv.T->sigs0,hstv.T->epsr,hstv.T->sigr,hstv.T->sig,hstv.T->e,hstv.T->eps,getDbTagData(),CommMetaData(8));
     return res;
   }
 
@@ -325,11 +303,11 @@ int XC::Steel02::sendData(CommParameters &cp)
 int XC::Steel02::recvData(const CommParameters &cp)
   {
     int res= SteelBase::recvData(cp);
-    res+= cp.receiveDoubles(sigini,R0,cR1,cR2,epsminP,epsmaxP,getDbTagData(),CommMetaData(4));
-    res+= cp.receiveDoubles(epsplP,epss0P,sigs0P,epssrP,sigsrP,epsP,getDbTagData(),CommMetaData(5));
-    res+= cp.receiveInts(konP,kon,getDbTagData(),CommMetaData(6));
-    res+= cp.receiveDoubles(sigP,eP,epsmin,epsmax,epspl,epss0,getDbTagData(),CommMetaData(7));
-    res+= cp.receiveDoubles(sigs0,epsr,sigr,sig,e,eps,getDbTagData(),CommMetaData(8));
+    res+= cp.receiveDoubles(sigini,R0,cR1,cR2,hstv.C->epsmin,hstv.C->epsmax,getDbTagData(),CommMetaData(4));
+    res+= cp.receiveDoubles(hstv.C->epspl,hstv.C->epss0,hstv.C->sigs0,hstv.C->epsr,hstv.C->sigr,hstv.C->eps,getDbTagData(),CommMetaData(5));
+    res+= cp.receiveInts(hstv.C->kon,hstv.T->kon,getDbTagData(),CommMetaData(6));
+    res+= cp.receiveDoubles(hstv.C->sig,hstv.C->e,hstv.T->epsmin,hstv.T->epsmax,hstv.T->epspl,hstv.T->epss0,getDbTagData(),CommMetaData(7));
+    res+= cp.receiveDoubles(hstv.T->sigs0,hstv.T->epsr,hstv.T->sigr,hstv.T->sig,hstv.T->e,hstv.T->eps,getDbTagData(),CommMetaData(8));
     return res;
   }
 
@@ -367,4 +345,4 @@ int XC::Steel02::recvSelf(const CommParameters &cp)
 
 //! @brief Print stuff.
 void XC::Steel02::Print(std::ostream &s, int flag)
-  { s << "Steel02:(strain, stress, tangent) " << eps << " " << sig << " " << e << std::endl; }
+  { s << "Steel02:(strain, stress, tangent) " << hstv.T->eps << " " << hstv.T->sig << " " << hstv.T->e << std::endl; }
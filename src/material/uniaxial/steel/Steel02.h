@@ -66,8 +66,26 @@
 #define Steel02_h
 
 #include "material/uniaxial/steel/SteelBase.h"
+#include "material/MaterialStateVars.h"
 
 namespace XC {
+
+//! @brief History variables of the Steel02 material.
+struct Steel02State
+  {
+    double epsmin; //!< max eps in compression
+    double epsmax; //!< max eps in tension
+    double epspl;  //!< plastic excursion
+    double epss0;  //!< eps at asymptotes intersection
+    double sigs0;  //!< sig at asymptotes intersection
+    double epsr;   //!< eps at last inversion point
+    double sigr;   //!< sig at last inversion point
+    int kon;       //!< index for loading/unloading
+    double sig;    //!< stress
+    double e;      //!< stiffness modulus
+    double eps;    //!< strain
+  };
+
 //! @ingroup MatUnx
 //
 //! @brief Uniaxial material for steel. Menegotto-Pinto steel
@@ -80,31 +98,8 @@ class Steel02 : public SteelBase
     double R0;  //!<  = matpar(4)  : exp transition elastic-plastic
     double cR1; //!<  = matpar(5)  : coefficient for changing R0 to R
     double cR2; //!<  = matpar(6)  : coefficient for changing R0 to R
-    // hstvP : STEEL HISTORY VARIABLES
-    double epsminP; //!<  = hstvP(1) : max eps in compression
-    double epsmaxP; //!<  = hstvP(2) : max eps in tension
-    double epsplP;  //!<  = hstvP(3) : plastic excursion
-    double epss0P;  //!<  = hstvP(4) : eps at asymptotes intersection
-    double sigs0P;  //!<  = hstvP(5) : sig at asymptotes intersection
-    double epssrP;  //!<  = hstvP(6) : eps at last inversion point
-    double sigsrP;  //!<  = hstvP(7) : sig at last inversion point
-    int    konP;    //!<  = hstvP(8) : index for loading/unloading
-    // hstv : STEEL HISTORY VARIABLES
-    double epsP;  //!<  = strain at previous converged step
-    double sigP;  //!<  = stress at previous converged step
-    double eP;    //!<   stiffness modulus at last converged step;
-
-    double epsmin;
-    double epsmax;
-    double epspl;
-    double epss0;
-    double sigs0;
-    double epsr;
-    double sigr;
-    int kon;
-    double sig;
-    double e;
-    double eps;   //!< strain at current step
+    // STEEL HISTORY VARIABLES (committed: hstv.C, trial: hstv.T)
+    MaterialStateVars<Steel02State> hstv; //!< History variables.
   protected:
     int setup_parameters(void);
     DbTagData &getDbTagData(void) const;
@@ -131,6 +126,9 @@ class Steel02 : public SteelBase
 
     int commitState(void);
     int revertToLastCommit(void);
+    //! @brief Return true if the state variables are in the store of the mesh.
+    bool isStateInStore(void) const
+      { return hstv.isAttached(); }
     int revertToStart(void);
 
     void setInitialStress(const double &);
@@ -170,76 +170,76 @@ void XC::Steel03::determineTrialState (double dStrain)
       double Esh = b*E0;
       double epsy = fy/E0;
       
-      double c1 = Esh*Tstrain;
-      double c2 = TshiftN*fyOneMinusB;
-      double c3 = TshiftP*fyOneMinusB;
-      double c = Cstress + E0*dStrain;
+      double c1 = Esh*hstv.T->strain;
+      double c2 = hstv.T->shiftN*fyOneMinusB;
+      double c3 = hstv.T->shiftP*fyOneMinusB;
+      double c = hstv.C->stress + E0*dStrain;
       
       //
       // Determine if a load reversal has occurred due to the trial strain
       //
 
       // Determine initial loading condition
-      if (Tloading == 0 && dStrain != 0.0) {
-          TmaxStrain = epsy;
-          TminStrain = -epsy;
+      if (hstv.T->loading == 0 && dStrain != 0.0) {
+          hstv.T->maxStrain = epsy;
+          hstv.T->minStrain = -epsy;
 	  if (dStrain > 0.0) {
-	    Tloading = 1;
-            TbStrain = TmaxStrain;
+	    hstv.T->loading = 1;
+            TbStrain = hstv.T->maxStrain;
             TbStress = fy;
-            Tplastic = TmaxStrain;
+            Tplastic = hstv.T->maxStrain;
           }
 	  else {
-	    Tloading = -1;
-            TbStrain = TminStrain;
+	    hstv.T->loading = -1;
+            TbStrain = hstv.T->minStrain;
             TbStress = -fy;
-            Tplastic = TminStrain;
+            Tplastic = hstv.T->minStrain;
           }
 
-          double intval = 1+pow(fabs(Tstrain/epsy),TcurR);
-          Tstress = c1+(1-b)*E0*Tstrain/pow(intval,1/TcurR);
-          Ttangent = Esh+E0*(1-b)/pow(intval,1+1/TcurR);
+          double intval = 1+pow(fabs(hstv.T->strain/epsy),TcurR);
+          hstv.T->stress = c1+(1-b)*E0*hstv.T->strain/pow(intval,1/TcurR);
+          hstv.T->tangent = Esh+E0*(1-b)/pow(intval,1+1/TcurR);
       }
           
       // Transition from loading to unloading, i.e. positive strain increment
       // to negative strain increment
-      if (Tloading == 1 && dStrain < 0.0) {
-	  Tloading = -1;
-	  if (Cstrain > TmaxStrain)
-	    TmaxStrain = Cstrain;
-          Tplastic = TminStrain;
-	  TshiftN = 1 + a1*pow((TmaxStrain-TminStrain)/(2.0*a2*epsy),0.8);
-          TrStrain = Cstrain;
-          TrStress = Cstress;
-          TbStrain = (c2+c)/E0/(b-1)+Tstrain/(1-b);
+      if (hstv.T->loading == 1 && dStrain < 0.0) {
+	  hstv.T->loading = -1;
+	  if (hstv.C->strain > hstv.T->maxStrain)
+	    hstv.T->maxStrain = hstv.C->strain;
+          Tplastic = hstv.T->minStrain;
+	  hstv.T->shiftN = 1 + a1*pow((hstv.T->maxStrain-hstv.T->minStrain)/(2.0*a2*epsy),0.8);
+          TrStrain = hstv.C->strain;
+          TrStress = hstv.C->stress;
+          TbStrain = (c2+c)/E0/(b-1)+hstv.T->strain/(1-b);
           TbStress = 1/(b-1)*(b*c2+b*c-c1)-c2;
-          TcurR = getR((TbStrain-TminStrain)/epsy);
+          TcurR = getR((TbStrain-hstv.T->minStrain)/epsy);
       }
 
       // Transition from unloading to loading, i.e. negative strain increment
       // to positive strain increment
-      if (Tloading == -1 && dStrain > 0.0) {
-	  Tloading = 1;
-	  if (Cstrain < TminStrain)
-	    TminStrain = Cstrain;
-          Tplastic = TmaxStrain;
-	  TshiftP = 1 + a3*pow((TmaxStrain-TminStrain)/(2.0*a4*epsy),0.8);
-          TrStrain = Cstrain;
-          TrStress = Cstress;
-          TbStrain = (c3-c)/E0/(1-b)+Tstrain/(1-b);
+      if (hstv.T->loading == -1 && dStrain > 0.0) {
+	  hstv.T->loading = 1;
+	  if (hstv.C->strain < hstv.T->minStrain)
+	    hstv.T->minStrain = hstv.C->strain;
+          Tplastic = hstv.T->maxStrain;
+	  hstv.T->shiftP = 1 + a3*pow((hstv.T->maxStrain-hstv.T->minStrain)/(2.0*a4*epsy),0.8);
+          TrStrain = hstv.C->strain;
+          TrStress = hstv.C->stress;
+          TbStrain = (c3-c)/E0/(1-b)+hstv.T->strain/(1-b);
           TbStress = 1/(1-b)*(b*c3-b*c+c1)+c3;
-          TcurR = getR((TmaxStrain-TbStrain)/epsy);
+          TcurR = getR((hstv.T->maxStrain-TbStrain)/epsy);
       }
       
-      if (Cloading != 0) {
+      if (hstv.C->loading != 0) {
           double c4 = TbStrain - TrStrain;
           double c5 = TbStress - TrStress;
-          double c6 = Tstrain - TrStrain;
+          double c6 = hstv.T->strain - TrStrain;
           double c4c5 = c5/c4;
           double intval = 1+pow(fabs(c6/c4),TcurR);
           
-          Tstress = TrStress+b*c4c5*c6+(1-b)*c4c5*c6/pow(intval,1/TcurR);
-          Ttangent = c4c5*b+c4c5*(1-b)/pow(intval,1+1/TcurR);
+          hstv.T->stress = TrStress+b*c4c5*c6+(1-b)*c4c5*c6/pow(intval,1/TcurR);
+          hstv.T->tangent = c4c5*b+c4c5*(1-b)/pow(intval,1+1/TcurR);
       }
 }
 
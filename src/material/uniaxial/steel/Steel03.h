@@ -127,6 +127,10 @@ class Steel03 : public SteelBase0103
 
     int commitState(void);
     int revertToLastCommit(void);    
+    //! @brief Return false, the history variables of Steel03 are
+    //! not in the store of the mesh.
+    bool isStateInStore(void) const
+      { return false; }
 
     UniaxialMaterial *getCopy(void) const;
     
@@ -39,26 +39,26 @@
 int XC::SteelBase0103::setup_parameters(void)
   {
     // History variables
-    CminStrain= 0.0;
-    CmaxStrain= 0.0;
-    CshiftP= 1.0;
-    CshiftN= 1.0;
-    Cloading= 0;
-
-    TminStrain= 0.0;
-    TmaxStrain= 0.0;
-    TshiftP= 1.0;
-    TshiftN= 1.0;
-    Tloading= 0;
+    hstv.C->minStrain= 0.0;
+    hstv.C->maxStrain= 0.0;
+    hstv.C->shiftP= 1.0;
+    hstv.C->shiftN= 1.0;
+    hstv.C->loading= 0;
+
+    hstv.T->minStrain= 0.0;
+    hstv.T->maxStrain= 0.0;
+    hstv.T->shiftP= 1.0;
+    hstv.T->shiftN= 1.0;
+    hstv.T->loading= 0;
 
     // State variables
-    Cstrain= 0.0;
-    Cstress= 0.0;
-    Ctangent= E0;
+    hstv.C->strain= 0.0;
+    hstv.C->stress= 0.0;
+    hstv.C->tangent= E0;
 
-    Tstrain= 0.0;
-    Tstress= 0.0;
-    Ttangent= E0;
+    hstv.T->strain= 0.0;
+    hstv.T->stress= 0.0;
+    hstv.T->tangent= E0;
     return 0;
   }
 
@@ -80,23 +80,23 @@ int XC::SteelBase0103::setTrialStrain(double strain, double strainRate)
       std::clog << "Warning: the strain in material SteelBase0103 is very big: "
                 << strain << std::endl;
     // Reset history variables to last converged state
-    TminStrain= CminStrain;
-    TmaxStrain= CmaxStrain;
-    TshiftP= CshiftP;
-    TshiftN= CshiftN;
-    Tloading= Cloading;
+    hstv.T->minStrain= hstv.C->minStrain;
+    hstv.T->maxStrain= hstv.C->maxStrain;
+    hstv.T->shiftP= hstv.C->shiftP;
+    hstv.T->shiftN= hstv.C->shiftN;
+    hstv.T->loading= hstv.C->loading;
 
-    Tstrain= Cstrain;
-    Tstress= Cstress;
-    Ttangent= Ctangent;
+    hstv.T->strain= hstv.C->strain;
+    hstv.T->stress= hstv.C->stress;
+    hstv.T->tangent= hstv.C->tangent;
 
     // Determine change in strain from last converged state
-    const double dStrain= strain - Cstrain;
+    const double dStrain= strain - hstv.C->strain;
 
     if(fabs(dStrain) > DBL_EPSILON)
       {
         // Set trial strain
-        Tstrain = strain;
+        hstv.T->strain = strain;
         // Calculate the trial state given the trial strain
         determineTrialState(dStrain);
       }
@@ -106,50 +106,31 @@ int XC::SteelBase0103::setTrialStrain(double strain, double strainRate)
 int XC::SteelBase0103::setTrial(double strain, double &stress, double &tangent, double strainRate)
   {
     setTrialStrain(strain,strainRate);
-    stress= Tstress;
-    tangent= Ttangent;
+    stress= hstv.T->stress;
+    tangent= hstv.T->tangent;
     return 0;
   }
 
 double XC::SteelBase0103::getStrain(void) const
-  { return Tstrain; }
+  { return hstv.T->strain; }
 
 double XC::SteelBase0103::getStress(void) const
-  { return Tstress; }
+  { return hstv.T->stress; }
 
 double XC::SteelBase0103::getTangent(void) const
-  { return Ttangent; }
+  { return hstv.T->tangent; }
 
+//! @brief Commit the material state (converged values= trial values).
 int XC::SteelBase0103::commitState(void)
   {
-    // History variables
-    CminStrain= TminStrain;
-    CmaxStrain= TmaxStrain;
-    CshiftP= TshiftP;
-    CshiftN= TshiftN;
-    Cloading= Tloading;
-
-    // State variables
-    Cstrain= Tstrain;
-    Cstress= Tstress;
-    Ctangent= Ttangent;
+    hstv.commit();
     return 0;
   }
 
 //! @brief Reset material to last committed state
 int XC::SteelBase0103::revertToLastCommit(void)
   {
-    // Reset trial history variables to last committed state
-    TminStrain= CminStrain;
-    TmaxStrain= CmaxStrain;
-    TshiftP= CshiftP;
-    TshiftN= CshiftN;
-    Tloading= Cloading;
-
-    // Reset trial state variables to last committed state
-    Tstrain = Cstrain;
-    Tstress = Cstress;
-    Ttangent = Ctangent;
+    hstv.revert();
     return 0;
   }
 
@@ -164,10 +145,10 @@ int XC::SteelBase0103::revertToStart(void)
 int XC::SteelBase0103::sendData(CommParameters &cp)
   {
     int res= SteelBase::sendData(cp);
-    res+= cp.sendDoubles(Cstrain,Cstress,Ctangent,Tstrain,Tstress,Ttangent,getDbTagData(),CommMetaData(4));
-    res+= cp.sendDoubles(CminStrain,CmaxStrain,CshiftP,CshiftN,getDbTagData(),CommMetaData(5));
-    res+= cp.sendInts(Cloading,Tloading,getDbTagData(),CommMetaData(6));
-    res+= cp.sendDoubles(TminStrain,TmaxStrain,TshiftP,TshiftN,getDbTagData(),CommMetaData(7));
+    res+= cp.sendDoubles(hstv.C->strain,hstv.C->stress,hstv.C->tangent,hstv.T->strain,hstv.T->stress,hstv.T->tangent,getDbTagData(),CommMetaData(4));
+    res+= cp.sendDoubles(hstv.C->minStrain,hstv.C->maxStrain,hstv.C->shiftP,hstv.C->shiftN,getDbTagData(),CommMetaData(5));
+    res+= cp.sendInts(hstv.C->loading,hstv.T->loading,getDbTagData(),CommMetaData(6));
+    res+= cp.sendDoubles(hstv.T->minStrain,hstv.T->maxStrain,hstv.T->shiftP,hstv.T->shiftN,getDbTagData(),CommMetaData(7));
     return res;
   }
 
@@ -175,10 +156,10 @@ int XC::SteelBase0103::sendData(CommParameters &cp)
 int XC::SteelBase0103::recvData(const CommParameters &cp)
   {
     int res= SteelBase::recvData(cp);
-    res+= cp.receiveDoubles(Cstrain,Cstress,Ctangent,Tstrain,Tstress,Ttangent,getDbTagData(),CommMetaData(4));
-    res+= cp.receiveDoubles(CminStrain,CmaxStrain,CshiftP,CshiftN,getDbTagData(),CommMetaData(5));
-    res+= cp.receiveInts(Cloading,Tloading,getDbTagData(),CommMetaData(6));
-    res+= cp.receiveDoubles(TminStrain,TmaxStrain,TshiftP,TshiftN,getDbTagData(),CommMetaData(7));
+    res+= cp.receiveDoubles(hstv.C->strain,hstv.C->stress,hstv.C->tangent,hstv.T->strain,hstv.T->stress,hstv.T->tangent,getDbTagData(),CommMetaData(4));
+    res+= cp.receiveDoubles(hstv.C->minStrain,hstv.C->maxStrain,hstv.C->shiftP,hstv.C->shiftN,getDbTagData(),CommMetaData(5));
+    res+= cp.receiveInts(hstv.C->loading,hstv.T->loading,getDbTagData(),CommMetaData(6));
+    res+= cp.receiveDoubles(hstv.T->minStrain,hstv.T->maxStrain,hstv.T->shiftP,hstv.T->shiftN,getDbTagData(),CommMetaData(7));
     return res;
   }
 
@@ -29,6 +29,7 @@
 #define SteelBase0103_h
 
 #include "material/uniaxial/steel/SteelBase.h"
+#include "material/MaterialStateVars.h"
 
 
 namespace XC {
@@ -39,39 +40,32 @@ const double STEEL_0103_DEFAULT_A2= 55.0;
 const double STEEL_0103_DEFAULT_A3= 0.0;
 const double STEEL_0103_DEFAULT_A4= 55.0;
 
+//! @ingroup MatUnx
+//
+//! @brief State and history variables of Steel01 and Steel03
+//! materials.
+struct SteelBase0103State
+  {
+    double minStrain; //!< Minimum strain in compression
+    double maxStrain; //!< Maximum strain in tension
+    double shiftP; //!< Shift in hysteresis loop for positive loading
+    double shiftN; //!< Shift in hysteresis loop for negative loading
+    double strain;
+    double stress;
+    double tangent; //!< Not really a state variable (only for convenience).
+    int loading; //!< Flag for loading/unloading
+                 // 1 = loading (positive strain increment)
+                 // -1 = unloading (negative strain increment)
+                 // 0 initially
+  };
+
 //! @ingroup MatUnx
 //
 //! @brief Base class for Steel01 and Steel03.
 class SteelBase0103: public SteelBase
   {
   protected:
-    /*** CONVERGED History Variables ***/
-    double CminStrain;  //!< Minimum strain in compression
-    double CmaxStrain;  //!< Maximum strain in tension
-    double CshiftP;     //!< Shift in hysteresis loop for positive loading
-    double CshiftN;     //!< Shift in hysteresis loop for negative loading
-    int Cloading;       //!< Flag for loading/unloading
-                        // 1 = loading (positive strain increment)
-                        // -1 = unloading (negative strain increment)
-                        // 0 initially
-
-    /*** CONVERGED State Variables ***/
-    double Cstrain;
-    double Cstress;
-    double Ctangent;
-
-    /*** TRIAL State Variables ***/
-    double Tstrain;
-    double Tstress;
-    double Ttangent; // Not really a state variable, but declared here
-                     // for convenience
-
-    /*** TRIAL History Variables ***/
-    double TminStrain;
-    double TmaxStrain;
-    double TshiftP;
-    double TshiftN;
-    int Tloading;
+    MaterialStateVars<SteelBase0103State> hstv; //!< trial (T) and converged (C) state and history variables.
 
     virtual void determineTrialState(double dStrain)= 0;
 
@@ -95,6 +89,9 @@ class SteelBase0103: public SteelBase
 
     int commitState(void);
     int revertToLastCommit(void);
+    //! @brief Return true if the state variables are in the store of the mesh.
+    virtual bool isStateInStore(void) const
+      { return hstv.isAttached(); }
     int revertToStart(void);
 
     void Print(std::ostream &s, int flag =0);
@@ -0,0 +1,341 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ResultsStore.cc
+
+#include "ResultsStore.h"
+#include "preprocessor/set_mgmt/SetMeshComp.h"
+#include "domain/mesh/node/Node.h"
+#include "domain/mesh/element/Element.h"
+#include "domain/mesh/element/truss_beam_column/elasticBeamColumn/ElasticBeam2d.h"
+#include "domain/mesh/element/truss_beam_column/elasticBeamColumn/ElasticBeam3d.h"
+#include "domain/mesh/element/truss_beam_column/NLForceBeamColumn2dBase.h"
+#include "domain/mesh/element/truss_beam_column/NLForceBeamColumn3dBase.h"
+#include "domain/mesh/element/plane/shell/ShellMITC4Base.h"
+#include "domain/mesh/element/plane/shell/ShellNL.h"
+#include "material/section/SectionForceDeformation.h"
+#include "utility/matrix/Vector.h"
+#include <cmath>
+#include <cstring>
+#include <stdint.h>
+
+//! @brief Computes the components of the resultants (xx, yy, xy)
+//! in a system rotated theta radians around the z(3) axis (same
+//! formula as internal_forces.transformInternalForces).
+static void rotate_resultants(double &xx, double &yy, double &xy,const double &theta)
+  {
+    const double cos2T= std::cos(2*theta);
+    const double sin2T= std::sin(2*theta);
+    const double tmpA= (xx+yy)/2.0;
+    const double tmpB= (xx-yy)/2.0*cos2T+xy*sin2T;
+    const double xyR= -(xx-yy)/2.0*sin2T+xy*cos2T;
+    xx= tmpA+tmpB;
+    yy= tmpA-tmpB;
+    xy= xyR;
+  }
+
+//! @brief Appends the Wood-Armer internal forces (one row for each axis)
+//! computed from the mean generalized stresses of the shell element.
+template <class ShellElem>
+static bool get_wood_armer_forces(ShellElem *shell,const std::map<int,double> &shellRotations,double wa[2][6])
+  {
+    shell->getResistingForce();
+    const XC::MaterialVector<XC::SectionForceDeformation> &mat= shell->getPhysicalProperties().getMaterialsVector();
+    double n1= mat.getMeanGeneralizedStressByName("n1");
+    double n2= mat.getMeanGeneralizedStressByName("n2");
+    double n12= mat.getMeanGeneralizedStressByName("n12");
+    double m1= mat.getMeanGeneralizedStressByName("m1");
+    double m2= mat.getMeanGeneralizedStressByName("m2");
+    double m12= mat.getMeanGeneralizedStressByName("m12");
+    double q13= mat.getMeanGeneralizedStressByName("q13");
+    double q23= mat.getMeanGeneralizedStressByName("q23");
+    std::map<int,double>::const_iterator i= shellRotations.find(shell->getTag());
+    if(i!=shellRotations.end())
+      {
+        const double theta= i->second;
+        rotate_resultants(n1,n2,n12,theta);
+        rotate_resultants(m1,m2,m12,theta);
+        double dummy= 0.0;
+        rotate_resultants(q13,q23,dummy,theta);
+      }
+    // Axis 1: N, Vy, Vz, T, My, Mz
+    wa[0][0]= n1; wa[0][1]= q13; wa[0][2]= n12;
+    wa[0][3]= 0.0; wa[0][4]= m1+std::copysign(m12,m1); wa[0][5]= 0.0;
+    // Axis 2.
+    wa[1][0]= n2; wa[1][1]= q23; wa[1][2]= n12;
+    wa[1][3]= 0.0; wa[1][4]= m2+std::copysign(m12,m2); wa[1][5]= 0.0;
+    return true;
+  }
+
+//! @brief Appends the internal forces at both ends of the 2D beam element.
+template <class Beam2d>
+static void get_beam2d_forces(Beam2d *beam,double f[2][6])
+  {
+    beam->getResistingForce();
+    f[0][0]= beam->getN1(); f[0][1]= beam->getV1(); f[0][2]= 0.0;
+    f[0][3]= 0.0; f[0][4]= 0.0; f[0][5]= beam->getM1();
+    f[1][0]= beam->getN2(); f[1][1]= beam->getV2(); f[1][2]= 0.0;
+    f[1][3]= 0.0; f[1][4]= 0.0; f[1][5]= beam->getM2();
+  }
+
+//! @brief Appends the internal forces at both ends of the 3D beam element.
+template <class Beam3d>
+static void get_beam3d_forces(Beam3d *beam,double f[2][6])
+  {
+    beam->getResistingForce();
+    f[0][0]= beam->getN1(); f[0][1]= beam->getVy1(); f[0][2]= beam->getVz1();
+    f[0][3]= beam->getT1(); f[0][4]= beam->getMy1(); f[0][5]= beam->getMz1();
+    f[1][0]= beam->getN2(); f[1][1]= beam->getVy2(); f[1][2]= beam->getVz2();
+    f[1][3]= beam->getT2(); f[1][4]= beam->getMy2(); f[1][5]= beam->getMz2();
+  }
+
+//! @brief Constructor.
+//!
+//! @param fName: name of the file to write (if not empty, the file
+//! is opened and its previous contents are discarded).
+XC::ResultsStore::ResultsStore(const std::string &fName)
+  : CommandEntity(), numBlocks(0)
+  {
+    if(!fName.empty())
+      open(fName);
+  }
+
+//! @brief Destructor.
+XC::ResultsStore::~ResultsStore(void)
+  { close(); }
+
+//! @brief Opens the file.
+//!
+//! @param fName: name of the file.
+//! @param append: if true, the new blocks are appended at the end
+//! of the file (if it exists).
+bool XC::ResultsStore::open(const std::string &fName,const bool &append)
+  {
+    close();
+    fileName= fName;
+    numBlocks= 0;
+    if(append)
+      out.open(fileName.c_str(),std::ios::out|std::ios::binary|std::ios::app);
+    else
+      out.open(fileName.c_str(),std::ios::out|std::ios::binary|std::ios::trunc);
+    if(!out)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; can't open file: '" << fileName << "'\n";
+        return false;
+      }
+    if(out.tellp()==std::streampos(0)) // new file: write header.
+      {
+        const uint32_t version= 1;
+        const uint32_t reserved= 0;
+        out.write("XCRSTORE",8);
+        out.write(reinterpret_cast<const char *>(&version),sizeof(version));
+        out.write(reinterpret_cast<const char *>(&reserved),sizeof(reserved));
+      }
+    return out.good();
+  }
+
+//! @brief Closes the file.
+void XC::ResultsStore::close(void)
+  {
+    if(out.is_open())
+      out.close();
+  }
+
+//! @brief Returns true if the file is open.
+bool XC::ResultsStore::isOpen(void) const
+  { return out.is_open(); }
+
+//! @brief Returns the name of the file.
+const std::string &XC::ResultsStore::getFileName(void) const
+  { return fileName; }
+
+//! @brief Returns the number of blocks written since the file
+//! was opened.
+size_t XC::ResultsStore::getNumBlocks(void) const
+  { return numBlocks; }
+
+//! @brief Sets the angle (radians) between the axes used to express
+//! the internal forces of the shell element and its local axes
+//! (see ShellMaterialInternalForces.transform).
+void XC::ResultsStore::setShellRotation(const int &tag,const double &theta)
+  { shellRotations[tag]= theta; }
+
+//! @brief Clears the rotation angles of the shell elements.
+void XC::ResultsStore::clearShellRotations(void)
+  { shellRotations.clear(); }
+
+//! @brief Writes zeros to align the stream to 8 bytes.
+void XC::ResultsStore::writePadding(const size_t &numBytes)
+  {
+    static const char zeros[8]= {0,0,0,0,0,0,0,0};
+    const size_t rem= numBytes%8;
+    if(rem)
+      out.write(zeros,8-rem);
+  }
+
+//! @brief Appends a row to the current block.
+void XC::ResultsStore::appendRow(const int &tag,const int &section,const double *v,const size_t &numComponents)
+  {
+    tags.push_back(tag);
+    sections.push_back(section);
+    values.insert(values.end(),v,v+numComponents);
+  }
+
+//! @brief Writes the rows of the current block.
+//!
+//! @param type: type of the results.
+//! @param name: name of the combination.
+//! @param numComponents: number of values on each row.
+int XC::ResultsStore::writeBlock(const BlockType &type,const std::string &name,const size_t &numComponents)
+  {
+    if(!out.is_open())
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; file not open.\n";
+        return -1;
+      }
+    const uint32_t blockType= type;
+    const uint64_t numRows= tags.size();
+    const uint64_t numComp= numComponents;
+    const uint64_t nameLength= name.size();
+    out.write("XCBK",4);
+    out.write(reinterpret_cast<const char *>(&blockType),sizeof(blockType));
+    out.write(reinterpret_cast<const char *>(&numRows),sizeof(numRows));
+    out.write(reinterpret_cast<const char *>(&numComp),sizeof(numComp));
+    out.write(reinterpret_cast<const char *>(&nameLength),sizeof(nameLength));
+    out.write(name.c_str(),nameLength);
+    writePadding(nameLength);
+    if(numRows>0)
+      {
+        std::vector<int32_t> tmp(tags.begin(),tags.end());
+        out.write(reinterpret_cast<const char *>(&tmp[0]),numRows*sizeof(int32_t));
+        writePadding(numRows*sizeof(int32_t));
+        tmp.assign(sections.begin(),sections.end());
+        out.write(reinterpret_cast<const char *>(&tmp[0]),numRows*sizeof(int32_t));
+        writePadding(numRows*sizeof(int32_t));
+        // write by columns.
+        std::vector<double> column(numRows);
+        for(size_t j= 0;j<numComponents;j++)
+          {
+            for(size_t i= 0;i<numRows;i++)
+              column[i]= values[i*numComponents+j];
+            out.write(reinterpret_cast<const char *>(&column[0]),numRows*sizeof(double));
+          }
+      }
+    tags.clear();
+    sections.clear();
+    values.clear();
+    numBlocks++;
+    int retval= 0;
+    if(!out.good())
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; error writing file: '" << fileName << "'\n";
+        retval= -2;
+      }
+    return retval;
+  }
+
+//! @brief Appends the internal forces of the element to the current
+//! block. Returns false if the element type is not supported.
+bool XC::ResultsStore::appendElementInternalForces(Element *elem)
+  {
+    bool retval= true;
+    double f[2][6];
+    if(ElasticBeam2d *beam= dynamic_cast<ElasticBeam2d *>(elem))
+      get_beam2d_forces(beam,f);
+    else if(NLForceBeamColumn2dBase *beam= dynamic_cast<NLForceBeamColumn2dBase *>(elem))
+      get_beam2d_forces(beam,f);
+    else if(ElasticBeam3d *beam= dynamic_cast<ElasticBeam3d *>(elem))
+      get_beam3d_forces(beam,f);
+    else if(NLForceBeamColumn3dBase *beam= dynamic_cast<NLForceBeamColumn3dBase *>(elem))
+      get_beam3d_forces(beam,f);
+    else if(ShellMITC4Base *shell= dynamic_cast<ShellMITC4Base *>(elem))
+      get_wood_armer_forces(shell,shellRotations,f);
+    else if(ShellNL *shell= dynamic_cast<ShellNL *>(elem))
+      get_wood_armer_forces(shell,shellRotations,f);
+    else
+      retval= false;
+    if(retval)
+      {
+        const int tag= elem->getTag();
+        appendRow(tag,0,f[0],numInternalForces);
+        appendRow(tag,1,f[1],numInternalForces);
+      }
+    return retval;
+  }
+
+//! @brief Writes a block with the internal forces (N, Vy, Vz, T, My, Mz)
+//! of the elements of the set.
+//!
+//! For beam elements, the rows correspond to the back (section 0) and
+//! front end (section 1) of the element. For shell elements, the rows
+//! contain the Wood-Armer internal forces for axis 1 (section 0) and
+//! axis 2 (section 1) computed from the mean generalized stresses.
+//!
+//! @param combName: name of the load combination.
+//! @param set: set containing the elements.
+int XC::ResultsStore::writeInternalForces(const std::string &combName,const SetMeshComp &set)
+  {
+    const DqPtrsElem &elements= set.getElements();
+    tags.reserve(2*elements.size());
+    sections.reserve(2*elements.size());
+    values.reserve(2*numInternalForces*elements.size());
+    size_t numIgnored= 0;
+    for(DqPtrsElem::const_iterator i= elements.begin();i!=elements.end();i++)
+      if(!appendElementInternalForces(*i))
+        numIgnored++;
+    if(numIgnored>0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; WARNING internal forces not implemented for "
+                << numIgnored << " elements of set: '"
+                << set.getName() << "'. Ignored.\n";
+    return writeBlock(INTERNAL_FORCES,combName,numInternalForces);
+  }
+
+//! @brief Writes a block with the displacements of the nodes of the set.
+//!
+//! The number of components is the maximum number of degrees of
+//! freedom of the nodes (missing components are filled with zeros).
+//!
+//! @param combName: name of the load combination.
+//! @param set: set containing the nodes.
+int XC::ResultsStore::writeDisplacements(const std::string &combName,const SetMeshComp &set)
+  {
+    const DqPtrsNode &nodes= set.getNodes();
+    size_t numComponents= 0;
+    for(DqPtrsNode::const_iterator i= nodes.begin();i!=nodes.end();i++)
+      numComponents= std::max(numComponents,size_t((*i)->getNumberDOF()));
+    tags.reserve(nodes.size());
+    sections.reserve(nodes.size());
+    values.reserve(numComponents*nodes.size());
+    std::vector<double> row(numComponents);
+    for(DqPtrsNode::const_iterator i= nodes.begin();i!=nodes.end();i++)
+      {
+        const Vector &disp= (*i)->getDisp();
+        const size_t sz= disp.Size();
+        for(size_t j= 0;j<numComponents;j++)
+          row[j]= (j<sz) ? disp(j) : 0.0;
+        appendRow((*i)->getTag(),0,row.empty() ? nullptr : &row[0],numComponents);
+      }
+    return writeBlock(DISPLACEMENTS,combName,numComponents);
+  }
@@ -0,0 +1,90 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ResultsStore.h
+
+#ifndef RESULTSSTORE_H
+#define RESULTSSTORE_H
+
+#include "xc_utils/src/kernel/CommandEntity.h"
+#include <fstream>
+#include <map>
+#include <vector>
+
+namespace XC {
+class SetMeshComp;
+class Element;
+
+//!  @ingroup POST_PROCESS
+// 
+//!  @brief Binary store for the results (internal forces and
+//!  displacements) obtained for each load combination.
+//!
+//! The results are written in blocks (one for each combination and
+//! result type). Each block stores the tags of the elements (or nodes),
+//! the section indexes and the values of each component by columns
+//! so the file can be read using memory mapping (see the
+//! postprocess.results_store Python module).
+//!
+//! File layout (native byte order, 8 byte alignment):
+//! - header: "XCRSTORE" + version (uint32) + reserved (uint32).
+//! - blocks: "XCBK" + type (uint32) + number of rows (uint64)
+//!   + number of components (uint64) + name length (uint64), followed
+//!   by the name, the tags (int32), the section indexes (int32) and
+//!   the values of each component (double), each one padded to 8 bytes.
+class ResultsStore: public CommandEntity
+  {
+  public:
+    //! @brief Type of the results stored in a block.
+    enum BlockType {INTERNAL_FORCES= 1, DISPLACEMENTS= 2};
+    static const size_t numInternalForces= 6; //!< N, Vy, Vz, T, My, Mz.
+  private:
+    std::string fileName; //!< name of the file.
+    std::ofstream out; //!< output stream.
+    size_t numBlocks; //!< number of blocks written.
+    std::map<int,double> shellRotations; //!< angle (theta) of the shell element axes.
+    std::vector<int> tags; //!< tags of the rows of the current block.
+    std::vector<int> sections; //!< section indexes of the rows of the current block.
+    std::vector<double> values; //!< values of the current block (by rows).
+
+    void writePadding(const size_t &);
+    int writeBlock(const BlockType &,const std::string &,const size_t &);
+    void appendRow(const int &,const int &,const double *,const size_t &);
+    bool appendElementInternalForces(Element *);
+  public:
+    ResultsStore(const std::string &fName= "");
+    ~ResultsStore(void);
+
+    bool open(const std::string &,const bool &append= false);
+    void close(void);
+    bool isOpen(void) const;
+    const std::string &getFileName(void) const;
+    size_t getNumBlocks(void) const;
+
+    void setShellRotation(const int &,const double &);
+    void clearShellRotations(void);
+
+    int writeInternalForces(const std::string &,const SetMeshComp &);
+    int writeDisplacements(const std::string &,const SetMeshComp &);
+  };
+} // end of XC namespace
+
+#endif
@@ -47,3 +47,16 @@ class_<XC::MapFields, bases<CommandEntity,dq_fields> >("MapFields")
   .def("newField",make_function( &XC::MapFields::newField, return_internal_reference<>() ),"Defines a new field.")
   ;
 
+
+class_<XC::ResultsStore, bases<CommandEntity>, boost::noncopyable >("ResultsStore")
+  .def(init<std::string>())
+  .def("open",&XC::ResultsStore::open,"open(fileName,append): open the file to write the results (if append is false the previous contents are discarded).")
+  .def("close",&XC::ResultsStore::close,"Close the file.")
+  .add_property("isOpen",&XC::ResultsStore::isOpen,"True if the file is open.")
+  .add_property("fileName",make_function( &XC::ResultsStore::getFileName, return_value_policy<return_by_value>() ),"Name of the file.")
+  .add_property("numBlocks",&XC::ResultsStore::getNumBlocks,"Number of blocks written since the file was opened.")
+  .def("setShellRotation",&XC::ResultsStore::setShellRotation,"setShellRotation(elemTag,theta): set the angle (radians) of the axes used to express the internal forces of the shell element.")
+  .def("clearShellRotations",&XC::ResultsStore::clearShellRotations,"Clear the angles of the shell elements.")
+  .def("writeInternalForces",&XC::ResultsStore::writeInternalForces,"writeInternalForces(combName,set): write the internal forces of the elements of the set.")
+  .def("writeDisplacements",&XC::ResultsStore::writeDisplacements,"writeDisplacements(combName,set): write the displacements of the nodes of the set.")
+  ;
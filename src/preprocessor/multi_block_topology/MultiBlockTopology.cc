@@ -55,13 +55,25 @@
 
 #include "domain/mesh/node/Node.h"
 #include "domain/mesh/element/Element.h"
+#include <thread>
+#include <algorithm>
 
 //! @brief Constructor.
 XC::MultiBlockTopology::MultiBlockTopology(Preprocessor *prep)
   : PreprocessorContainer(prep), reference_systems(this),
     transformaciones_geometricas(this),
     points(this), edges(this), faces(this), cuerpos(this), unif_grid(this),
-    framework2d(this), framework3d(this) {}
+    framework2d(this), framework3d(this), numThreads(1) {}
+
+//! @brief Sets the number of threads used to mesh the surfaces
+//! (if zero use the number of concurrent threads supported by the
+//! hardware). With one thread the surfaces are meshed one by one.
+void XC::MultiBlockTopology::setNumThreads(const size_t &n)
+  {
+    numThreads= n;
+    if(numThreads==0)
+      numThreads= std::max(std::thread::hardware_concurrency(),1U);
+  }
 
 //! @brief Assign indexes to the objects (nodes,elements,points,...)
 //! to be used in VTK arrays.
@@ -82,6 +82,7 @@ class MultiBlockTopology: public PreprocessorContainer
     UniformGridMap unif_grid; //!< Uniform grids container.
     Framework2d framework2d; //!< Bi-dimensional framework container.
     Framework3d framework3d; //!< Three-dimensional framework container.
+    size_t numThreads; //!< Number of threads used to compute the interior node positions of the surfaces.
 
   protected:
 
@@ -95,6 +96,11 @@ class MultiBlockTopology: public PreprocessorContainer
     
     void conciliaNDivs(void);
 
+    //! @brief Returns the number of threads used to mesh the surfaces.
+    inline size_t getNumThreads(void) const
+      { return numThreads; }
+    void setNumThreads(const size_t &);
+
     void clearAll(void);
     //! @brief Destructor.
     virtual ~MultiBlockTopology(void);
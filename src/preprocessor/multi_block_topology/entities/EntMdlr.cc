@@ -34,6 +34,8 @@
 #include "domain/mesh/node/Node.h"
 #include "domain/domain/Domain.h"
 #include "domain/mesh/element/Element.h"
+#include "domain/mesh/Mesh.h"
+#include "utility/ObjectArena.h"
 #include "preprocessor/Preprocessor.h"
 #include "preprocessor/set_mgmt/IRowSet.h"
 #include "preprocessor/set_mgmt/JRowSet.h"
@@ -309,6 +311,16 @@ void XC::EntMdlr::create_nodes(const Pos3dArray3d &positions)
 //! @brief Creates elements on the nodes created
 //! in create_nodes.
 bool XC::EntMdlr::create_elements(meshing_dir dm)
+  {
+    const bool retval= put_elements_on_mesh(dm);
+    if(retval)
+      add_elements(ttzElements);
+    return retval;
+  }
+
+//! @brief Creates the elements on the nodes created in create_nodes
+//! without adding them to the model (see create_elements).
+bool XC::EntMdlr::put_elements_on_mesh(meshing_dir dm)
   {
     bool retval= false;
     if(!ttzNodes.empty())
@@ -328,8 +340,10 @@ bool XC::EntMdlr::create_elements(meshing_dir dm)
                   const Element *smll= getPreprocessor()->getElementHandler().get_seed_element();
                   if(smll)
                     {
+                      // the elements (and their materials) are
+                      // allocated from the arena of the mesh.
+                      ObjectArena::Scope scope(getPreprocessor()->getDomain()->getMesh().getObjectArena());
                       ttzElements= smll->put_on_mesh(ttzNodes,dm);
-                      add_elements(ttzElements);
                       retval= true;
                     }
                   else if(verbosity>0)
@@ -61,10 +61,12 @@ class EntMdlr: public SetEstruct
     ElemPtrArray3d ttzElements;
     friend class Set;
     friend class SetMeshComp;
+    friend class SetEntities;
     friend class MultiBlockTopology;
     virtual void update_topology(void)= 0;
     void create_nodes(const Pos3dArray3d &);
     Node *create_node(const Pos3d &pos,size_t i=1,size_t j=1, size_t k=1);
+    bool put_elements_on_mesh(meshing_dir dm);
     bool create_elements(meshing_dir dm);
     Pnt *create_point(const Pos3d &);
     void create_points(const Pos3dArray &);
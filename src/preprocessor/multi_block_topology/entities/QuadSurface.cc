@@ -465,41 +465,91 @@ Polygon3d XC::QuadSurface::getPolygon(void) const
     return retval;
   }
 
-//! @brief Creates surface nodes.
-void XC::QuadSurface::create_nodes(void)
+//! @brief Creates the nodes of the surface contour (the nodes of
+//! its lines) and put them in the node array.
+void XC::QuadSurface::create_contour_nodes(void)
   {
+    create_line_nodes();
 
-    checkNDivs();
-    if(ttzNodes.Null())
+    const size_t n_rows= NDivJ()+1;
+    const size_t cols= NDivI()+1;
+    ttzNodes = NodePtrArray3d(1,n_rows,cols);
+
+    //j=1
+    for(size_t k=1;k<=cols;k++)
       {
-        create_line_nodes();
+        Side &ll= lines[0];
+        Node *nn= ll.getNode(k);
+        ttzNodes(1,1,k)= nn;
+      }
 
-        const size_t n_rows= NDivJ()+1;
-        const size_t cols= NDivI()+1;
-        ttzNodes = NodePtrArray3d(1,n_rows,cols);
+    //j=n_rows.
+    for(size_t k=1;k<=cols;k++) //En sentido inverso.
+      ttzNodes(1,n_rows,k)= lines[2].getNodeReverse(k);
 
 
-        //j=1
-        for(size_t k=1;k<=cols;k++)
-          {
-            Side &ll= lines[0];
-            Node *nn= ll.getNode(k);
-            ttzNodes(1,1,k)= nn;
-          }
+    //k=1
+    for(size_t j=2;j<n_rows;j++) //En sentido inverso.
+      ttzNodes(1,j,1)= lines[3].getNodeReverse(j);
+    //k=cols.
+    for(size_t j=2;j<n_rows;j++)
+      ttzNodes(1,j,cols)= lines[1].getNode(j);
+  }
+
+//! @brief Return the number of interior nodes of the surface once
+//! the contour nodes are created.
+size_t XC::QuadSurface::getNumberOfInteriorNodes(void) const
+  {
+    size_t retval= 0;
+    const size_t n_rows= ttzNodes.getNumberOfRows();
+    const size_t cols= ttzNodes.getNumberOfColumns();
+    if((n_rows>2) && (cols>2))
+      retval= (n_rows-2)*(cols-2);
+    return retval;
+  }
 
-        //j=n_rows.
-        for(size_t k=1;k<=cols;k++) //En sentido inverso.
-          ttzNodes(1,n_rows,k)= lines[2].getNodeReverse(k);
+//! @brief Appends to the vector the positions of the interior nodes
+//! (rows first) once the contour nodes are created. It doesn't
+//! modify the model, so it can be called concurrently for different
+//! surfaces.
+void XC::QuadSurface::getInteriorNodePositions(std::vector<Pos3d> &positions) const
+  {
+    const size_t n_rows= ttzNodes.getNumberOfRows();
+    const size_t cols= ttzNodes.getNumberOfColumns();
+    if((n_rows>2) && (cols>2))
+      {
+        const Pos3dArray node_pos= get_positions(); //Node positions.
+        positions.reserve(positions.size()+(n_rows-2)*(cols-2));
+        for(size_t j= 2;j<n_rows;j++) //interior rows.
+          for(size_t k= 2;k<cols;k++) //interior columns.
+            positions.push_back(node_pos(j,k));
+      }
+  }
 
+//! @brief Put in the node array the interior nodes (in the order of
+//! getInteriorNodePositions), return an iterator to the first node
+//! not used.
+std::vector<XC::Node *>::const_iterator XC::QuadSurface::setInteriorNodes(std::vector<Node *>::const_iterator i)
+  {
+    const size_t n_rows= ttzNodes.getNumberOfRows();
+    const size_t cols= ttzNodes.getNumberOfColumns();
+    for(size_t j= 2;j<n_rows;j++) //interior rows.
+      for(size_t k= 2;k<cols;k++,i++) //interior columns.
+        ttzNodes(1,j,k)= *i;
+    return i;
+  }
 
-        //k=1
-        for(size_t j=2;j<n_rows;j++) //En sentido inverso.
-          ttzNodes(1,j,1)= lines[3].getNodeReverse(j);
-        //k=cols.
-        for(size_t j=2;j<n_rows;j++)
-          ttzNodes(1,j,cols)= lines[1].getNode(j);
+//! @brief Creates surface nodes.
+void XC::QuadSurface::create_nodes(void)
+  {
 
+    checkNDivs();
+    if(ttzNodes.Null())
+      {
+        create_contour_nodes();
 
+        const size_t n_rows= ttzNodes.getNumberOfRows();
+        const size_t cols= ttzNodes.getNumberOfColumns();
         Pos3dArray node_pos= get_positions(); //Node positions.
         for(size_t j= 2;j<n_rows;j++) //interior rows.
           for(size_t k= 2;k<cols;k++) //interior columns.
@@ -31,6 +31,7 @@
 
 #include "Face.h"
 #include "preprocessor/multi_block_topology/matrices/PntPtrArray.h"
+#include <vector>
 
 class Polygon3d;
 namespace XC {
@@ -72,6 +73,10 @@ class QuadSurface: public Face
 
     bool checkNDivs(const size_t &i,const size_t &j) const;
     bool checkNDivs(void) const;
+    void create_contour_nodes(void);
+    size_t getNumberOfInteriorNodes(void) const;
+    void getInteriorNodePositions(std::vector<Pos3d> &) const;
+    std::vector<Node *>::const_iterator setInteriorNodes(std::vector<Node *>::const_iterator);
     void create_nodes(void);
     void genMesh(meshing_dir dm);
   };
@@ -66,6 +66,7 @@ class_<XC::MultiBlockTopology, bases<XC::PreprocessorContainer>, boost::noncopya
   .add_property("get3DNets", make_function( getRefToFramework3d, return_internal_reference<>() ))
   .add_property("getUniformGrids", make_function( getUniformGridsRef, return_internal_reference<>() ))
   .def("conciliaNDivs", &XC::MultiBlockTopology::conciliaNDivs)
+  .add_property("numThreads", &XC::MultiBlockTopology::getNumThreads, &XC::MultiBlockTopology::setNumThreads,"Number of threads used to compute the positions of the interior nodes of the surfaces; nodes and elements are always created by the main thread (0: hardware concurrency; 1: mesh the surfaces one by one).")
   .def("getLineWithEndPoints",make_function( getLineWithEndPoints, return_internal_reference<>() ))
    ;
 
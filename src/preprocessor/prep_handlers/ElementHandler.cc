@@ -28,6 +28,7 @@
 
 #include "ElementHandler.h"
 #include "domain/domain/Domain.h"
+#include "domain/mesh/Mesh.h"
 #include "domain/mesh/element/Element.h"
 #include "preprocessor/Preprocessor.h"
 
@@ -35,6 +36,7 @@
 
 #include "domain/mesh/node/Node.h"
 #include "utility/tagged/DefaultTag.h"
+#include <algorithm>
 
 void XC::ElementHandler::SeedElemHandler::free_mem(void)
   {
@@ -106,6 +108,17 @@ XC::Element *XC::ElementHandler::getElement(int tag)
     return retval;
   }
 
+//! @brief Return the memory arena of the mesh (the elements created
+//! by this handler are allocated from it).
+XC::ObjectArena *XC::ElementHandler::get_object_arena(void)
+  {
+    ObjectArena *retval= nullptr;
+    Domain *dom= getDomain();
+    if(dom)
+      retval= dom->getMesh().getObjectArena();
+    return retval;
+  }
+
 //! @brief Adds the element to the model.
 void XC::ElementHandler::add(Element *e)
   {
@@ -113,6 +126,21 @@ void XC::ElementHandler::add(Element *e)
       new_element(e);
   }
 
+//! @brief Adds the elements to the model at once.
+bool XC::ElementHandler::add_elements(const std::vector<Element *> &elements)
+  {
+    const bool retval= getDomain()->addElements(elements);
+    if(retval)
+      {
+        getPreprocessor()->UpdateSets(elements);
+        int nextTag= getDefaultTag();
+        for(std::vector<Element *>::const_iterator i= elements.begin();i!=elements.end();i++)
+          nextTag= std::max(nextTag,(*i)->getTag()+1);
+        setDefaultTag(nextTag);
+      }
+    return retval;
+  }
+
 void XC::ElementHandler::clearAll(void)
   {
     seed_elem_handler.clearAll();
@@ -131,6 +159,18 @@ void XC::ElementHandler::Add(Element *e)
       }
   }
 
+//! @brief Adds the elements at once and set their identifiers (tags)
+//! consecutively starting at the default tag (bulk version of Add).
+void XC::ElementHandler::Add(const std::vector<Element *> &elements)
+  {
+    int tag= Element::getDefaultTag().getTag();
+    for(std::vector<Element *>::const_iterator i= elements.begin();i!=elements.end();i++,tag++)
+      (*i)->setTag(tag);
+    if(!add_elements(elements))
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; error adding " << elements.size()
+                << " elements." << std::endl;
+  }
 
 //! @brief Adds a new element to the model.
 void XC::ElementHandler::new_element(Element *e)
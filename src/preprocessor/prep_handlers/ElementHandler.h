@@ -62,6 +62,8 @@ class ElementHandler: public ProtoElementHandler
     SeedElemHandler seed_elem_handler; //!< Seed element for meshing.
   protected:
     virtual void add(Element *);
+    virtual bool add_elements(const std::vector<Element *> &);
+    virtual ObjectArena *get_object_arena(void);
   public:
     ElementHandler(Preprocessor *);
     Element *getElement(int tag);
@@ -73,6 +75,7 @@ class ElementHandler: public ProtoElementHandler
       { return seed_elem_handler.GetSeedElement(); }
 
     virtual void Add(Element *);
+    void Add(const std::vector<Element *> &);
 
     int getDefaultTag(void) const;
     void setDefaultTag(const int &tag);
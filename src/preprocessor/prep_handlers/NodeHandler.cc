@@ -38,6 +38,8 @@
 
 #include "domain/mesh/element/Element.h"
 #include "utility/tagged/DefaultTag.h"
+#include "utility/matrix/ID.h"
+#include "utility/xc_python_utils.h"
 
 void XC::NodeHandler::free_mem(void)
   {
@@ -107,6 +109,140 @@ XC::Node *XC::NodeHandler::duplicateNode(const int &orgNodeTag)
     return retval;
   }
 
+//! @brief Create the nodes whose coordinates are passed as
+//! parameter and add them to the domain and to the opened sets at
+//! once, so the KD trees are rebuilt only one time.
+//!
+//! @param coords: node coordinates (numCoords values for each node).
+//! @param numCoords: number of coordinates for each node (1, 2 or 3).
+//! @param tags: node identifiers (if empty the nodes are numbered
+//!              starting at the default tag).
+//! @return the new nodes (empty if an error occurs).
+std::vector<XC::Node *> XC::NodeHandler::new_nodes(const std::vector<double> &coords,const size_t &numCoords,const std::vector<int> &tags)
+  {
+    std::vector<Node *> retval;
+    if((numCoords<1) || (numCoords>3))
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; wrong number of coordinates: "
+                  << numCoords << " (must be 1, 2 or 3)." << std::endl;
+        return retval;
+      }
+    const size_t numNodes= coords.size()/numCoords;
+    if(!tags.empty() && (tags.size()!=numNodes))
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; number of tags: " << tags.size()
+                  << " doesn't match the number of nodes: "
+                  << numNodes << std::endl;
+        return retval;
+      }
+    const int tg= getDefaultTag(); //Before seed node creation.
+    if(!seed_node)
+      seed_node= new_node(0,ncoo_def_node,ndof_def_node,0.0,0.0,0.0);
+    const size_t dim= seed_node->getDim();
+    const int ndof= seed_node->getNumberDOF();
+
+    retval.resize(numNodes,nullptr);
+    int nextTag= tg;
+    for(size_t i= 0;i<numNodes;i++)
+      {
+        const int tag= (tags.empty() ? tg+static_cast<int>(i) : tags[i]);
+        const double *xyz= &coords[i*numCoords];
+        const double x= xyz[0];
+        const double y= (numCoords>1 ? xyz[1] : 0.0);
+        const double z= (numCoords>2 ? xyz[2] : 0.0);
+        retval[i]= new_node(tag,dim,ndof,x,y,z);
+        nextTag= std::max(nextTag,tag+1);
+      }
+    if(getDomain()->addNodes(retval))
+      {
+        getPreprocessor()->UpdateSets(retval);
+        setDefaultTag(nextTag);
+      }
+    else
+      {
+        for(std::vector<Node *>::iterator i= retval.begin();i!=retval.end();i++)
+          delete *i;
+        setDefaultTag(tg);
+        retval.clear();
+      }
+    return retval;
+  }
+
+//! @brief Create the nodes whose coordinates are passed as
+//! parameter (bulk version of newNode).
+//!
+//! @param coords: node coordinates (numCoords values for each node).
+//! @param numCoords: number of coordinates for each node (1, 2 or 3).
+//! @param tags: node identifiers (if empty the nodes are numbered
+//!              starting at the default tag).
+//! @return the identifiers of the new nodes (empty if an error occurs).
+XC::ID XC::NodeHandler::newNodes(const std::vector<double> &coords,const size_t &numCoords,const std::vector<int> &tags)
+  {
+    const std::vector<Node *> nodes= new_nodes(coords,numCoords,tags);
+    const size_t sz= nodes.size();
+    ID retval(sz);
+    for(size_t i= 0;i<sz;i++)
+      retval[i]= nodes[i]->getTag();
+    return retval;
+  }
+
+//! @brief Create nodes at the positions passed as parameter (bulk
+//! version of newNode).
+//!
+//! @param positions: node positions.
+//! @param tags: node identifiers (if empty the nodes are numbered
+//!              starting at the default tag).
+std::vector<XC::Node *> XC::NodeHandler::newNodes(const std::vector<Pos3d> &positions,const std::vector<int> &tags)
+  {
+    const size_t sz= positions.size();
+    std::vector<double> coords(3*sz);
+    for(size_t i= 0;i<sz;i++)
+      {
+        const Pos3d &p= positions[i];
+        coords[3*i]= p.x(); coords[3*i+1]= p.y(); coords[3*i+2]= p.z();
+      }
+    return new_nodes(coords,3,tags);
+  }
+
+//! @brief Create the nodes whose coordinates are passed as
+//! parameter (i. e. a NumPy array of shape (numNodes,numCoords)).
+XC::ID XC::NodeHandler::newNodes(const boost::python::object &coords)
+  { return newNodes(coords,boost::python::object()); }
+
+//! @brief Create the nodes whose coordinates are passed as
+//! parameter (i. e. a NumPy array of shape (numNodes,numCoords)).
+//!
+//! @param coords: node coordinates (i. e. NumPy array of shape (numNodes,numCoords)).
+//! @param tags: node identifiers (i. e. NumPy array of shape (numNodes)),
+//!              if None the nodes are numbered starting at the default tag.
+XC::ID XC::NodeHandler::newNodes(const boost::python::object &coords,const boost::python::object &tags)
+  {
+    ID retval;
+    std::vector<double> xyz;
+    size_t numNodes= 0, numCoords= 0;
+    if(!vector_double_from_py_array(coords,xyz,numNodes,numCoords))
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; can't read node coordinates." << std::endl;
+        return retval;
+      }
+    std::vector<int> tagValues;
+    if(!tags.is_none())
+      {
+        size_t numTags= 0, numCols= 0;
+        if(!vector_int_from_py_array(tags,tagValues,numTags,numCols) || (numCols>1))
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; can't read node tags." << std::endl;
+            return retval;
+          }
+      }
+    retval= newNodes(xyz,numCoords,tagValues);
+    return retval;
+  }
+
 XC::Node *XC::NodeHandler::newNode(const double &x,const double &y,const double &z)
   {
     const int tg= getDefaultTag(); //Before seed node creation.
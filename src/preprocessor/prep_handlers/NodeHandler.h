@@ -31,10 +31,13 @@
 
 #include "PrepHandler.h"
 #include "xc_utils/src/geom/pos_vec/Pos3d.h"
+#include <vector>
+#include <boost/python/object.hpp>
 
 namespace XC {
 
 class Node;
+class ID;
 
 //!  @ingroup Lodrs
 //! 
@@ -47,6 +50,7 @@ class NodeHandler: public PrepHandler
     Node *seed_node; //!< Seed node for semi-automatic meshing.
     void free_mem(void);
     Node *new_node(const int &tag,const size_t &dim,const int &ndof,const double &x,const double &y=0.0,const double &z=0.0);
+    std::vector<Node *> new_nodes(const std::vector<double> &,const size_t &,const std::vector<int> &);
   public:
     NodeHandler(Preprocessor *);
     virtual ~NodeHandler(void);
@@ -63,6 +67,10 @@ class NodeHandler: public PrepHandler
     Node *newNodeIDXY(const int &,const double &,const double &);
     Node *newNodeIDV(const int &,const Vector &);
     Node *duplicateNode(const int &);
+    ID newNodes(const std::vector<double> &,const size_t &,const std::vector<int> &);
+    std::vector<Node *> newNodes(const std::vector<Pos3d> &,const std::vector<int> &tags= std::vector<int>());
+    ID newNodes(const boost::python::object &);
+    ID newNodes(const boost::python::object &,const boost::python::object &);
 
     size_t getDimEspacio(void) const
       { return ncoo_def_node; }
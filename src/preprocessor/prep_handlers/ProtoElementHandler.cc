@@ -28,6 +28,7 @@
 
 #include "ProtoElementHandler.h"
 #include "create_elem.h"
+#include "utility/ObjectArena.h"
 
 #include "domain/mesh/element/truss_beam_column/truss/CorotTruss.h"
 #include "domain/mesh/element/truss_beam_column/truss/CorotTrussSection.h"
@@ -87,6 +88,10 @@
 #include "domain/mesh/element/zeroLength/ZeroLengthContact3D.h"
 
 #include "preprocessor/Preprocessor.h"
+#include "utility/xc_python_utils.h"
+#include "utility/tagged/DefaultTag.h"
+#include "domain/domain/Domain.h"
+#include <set>
 
 
 //! @brief Default constructor.
@@ -424,6 +429,7 @@ XC::Element *XC::ProtoElementHandler::newElement(const std::string &type,const I
     Element *retval= getPreprocessor()->getDomain()->getElement(tag_elem);
     if(!retval) //It doesn't already exists.
       {
+        ObjectArena::Scope scope(get_object_arena());
         retval= create_element(type,tag_elem);
         if(retval)
           {
@@ -438,6 +444,140 @@ XC::Element *XC::ProtoElementHandler::newElement(const std::string &type,const I
     return retval;
   }
 
+//! @brief Adds the elements to the model (one by one by default).
+bool XC::ProtoElementHandler::add_elements(const std::vector<Element *> &elements)
+  {
+    for(std::vector<Element *>::const_iterator i= elements.begin();i!=elements.end();i++)
+      add(*i);
+    return true;
+  }
+
+//! @brief Create the elements whose connectivity is passed as
+//! parameter (bulk version of newElement).
+//!
+//! The connectivity is checked in one pass before creating any
+//! element. The elements are added to the domain and to the opened
+//! sets at once.
+//!
+//! @param type: type of the elements (see create_element).
+//! @param connectivity: node tags of the elements (numNodes values for each element).
+//! @param numNodes: number of nodes of each element.
+//! @param tags: element identifiers (if empty the elements are numbered
+//!              starting at the default tag).
+//! @return the identifiers of the new elements (empty if an error occurs).
+XC::ID XC::ProtoElementHandler::newElements(const std::string &type,const std::vector<int> &connectivity,const size_t &numNodes,const std::vector<int> &tags)
+  {
+    ID retval;
+    const std::string errHeader= getClassName() + "::" + __FUNCTION__;
+    if(numNodes<1)
+      {
+        std::cerr << errHeader << "; wrong number of nodes: "
+                  << numNodes << std::endl;
+        return retval;
+      }
+    const size_t numElements= connectivity.size()/numNodes;
+    if(numElements==0)
+      return retval;
+    if(!tags.empty() && (tags.size()!=numElements))
+      {
+        std::cerr << errHeader << "; number of tags: " << tags.size()
+                  << " doesn't match the number of elements: "
+                  << numElements << std::endl;
+        return retval;
+      }
+    const Domain *dom= getPreprocessor()->getDomain();
+    // check the connectivity.
+    std::set<int> checked;
+    for(std::vector<int>::const_iterator i= connectivity.begin();i!=connectivity.end();i++)
+      {
+        const int nodeTag= *i;
+        if(checked.insert(nodeTag).second && !dom->getNode(nodeTag))
+          {
+            std::cerr << errHeader << "; node: " << nodeTag
+                      << " not found." << std::endl;
+            return retval;
+          }
+      }
+    // assign tags.
+    const int tg= getDefaultTag();
+    retval.resize(numElements);
+    for(size_t i= 0;i<numElements;i++)
+      retval[i]= (tags.empty() ? tg+static_cast<int>(i) : tags[i]);
+    // create the elements.
+    ObjectArena::Scope scope(get_object_arena());
+    std::vector<Element *> elements(numElements,nullptr);
+    Element *first= create_element(type,retval[0]);
+    if(!first)
+      return ID();
+    if(first->getNumExternalNodes()!=static_cast<int>(numNodes))
+      {
+        std::cerr << errHeader << "; elements of type: '" << type
+                  << "' have " << first->getNumExternalNodes()
+                  << " nodes, not " << numNodes << std::endl;
+        delete first;
+        Element::getDefaultTag().setTag(tg);
+        return ID();
+      }
+    elements[0]= first;
+    for(size_t i= 1;i<numElements;i++)
+      elements[i]= create_element(type,retval[i]);
+    ID iNodes(numNodes);
+    for(size_t i= 0;i<numElements;i++)
+      {
+        const int *conn= &connectivity[i*numNodes];
+        for(size_t j= 0;j<numNodes;j++)
+          iNodes[j]= conn[j];
+        elements[i]->setIdNodes(iNodes);
+      }
+    if(!add_elements(elements))
+      {
+        for(std::vector<Element *>::iterator i= elements.begin();i!=elements.end();i++)
+          delete *i;
+        Element::getDefaultTag().setTag(tg);
+        retval= ID();
+      }
+    return retval;
+  }
+
+//! @brief Create the elements whose connectivity is passed as
+//! parameter (i. e. a NumPy array of shape (numElements,numNodes)).
+XC::ID XC::ProtoElementHandler::newElements(const std::string &type,const boost::python::object &connectivity)
+  { return newElements(type,connectivity,boost::python::object()); }
+
+//! @brief Create the elements whose connectivity is passed as
+//! parameter.
+//!
+//! @param type: type of the elements (see create_element).
+//! @param connectivity: node tags of the elements (i. e. NumPy array of
+//!                      shape (numElements,numNodes)).
+//! @param tags: element identifiers (i. e. NumPy array of shape (numElements)),
+//!              if None the elements are numbered starting at the default tag.
+XC::ID XC::ProtoElementHandler::newElements(const std::string &type,const boost::python::object &connectivity,const boost::python::object &tags)
+  {
+    ID retval;
+    std::vector<int> conn;
+    size_t numElements= 0, numNodes= 0;
+    if(!vector_int_from_py_array(connectivity,conn,numElements,numNodes))
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; can't read element connectivity." << std::endl;
+        return retval;
+      }
+    std::vector<int> tagValues;
+    if(!tags.is_none())
+      {
+        size_t numTags= 0, numCols= 0;
+        if(!vector_int_from_py_array(tags,tagValues,numTags,numCols) || (numCols>1))
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; can't read element tags." << std::endl;
+            return retval;
+          }
+      }
+    retval= newElements(type,conn,numNodes,tagValues);
+    return retval;
+  }
+
 //! @brief Sets the default material name for new elements.
 void XC::ProtoElementHandler::setDefaultMaterial(const std::string &nmb)
   { nmb_mat= nmb; }
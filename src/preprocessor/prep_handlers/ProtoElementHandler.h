@@ -34,9 +34,12 @@
 #include "TransfCooHandler.h"
 #include "BeamIntegratorHandler.h"
 #include <map>
+#include <vector>
+#include <boost/python/object.hpp>
 
 namespace XC {
 class Element;
+class ObjectArena;
 
 //!  @ingroup Ldrs
 //! 
@@ -58,6 +61,11 @@ class ProtoElementHandler: public PrepHandler
     int dir; //!< If required (i.e. for zero length elements), direction of the element material.
   protected:
     virtual void add(Element *)= 0;
+    virtual bool add_elements(const std::vector<Element *> &);
+    //! @brief Return the memory arena for the new elements (nullptr
+    //! to allocate them from the global heap).
+    virtual ObjectArena *get_object_arena(void)
+      { return nullptr; }
     const MaterialHandler &get_material_handler(void) const;
     MaterialHandler::const_iterator get_iter_material(void) const;
     const Material *get_ptr_material(void) const;
@@ -86,6 +94,9 @@ class ProtoElementHandler: public PrepHandler
     const std::string &getDefaultIntegrator(void) const;
 
     Element *newElement(const std::string &,const ID &);
+    ID newElements(const std::string &,const std::vector<int> &,const size_t &,const std::vector<int> &);
+    ID newElements(const std::string &,const boost::python::object &);
+    ID newElements(const std::string &,const boost::python::object &,const boost::python::object &);
 
   };
 
@@ -26,6 +26,8 @@ class_<XC::PrepHandler, bases<XC::PreprocessorContainer,XC::MovableObject>, boos
 XC::Node *(XC::NodeHandler::*newNodeFromXYZ)(const double &x,const double &y,const double &z)= &XC::NodeHandler::newNode;
 XC::Node *(XC::NodeHandler::*newNodeFromXY)(const double &x,const double &y)= &XC::NodeHandler::newNode;
 XC::Node *(XC::NodeHandler::*newNodeFromVector)(const XC::Vector &)= &XC::NodeHandler::newNode;
+XC::ID (XC::NodeHandler::*newNodesFromArray)(const boost::python::object &)= &XC::NodeHandler::newNodes;
+XC::ID (XC::NodeHandler::*newNodesFromArrayWithTags)(const boost::python::object &,const boost::python::object &)= &XC::NodeHandler::newNodes;
 class_<XC::NodeHandler, bases<XC::PrepHandler>, boost::noncopyable >("NodeHandler", no_init)
   .add_property("numDOFs", &XC::NodeHandler::getNumDOFs, &XC::NodeHandler::setNumDOFs,"Number of degrees of freedom per node.")
   .add_property("dimSpace", &XC::NodeHandler::getDimEspacio, &XC::NodeHandler::setDimEspacio, "Espace dimension.")
@@ -39,6 +41,8 @@ class_<XC::NodeHandler, bases<XC::PrepHandler>, boost::noncopyable >("NodeHandle
   .def("newNodeIDXY", &XC::NodeHandler::newNodeIDXY,return_internal_reference<>(),"\n""newNodeIDXY(tag,x,y)""Create a node whose ID=tag from global coordinates (x,y).")
   .def("newNodeIDV", &XC::NodeHandler::newNodeIDV,return_internal_reference<>(),"\n""newNodeIDV(tag,vector)""Create a node whose ID=tag from the vector passed as parameter.")
   .def("newSeedNode", &XC::NodeHandler::newSeedNode,return_internal_reference<>(),"\n""newSeedNode()\n""Defines the seed node.")
+  .def("newNodes", newNodesFromArray,"\n""newNodes(coords)\n""Create the nodes whose coordinates are passed as parameter (NumPy array or list of lists of shape (numNodes,dim)), numbering them starting at defaultTag. Return the ID of the new nodes.")
+  .def("newNodes", newNodesFromArrayWithTags,"\n""newNodes(coords,tags)\n""Create the nodes whose coordinates and identifiers are passed as parameter. Return the ID of the new nodes.")
   .def("duplicateNode", &XC::NodeHandler::duplicateNode,return_internal_reference<>(),"\n""duplicateNode(orgNodeTag) \n" "Create a duplicate copy of node with ID=orgNodeTag")
   ;
 
@@ -68,6 +72,8 @@ class_<XC::BeamIntegratorHandler, bases<XC::PrepHandler>, boost::noncopyable >("
   .def("clear",&XC::BeamIntegratorHandler::clearAll,"Removes all items.")
  ;
 
+XC::ID (XC::ProtoElementHandler::*newElementsFromArray)(const std::string &,const boost::python::object &)= &XC::ProtoElementHandler::newElements;
+XC::ID (XC::ProtoElementHandler::*newElementsFromArrayWithTags)(const std::string &,const boost::python::object &,const boost::python::object &)= &XC::ProtoElementHandler::newElements;
 class_<XC::ProtoElementHandler, bases<XC::PrepHandler>, boost::noncopyable >("ProtoElementHandler", no_init)
  .add_property("dimElem", &XC::ProtoElementHandler::getDimElem, &XC::ProtoElementHandler::setDimElem, "Set the default dimension for the elements to be created: 0, 1, 2 or 3 for 0D, 1D, 2D or 3D, respectively.")
   .add_property("numSections", &XC::ProtoElementHandler::getNumSections, &XC::ProtoElementHandler::setNumSections, "Set the default number of sections for the elements to be created")
@@ -75,6 +81,8 @@ class_<XC::ProtoElementHandler, bases<XC::PrepHandler>, boost::noncopyable >("Pr
   .add_property("defaultTransformation", make_function( &XC::ProtoElementHandler::getDefaultTransf, return_value_policy<copy_const_reference>() ), &XC::ProtoElementHandler::setDefaultTransf,"Set the default coordinate transformation (called by its name) for the elements to be created")
   .add_property("defaultIntegrator", make_function( &XC::ProtoElementHandler::getDefaultIntegrator, return_value_policy<copy_const_reference>() ), &XC::ProtoElementHandler::setDefaultIntegrator,"Set the default integrator (called by its name) for the elements to be created")
   .def("newElement", &XC::ProtoElementHandler::newElement,return_internal_reference<>(),"\n newElement(type,iNodes): Create a new element of type 'type' from the nodes passed as parameter with the XC.ID object 'iNodes'. \n" "Parameters:\n""-type: type of element. Available types:'truss','truss_section','corot_truss','corot_truss_section','muelle', 'spring', 'beam2d_02', 'beam2d_03',  'beam2d_04', 'beam3d_01', 'beam3d_02', 'elastic_beam2d', 'elastic_beam3d', 'beam_with_hinges_2d', 'beam_with_hinges_3d', 'nl_beam_column_2d', 'nl_beam_column_3d','force_beam_column_2d', 'force_beam_column_3d', 'shell_mitc4', ' shell_nl', 'quad4n', 'tri31', 'brick', 'zero_length', 'zero_length_contact_2d', 'zero_length_contact_3d', 'zero_length_section'. \n""-iNodes: nodes ID, e.g. xc.ID([1,2]) to create a linear element from node 1 to node 2. \n")
+  .def("newElements", newElementsFromArray,"\n newElements(type,connectivity): Create the elements of type 'type' whose node tags are passed as parameter (NumPy array or list of lists of shape (numElements,numNodes)), numbering them starting at defaultTag. Return the ID of the new elements.")
+  .def("newElements", newElementsFromArrayWithTags,"\n newElements(type,connectivity,tags): Create the elements of type 'type' whose node tags and identifiers are passed as parameter. Return the ID of the new elements.")
    ;
 
 class_<XC::ElementHandler::SeedElemHandler, bases<XC::ProtoElementHandler>, boost::noncopyable >("SeedElementHandler", no_init)
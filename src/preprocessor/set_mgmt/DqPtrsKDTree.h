@@ -32,6 +32,7 @@
 
 #include "DqPtrs.h"
 #include <set>
+#include <vector>
 
 class Pos3d;
 class Vector3d;
@@ -66,6 +67,7 @@ class DqPtrsKDTree: public DqPtrs<T>
     //void extend_cond(const DqPtrsKDTree &,const std::string &cond);
     bool push_back(T *);
     bool push_front(T *);
+    void append_new(const std::vector<T *> &);
     void clearAll(void);
 
     T *getNearest(const Pos3d &p);
@@ -148,6 +150,17 @@ bool XC::DqPtrsKDTree<T,KDTree>::push_back(T *t)
     return retval;
   }
 
+//! @brief Appends the objects of the vector without checking
+//! if they are already in the container (use it only for objects that
+//! have just been created) and inserts them in the KD tree at once.
+template <class T,class KDTree>
+void XC::DqPtrsKDTree<T,KDTree>::append_new(const std::vector<T *> &v)
+  {
+    for(typename std::vector<T *>::const_iterator i= v.begin();i!=v.end();i++)
+      DqPtrs<T>::lst_ptr::push_back(*i);
+    kdtree.insert(v.begin(),v.end());
+  }
+
 //! @brief Inserts an object at the begining of the container.
 template <class T,class KDTree>
 bool XC::DqPtrsKDTree<T,KDTree>::push_front(T *t)
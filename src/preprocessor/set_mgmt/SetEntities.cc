@@ -32,11 +32,14 @@
 #include "preprocessor/multi_block_topology/entities/Pnt.h"
 #include "preprocessor/multi_block_topology/entities/Edge.h"
 #include "preprocessor/multi_block_topology/entities/Face.h"
+#include "preprocessor/multi_block_topology/entities/QuadSurface.h"
 #include "preprocessor/multi_block_topology/entities/Body.h"
 #include "preprocessor/multi_block_topology/entities/UniformGrid.h"
 #include "preprocessor/multi_block_topology/matrices/ElemPtrArray3d.h"
 #include "preprocessor/multi_block_topology/trf/TrfGeom.h"
 #include "utility/matrix/ID.h"
+#include <thread>
+#include <algorithm>
 
 #include "xc_utils/src/geom/pos_vec/SlidingVectorsSystem3d.h"
 #include "xc_utils/src/geom/d2/Plane.h"
@@ -355,12 +358,123 @@ void XC::SetEntities::surface_meshing(meshing_dir dm)
   {
     if(verbosity>2)
       std::clog << "Meshing surfaces...";
-    for(lst_surface_ptrs::iterator i= surfaces.begin();i!=surfaces.end();i++)
-      (*i)->genMesh(dm);
+    const size_t nt= getPreprocessor()->getMultiBlockTopology().getNumThreads();
+    if((nt>1) && (surfaces.size()>1))
+      parallel_surface_meshing(dm,nt);
+    else
+      for(lst_surface_ptrs::iterator i= surfaces.begin();i!=surfaces.end();i++)
+        (*i)->genMesh(dm);
     if(verbosity>2)
       std::clog << "done." << std::endl;
   }
 
+//! @brief Computes the positions of the interior nodes of the
+//! surfaces owned by the worker (surfaces i with i%numThreads==t).
+static void interior_node_positions(const std::vector<XC::QuadSurface *> &quads,std::vector<std::vector<Pos3d> > &positions,size_t t,size_t numThreads)
+  {
+    const size_t sz= quads.size();
+    for(size_t i= t;i<sz;i+= numThreads)
+      quads[i]->getInteriorNodePositions(positions[i]);
+  }
+
+//! @brief Create nodes and elements on surfaces using several threads.
+//!
+//! Only the computation of the positions of the interior nodes runs
+//! concurrently (surface i by the thread i%numThreads). The nodes and
+//! elements are created by the main thread because their constructors
+//! aren't thread safe (i.e. Python properties). The meshing is done
+//! in stages:
+//! - the nodes of the surface contours (lines) are created first, so the
+//! nodes shared by neighbour surfaces are fixed. After the contour
+//! nodes of each surface the tags of its interior nodes are reserved.
+//! - the positions of the interior nodes of each surface are computed
+//! concurrently.
+//! - the interior nodes of all the surfaces are added to the model at
+//! once using the reserved tags.
+//! - the elements are created surface by surface and added to the
+//! model at once.
+//! This way nodes and elements are numbered as in the serial meshing
+//! (surface by surface, in the order of the set), whatever the number
+//! of threads.
+void XC::SetEntities::parallel_surface_meshing(meshing_dir dm,const size_t &numThreads)
+  {
+    NodeHandler &nodeHandler= getPreprocessor()->getNodeHandler();
+    std::vector<QuadSurface *> quads;
+    std::vector<int> interiorTags;
+    for(lst_surface_ptrs::iterator i= surfaces.begin();i!=surfaces.end();i++)
+      {
+        QuadSurface *quad= dynamic_cast<QuadSurface *>(*i);
+        if(quad && quad->getTtzNodes().Null())
+          {
+            quad->checkNDivs();
+            quad->create_contour_nodes();
+            // Reserve the tags of the interior nodes.
+            const int firstTag= nodeHandler.getDefaultTag();
+            const int numInteriorNodes= quad->getNumberOfInteriorNodes();
+            for(int j= 0;j<numInteriorNodes;j++)
+              interiorTags.push_back(firstTag+j);
+            nodeHandler.setDefaultTag(firstTag+numInteriorNodes);
+            quads.push_back(quad);
+          }
+      }
+    const size_t numQuads= quads.size();
+    std::vector<std::vector<Pos3d> > positions(numQuads);
+    const size_t nt= std::min(numThreads,numQuads);
+    std::vector<std::thread> workers;
+    for(size_t t= 0;t<nt;t++)
+      workers.push_back(std::thread(interior_node_positions,std::cref(quads),std::ref(positions),t,nt));
+    for(std::vector<std::thread>::iterator i= workers.begin();i!=workers.end();i++)
+      i->join();
+
+    // Interior nodes.
+    std::vector<Pos3d> allPositions;
+    for(size_t i= 0;i<numQuads;i++)
+      allPositions.insert(allPositions.end(),positions[i].begin(),positions[i].end());
+    const std::vector<Node *> nodes= nodeHandler.newNodes(allPositions,interiorTags);
+    if(nodes.size()!=allPositions.size())
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; error creating the interior nodes." << std::endl;
+        return;
+      }
+    std::vector<Node *>::const_iterator iNode= nodes.begin();
+    for(size_t i= 0;i<numQuads;i++)
+      iNode= quads[i]->setInteriorNodes(iNode);
+
+    // Elements (in the order of the set).
+    ElementHandler &elementHandler= getPreprocessor()->getElementHandler();
+    std::vector<Element *> elements;
+    size_t iQuad= 0;
+    for(lst_surface_ptrs::iterator i= surfaces.begin();i!=surfaces.end();i++)
+      {
+        if((iQuad<numQuads) && (*i==quads[iQuad]))
+          {
+            QuadSurface *quad= quads[iQuad++];
+            if(quad->getTtzElements().Null() && quad->put_elements_on_mesh(dm))
+              {
+                const ElemPtrArray3d &ttz= quad->getTtzElements();
+                const size_t n_layers= ttz.getNumberOfLayers();
+                for(size_t l= 1;l<=n_layers;l++)
+                  for(size_t j= 1;j<=ttz(l).getNumberOfRows();j++)
+                    for(size_t k= 1;k<=ttz(l).getNumberOfColumns();k++)
+                      if(ttz(l,j,k))
+                        elements.push_back(ttz(l,j,k));
+              }
+          }
+        else //surface already meshed (or not a quad surface).
+          {
+            if(!elements.empty()) // keep the numbering.
+              {
+                elementHandler.Add(elements);
+                elements.clear();
+              }
+            (*i)->genMesh(dm);
+          }
+      }
+    if(!elements.empty())
+      elementHandler.Add(elements);
+  }
+
 //! @brief Create nodes and, where appropriate, elements on set bodies.
 void XC::SetEntities::body_meshing(meshing_dir dm)
   {
@@ -102,6 +102,7 @@ class SetEntities: public PreprocessorContainer, public MovableObject
     void point_meshing(meshing_dir dm);
     void line_meshing(meshing_dir dm);
     void surface_meshing(meshing_dir dm);
+    void parallel_surface_meshing(meshing_dir dm,const size_t &);
     void body_meshing(meshing_dir dm);
     void uniform_grid_meshing(meshing_dir dm);
 
@@ -162,10 +162,18 @@ void XC::SetMeshComp::clearAll(void)
 void XC::SetMeshComp::addNode(Node *nPtr)
   { nodes.push_back(nPtr); }
 
+//! @brief Appends the nodes just created (they can't be already in the set).
+void XC::SetMeshComp::appendNewNodes(const std::vector<Node *> &nds)
+  { nodes.append_new(nds); }
+
 //! @brief Adds the pointer to element being passed as parameter.
 void XC::SetMeshComp::addElement(Element *ePtr)
   { elements.push_back(ePtr); }
 
+//! @brief Appends the elements just created (they can't be already in the set).
+void XC::SetMeshComp::appendNewElements(const std::vector<Element *> &elems)
+  { elements.append_new(elems); }
+
 //! @brief Returns true if the node belongs to the set.
 bool XC::SetMeshComp::In(const Node *n) const
   { return nodes.in(n); }
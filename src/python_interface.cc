@@ -24,6 +24,7 @@
 
 #include "FEProblem.h"
 #include "python_interface.h"
+#include "post_process/ResultsStore.h"
 
 void export_utility(void);
 void export_material_base(void);
@@ -38,6 +39,7 @@ void export_preprocessor_build_model(void);
 void export_preprocessor_sets(void);
 void export_preprocessor_main(void);
 void export_solution(void);
+void export_reliability(void);
 
 BOOST_PYTHON_MODULE(xc)
   {
@@ -75,6 +77,7 @@ BOOST_PYTHON_MODULE(xc)
     export_preprocessor_sets();
     export_preprocessor_main();
     export_solution(); //Solution routines exposition.
+    export_reliability(); //Reliability analysis exposition.
 
 #include "post_process/python_interface.tcc"
 
@@ -89,6 +92,9 @@ BOOST_PYTHON_MODULE(xc)
       .add_property("getSoluProc", make_function( getSoluProcRef, return_internal_reference<>() ),"Return a reference to the solver")
       .add_property("getDatabase", make_function( &XC::FEProblem::getDataBase, return_internal_reference<>() ),"Return a reference to the data base")
       .def("newDatabase", make_function( &XC::FEProblem::defineDatabase, return_internal_reference<>() ),"Create a data base")
+      .def("newOutputHandler", make_function( &XC::FEProblem::newOutputHandler, return_internal_reference<>() ),"newOutputHandler(type, name): create an output handler for the recorders (type: binary_handler, file_handler or stream_handler).")
+      .def("sendModel", &XC::FEProblem::sendModel,"sendModel(channel, commitTag): send the model through the channel.")
+      .def("receiveModel", &XC::FEProblem::receiveModel,"receiveModel(channel, commitTag): receive the model sent through the channel.")
       .add_property("getFields", make_function( &XC::FEProblem::getFields, return_internal_reference<>() ),"Return fields definition (export).")
       .def("clearAll",&XC::FEProblem::clearAll,"Delete all entities in the FE problem.")
    ;
@@ -81,6 +81,7 @@ class NewmarkSensitivityIntegrator : public SensitivityIntegrator , public Newma
     NewmarkSensitivityIntegrator(AnalysisAggregation *);
     NewmarkSensitivityIntegrator(AnalysisAggregation *,int assemblyFlag, double gamma, double beta, bool disp = true);
     NewmarkSensitivityIntegrator(AnalysisAggregation *,int assemblyFlag, double gamma, double beta, const RayleighDampingFactors &rF, bool disp = true);
+    Integrator *getCopy(void) const;
     
     int setParameter(const std::vector<std::string> &argv, Parameter &param);
     int updateParameter(int parameterID, Information &info);
@@ -94,6 +95,9 @@ class NewmarkSensitivityIntegrator : public SensitivityIntegrator , public Newma
     int saveSensitivity   (const Vector &v, int gradNum, int numGrads);
     int commitSensitivity (int gradNum, int numGrads);  
   };
+
+inline Integrator *NewmarkSensitivityIntegrator::getCopy(void) const
+  { return new NewmarkSensitivityIntegrator(*this); }
 } // end of XC namespace
 
 #endif
@@ -61,6 +61,7 @@
 #include <solution/analysis/algorithm/equiSolnAlgo/EquiSolnAlgo.h>
 #include <reliability/FEsensitivity/SensitivityIntegrator.h>
 #include <solution/system_of_eqn/linearSOE/LinearSOE.h>
+#include <solution/system_of_eqn/linearSOE/FactoredSOEBase.h>
 #include <utility/matrix/Vector.h>
 #include <reliability/domain/components/ReliabilityDomain.h>
 #include <reliability/domain/components/RandomVariablePositioner.h>
@@ -87,8 +88,32 @@ XC::SensitivityAlgorithm::SensitivityAlgorithm(ReliabilityDomain *passedReliabil
 	// and whether they should be computed wrt. random variables
 	analysisTypeTag = passedAnalysisTypeTag;
 
+	// Form the tangent again unless told otherwise
+	reuseTangent = false;
 }
 
+//! @brief If true the sensitivity right-hand sides are solved with the
+//! tangent already assembled and factored by the solution algorithm
+//! (a forward/back substitution each) instead of forming it again.
+//! Only exact when that tangent corresponds to the converged state
+//! (i.e. linear problems or Newton iterations ending with a negligible
+//! increment).
+void XC::SensitivityAlgorithm::setReuseTangent(bool b)
+  { reuseTangent= b; }
+
+//! @brief Returns true if the tangent of the solution algorithm is reused.
+bool XC::SensitivityAlgorithm::getReuseTangent(void) const
+  { return reuseTangent; }
+
+//! @brief Returns true if the system of equations of the solution
+//! algorithm holds a factored tangent (it has not been assembled
+//! again since it was last solved) that can be reused.
+bool XC::SensitivityAlgorithm::isTangentFactored(void) const
+  {
+    const FactoredSOEBase *theSOE= dynamic_cast<const FactoredSOEBase *>(theAlgorithm->getLinearSOEPtr());
+    return (theSOE && theSOE->isFactored());
+  }
+
 
 int XC::SensitivityAlgorithm::computeSensitivities(void)
   {
@@ -113,10 +138,11 @@ int XC::SensitivityAlgorithm::computeSensitivities(void)
 	IncrementalIntegrator *theIncInt = theAlgorithm->getIncrementalIntegratorPtr();
 
 
-	// Form current tangent at converged state
-	// (would be nice with an if-statement here in case
-	// the current tangent is already formed)
-	if (theIncInt->formTangent(CURRENT_TANGENT) < 0){
+	// Form current tangent at converged state, unless the
+	// tangent already factored by the algorithm is to be reused.
+	// Either way the tangent is factored at most once and each
+	// gradient below is a solve with a new right-hand side.
+	if ((!reuseTangent || !isTangentFactored()) && theIncInt->formTangent(CURRENT_TANGENT) < 0){
 		std::cerr << "WARNING XC::SensitivityAlgorithm::computeGradients() -";
 		std::cerr << "the XC::Integrator failed in formTangent()\n";
 		return -1;
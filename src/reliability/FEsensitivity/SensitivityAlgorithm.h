@@ -72,12 +72,16 @@ class SensitivityAlgorithm
     EquiSolnAlgo *theAlgorithm;
     SensitivityIntegrator *theSensitivityIntegrator;
     int analysisTypeTag;
+    bool reuseTangent; //!< if true, don't form (and factor) the tangent again.
   public:
     SensitivityAlgorithm(ReliabilityDomain *passedReliabilityDomain,
 	                 EquiSolnAlgo *passedAlgorithm,
 			 SensitivityIntegrator *passedSensitivityIntegrator,
 			 int analysisTypeTag);
 
+    void setReuseTangent(bool);
+    bool getReuseTangent(void) const;
+    bool isTangentFactored(void) const;
     int computeSensitivities(void);
     bool shouldComputeAtEachStep(void);
   };
@@ -71,7 +71,8 @@ class StaticSensitivityIntegrator : public SensitivityIntegrator, public StaticI
     int gradNumber;
   public:
     StaticSensitivityIntegrator(AnalysisAggregation *owr);
-    
+    Integrator *getCopy(void) const;
+
 
 	// Methods promised by the ordinary integrator
     int newStep(void);    
@@ -88,6 +89,9 @@ class StaticSensitivityIntegrator : public SensitivityIntegrator, public StaticI
     int saveSensitivity(const Vector &v, int gradNum, int numGrads);
     int commitSensitivity(int gradNum, int numGrads);
   };
+
+inline Integrator *StaticSensitivityIntegrator::getCopy(void) const
+  { return new StaticSensitivityIntegrator(*this); }
 } // end of XC namespace
 
 #endif
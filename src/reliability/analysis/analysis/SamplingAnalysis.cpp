@@ -75,6 +75,9 @@
 #include <cmath>
 #include <stdlib.h>
 #include <string.h>
+#include <algorithm>
+#include <thread>
+#include <functional>
 
 #include <fstream>
 #include <iomanip>
@@ -85,6 +88,11 @@ using std::setw;
 using std::setprecision;
 using std::setiosflags;
 
+//! @brief Stream used to generate the Latin hypercube design (it's
+//! not the number of any sample so the permutations are independent
+//! of the sampled points).
+const int XC::SamplingAnalysis::lhsStream= -1;
+
 
 XC::SamplingAnalysis::SamplingAnalysis(	ReliabilityDomain *passedReliabilityDomain,
 										ProbabilityTransformation *passedProbabilityTransformation,
@@ -110,8 +118,177 @@ XC::SamplingAnalysis::SamplingAnalysis(	ReliabilityDomain *passedReliabilityDoma
 	fileName= passedFileName;
 	startPoint = pStartPoint;
 	analysisTypeTag = passedAnalysisTypeTag;
+	latinHypercube = false;
+	useStreams = false;
+	batchSize = 1;
+	replicas.push_back(Replica(theProbabilityTransformation,theGFunEvaluator));
 }
 
+//! @brief Adds an independent copy of the model (its own domain,
+//! reliability domain, probability transformation and g-function
+//! evaluator) on which samples are evaluated by a worker thread.
+//! Returns the number of model copies available (the original included).
+int XC::SamplingAnalysis::addReplica(ProbabilityTransformation *pt, GFunEvaluator *gfe)
+  {
+    if(pt && gfe && (gfe!=theGFunEvaluator))
+      {
+        replicas.push_back(Replica(pt,gfe));
+        if(batchSize<static_cast<int>(replicas.size()))
+          batchSize= replicas.size();
+      }
+    else
+      std::cerr << "SamplingAnalysis::addReplica; a replica needs its own"
+                << " probability transformation and g-function evaluator."
+                << std::endl;
+    return replicas.size();
+  }
+
+//! @brief Returns the number of model copies available (the original included).
+size_t XC::SamplingAnalysis::getNumberOfReplicas(void) const
+  { return replicas.size(); }
+
+//! @brief Sets the number of samples generated and evaluated at once
+//! (it never goes below the number of replicas).
+void XC::SamplingAnalysis::setBatchSize(int sz)
+  { batchSize= std::max(sz,static_cast<int>(replicas.size())); }
+
+//! @brief Sampling by Latin hypercube (stratified in each standard normal
+//! direction) instead of crude Monte Carlo. Combines with importance
+//! sampling (start point and sampling standard deviation). Needs
+//! a counter-based random number generator.
+void XC::SamplingAnalysis::setLatinHypercube(bool b)
+  { latinHypercube= b; }
+
+//! @brief Generates a random permutation of the strata for each random
+//! variable. Uses a stream of its own (samples use streams 1,2,...) so
+//! the design is reproduced on restart and it's not correlated with
+//! the samples. Requires a counter-based generator.
+int XC::SamplingAnalysis::prepareLatinHypercube(int seed)
+  {
+    const int numRV= theReliabilityDomain->getNumberOfRandomVariables();
+    const int N= std::max(numberOfSimulations,1);
+    lhsPermutations.resize(static_cast<size_t>(numRV)*N);
+    if(theRandomNumberGenerator->setStream(lhsStream)<0)
+      {
+        std::cerr << "SamplingAnalysis::prepareLatinHypercube; the random"
+                  << " number generator doesn't support streams"
+                  << " (use CounterBasedRandGenerator)." << std::endl;
+        return -1;
+      }
+    int result= theRandomNumberGenerator->generate_nIndependentUniformNumbers(1,0.0,1.0,seed);
+    if(result<0)
+      return result;
+    for(int j= 0;j<numRV;j++)
+      {
+        int *perm= &lhsPermutations[static_cast<size_t>(j)*N];
+        for(int i= 0;i<N;i++)
+          perm[i]= i;
+        if(N<2)
+          continue;
+        result= theRandomNumberGenerator->generate_nIndependentUniformNumbers(N-1,0.0,1.0);
+        if(result<0)
+          return result;
+        const Vector &r= theRandomNumberGenerator->getGeneratedNumbers();
+        for(int i= N-1;i>0;i--) // Fisher-Yates shuffle.
+          {
+            const int l= std::min(static_cast<int>(r(N-1-i)*(i+1)),i);
+            std::swap(perm[i],perm[l]);
+          }
+      }
+    return 0;
+  }
+
+//! @brief Computes the standard normal numbers for the sample k (1-based).
+//! With counter-based generators the numbers depend only on (seed, k),
+//! otherwise they are the next ones of the generator sequence.
+int XC::SamplingAnalysis::generateSample(int k, int seed, Vector &randomArray)
+  {
+    const int numRV= theReliabilityDomain->getNumberOfRandomVariables();
+    if(useStreams && (theRandomNumberGenerator->setStream(k)<0))
+      return -1;
+    int result= 0;
+    if(!latinHypercube)
+      {
+        result= theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV,seed);
+        if(result>=0)
+          randomArray= theRandomNumberGenerator->getGeneratedNumbers();
+      }
+    else
+      {
+        result= theRandomNumberGenerator->generate_nIndependentUniformNumbers(numRV,0.0,1.0,seed);
+        if(result>=0)
+          {
+            const int N= std::max(numberOfSimulations,1);
+            const int i= (k-1)%N;
+            const Vector &r= theRandomNumberGenerator->getGeneratedNumbers();
+            NormalRV aStdNormRV(1,0.0,1.0,0.0);
+            randomArray.resize(numRV);
+            for(int j= 0;j<numRV;j++)
+              {
+                double p= (lhsPermutations[static_cast<size_t>(j)*N+i]+r(j))/N;
+                p= std::min(std::max(p,1e-7),1.0-1e-7);
+                randomArray(j)= aStdNormRV.getInverseCDFvalue(p);
+              }
+          }
+      }
+    return result;
+  }
+
+//! @brief Evaluates the limit-state functions at point u using the given
+//! model copy. Returns 0 if ok, 1 if the FE analysis failed (g values
+//! set to -1.0) and a negative value on error.
+int XC::SamplingAnalysis::evaluateSample(Replica &r, const Vector &u, Vector &g) const
+  {
+    int result= r.theProbabilityTransformation->set_u(u);
+    if(result<0)
+      return -1;
+    result= r.theProbabilityTransformation->transform_u_to_x();
+    if(result<0)
+      return -2;
+    const Vector x= r.theProbabilityTransformation->get_x();
+
+    // Evaluate limit-state function
+    const bool FEconvergence= (r.theGFunEvaluator->runGFunAnalysis(x)>=0);
+
+    // Loop over number of limit-state functions
+    ReliabilityDomain *rd= r.theGFunEvaluator->getReliabilityDomain();
+    for(int lsf= 0;lsf<g.Size();lsf++)
+      {
+        // Set tag of "active" limit-state function
+        rd->setTagOfActiveLimitStateFunction(lsf+1);
+        result= r.theGFunEvaluator->evaluateG(x);
+        if(result<0)
+          return -3;
+        g(lsf)= (FEconvergence ? r.theGFunEvaluator->getG() : -1.0);
+      }
+    return (FEconvergence ? 0 : 1);
+  }
+
+//! @brief Evaluates the samples assigned to the model copy r
+//! (samples r, r+n, r+2n,... being n the number of copies).
+void XC::SamplingAnalysis::evaluateSamples(size_t r, const std::vector<Vector> &us, std::vector<Vector> &gs, std::vector<int> &status)
+  {
+    const size_t n= replicas.size();
+    for(size_t i= r;i<us.size();i+= n)
+      status[i]= evaluateSample(replicas[r],us[i],gs[i]);
+  }
+
+//! @brief Evaluates the limit-state functions at the points of the batch,
+//! distributing them between the model copies (one thread each).
+void XC::SamplingAnalysis::evaluateBatch(const std::vector<Vector> &us, int numLsf, std::vector<Vector> &gs, std::vector<int> &status)
+  {
+    const size_t n= us.size();
+    gs.assign(n,Vector(numLsf));
+    status.assign(n,0);
+    const size_t numWorkers= std::min(replicas.size(),n);
+    std::vector<std::thread> workers;
+    for(size_t r= 1;r<numWorkers;r++)
+      workers.push_back(std::thread(&SamplingAnalysis::evaluateSamples,this,r,std::cref(us),std::ref(gs),std::ref(status)));
+    evaluateSamples(0,us,gs,status);
+    for(std::vector<std::thread>::iterator i= workers.begin();i!=workers.end();i++)
+      i->join();
+  }
+
 
 
 
@@ -137,8 +314,6 @@ XC::SamplingAnalysis::analyze(void)
 	Matrix chol_covariance(numRV, numRV);
 	Matrix inv_covariance(numRV, numRV);
 	Vector startValues(numRV);
-	Vector x(numRV);
-	Vector z(numRV);
 	Vector u(numRV);
 	Vector randomArray(numRV);
 	LimitStateFunction *theLimitStateFunction = 0;
@@ -297,7 +472,6 @@ XC::SamplingAnalysis::analyze(void)
 	Vector temp1;
 	double temp2;
 	double denumerator;
-	bool FEconvergence;
 
 
 	// Prepare output file
@@ -305,6 +479,26 @@ XC::SamplingAnalysis::analyze(void)
 
 
 	bool isFirstSimulation = true;
+	std::vector<Vector> batchU;
+	std::vector<Vector> batchG;
+	std::vector<int> batchStatus;
+	size_t nextInBatch = 0;
+	// Counter-based generators draw each sample from its own stream
+	// (the others give the samples in the order they are generated).
+	useStreams = (theRandomNumberGenerator->setStream(0)>=0);
+	if (!useStreams && printFlag == 2) {
+		std::cerr << "XC::SamplingAnalysis::analyze() - WARNING the random" << std::endl
+			<< " number generator doesn't support streams, the samples" << std::endl
+			<< " after a restart won't be the same." << std::endl;
+	}
+	if (latinHypercube) {
+		result = prepareLatinHypercube(seed);
+		if (result < 0) {
+			std::cerr << "XC::SamplingAnalysis::analyze() - could not generate" << std::endl
+				<< " the Latin hypercube design." << std::endl;
+			return -1;
+		}
+	}
 	while( (k<=numberOfSimulations) && (govCov>targetCOV) || (k<=2) )
            {
 
@@ -314,70 +508,53 @@ XC::SamplingAnalysis::analyze(void)
 		}
 
 		
-		// Create array of standard normal random numbers
-		if (isFirstSimulation) {
-			result = theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV,seed);
-		}
-		else {
-			result = theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV);
-		}
-		seed = theRandomNumberGenerator->getSeed();
-		if (result < 0) {
-			std::cerr << "XC::SamplingAnalysis::analyze() - could not generate" << std::endl
-				<< " random numbers for simulation." << std::endl;
-			return -1;
+		// When the previous batch is exhausted, generate the next
+		// one and evaluate it (concurrently if there are replicas).
+		// Results are consumed below in sample order, so the estimates
+		// don't depend on the batch size or the number of replicas.
+		if (nextInBatch >= batchU.size()) {
+			const int nInBatch = std::max(1,std::min(batchSize,numberOfSimulations-k+1));
+			batchU.assign(nInBatch, Vector(numRV));
+			for (int b=0; b<nInBatch; b++) {
+				result = generateSample(k+b, (isFirstSimulation && b==0) ? seed : 0, randomArray);
+				if (result < 0) {
+					std::cerr << "XC::SamplingAnalysis::analyze() - could not generate" << std::endl
+						<< " random numbers for simulation." << std::endl;
+					return -1;
+				}
+				// Compute the point in standard normal space
+				batchU[b] = startPointY + chol_covariance * randomArray;
+			}
+			seed = theRandomNumberGenerator->getSeed();
+			evaluateBatch(batchU, numLsf, batchG, batchStatus);
+			nextInBatch = 0;
 		}
-		randomArray = theRandomNumberGenerator->getGeneratedNumbers();
-
-		// Compute the point in standard normal space
-		u = startPointY + chol_covariance * randomArray;
-                
-		// Transform into original space
-		result = theProbabilityTransformation->set_u(u);
-		if (result < 0) {
+		u = batchU[nextInBatch];
+		const Vector &gValues = batchG[nextInBatch];
+		result = batchStatus[nextInBatch];
+		nextInBatch++;
+		if (result == -1) {
 			std::cerr << "XC::SamplingAnalysis::analyze() - could not " << std::endl
 				<< " set the u-vector for xu-transformation. " << std::endl;
 			return -1;
 		}
-
-		
-		result = theProbabilityTransformation->transform_u_to_x();
-		if (result < 0) {
+		else if (result == -2) {
 			std::cerr << "XC::SamplingAnalysis::analyze() - could not " << std::endl
 				<< " transform u to x. " << std::endl;
 			return -1;
 		}
-		x = theProbabilityTransformation->get_x();
-
-		// Evaluate limit-state function
-		FEconvergence = true;
-		result = theGFunEvaluator->runGFunAnalysis(x);
-		if (result < 0) {
-			// In this case a failure happened during the analysis
-			// Hence, register this as failure
-			FEconvergence = false;
+		else if (result == -3) {
+			std::cerr << "XC::SamplingAnalysis::analyze() - could not " << std::endl
+				<< " tokenize limit-state function. " << std::endl;
+			return -1;
 		}
 
 
 		// Loop over number of limit-state functions
 		for (int lsf=0; lsf<numLsf; lsf++ ) {
 
-
-			// Set tag of "active" limit-state function
-			theReliabilityDomain->setTagOfActiveLimitStateFunction(lsf+1);
-
-
-			// Get value of limit-state function
-			result = theGFunEvaluator->evaluateG(x);
-			if (result < 0) {
-				std::cerr << "XC::SamplingAnalysis::analyze() - could not " << std::endl
-					<< " tokenize limit-state function. " << std::endl;
-				return -1;
-			}
-			gFunctionValue = theGFunEvaluator->getG();
-			if (!FEconvergence) {
-				gFunctionValue = -1.0;
-			}
+			// Value of limit-state function (-1.0 if the FE analysis failed)
+			gFunctionValue = gValues(lsf);
 
 
 			
@@ -66,14 +66,34 @@
 #include <reliability/analysis/randomNumber/RandomNumberGenerator.h>
 
 #include <fstream>
+#include <vector>
 using std::ofstream;
 
 namespace XC {
 class GFunEvaluator;
 
+//! @brief Monte Carlo (crude, importance or Latin hypercube) sampling.
+//!
+//! Samples are generated in batches in the calling thread and their
+//! limit-state functions evaluated concurrently on independent copies
+//! of the model (see addReplica). Each copy must own everything the
+//! evaluation touches (domain, reliability domain, probability
+//! transformation, g-function evaluator and its interpreter). The
+//! results are reduced in sample order, so with a counter-based random
+//! number generator the estimates (and the early stop when the target
+//! coefficient of variation is reached) don't depend on the number of
+//! threads.
 class SamplingAnalysis : public ReliabilityAnalysis
 {
 private:
+	//! @brief Copy of the model on which samples are evaluated.
+	struct Replica
+	  {
+	    ProbabilityTransformation *theProbabilityTransformation;
+	    GFunEvaluator *theGFunEvaluator;
+	    Replica(ProbabilityTransformation *pt= nullptr, GFunEvaluator *gfe= nullptr)
+	      : theProbabilityTransformation(pt), theGFunEvaluator(gfe) {}
+	  };
 	ReliabilityDomain *theReliabilityDomain;
 	ProbabilityTransformation *theProbabilityTransformation;
 	GFunEvaluator *theGFunEvaluator;
@@ -85,7 +105,18 @@ private:
 	std::string fileName;
 	Vector *startPoint;
 	int analysisTypeTag;
+	std::vector<Replica> replicas; //!< model copies (the first one is the original).
+	int batchSize; //!< number of samples generated and evaluated at once.
+	bool latinHypercube; //!< if true use Latin hypercube sampling.
+	std::vector<int> lhsPermutations; //!< strata permutation for each random variable.
+	bool useStreams; //!< true if the generator draws each sample from its own stream.
+	static const int lhsStream; //!< stream used to generate the Latin hypercube design.
 
+	int prepareLatinHypercube(int seed);
+	int generateSample(int k, int seed, Vector &randomArray);
+	int evaluateSample(Replica &, const Vector &u, Vector &g) const;
+	void evaluateSamples(size_t r, const std::vector<Vector> &, std::vector<Vector> &, std::vector<int> &);
+	void evaluateBatch(const std::vector<Vector> &, int numLsf, std::vector<Vector> &, std::vector<int> &);
 public:
 	SamplingAnalysis(	ReliabilityDomain *passedReliabilityDomain,
 						ProbabilityTransformation *passedProbabilityTransformation,
@@ -99,6 +130,11 @@ public:
 						Vector *startPoint,
 						int analysisTypeTag);
 
+	int addReplica(ProbabilityTransformation *, GFunEvaluator *);
+	size_t getNumberOfReplicas(void) const;
+	void setBatchSize(int);
+	void setLatinHypercube(bool);
+
 	int analyze(void);
 };
 } // end of XC namespace
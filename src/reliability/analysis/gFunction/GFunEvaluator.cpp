@@ -76,6 +76,10 @@ XC::GFunEvaluator::GFunEvaluator(Tcl_Interp *passedTclInterp, ReliabilityDomain
     numberOfEvaluations = 0;
 }
 
+//! @brief Returns the reliability domain whose limit-state functions are evaluated.
+XC::ReliabilityDomain *XC::GFunEvaluator::getReliabilityDomain(void)
+  { return theReliabilityDomain; }
+
 double XC::GFunEvaluator::getG()
   { return g; }
 
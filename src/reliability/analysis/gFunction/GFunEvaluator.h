@@ -80,6 +80,7 @@ public:
 	GFunEvaluator(Tcl_Interp *theTclInterp, ReliabilityDomain *theReliabilityDomain);
 
 	// Methods provided by base class
+	ReliabilityDomain *getReliabilityDomain(void);
 	int		evaluateG(Vector x);
 	double	getG();
 	int     initializeNumberOfEvaluations();
@@ -0,0 +1,140 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//CounterBasedRandGenerator.cc
+
+#include <reliability/analysis/randomNumber/CounterBasedRandGenerator.h>
+#include <cmath>
+
+//! @brief Philox4x32 round multipliers and Weyl key increments
+//! (Salmon et al. "Parallel random numbers: as easy as 1, 2, 3", 2011).
+static const uint32_t PHILOX_M0= 0xD2511F53u;
+static const uint32_t PHILOX_M1= 0xCD9E8D57u;
+static const uint32_t PHILOX_W0= 0x9E3779B9u;
+static const uint32_t PHILOX_W1= 0xBB67AE85u;
+
+//! @brief Constructor.
+XC::CounterBasedRandGenerator::CounterBasedRandGenerator(int seed)
+  :RandomNumberGenerator(), generatedNumbers(), stream(0), position(0)
+  { reseed(seed); }
+
+//! @brief Sets the key of the generator and rewinds the current stream.
+void XC::CounterBasedRandGenerator::reseed(int seed)
+  {
+    key[0]= static_cast<uint32_t>(seed);
+    key[1]= 0x5EEDu;
+    position= 0;
+  }
+
+//! @brief Applies the ten rounds of the Philox4x32 bijection to the counter.
+void XC::CounterBasedRandGenerator::philox(const uint32_t k[2], uint32_t ctr[4])
+  {
+    uint32_t k0= k[0], k1= k[1];
+    for(int r= 0;r<10;r++)
+      {
+        const uint64_t p0= static_cast<uint64_t>(PHILOX_M0)*ctr[0];
+        const uint64_t p1= static_cast<uint64_t>(PHILOX_M1)*ctr[2];
+        const uint32_t hi0= static_cast<uint32_t>(p0>>32), lo0= static_cast<uint32_t>(p0);
+        const uint32_t hi1= static_cast<uint32_t>(p1>>32), lo1= static_cast<uint32_t>(p1);
+        ctr[0]= hi1^ctr[1]^k0;
+        ctr[1]= lo1;
+        ctr[2]= hi0^ctr[3]^k1;
+        ctr[3]= lo0;
+        k0+= PHILOX_W0;
+        k1+= PHILOX_W1;
+      }
+  }
+
+//! @brief Returns the next block of four 32-bit random integers of the current stream.
+void XC::CounterBasedRandGenerator::nextBlock(uint32_t out[4])
+  {
+    out[0]= static_cast<uint32_t>(position);
+    out[1]= static_cast<uint32_t>(position>>32);
+    out[2]= static_cast<uint32_t>(stream);
+    out[3]= static_cast<uint32_t>(stream>>32);
+    philox(key,out);
+    position++;
+  }
+
+//! @brief Returns a uniform number in the open interval (0,1) with 53 significant bits.
+double XC::CounterBasedRandGenerator::nextUniform(void)
+  {
+    uint32_t b[4];
+    nextBlock(b);
+    const double a= static_cast<double>(b[0]>>5); // 27 bits.
+    const double c= static_cast<double>(b[1]>>6); // 26 bits.
+    return (a*67108864.0+c+0.5)/9007199254740992.0;
+  }
+
+//! @brief Selects the stream from which the next numbers are drawn and
+//! rewinds it. Typically the stream is the sample number.
+int XC::CounterBasedRandGenerator::setStream(int s)
+  {
+    stream= static_cast<uint64_t>(static_cast<uint32_t>(s));
+    position= 0;
+    return 0;
+  }
+
+//! @brief Generates n uniform numbers in [lower,upper] from the current stream.
+//! If seed is not zero the generator is reseeded and the stream rewound.
+int XC::CounterBasedRandGenerator::generate_nIndependentUniformNumbers(int n, double lower, double upper, int seedIn)
+  {
+    if(seedIn!=0)
+      reseed(seedIn);
+    generatedNumbers.resize(n);
+    for(int j= 0;j<n;j++)
+      generatedNumbers(j)= (upper-lower)*nextUniform()+lower;
+    return 0;
+  }
+
+//! @brief Generates n standard normal numbers from the current stream
+//! (Box-Muller transform). If seed is not zero the generator is reseeded
+//! and the stream rewound.
+int XC::CounterBasedRandGenerator::generate_nIndependentStdNormalNumbers(int n, int seedIn)
+  {
+    if(seedIn!=0)
+      reseed(seedIn);
+    generatedNumbers.resize(n);
+    const double twoPi= 2.0*M_PI;
+    for(int j= 0;j<n;j+=2)
+      {
+        const double r= sqrt(-2.0*log(nextUniform()));
+        const double theta= twoPi*nextUniform();
+        generatedNumbers(j)= r*cos(theta);
+        if(j+1<n)
+          generatedNumbers(j+1)= r*sin(theta);
+      }
+    return 0;
+  }
+
+//! @brief Returns the last generated numbers.
+const XC::Vector &XC::CounterBasedRandGenerator::getGeneratedNumbers(void) const
+  { return generatedNumbers; }
+
+//! @brief Returns the key of the generator. Unlike the C library
+//! generator the seed doesn't change while drawing numbers.
+int XC::CounterBasedRandGenerator::getSeed(void)
+  { return static_cast<int>(key[0]); }
@@ -0,0 +1,66 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//CounterBasedRandGenerator.h
+
+#ifndef CounterBasedRandGenerator_h
+#define CounterBasedRandGenerator_h
+
+#include <reliability/analysis/randomNumber/RandomNumberGenerator.h>
+#include <stdint.h>
+
+namespace XC {
+//! @brief Counter-based (Philox4x32-10) random number generator.
+//!
+//! The numbers are a pure function of (key, stream, position) so
+//! each Monte Carlo sample can draw from its own stream. The sequence
+//! obtained for a given sample does not depend on the order in
+//! which samples are evaluated, nor on the number of threads used
+//! to evaluate them, and restarts reproduce the same samples.
+class CounterBasedRandGenerator: public RandomNumberGenerator
+  {
+  private:
+    Vector generatedNumbers;
+    uint32_t key[2]; //!< generator key (seed).
+    uint64_t stream; //!< current stream (i.e. sample number).
+    uint64_t position; //!< number of blocks consumed in the current stream.
+
+    static void philox(const uint32_t k[2], uint32_t ctr[4]);
+    void nextBlock(uint32_t out[4]);
+    double nextUniform(void);
+    void reseed(int);
+  public:
+    CounterBasedRandGenerator(int seed= 1);
+
+    int generate_nIndependentStdNormalNumbers(int n, int seed=0);
+    int generate_nIndependentUniformNumbers(int n, double lower, double upper, int seed=0);
+    const Vector &getGeneratedNumbers(void) const;
+    int getSeed(void);
+    int setStream(int);
+  };
+} // end of XC namespace
+
+#endif
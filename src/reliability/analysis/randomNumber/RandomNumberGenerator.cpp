@@ -62,6 +62,12 @@
 //! @brief Constructor.
 XC::RandomNumberGenerator::RandomNumberGenerator(){}
 
+//! @brief Selects an independent stream of random numbers (i.e. the
+//! sample number). Returns -1 if the generator is sequential and
+//! doesn't support streams.
+int XC::RandomNumberGenerator::setStream(int)
+  { return -1; }
+
 
 
 
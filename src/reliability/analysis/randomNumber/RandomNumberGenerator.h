@@ -73,6 +73,7 @@ class RandomNumberGenerator
     virtual int generate_nIndependentUniformNumbers(int n, double lower, double upper, int seed=0) =0;
     virtual const Vector &getGeneratedNumbers() const=0;
     virtual int getSeed() =0;
+    virtual int setStream(int);
   };
 } // end of XC namespace
 
@@ -0,0 +1,36 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//python_interface.tcc
+
+class_<XC::RandomNumberGenerator, boost::noncopyable >("RandomNumberGenerator", no_init)
+  .def("generate_nIndependentStdNormalNumbers", &XC::RandomNumberGenerator::generate_nIndependentStdNormalNumbers,"generate_nIndependentStdNormalNumbers(n,seed): generates n standard normal numbers (if seed is not zero the generator is reseeded first).")
+  .def("generate_nIndependentUniformNumbers", &XC::RandomNumberGenerator::generate_nIndependentUniformNumbers,"generate_nIndependentUniformNumbers(n,lower,upper,seed): generates n numbers uniformly distributed in [lower,upper] (if seed is not zero the generator is reseeded first).")
+  .add_property("getGeneratedNumbers", make_function(&XC::RandomNumberGenerator::getGeneratedNumbers, return_internal_reference<>() ),"Return the last generated numbers.")
+  .add_property("getSeed", &XC::RandomNumberGenerator::getSeed,"Return the seed of the generator.")
+  .def("setStream", &XC::RandomNumberGenerator::setStream,"setStream(s): select the stream from which the next numbers are drawn. Return a negative value if the generator doesn't support streams.")
+  ;
+
+class_<XC::CStdLibRandGenerator, bases<XC::RandomNumberGenerator>, boost::noncopyable >("CStdLibRandGenerator")
+  ;
+
+class_<XC::CounterBasedRandGenerator, bases<XC::RandomNumberGenerator>, boost::noncopyable >("CounterBasedRandGenerator", init<optional<int> >())
+  ;
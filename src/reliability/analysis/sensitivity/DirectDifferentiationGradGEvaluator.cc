@@ -0,0 +1,315 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//DirectDifferentiationGradGEvaluator.cc
+
+#include <reliability/analysis/sensitivity/DirectDifferentiationGradGEvaluator.h>
+#include <reliability/domain/components/ReliabilityDomain.h>
+#include <reliability/domain/components/LimitStateFunction.h>
+#include <reliability/domain/components/RandomVariable.h>
+#include <reliability/FEsensitivity/SensitivityAlgorithm.h>
+#include <domain/domain/Domain.h>
+#include <domain/mesh/node/Node.h>
+#include <tcl.h>
+#include <cstring>
+#include <cstdio>
+#include <cmath>
+#include <set>
+
+//! @brief Constructor.
+//!
+//! @param passedTclInterp: interpreter where the limit-state functions are evaluated.
+//! @param passedReliabilityDomain: random variables and limit-state functions.
+//! @param passedDomain: finite element domain (source of the nodal sensitivities).
+//! @param passedSensitivityAlgorithm: algorithm that computes the response sensitivities.
+//! @param pf: relative perturbation used to differentiate the limit-state expression.
+XC::DirectDifferentiationGradGEvaluator::DirectDifferentiationGradGEvaluator(Tcl_Interp *passedTclInterp, ReliabilityDomain *passedReliabilityDomain, Domain *passedDomain, SensitivityAlgorithm *passedSensitivityAlgorithm, double pf)
+  : GradGEvaluator(passedReliabilityDomain, passedTclInterp),
+    theDomain(passedDomain), theSensitivityAlgorithm(passedSensitivityAlgorithm),
+    grad_g(passedReliabilityDomain->getNumberOfRandomVariables()), grad_g_matrix(),
+    DgDdispl(), perturbationFactor(pf), lastX(), numSensitivityAnalyses(0),
+    ownsInterp(false)
+  {}
+
+//! @brief Constructor. The limit-state functions are evaluated in an
+//! interpreter owned by this object.
+//!
+//! @param passedReliabilityDomain: random variables and limit-state functions.
+//! @param passedDomain: finite element domain (source of the nodal sensitivities).
+//! @param passedSensitivityAlgorithm: algorithm that computes the response sensitivities.
+//! @param pf: relative perturbation used to differentiate the limit-state expression.
+XC::DirectDifferentiationGradGEvaluator::DirectDifferentiationGradGEvaluator(ReliabilityDomain *passedReliabilityDomain, Domain *passedDomain, SensitivityAlgorithm *passedSensitivityAlgorithm, double pf)
+  : GradGEvaluator(passedReliabilityDomain, Tcl_CreateInterp()),
+    theDomain(passedDomain), theSensitivityAlgorithm(passedSensitivityAlgorithm),
+    grad_g(passedReliabilityDomain->getNumberOfRandomVariables()), grad_g_matrix(),
+    DgDdispl(), perturbationFactor(pf), lastX(), numSensitivityAnalyses(0),
+    ownsInterp(true)
+  {}
+
+//! @brief Destructor.
+XC::DirectDifferentiationGradGEvaluator::~DirectDifferentiationGradGEvaluator(void)
+  {
+    if(ownsInterp && theTclInterp)
+      {
+        Tcl_DeleteInterp(theTclInterp);
+        theTclInterp= nullptr;
+      }
+  }
+
+//! @brief Sets the algorithm that computes the response sensitivities.
+void XC::DirectDifferentiationGradGEvaluator::setSensitivityAlgorithm(SensitivityAlgorithm *sa)
+  {
+    theSensitivityAlgorithm= sa;
+    invalidateSensitivities();
+  }
+
+//! @brief Assigns the values of the random variables to the
+//! variables x_1, x_2,... of the interpreter.
+void XC::DirectDifferentiationGradGEvaluator::setRandomVariables(const Vector &x)
+  {
+    char tclAssignment[100];
+    for(int i= 0;i<x.Size();i++)
+      {
+        sprintf(tclAssignment,"set x_%d %35.20f",i+1,x(i));
+        Tcl_Eval(theTclInterp,tclAssignment);
+      }
+  }
+
+//! @brief Assigns the nodal responses of the domain to the variables
+//! u_node_dof (displacement) and ud_node_dof (velocity) of the
+//! interpreter that appear in the tokens of the expression.
+int XC::DirectDifferentiationGradGEvaluator::setNodalResponses(const std::vector<std::string> &tokens)
+  {
+    char tclAssignment[100];
+    for(std::vector<std::string>::const_iterator it= tokens.begin();it!=tokens.end();it++)
+      {
+        const char *tokenPtr= it->c_str();
+        if(strncmp(tokenPtr,"u",1)==0)
+          {
+            const bool isVel= (strncmp(tokenPtr,"ud",2)==0);
+            int nodeNumber= 0, direction= 0;
+            sscanf(tokenPtr,(isVel ? "ud_%i_%i" : "u_%i_%i"),&nodeNumber,&direction);
+            const Node *theNode= theDomain->getNode(nodeNumber);
+            if(!theNode)
+              {
+                std::cerr << "DirectDifferentiationGradGEvaluator::" << __FUNCTION__
+                          << "; node: " << nodeNumber << " not found." << std::endl;
+                return -1;
+              }
+            const Vector &response= (isVel ? theNode->getTrialVel() : theNode->getTrialDisp());
+            if(direction<1 || direction>response.Size())
+              {
+                std::cerr << "DirectDifferentiationGradGEvaluator::" << __FUNCTION__
+                          << "; node: " << nodeNumber << " has no degree of freedom: "
+                          << direction << std::endl;
+                return -1;
+              }
+            sprintf(tclAssignment,(isVel ? "set ud_%d_%d %35.20f" : "set u_%d_%d %35.20f"),nodeNumber,direction,response(direction-1));
+            Tcl_Eval(theTclInterp,tclAssignment);
+          }
+      }
+    return 0;
+  }
+
+//! @brief Forces the response sensitivities to be recomputed on the next call.
+void XC::DirectDifferentiationGradGEvaluator::invalidateSensitivities(void)
+  { lastX.resize(0); }
+
+//! @brief Returns the number of times the sensitivity algorithm has been run.
+int XC::DirectDifferentiationGradGEvaluator::getNumberOfSensitivityAnalyses(void) const
+  { return numSensitivityAnalyses; }
+
+//! @brief Computes the response sensitivities with respect to all the
+//! random variables at point x, unless they are already available
+//! (computed for the same point or at each step by the integrator).
+int XC::DirectDifferentiationGradGEvaluator::updateSensitivities(const Vector &x)
+  {
+    int retval= 0;
+    if(!theSensitivityAlgorithm)
+      {
+        std::cerr << "DirectDifferentiationGradGEvaluator::" << __FUNCTION__
+                  << "; sensitivity algorithm not set." << std::endl;
+        retval= -1;
+      }
+    else if(!theSensitivityAlgorithm->shouldComputeAtEachStep())
+      {
+        bool upToDate= (lastX.Size()==x.Size());
+        for(int i= 0;upToDate && i<x.Size();i++)
+          upToDate= (lastX(i)==x(i));
+        if(!upToDate)
+          {
+            // Solve with the tangent already factored by the analysis if
+            // it's still in the system of equations.
+            theSensitivityAlgorithm->setReuseTangent(theSensitivityAlgorithm->isTangentFactored());
+            retval= theSensitivityAlgorithm->computeSensitivities();
+            numSensitivityAnalyses++;
+            if(retval>=0)
+              lastX= x;
+            else
+              lastX.resize(0);
+          }
+      }
+    return retval;
+  }
+
+//! @brief Returns the finite difference derivative of the active limit-state
+//! expression with respect to the Tcl variable var.
+double XC::DirectDifferentiationGradGEvaluator::perturbExpression(const std::string &var, double originalValue, double delta, double g)
+  {
+    const int lsf= theReliabilityDomain->getTagOfActiveLimitStateFunction();
+    LimitStateFunction *theLimitStateFunction= theReliabilityDomain->getLimitStateFunctionPtr(lsf);
+    char tclAssignment[500];
+    sprintf(tclAssignment,"set %s %35.20f",var.c_str(),originalValue+delta);
+    Tcl_Eval(theTclInterp,tclAssignment);
+    double g_perturbed= g;
+    const std::string theTokenizedExpression= theLimitStateFunction->getTokenizedExpression();
+    Tcl_ExprDouble(theTclInterp,theTokenizedExpression.c_str(),&g_perturbed);
+    sprintf(tclAssignment,"set %s %35.20f",var.c_str(),originalValue);
+    Tcl_Eval(theTclInterp,tclAssignment);
+    return (g_perturbed-g)/delta;
+  }
+
+//! @brief Computes the gradient of the active limit-state function at x.
+int XC::DirectDifferentiationGradGEvaluator::computeGradG(double g, Vector passed_x)
+  {
+    computeParameterDerivatives(g);
+    DgDdispl= Matrix();
+    grad_g.resize(passed_x.Size());
+    grad_g.Zero();
+
+    const int lsf= theReliabilityDomain->getTagOfActiveLimitStateFunction();
+    LimitStateFunction *theLimitStateFunction= theReliabilityDomain->getLimitStateFunctionPtr(lsf);
+    const std::string theExpression= theLimitStateFunction->getExpression();
+    std::vector<char> lsf_copy(theExpression.begin(),theExpression.end());
+    lsf_copy.push_back('\0');
+    const int nrv= passed_x.Size();
+    char separators[5]= "}{";
+    char varName[100];
+    std::vector<Vector> dgddispl; // node, dof, dg/du.
+
+    // Each variable contributes once to the gradient, no matter
+    // how many times it appears in the expression.
+    std::vector<std::string> tokens;
+    std::set<std::string> seen;
+    for(char *t= strtok(&lsf_copy[0],separators);t!=nullptr;t= strtok(nullptr,separators))
+      if(seen.insert(t).second)
+        tokens.push_back(t);
+
+    // All the variables must have a value before differentiating.
+    setRandomVariables(passed_x);
+    if(setNodalResponses(tokens)<0)
+      return -1;
+
+    bool sensitivitiesReady= false;
+    for(std::vector<std::string>::const_iterator it= tokens.begin();it!=tokens.end();it++)
+      {
+        const char *tokenPtr= it->c_str();
+        if(strncmp(tokenPtr,"x",1)==0) // explicit dependence on a random variable.
+          {
+            int rvNum= 0;
+            sscanf(tokenPtr,"x_%i",&rvNum);
+            if(rvNum>=1 && rvNum<=nrv)
+              {
+                const double stdv= theReliabilityDomain->getRandomVariablePtr(rvNum)->getStdv();
+                sprintf(varName,"x_%d",rvNum);
+                grad_g(rvNum-1)+= perturbExpression(varName,passed_x(rvNum-1),perturbationFactor*stdv,g);
+              }
+          }
+        else if((strncmp(tokenPtr,"ud",2)==0) || (strncmp(tokenPtr,"u",1)==0)) // nodal response.
+          {
+            if(!sensitivitiesReady)
+              {
+                const int result= updateSensitivities(passed_x);
+                if(result<0)
+                  {
+                    std::cerr << "DirectDifferentiationGradGEvaluator::" << __FUNCTION__
+                              << "; the sensitivity algorithm failed." << std::endl;
+                    return result;
+                  }
+                sensitivitiesReady= true;
+              }
+            const bool isVel= (strncmp(tokenPtr,"ud",2)==0);
+            int nodeNumber= 0, direction= 0;
+            sscanf(tokenPtr,(isVel ? "ud_%i_%i" : "u_%i_%i"),&nodeNumber,&direction);
+            Node *theNode= theDomain->getNode(nodeNumber); // checked by setNodalResponses.
+            sprintf(varName,(isVel ? "ud_%d_%d" : "u_%d_%d"),nodeNumber,direction);
+            const double originalValue= (isVel ? theNode->getTrialVel()(direction-1) : theNode->getTrialDisp()(direction-1));
+            const double delta= (originalValue!=0.0 ? originalValue*perturbationFactor : perturbationFactor);
+            const double dgdu= perturbExpression(varName,originalValue,delta,g);
+            // Chain rule with the DDM response sensitivities.
+            for(int i= 1;i<=nrv;i++)
+              {
+                const double dudx= (isVel ? theNode->getVelSensitivity(direction,i) : theNode->getDispSensitivity(direction,i));
+                grad_g(i-1)+= dgdu*dudx;
+              }
+            if(!isVel)
+              dgddispl.push_back(Vector(nodeNumber,direction,dgdu));
+          }
+      }
+    if(!dgddispl.empty())
+      {
+        DgDdispl= Matrix(dgddispl.size(),3);
+        for(size_t i= 0;i<dgddispl.size();i++)
+          for(int j= 0;j<3;j++)
+            DgDdispl(i,j)= dgddispl[i](j);
+      }
+    return 0;
+  }
+
+//! @brief Computes the gradients of all the limit-state functions. The
+//! response sensitivities are computed only once for all of them.
+int XC::DirectDifferentiationGradGEvaluator::computeAllGradG(Vector gFunValues, Vector passed_x)
+  {
+    grad_g_matrix= Matrix(passed_x.Size(),gFunValues.Size());
+    for(int j= 1;j<=gFunValues.Size();j++)
+      {
+        theReliabilityDomain->setTagOfActiveLimitStateFunction(j);
+        const int result= computeGradG(gFunValues(j-1),passed_x);
+        if(result<0)
+          return result;
+        for(int i= 0;i<passed_x.Size();i++)
+          grad_g_matrix(i,j-1)= grad_g(i);
+      }
+    return 0;
+  }
+
+//! @brief Returns the gradient of the active limit-state function.
+XC::Vector XC::DirectDifferentiationGradGEvaluator::getGradG()
+  { return grad_g; }
+
+//! @brief Returns the gradients computed by computeAllGradG (one column
+//! for each limit-state function).
+XC::Matrix XC::DirectDifferentiationGradGEvaluator::getAllGradG()
+  {
+    if(grad_g_matrix.noRows()==0)
+      return Matrix(1,1);
+    return grad_g_matrix;
+  }
+
+//! @brief Returns a matrix with a row (node, dof, dg/du) for each
+//! nodal displacement in the active limit-state function.
+XC::Matrix XC::DirectDifferentiationGradGEvaluator::getDgDdispl()
+  { return DgDdispl; }
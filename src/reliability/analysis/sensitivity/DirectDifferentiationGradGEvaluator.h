@@ -0,0 +1,96 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//DirectDifferentiationGradGEvaluator.h
+
+#ifndef DirectDifferentiationGradGEvaluator_h
+#define DirectDifferentiationGradGEvaluator_h
+
+#include "GradGEvaluator.h"
+#include <utility/matrix/Vector.h>
+#include <utility/matrix/Matrix.h>
+
+namespace XC {
+class Domain;
+class SensitivityAlgorithm;
+
+//! @brief Gradient of the limit-state functions obtained by the direct
+//! differentiation method (DDM).
+//!
+//! The response sensitivities with respect to all the random
+//! variables are computed once per design point by the sensitivity
+//! algorithm: the tangent at the converged state is factored once
+//! and each gradient is a forward/back substitution with a new
+//! right-hand side. No additional finite element analysis is needed,
+//! so the cost of a design point iteration doesn't grow with the
+//! number of random variables as it does with the finite difference
+//! evaluator. The derivatives of the limit-state expression with
+//! respect to its arguments (x_i, u_node_dof, ud_node_dof) are cheap
+//! finite differences on the expression itself (the nodal responses
+//! are read from the domain); the chain rule combines them with the
+//! nodal sensitivities. The sensitivity algorithm is needed only if
+//! the limit-state functions depend on nodal responses. If the
+//! system of equations still holds the factored tangent of the
+//! analysis it is reused.
+class DirectDifferentiationGradGEvaluator: public GradGEvaluator
+  {
+  private:
+    Domain *theDomain;
+    SensitivityAlgorithm *theSensitivityAlgorithm;
+    Vector grad_g;
+    Matrix grad_g_matrix;
+    Matrix DgDdispl;
+    double perturbationFactor;
+    Vector lastX; //!< point where the response sensitivities were computed.
+    int numSensitivityAnalyses; //!< number of calls to the sensitivity algorithm.
+    bool ownsInterp; //!< true if the interpreter has been created by this object.
+
+    int updateSensitivities(const Vector &x);
+    double perturbExpression(const std::string &var, double originalValue, double delta, double g);
+    void setRandomVariables(const Vector &x);
+    int setNodalResponses(const std::vector<std::string> &);
+
+    DirectDifferentiationGradGEvaluator(const DirectDifferentiationGradGEvaluator &);
+    DirectDifferentiationGradGEvaluator &operator=(const DirectDifferentiationGradGEvaluator &);
+  public:
+    DirectDifferentiationGradGEvaluator(Tcl_Interp *, ReliabilityDomain *, Domain *, SensitivityAlgorithm *, double perturbationFactor= 0.001);
+    DirectDifferentiationGradGEvaluator(ReliabilityDomain *, Domain *, SensitivityAlgorithm *sa= nullptr, double perturbationFactor= 0.001);
+    ~DirectDifferentiationGradGEvaluator(void);
+
+    int computeGradG(double gFunValue, Vector passed_x);
+    int computeAllGradG(Vector gFunValues, Vector passed_x);
+
+    Vector getGradG();
+    Matrix getAllGradG();
+
+    Matrix getDgDdispl();
+    int getNumberOfSensitivityAnalyses(void) const;
+    void setSensitivityAlgorithm(SensitivityAlgorithm *);
+    void invalidateSensitivities(void);
+  };
+} // end of XC namespace
+
+#endif
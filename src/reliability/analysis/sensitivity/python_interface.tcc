@@ -0,0 +1,47 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//python_interface.tcc
+
+class_<XC::SensitivityIntegrator, boost::noncopyable >("SensitivityIntegrator", no_init);
+
+class_<XC::StaticSensitivityIntegrator, bases<XC::SensitivityIntegrator>, boost::noncopyable >("StaticSensitivityIntegrator", init<XC::AnalysisAggregation *>()[with_custodian_and_ward<1,2>()])
+  ;
+
+class_<XC::NewmarkSensitivityIntegrator, bases<XC::Newmark, XC::SensitivityIntegrator>, boost::noncopyable >("NewmarkSensitivityIntegrator", no_init)
+  ;
+
+class_<XC::SensitivityAlgorithm, boost::noncopyable >("SensitivityAlgorithm", init<XC::ReliabilityDomain *, XC::EquiSolnAlgo *, XC::SensitivityIntegrator *, int>()[with_custodian_and_ward<1,2,with_custodian_and_ward<1,3,with_custodian_and_ward<1,4> > >()])
+  .def("computeSensitivities", &XC::SensitivityAlgorithm::computeSensitivities,"Computes the response sensitivities with respect to the random variables (analysis type 1 or 3) or the parameters (analysis type 2 or 4).")
+  .add_property("reuseTangent", &XC::SensitivityAlgorithm::getReuseTangent, &XC::SensitivityAlgorithm::setReuseTangent,"If true the tangent factored by the solution algorithm is reused.")
+  .add_property("isTangentFactored", &XC::SensitivityAlgorithm::isTangentFactored,"Return true if the system of equations holds a factored tangent.")
+  ;
+
+class_<XC::DirectDifferentiationGradGEvaluator, boost::noncopyable >("DirectDifferentiationGradGEvaluator", init<XC::ReliabilityDomain *, XC::Domain *>()[with_custodian_and_ward<1,2,with_custodian_and_ward<1,3> >()])
+  .def(init<XC::ReliabilityDomain *, XC::Domain *, XC::SensitivityAlgorithm *>()[with_custodian_and_ward<1,2,with_custodian_and_ward<1,3,with_custodian_and_ward<1,4> > >()])
+  .def("setSensitivityAlgorithm", &XC::DirectDifferentiationGradGEvaluator::setSensitivityAlgorithm, with_custodian_and_ward<1,2>(),"Sets the algorithm that computes the response sensitivities (needed if the limit-state functions depend on nodal responses).")
+  .def("computeGradG", &XC::DirectDifferentiationGradGEvaluator::computeGradG,"computeGradG(g,x): computes the gradient of the active limit-state function (whose value is g) at the point x.")
+  .def("computeAllGradG", &XC::DirectDifferentiationGradGEvaluator::computeAllGradG,"computeAllGradG(gValues,x): computes the gradients of all the limit-state functions at the point x.")
+  .add_property("getGradG", &XC::DirectDifferentiationGradGEvaluator::getGradG,"Return the gradient of the active limit-state function.")
+  .add_property("getAllGradG", &XC::DirectDifferentiationGradGEvaluator::getAllGradG,"Return the gradients of all the limit-state functions (one column each).")
+  .add_property("getDgDdispl", &XC::DirectDifferentiationGradGEvaluator::getDgDdispl,"Return a row (node, dof, dg/du) for each nodal displacement in the active limit-state function.")
+  .add_property("getNumberOfSensitivityAnalyses", &XC::DirectDifferentiationGradGEvaluator::getNumberOfSensitivityAnalyses,"Return the number of times the response sensitivities have been computed.")
+  ;
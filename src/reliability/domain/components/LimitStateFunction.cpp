@@ -67,10 +67,17 @@ XC::LimitStateFunction::LimitStateFunction(int passedTag,const std::string &pass
   {
     originalExpression= passedExpression;
     expressionWithAddition= passedExpression;
-    tokenizedExpression= passedExpression;
+    tokenizeIt(expressionWithAddition);
   }
 
 
+//! @brief Print stuff.
+void XC::LimitStateFunction::Print(std::ostream &s, int flag)
+  {
+    s << "LimitStateFunction, tag: " << getTag() << std::endl
+      << "  expression: " << expressionWithAddition << std::endl;
+  }
+
 const std::string &XC::LimitStateFunction::getExpression(void) const
   { return expressionWithAddition; }
 
@@ -104,6 +104,7 @@ class LimitStateFunction : public ReliabilityDomainComponent
     Vector secondLastAlpha;
   public:
     LimitStateFunction(int tag,const std::string &expression);
+    void Print(std::ostream &s, int flag =0);
 
     // Method to get/add limit-state function
     const std::string &getExpression(void) const;
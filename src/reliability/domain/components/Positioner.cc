@@ -42,21 +42,24 @@ XC::Positioner::Positioner(int passedTag, int classTag,DomainComponent *object,c
   }
 
 
+//! @brief Sets the new value of the parameter on the objects that
+//! have identified it (the identifiers of the parameter in each
+//! object are stored in theParam).
 int XC::Positioner::update(double newValue)
   {
     theInfo.theDouble = newValue;
     if(parameterID >= 0)
-      return theObject->updateParameter(parameterID, theInfo);
+      return theParam.update(newValue);
     else
       return -1;
   }
 
+//! @brief Activates (or deactivates) the parameter on the objects
+//! that have identified it.
 int XC::Positioner::activate(bool active)
   {
-    if(active)
-      { theObject->activateParameter(parameterID); }
-    else
-      { theObject->activateParameter(0); }
+    if(parameterID >= 0)
+      theParam.activate(active);
     return 0;
   }
 
@@ -68,6 +68,8 @@
 #include <reliability/domain/modulatingFunction/ModulatingFunction.h>
 #include <reliability/domain/filter/Filter.h>
 #include <reliability/domain/spectrum/Spectrum.h>
+#include <reliability/domain/distributions/NormalRV.h>
+#include <sstream>
 
 
 XC::ReliabilityDomain::ReliabilityDomain()
@@ -102,6 +104,21 @@ bool XC::ReliabilityDomain::addRandomVariable(RandomVariable *theRandomVariable)
     return result;
   }
 
+//! @brief Creates a normal random variable and adds it to the domain
+//! (returns nullptr if the tag is already in use).
+XC::RandomVariable *XC::ReliabilityDomain::newNormalRV(int tag,double mean,double stdv)
+  {
+    RandomVariable *retval= new NormalRV(tag,mean,stdv);
+    if(!addRandomVariable(retval))
+      {
+        std::cerr << "ReliabilityDomain::" << __FUNCTION__
+                  << "; could not add random variable: " << tag << std::endl;
+        delete retval;
+        retval= nullptr;
+      }
+    return retval;
+  }
+
 bool XC::ReliabilityDomain::addCorrelationCoefficient(CorrelationCoefficient *theCorrelationCoefficient)
   {
     bool result = theCorrelationCoefficientsPtr->addComponent(theCorrelationCoefficient);
@@ -114,6 +131,43 @@ bool XC::ReliabilityDomain::addLimitStateFunction(LimitStateFunction *theLimitSt
     return result;
   }
 
+//! @brief Creates a limit-state function and adds it to the domain
+//! (returns nullptr if the tag is already in use).
+XC::LimitStateFunction *XC::ReliabilityDomain::newLimitStateFunction(int tag,const std::string &expression)
+  {
+    LimitStateFunction *retval= new LimitStateFunction(tag,expression);
+    if(!addLimitStateFunction(retval))
+      {
+        std::cerr << "ReliabilityDomain::" << __FUNCTION__
+                  << "; could not add limit-state function: " << tag << std::endl;
+        delete retval;
+        retval= nullptr;
+      }
+    return retval;
+  }
+
+//! @brief Creates a positioner that sets the value of the random variable
+//! rvNumber on a parameter of the domain component (i.e. "A" for the area
+//! of a truss or "material E" for the elastic modulus of its material)
+//! and adds it to the domain.
+XC::RandomVariablePositioner *XC::ReliabilityDomain::newRandomVariablePositioner(int tag,int rvNumber,DomainComponent *theObject,const std::string &parameter)
+  {
+    std::vector<std::string> argv;
+    std::istringstream iss(parameter);
+    std::string word;
+    while(iss >> word)
+      argv.push_back(word);
+    RandomVariablePositioner *retval= new RandomVariablePositioner(tag,rvNumber,theObject,argv);
+    if(!addRandomVariablePositioner(retval))
+      {
+        std::cerr << "ReliabilityDomain::" << __FUNCTION__
+                  << "; could not add random variable positioner: " << tag << std::endl;
+        delete retval;
+        retval= nullptr;
+      }
+    return retval;
+  }
+
 bool XC::ReliabilityDomain::addRandomVariablePositioner(RandomVariablePositioner *theRandomVariablePositioner)
   {
     bool result = theRandomVariablePositionersPtr->addComponent(theRandomVariablePositioner);
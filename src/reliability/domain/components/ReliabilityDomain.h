@@ -87,6 +87,9 @@ class ReliabilityDomain
 	virtual bool addModulatingFunction(ModulatingFunction *theModulatingFunction);
 	virtual bool addFilter(Filter *theFilter);
 	virtual bool addSpectrum(Spectrum *theSpectrum);
+	RandomVariable *newNormalRV(int tag,double mean,double stdv);
+	LimitStateFunction *newLimitStateFunction(int tag,const std::string &expression);
+	RandomVariablePositioner *newRandomVariablePositioner(int tag,int rvNumber,DomainComponent *,const std::string &parameter);
 
 	// Member functions to get components from the domain
 	RandomVariable *getRandomVariablePtr(int tag);
@@ -0,0 +1,45 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//python_interface.tcc
+
+class_<XC::RandomVariable, bases<XC::TaggedObject>, boost::noncopyable >("RandomVariable", no_init)
+  .add_property("mean", &XC::RandomVariable::getMean,"Return the mean of the random variable.")
+  .add_property("stdv", &XC::RandomVariable::getStdv,"Return the standard deviation of the random variable.")
+  ;
+
+class_<XC::LimitStateFunction, bases<XC::TaggedObject>, boost::noncopyable >("LimitStateFunction", no_init)
+  .add_property("expression", make_function(&XC::LimitStateFunction::getExpression, return_value_policy<copy_const_reference>()),"Return the expression of the limit-state function.")
+  .add_property("tokenizedExpression", make_function(&XC::LimitStateFunction::getTokenizedExpression, return_value_policy<copy_const_reference>()),"Return the expression as evaluated by the interpreter.")
+  ;
+
+class_<XC::RandomVariablePositioner, boost::noncopyable >("RandomVariablePositioner", no_init)
+  .add_property("rvNumber", &XC::RandomVariablePositioner::getRvNumber,"Return the number of the random variable.")
+  ;
+
+class_<XC::ReliabilityDomain, boost::noncopyable >("ReliabilityDomain")
+  .def("newNormalRV", &XC::ReliabilityDomain::newNormalRV, return_internal_reference<>(),"newNormalRV(tag,mean,stdv): creates a normal random variable.")
+  .def("newRandomVariablePositioner", &XC::ReliabilityDomain::newRandomVariablePositioner, return_internal_reference<>(),"newRandomVariablePositioner(tag,rvNumber,object,parameter): creates a positioner that maps the random variable to a parameter of the domain component (i.e. 'A' for the area of a truss).")
+  .def("newLimitStateFunction", &XC::ReliabilityDomain::newLimitStateFunction, return_internal_reference<>(),"newLimitStateFunction(tag,expression): creates a limit-state function (i.e. '{x_1}-{u_2_1}').")
+  .add_property("numberOfRandomVariables", &XC::ReliabilityDomain::getNumberOfRandomVariables,"Return the number of random variables.")
+  .add_property("numberOfLimitStateFunctions", &XC::ReliabilityDomain::getNumberOfLimitStateFunctions,"Return the number of limit-state functions.")
+  .add_property("tagOfActiveLimitStateFunction", &XC::ReliabilityDomain::getTagOfActiveLimitStateFunction, &XC::ReliabilityDomain::setTagOfActiveLimitStateFunction,"Identifier of the limit-state function being evaluated.")
+  ;
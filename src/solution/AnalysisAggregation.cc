@@ -35,6 +35,7 @@
 
 //Integrators.
 #include "solution/analysis/integrator/integrators.h"
+#include "reliability/FEsensitivity/NewmarkSensitivityIntegrator.h"
 
 //Solution algorithm.
 #include "solution/analysis/algorithm/solution_algorithms.h"
@@ -71,7 +72,9 @@ bool XC::AnalysisAggregation::alloc_soln_algo(const std::string &nmb)
   {
     free_soln_algo();
 
-    if(nmb=="bfgs_soln_algo")
+    if(nmb=="adaptive_newton_soln_algo")
+      theSolnAlgo=new AdaptiveNewton(this);
+    else if(nmb=="bfgs_soln_algo")
       theSolnAlgo=new BFGS(this);
     else if(nmb=="broyden_soln_algo")
       theSolnAlgo=new Broyden(this);
@@ -236,6 +239,8 @@ bool XC::AnalysisAggregation::alloc_integrator(const std::string &nmb,const Vect
       theIntegrator=new HHTHybridSimulation(this);
     else if(nmb=="newmark_integrator")
       theIntegrator=new Newmark(this,.5,.25);
+    else if(nmb=="newmark_sensitivity_integrator")
+      theIntegrator=new NewmarkSensitivityIntegrator(this,0,.5,.25);
     else if(nmb=="newmark1_integrator")
       theIntegrator=new Newmark1(this,.5,.25);
     else if(nmb=="newmark_explicit_integrator")
@@ -319,6 +324,8 @@ bool XC::AnalysisAggregation::alloc_system_of_equations(const std::string &nmb,A
       theSOE=new DiagonalSOE(this);
     else if(nmb=="distributed_diagonal_soe")
       theSOE=new DistributedDiagonalSOE(this);
+    else if(nmb=="ebe_lin_soe")
+      theSOE=new ElementByElementLinSOE(this);
     else if(nmb=="full_gen_lin_soe")
       theSOE=new FullGenLinSOE(this);
 //     else if(nmb=="itpack_lin_soe")
@@ -92,26 +92,67 @@ XC::DomainDecompAlgo::DomainDecompAlgo(AnalysisAggregation *owr)
 //! INVOKED ALL RETURN \f$0\f$ OTHERWISE PRINT WARNING AND RETURN NEGATIVE.
 int XC::DomainDecompAlgo::solveCurrentStep(void)
   {
-    IncrementalIntegrator *theIntegrator= dynamic_cast<IncrementalIntegrator *>(getIntegratorPtr());
-    LinearSOE *theLinearSOE= getLinearSOEPtr();
+    int retval= setExternalResponse();
+    if(retval==0)
+      retval= solveInternalResponse();
+    if(retval==0)
+      retval= updateInternalResponse();
+    return retval;
+  }
+
+//! @brief First step of solveCurrentStep: passes the response of the
+//! external dofs (obtained from the solution of the interface problem)
+//! to the solver.
+int XC::DomainDecompAlgo::setExternalResponse(void)
+  {
     DomainSolver *theSolver= getDomainSolverPtr();    
     Subdomain *theSubdomain= getSubdomainPtr();
-    
-    if(theIntegrator != 0 && theLinearSOE != 0 &&
-	theSolver != 0 && theSubdomain != 0 )
+    if(theSolver != 0 && theSubdomain != 0)
       {
 	const Vector &extResponse= theSubdomain->getLastExternalSysResponse();
-
 	theSolver->setComputedXext(extResponse);
-	theSolver->solveXint();
+	return 0;
+      }
+    else
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; no links have been set\n";
+	return -1;
+      }
+  }
 
+//! @brief Second step of solveCurrentStep: computes the response of
+//! the internal dofs (back substitution). This step only
+//! uses the data of the solver, so it can be performed concurrently
+//! for different subdomains.
+int XC::DomainDecompAlgo::solveInternalResponse(void)
+  {
+    DomainSolver *theSolver= getDomainSolverPtr();    
+    if(theSolver)
+      return theSolver->solveXint();
+    else
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; no solver has been set\n";
+	return -1;
+      }
+  }
+
+//! @brief Last step of solveCurrentStep: updates the response of
+//! the subdomain nodes.
+int XC::DomainDecompAlgo::updateInternalResponse(void)
+  {
+    IncrementalIntegrator *theIntegrator= dynamic_cast<IncrementalIntegrator *>(getIntegratorPtr());
+    LinearSOE *theLinearSOE= getLinearSOEPtr();
+    if(theIntegrator != 0 && theLinearSOE != 0)
+      {
 	theIntegrator->update(theLinearSOE->getX());
 	return 0;
       }
     else
       {
-	std::cerr << "XC::DomainDecompAlgo::solveCurrentStep() ";
-	std::cerr << "no links have been set\n";
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; no links have been set\n";
 	return -1;
       }
   }
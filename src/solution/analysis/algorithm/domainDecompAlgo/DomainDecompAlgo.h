@@ -95,6 +95,11 @@ class DomainDecompAlgo: public SolutionAlgorithm
   public:
     // public functions defined for subclasses
     int solveCurrentStep(void);
+
+    // steps of solveCurrentStep (see PartitionedDomain::update).
+    int setExternalResponse(void);
+    int solveInternalResponse(void);
+    int updateInternalResponse(void);
     int sendSelf(CommParameters &);
     int recvSelf(const CommParameters &);
   };
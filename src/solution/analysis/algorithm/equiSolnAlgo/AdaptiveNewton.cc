@@ -0,0 +1,521 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//AdaptiveNewton.cc
+
+#include <solution/analysis/algorithm/equiSolnAlgo/AdaptiveNewton.h>
+#include <solution/analysis/algorithm/equiSolnAlgo/lineSearch/LineSearch.h>
+#include <solution/analysis/algorithm/equiSolnAlgo/lineSearch/BisectionLineSearch.h>
+#include <solution/analysis/algorithm/equiSolnAlgo/lineSearch/InitialInterpolatedLineSearch.h>
+#include <solution/analysis/algorithm/equiSolnAlgo/lineSearch/RegulaFalsiLineSearch.h>
+#include <solution/analysis/algorithm/equiSolnAlgo/lineSearch/SecantLineSearch.h>
+#include <solution/analysis/model/AnalysisModel.h>
+#include <solution/analysis/integrator/IncrementalIntegrator.h>
+#include <solution/system_of_eqn/linearSOE/LinearSOE.h>
+#include <solution/analysis/convergenceTest/ConvergenceTest.h>
+#include <utility/matrix/Matrix.h>
+#include <utility/matrix/Vector.h>
+#include "solution/AnalysisAggregation.h"
+#include <chrono>
+#include <cmath>
+#include <sstream>
+
+//! @brief Update the exponential average of a measured value.
+inline void update_average(double &avg,const double &value)
+  { avg= (avg>0.0) ? 0.5*(avg+value) : value; }
+
+//! @brief Constructor.
+//!
+//! @param owr: analysis aggregation that owns this object.
+//! @param theTangentToUse: tangent to use (current, initial,...).
+//! @param maxDim: maximum dimension of the Krylov subspace.
+XC::AdaptiveNewton::AdaptiveNewton(AnalysisAggregation *owr,int theTangentToUse, int maxDim)
+  :EquiSolnAlgo(owr,EquiALGORITHM_TAGS_AdaptiveNewton),
+   tangent(theTangentToUse), theLineSearch(nullptr), v(0), Av(0),
+   AvData(0), rData(0), work(0), lwork(0), numEqns(0), maxDimension(maxDim),
+   maxContraction(0.9), divergenceRatio(1.0), useCostModel(true),
+   freshIterationCost(0.0), staleIterationCost(0.0), newtonContraction(0.1),
+   numRefactorizations(0), numKrylovIterations(0), numLineSearches(0)
+  {
+    if(maxDimension < 0) maxDimension= 0;
+    alloc("initial_interpolated_line_search");
+  }
+
+//! @brief Copy constructor.
+XC::AdaptiveNewton::AdaptiveNewton(const AdaptiveNewton &other)
+  : EquiSolnAlgo(other), tangent(other.tangent), theLineSearch(nullptr),
+    v(other.v), Av(other.Av), AvData(other.AvData), rData(other.rData),
+    work(other.work), lwork(other.lwork), numEqns(other.numEqns),
+    maxDimension(other.maxDimension), maxContraction(other.maxContraction),
+    divergenceRatio(other.divergenceRatio), useCostModel(other.useCostModel),
+    freshIterationCost(other.freshIterationCost),
+    staleIterationCost(other.staleIterationCost),
+    newtonContraction(other.newtonContraction),
+    numRefactorizations(other.numRefactorizations),
+    numKrylovIterations(other.numKrylovIterations),
+    numLineSearches(other.numLineSearches)
+  { if(other.theLineSearch) copy(other.theLineSearch); }
+
+//! @brief Assignment operator.
+XC::AdaptiveNewton &XC::AdaptiveNewton::operator=(const AdaptiveNewton &other)
+  {
+    EquiSolnAlgo::operator=(other);
+    tangent= other.tangent;
+    v= other.v;
+    Av= other.Av;
+    AvData= other.AvData;
+    rData= other.rData;
+    work= other.work;
+    lwork= other.lwork;
+    numEqns= other.numEqns;
+    maxDimension= other.maxDimension;
+    maxContraction= other.maxContraction;
+    divergenceRatio= other.divergenceRatio;
+    useCostModel= other.useCostModel;
+    freshIterationCost= other.freshIterationCost;
+    staleIterationCost= other.staleIterationCost;
+    newtonContraction= other.newtonContraction;
+    numRefactorizations= other.numRefactorizations;
+    numKrylovIterations= other.numKrylovIterations;
+    numLineSearches= other.numLineSearches;
+    if(other.theLineSearch)
+      copy(other.theLineSearch);
+    else
+      free_mem();
+    return *this;
+  }
+
+//! @brief Destructor.
+XC::AdaptiveNewton::~AdaptiveNewton(void)
+  { free_mem(); }
+
+void XC::AdaptiveNewton::free_mem(void)
+  {
+    if(theLineSearch)
+      {
+        delete theLineSearch;
+        theLineSearch= nullptr;
+      }
+  }
+
+//! @brief Create the line search whose name is being passed as parameter.
+bool XC::AdaptiveNewton::alloc(const std::string &nmb)
+  {
+    free_mem();
+    if(nmb=="bisection_line_search")
+      theLineSearch=new BisectionLineSearch();
+    else if(nmb=="initial_interpolated_line_search")
+      theLineSearch=new InitialInterpolatedLineSearch();
+    else if(nmb=="regula_falsi_line_search")
+      theLineSearch=new RegulaFalsiLineSearch();
+    else if(nmb=="secant_line_search")
+      theLineSearch=new SecantLineSearch();
+    if(theLineSearch)
+      theLineSearch->set_owner(this);
+    return (theLineSearch!=nullptr);
+  }
+
+void XC::AdaptiveNewton::copy(LineSearch *ptr)
+  {
+    if(ptr)
+      {
+        free_mem();
+        theLineSearch= ptr->getCopy();
+        theLineSearch->set_owner(this);
+      }
+    else
+     std::cerr << getClassName() << "::" << __FUNCTION__
+	       << "; pointer to line search is null." << std::endl;
+  }
+
+//! @brief Return the maximum dimension of the Krylov subspace.
+int XC::AdaptiveNewton::getMaxDimension(void) const
+  { return maxDimension; }
+
+//! @brief Set the maximum dimension of the Krylov subspace (zero
+//! means modified Newton iterations between refactorizations).
+void XC::AdaptiveNewton::setMaxDimension(const int &d)
+  {
+    maxDimension= std::max(d,0);
+    v.clear();
+    Av.clear();
+  }
+
+//! @brief Return the contraction rate (|R_k|/|R_{k-1}|) over which
+//! the tangent is refactored.
+double XC::AdaptiveNewton::getMaxContraction(void) const
+  { return maxContraction; }
+
+//! @brief Set the contraction rate (|R_k|/|R_{k-1}|) over which
+//! the tangent is refactored.
+void XC::AdaptiveNewton::setMaxContraction(const double &d)
+  { maxContraction= d; }
+
+//! @brief Return the ratio |R_k|/|R_{k-1}| over which the iterations
+//! are considered divergent.
+double XC::AdaptiveNewton::getDivergenceRatio(void) const
+  { return divergenceRatio; }
+
+//! @brief Set the ratio |R_k|/|R_{k-1}| over which the iterations
+//! are considered divergent.
+void XC::AdaptiveNewton::setDivergenceRatio(const double &d)
+  { divergenceRatio= d; }
+
+//! @brief Return true if the measured costs are used to decide
+//! when to refactor the tangent.
+bool XC::AdaptiveNewton::getUseCostModel(void) const
+  { return useCostModel; }
+
+//! @brief If true, use the measured costs to decide when to refactor
+//! the tangent; otherwise the tangent is refactored only when the
+//! contraction is poor, the iterations diverge or the Krylov subspace
+//! is full.
+void XC::AdaptiveNewton::setUseCostModel(const bool &b)
+  { useCostModel= b; }
+
+//! @brief Set the line search to use when the iterations with a fresh
+//! tangent diverge ("bisection_line_search",
+//! "initial_interpolated_line_search", "regula_falsi_line_search" or
+//! "secant_line_search"). Any other name removes the line search.
+void XC::AdaptiveNewton::setLineSearch(const std::string &nmb)
+  { alloc(nmb); }
+
+//! @brief Return true if a line search has been defined.
+bool XC::AdaptiveNewton::hasLineSearch(void) const
+  { return (theLineSearch!=nullptr); }
+
+//! @brief Return the number of times the tangent has been formed.
+size_t XC::AdaptiveNewton::getNumRefactorizations(void) const
+  { return numRefactorizations; }
+
+//! @brief Return the number of iterations that reused the last
+//! factorization.
+size_t XC::AdaptiveNewton::getNumKrylovIterations(void) const
+  { return numKrylovIterations; }
+
+//! @brief Return the number of line searches performed.
+size_t XC::AdaptiveNewton::getNumLineSearches(void) const
+  { return numLineSearches; }
+
+//! @brief Reset the counters of refactorizations, Krylov iterations
+//! and line searches.
+void XC::AdaptiveNewton::resetStatistics(void)
+  {
+    numRefactorizations= 0;
+    numKrylovIterations= 0;
+    numLineSearches= 0;
+  }
+
+//! @brief Return true if the reduction of the residual per unit of time
+//! expected from a fresh tangent is greater than the one obtained
+//! with the last factorization.
+//!
+//! @param rho: last contraction rate (|R_k|/|R_{k-1}|) obtained with
+//! the last factorization.
+bool XC::AdaptiveNewton::refactorIsCheaper(const double &rho) const
+  {
+    bool retval= false;
+    if(useCostModel && (rho>0.0) && (freshIterationCost>0.0) && (staleIterationCost>0.0))
+      {
+        const double staleRate= -log(rho)/staleIterationCost;
+        const double freshRate= -log(newtonContraction)/freshIterationCost;
+        retval= (staleRate<freshRate);
+      }
+    return retval;
+  }
+
+//! @brief Solve the current step.
+int XC::AdaptiveNewton::solveCurrentStep(void)
+  {
+    AnalysisModel *theAnaModel= getAnalysisModelPtr();
+    IncrementalIntegrator *theIntegrator= getIncrementalIntegratorPtr();
+    LinearSOE *theSOE= getLinearSOEPtr();
+    ConvergenceTest *theTest= getConvergenceTestPtr();
+
+    if((theAnaModel == 0) || (theIntegrator == 0) || (theSOE == 0) || (theTest == 0))
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; undefined model, integrator or system of equations.\n";
+        return -5;
+      }
+
+    // Get size information from SOE
+    numEqns= theSOE->getNumEqn();
+    const int maxDim= std::min(maxDimension,numEqns);
+    if((v.size()!=size_t(maxDim+1)) || (v[0].Size()!=numEqns))
+      {
+        v= std::vector<Vector>(maxDim+1,Vector(numEqns));
+        Av= std::vector<Vector>(maxDim+1,Vector(numEqns));
+      }
+    AvData.resize(maxDim*numEqns);
+    rData.resize(std::max(numEqns,maxDim));
+    lwork= 2*std::min(numEqns,maxDim);
+    work.resize(lwork);
+
+    if(theLineSearch)
+      theLineSearch->newStep(*theSOE);
+
+    // Evaluate system residual R(y_0)
+    if(theIntegrator->formUnbalance() < 0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; the Integrator failed in formUnbalance()\n";
+        return -2;
+      }
+
+    theTest->set_owner(getAnalysisAggregation());
+    if(theTest->start() < 0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; the ConvergenceTest object failed in start()\n";
+        return -3;
+      }
+
+    double normR= theSOE->getB().Norm();
+    bool refactor= true; // Form the tangent in the first iteration.
+    bool lineSearchOn= false;
+    int dim= 0; // Current dimension of Krylov subspace.
+    int k= 1;
+    int result= -1;
+    do
+      {
+        const bool freshTangent= refactor;
+        const std::chrono::steady_clock::time_point start= std::chrono::steady_clock::now();
+        if(refactor)
+          {
+            if(theIntegrator->formTangent(tangent) < 0)
+              {
+                std::cerr << getClassName() << "::" << __FUNCTION__
+                          << "; the Integrator failed in formTangent()\n";
+                return -1;
+              }
+            numRefactorizations++;
+            dim= 0;
+            refactor= false;
+          }
+
+        if(theSOE->solve() < 0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; the LinearSysOfEqn failed in solve()\n";
+            return -3;
+          }
+
+        const Vector &dU= theSOE->getX();
+        const Vector *dx= &dU;
+        double s0= 0.0;
+        if(lineSearchOn)
+          s0= -(dU ^ theSOE->getB());
+        else
+          {
+            // Krylov update on the last factorization.
+            if(this->leastSquares(dim) < 0)
+              {
+                std::cerr << getClassName() << "::" << __FUNCTION__
+                          << "; failed in leastSquares()\n";
+                return -1;
+              }
+            dx= &v[dim];
+            if(maxDim>0)
+              dim++;
+            if(!freshTangent)
+              numKrylovIterations++;
+          }
+
+        if(theIntegrator->update(*dx) < 0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; the Integrator failed in update()\n";
+            return -4;
+          }
+
+        if(theIntegrator->formUnbalance() < 0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; the Integrator failed in formUnbalance()\n";
+            return -2;
+          }
+
+        if(lineSearchOn)
+          {
+            const double s= -(dU ^ theSOE->getB());
+            theLineSearch->search(s0, s, *theSOE, *theIntegrator);
+            numLineSearches++;
+          }
+
+        const std::chrono::duration<double> elapsed= std::chrono::steady_clock::now()-start;
+        if(freshTangent)
+          update_average(freshIterationCost,elapsed.count());
+        else
+          update_average(staleIterationCost,elapsed.count());
+
+        // Contraction rate of the residual.
+        const double normR1= theSOE->getB().Norm();
+        const double rho= (normR>0.0) ? normR1/normR : 0.0;
+        normR= normR1;
+
+        result= theTest->test();
+        this->record(k++); //Call the record(...) method of all the recorders.
+
+        if(result == -1) // Decide what to do in the next iteration.
+          {
+            std::ostringstream msg;
+            if(lineSearchOn)
+              refactor= true; // Newton with line search until the end of the step.
+            else if(rho>divergenceRatio)
+              {
+                refactor= true;
+                msg << "residual grows (ratio= " << rho << ")";
+                if(!freshTangent)
+                  msg << " with the last factorization; refactoring.";
+                else if(theLineSearch)
+                  {
+                    lineSearchOn= true;
+                    msg << " with a fresh tangent; line search enabled.";
+                  }
+                else
+                  msg << " with a fresh tangent and no line search defined.";
+              }
+            else if(freshTangent)
+              {
+                if(rho>0.0)
+                  {
+                    update_average(newtonContraction,rho);
+                    newtonContraction= std::max(std::min(newtonContraction,0.99),1e-3);
+                  }
+              }
+            else if(dim>maxDim)
+              {
+                refactor= true;
+                msg << "Krylov subspace full (dimension= " << maxDim << "); refactoring.";
+              }
+            else if(rho>maxContraction)
+              {
+                refactor= true;
+                msg << "slow contraction (ratio= " << rho << "); refactoring.";
+              }
+            else if(refactorIsCheaper(rho))
+              {
+                refactor= true;
+                msg << "a new tangent is cheaper (ratio= " << rho
+                    << ", iteration cost: " << staleIterationCost
+                    << " s, refactoring cost: " << freshIterationCost
+                    << " s); refactoring.";
+              }
+            const std::string tmp= msg.str();
+            if(!tmp.empty())
+              theTest->logAlgorithmDecision(tmp);
+          }
+      }
+    while(result == -1);
+
+    if(result == -2)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; the ConvergenceTest object failed in test()\n"
+                  << "convergence test message: "
+                  << theTest->getStatusMsg(1) << std::endl;
+        return -3;
+      }
+
+    // note - if postive result we are returning what the convergence
+    // test returned which should be the number of iterations
+    return result;
+  }
+
+int XC::AdaptiveNewton::sendSelf(CommParameters &cp)
+  { return -1; }
+
+int XC::AdaptiveNewton::recvSelf(const CommParameters &cp)
+  { return -1; }
+
+void XC::AdaptiveNewton::Print(std::ostream &s, int flag)
+  {
+    s << getClassName();
+    s << "\n\tMax subspace dimension: " << maxDimension;
+    s << "\n\tMax contraction ratio: " << maxContraction;
+    s << "\n\tDivergence ratio: " << divergenceRatio;
+    s << "\n\tNumber of equations: " << numEqns << std::endl;
+    if(theLineSearch)
+      theLineSearch->Print(s, flag);
+  }
+
+extern "C" int dgels_(char *T, int *M, int *N, int *NRHS,
+                      double *A, int *LDA, double *B, int *LDB,
+                      double *WORK, int *LWORK, int *INFO);
+
+//! @brief Krylov subspace update (see KrylovNewton::leastSquares).
+int XC::AdaptiveNewton::leastSquares(int k)
+  {
+    LinearSOE *theSOE= this->getLinearSOEPtr();
+    const Vector &r= theSOE->getX();
+
+    // v_{k+1} = w_{k+1} + q_{k+1}
+    v[k]= r;
+    Av[k]= r;
+
+    // Subspace is empty
+    if(k == 0)
+      return 0;
+
+    // Compute Av_k = f(y_{k-1}) - f(y_k) = r_{k-1} - r_k
+    Av[k-1].addVector(1.0, r, -1.0);
+
+    // Put subspace vectors into AvData
+    Matrix A(AvData.getDataPtr(), numEqns, k);
+    for(int i= 0; i < k; i++)
+      {
+        const Vector &Ai= Av[i];
+        for(int j= 0; j < numEqns; j++)
+          A(j,i)= Ai(j);
+      }
+
+    // Put residual vector into rData (need to save r for later!)
+    Vector B(rData.getDataPtr(), numEqns);
+    B= r;
+
+    char trans[]= "N"; // No transpose
+    int nrhs= 1; // The number of right hand side vectors
+    int ldb= std::max(numEqns,k); // Leading dimension of the right hand side vector
+    int info= 0; // Subroutine error flag
+
+    // Call the LAPACK least squares subroutine
+    dgels_(trans, &numEqns, &k, &nrhs, AvData.getDataPtr(), &numEqns, rData.getDataPtr(), &ldb, work.getDataPtr(), &lwork, &info);
+
+    if(info < 0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; error code " << info << " returned by LAPACK dgels\n";
+        return info;
+      }
+
+    // Compute the correction vector
+    for(int j= 0; j < k; j++)
+      {
+        // Solution to least squares is written to rData
+        const double cj= rData[j];
+        // Compute w_{k+1} = c_1 v_1 + ... + c_k v_k
+        v[k].addVector(1.0, v[j], cj);
+        // Compute least squares residual q_{k+1} = r_k - (c_1 Av_1 + ... + c_k Av_k)
+        v[k].addVector(1.0, Av[j], -cj);
+      }
+    return 0;
+  }
@@ -0,0 +1,120 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//AdaptiveNewton.h
+
+#ifndef AdaptiveNewton_h
+#define AdaptiveNewton_h
+
+#include "EquiSolnAlgo.h"
+#include "utility/matrix/Vector.h"
+
+namespace XC {
+
+class LineSearch;
+
+//! @ingroup EQSolAlgo
+//
+//! @brief Newton based algorithm that chooses, iteration by iteration,
+//! between refactoring the tangent, reusing the last factorization with
+//! a Krylov subspace accelerator (see KrylovNewton) and doing full Newton
+//! iterations with a line search (see NewtonLineSearch).
+//!
+//! The decisions are based on the contraction rate of the residual
+//! (|R_k|/|R_{k-1}|), on the measured cost of forming and factoring
+//! the tangent versus the cost of an iteration with the last
+//! factorization and on the growth of the residual (divergence).
+//! The decisions are logged through the convergence test.
+class AdaptiveNewton: public EquiSolnAlgo
+  {
+  private:
+    int tangent; //!< Tangent to use (current, initial,...).
+    LineSearch *theLineSearch; //!< Line search used when the iterations diverge.
+
+    // Krylov subspace accelerator (see KrylovNewton).
+    std::vector<Vector> v; //!< Update vectors.
+    std::vector<Vector> Av; //!< Subspace vectors.
+    Vector AvData; //!< Array data sent to LAPACK subroutine.
+    Vector rData;
+    Vector work;
+    int lwork; //!< Length of work array.
+    int numEqns;
+    int maxDimension; //!< Maximum dimension of the Krylov subspace.
+
+    double maxContraction; //!< Refactor if |R_k|/|R_{k-1}| is greater than this value.
+    double divergenceRatio; //!< The iterations diverge if |R_k|/|R_{k-1}| is greater than this value.
+
+    // Cost model (exponential averages of the measured values).
+    bool useCostModel; //!< If true, compare the cost of refactoring with the cost of going on with the last factorization.
+    double freshIterationCost; //!< Time of an iteration that forms and factors the tangent.
+    double staleIterationCost; //!< Time of an iteration with the last factorization.
+    double newtonContraction; //!< Contraction rate of the iterations with a fresh tangent.
+
+    // Statistics.
+    size_t numRefactorizations; //!< Number of times the tangent has been formed.
+    size_t numKrylovIterations; //!< Number of iterations with a stale factorization.
+    size_t numLineSearches; //!< Number of line searches performed.
+
+    int leastSquares(int dimension);
+    bool refactorIsCheaper(const double &) const;
+
+    friend class AnalysisAggregation;
+    friend class FEM_ObjectBroker;
+    AdaptiveNewton(AnalysisAggregation *,int tangent= CURRENT_TANGENT, int maxDim= 3);
+    AdaptiveNewton(const AdaptiveNewton &);
+    AdaptiveNewton &operator=(const AdaptiveNewton &);
+    virtual SolutionAlgorithm *getCopy(void) const;
+  protected:
+    void free_mem(void);
+    bool alloc(const std::string &);
+    void copy(LineSearch *);
+  public:
+    ~AdaptiveNewton(void);
+
+    int solveCurrentStep(void);
+
+    int getMaxDimension(void) const;
+    void setMaxDimension(const int &);
+    double getMaxContraction(void) const;
+    void setMaxContraction(const double &);
+    double getDivergenceRatio(void) const;
+    void setDivergenceRatio(const double &);
+    bool getUseCostModel(void) const;
+    void setUseCostModel(const bool &);
+    void setLineSearch(const std::string &);
+    bool hasLineSearch(void) const;
+
+    size_t getNumRefactorizations(void) const;
+    size_t getNumKrylovIterations(void) const;
+    size_t getNumLineSearches(void) const;
+    void resetStatistics(void);
+
+    virtual int sendSelf(CommParameters &);
+    virtual int recvSelf(const CommParameters &);
+    void Print(std::ostream &s, int flag =0);
+  };
+
+inline SolutionAlgorithm *AdaptiveNewton::getCopy(void) const
+  { return new AdaptiveNewton(*this); }
+
+} // end of XC namespace
+
+#endif
@@ -83,6 +83,7 @@ class Vector;
 class BisectionLineSearch: public LineSearch
   {
     friend class NewtonLineSearch;
+    friend class AdaptiveNewton;
     friend class FEM_ObjectBroker;
     BisectionLineSearch(void);
     LineSearch *getCopy(void) const;
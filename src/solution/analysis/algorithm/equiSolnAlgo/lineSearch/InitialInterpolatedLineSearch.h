@@ -76,6 +76,7 @@ class InitialInterpolatedLineSearch: public LineSearch
   {
     friend class FEM_ObjectBroker;
     friend class NewtonLineSearch;
+    friend class AdaptiveNewton;
     InitialInterpolatedLineSearch(void);
     LineSearch *getCopy(void) const;
   public:
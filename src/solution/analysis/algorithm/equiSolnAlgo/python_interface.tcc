@@ -23,6 +23,19 @@
 
 class_<XC::EquiSolnAlgo, bases<XC::SolutionAlgorithm>, boost::noncopyable >("EquiSolnAlgo", no_init);
 
+class_<XC::AdaptiveNewton, bases<XC::EquiSolnAlgo>, boost::noncopyable >("AdaptiveNewton", no_init)
+  .add_property("maxDimension", &XC::AdaptiveNewton::getMaxDimension, &XC::AdaptiveNewton::setMaxDimension, "Maximum dimension of the Krylov subspace used with the last factorization.")
+  .add_property("maxContraction", &XC::AdaptiveNewton::getMaxContraction, &XC::AdaptiveNewton::setMaxContraction, "Contraction ratio |R_k|/|R_{k-1}| over which the tangent is refactored.")
+  .add_property("divergenceRatio", &XC::AdaptiveNewton::getDivergenceRatio, &XC::AdaptiveNewton::setDivergenceRatio, "Ratio |R_k|/|R_{k-1}| over which the iterations are considered divergent.")
+  .add_property("useCostModel", &XC::AdaptiveNewton::getUseCostModel, &XC::AdaptiveNewton::setUseCostModel, "If true, use the measured costs to decide when to refactor the tangent.")
+  .def("setLineSearch", &XC::AdaptiveNewton::setLineSearch, "setLineSearch(name): set the line search to use when the iterations diverge ('bisection_line_search', 'initial_interpolated_line_search', 'regula_falsi_line_search' or 'secant_line_search'); any other name removes the line search.")
+  .add_property("hasLineSearch", &XC::AdaptiveNewton::hasLineSearch, "Return true if a line search has been defined.")
+  .add_property("numRefactorizations", &XC::AdaptiveNewton::getNumRefactorizations, "Number of times the tangent has been formed.")
+  .add_property("numKrylovIterations", &XC::AdaptiveNewton::getNumKrylovIterations, "Number of iterations that reused the last factorization.")
+  .add_property("numLineSearches", &XC::AdaptiveNewton::getNumLineSearches, "Number of line searches performed.")
+  .def("resetStatistics", &XC::AdaptiveNewton::resetStatistics, "Reset the counters of refactorizations, Krylov iterations and line searches.")
+  ;
+
 class_<XC::EquiSolnConvAlgo, bases<XC::EquiSolnAlgo>, boost::noncopyable >("EquiSolnConvAlgo", no_init);
 
 class_<XC::BFBRoydenBase, bases<XC::EquiSolnConvAlgo>, boost::noncopyable >("BFBRoydenBase", no_init);
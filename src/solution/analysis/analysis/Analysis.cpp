@@ -66,6 +66,9 @@
 #include "solution/AnalysisAggregation.h"
 #include "solution/ProcSolu.h"
 #include "solution/analysis/model/AnalysisModel.h"
+#include "solution/analysis/handler/ConstraintHandler.h"
+#include "solution/analysis/integrator/IncrementalIntegrator.h"
+#include "domain/domain/Domain.h"
 
 
 
@@ -79,6 +82,42 @@ XC::Analysis::Analysis(AnalysisAggregation *s)
 int XC::Analysis::newStepDomain(AnalysisModel *theModel,const double &dT)
   { return theModel->newStepDomain(dT); }
 
+//! @brief Deals with a change of the domain stamp.
+//!
+//! If the topology of the model has not changed since the stamp passed as
+//! parameter (only the single freedom constraints have changed, see
+//! Domain::domainConstraintChange) the constraint handler is asked to
+//! update the objects that enforce those constraints, keeping the
+//! FE_Elements, the DOF_Groups, the DOF numbering and the size of the
+//! system of equations. Otherwise (or if the handler can't do it)
+//! domainChanged() is invoked to rebuild the analysis model.
+//!
+//! @param lastStamp: domain stamp at the last call to domainChanged().
+int XC::Analysis::updateAfterDomainChange(const int &lastStamp)
+  {
+    const Domain *theDomain= getDomainPtr();
+    if((lastStamp>0) && (theDomain->getTopologyChangeStamp()<=lastStamp))
+      {
+        ConstraintHandler *theHandler= getConstraintHandlerPtr();
+        const int result= (theHandler ? theHandler->updateSPs() : 1);
+        if(result==0)
+          {
+            IncrementalIntegrator *theIntegrator= getIncrementalIntegratorPtr();
+            if(theIntegrator)
+              theIntegrator->updateTangentCacheFEs();
+            return 0;
+          }
+        else if(result<0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; ConstraintHandler::updateSPs() failed."
+                      << std::endl;
+            return result;
+          }
+      }
+    return domainChanged();
+  }
+
 XC::ProcSolu *XC::Analysis::getProcSolu(void)
   { return dynamic_cast<ProcSolu *>(Owner()); }
 
@@ -120,6 +120,7 @@ class Analysis: public CommandEntity
     AnalysisAggregation *solution_method; //!< Solution method.
 
     int newStepDomain(AnalysisModel *theModel,const double &dT =0.0);
+    int updateAfterDomainChange(const int &);
     ProcSolu *getProcSolu(void);
     const ProcSolu *getProcSolu(void) const;    
 
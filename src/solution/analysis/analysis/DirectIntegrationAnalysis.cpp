@@ -121,8 +121,9 @@ int XC::DirectIntegrationAnalysis::initialize(void)
     int stamp = the_Domain->hasDomainChanged();
     if(stamp != domainStamp)
       {
+        const int lastStamp= domainStamp;
         domainStamp = stamp;	
-        if(this->domainChanged() < 0)
+        if(this->updateAfterDomainChange(lastStamp) < 0)
           {
 	    std::cerr << getClassName() << "::" << __FUNCTION__
 		      << "; domainChanged() failed\n";
@@ -171,6 +172,7 @@ int XC::DirectIntegrationAnalysis::analyze(int numSteps, double dT)
 		      << the_Domain->getTimeTracker().getCurrentTime()
 		      << std::endl;
 	    the_Domain->revertToLastCommit();
+	    the_Domain->flushRecorders();
 	    return -2;
           }
 
@@ -178,11 +180,13 @@ int XC::DirectIntegrationAnalysis::analyze(int numSteps, double dT)
         int stamp = the_Domain->hasDomainChanged();
         if(stamp != domainStamp)
           {
+	    const int lastStamp= domainStamp;
 	    domainStamp = stamp;	
-	    if(this->domainChanged() < 0)
+	    if(this->updateAfterDomainChange(lastStamp) < 0)
               {
 	        std::cerr << getClassName() << "::" << __FUNCTION__
 			  << "; domainChanged() failed\n";
+	        the_Domain->flushRecorders();
 	        return -1;
               }	
           }
@@ -194,6 +198,7 @@ int XC::DirectIntegrationAnalysis::analyze(int numSteps, double dT)
 		      << the_Domain->getTimeTracker().getCurrentTime()
 		      << std::endl;
 	    the_Domain->revertToLastCommit();
+	    the_Domain->flushRecorders();
 	    return -2;
           }
 
@@ -206,6 +211,7 @@ int XC::DirectIntegrationAnalysis::analyze(int numSteps, double dT)
 		      << std::endl;
 	    the_Domain->revertToLastCommit();	    
 	    solution_method->getTransientIntegratorPtr()->revertToLastStep();
+	    the_Domain->flushRecorders();
 	    return -3;
           }    
 
@@ -224,6 +230,7 @@ int XC::DirectIntegrationAnalysis::analyze(int numSteps, double dT)
 			  << std::endl;
 	        the_Domain->revertToLastCommit();	    
 	        solution_method->getTransientIntegratorPtr()->revertToLastStep();
+	        the_Domain->flushRecorders();
 	        return -5;
 	      }
           }
@@ -239,10 +246,12 @@ int XC::DirectIntegrationAnalysis::analyze(int numSteps, double dT)
 		      << std::endl;
 	    the_Domain->revertToLastCommit();	    
 	    solution_method->getTransientIntegratorPtr()->revertToLastStep();
+	    the_Domain->flushRecorders();
 	    return -4;
           }
       }    
     solution_method->set_owner(old);
+    the_Domain->flushRecorders(); // write the pending recorder data.
     return result;
   }
 
@@ -493,8 +502,9 @@ int XC::DirectIntegrationAnalysis::checkDomainChange(void)
     int stamp = the_Domain->hasDomainChanged();
     if(stamp != domainStamp)
       {
+        const int lastStamp= domainStamp;
         domainStamp = stamp;	
-        if(this->domainChanged() < 0)
+        if(this->updateAfterDomainChange(lastStamp) < 0)
           {
             std::cerr << getClassName() << "::" << __FUNCTION__
 		      << "; domainChanged() failed\n";
@@ -102,7 +102,7 @@ XC::DomainDecompositionAnalysis::DomainDecompositionAnalysis(Subdomain &subDomai
     MovableObject(DomDecompANALYSIS_TAGS_DomainDecompositionAnalysis),
     theSubdomain(&subDomain),
     theSolver(nullptr),
-    numEqn(0),numExtEqn(0),tangFormed(false),tangFormedCount(0),
+    numEqn(0),numExtEqn(0),tangFormed(false),tangFormedCount(0),condensationPending(false),
     domainStamp(0)
   {
     theSubdomain->setDomainDecompAnalysis(*this);
@@ -118,7 +118,7 @@ XC::DomainDecompositionAnalysis::DomainDecompositionAnalysis(Subdomain &subDomai
     MovableObject(DomDecompANALYSIS_TAGS_DomainDecompositionAnalysis),
     theSubdomain(&subDomain),
     theSolver(&theSlvr),
-    numEqn(0),numExtEqn(0),tangFormed(false),tangFormedCount(0),
+    numEqn(0),numExtEqn(0),tangFormed(false),tangFormedCount(0),condensationPending(false),
     domainStamp(0)
   {
     theSubdomain->setDomainDecompAnalysis(*this);
@@ -133,7 +133,7 @@ XC::DomainDecompositionAnalysis::DomainDecompositionAnalysis(int clsTag, Subdoma
   : Analysis(s),
     MovableObject(clsTag),
     theSubdomain(&subDomain),
-    theSolver(nullptr), numEqn(0),numExtEqn(0),tangFormed(false),tangFormedCount(0),
+    theSolver(nullptr), numEqn(0),numExtEqn(0),tangFormed(false),tangFormedCount(0),condensationPending(false),
     domainStamp(0) {}
 
 //! @brief Constructor.
@@ -146,7 +146,7 @@ XC::DomainDecompositionAnalysis::DomainDecompositionAnalysis(int clsTag, Subdoma
   : Analysis(s),
     MovableObject(clsTag),
     theSubdomain(&theDomain),
-    theSolver(&theSolver), numEqn(0),numExtEqn(0),tangFormed(false),tangFormedCount(0),
+    theSolver(&theSolver), numEqn(0),numExtEqn(0),tangFormed(false),tangFormedCount(0),condensationPending(false),
     domainStamp(0) {}
 
 //! @brief Virtual constructor.
@@ -250,6 +250,7 @@ int XC::DomainDecompositionAnalysis::domainChanged(void)
 
     tangFormed= false;
     tangFormedCount= 0;
+    condensationPending= false;
     
     return 0;
   }
@@ -274,6 +275,21 @@ int XC::DomainDecompositionAnalysis::newStep(double dT)
 int XC::DomainDecompositionAnalysis::computeInternalResponse(void)
   {  return getDomainDecompSolutionAlgorithmPtr()->solveCurrentStep(); }
 
+//! @brief First step of computeInternalResponse (see
+//! DomainDecompAlgo::setExternalResponse).
+int XC::DomainDecompositionAnalysis::setExternalResponse(void)
+  {  return getDomainDecompSolutionAlgorithmPtr()->setExternalResponse(); }
+
+//! @brief Second step of computeInternalResponse (see
+//! DomainDecompAlgo::solveInternalResponse).
+int XC::DomainDecompositionAnalysis::solveInternalResponse(void)
+  {  return getDomainDecompSolutionAlgorithmPtr()->solveInternalResponse(); }
+
+//! @brief Last step of computeInternalResponse (see
+//! DomainDecompAlgo::updateInternalResponse).
+int XC::DomainDecompositionAnalysis::updateInternalResponse(void)
+  {  return getDomainDecompSolutionAlgorithmPtr()->updateInternalResponse(); }
+
 
 
 //! @brief Assembles the tangent stiffness matrix.
@@ -292,6 +308,17 @@ int XC::DomainDecompositionAnalysis::computeInternalResponse(void)
 //! condenseA()} method returns a negative number this number is
 //! returned.  
 int XC::DomainDecompositionAnalysis::formTangent(void)
+  {
+    int result= assembleTangent();
+    if(result < 0)
+      return result;
+    return condenseTangent();
+  }
+
+//! @brief First step of formTangent: checks if the domain has
+//! changed and assembles the tangent of the subdomain (if
+//! not already formed for the current state).
+int XC::DomainDecompositionAnalysis::assembleTangent(void)
   {
     int result =0;
 
@@ -309,12 +336,27 @@ int XC::DomainDecompositionAnalysis::formTangent(void)
     // called for this state by formResidual() or formTangVectProduct()
     // so we won't be doing it again.
 
+    condensationPending= false;
     if(tangFormedCount != -1)
       {
 	result= getIncrementalIntegratorPtr()->formTangent();
 	if(result < 0)
 	  return result;
+        condensationPending= true;
+      }
+    return result;
+  }
+
+//! @brief Second step of formTangent: condenses the tangent
+//! assembled by assembleTangent. This step only uses the data of the
+//! solver, so it can be performed concurrently for different subdomains.
+int XC::DomainDecompositionAnalysis::condenseTangent(void)
+  {
+    int result =0;
+    if(condensationPending)
+      {
 	result= theSolver->condenseA(numEqn-numExtEqn);
+        condensationPending= false;
 	if(result < 0)
 	  return result;
       }
@@ -339,6 +381,16 @@ int XC::DomainDecompositionAnalysis::formTangent(void)
 //! the negative number that was returned if either formUnbalance()}
 //! or {\em condenseRHS() failed.
 int XC::DomainDecompositionAnalysis::formResidual(void)
+  {
+    int result= assembleResidual();
+    if(result < 0)
+      return result;
+    return condenseResidual();
+  }
+
+//! @brief First step of formResidual: checks if the domain has
+//! changed, forms the tangent if needed and assembles the unbalance.
+int XC::DomainDecompositionAnalysis::assembleResidual(void)
   {
     int result =0;
     Domain *the_Domain= this->getDomainPtr();    
@@ -360,13 +412,15 @@ int XC::DomainDecompositionAnalysis::formResidual(void)
 	                      // is not formed twice at same state
       }
 
-    result= getIncrementalIntegratorPtr()->formUnbalance();
-
-    if(result < 0)
-      return result;
-    return theSolver->condenseRHS(numEqn-numExtEqn);
+    return getIncrementalIntegratorPtr()->formUnbalance();
   }
 
+//! @brief Second step of formResidual: condenses the unbalance
+//! (forward substitution). This step only uses the data of the
+//! solver, so it can be performed concurrently for different subdomains.
+int XC::DomainDecompositionAnalysis::condenseResidual(void)
+  { return theSolver->condenseRHS(numEqn-numExtEqn); }
+
 
 //! @brief form the product of the condensed tangent matrix times the
 //! vector \f$u\f$.
@@ -102,6 +102,7 @@ class DomainDecompositionAnalysis: public Analysis, public MovableObject
     // before being asked to form Residual(). 
     bool tangFormed; //!< True if the tangent stiffness matrix is already formed.
     int tangFormedCount; //!< saves the expense of computing formTangent() for same state of Subdomain.
+    bool condensationPending; //!< true if the tangent has been assembled but not condensed yet.
   protected:
     int domainStamp;
     //! @brief Returns a pointer to the subdomain.
@@ -136,6 +137,16 @@ class DomainDecompositionAnalysis: public Analysis, public MovableObject
     virtual int  formTangent(void);
     virtual int  formResidual(void);
     virtual int  formTangVectProduct(Vector &force);
+
+    // steps of formTangent, formResidual and computeInternalResponse
+    // (see PartitionedDomain).
+    int assembleTangent(void);
+    int condenseTangent(void);
+    int assembleResidual(void);
+    int condenseResidual(void);
+    int setExternalResponse(void);
+    int solveInternalResponse(void);
+    int updateInternalResponse(void);
     virtual const Matrix &getTangent(void);
     virtual const Vector &getResidual(void);
     virtual const Vector &getTangVectProduct(void);
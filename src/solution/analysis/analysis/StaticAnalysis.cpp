@@ -141,8 +141,9 @@ int XC::StaticAnalysis::check_domain_change(int num_step,int numSteps)
 
     if(stamp != domainStamp)
       {
+        const int lastStamp= domainStamp;
         domainStamp= stamp;
-        result= domainChanged();
+        result= updateAfterDomainChange(lastStamp);
 
         if(result < 0)
           {
@@ -303,6 +304,7 @@ int XC::StaticAnalysis::analyze(int numSteps)
           break;
       }
     solution_method->set_owner(old);
+    getDomainPtr()->flushRecorders(); // write the pending recorder data.
     return result;
   }
 
@@ -314,8 +316,9 @@ int XC::StaticAnalysis::initialize(void)
     int stamp= the_Domain->hasDomainChanged();
     if(stamp != domainStamp)
       {
+        const int lastStamp= domainStamp;
         domainStamp= stamp;
-        if(this->domainChanged() < 0)
+        if(this->updateAfterDomainChange(lastStamp) < 0)
           {
             std::cerr << getClassName() << "::" << __FUNCTION__
 		      << "; domainChanged() failed\n";
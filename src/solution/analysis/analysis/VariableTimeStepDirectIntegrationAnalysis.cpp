@@ -65,12 +65,187 @@
 #include <solution/analysis/integrator/TransientIntegrator.h>
 #include <domain/domain/Domain.h>
 #include <solution/analysis/convergenceTest/ConvergenceTest.h>
+#include "domain/mesh/node/Node.h"
+#include "domain/mesh/node/NodeIter.h"
 #include <cfloat>
+#include <cmath>
+#include <algorithm>
 #include "solution/AnalysisAggregation.h"
+#include "utility/xc_python_utils.h"
 
 //! @brief Constructor.
 XC::VariableTimeStepDirectIntegrationAnalysis::VariableTimeStepDirectIntegrationAnalysis(AnalysisAggregation *analysis_aggregation)
-  :DirectIntegrationAnalysis(analysis_aggregation) {}    
+  :DirectIntegrationAnalysis(analysis_aggregation), errorTolerance(0.0),
+   safetyFactor(0.9), maxGrowthFactor(2.0), minShrinkFactor(0.2),
+   deadBand(0.2), nextOutput(0) {}    
+
+//! @brief Set the tolerance for the local truncation error. If the
+//! value is zero (default) the time step is controlled by the number
+//! of iterations of the last step (see determineDt).
+void XC::VariableTimeStepDirectIntegrationAnalysis::setErrorTolerance(const double &d)
+  { errorTolerance= d; }
+
+//! @brief Return the tolerance for the local truncation error.
+double XC::VariableTimeStepDirectIntegrationAnalysis::getErrorTolerance(void) const
+  { return errorTolerance; }
+
+//! @brief Set the safety factor applied to the time step proposed
+//! by the error estimator.
+void XC::VariableTimeStepDirectIntegrationAnalysis::setSafetyFactor(const double &d)
+  { safetyFactor= d; }
+
+//! @brief Return the safety factor.
+double XC::VariableTimeStepDirectIntegrationAnalysis::getSafetyFactor(void) const
+  { return safetyFactor; }
+
+//! @brief Set the maximum ratio between two consecutive time steps.
+void XC::VariableTimeStepDirectIntegrationAnalysis::setMaxGrowthFactor(const double &d)
+  { maxGrowthFactor= d; }
+
+//! @brief Return the maximum ratio between two consecutive time steps.
+double XC::VariableTimeStepDirectIntegrationAnalysis::getMaxGrowthFactor(void) const
+  { return maxGrowthFactor; }
+
+//! @brief Set the minimum ratio between two consecutive time steps.
+void XC::VariableTimeStepDirectIntegrationAnalysis::setMinShrinkFactor(const double &d)
+  { minShrinkFactor= d; }
+
+//! @brief Return the minimum ratio between two consecutive time steps.
+double XC::VariableTimeStepDirectIntegrationAnalysis::getMinShrinkFactor(void) const
+  { return minShrinkFactor; }
+
+//! @brief Set the relative change of the time step below which the
+//! time step is kept unchanged (avoids changing the effective
+//! stiffness of the integrator on each step).
+void XC::VariableTimeStepDirectIntegrationAnalysis::setDeadBand(const double &d)
+  { deadBand= d; }
+
+//! @brief Return the dead band.
+double XC::VariableTimeStepDirectIntegrationAnalysis::getDeadBand(void) const
+  { return deadBand; }
+
+//! @brief Set the times where the recorders will be called. If the
+//! container is empty (default) the recorders are called at the end
+//! of each step.
+void XC::VariableTimeStepDirectIntegrationAnalysis::setOutputTimes(const std::vector<double> &v)
+  {
+    outputTimes= v;
+    std::sort(outputTimes.begin(),outputTimes.end());
+    nextOutput= 0;
+  }
+
+//! @brief Set the output times from a Python list.
+void XC::VariableTimeStepDirectIntegrationAnalysis::setOutputTimesPy(const boost::python::list &l)
+  { setOutputTimes(vector_double_from_py_object(l)); }
+
+//! @brief Return the times where the recorders will be called.
+const std::vector<double> &XC::VariableTimeStepDirectIntegrationAnalysis::getOutputTimes(void) const
+  { return outputTimes; }
+
+//! @brief Store the committed state of the nodes at the beginning
+//! of the step.
+void XC::VariableTimeStepDirectIntegrationAnalysis::storePreviousState(Domain *theDom)
+  {
+    previousState.clear();
+    Node *theNode= nullptr;
+    NodeIter &theNodes= theDom->getNodes();
+    while((theNode= theNodes()) != nullptr)
+      {
+        NodeState ns;
+        ns.node= theNode;
+        ns.disp= theNode->getDisp();
+        ns.vel= theNode->getVel();
+        ns.accel= theNode->getAccel();
+        previousState.push_back(ns);
+      }
+  }
+
+//! @brief Store the trial state of the nodes (the setTrialDisp calls of
+//! the interpolation would modify it otherwise).
+void XC::VariableTimeStepDirectIntegrationAnalysis::storeTrialState(std::vector<NodeState> &state) const
+  {
+    state.clear();
+    for(std::vector<NodeState>::const_iterator i= previousState.begin();i!=previousState.end();i++)
+      {
+        const Node *theNode= i->node;
+        NodeState ns;
+        ns.node= i->node;
+        ns.disp= theNode->getTrialDisp();
+        ns.incrDeltaDisp= theNode->getIncrDeltaDisp();
+        ns.vel= theNode->getTrialVel();
+        ns.accel= theNode->getTrialAccel();
+        state.push_back(ns);
+      }
+  }
+
+//! @brief Restore the trial state stored by storeTrialState.
+//!
+//! The displacement is set twice so the incremental displacements
+//! (incrDisp and incrDeltaDisp) recover the values they had at the
+//! end of the step.
+void XC::VariableTimeStepDirectIntegrationAnalysis::restoreTrialState(const std::vector<NodeState> &state) const
+  {
+    for(std::vector<NodeState>::const_iterator i= state.begin();i!=state.end();i++)
+      {
+        Node *theNode= i->node;
+        theNode->setTrialDisp(i->disp-i->incrDeltaDisp);
+        theNode->setTrialDisp(i->disp);
+        theNode->setTrialVel(i->vel);
+        theNode->setTrialAccel(i->accel);
+      }
+  }
+
+//! @brief Call the recorders for each output time in the interval (t0,t1].
+//!
+//! The nodal response is interpolated between the state at the beginning
+//! of the step and the just committed one (cubic Hermite interpolation
+//! for displacements, linear for velocities and accelerations). Element
+//! responses correspond to the end of the step.
+//! @param t0: time at the beginning of the step.
+//! @param t1: time at the end of the step.
+void XC::VariableTimeStepDirectIntegrationAnalysis::recordOutputTimes(Domain *theDom,const double &t0,const double &t1)
+  {
+    const double h= t1-t0;
+    const int commitTag= theDom->getCommitTag();
+    const size_t numOutputs= outputTimes.size();
+    // trial state at the end of the step (restored after recording).
+    std::vector<NodeState> endState;
+    while((nextOutput<numOutputs) && (outputTimes[nextOutput]<=t1))
+      {
+        const double tOut= outputTimes[nextOutput];
+        nextOutput++;
+        if(tOut<t0)
+          continue; // before the start of the analysis.
+        const double theta= (h>0.0) ? (tOut-t0)/h : 1.0;
+        if(theta<1.0)
+          {
+            const double theta2= theta*theta;
+            const double theta3= theta2*theta;
+            const double h00= 2.0*theta3-3.0*theta2+1.0;
+            const double h10= theta3-2.0*theta2+theta;
+            const double h01= -2.0*theta3+3.0*theta2;
+            const double h11= theta3-theta2;
+            if(endState.empty())
+              storeTrialState(endState);
+            for(std::vector<NodeState>::const_iterator i= previousState.begin();i!=previousState.end();i++)
+              {
+                Node *theNode= i->node;
+                const Vector &d1= theNode->getDisp();
+                const Vector &v1= theNode->getVel();
+                const Vector &a1= theNode->getAccel();
+                theNode->setTrialDisp(h00*i->disp+(h10*h)*i->vel+h01*d1+(h11*h)*v1);
+                theNode->setTrialVel((1.0-theta)*i->vel+theta*v1);
+                theNode->setTrialAccel((1.0-theta)*i->accel+theta*a1);
+              }
+            theDom->setCurrentTime(tOut);
+            theDom->record(commitTag,tOut);
+            restoreTrialState(endState);
+            theDom->setCurrentTime(t1);
+          }
+        else
+          theDom->record(commitTag,tOut);
+      }
+  }
 
 //! @brief Performs the analysis.
 //! 
@@ -95,6 +270,17 @@ int XC::VariableTimeStepDirectIntegrationAnalysis::analyze(int numSteps, double
     double totalTimeIncr = numSteps * dT;
     double currentTimeIncr = 0.0;
     double currentDt = dT;
+    double eta= 0.0; // estimated local truncation error.
+    // error control (may be disabled below if the integrator
+    // doesn't provide an error estimate).
+    bool errorControl= (errorTolerance>0.0);
+
+    // if output times are defined the recorders are called from
+    // recordOutputTimes instead of from Domain::commit.
+    const bool interpolateOutput= !outputTimes.empty();
+    const bool recordOnCommit= theDom->getRecordOnCommit();
+    if(interpolateOutput)
+      theDom->setRecordOnCommit(false);
   
     // loop until analysis has performed the total time incr requested
     while(currentTimeIncr < totalTimeIncr)
@@ -104,9 +290,15 @@ int XC::VariableTimeStepDirectIntegrationAnalysis::analyze(int numSteps, double
           {
             std::cerr << getClassName() << "::" << __FUNCTION__
 		      << "; failed checkDomainChange\n";
+            theDom->setRecordOnCommit(recordOnCommit);
+            solution_method->set_owner(old);
             return -1;
           }
 
+        const double t0= theDom->getTimeTracker().getCommittedTime();
+        if(interpolateOutput)
+          storePreviousState(theDom);
+
         //
         // do newStep(), solveCurrentStep() and commit() as in regular
         // DirectINtegrationAnalysis - difference is we do not return
@@ -123,6 +315,34 @@ int XC::VariableTimeStepDirectIntegrationAnalysis::analyze(int numSteps, double
 	      result = -3;
           }    
 
+        // error control: reject the step if the estimated local
+        // truncation error exceeds the tolerance.
+        if((result >= 0) && errorControl)
+          {
+            eta= theIntegratr->getLocalTruncationError();
+            if(eta<0.0)
+              {
+                std::cerr << getClassName() << "::" << __FUNCTION__
+			  << "; the integrator doesn't provide an"
+		          << " error estimate. Error control ignored."
+			  << std::endl;
+                errorControl= false;
+              }
+            else if(eta>errorTolerance)
+              {
+                if(currentDt <= dtMin) // can't reduce the step: accept it.
+                  std::cerr << getClassName() << "::" << __FUNCTION__
+			    << "; at time "
+			    << theDom->getTimeTracker().getCurrentTime()
+			    << " the estimated error: " << eta
+			    << " exceeds the tolerance: " << errorTolerance
+			    << " with the minimum time step: " << dtMin
+			    << ". Step accepted." << std::endl;
+                else
+                  result= -5;
+              }
+          }
+
         if(result >= 0)
           {
             result = theIntegratr->commit();
@@ -133,8 +353,12 @@ int XC::VariableTimeStepDirectIntegrationAnalysis::analyze(int numSteps, double
         // if the time step was successfull increment delta T for the analysis
         // othewise revert the XC::Domain to last committed state & see if can go on
 
-        if(result >= 0) 
-          currentTimeIncr += currentDt;
+        if(result >= 0)
+          {
+            currentTimeIncr += currentDt;
+            if(interpolateOutput)
+              recordOutputTimes(theDom,t0,theDom->getTimeTracker().getCommittedTime());
+          }
         else
           {
             // invoke the revertToLastCommit
@@ -148,18 +372,62 @@ int XC::VariableTimeStepDirectIntegrationAnalysis::analyze(int numSteps, double
 			  << "; failed at time "
 			  << theDom->getTimeTracker().getCurrentTime()
 			  << std::endl;
+                theDom->setRecordOnCommit(recordOnCommit);
+                solution_method->set_owner(old);
+                theDom->flushRecorders();
                 return result;
               }
-            // if still here reset result for next loop
-            result = 0;
           }
         // now we determine a new_ delta T for next loop
-        currentDt = this->determineDt(currentDt, dtMin, dtMax, Jd, theTest);
+        if(errorControl)
+          {
+            if(result==-5) // rejected by error control.
+              currentDt= this->determineDtFromError(currentDt, dtMin, dtMax, eta);
+            else if(result<0) // not converged.
+              currentDt= std::max(currentDt*minShrinkFactor,dtMin-DBL_EPSILON);
+            else
+              currentDt= this->determineDtFromError(currentDt, dtMin, dtMax, eta);
+          }
+        else
+          currentDt = this->determineDt(currentDt, dtMin, dtMax, Jd, theTest);
+        // if still here reset result for next loop
+        result = 0;
       }
+    theDom->setRecordOnCommit(recordOnCommit);
     solution_method->set_owner(old);
+    theDom->flushRecorders(); // write the pending recorder data.
     return 0;
   }
 
+//! @brief Compute the new time step from the estimated local truncation
+//! error of the last step (the error of Newmark-type integrators is
+//! O(dt^3)).
+//!
+//! @param dT: last time increment.
+//! @param dtMin: minimum value for the time increment.
+//! @param dtMax: maximum value for the time increment.
+//! @param eta: estimated local truncation error of the last step.
+double XC::VariableTimeStepDirectIntegrationAnalysis::determineDtFromError(double dT, double dtMin, double dtMax, const double &eta) const
+  {
+    double factor= maxGrowthFactor;
+    if(eta>0.0)
+      factor= safetyFactor*std::pow(errorTolerance/eta,1.0/3.0);
+    factor= std::max(minShrinkFactor,std::min(factor,maxGrowthFactor));
+    // keep the time step (and so the effective stiffness) if the
+    // change is small and the error is under control.
+    if((eta<=errorTolerance) && (std::fabs(factor-1.0)<deadBand))
+      factor= 1.0;
+    double newDt= dT*factor;
+
+    // ensure: dtMin <~~ dT <= dtMax
+    if(newDt < dtMin)
+      newDt = dtMin - DBL_EPSILON;  // to ensure we get out of the analysis 
+                               // loop if can't converge on next step
+    else if(newDt > dtMax)
+      newDt = dtMax;
+    return newDt;
+  }
+
 //! @brief 
 double XC::VariableTimeStepDirectIntegrationAnalysis::determineDt(double dT, double dtMin, double dtMax, int Jd, ConvergenceTest *theTest)
   {
@@ -66,10 +66,14 @@
 // What: "@(#) VariableTimeStepDirectIntegrationAnalysis.h, revA"
 
 #include <solution/analysis/analysis/DirectIntegrationAnalysis.h>
+#include "utility/matrix/Vector.h"
+#include <vector>
 
 namespace XC {
 class TransientIntegrator;
 class ConvergenceTest;
+class Domain;
+class Node;
 
 //! @ingroup AnalysisType
 //
@@ -78,12 +82,49 @@ class ConvergenceTest;
 class VariableTimeStepDirectIntegrationAnalysis: public DirectIntegrationAnalysis
   {
   protected:
+    //! @brief State of a node (used to interpolate the response
+    //! at the output times).
+    struct NodeState
+      {
+        Node *node; //!< node pointer.
+        Vector disp; //!< displacement.
+        Vector incrDeltaDisp; //!< displacement increment from the last iteration (trial state only).
+        Vector vel; //!< velocity.
+        Vector accel; //!< acceleration.
+      };
+    double errorTolerance; //!< tolerance for the local truncation error (0: control by number of iterations).
+    double safetyFactor; //!< safety factor for the time step proposed by the error estimator.
+    double maxGrowthFactor; //!< maximum ratio between two consecutive time steps.
+    double minShrinkFactor; //!< minimum ratio between two consecutive time steps.
+    double deadBand; //!< relative change below which the time step is kept unchanged.
+    std::vector<double> outputTimes; //!< times where the recorders are called (empty: call them each step).
+    std::vector<NodeState> previousState; //!< nodal state at the beginning of the step.
+    size_t nextOutput; //!< index of the next output time.
+
     virtual double determineDt(double dT, double dtMin, double dtMax, int Jd,ConvergenceTest *theTest);
+    double determineDtFromError(double dT, double dtMin, double dtMax, const double &eta) const;
+    void storePreviousState(Domain *);
+    void storeTrialState(std::vector<NodeState> &) const;
+    void restoreTrialState(const std::vector<NodeState> &) const;
+    void recordOutputTimes(Domain *,const double &t0,const double &t1);
 
     friend class ProcSolu;
     VariableTimeStepDirectIntegrationAnalysis(AnalysisAggregation *analysis_aggregation);
     Analysis *getCopy(void) const;
   public:
+    void setErrorTolerance(const double &);
+    double getErrorTolerance(void) const;
+    void setSafetyFactor(const double &);
+    double getSafetyFactor(void) const;
+    void setMaxGrowthFactor(const double &);
+    double getMaxGrowthFactor(void) const;
+    void setMinShrinkFactor(const double &);
+    double getMinShrinkFactor(void) const;
+    void setDeadBand(const double &);
+    double getDeadBand(void) const;
+    void setOutputTimes(const std::vector<double> &);
+    void setOutputTimesPy(const boost::python::list &);
+    const std::vector<double> &getOutputTimes(void) const;
 
     int analyze(int numSteps, double dT, double dtMin, double dtMax, int Jd);
   };
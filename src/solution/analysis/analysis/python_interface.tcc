@@ -87,7 +87,16 @@ class_<XC::TransientAnalysis, bases<XC::Analysis>, boost::noncopyable >("Transie
 
 class_<XC::DirectIntegrationAnalysis, bases<XC::TransientAnalysis>, boost::noncopyable >("DirectIntegrationAnalysis", no_init);
 
-class_<XC::VariableTimeStepDirectIntegrationAnalysis, bases<XC::DirectIntegrationAnalysis>, boost::noncopyable >("VariableTimeStepDirectIntegrationAnalysis", no_init);
+int (XC::VariableTimeStepDirectIntegrationAnalysis::*analyzeVariableTimeStep)(int, double, double, double, int)= &XC::VariableTimeStepDirectIntegrationAnalysis::analyze;
+class_<XC::VariableTimeStepDirectIntegrationAnalysis, bases<XC::DirectIntegrationAnalysis>, boost::noncopyable >("VariableTimeStepDirectIntegrationAnalysis", no_init)
+  .def("analyze", analyzeVariableTimeStep,"analyze(nSteps,dT,dtMin,dtMax,Jd) performs the analysis; the time step changes with the number of iterations (Jd: desired number of iterations) or, if errorTolerance is not zero, with the estimated local truncation error.")
+  .add_property("errorTolerance", &XC::VariableTimeStepDirectIntegrationAnalysis::getErrorTolerance, &XC::VariableTimeStepDirectIntegrationAnalysis::setErrorTolerance,"tolerance for the local truncation error (0: time step controlled by the number of iterations).")
+  .add_property("safetyFactor", &XC::VariableTimeStepDirectIntegrationAnalysis::getSafetyFactor, &XC::VariableTimeStepDirectIntegrationAnalysis::setSafetyFactor,"safety factor for the time step proposed by the error estimator.")
+  .add_property("maxGrowthFactor", &XC::VariableTimeStepDirectIntegrationAnalysis::getMaxGrowthFactor, &XC::VariableTimeStepDirectIntegrationAnalysis::setMaxGrowthFactor,"maximum ratio between two consecutive time steps.")
+  .add_property("minShrinkFactor", &XC::VariableTimeStepDirectIntegrationAnalysis::getMinShrinkFactor, &XC::VariableTimeStepDirectIntegrationAnalysis::setMinShrinkFactor,"minimum ratio between two consecutive time steps.")
+  .add_property("deadBand", &XC::VariableTimeStepDirectIntegrationAnalysis::getDeadBand, &XC::VariableTimeStepDirectIntegrationAnalysis::setDeadBand,"relative change below which the time step is kept unchanged.")
+  .def("setOutputTimes", &XC::VariableTimeStepDirectIntegrationAnalysis::setOutputTimesPy,"setOutputTimes([t1,t2,...]) call the recorders at the given times (nodal response interpolated) instead of at the end of each step.")
+  ;
 
 #ifdef _PARALLEL_PROCESSING
 class_<XC::DomainDecompositionAnalysis, bases<XC::Analysis, XC::MovableObject>, boost::noncopyable >("DomainDecompositionAnalysis", no_init);
@@ -71,7 +71,7 @@
 //! @param classTag: class identifier.
 XC::ConvergenceTest::ConvergenceTest(CommandEntity *owr,int classTag)
   :MovableObject(classTag), EntityWithOwner(owr), currentIter(0), maxNumIter(0),
-   printFlag(0), nType(2), norms(1), lastRatio(0.0), calculatedNormX(0.0), calculatedNormB(0.0) {}
+   printFlag(0), nType(2), norms(1), lastRatio(0.0), calculatedNormX(0.0), calculatedNormB(0.0), algorithmLogMaxSize(1000) {}
 
 //! @brief Constructor.
 //!
@@ -84,7 +84,7 @@ XC::ConvergenceTest::ConvergenceTest(CommandEntity *owr,int classTag)
 //! @param sz_norms: size of the vector that contains computed norms.
 XC::ConvergenceTest::ConvergenceTest(CommandEntity *owr,int classTag,int maxIter,int prtFlg, int normType, int sz_norms)
   :MovableObject(classTag), EntityWithOwner(owr), currentIter(0), maxNumIter(maxIter),
-   printFlag(prtFlg), nType(normType), norms(sz_norms), lastRatio(0.0), calculatedNormX(0.0), calculatedNormB(0.0) {}
+   printFlag(prtFlg), nType(normType), norms(sz_norms), lastRatio(0.0), calculatedNormX(0.0), calculatedNormB(0.0), algorithmLogMaxSize(1000) {}
 
 //! @brief Virtual constructor.
 XC::ConvergenceTest* XC::ConvergenceTest::getCopy(int iterations) const
@@ -284,6 +284,52 @@ std::string XC::ConvergenceTest::getFailedToConvergeMessage(void) const
     return retval.str();
   }
 
+//! @brief Append a decision of the solution algorithm (refactoring
+//! the tangent, enabling a line search,...) to the log. The message
+//! is also printed if the print flag is not zero. If the log is full
+//! the oldest decision is discarded.
+void XC::ConvergenceTest::logAlgorithmDecision(const std::string &msg)
+  {
+    const std::string tmp= "iteration: "+std::to_string(currentIter)+"; "+msg;
+    algorithmLog.push_back(tmp);
+    while(algorithmLog.size()>algorithmLogMaxSize)
+      algorithmLog.pop_front();
+    if(printFlag)
+      std::clog << getClassName() << "::" << __FUNCTION__ << " - "
+                << tmp << std::endl;
+  }
+
+//! @brief Return the decisions logged by the solution algorithm.
+const std::deque<std::string> &XC::ConvergenceTest::getAlgorithmLog(void) const
+  { return algorithmLog; }
+
+//! @brief Return the decisions logged by the solution algorithm
+//! in a Python list.
+boost::python::list XC::ConvergenceTest::getAlgorithmLogPy(void) const
+  {
+    boost::python::list retval;
+    for(std::deque<std::string>::const_iterator i= algorithmLog.begin();i!=algorithmLog.end();i++)
+      retval.append(*i);
+    return retval;
+  }
+
+//! @brief Clear the log of the solution algorithm decisions.
+void XC::ConvergenceTest::clearAlgorithmLog(void)
+  { algorithmLog.clear(); }
+
+//! @brief Return the maximum number of decisions kept in the log.
+size_t XC::ConvergenceTest::getAlgorithmLogMaxSize(void) const
+  { return algorithmLogMaxSize; }
+
+//! @brief Set the maximum number of decisions kept in the log
+//! (the oldest decisions are discarded).
+void XC::ConvergenceTest::setAlgorithmLogMaxSize(const size_t &sz)
+  {
+    algorithmLogMaxSize= sz;
+    while(algorithmLog.size()>algorithmLogMaxSize)
+      algorithmLog.pop_front();
+  }
+
 //! @brief Returns a string with the values of x and b vectors.
 std::string XC::ConvergenceTest::getDeltaXRMessage(void) const
   {
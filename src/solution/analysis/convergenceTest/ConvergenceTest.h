@@ -64,6 +64,8 @@
 #include "xc_utils/src/kernel/EntityWithOwner.h"
 #include "utility/matrix/Vector.h"
 #include "solution/system_of_eqn/linearSOE/LinearSOE.h"
+#include <deque>
+#include <boost/python/list.hpp>
 
 namespace XC {
 class EquiSolnAlgo;
@@ -93,6 +95,8 @@ class ConvergenceTest: public MovableObject, public EntityWithOwner
     mutable double calculatedNormX; //!< Last calculated |x|
     mutable double calculatedNormB; //!< Last calculated |b|
     mutable double calculatedEnergyProduct; //!< Last calculated |0.5*(x ^ b)|.
+    std::deque<std::string> algorithmLog; //!< Decisions taken by the solution algorithm.
+    size_t algorithmLogMaxSize; //!< Maximum number of decisions kept in the log (the oldest ones are discarded).
 
     bool hasLinearSOE(void) const;
     LinearSOE *getLinearSOEPtr(void);
@@ -148,6 +152,13 @@ class ConvergenceTest: public MovableObject, public EntityWithOwner
     std::string getFailedToConvergeMessage(void) const;
     std::string getDeltaXRMessage(void) const;
     std::string getDeltaXRNormsMessage(void) const;
+
+    void logAlgorithmDecision(const std::string &);
+    const std::deque<std::string> &getAlgorithmLog(void) const;
+    boost::python::list getAlgorithmLogPy(void) const;
+    void clearAlgorithmLog(void);
+    size_t getAlgorithmLogMaxSize(void) const;
+    void setAlgorithmLogMaxSize(const size_t &);
   };
 } // end of XC namespace
 
@@ -26,6 +26,9 @@ class_<XC::ConvergenceTest, bases<XC::MovableObject,CommandEntity>, boost::nonco
   .add_property("currentIter", &XC::ConvergenceTest::getCurrentIter, &XC::ConvergenceTest::setCurrentIter)
   .add_property("printFlag", &XC::ConvergenceTest::getPrintFlag, &XC::ConvergenceTest::setPrintFlag)
   .add_property("normType", &XC::ConvergenceTest::getNormType, &XC::ConvergenceTest::setNormType)
+  .add_property("algorithmLog", &XC::ConvergenceTest::getAlgorithmLogPy, "Return the decisions taken by the solution algorithm (if it logs them).")
+  .def("clearAlgorithmLog", &XC::ConvergenceTest::clearAlgorithmLog, "Clear the log of the solution algorithm decisions.")
+  .add_property("algorithmLogMaxSize", &XC::ConvergenceTest::getAlgorithmLogMaxSize, &XC::ConvergenceTest::setAlgorithmLogMaxSize, "Maximum number of decisions kept in the log (the oldest ones are discarded).")
   ;
 
 
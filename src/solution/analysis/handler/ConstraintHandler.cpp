@@ -87,6 +87,18 @@ int XC::ConstraintHandler::doneNumberingDOF(void)
 int XC::ConstraintHandler::update(void)
   { return 0; }
 
+//! @brief Update the objects that enforce the single freedom constraints
+//! after a change that affects only those constraints (see
+//! Domain::domainConstraintChange).
+//!
+//! Returns \f$0\f$ if the objects have been updated without changing the
+//! DOF numbering or the connectivity of the model, a positive number if
+//! the handler can't do that (and the whole model must be rebuilt by
+//! handle()) and a negative number if an error occurs. This base class
+//! always asks for a rebuild.
+int XC::ConstraintHandler::updateSPs(void)
+  { return 1; }
+
 //! @brief ??
 int XC::ConstraintHandler::applyLoad(void)
   { return 0; }
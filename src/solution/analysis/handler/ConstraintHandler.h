@@ -135,6 +135,7 @@ class ConstraintHandler: public MovableObject, public CommandEntity
     //! setFE\_elementPtr}.    
     virtual int handle(const ID *nodesNumberedLast =0) =0;
     virtual int update(void);
+    virtual int updateSPs(void);
     virtual int applyLoad(void);
     virtual int doneNumberingDOF(void);
     virtual void clearAll(void);    
@@ -56,7 +56,10 @@
 
 #include <solution/analysis/handler/PenaltyConstraintHandler.h>
 #include <cstdlib>
+#include <vector>
+#include <algorithm>
 #include <solution/analysis/model/AnalysisModel.h>
+#include <solution/analysis/model/FE_EleIter.h>
 #include <domain/domain/Domain.h>
 #include <solution/analysis/model/fe_ele/FE_Element.h>
 #include <solution/analysis/model/dof_grp/DOF_Group.h>
@@ -226,3 +229,54 @@ int XC::PenaltyConstraintHandler::handle(const ID *nodesLast)
   }
 
 
+
+//! @brief Update the PenaltySFreedom_FE objects after a change that
+//! affects only the single freedom constraints of the domain.
+//!
+//! The PenaltySFreedom\_FE objects are removed from the AnalysisModel and
+//! a new one is created for each SFreedom\_Constraint in the domain. The
+//! remaining FE\_Elements and the DOF\_Groups (and therefore the DOF
+//! numbering) are kept untouched and, since the penalty objects only
+//! contribute to the diagonal of the tangent, so is the sparsity of the
+//! system of equations. Returns \f$1\f$ if the model has not been built
+//! yet (handle() must be called).
+int XC::PenaltyConstraintHandler::updateSPs(void)
+  {
+    Domain *theDomain= this->getDomainPtr();
+    AnalysisModel *theModel= this->getAnalysisModelPtr();
+    if((!theDomain) || (!theModel))
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; domain or model was not set.\n";
+        return -1;
+      }
+    if(theModel->getNumDOF_Groups()==0) // nothing to update.
+      return 1;
+
+    // remove the old PenaltySFreedom_FE objects.
+    std::vector<int> oldSPs;
+    int nextTag= 0;
+    FE_EleIter &theFEs= theModel->getFEs();
+    FE_Element *fePtr= nullptr;
+    while((fePtr= theFEs()) != 0)
+      {
+        const int tag= fePtr->getTag();
+        if(dynamic_cast<PenaltySFreedom_FE *>(fePtr))
+          oldSPs.push_back(tag);
+        nextTag= std::max(nextTag,tag+1);
+      }
+    for(std::vector<int>::const_iterator i= oldSPs.begin();i!=oldSPs.end();i++)
+      theModel->removeFE_Element(*i);
+
+    // create the new ones.
+    int retval= 0;
+    SFreedom_ConstraintIter &theSPs= theDomain->getConstraints().getDomainAndLoadPatternSPs();
+    SFreedom_Constraint *spPtr= nullptr;
+    while((spPtr = theSPs()) != 0)
+      {
+        fePtr= theModel->createPenaltySFreedom_FE(nextTag++, *spPtr, alphaSP);
+        if(!fePtr || (fePtr->setID()<0))
+          retval= -2;
+      }
+    return retval;
+  }
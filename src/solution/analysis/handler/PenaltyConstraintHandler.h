@@ -91,6 +91,7 @@ class PenaltyConstraintHandler : public FactorsConstraintHandler
     ConstraintHandler *getCopy(void) const;
   public:
     int handle(const ID *nodesNumberedLast =0);
+    int updateSPs(void);
   };
 } // end of XC namespace
 
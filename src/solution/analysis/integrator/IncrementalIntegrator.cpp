@@ -65,13 +65,185 @@
 #include <solution/analysis/model/dof_grp/DOF_Group.h>
 #include <solution/analysis/model/FE_EleIter.h>
 #include <solution/analysis/model/DOF_GrpIter.h>
+#include "domain/mesh/element/Element.h"
+#include "utility/matrix/ID.h"
+#include "domain/domain/partitioned/PartitionedDomain.h"
 
 
 //! @brief Constructor.
 //!
 //! @param owr: set of objects used to perform the analysis.
 XC::IncrementalIntegrator::IncrementalIntegrator(AnalysisAggregation *owr,int clasTag)
-  : Integrator(owr,clasTag), statusFlag(CURRENT_TANGENT) {}
+  : Integrator(owr,clasTag), statusFlag(CURRENT_TANGENT),
+    useTangentCache(false), tangentCacheFlag(-1), cachedFirstVariableEq(0),
+    cachedFE_Version(0) {}
+
+//! @brief Activates/deactivates the caching of the tangent contribution
+//! of the elements whose stiffness doesn't change with its state
+//! (see Element::hasConstantTangent).
+void XC::IncrementalIntegrator::setUseTangentCache(const bool &b)
+  {
+    useTangentCache= b;
+    if(!useTangentCache)
+      invalidateTangentCache();
+  }
+
+//! @brief Return true if the tangent caching is active.
+bool XC::IncrementalIntegrator::getUseTangentCache(void) const
+  { return useTangentCache; }
+
+//! @brief Discards the cached tangent contribution. Must be called if
+//! the properties of the elements with constant tangent are modified.
+void XC::IncrementalIntegrator::invalidateTangentCache(void)
+  {
+    tangentCacheFlag= -1;
+    constantFEs.clear();
+    constantFEsDead.clear();
+    variableFEs.clear();
+    LinearSOE *theSOE= getLinearSOEPtr();
+    if(theSOE)
+      theSOE->clearConstantA();
+  }
+
+//! @brief Updates the list of the elements with variable tangent after
+//! the objects that enforce the single freedom constraints have been
+//! replaced (see ConstraintHandler::updateSPs).
+//!
+//! The cached tangent is kept unless one of the new objects affects
+//! an equation of its (already factored) constant part.
+void XC::IncrementalIntegrator::updateTangentCacheFEs(void)
+  {
+    if(tangentCacheFlag<0) // nothing cached.
+      return;
+    AnalysisModel *mdl= getAnalysisModelPtr();
+    if(!mdl)
+      {
+        invalidateTangentCache();
+        return;
+      }
+    variableFEs.clear();
+    FE_Element *elePtr;
+    FE_EleIter &theEles= mdl->getFEs();
+    while((elePtr = theEles()) != 0)
+      {
+        const Element *theEle= elePtr->getElement();
+        if(!theEle || !theEle->hasConstantTangent())
+          {
+            const ID &id= elePtr->getID();
+            for(int j= 0;j<id.Size();j++)
+              if((id(j)>=0) && (id(j)<cachedFirstVariableEq))
+                {
+                  invalidateTangentCache();
+                  return;
+                }
+            variableFEs.push_back(elePtr);
+          }
+      }
+    // the cached pointers are still valid.
+    cachedFE_Version= mdl->getFE_ElementsVersion();
+  }
+
+//! @brief Return true if the constant part of the tangent stored
+//! in the system of equations can be reused.
+bool XC::IncrementalIntegrator::isTangentCacheValid(const LinearSOE &theSOE) const
+  {
+    // the FE_Element pointers are only checked if the analysis model
+    // has not been rebuilt (or modified) since they were cached.
+    const AnalysisModel *mdl= getAnalysisModelPtr();
+    bool retval= mdl && (mdl->getFE_ElementsVersion()==cachedFE_Version);
+    retval= retval && (tangentCacheFlag==statusFlag) && theSOE.hasConstantA();
+    const size_t sz= constantFEs.size();
+    for(size_t i= 0;retval && (i<sz);i++)
+      {
+        const Element *theEle= constantFEs[i]->getElement();
+        retval= theEle && theEle->hasConstantTangent() && (theEle->isDead()==constantFEsDead[i]);
+      }
+    return retval;
+  }
+
+//! @brief Builds the tangent stiffness matrix reusing the
+//! contribution of the elements with constant tangent.
+//!
+//! The first time it's called, it assembles the tangent of those
+//! elements and stores it in the system of equations. In the following
+//! calls the stored matrix is restored and only the contributions of
+//! the remaining elements are computed and assembled.
+int XC::IncrementalIntegrator::formCachedTangent(AnalysisModel &mdl,LinearSOE &theSOE)
+  {
+    int result= 0;
+    if(isTangentCacheValid(theSOE) && theSOE.restoreConstantA())
+      {
+        // add the contribution of the elements with variable tangent.
+        for(std::vector<FE_Element *>::iterator i= variableFEs.begin();i!=variableFEs.end();i++)
+          if(theSOE.addA((*i)->getTangent(this),(*i)->getID()) < 0)
+            {
+              std::cerr << getClassName() << "::" << __FUNCTION__
+                        << "; WARNING failed in addA for ID "
+                        << (*i)->getID();	    
+              result= -3;
+            }
+      }
+    else
+      {
+        constantFEs.clear();
+        constantFEsDead.clear();
+        variableFEs.clear();
+        theSOE.zeroA();
+        // assemble the constant part first.
+        int firstVariableEq= theSOE.getNumEqn();
+        FE_Element *elePtr;
+        FE_EleIter &theEles= mdl.getFEs();
+        while((elePtr = theEles()) != 0)
+          {
+            const Element *theEle= elePtr->getElement();
+            if(theEle && theEle->hasConstantTangent())
+              {
+                constantFEs.push_back(elePtr);
+                constantFEsDead.push_back(theEle->isDead());
+                if(theSOE.addA(elePtr->getTangent(this),elePtr->getID()) < 0)
+                  {
+                    std::cerr << getClassName() << "::" << __FUNCTION__
+                              << "; WARNING failed in addA for ID "
+                              << elePtr->getID();	    
+                    result= -3;
+                  }
+              }
+            else
+              {
+                variableFEs.push_back(elePtr);
+                const ID &id= elePtr->getID();
+                for(int j= 0;j<id.Size();j++)
+                  if((id(j)>=0) && (id(j)<firstVariableEq))
+                    firstVariableEq= id(j);
+              }
+          }
+        if((result==0) && theSOE.storeConstantA(firstVariableEq))
+          {
+            tangentCacheFlag= statusFlag;
+            cachedFirstVariableEq= firstVariableEq;
+            cachedFE_Version= mdl.getFE_ElementsVersion();
+          }
+        else
+          {
+            tangentCacheFlag= -1;
+            constantFEs.clear();
+            constantFEsDead.clear();
+          }
+        // add the contribution of the elements with variable tangent.
+        for(std::vector<FE_Element *>::iterator i= variableFEs.begin();i!=variableFEs.end();i++)
+          if(theSOE.addA((*i)->getTangent(this),(*i)->getID()) < 0)
+            {
+              std::cerr << getClassName() << "::" << __FUNCTION__
+                        << "; WARNING failed in addA for ID "
+                        << (*i)->getID();	    
+              result= -3;
+            }
+        if(tangentCacheFlag<0)
+          variableFEs.clear();
+      }
+    return result;
+  }
+
 
 
 //! @brief Builds tangent stiffness matrix.
@@ -108,6 +280,11 @@ int XC::IncrementalIntegrator::formTangent(int statFlag)
 	return -1;
       }
 
+    if(formSubdomainTangents() < 0)
+      return -2;
+    if(useTangentCache)
+      return formCachedTangent(*mdl,*theSOE);
+
     theSOE->zeroA(); //Zeroes the matrix elements.
     
     // the loops to form and add the tangents are broken into two for 
@@ -127,6 +304,37 @@ int XC::IncrementalIntegrator::formTangent(int statFlag)
     return result;
   }
 
+//! @brief If the domain is partitioned, condenses the tangent of its
+//! subdomains concurrently before the FE_Elements are asked for them
+//! (see PartitionedDomain::formSubdomainTangents).
+int XC::IncrementalIntegrator::formSubdomainTangents(void)
+  {
+    int retval= 0;
+    AnalysisModel *mdl= getAnalysisModelPtr();
+    PartitionedDomain *pd= dynamic_cast<PartitionedDomain *>(mdl->getDomainPtr());
+    if(pd)
+      {
+        retval= pd->formSubdomainTangents();
+        if(retval<0)
+	  std::cerr << getClassName() << "::" << __FUNCTION__
+	            << "; WARNING failed to form the subdomain tangents.\n";
+      }
+    return retval;
+  }
+
+//! @brief If the domain is partitioned, condenses the residual of its
+//! subdomains concurrently before the FE_Elements are asked for them
+//! (see PartitionedDomain::formSubdomainResiduals).
+int XC::IncrementalIntegrator::formSubdomainResiduals(void)
+  {
+    int retval= 0;
+    AnalysisModel *mdl= getAnalysisModelPtr();
+    PartitionedDomain *pd= dynamic_cast<PartitionedDomain *>(mdl->getDomainPtr());
+    if(pd)
+      retval= pd->formSubdomainResiduals();
+    return retval;
+  }
+
 //! @brief Builds the unbalanced load vector (right hand side of the equation).
 //!
 //! Invoked to form the unbalance. The method fist zeros out the \f$B\f$
@@ -155,6 +363,12 @@ int XC::IncrementalIntegrator::formUnbalance(void)
     
     theSOE->zeroB();
     
+    if(formSubdomainResiduals() < 0)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING: failed to condense the subdomains\n";
+	return -1;
+      }
     if(formElementResidual() < 0)
       {
 	std::cerr << getClassName() << "::" << __FUNCTION__
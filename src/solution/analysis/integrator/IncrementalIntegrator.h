@@ -66,6 +66,7 @@
 // What: "@(#) IncrementalIntegrator.h, revA"
 
 #include <solution/analysis/integrator/Integrator.h>
+#include <vector>
 
 namespace XC {
 class LinearSOE;
@@ -104,12 +105,29 @@ class IncrementalIntegrator : public Integrator
     virtual int formElementResidual(void);
     int statusFlag;
 
+    bool useTangentCache; //!< if true, reuse the contribution of the elements with constant tangent.
+    int tangentCacheFlag; //!< status flag used to compute the cached tangent (-1 if none).
+    std::vector<FE_Element *> constantFEs; //!< elements whose tangent is cached.
+    std::vector<bool> constantFEsDead; //!< dead/alive state of those elements when cached.
+    std::vector<FE_Element *> variableFEs; //!< elements whose tangent must be computed each time.
+    int cachedFirstVariableEq; //!< first equation affected by the elements with variable tangent when cached.
+    size_t cachedFE_Version; //!< version of the analysis model FE_Elements when cached (see AnalysisModel::getFE_ElementsVersion).
+    bool isTangentCacheValid(const LinearSOE &) const;
+    int formCachedTangent(AnalysisModel &,LinearSOE &);
+    int formSubdomainTangents(void);
+    int formSubdomainResiduals(void);
+
     IncrementalIntegrator(AnalysisAggregation *,int classTag);
   public:
     // methods to set up the system of equations
     virtual int formTangent(int statusFlag = CURRENT_TANGENT);    
     virtual int formUnbalance(void);
 
+    void setUseTangentCache(const bool &);
+    bool getUseTangentCache(void) const;
+    void invalidateTangentCache(void);
+    void updateTangentCacheFEs(void);
+
     // pure virtual methods to define the FE_ELe and DOF_Group contributions
     //! @brief To inform the FE\_Element how to build its tangent matrix for
     //! addition to the system of equations.
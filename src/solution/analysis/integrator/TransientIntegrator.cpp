@@ -70,6 +70,9 @@
 #include <solution/analysis/model/dof_grp/DOF_Group.h>
 #include <solution/analysis/model/FE_EleIter.h>
 #include <solution/analysis/model/DOF_GrpIter.h>
+#include <solution/analysis/integrator/transient/ResponseQuantities.h>
+#include <algorithm>
+#include <cmath>
 
 
 //! @brief Constructor.
@@ -118,6 +121,9 @@ int XC::TransientIntegrator::formTangent(int statFlag)
 	return -1;
       }
     
+    if(formSubdomainTangents() < 0)
+      return -2;
+
     // the loops to form and add the tangents are broken into two for 
     // efficiency when performing parallel computations
     
@@ -188,3 +194,35 @@ int XC::TransientIntegrator::formNodUnbalance(DOF_Group *theDof)
     return 0;
   }
 
+
+//! @brief Returns an estimation of the relative local truncation error
+//! of the last step or a negative number if the integrator doesn't
+//! provide it.
+double XC::TransientIntegrator::getLocalTruncationError(void) const
+  { return -1.0; }
+
+//! @brief Zienkiewicz-Xie a posteriori estimation of the local error
+//! of the displacements of a Newmark type step:
+//! \f$ e= (\beta - 1/6) \Delta t^2 (\ddot U_{t+\Delta t} - \ddot U_t) \f$.
+//! Returns \f$ ||e||/||U_{t+\Delta t}|| \f$ (or \f$||e||\f$ if the
+//! displacements are zero).
+double XC::TransientIntegrator::zienkiewiczXieError(const double &beta,const double &deltaT,const ResponseQuantities &Ut,const ResponseQuantities &U)
+  {
+    const Vector &a0= Ut.getDotDot();
+    const Vector &a1= U.getDotDot();
+    const int sz= a1.Size();
+    if(a0.Size()!=sz)
+      return -1.0;
+    const double factor= (beta-1.0/6.0)*deltaT*deltaT;
+    double e2= 0.0;
+    for(int i= 0;i<sz;i++)
+      {
+        const double ei= factor*(a1(i)-a0(i));
+        e2+= ei*ei;
+      }
+    const double normU= std::max(U.get().Norm(),Ut.get().Norm());
+    double retval= sqrt(e2);
+    if(normU>0.0)
+      retval/= normU;
+    return retval;
+  }
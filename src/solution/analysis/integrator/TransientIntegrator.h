@@ -73,6 +73,7 @@ class AnalysisModel;
 class FE_Element;
 class DOF_Group;
 class Vector;
+class ResponseQuantities;
 
 //! @addtogroup TransientIntegrator Integration of the dynamic equations of motion.
 //! @ingroup AnalysisIntegrator
@@ -179,12 +180,14 @@ class TransientIntegrator : public IncrementalIntegrator
   {
   protected:
     TransientIntegrator(AnalysisAggregation *,int classTag);
+    static double zienkiewiczXieError(const double &beta,const double &deltaT,const ResponseQuantities &Ut,const ResponseQuantities &U);
   public:
 
     virtual int formTangent(int statFlag);
     virtual int formEleResidual(FE_Element *theEle);
     virtual int formNodUnbalance(DOF_Group *theDof);    
     virtual int initialize(void) {return 0;};    
+    virtual double getLocalTruncationError(void) const;
   };
 } // end of XC namespace
 
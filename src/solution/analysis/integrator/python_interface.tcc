@@ -24,7 +24,10 @@ class_<XC::Integrator, bases<XC::MovableObject,CommandEntity>, boost::noncopyabl
 
 class_<XC::EigenIntegrator, bases<XC::Integrator>, boost::noncopyable >("EigenIntegrator", no_init);
 
-class_<XC::IncrementalIntegrator, bases<XC::Integrator>, boost::noncopyable >("IncrementalIntegrator", no_init);
+class_<XC::IncrementalIntegrator, bases<XC::Integrator>, boost::noncopyable >("IncrementalIntegrator", no_init)
+  .add_property("useTangentCache", &XC::IncrementalIntegrator::getUseTangentCache, &XC::IncrementalIntegrator::setUseTangentCache,"If true, the tangent contribution of the elements with constant stiffness is computed only once.")
+  .def("invalidateTangentCache", &XC::IncrementalIntegrator::invalidateTangentCache,"Discards the cached tangent (call it after modifying the properties of the elements).")
+  ;
 
 class_<XC::StaticIntegrator, bases<XC::IncrementalIntegrator>, boost::noncopyable >("StaticIntegrator", no_init);
 
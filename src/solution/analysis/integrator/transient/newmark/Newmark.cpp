@@ -73,7 +73,7 @@
 //! @param owr: analysis aggregation that will own this object.
 XC::Newmark::Newmark(AnalysisAggregation *owr)
   : NewmarkBase2(owr,INTEGRATOR_TAGS_Newmark),
-    displ(true), determiningMass(false) {}
+    displ(true), determiningMass(false), dt(0.0) {}
 
 //! @brief Constructor.
 //!
@@ -86,7 +86,7 @@ XC::Newmark::Newmark(AnalysisAggregation *owr)
 //!                  indicating that Rayleigh damping will not be used.
 XC::Newmark::Newmark(AnalysisAggregation *owr,double _gamma, double _beta, bool dispFlag)
   : NewmarkBase2(owr,INTEGRATOR_TAGS_Newmark,_gamma,_beta),
-    displ(dispFlag), determiningMass(false) {}
+    displ(dispFlag), determiningMass(false), dt(0.0) {}
 
 //! @brief Constructor.
 //!
@@ -100,7 +100,7 @@ XC::Newmark::Newmark(AnalysisAggregation *owr,double _gamma, double _beta, bool
 //!                  indicating that Rayleigh damping will not be used.
 XC::Newmark::Newmark(AnalysisAggregation *owr,double _gamma, double _beta,const RayleighDampingFactors &rF,bool dispFlag)
   : NewmarkBase2(owr,INTEGRATOR_TAGS_Newmark,_gamma,_beta,rF),
-    displ(dispFlag), determiningMass(false) {}
+    displ(dispFlag), determiningMass(false), dt(0.0) {}
 
 //! The following are performed when this method is invoked:
 //! \begin{enumerate}
@@ -173,6 +173,7 @@ int XC::Newmark::newStep(double deltaT)
 
     // get a pointer to the XC::AnalysisModel
     AnalysisModel *theModel = this->getAnalysisModelPtr();
+    dt= deltaT;
     
     // set the constants
     if(displ == true)
@@ -423,6 +424,11 @@ int XC::Newmark::update(const XC::Vector &deltaU)
     return 0;
   }    
 
+//! @brief Returns the Zienkiewicz-Xie estimation of the relative
+//! local error of the displacements in the last step.
+double XC::Newmark::getLocalTruncationError(void) const
+  { return zienkiewiczXieError(beta,dt,Ut,U); }
+
 //! @brief Send object members through the channel being passed as parameter.
 int XC::Newmark::sendData(CommParameters &cp)
   {
@@ -142,6 +142,7 @@ class Newmark : public NewmarkBase2
     bool displ; //!< a flag indicating whether displ or accel increments.
     ResponseQuantities Ut; //!< response quantities at time t.
     bool determiningMass; //!< flag to check if just want the mass contribution.
+    double dt; //!< time increment of the current step.
   protected:
     int sendData(CommParameters &);
     int recvData(const CommParameters &);
@@ -163,6 +164,7 @@ class Newmark : public NewmarkBase2
     int newStep(double deltaT);    
     int revertToLastStep(void);        
     int update(const Vector &deltaU);
+    double getLocalTruncationError(void) const;
     
     virtual int sendSelf(CommParameters &);
     virtual int recvSelf(const CommParameters &);
@@ -111,6 +111,10 @@ XC::HHTBase::HHTBase(AnalysisAggregation *owr,int classTag,double _alpha, double
 XC::HHTBase::HHTBase(AnalysisAggregation *owr,int classTag,double _alpha, double _beta, double _gamma,const RayleighDampingFactors &rF)
     : HHTRayleighBase(owr,classTag,_alpha,_gamma,rF), beta(_beta), c1(0.0) {}
 
+//! @brief Returns the Zienkiewicz-Xie estimation of the relative
+//! local error of the displacements in the last step.
+double XC::HHTBase::getLocalTruncationError(void) const
+  { return zienkiewiczXieError(beta,deltaT,Ut,U); }
 
 //! @brief Send object members through the channel being passed as parameter.
 int XC::HHTBase::sendData(CommParameters &cp)
@@ -63,6 +63,8 @@ class HHTBase: public HHTRayleighBase
     HHTBase(AnalysisAggregation *,int classTag,double alpha,const RayleighDampingFactors &rF);
     HHTBase(AnalysisAggregation *,int classTag,double alpha, double beta, double gamma);
     HHTBase(AnalysisAggregation *,int classTag,double alpha, double beta, double gamma,const RayleighDampingFactors &rF);    
+  public:
+    double getLocalTruncationError(void) const;
   };
 } // end of XC namespace
 
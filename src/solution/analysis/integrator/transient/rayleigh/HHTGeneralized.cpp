@@ -289,6 +289,11 @@ int XC::HHTGeneralized::update(const Vector &deltaU)
     return 0;
   }
 
+//! @brief Returns the Zienkiewicz-Xie estimation of the relative
+//! local error of the displacements in the last step.
+double XC::HHTGeneralized::getLocalTruncationError(void) const
+  { return zienkiewiczXieError(beta,deltaT,Ut,U); }
+
 
 int XC::HHTGeneralized::commit(void)
   {
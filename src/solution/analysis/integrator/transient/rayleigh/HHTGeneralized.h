@@ -109,6 +109,7 @@ class HHTGeneralized : public RayleighBase
     int revertToLastStep(void);        
     int update(const Vector &deltaU);
     int commit(void);
+    double getLocalTruncationError(void) const;
     
     virtual int sendSelf(CommParameters &);
     virtual int recvSelf(const CommParameters &);
@@ -85,6 +85,7 @@
 #include "domain/mesh/element/Element.h"
 #include "domain/domain/subdomain/Subdomain.h"
 #include "domain/mesh/node/NodeIter.h"
+#include "domain/mesh/node/NodalStateStore.h"
 #include "solution/analysis/handler/ConstraintHandler.h"
 #include "solution/analysis/handler/TransformationConstraintHandler.h"
 
@@ -100,7 +101,8 @@ XC::AnalysisModel::AnalysisModel(ModelWrapper *owr)
    numFE_Ele(0), numDOF_Grp(0), numEqn(0),
    theFEs(this,256,"FEs"), theDOFGroups(this,256,"DOFs"), theFEiter(&theFEs), theDOFGroupiter(&theDOFGroups),
    theFEconst_iter(&theFEs), theDOFGroupconst_iter(&theDOFGroups),
-   myDOFGraph(*this), myGroupGraph(*this), updateGraphs(false) {}
+   myDOFGraph(*this), myGroupGraph(*this), updateGraphs(false), feVersion(0),
+   scatterStoreVersion(0), updateScatter(true) {}
 
 //! @brief Constructor.
 //!
@@ -112,7 +114,8 @@ XC::AnalysisModel::AnalysisModel(int theClassTag,CommandEntity *owr)
    numFE_Ele(0), numDOF_Grp(0), numEqn(0),
    theFEs(this,1024,"FEs"), theDOFGroups(this,1024,"DOFs"),theFEiter(&theFEs), theDOFGroupiter(&theDOFGroups),
    theFEconst_iter(&theFEs), theDOFGroupconst_iter(&theDOFGroups),
-   myDOFGraph(*this), myGroupGraph(*this), updateGraphs(false) {}
+   myDOFGraph(*this), myGroupGraph(*this), updateGraphs(false), feVersion(0),
+   scatterStoreVersion(0), updateScatter(true) {}
 
 //! @brief Copy constructor.
 XC::AnalysisModel::AnalysisModel(const AnalysisModel &other)
@@ -120,7 +123,8 @@ XC::AnalysisModel::AnalysisModel(const AnalysisModel &other)
    numFE_Ele(other.numFE_Ele), numDOF_Grp(other.numDOF_Grp), numEqn(other.numEqn),
    theFEs(other.theFEs), theDOFGroups(other.theDOFGroups),theFEiter(&theFEs), theDOFGroupiter(&theDOFGroups),
    theFEconst_iter(&theFEs), theDOFGroupconst_iter(&theDOFGroups),
-   myDOFGraph(*this), myGroupGraph(*this), updateGraphs(false) {}
+   myDOFGraph(*this), myGroupGraph(*this), updateGraphs(false), feVersion(0),
+   scatterStoreVersion(0), updateScatter(true) {}
 
 //! @brief Assignment operator.
 XC::AnalysisModel &XC::AnalysisModel::operator=(const AnalysisModel &other)
@@ -135,6 +139,8 @@ XC::AnalysisModel &XC::AnalysisModel::operator=(const AnalysisModel &other)
     myDOFGraph= DOF_Graph(*this);
     myGroupGraph= DOF_GroupGraph(*this);
     updateGraphs= false; //Update just finished
+    feVersion++;
+    updateScatter= true;
     return *this;
   }
 
@@ -191,6 +197,7 @@ bool XC::AnalysisModel::addFE_Element(FE_Element *theElement)
 	      {
 		theElement->setAnalysisModel(*this);
 		numFE_Ele++;
+		feVersion++;
 		updateGraphs= true;
 	      }
 	  }
@@ -198,6 +205,23 @@ bool XC::AnalysisModel::addFE_Element(FE_Element *theElement)
     return retval;
   }
 
+//! @brief Removes (and deletes) the FE_Element identified by the argument.
+//!
+//! Used by the constraint handlers to replace the objects that enforce
+//! the constraints without rebuilding the whole model.
+//! @param tag: identifier of the FE_Element to remove.
+bool XC::AnalysisModel::removeFE_Element(int tag)
+  {
+    const bool retval= theFEs.removeComponent(tag);
+    if(retval)
+      {
+        numFE_Ele--;
+        feVersion++;
+        updateGraphs= true;
+      }
+    return retval;
+  }
+
 //! @brief Creates a FE_Element and appends it to the model.
 XC::FE_Element *XC::AnalysisModel::createFE_Element(const int &tag, Element *elePtr)
   {
@@ -518,11 +542,19 @@ void XC::AnalysisModel::clearAll(void)
     numFE_Ele=0;
     numDOF_Grp= 0;
     numEqn= 0;    
+    feVersion++;
     updateGraphs= true;
+    updateScatter= true;
   }
 
 
 
+//! @brief Returns a number that changes each time a FE_Element is
+//! added or removed (so the objects that store pointers to the
+//! FE_Elements can check if they are still valid).
+size_t XC::AnalysisModel::getFE_ElementsVersion(void) const
+  { return feVersion; }
+
 //! @brief Returns the umber of DOF_Group objects added to the model.
 int XC::AnalysisModel::getNumDOF_Groups(void) const
   { return numDOF_Grp; }
@@ -588,7 +620,10 @@ XC::DOF_GrpConstIter &XC::AnalysisModel::getConstDOFs() const
 //! @brief Sets the value of the number of equations in the model.
 //! Invoked by the DOF\_Numberer when it is numbering the dofs.
 void XC::AnalysisModel::setNumEqn(int theNumEqn)
-  { numEqn= theNumEqn; }
+  {
+    numEqn= theNumEqn;
+    updateScatter= true; // equation numbers have changed.
+  }
 
 //! @brief Returns the number of DOFs in the model which have been assigned
 //! an equation number.
@@ -662,16 +697,80 @@ const XC::Graph &XC::AnalysisModel::getDOFGroupGraph(void) const
 //! iter.
 void XC::AnalysisModel::setResponse(const Vector &disp, const Vector &vel, const Vector &accel)
   {
-    DOF_GrpIter &theDOFGrps= this->getDOFGroups();
-    DOF_Group *dofPtr= nullptr;
-    while((dofPtr= theDOFGrps()) != 0)
+    NodalStateStore *store= get_nodal_state_store();
+    if(store)
       {
-        dofPtr->setNodeDisp(disp);
-        dofPtr->setNodeVel(vel);
-        dofPtr->setNodeAccel(accel);        
+        store->setTrialDisp(scatterPositions,scatterEquations,disp);
+        store->setTrialVel(scatterPositions,scatterEquations,vel);
+        store->setTrialAccel(scatterPositions,scatterEquations,accel);
+        for(std::vector<DOF_Group *>::iterator i= otherDOF_Groups.begin();i!=otherDOF_Groups.end();i++)
+          {
+            (*i)->setNodeDisp(disp);
+            (*i)->setNodeVel(vel);
+            (*i)->setNodeAccel(accel);
+          }
+      }
+    else
+      {
+        DOF_GrpIter &theDOFGrps= this->getDOFGroups();
+        DOF_Group *dofPtr= nullptr;
+        while((dofPtr= theDOFGrps()) != 0)
+          {
+            dofPtr->setNodeDisp(disp);
+            dofPtr->setNodeVel(vel);
+            dofPtr->setNodeAccel(accel);        
+          }
       }
   }
         
+//! @brief Return the storage of the nodal response quantities
+//! if the mesh uses it (nullptr otherwise).
+//!
+//! If the nodes are in a NodalStateStore, the values of the
+//! DOF_Group objects that take its values directly from the
+//! equation numbers are set with a single loop (see
+//! NodalStateStore::setTrialDisp), the positions of its
+//! DOFs in the store are computed here.
+XC::NodalStateStore *XC::AnalysisModel::get_nodal_state_store(void)
+  {
+    NodalStateStore *retval= nullptr;
+    Domain *dom= getDomainPtr();
+    if(dom)
+      retval= dom->getMesh().getNodalStateStore();
+    if(retval)
+      {
+        if(updateScatter || (scatterStoreVersion!=retval->getVersion()))
+          {
+            scatterPositions.clear();
+            scatterEquations.clear();
+            otherDOF_Groups.clear();
+            DOF_GrpIter &theDOFGrps= this->getDOFGroups();
+            DOF_Group *dofPtr= nullptr;
+            while((dofPtr= theDOFGrps()) != 0)
+              {
+                long offset= -1;
+                if(dofPtr->isDirectlyMapped())
+                  offset= retval->getNodeOffset(*dofPtr->myNode);
+                if(offset>=0)
+                  {
+                    const ID &id= dofPtr->getID();
+                    const int sz= dofPtr->getNumDOF();
+                    for(int i= 0;i<sz;i++)
+                      {
+                        scatterPositions.push_back(offset+i);
+                        scatterEquations.push_back(id(i));
+                      }
+                  }
+                else
+                  otherDOF_Groups.push_back(dofPtr);
+              }
+            scatterStoreVersion= retval->getVersion();
+            updateScatter= false;
+          }
+      }
+    return retval;
+  }
+
 //! @brief Sets the values of the displacement of the nodes.
 //!
 //! The model is responsible for invoking {\em setDisp(disp)} on each
@@ -680,10 +779,20 @@ void XC::AnalysisModel::setResponse(const Vector &disp, const Vector &vel, const
 //! setNodeDisp(disp)} on each DOF\_Group.
 void XC::AnalysisModel::setDisp(const Vector &disp)
   {
-    DOF_GrpIter &theDOFGrps= this->getDOFGroups();
-    DOF_Group *dofPtr= nullptr;
-    while ((dofPtr= theDOFGrps()) != 0) 
-        dofPtr->setNodeDisp(disp);
+    NodalStateStore *store= get_nodal_state_store();
+    if(store)
+      {
+        store->setTrialDisp(scatterPositions,scatterEquations,disp);
+        for(std::vector<DOF_Group *>::iterator i= otherDOF_Groups.begin();i!=otherDOF_Groups.end();i++)
+          (*i)->setNodeDisp(disp);
+      }
+    else
+      {
+        DOF_GrpIter &theDOFGrps= this->getDOFGroups();
+        DOF_Group *dofPtr= nullptr;
+        while ((dofPtr= theDOFGrps()) != 0) 
+            dofPtr->setNodeDisp(disp);
+      }
   }        
         
 //! @brief Sets the values of the velocity of the nodes.
@@ -722,10 +831,20 @@ void XC::AnalysisModel::setAccel(const Vector &accel)
 //! incrNodeDisp(disp)} on each DOF\_Group.
 void XC::AnalysisModel::incrDisp(const Vector &disp)
   {
-    DOF_GrpIter &theDOFGrps= this->getDOFGroups();
-    DOF_Group *dofPtr= nullptr;
-    while ((dofPtr= theDOFGrps()) != 0) 
-        dofPtr->incrNodeDisp(disp);
+    NodalStateStore *store= get_nodal_state_store();
+    if(store)
+      {
+        store->incrTrialDisp(scatterPositions,scatterEquations,disp);
+        for(std::vector<DOF_Group *>::iterator i= otherDOF_Groups.begin();i!=otherDOF_Groups.end();i++)
+          (*i)->incrNodeDisp(disp);
+      }
+    else
+      {
+        DOF_GrpIter &theDOFGrps= this->getDOFGroups();
+        DOF_Group *dofPtr= nullptr;
+        while ((dofPtr= theDOFGrps()) != 0) 
+            dofPtr->incrNodeDisp(disp);
+      }
   }
         
 //! @brief Sets the values of the velocity increment of the nodes.
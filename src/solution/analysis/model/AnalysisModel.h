@@ -74,6 +74,7 @@
 #include "solution/analysis/model/FE_EleConstIter.h"
 #include "solution/analysis/model/DOF_GrpIter.h"
 #include "solution/analysis/model/DOF_GrpConstIter.h"
+#include <vector>
 
 namespace XC {
 class Domain;
@@ -93,6 +94,7 @@ class TransformationDOF_Group;
 class Vector;
 class DOF_GroupGraph;
 class FEM_ObjectBroker;
+class NodalStateStore;
 class ConstraintHandler;
 class TransformationConstraintHandler;
 class RayleighDampingFactors;
@@ -147,6 +149,16 @@ class AnalysisModel: public MovableObject, public CommandEntity
     mutable DOF_Graph myDOFGraph;
     mutable DOF_GroupGraph myGroupGraph;
     mutable bool updateGraphs;
+    size_t feVersion; //!< incremented each time FE_Elements are added or removed.
+
+    // update of the nodes whose values are in a NodalStateStore.
+    std::vector<size_t> scatterPositions; //!< position in the store of each DOF.
+    std::vector<int> scatterEquations; //!< equation number of each DOF.
+    std::vector<DOF_Group *> otherDOF_Groups; //!< DOF groups that update its nodes by themselves.
+    size_t scatterStoreVersion; //!< version of the store when the positions were computed.
+    bool updateScatter; //!< if true, the positions must be computed again.
+
+    NodalStateStore *get_nodal_state_store(void);
 
     ModelWrapper *getModelWrapper(void);
     const ModelWrapper *getModelWrapper(void) const;
@@ -194,6 +206,8 @@ class AnalysisModel: public MovableObject, public CommandEntity
     virtual PenaltyMFreedom_FE *createPenaltyMFreedom_FE(const int &, MFreedom_Constraint &, const double &);
     virtual PenaltyMRMFreedom_FE *createPenaltyMRMFreedom_FE(const int &, MRMFreedom_Constraint &, const double &);
     virtual FE_Element *createTransformationFE(const int &, Element *, const std::set<int> &,std::set<FE_Element *> &);
+    virtual bool removeFE_Element(int tag);
+    size_t getFE_ElementsVersion(void) const;
     virtual void clearAll(void);
 
     // methods to access the FE_Elements and DOF_Groups and their numbers
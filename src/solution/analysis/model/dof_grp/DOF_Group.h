@@ -135,6 +135,11 @@ class DOF_Group: public TaggedObject
     int inicID(const int &value);
 
     virtual int getNodeTag(void) const;
+    //! @brief Return true if the trial response of the node is
+    //! obtained by taking the values of its equation numbers (see
+    //! setNodeDisp).
+    inline virtual bool isDirectlyMapped(void) const
+      { return (myNode!=nullptr); }
     //! @brief Returns the total number of DOFs in the DOF\_Group. 
     inline virtual int getNumDOF(void) const
       { return myID.Size(); }
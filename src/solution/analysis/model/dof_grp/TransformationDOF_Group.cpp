@@ -87,6 +87,31 @@ std::vector<XC::SFreedom_Constraint *> XC::TransformationDOF_Group::getSFreedomC
     return retval;
   }
 
+//! @brief Store the non-zero coefficients of the matrix argument
+//! column by column.
+void XC::TransformationDOF_Group::SparseTransformation::compress(const Matrix &T)
+  {
+    const int nCols= T.noCols();
+    numRows= T.noRows();
+    colPtr.resize(nCols+1);
+    rowIdx.clear();
+    values.clear();
+    colPtr[0]= 0;
+    for(int j=0; j<nCols; j++)
+      {
+        for(int i=0; i<numRows; i++)
+          {
+            const double v= T(i,j);
+            if(v!=0.0)
+              {
+                rowIdx.push_back(i);
+                values.push_back(v);
+              }
+          }
+        colPtr[j+1]= rowIdx.size();
+      }
+  }
+
 //! @brief Initializes object arrays.
 void XC::TransformationDOF_Group::arrays_setup(int numNodalDOF, int numConstrainedNodeRetainedDOF, int numRetainedNodeDOF)  
   {
@@ -506,6 +531,41 @@ void XC::TransformationDOF_Group::setEigenvector(int mode, const Vector &u)
   }
 
 
+//! @brief Compute the transformation matrix from the constraint
+//! matrix of the multi-freedom constraint and store it also in
+//! compressed sparse column format.
+void XC::TransformationDOF_Group::computeT(void)
+  {
+    const MFreedom_ConstraintBase *mfc= getMFreedomConstraint();
+    const int numNodalDOF= myNode->getNumberDOF();
+    const ID &retainedDOF= mfc->getRetainedDOFs();
+    const ID &constrainedDOF= mfc->getConstrainedDOFs();    
+    const int numNodalDOFConstrained= constrainedDOF.Size();
+    const int numRetainedDOF= numNodalDOF - numNodalDOFConstrained;
+    const int numRetainedNodeDOF= retainedDOF.Size();
+
+    Trans.Zero();
+    const Matrix &Ccr= mfc->getConstraint();
+    int col= 0;
+    for(int i=0; i<numNodalDOF; i++)
+      {
+        const int loc= constrainedDOF.getLocation(i);
+        if(loc < 0)
+          {
+            Trans(i,col)= 1.0;
+            col++;
+          }
+        else
+          {
+            for(int j=0; j<numRetainedNodeDOF; j++)
+              Trans(i,j+numRetainedDOF)= Ccr(loc,j);
+          }
+      }
+    sparseTrans.compress(Trans);
+  }
+
+//! @brief Return a pointer to the transformation matrix (nullptr
+//! if the node is not constrained by a multi-freedom constraint).
 XC::Matrix *XC::TransformationDOF_Group::getT(void)
   {
     const MFreedom_ConstraintBase *mfc= getMFreedomConstraint();
@@ -514,37 +574,30 @@ XC::Matrix *XC::TransformationDOF_Group::getT(void)
     if(mfc)
       {
         if(mfc->isTimeVarying())
-	  {
-            const int numNodalDOF= myNode->getNumberDOF();
-            const ID &retainedDOF= mfc->getRetainedDOFs();
-            const ID &constrainedDOF= mfc->getConstrainedDOFs();    
-            int numNodalDOFConstrained= constrainedDOF.Size();
-            int numRetainedDOF= numNodalDOF - numNodalDOFConstrained;
-            int numRetainedNodeDOF= retainedDOF.Size();
-
-            Trans.Zero();
-            const Matrix &Ccr= mfc->getConstraint();
-            int col= 0;
-            for(int i=0; i<numNodalDOF; i++)
-              {
-                const int loc= constrainedDOF.getLocation(i);
-                if(loc < 0)
-                  {
-                    Trans(i,col)= 1.0;
-                    col++;
-                  }
-                else
-                  {
-                    for(int j=0; j<numRetainedNodeDOF; j++)
-                      Trans(i,j+numRetainedDOF)= Ccr(loc,j);
-                  }
-              }
-	  }
+          computeT();
 	retval= &Trans;
       }
     return retval;    
   }
 
+//! @brief Return a pointer to the transformation matrix in
+//! compressed sparse column format (nullptr if the node is not
+//! constrained by a multi-freedom constraint).
+const XC::TransformationDOF_Group::SparseTransformation *XC::TransformationDOF_Group::getSparseT(void)
+  {
+    const SparseTransformation *retval= nullptr;
+    if(getT())
+      retval= &sparseTrans;
+    return retval;
+  }
+
+//! @brief Return true if the transformation matrix must be
+//! recomputed each time it's used.
+bool XC::TransformationDOF_Group::isTimeVarying(void) const
+  {
+    const MFreedom_ConstraintBase *mfc= getMFreedomConstraint();
+    return (mfc && mfc->isTimeVarying());
+  }
 
 int XC::TransformationDOF_Group::doneID(void)
   {
@@ -575,25 +628,7 @@ int XC::TransformationDOF_Group::doneID(void)
     
             // if constraint is not time-varying determine the transformation matrix
             if(mfc->isTimeVarying() == false)
-              {
-                Trans.Zero();
-                const Matrix &Ccr= mfc->getConstraint();
-                int col= 0;
-                for(int i=0; i<numNodalDOF; i++)
-                  {
-                    const int loc= constrainedDOF.getLocation(i);
-                    if(loc < 0)
-                      {
-                        Trans(i,col)= 1.0;
-                        col++;
-                      }
-                    else
-                      {
-                        for(int j=0; j<numRetainedNodeDOF; j++)
-                          Trans(i,j+numRetainedDOF)= Ccr(loc,j);
-                      }
-                  }
-              }
+              computeT();
           }
       }
     return 0;
@@ -85,10 +85,28 @@ class TransformationConstraintHandler;
 //! TransformationFE objects
 class TransformationDOF_Group: public DOF_Group
   {
+  public:
+    //! @brief Transformation matrix stored in compressed sparse
+    //! column format (each column of T has only a few non-zero
+    //! coefficients).
+    struct SparseTransformation
+      {
+        int numRows; //!< number of rows (DOFs of the node).
+        std::vector<int> colPtr; //!< position of the first coefficient of each column.
+        std::vector<int> rowIdx; //!< row index of each coefficient.
+        std::vector<double> values; //!< non-zero coefficients.
+        SparseTransformation(void)
+          : numRows(0) {}
+        void compress(const Matrix &);
+        //! @brief Return the number of columns.
+        inline int getNumCols(void) const
+          { return (colPtr.empty() ? 0 : colPtr.size()-1); }
+      };
   private:
     MFreedom_ConstraintBase *mfc; //!< Pointer to multi-freedom constraint.
     
     Matrix Trans;
+    SparseTransformation sparseTrans; //!< non-zero coefficients of Trans.
     ID modID;
     int modNumDOF;
     UnbalAndTangent unbalAndTangentMod;
@@ -102,6 +120,7 @@ class TransformationDOF_Group: public DOF_Group
 
     void arrays_setup(int numNodalDOF, int numConstrainedNodeRetainedDOF, int numRetainedNodeDOF);
     void initialize(TransformationConstraintHandler *);
+    void computeT(void);
   protected:
     friend class AnalysisModel;
     TransformationDOF_Group(int tag, Node *myNode, MFreedom_ConstraintBase *, TransformationConstraintHandler*);
@@ -123,6 +142,8 @@ class TransformationDOF_Group: public DOF_Group
     const ID &getID(void) const; 
     virtual void setID(int dof, int value);    
     Matrix *getT(void);
+    const SparseTransformation *getSparseT(void);
+    bool isTimeVarying(void) const;
     virtual int getNumDOF(void) const;    
     virtual int getNumFreeDOF(void) const;
     virtual int getNumConstrainedDOF(void) const;
@@ -143,6 +164,11 @@ class TransformationDOF_Group: public DOF_Group
     const Vector &getCommittedVel(void);
     const Vector &getCommittedAccel(void);
     
+    //! @brief The trial response of the node is obtained
+    //! through the transformation matrix.
+    inline bool isDirectlyMapped(void) const
+      { return false; }
+
     // methods to update the trial response at the nodes
     void setNodeDisp(const Vector &u);
     void setNodeVel(const Vector &udot);
@@ -60,11 +60,10 @@
 #include <domain/mesh/element/Element.h>
 #include <domain/domain/Domain.h>
 #include <domain/mesh/node/Node.h>
-#include <solution/analysis/model/dof_grp/DOF_Group.h>
+#include <solution/analysis/model/dof_grp/TransformationDOF_Group.h>
 #include <solution/analysis/integrator/Integrator.h>
 #include "domain/domain/subdomain/Subdomain.h"
 #include <solution/analysis/model/AnalysisModel.h>
-#include <utility/matrix/IntPtrWrapper.h>
 #include <utility/matrix/Matrix.h>
 #include <utility/matrix/Vector.h>
 #include <solution/analysis/handler/TransformationConstraintHandler.h>
@@ -73,30 +72,25 @@
 const int MAX_NUM_DOF= 64;
 
 // static variables initialisation
-XC::UnbalAndTangentStorage XC::TransformationFE::unbalAndTangentArrayMod(MAX_NUM_DOF+1);
-std::vector<XC::Matrix *> XC::TransformationFE::theTransformations; 
 int XC::TransformationFE::numTransFE(0);           
-int XC::TransformationFE::transCounter(0);           
-int XC::TransformationFE::sizeTransformations(0);          
-XC::Vector XC::TransformationFE::dataBuffer(MAX_NUM_DOF*MAX_NUM_DOF);
-XC::Vector XC::TransformationFE::localKbuffer(MAX_NUM_DOF*MAX_NUM_DOF);          
-XC::ID XC::TransformationFE::dofData(MAX_NUM_DOF);          
-int XC::TransformationFE::sizeBuffer(MAX_NUM_DOF*MAX_NUM_DOF);
 
 //  TransformationFE(Element *, Integrator *theIntegrator);
 //        construictor that take the corresponding model element.
 XC::TransformationFE::TransformationFE(int tag, Element *ele)
-  :FE_Element(tag, ele), theDOFs(), /* numSPs(0), theSPs(),*/  
-  numGroups(0), numTransformedDOF(0),unbalAndTangentMod(numTransformedDOF,unbalAndTangentArrayMod)
+  :FE_Element(tag, ele), theDOFs(), theTransDOFs(), /* numSPs(0), theSPs(),*/  
+  numGroups(0), numTransformedDOF(0), unbalAndTangentStorageMod(1), unbalAndTangentMod(numTransformedDOF,unbalAndTangentStorageMod),
+   identityT(true), timeVaryingT(false)
   {
   // set number of original dof at ele
     numOriginalDOF = ele->getNumDOF();
+    unmodResponse= Vector(numOriginalDOF);
 
     // create the array of pointers to DOF_Groups
     const ID &nodes = ele->getNodePtrs().getExternalNodes();
     Domain *theDomain = ele->getDomain();
     int numNodes = nodes.Size();
     theDOFs= std::vector<DOF_Group *>(numNodes,static_cast<DOF_Group *>(nullptr));
+    theTransDOFs= std::vector<TransformationDOF_Group *>(numNodes,static_cast<TransformationDOF_Group *>(nullptr));
 
     numGroups = numNodes;
 
@@ -121,16 +115,9 @@ XC::TransformationFE::TransformationFE(int tag, Element *ele)
             exit(-1);
           }        
         theDOFs[i] = theDofGroup;
+        theTransDOFs[i]= dynamic_cast<TransformationDOF_Group *>(theDofGroup);
       }
 
-    // see if theTransformation array is big enough
-    // if not delete the old and create a new_ one
-    if(numNodes > sizeTransformations)
-      {
-        theTransformations.resize(numNodes,static_cast<Matrix *>(nullptr));
-        sizeTransformations = numNodes;
-      }        
-
     // increment the number of transformations
     numTransFE++;
   }
@@ -139,15 +126,6 @@ XC::TransformationFE::TransformationFE(int tag, Element *ele)
 XC::TransformationFE::~TransformationFE(void)
   {
     numTransFE--;
-
-    // if this is the last XC::FE_Element, clean up the
-    // storage for the matrix and vector objects
-    if(numTransFE == 0)
-      {
-        sizeTransformations = 0;
-        sizeBuffer = 0;
-        transCounter = 0;
-      }
   }    
 
 
@@ -193,162 +171,158 @@ int XC::TransformationFE::setID(void)
                 return -3;
               }                
       }
-    unbalAndTangentMod= UnbalAndTangent(numTransformedDOF,unbalAndTangentArrayMod);
+    unbalAndTangentMod= UnbalAndTangent(numTransformedDOF,unbalAndTangentStorageMod);
+    formTransformation();
     return 0;
   }
 
-const XC::Matrix &XC::TransformationFE::getTangent(Integrator *theNewIntegrator)
+//! @brief Assemble the block diagonal transformation matrix of
+//! the element, in compressed sparse column format, from the
+//! transformation matrices of its DOF groups. The DOF groups without
+//! transformation matrix contribute with an identity block.
+void XC::TransformationFE::formTransformation(void)
   {
-    const Matrix &theTangent = this->FE_Element::getTangent(theNewIntegrator);
-
-    static IntPtrWrapper numDOFs(dofData.getDataPtr(), 1);
-    numDOFs.setData(dofData.getDataPtr(), numGroups);
-    
-    // DO THE SP STUFF TO THE TANGENT 
-    
-    // get the transformation matrix from each dof group & number of local dof
-    // for original node.
-    int numNode = numGroups;
-    for(int a= 0;a<numNode;a++)
+    transColPtr.clear();
+    transRowIdx.clear();
+    transValues.clear();
+    transColPtr.push_back(0);
+    identityT= true;
+    timeVaryingT= false;
+    int rowOffset= 0;
+    for(int i=0; i<numGroups; i++)
       {
-        Matrix *theT = theDOFs[a]->getT();
-        theTransformations[a] = theT;
-        if(theT != 0)
-          numDOFs[a] = theT->noRows(); // T^ 
+        const TransformationDOF_Group::SparseTransformation *Ti= nullptr;
+        if(theTransDOFs[i])
+          {
+            Ti= theTransDOFs[i]->getSparseT();
+            timeVaryingT= timeVaryingT || theTransDOFs[i]->isTimeVarying();
+          }
+        if(Ti)
+          {
+            identityT= false;
+            const int noCols= Ti->getNumCols();
+            for(int c=0; c<noCols; c++)
+              {
+                for(int k=Ti->colPtr[c]; k<Ti->colPtr[c+1]; k++)
+                  {
+                    transRowIdx.push_back(rowOffset+Ti->rowIdx[k]);
+                    transValues.push_back(Ti->values[k]);
+                  }
+                transColPtr.push_back(transRowIdx.size());
+              }
+            rowOffset+= Ti->numRows;
+          }
         else
-          numDOFs[a] = theDOFs[a]->getNumDOF();
+          {
+            const int noCols= theDOFs[i]->getNumDOF();
+            for(int c=0; c<noCols; c++)
+              {
+                transRowIdx.push_back(rowOffset+c);
+                transValues.push_back(1.0);
+                transColPtr.push_back(transRowIdx.size());
+              }
+            rowOffset+= noCols;
+          }
       }
-
-    // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-    // where blocks are of size equal to num ele dof at a node
-
-    int startRow = 0;
-    int noRowsTransformed = 0;
-    int noRowsOriginal = 0;
-
-    static XC::Matrix localK;
-
-    // foreach block row, for each block col do
-    for(int i=0; i<numNode; i++) {
-
-        int startCol = 0;
-        int numDOFi = numDOFs[i];        
-        int noColsOriginal = 0;
-
-        for(int j=0; j<numNode; j++) {
-
-            const Matrix *Ti= theTransformations[i];
-            const Matrix *Tj= theTransformations[j];
-            int numDOFj = numDOFs[j];        
-            localK.setData(localKbuffer.getDataPtr(), numDOFi, numDOFj);
-
-            // copy K(i,j) into localK matrix
-            // CHECK SIZE OF BUFFFER            
-            for(int a=0; a<numDOFi; a++)
-                for(int b=0; b<numDOFj; b++)
-                    localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-
-            // now perform the matrix computation T(i)^T localK T(j)
-            // note: if T == 0 then the Identity is assumed
-            int noColsTransformed = 0;
-            static Matrix localTtKT;
-            
-            if(Ti != 0 && Tj != 0) {
-                noRowsTransformed = Ti->noCols();
-                noColsTransformed = Tj->noCols();
-                // CHECK SIZE OF BUFFFER
-                localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-                localTtKT = (*Ti) ^ localK * (*Tj);
-            } else if(Ti == 0 && Tj != 0) {
-                noRowsTransformed = numDOFi;
-                noColsTransformed = Tj->noCols();
-                // CHECK SIZE OF BUFFFER
-                localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-                // localTtKT = localK * (*Tj);               
-                localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-            } else if(Ti != 0 && Tj == 0) {
-                noRowsTransformed = Ti->noCols();
-                noColsTransformed = numDOFj;
-                // CHECK SIZE OF BUFFFER
-                localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-                localTtKT = (*Ti) ^ localK;
-            } else {
-                noRowsTransformed = numDOFi;
-                noColsTransformed = numDOFj;
-                localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-                localTtKT = localK;
-            }
-            // now copy into modTangent the T(i)^t K(i,j) T(j) product
-            for(int c=0; c<noRowsTransformed; c++) 
-                for(int d=0; d<noColsTransformed; d++) 
-                    (unbalAndTangentMod.getTangent())(startRow+c, startCol+d) = localTtKT(c,d);
-            
-            startCol += noColsTransformed;
-            noColsOriginal += numDOFj;
-        }
-
-        noRowsOriginal += numDOFi;
-        startRow += noRowsTransformed;
-    }
-
-    return unbalAndTangentMod.getTangent();
+    if(!identityT)
+      KT= Matrix(numOriginalDOF,numTransformedDOF);
   }
 
+//! @brief Recompute the transformation of the element if any of
+//! its DOF groups has a time varying transformation matrix.
+void XC::TransformationFE::updateTransformation(void)
+  {
+    if(timeVaryingT)
+      formTransformation();
+  }
 
-const XC::Vector &XC::TransformationFE::getResidual(Integrator *theNewIntegrator)
+//! @brief Return the matrix \f$T^T K T\f$ computed using the
+//! non-zero coefficients of \f$T\f$ only.
+const XC::Matrix &XC::TransformationFE::transformTangent(const Matrix &K)
   {
-    const Vector &theResidual = this->XC::FE_Element::getResidual(theNewIntegrator);
-    // DO THE SP STUFF TO THE TANGENT
+    updateTransformation();
+    if(identityT)
+      return K;
     
-    // perform Tt R  -- as T is block diagonal do T(i)^T R(i)
-    // where blocks are of size equal to num ele dof at a node
-
-    int startRowTransformed = 0;
-    int startRowOriginal = 0;
-    int numNode = numGroups;
-
-    // foreach block row, for each block col do
-    for(int i=0; i<numNode; i++) {
-        int noRows = 0;
-        int noCols = 0;
-        const Matrix *Ti = theDOFs[i]->getT();
-        if(Ti != 0) {
-          noRows = Ti->noCols(); // T^
-          noCols = Ti->noRows();
-
-          /*
-          Vector orig(noCols);
-          Vector mod(noRows);
-          for(int k=startRowOriginal; k<startRowOriginal+noCols; k++)
-            orig(k-startRowOriginal)= theResidual(k);
-          mod = (*Ti)^orig;
-          for(int k=startRowTransformed; k<startRowTransformed+noRows; k++)
-            (unbalAndTangentMod.getResidual())(k) = mod (k-startRowTransformed);
-
-          */
-
-          for(int j=0; j<noRows; j++) {
-            double sum = 0.0;
-            for(int k=0; k<noCols; k++)
-              sum += (*Ti)(k,j) * theResidual(startRowOriginal + k);
-            (unbalAndTangentMod.getResidual())(startRowTransformed +j) = sum;
-          }
-
-        } else {
-          noCols = theDOFs[i]->getNumDOF();
-          noRows = noCols;
-          for(int j=0; j<noRows; j++)
-            (unbalAndTangentMod.getResidual())(startRowTransformed +j) = theResidual(startRowOriginal + j);
+    // KT= K*T
+    KT.Zero();
+    for(int c=0; c<numTransformedDOF; c++)
+      for(int k=transColPtr[c]; k<transColPtr[c+1]; k++)
+        {
+          const int row= transRowIdx[k];
+          const double v= transValues[k];
+          for(int i=0; i<numOriginalDOF; i++)
+            KT(i,c)+= v*K(i,row);
         }
-        startRowTransformed += noRows;
-        startRowOriginal += noCols;
-    }
+    
+    // modTangent= T^T*(K*T)
+    Matrix &modTangent= unbalAndTangentMod.getTangent();
+    for(int c=0; c<numTransformedDOF; c++)
+      for(int r=0; r<numTransformedDOF; r++)
+        {
+          double sum= 0.0;
+          for(int k=transColPtr[r]; k<transColPtr[r+1]; k++)
+            sum+= transValues[k]*KT(transRowIdx[k],c);
+          modTangent(r,c)= sum;
+        }
+    return modTangent;
+  }
 
+//! @brief Return the vector \f$T^T R\f$ computed using the
+//! non-zero coefficients of \f$T\f$ only.
+const XC::Vector &XC::TransformationFE::transformResidual(const Vector &R)
+  {
+    updateTransformation();
+    if(identityT)
+      return R;
+    
+    Vector &modResidual= unbalAndTangentMod.getResidual();
+    for(int c=0; c<numTransformedDOF; c++)
+      {
+        double sum= 0.0;
+        for(int k=transColPtr[c]; k<transColPtr[c+1]; k++)
+          sum+= transValues[k]*R(transRowIdx[k]);
+        modResidual(c)= sum;
+      }
+    return modResidual;
+  }
+
+//! @brief Return the product of the transformed tangent and the
+//! components of the vector argument that correspond to the
+//! element DOFs.
+const XC::Vector &XC::TransformationFE::getForce(const Matrix &theTangent, const Vector &v)
+  {
+    const Matrix &modTangent= transformTangent(theTangent);
+    
+    // get the components we need out of the vector
+    // and place in a temporary vector
+    Vector tmp(numTransformedDOF);
+    for(int j=0; j<numTransformedDOF; j++)
+      {
+        const int dof= modID(j);
+        if(dof >= 0)
+          tmp(j)= v(dof);
+        else
+          tmp(j)= 0.0;
+      }
+    unbalAndTangentMod.getResidual().addMatrixVector(0.0, modTangent, tmp, 1.0);
     return unbalAndTangentMod.getResidual();
-}
+  }
 
+const XC::Matrix &XC::TransformationFE::getTangent(Integrator *theNewIntegrator)
+  {
+    const Matrix &theTangent = this->FE_Element::getTangent(theNewIntegrator);
+    // perform Tt K T
+    return transformTangent(theTangent);
+  }
 
 
+const XC::Vector &XC::TransformationFE::getResidual(Integrator *theNewIntegrator)
+  {
+    const Vector &theResidual = this->XC::FE_Element::getResidual(theNewIntegrator);
+    // perform Tt R
+    return transformResidual(theResidual);
+  }
 
 const XC::Vector &XC::TransformationFE::getTangForce(const XC::Vector &disp, double fact)
   {
@@ -359,351 +333,34 @@ const XC::Vector &XC::TransformationFE::getTangForce(const XC::Vector &disp, dou
   }
 
 const XC::Vector &XC::TransformationFE::getK_Force(const XC::Vector &accel, double fact)
-{
-  this->FE_Element::zeroTangent();    
-  this->FE_Element::addKtToTang();    
-  const Matrix &theTangent = this->XC::FE_Element::getTangent(0);
-
-  static IntPtrWrapper numDOFs(dofData.getDataPtr(), 1);
-  numDOFs.setData(dofData.getDataPtr(), numGroups);
-    
-  // DO THE SP STUFF TO THE TANGENT 
-  
-  // get the transformation matrix from each dof group & number of local dof
-  // for original node.
-  int numNode = numGroups;
-  for(int a = 0; a<numNode; a++)
-    {
-      Matrix *theT = theDOFs[a]->getT();
-      theTransformations[a] = theT;
-      if(theT != 0)
-        numDOFs[a] = theT->noRows(); // T^ 
-      else
-        numDOFs[a] = theDOFs[a]->getNumDOF();
-    }
-  
-  // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-  // where blocks are of size equal to num ele dof at a node
-  
-  int startRow = 0;
-  int noRowsTransformed = 0;
-  int noRowsOriginal = 0;
-  
-  static XC::Matrix localK;
-  
-  // foreach block row, for each block col do
-  for(int i=0; i<numNode; i++) {
-    
-    int startCol = 0;
-    int numDOFi = numDOFs[i];        
-    int noColsOriginal = 0;
-    
-    for(int j=0; j<numNode; j++)
-      {
-        const Matrix *Ti= theTransformations[i];
-        const Matrix *Tj= theTransformations[j];
-      int numDOFj = numDOFs[j];        
-      localK.setData(localKbuffer.getDataPtr(), numDOFi, numDOFj);
-      
-      // copy K(i,j) into localK matrix
-      // CHECK SIZE OF BUFFFER            
-      for(int a=0; a<numDOFi; a++)
-        for(int b=0; b<numDOFj; b++)
-          localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-      
-      // now perform the matrix computation T(i)^T localK T(j)
-      // note: if T == 0 then the Identity is assumed
-      int noColsTransformed = 0;
-      static XC::Matrix localTtKT;
-      
-      if(Ti != 0 && Tj != 0) {
-        noRowsTransformed = Ti->noCols();
-        noColsTransformed = Tj->noCols();
-        // CHECK SIZE OF BUFFFER
-        localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-        localTtKT = (*Ti) ^ localK * (*Tj);
-      } else if(Ti == 0 && Tj != 0) {
-        noRowsTransformed = numDOFi;
-        noColsTransformed = Tj->noCols();
-        // CHECK SIZE OF BUFFFER
-        localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-        // localTtKT = localK * (*Tj);               
-        localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-      } else if(Ti != 0 && Tj == 0) {
-        noRowsTransformed = Ti->noCols();
-        noColsTransformed = numDOFj;
-        // CHECK SIZE OF BUFFFER
-        localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-        localTtKT = (*Ti) ^ localK;
-      } else {
-        noRowsTransformed = numDOFi;
-        noColsTransformed = numDOFj;
-        localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-        localTtKT = localK;
-      }
-      // now copy into modTangent the T(i)^t K(i,j) T(j) product
-      for(int c=0; c<noRowsTransformed; c++) 
-        for(int d=0; d<noColsTransformed; d++) 
-          (unbalAndTangentMod.getTangent())(startRow+c, startCol+d) = localTtKT(c,d);
-      
-      startCol += noColsTransformed;
-      noColsOriginal += numDOFj;
-    }
-    
-    noRowsOriginal += numDOFi;
-    startRow += noRowsTransformed;
-  }
-  
-  // get the components we need out of the vector
-  // and place in a temporary vector
-  Vector tmp(numTransformedDOF);
-  for(int j=0; j<numTransformedDOF; j++) {
-    int dof = modID(j);
-    if(dof >= 0)
-      tmp(j) = accel(dof);
-    else
-      tmp(j) = 0.0;
+  {
+    this->FE_Element::zeroTangent();    
+    this->FE_Element::addKtToTang();    
+    const Matrix &theTangent = this->XC::FE_Element::getTangent(0);
+    return getForce(theTangent, accel);
   }
 
-  unbalAndTangentMod.getResidual().addMatrixVector(0.0, unbalAndTangentMod.getTangent(), tmp, 1.0);
-
-  return unbalAndTangentMod.getResidual();
-}
-
 const XC::Vector &XC::TransformationFE::getM_Force(const Vector &accel, double fact)
   {
     this->FE_Element::zeroTangent();    
     this->FE_Element::addMtoTang();    
     const Matrix &theTangent = this->FE_Element::getTangent(0);
-
-    static IntPtrWrapper numDOFs(dofData.getDataPtr(), 1);
-    numDOFs.setData(dofData.getDataPtr(), numGroups);
-    
-    // DO THE SP STUFF TO THE TANGENT 
-  
-    // get the transformation matrix from each dof group & number of local dof
-    // for original node.
-    int numNode = numGroups;
-    for(int a = 0; a<numNode; a++)
-      {
-        Matrix *theT = theDOFs[a]->getT();
-        theTransformations[a] = theT;
-        if(theT != 0)
-          numDOFs[a] = theT->noRows(); // T^ 
-        else
-          numDOFs[a] = theDOFs[a]->getNumDOF();
-      }
-  
-    // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-    // where blocks are of size equal to num ele dof at a node
-  
-    int startRow = 0;
-    int noRowsTransformed = 0;
-    int noRowsOriginal = 0;
-  
-    static Matrix localK;
-  
-    // foreach block row, for each block col do
-    for(int i=0; i<numNode; i++)
-      {
-    
-        int startCol = 0;
-        int numDOFi = numDOFs[i];        
-        int noColsOriginal = 0;
-    
-        for(int j=0; j<numNode; j++)
-          {
-            const Matrix *Ti= theTransformations[i];
-            const Matrix *Tj= theTransformations[j];
-            int numDOFj = numDOFs[j];        
-            localK.setData(localKbuffer.getDataPtr(), numDOFi, numDOFj);
-      
-            // copy K(i,j) into localK matrix
-            // CHECK SIZE OF BUFFFER            
-            for(int a=0; a<numDOFi; a++)
-              for(int b=0; b<numDOFj; b++)
-                localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-      
-            // now perform the matrix computation T(i)^T localK T(j)
-            // note: if T == 0 then the Identity is assumed
-            int noColsTransformed = 0;
-            static Matrix localTtKT;
-      
-      if(Ti != 0 && Tj != 0) {
-        noRowsTransformed = Ti->noCols();
-        noColsTransformed = Tj->noCols();
-        // CHECK SIZE OF BUFFFER
-        localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-        localTtKT = (*Ti) ^ localK * (*Tj);
-      } else if(Ti == 0 && Tj != 0) {
-        noRowsTransformed = numDOFi;
-        noColsTransformed = Tj->noCols();
-        // CHECK SIZE OF BUFFFER
-        localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-        // localTtKT = localK * (*Tj);               
-        localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-      } else if(Ti != 0 && Tj == 0) {
-        noRowsTransformed = Ti->noCols();
-        noColsTransformed = numDOFj;
-        // CHECK SIZE OF BUFFFER
-        localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-        localTtKT = (*Ti) ^ localK;
-      } else {
-        noRowsTransformed = numDOFi;
-        noColsTransformed = numDOFj;
-        localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-        localTtKT = localK;
-      }
-      // now copy into modTangent the T(i)^t K(i,j) T(j) product
-      for(int c=0; c<noRowsTransformed; c++) 
-        for(int d=0; d<noColsTransformed; d++) 
-          (unbalAndTangentMod.getTangent())(startRow+c, startCol+d) = localTtKT(c,d);
-      
-      startCol += noColsTransformed;
-      noColsOriginal += numDOFj;
-    }
-    
-    noRowsOriginal += numDOFi;
-    startRow += noRowsTransformed;
-  }
-  
-  // get the components we need out of the vector
-  // and place in a temporary vector
-  Vector tmp(numTransformedDOF);
-  for(int j=0; j<numTransformedDOF; j++) {
-    int dof = modID(j);
-    if(dof >= 0)
-      tmp(j) = accel(dof);
-    else
-      tmp(j) = 0.0;
+    return getForce(theTangent, accel);
   }
 
-  unbalAndTangentMod.getResidual().addMatrixVector(0.0, unbalAndTangentMod.getTangent(), tmp, 1.0);
-
-  return unbalAndTangentMod.getResidual();
-}
-
 const XC::Vector &XC::TransformationFE::getC_Force(const XC::Vector &accel, double fact)
-{
-  this->FE_Element::zeroTangent();    
-  this->FE_Element::addCtoTang();    
-  const Matrix &theTangent = this->XC::FE_Element::getTangent(0);
-
-  static IntPtrWrapper numDOFs(dofData.getDataPtr(), 1);
-  numDOFs.setData(dofData.getDataPtr(), numGroups);
-    
-  // DO THE SP STUFF TO THE TANGENT 
-  
-  // get the transformation matrix from each dof group & number of local dof
-  // for original node.
-  int numNode = numGroups;
-  for(int a = 0; a<numNode; a++)
-    {
-      Matrix *theT = theDOFs[a]->getT();
-      theTransformations[a] = theT;
-      if(theT != 0)
-        numDOFs[a] = theT->noRows(); // T^ 
-      else
-        numDOFs[a] = theDOFs[a]->getNumDOF();
-    }
-  
-  // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-  // where blocks are of size equal to num ele dof at a node
-  
-  int startRow = 0;
-  int noRowsTransformed = 0;
-  int noRowsOriginal = 0;
-  
-  static XC::Matrix localK;
-  
-  // foreach block row, for each block col do
-  for(int i=0; i<numNode; i++) {
-    
-    int startCol = 0;
-    int numDOFi = numDOFs[i];        
-    int noColsOriginal = 0;
-    
-    for(int j=0; j<numNode; j++)
-      {
-        const Matrix *Ti= theTransformations[i];
-        const Matrix *Tj= theTransformations[j];
-      int numDOFj = numDOFs[j];        
-      localK.setData(localKbuffer.getDataPtr(), numDOFi, numDOFj);
-      
-      // copy K(i,j) into localK matrix
-      // CHECK SIZE OF BUFFFER            
-      for(int a=0; a<numDOFi; a++)
-        for(int b=0; b<numDOFj; b++)
-          localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-      
-      // now perform the matrix computation T(i)^T localK T(j)
-      // note: if T == 0 then the Identity is assumed
-      int noColsTransformed = 0;
-      static XC::Matrix localTtKT;
-      
-      if(Ti != 0 && Tj != 0) {
-        noRowsTransformed = Ti->noCols();
-        noColsTransformed = Tj->noCols();
-        // CHECK SIZE OF BUFFFER
-        localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-        localTtKT = (*Ti) ^ localK * (*Tj);
-      } else if(Ti == 0 && Tj != 0) {
-        noRowsTransformed = numDOFi;
-        noColsTransformed = Tj->noCols();
-        // CHECK SIZE OF BUFFFER
-        localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-        // localTtKT = localK * (*Tj);               
-        localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-      } else if(Ti != 0 && Tj == 0) {
-        noRowsTransformed = Ti->noCols();
-        noColsTransformed = numDOFj;
-        // CHECK SIZE OF BUFFFER
-        localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-        localTtKT = (*Ti) ^ localK;
-      } else {
-        noRowsTransformed = numDOFi;
-        noColsTransformed = numDOFj;
-        localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-        localTtKT = localK;
-      }
-      // now copy into modTangent the T(i)^t K(i,j) T(j) product
-      for(int c=0; c<noRowsTransformed; c++) 
-        for(int d=0; d<noColsTransformed; d++) 
-          (unbalAndTangentMod.getTangent())(startRow+c, startCol+d) = localTtKT(c,d);
-      
-      startCol += noColsTransformed;
-      noColsOriginal += numDOFj;
-    }
-    
-    noRowsOriginal += numDOFi;
-    startRow += noRowsTransformed;
-  }
-  
-  // get the components we need out of the vector
-  // and place in a temporary vector
-  Vector tmp(numTransformedDOF);
-  for(int j=0; j<numTransformedDOF; j++) {
-    int dof = modID(j);
-    if(dof >= 0)
-      tmp(j) = accel(dof);
-    else
-      tmp(j) = 0.0;
+  {
+    this->FE_Element::zeroTangent();    
+    this->FE_Element::addCtoTang();    
+    const Matrix &theTangent = this->XC::FE_Element::getTangent(0);
+    return getForce(theTangent, accel);
   }
 
-  unbalAndTangentMod.getResidual().addMatrixVector(0.0, unbalAndTangentMod.getTangent(), tmp, 1.0);
-
-  return unbalAndTangentMod.getResidual();
-}
-
-
 void XC::TransformationFE::addD_Force(const XC::Vector &disp,  double fact)
   {
     if(fact == 0.0)
       return;
 
-    static Vector response;
-    response.setData(dataBuffer.getDataPtr(), numOriginalDOF);
-                    
     for(int i=0; i<numTransformedDOF; i++) {
         int loc = modID(i);
         if(loc >= 0)
@@ -711,8 +368,8 @@ void XC::TransformationFE::addD_Force(const XC::Vector &disp,  double fact)
         else
             (unbalAndTangentMod.getResidual())(i) = 0.0;
     }
-    transformResponse(unbalAndTangentMod.getResidual(), response);
-    this->addLocalD_Force(response, fact);
+    transformResponse(unbalAndTangentMod.getResidual(), unmodResponse);
+    this->addLocalD_Force(unmodResponse, fact);
   }            
 
 void XC::TransformationFE::addM_Force(const XC::Vector &disp,  double fact)
@@ -720,9 +377,6 @@ void XC::TransformationFE::addM_Force(const XC::Vector &disp,  double fact)
     if(fact == 0.0)
         return;
 
-    static Vector response;
-    response.setData(dataBuffer.getDataPtr(), numOriginalDOF);
-                    
     for(int i=0; i<numTransformedDOF; i++) {
         int loc = modID(i);
         if(loc >= 0)
@@ -730,8 +384,8 @@ void XC::TransformationFE::addM_Force(const XC::Vector &disp,  double fact)
         else
             (unbalAndTangentMod.getResidual())(i) = 0.0;
     }
-    transformResponse(unbalAndTangentMod.getResidual(), response);
-    this->addLocalM_Force(response, fact);
+    transformResponse(unbalAndTangentMod.getResidual(), unmodResponse);
+    this->addLocalM_Force(unmodResponse, fact);
   }            
 
 
@@ -763,39 +417,26 @@ const XC::Vector &XC::TransformationFE::getLastResponse(void)
 int XC::TransformationFE::transformResponse(const XC::Vector &modResp, 
                                     Vector &unmodResp)
   {
-    // perform T R  -- as T is block diagonal do T(i) R(i)
-    // where blocks are of size equal to num ele dof at a node
-
-    int startRowOriginal = 0;
-    int startRowTransformed = 0;
-    int numNode = numGroups;
-    int noRows = 0;
-    int noCols = 0;
-
-    for(int i=0; i<numNode; i++) {
-        const Matrix *Ti = theDOFs[i]->getT();
-        if(Ti != 0) {
-            noRows = Ti->noRows();
-            noCols = Ti->noCols();
-            for(int j=0; j<noRows; j++) {
-                double sum = 0.0;
-                for(int k=0; k<noCols; k++)
-                    sum += (*Ti)(j,k) * modResp(startRowTransformed +k) ;
-                unmodResp(startRowOriginal + j) = sum;
-            }
-        } else {
-            noCols = theDOFs[i]->getNumDOF();
-            noRows = noCols;
-            for(int j=0; j<noCols; j++)
-                unmodResp(startRowOriginal + j) = modResp(startRowTransformed +j);
-        }
-        startRowOriginal += noRows;
-        startRowTransformed += noCols;
-    }
-
+    // perform T R using the non-zero coefficients of T
+    updateTransformation();
+    if(identityT)
+      {
+        for(int i=0; i<numOriginalDOF; i++)
+          unmodResp(i)= modResp(i);
+      }
+    else
+      {
+        for(int i=0; i<numOriginalDOF; i++)
+          unmodResp(i)= 0.0;
+        for(int c=0; c<numTransformedDOF; c++)
+          {
+            const double v= modResp(c);
+            for(int k=transColPtr[c]; k<transColPtr[c+1]; k++)
+              unmodResp(transRowIdx[k])+= transValues[k]*v;
+          }
+      }
     return 0;
-}
-
+  }
 
 // AddingSensitivity:BEGIN /////////////////////////////////
 void XC::TransformationFE::addD_ForceSensitivity(int gradNumber, const XC::Vector &disp,  double fact)
@@ -803,9 +444,6 @@ void XC::TransformationFE::addD_ForceSensitivity(int gradNumber, const XC::Vecto
     if(fact == 0.0)
         return;
 
-    static Vector response;
-    response.setData(dataBuffer.getDataPtr(), numOriginalDOF);
-                    
     for(int i=0; i<numTransformedDOF; i++) {
         int loc = modID(i);
         if(loc >= 0)
@@ -813,8 +451,8 @@ void XC::TransformationFE::addD_ForceSensitivity(int gradNumber, const XC::Vecto
         else
             (unbalAndTangentMod.getResidual())(i) = 0.0;
     }
-    transformResponse(unbalAndTangentMod.getResidual(), response);
-    this->addLocalD_ForceSensitivity(gradNumber, response, fact);
+    transformResponse(unbalAndTangentMod.getResidual(), unmodResponse);
+    this->addLocalD_ForceSensitivity(gradNumber, unmodResponse, fact);
 }            
 
 void XC::TransformationFE::addM_ForceSensitivity(int gradNumber, const XC::Vector &disp,  double fact)
@@ -822,9 +460,6 @@ void XC::TransformationFE::addM_ForceSensitivity(int gradNumber, const XC::Vecto
     if(fact == 0.0)
         return;
 
-    static Vector response;
-    response.setData(dataBuffer.getDataPtr(), numOriginalDOF);
-                    
     for(int i=0; i<numTransformedDOF; i++) {
         int loc = modID(i);
         if(loc >= 0)
@@ -832,8 +467,8 @@ void XC::TransformationFE::addM_ForceSensitivity(int gradNumber, const XC::Vecto
         else
             (unbalAndTangentMod.getResidual())(i) = 0.0;
     }
-    transformResponse(unbalAndTangentMod.getResidual(), response);
-    this->addLocalM_ForceSensitivity(gradNumber, response, fact);
+    transformResponse(unbalAndTangentMod.getResidual(), unmodResponse);
+    this->addLocalM_ForceSensitivity(gradNumber, unmodResponse, fact);
   }            
 
 // AddingSensitivity:END ////////////////////////////////////
@@ -68,6 +68,7 @@
 namespace XC {
 class SFreedom_Constraint;
 class DOF_Group;
+class TransformationDOF_Group;
 class TransformationConstraintHandler;
 
 //! @ingroup AnalysisFE
@@ -90,22 +91,32 @@ class TransformationFE: public FE_Element
   {
   private:
     std::vector<DOF_Group *> theDOFs; //!< DOF groups.
+    std::vector<TransformationDOF_Group *> theTransDOFs; //!< DOF groups that can have a transformation matrix (nullptr otherwise).
     ID modID;
     int numGroups;
     int numTransformedDOF;
     int numOriginalDOF;
+    UnbalAndTangentStorage unbalAndTangentStorageMod; //!< storage only for the zero size case (the tangent and the residual are owned by each object).
     UnbalAndTangent unbalAndTangentMod;
+
+    // block diagonal transformation matrix of the element
+    // (compressed sparse column format).
+    std::vector<int> transColPtr; //!< position of the first coefficient of each column.
+    std::vector<int> transRowIdx; //!< row index of each coefficient.
+    std::vector<double> transValues; //!< non-zero coefficients.
+    bool identityT; //!< true if no DOF group has a transformation matrix.
+    bool timeVaryingT; //!< true if the transformation must be recomputed each time.
+    Matrix KT; //!< work matrix to store the product K*T.
+    Vector unmodResponse; //!< work vector to store the response in the original DOFs.
     
     // static variables - single copy for all objects of the class	
-    static UnbalAndTangentStorage unbalAndTangentArrayMod; //!< array of class wide vectors and matrices
-    static std::vector<Matrix *> theTransformations; //!< for holding pointers to the T matrices
     static int numTransFE;     //!< number of objects    
-    static int transCounter;   //!< a counter used to indicate when to do something
-    static int sizeTransformations; //!< size of theTransformations array
-    static Vector dataBuffer;
-    static Vector localKbuffer;
-    static ID dofData;
-    static int sizeBuffer;
+
+    void formTransformation(void);
+    void updateTransformation(void);
+    const Matrix &transformTangent(const Matrix &);
+    const Vector &transformResidual(const Vector &);
+    const Vector &getForce(const Matrix &, const Vector &);
   protected:
     int transformResponse(const Vector &modResponse, Vector &unmodResponse);
  
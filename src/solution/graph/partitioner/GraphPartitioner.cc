@@ -0,0 +1,61 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//GraphPartitioner.cc
+
+#include "GraphPartitioner.h"
+#include "MultilevelPartitioner.h"
+#ifdef HAVE_METIS
+#include "Metis.h"
+#endif
+#include <iostream>
+
+//! @brief Returns a new graph partitioner of the type being passed
+//! as parameter:
+//! - "metis": partitioner that uses the METIS library (only if
+//!   XC has been built with it).
+//! - "multilevel": built-in multilevel partitioner (see
+//!   MultilevelPartitioner).
+//! - "default": Metis if available, MultilevelPartitioner otherwise.
+//! Returns nullptr if the type is not available.
+XC::GraphPartitioner *XC::newGraphPartitioner(const std::string &type)
+  {
+    GraphPartitioner *retval= nullptr;
+    if(type=="multilevel")
+      retval= new MultilevelPartitioner();
+    else if((type=="metis") || (type=="default"))
+      {
+#ifdef HAVE_METIS
+        retval= new Metis();
+#else
+        if(type=="default")
+          retval= new MultilevelPartitioner();
+        else
+          std::cerr << __FUNCTION__
+                    << "; XC has been built without the METIS library.\n";
+#endif
+      }
+    else
+      std::cerr << __FUNCTION__
+                << "; unknown graph partitioner type: '"
+                << type << "'.\n";
+    return retval;
+  }
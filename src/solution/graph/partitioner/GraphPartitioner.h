@@ -66,6 +66,8 @@
 #ifndef GraphPartitioner_h
 #define GraphPartitioner_h
 
+#include <string>
+
 namespace XC {
 class ID;
 class Graph;
@@ -87,6 +89,8 @@ class GraphPartitioner
     //! @breif Constructor.
     GraphPartitioner(void) {};
   public:
+    //! @brief Destructor.
+    virtual ~GraphPartitioner(void) {}
     //! @brief Method invoked to partition the graph.
     //!
     //! This is the method invoked to partition the graph into \p numPart
@@ -96,6 +100,8 @@ class GraphPartitioner
     //! negative number if not; the value depending on the subclass.
     virtual int partition(Graph &theGraph, int numPart) =0;
   };
+
+GraphPartitioner *newGraphPartitioner(const std::string &type= "default");
 } // end of XC namespace
 
 #endif
@@ -0,0 +1,544 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MultilevelPartitioner.cc
+
+#include "MultilevelPartitioner.h"
+#include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/Vertex.h"
+#include <queue>
+#include <algorithm>
+#include <iostream>
+
+//! @brief Return the sum of the vertex weights.
+double XC::MultilevelPartitioner::CSRGraph::getTotalWeight(void) const
+  {
+    double retval= 0.0;
+    for(std::vector<double>::const_iterator i= vwgt.begin();i!=vwgt.end();i++)
+      retval+= *i;
+    return retval;
+  }
+
+//! @brief Constructor.
+//!
+//! @param ct: number of vertices per partition in the coarsest graph.
+//! @param imb: allowed imbalance (max. part weight/mean part weight).
+//! @param np: maximum number of refinement passes for each level.
+XC::MultilevelPartitioner::MultilevelPartitioner(int ct, double imb, int np)
+  : GraphPartitioner(), coarsenTo(std::max(ct,1)),
+    imbalance(std::max(imb,1.0)), numPasses(np), maxNegativeMoves(50)
+  {}
+
+//! @brief Set the number of vertices per partition in the coarsest graph.
+void XC::MultilevelPartitioner::setCoarsenTo(int ct)
+  { coarsenTo= std::max(ct,1); }
+
+//! @brief Return the number of vertices per partition in the coarsest graph.
+int XC::MultilevelPartitioner::getCoarsenTo(void) const
+  { return coarsenTo; }
+
+//! @brief Set the allowed imbalance (max. part weight/mean part weight).
+void XC::MultilevelPartitioner::setImbalance(double imb)
+  { imbalance= std::max(imb,1.0); }
+
+//! @brief Return the allowed imbalance.
+double XC::MultilevelPartitioner::getImbalance(void) const
+  { return imbalance; }
+
+//! @brief Set the maximum number of refinement passes for each level.
+void XC::MultilevelPartitioner::setNumPasses(int np)
+  { numPasses= np; }
+
+//! @brief Return the maximum number of refinement passes for each level.
+int XC::MultilevelPartitioner::getNumPasses(void) const
+  { return numPasses; }
+
+//! @brief Return the sum of the weights of the edges whose vertices
+//! belong to different parts.
+double XC::MultilevelPartitioner::getEdgeCut(const CSRGraph &g, const std::vector<int> &part)
+  {
+    double retval= 0.0;
+    const int n= g.getNumVertex();
+    for(int v= 0;v<n;v++)
+      for(int j= g.xadj[v];j<g.xadj[v+1];j++)
+        if(part[g.adjncy[j]]!=part[v])
+          retval+= g.adjwgt[j];
+    return retval/2.0;
+  }
+
+//! @brief Computes the connectivity of the vertex with each
+//! of the parts (sum of the weights of the edges that join the
+//! vertex with the part). On return, parts contains the
+//! indexes of the parts adjacent to the vertex.
+static void compute_connectivity(const XC::MultilevelPartitioner::CSRGraph &g, const std::vector<int> &part, int v, std::vector<double> &conn, std::vector<int> &parts)
+  {
+    for(std::vector<int>::const_iterator i= parts.begin();i!=parts.end();i++)
+      conn[*i]= 0.0;
+    parts.clear();
+    for(int j= g.xadj[v];j<g.xadj[v+1];j++)
+      {
+        const int p= part[g.adjncy[j]];
+        if(std::find(parts.begin(),parts.end(),p)==parts.end())
+          parts.push_back(p);
+        conn[p]+= g.adjwgt[j];
+      }
+  }
+
+//! @brief Return the best part to move the vertex to (-1 if none) and
+//! the corresponding reduction of the edge cut (gain). Only the parts
+//! adjacent to the vertex are considered and the move must not
+//! exceed the maximum part weight (unless it reduces the imbalance).
+static int best_move(const XC::MultilevelPartitioner::CSRGraph &g, const std::vector<int> &part, const std::vector<double> &pw, double maxW, int v, std::vector<double> &conn, std::vector<int> &parts, double &gain)
+  {
+    compute_connectivity(g,part,v,conn,parts);
+    const int from= part[v];
+    int retval= -1;
+    gain= 0.0;
+    for(std::vector<int>::const_iterator i= parts.begin();i!=parts.end();i++)
+      {
+        const int p= *i;
+        if(p!=from)
+          {
+            const double newW= pw[p]+g.vwgt[v];
+            if((newW<=maxW) || (newW<pw[from]))
+              {
+                const double g_p= conn[p]-conn[from];
+                if((retval<0) || (g_p>gain) || ((g_p==gain) && (pw[p]<pw[retval])))
+                  {
+                    retval= p;
+                    gain= g_p;
+                  }
+              }
+          }
+      }
+    return retval;
+  }
+
+//! @brief Return the sum of the part weights in excess of maxW.
+static double overload(const std::vector<double> &pw, double maxW)
+  {
+    double retval= 0.0;
+    for(std::vector<double>::const_iterator i= pw.begin();i!=pw.end();i++)
+      if(*i>maxW)
+        retval+= *i-maxW;
+    return retval;
+  }
+
+//! @brief Builds the coarse graph by contracting the edges
+//! of a heavy edge matching. Returns false if the graph can't
+//! be coarsened any more.
+//!
+//! @param g: graph to coarsen.
+//! @param cg: coarse graph.
+//! @param cmap: index of the coarse vertex for each vertex of g.
+//! @param maxVWgt: maximum weight of a coarse vertex.
+bool XC::MultilevelPartitioner::coarsen(const CSRGraph &g, CSRGraph &cg, std::vector<int> &cmap, double maxVWgt) const
+  {
+    const int n= g.getNumVertex();
+    std::vector<int> match(n,-1);
+    // visit the vertices in increasing degree order, so the
+    // vertices with few neighbours have more chances to be matched.
+    std::vector<int> order(n);
+    for(int v= 0;v<n;v++)
+      order[v]= v;
+    std::stable_sort(order.begin(),order.end(),[&g](int a, int b)
+                     { return (g.xadj[a+1]-g.xadj[a])<(g.xadj[b+1]-g.xadj[b]); });
+    for(std::vector<int>::const_iterator i= order.begin();i!=order.end();i++)
+      {
+        const int v= *i;
+        if(match[v]<0)
+          {
+            int best= -1;
+            double bestW= -1.0;
+            for(int j= g.xadj[v];j<g.xadj[v+1];j++)
+              {
+                const int u= g.adjncy[j];
+                if((match[u]<0) && (u!=v) && ((g.vwgt[v]+g.vwgt[u])<=maxVWgt))
+                  if((g.adjwgt[j]>bestW) || ((g.adjwgt[j]==bestW) && (g.vwgt[u]<g.vwgt[best])))
+                    {
+                      best= u;
+                      bestW= g.adjwgt[j];
+                    }
+              }
+            if(best<0)
+              match[v]= v;
+            else
+              {
+                match[v]= best;
+                match[best]= v;
+              }
+          }
+      }
+
+    // number the coarse vertices.
+    cmap.assign(n,-1);
+    std::vector<int> first;
+    for(int v= 0;v<n;v++)
+      if(cmap[v]<0)
+        {
+          const int c= first.size();
+          cmap[v]= c;
+          cmap[match[v]]= c;
+          first.push_back(v);
+        }
+    const int nc= first.size();
+    if(nc>0.95*n) // not enough contraction.
+      return false;
+
+    // build the coarse graph merging the adjacencies of the matched vertices.
+    cg.vwgt.assign(nc,0.0);
+    cg.xadj.assign(nc+1,0);
+    cg.adjncy.clear();
+    cg.adjwgt.clear();
+    std::vector<int> pos(nc,-1);
+    for(int c= 0;c<nc;c++)
+      {
+        const int start= cg.adjncy.size();
+        const int v= first[c];
+        const int fine[2]= {v, match[v]};
+        const int numFine= (match[v]==v) ? 1 : 2;
+        for(int f= 0;f<numFine;f++)
+          {
+            const int w= fine[f];
+            cg.vwgt[c]+= g.vwgt[w];
+            for(int j= g.xadj[w];j<g.xadj[w+1];j++)
+              {
+                const int cu= cmap[g.adjncy[j]];
+                if(cu!=c)
+                  {
+                    if(pos[cu]>=start) // already in the adjacency of c.
+                      cg.adjwgt[pos[cu]]+= g.adjwgt[j];
+                    else
+                      {
+                        pos[cu]= cg.adjncy.size();
+                        cg.adjncy.push_back(cu);
+                        cg.adjwgt.push_back(g.adjwgt[j]);
+                      }
+                  }
+              }
+          }
+        cg.xadj[c+1]= cg.adjncy.size();
+      }
+    return true;
+  }
+
+//! @brief Computes a k-way partition of the (coarse) graph by greedy
+//! graph growing: each part grows from a seed vertex adding the
+//! vertex most connected to the part until it reaches its share of
+//! the weight.
+void XC::MultilevelPartitioner::initialPartition(const CSRGraph &g, std::vector<int> &part, int k) const
+  {
+    const int n= g.getNumVertex();
+    part.assign(n,-1);
+    std::vector<double> conn(n,0.0); // connectivity with the growing part.
+    double remaining= g.getTotalWeight();
+    int assigned= 0;
+    int seed= 0;
+    for(int p= 0;(p<k) && (assigned<n);p++)
+      {
+        if(p==k-1) // last part: remaining vertices.
+          {
+            for(int v= 0;v<n;v++)
+              if(part[v]<0)
+                part[v]= p;
+            break;
+          }
+        const double target= remaining/(k-p);
+        double w= 0.0;
+        std::priority_queue<std::pair<double,int> > frontier;
+        std::vector<int> touched;
+        while((w<target) && (assigned<n))
+          {
+            int v= -1;
+            while(!frontier.empty())
+              {
+                const std::pair<double,int> top= frontier.top();
+                frontier.pop();
+                if((part[top.second]<0) && (top.first==conn[top.second]))
+                  {
+                    v= top.second;
+                    break;
+                  }
+              }
+            if(v<0) // new seed (disconnected graph or first vertex).
+              {
+                while(part[seed]>=0)
+                  seed++;
+                v= seed;
+              }
+            // don't overshoot the target more than we fall short of it.
+            if((w>0.0) && ((w+g.vwgt[v]-target)>(target-w)))
+              break;
+            part[v]= p;
+            w+= g.vwgt[v];
+            assigned++;
+            for(int j= g.xadj[v];j<g.xadj[v+1];j++)
+              {
+                const int u= g.adjncy[j];
+                if(part[u]<0)
+                  {
+                    if(conn[u]==0.0)
+                      touched.push_back(u);
+                    conn[u]+= g.adjwgt[j];
+                    frontier.push(std::make_pair(conn[u],u));
+                  }
+              }
+          }
+        for(std::vector<int>::const_iterator i= touched.begin();i!=touched.end();i++)
+          conn[*i]= 0.0;
+        remaining-= w;
+      }
+  }
+
+//! @brief Moves vertices out of the overweight parts to the
+//! adjacent parts that can receive them.
+void XC::MultilevelPartitioner::balance(const CSRGraph &g, std::vector<int> &part, std::vector<double> &pw, int k, double maxW) const
+  {
+    const int n= g.getNumVertex();
+    std::vector<double> conn(k,0.0);
+    std::vector<int> parts;
+    for(int sweep= 0;sweep<numPasses;sweep++)
+      {
+        bool overloaded= false;
+        bool moved= false;
+        for(int v= 0;v<n;v++)
+          {
+            const int from= part[v];
+            if(pw[from]>maxW)
+              {
+                overloaded= true;
+                compute_connectivity(g,part,v,conn,parts);
+                int to= -1;
+                double bestGain= 0.0;
+                for(std::vector<int>::const_iterator i= parts.begin();i!=parts.end();i++)
+                  {
+                    const int p= *i;
+                    if((p!=from) && (pw[p]+g.vwgt[v]<=maxW))
+                      {
+                        const double gain= conn[p]-conn[from];
+                        if((to<0) || (gain>bestGain))
+                          {
+                            to= p;
+                            bestGain= gain;
+                          }
+                      }
+                  }
+                if(to>=0)
+                  {
+                    part[v]= to;
+                    pw[from]-= g.vwgt[v];
+                    pw[to]+= g.vwgt[v];
+                    moved= true;
+                  }
+              }
+          }
+        if(!overloaded || !moved)
+          break;
+      }
+  }
+
+//! @brief Improves the partition with a k-way version of the
+//! Fiduccia-Mattheyses algorithm: on each pass the boundary vertices
+//! are moved (each one at most once) in decreasing gain order,
+//! accepting moves with negative gain to escape from local minima, and
+//! then the moves after the best partition found are undone.
+void XC::MultilevelPartitioner::refine(const CSRGraph &g, std::vector<int> &part, int k) const
+  {
+    const int n= g.getNumVertex();
+    const double maxW= imbalance*g.getTotalWeight()/k;
+    const double eps= 1e-9*maxW;
+    std::vector<double> pw(k,0.0);
+    for(int v= 0;v<n;v++)
+      pw[part[v]]+= g.vwgt[v];
+    balance(g,part,pw,k,maxW);
+
+    std::vector<double> conn(k,0.0);
+    std::vector<int> parts;
+    double cut= getEdgeCut(g,part);
+    for(int pass= 0;pass<numPasses;pass++)
+      {
+        std::vector<bool> locked(n,false);
+        std::priority_queue<std::pair<double,int> > pq;
+        double gain= 0.0;
+        for(int v= 0;v<n;v++)
+          if(best_move(g,part,pw,maxW,v,conn,parts,gain)>=0)
+            pq.push(std::make_pair(gain,v));
+
+        std::vector<std::pair<int,int> > moves; // (vertex, previous part).
+        double currentCut= cut, bestCut= cut;
+        double bestOverload= overload(pw,maxW);
+        size_t bestIdx= 0;
+        int nonImproving= 0;
+        while(!pq.empty() && (nonImproving<maxNegativeMoves))
+          {
+            const std::pair<double,int> top= pq.top();
+            pq.pop();
+            const int v= top.second;
+            if(locked[v])
+              continue;
+            const int to= best_move(g,part,pw,maxW,v,conn,parts,gain);
+            if(to<0)
+              continue;
+            if(gain<top.first) // stale entry.
+              {
+                pq.push(std::make_pair(gain,v));
+                continue;
+              }
+            const int from= part[v];
+            part[v]= to;
+            pw[from]-= g.vwgt[v];
+            pw[to]+= g.vwgt[v];
+            locked[v]= true;
+            moves.push_back(std::make_pair(v,from));
+            currentCut-= gain;
+            const double currentOverload= overload(pw,maxW);
+            if((currentOverload<bestOverload-eps) || ((currentOverload<=bestOverload+eps) && (currentCut<bestCut-1e-12)))
+              {
+                bestCut= currentCut;
+                bestOverload= currentOverload;
+                bestIdx= moves.size();
+                nonImproving= 0;
+              }
+            else
+              nonImproving++;
+            for(int j= g.xadj[v];j<g.xadj[v+1];j++)
+              {
+                const int u= g.adjncy[j];
+                if(!locked[u] && (best_move(g,part,pw,maxW,u,conn,parts,gain)>=0))
+                  pq.push(std::make_pair(gain,u));
+              }
+          }
+        // undo the moves made after the best partition.
+        while(moves.size()>bestIdx)
+          {
+            const int v= moves.back().first;
+            const int prev= moves.back().second;
+            pw[part[v]]-= g.vwgt[v];
+            pw[prev]+= g.vwgt[v];
+            part[v]= prev;
+            moves.pop_back();
+          }
+        cut= bestCut;
+        if(bestIdx==0) // no improvement.
+          break;
+      }
+  }
+
+//! @brief Computes a partition of the graph in k parts.
+//!
+//! @param g: graph to partition.
+//! @param k: number of parts.
+//! @param part: part (0 through k-1) assigned to each vertex.
+int XC::MultilevelPartitioner::partition(const CSRGraph &g, int k, std::vector<int> &part) const
+  {
+    if(k<1)
+      {
+        std::cerr << "MultilevelPartitioner::" << __FUNCTION__
+                  << "; wrong number of partitions: " << k << std::endl;
+        return -1;
+      }
+    const int n= g.getNumVertex();
+    part.assign(n,0);
+    if((k==1) || (n==0))
+      return 0;
+    if(n<=k) // one vertex for each part.
+      {
+        for(int v= 0;v<n;v++)
+          part[v]= v;
+        return 0;
+      }
+
+    // coarsening phase.
+    std::vector<CSRGraph> levels(1,g);
+    std::vector<std::vector<int> > cmaps;
+    const int target= coarsenTo*k;
+    const double maxVWgt= 1.5*g.getTotalWeight()/target;
+    while(levels.back().getNumVertex()>target)
+      {
+        CSRGraph cg;
+        std::vector<int> cmap;
+        if(!coarsen(levels.back(),cg,cmap,maxVWgt))
+          break;
+        levels.push_back(cg);
+        cmaps.push_back(cmap);
+      }
+
+    // initial partition of the coarsest graph.
+    std::vector<int> cpart;
+    initialPartition(levels.back(),cpart,k);
+    refine(levels.back(),cpart,k);
+
+    // uncoarsening phase.
+    for(int l= cmaps.size()-1;l>=0;l--)
+      {
+        const std::vector<int> &cmap= cmaps[l];
+        std::vector<int> fpart(cmap.size());
+        for(size_t v= 0;v<cmap.size();v++)
+          fpart[v]= cpart[cmap[v]];
+        cpart.swap(fpart);
+        refine(levels[l],cpart,k);
+      }
+    part.swap(cpart);
+    return 0;
+  }
+
+//! @brief Partitions the graph in numPart parts, assigning to each
+//! vertex a color from 1 through numPart.
+int XC::MultilevelPartitioner::partition(Graph &theGraph, int numPart)
+  {
+    const int numVertex= theGraph.getNumVertex();
+    CSRGraph g;
+    g.xadj.assign(numVertex+1,0);
+    g.vwgt.assign(numVertex,0.0);
+    g.adjncy.reserve(2*theGraph.getNumEdge());
+    for(int v= 0;v<numVertex;v++)
+      {
+        const Vertex *vertexPtr= theGraph.getVertexPtr(v+START_VERTEX_NUM);
+        if(!vertexPtr)
+          {
+            std::cerr << "MultilevelPartitioner::" << __FUNCTION__
+                      << "; WARNING no partitioning done,"
+                      << " consecutive vertex numbering required.\n";
+            return -2;
+          }
+        g.vwgt[v]= std::max(vertexPtr->getWeight(),0.0);
+        const std::set<int> &adjacency= vertexPtr->getAdjacency();
+        for(std::set<int>::const_iterator i= adjacency.begin();i!=adjacency.end();i++)
+          {
+            const int u= *i-START_VERTEX_NUM;
+            if(u!=v)
+              {
+                g.adjncy.push_back(u);
+                g.adjwgt.push_back(1.0);
+              }
+          }
+        g.xadj[v+1]= g.adjncy.size();
+      }
+    if(g.getTotalWeight()<=0.0) // no weights, each vertex weights one.
+      g.vwgt.assign(numVertex,1.0);
+
+    std::vector<int> part;
+    const int retval= partition(g,numPart,part);
+    if(retval==0)
+      for(int v= 0;v<numVertex;v++)
+        theGraph.getVertexPtr(v+START_VERTEX_NUM)->setColor(part[v]+1); // start colors at 1
+    return retval;
+  }
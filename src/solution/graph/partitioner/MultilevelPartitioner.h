@@ -0,0 +1,87 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MultilevelPartitioner.h
+
+#ifndef MultilevelPartitioner_h
+#define MultilevelPartitioner_h
+
+#include "solution/graph/partitioner/GraphPartitioner.h"
+#include <vector>
+
+namespace XC {
+
+//! @ingroup Graph
+//
+//! @brief Multilevel k-way graph partitioner that doesn't depend
+//! on external libraries.
+//!
+//! The graph is coarsened by heavy edge matching until it has
+//! a few vertices for each partition, then the coarsest graph is
+//! partitioned by greedy graph growing and the partition is projected
+//! back to the original graph, refining it at each level with a
+//! Fiduccia-Mattheyses (FM) boundary refinement.
+//!
+//! The vertex weights of the graph (see Vertex::getWeight) are used
+//! to balance the partitions (if all of them are zero, each vertex
+//! weights one). As Metis, it requires the vertices to be labeled
+//! START_VERTEX_NUM through numVertex-1+START_VERTEX_NUM.
+class MultilevelPartitioner: public GraphPartitioner
+  {
+  public:
+    //! @brief Graph in compressed sparse row format.
+    struct CSRGraph
+      {
+        std::vector<int> xadj; //!< start of the adjacency of each vertex in adjncy.
+        std::vector<int> adjncy; //!< adjacent vertices.
+        std::vector<double> adjwgt; //!< edge weights.
+        std::vector<double> vwgt; //!< vertex weights.
+        inline int getNumVertex(void) const
+          { return vwgt.size(); }
+        double getTotalWeight(void) const;
+      };
+  private:
+    int coarsenTo; //!< number of vertices per partition in the coarsest graph.
+    double imbalance; //!< allowed imbalance (max. part weight/mean part weight).
+    int numPasses; //!< maximum number of FM passes for each level.
+    int maxNegativeMoves; //!< FM moves without improvement before ending the pass.
+
+    bool coarsen(const CSRGraph &, CSRGraph &, std::vector<int> &, double) const;
+    void initialPartition(const CSRGraph &, std::vector<int> &, int) const;
+    void balance(const CSRGraph &, std::vector<int> &, std::vector<double> &, int, double) const;
+    void refine(const CSRGraph &, std::vector<int> &, int) const;
+  public:
+    MultilevelPartitioner(int coarsenTo= 20, double imbalance= 1.03, int numPasses= 8);
+
+    void setCoarsenTo(int);
+    int getCoarsenTo(void) const;
+    void setImbalance(double);
+    double getImbalance(void) const;
+    void setNumPasses(int);
+    int getNumPasses(void) const;
+
+    int partition(const CSRGraph &, int, std::vector<int> &) const;
+    int partition(Graph &theGraph, int numPart);
+    static double getEdgeCut(const CSRGraph &, const std::vector<int> &);
+  };
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,32 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//python_interface.tcc
+
+class_<XC::GraphPartitioner, boost::noncopyable >("GraphPartitioner", "Base class for the graph partitioners (see Mesh.getElementPartitions).", no_init);
+
+class_<XC::MultilevelPartitioner, bases<XC::GraphPartitioner>, boost::noncopyable >("MultilevelPartitioner", "Built-in multilevel k-way graph partitioner (heavy edge matching, greedy graph growing and Fiduccia-Mattheyses refinement).")
+  .add_property("coarsenTo", &XC::MultilevelPartitioner::getCoarsenTo, &XC::MultilevelPartitioner::setCoarsenTo,"Number of vertices per part in the coarsest graph.")
+  .add_property("imbalance", &XC::MultilevelPartitioner::getImbalance, &XC::MultilevelPartitioner::setImbalance,"Allowed imbalance (maximum part weight/mean part weight).")
+  .add_property("numPasses", &XC::MultilevelPartitioner::getNumPasses, &XC::MultilevelPartitioner::setNumPasses,"Maximum number of refinement passes for each level.")
+  ;
+
+def("newGraphPartitioner",&XC::newGraphPartitioner,return_value_policy<manage_new_object>(),"newGraphPartitioner(type): return a new graph partitioner; type can be 'metis' (only if XC has been built with METIS), 'multilevel' or 'default' (METIS if available, multilevel otherwise).");
@@ -96,6 +96,13 @@ XC::AnalysisModel *XC::SystemOfEqn::getAnalysisModelPtr(void)
     return sm->getAnalysisModelPtr();
   }
 
+//! @brief Returns a pointer to the integrator (nullptr if none).
+XC::Integrator *XC::SystemOfEqn::getIntegratorPtr(void)
+  {
+    AnalysisAggregation *sm= getAnalysisAggregation();
+    return (sm ? sm->getIntegratorPtr() : nullptr);
+  }
+
 //! @brief Check number of DOFs in the graph.
 int XC::SystemOfEqn::checkSize(Graph &theGraph) const
   {
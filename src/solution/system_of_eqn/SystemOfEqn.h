@@ -73,6 +73,7 @@ class Graph;
 class AnalysisModel;
 class FEM_ObjectBroker;
 class AnalysisAggregation;
+class Integrator;
 
 //!  @ingroup Solu
 //! 
@@ -93,6 +94,7 @@ class SystemOfEqn: public MovableObject, public CommandEntity
   protected:
     virtual AnalysisModel *getAnalysisModelPtr(void);
     virtual const AnalysisModel *getAnalysisModelPtr(void) const;
+    Integrator *getIntegratorPtr(void);
 
     friend class AnalysisAggregation;
     SystemOfEqn(AnalysisAggregation *,int classTag);
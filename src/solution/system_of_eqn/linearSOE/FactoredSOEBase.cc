@@ -33,7 +33,41 @@
 //! @param owr: analysis aggregation that owns this object.
 //! @param classTag: identifier of the class.
 XC::FactoredSOEBase::FactoredSOEBase(AnalysisAggregation *owr,int classTag,int N)
-  : LinearSOEData(owr,classTag,N), factored(false){}
+  : LinearSOEData(owr,classTag,N), factored(false),
+    constantAStored(false), firstVariableEq(0) {}
+
+//! @brief Stores a copy of the matrix coefficients as the constant
+//! part of the matrix.
+void XC::FactoredSOEBase::storeConstantPart(const Vector &A,const int &firstVarEq)
+  {
+    constantA= A;
+    constantAStored= true;
+    firstVariableEq= firstVarEq;
+  }
+
+//! @brief Copies the constant part of the matrix into \p A.
+bool XC::FactoredSOEBase::restoreConstantPart(Vector &A)
+  {
+    if(constantAStored && (A.Size()==constantA.Size()))
+      {
+        A= constantA;
+        factored= false;
+        return true;
+      }
+    return false;
+  }
+
+//! @brief Returns true if a constant part of the matrix is stored.
+bool XC::FactoredSOEBase::hasConstantA(void) const
+  { return constantAStored; }
+
+//! @brief Removes the stored constant part of the matrix.
+void XC::FactoredSOEBase::clearConstantA(void)
+  {
+    constantAStored= false;
+    constantA.resize(0);
+    firstVariableEq= 0;
+  }
 
 
 
@@ -31,6 +31,7 @@
 #define FactoredSOEBase_h
 
 #include "solution/system_of_eqn/linearSOE/LinearSOEData.h"
+#include "utility/matrix/Vector.h"
 
 namespace XC {
 
@@ -41,8 +42,21 @@ class FactoredSOEBase: public LinearSOEData
   {
   protected:
     bool factored; //!< True if the system is factored.
+    Vector constantA; //!< constant part of the matrix (tangent cache).
+    bool constantAStored; //!< true if constantA contains the constant part of the matrix.
+    int firstVariableEq; //!< first equation that receives variable contributions.
+
+    void storeConstantPart(const Vector &A,const int &);
+    bool restoreConstantPart(Vector &A);
 
     FactoredSOEBase(AnalysisAggregation *,int classTag,int N= 0);
+  public:
+    //! @brief Returns true if the matrix is factored (so the system can be
+    //! solved for other right-hand sides without factoring it again).
+    inline bool isFactored(void) const
+      { return factored; }
+    virtual bool hasConstantA(void) const;
+    virtual void clearConstantA(void);
   };
 } // end of XC namespace
 
@@ -76,6 +76,7 @@
 #include <solution/system_of_eqn/linearSOE/diagonal/DiagonalSolver.h>
 #include <solution/system_of_eqn/linearSOE/diagonal/DistributedDiagonalSolver.h>
 #include <solution/system_of_eqn/linearSOE/diagonal/DiagonalDirectSolver.h>
+#include "solution/system_of_eqn/linearSOE/cg/PCG_LinSolver.h"
 
 #include <solution/system_of_eqn/linearSOE/fullGEN/FullGenLinSolver.h>
 #include <solution/system_of_eqn/linearSOE/fullGEN/FullGenLinLapackSolver.h>
@@ -162,6 +163,27 @@ bool XC::LinearSOE::setSolver(LinearSOESolver *newSolver)
     return retval;
   }
 
+//! @brief Stores the current value of the matrix \f$A\f$ as its constant
+//! part; the equations from \p firstVariableEq onwards are those that may
+//! receive additional (variable) contributions. Returns false if the
+//! system of equations doesn't support this feature (default).
+bool XC::LinearSOE::storeConstantA(const int &firstVariableEq)
+  { return false; }
+
+//! @brief Sets the matrix \f$A\f$ to its stored constant part (used
+//! instead of zeroA to avoid adding the constant contributions again).
+//! Returns false if there is no constant part stored.
+bool XC::LinearSOE::restoreConstantA(void)
+  { return false; }
+
+//! @brief Returns true if a constant part of the matrix \f$A\f$ is stored.
+bool XC::LinearSOE::hasConstantA(void) const
+  { return false; }
+
+//! @brief Removes the stored constant part of the matrix \f$A\f$.
+void XC::LinearSOE::clearConstantA(void)
+  {}
+
 XC::LinearSOESolver &XC::LinearSOE::newSolver(const std::string &type)
   {
     if(type=="band_gen_lin_lapack_solver")
@@ -180,6 +202,8 @@ XC::LinearSOESolver &XC::LinearSOE::newSolver(const std::string &type)
       setSolver(new FullGenLinLapackSolver());
 //     else if(type=="itpack_lin_solver")
 //       setSolver(new ItpackLinSolver());
+    else if(type=="pcg_lin_solver")
+      setSolver(new PCG_LinSolver());
     else if(type=="profile_spd_lin_direct_solver")
       setSolver(new ProfileSPDLinDirectSolver());
     else if(type=="profile_spd_lin_direct_block_solver")
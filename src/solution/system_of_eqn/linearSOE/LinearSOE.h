@@ -158,6 +158,12 @@ class LinearSOE : public SystemOfEqn
     virtual void setX(int loc, double value) =0;
     //! @brief Sets the vector $x$.
     virtual void setX(const Vector &X) =0;
+
+    // constant part of the matrix (tangent cache).
+    virtual bool storeConstantA(const int &firstVariableEq);
+    virtual bool restoreConstantA(void);
+    virtual bool hasConstantA(void) const;
+    virtual void clearConstantA(void);
     
     LinearSOESolver *getSolver(void);
     LinearSOESolver &newSolver(const std::string &);
@@ -149,6 +149,7 @@ bool XC::BandGenLinSOE::setSolver(LinearSOESolver *newSolver)
 int XC::BandGenLinSOE::setSize(Graph &theGraph)
   {
     int result = 0;
+    clearConstantA();
     size= checkSize(theGraph);
 
     /*
@@ -304,6 +305,18 @@ void XC::BandGenLinSOE::zeroA(void)
     factored = false;
   }
 
+//! @brief Stores the current matrix as its constant part (see
+//! IncrementalIntegrator::formTangent).
+bool XC::BandGenLinSOE::storeConstantA(const int &firstVarEq)
+  {
+    storeConstantPart(A,firstVarEq);
+    return true;
+  }
+
+//! @brief Sets the matrix to its stored constant part.
+bool XC::BandGenLinSOE::restoreConstantA(void)
+  { return restoreConstantPart(A); }
+
 int XC::BandGenLinSOE::sendSelf(CommParameters &cp)
   { return 0; }
 
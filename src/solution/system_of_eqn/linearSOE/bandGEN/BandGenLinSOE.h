@@ -127,6 +127,10 @@ class BandGenLinSOE : public FactoredSOEBase
 
     virtual void zeroA(void);
 
+    virtual bool storeConstantA(const int &);
+
+    virtual bool restoreConstantA(void);
+
     virtual int sendSelf(CommParameters &);
     virtual int recvSelf(const CommParameters &);
     friend class BandGenLinLapackSolver;
@@ -82,6 +82,10 @@ class DistributedBandGenLinSOE : public BandGenLinSOE, public DistributedBandLin
   public:
     // these methods need to be rewritten
     int setSize(Graph &theGraph);
+    //! @brief Constant part of the matrix not supported (the
+    //! matrix is completed with the contributions of other processes).
+    inline virtual bool storeConstantA(const int &)
+      { return false; }
     int addA(const Matrix &, const ID &, double fact = 1.0);
     int addB(const Vector &, const ID &,const double &fact= 1.0);
     int setB(const Vector &, const double &fact= 1.0);            
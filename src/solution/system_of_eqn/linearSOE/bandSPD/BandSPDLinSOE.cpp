@@ -164,6 +164,7 @@ bool XC::BandSPDLinSOE::setSolver(LinearSOESolver *newSolver)
 int XC::BandSPDLinSOE::setSize(Graph &theGraph)
   {
     int result = 0;
+    clearConstantA();
     size= checkSize(theGraph);
     half_band= theGraph.getVertexDiffMaxima();
 
@@ -272,6 +273,18 @@ void XC::BandSPDLinSOE::zeroA(void)
     factored = false;
   }
 
+//! @brief Stores the current matrix as its constant part (see
+//! IncrementalIntegrator::formTangent).
+bool XC::BandSPDLinSOE::storeConstantA(const int &firstVarEq)
+  {
+    storeConstantPart(A,firstVarEq);
+    return true;
+  }
+
+//! @brief Sets the matrix to its stored constant part.
+bool XC::BandSPDLinSOE::restoreConstantA(void)
+  { return restoreConstantPart(A); }
+
 int XC::BandSPDLinSOE::sendSelf(CommParameters &cp)
   { return 0; }
 
@@ -130,6 +130,10 @@ class BandSPDLinSOE: public FactoredSOEBase
     
     virtual void zeroA(void);
     
+    virtual bool storeConstantA(const int &);
+    
+    virtual bool restoreConstantA(void);
+    
     virtual int sendSelf(CommParameters &);
     virtual int recvSelf(const CommParameters &);
     
@@ -84,6 +84,10 @@ class DistributedBandSPDLinSOE: public BandSPDLinSOE, public DistributedBandLinS
     int addB(const Vector &, const ID &,const double &fact= 1.0);    
     int setB(const Vector &, const double &fact = 1.0);            
     int setSize(Graph &theGraph);
+    //! @brief Constant part of the matrix not supported (the
+    //! matrix is completed with the contributions of other processes).
+    inline virtual bool storeConstantA(const int &)
+      { return false; }
     int solve(void);
     const Vector &getB(void) const;
 
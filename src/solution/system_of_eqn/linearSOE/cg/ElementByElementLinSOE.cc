@@ -0,0 +1,679 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ElementByElementLinSOE.cc
+
+#include "ElementByElementLinSOE.h"
+#include "PCG_LinSolver.h"
+#include <utility/matrix/Matrix.h>
+#include <utility/matrix/ID.h>
+#include "solution/graph/graph/Graph.h"
+#include "solution/analysis/model/AnalysisModel.h"
+#include "solution/analysis/model/DOF_GrpIter.h"
+#include "solution/analysis/model/dof_grp/DOF_Group.h"
+#include "solution/analysis/model/FE_EleIter.h"
+#include "solution/analysis/model/fe_ele/FE_Element.h"
+#include "solution/analysis/integrator/TransientIntegrator.h"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+//! @brief Constructor.
+XC::ElementByElementLinSOE::ElementByElementLinSOE(AnalysisAggregation *owr)
+  :LinearSOEData(owr,LinSOE_TAGS_ElementByElementLinSOE), matrixFree(false),
+   preconditioner(JACOBI), preconditionerReady(false), numThreads(1),
+   parallelThreshold(50000)
+  {
+    const int nt= std::thread::hardware_concurrency();
+    if(nt>1)
+      numThreads= nt;
+  }
+
+//! @brief Sets the solver.
+bool XC::ElementByElementLinSOE::setSolver(LinearSOESolver *newSolver)
+  {
+    bool retval= false;
+    PCG_LinSolver *tmp= dynamic_cast<PCG_LinSolver *>(newSolver);
+    if(tmp)
+      retval= LinearSOE::setSolver(tmp);
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; solver incompatible with system of equations."
+		<< std::endl;
+    return retval;
+  }
+
+//! @brief Sets the size of the system and the data needed
+//! by the preconditioners.
+int XC::ElementByElementLinSOE::setSize(Graph &theGraph)
+  {
+    int result= 0;
+    size= checkSize(theGraph);
+    inic(size);
+    diagA.resize(size);
+    invDiagA.resize(size);
+    setupNodeBlocks();
+    zeroA();
+
+    // the sparsity pattern for the incomplete factorization
+    // is computed from the first matrix assembled.
+    rowStartL.clear(); colL.clear(); valL.clear();
+
+    // invoke setSize() on the solver
+    LinearSOESolver *the_Solver= this->getSolver();
+    if(the_Solver)
+      {
+        const int solverOK= the_Solver->setSize();
+        if(solverOK < 0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; solver failed setSize()\n";
+            return solverOK;
+          }
+      }
+    return result;
+  }
+
+//! @brief Store the equation numbers of each DOF group (node) to
+//! build the block Jacobi preconditioner.
+void XC::ElementByElementLinSOE::setupNodeBlocks(void)
+  {
+    nodeBlockStart.clear();
+    nodeBlockDOFs.clear();
+    dofBlock.assign(size,-1);
+    dofLocal.assign(size,-1);
+    nodeBlockStart.push_back(0);
+    AnalysisModel *theModel= getAnalysisModelPtr();
+    if(theModel)
+      {
+        DOF_Group *dofPtr= nullptr;
+        DOF_GrpIter &theDOFGroups= theModel->getDOFGroups();
+        while((dofPtr= theDOFGroups()) != nullptr)
+          {
+            const ID &eqs= dofPtr->getID();
+            const size_t blockStart= nodeBlockDOFs.size();
+            for(int i= 0;i<eqs.Size();i++)
+              {
+                const int eq= eqs(i);
+                if(eq>=0 && eq<size)
+                  nodeBlockDOFs.push_back(eq);
+              }
+            if(nodeBlockDOFs.size()>blockStart)
+              nodeBlockStart.push_back(nodeBlockDOFs.size());
+          }
+      }
+    // position of each equation in its node block.
+    const size_t numBlocks= nodeBlockStart.size()-1;
+    nodeBlockInvStart.resize(numBlocks+1);
+    nodeBlockInvStart[0]= 0;
+    for(size_t b= 0;b<numBlocks;b++)
+      {
+        const size_t n= nodeBlockStart[b+1]-nodeBlockStart[b];
+        for(size_t i= 0;i<n;i++)
+          {
+            const int eq= nodeBlockDOFs[nodeBlockStart[b]+i];
+            dofBlock[eq]= b;
+            dofLocal[eq]= i;
+          }
+        nodeBlockInvStart[b+1]= nodeBlockInvStart[b]+n*n;
+      }
+    nodeBlocks.resize(nodeBlockInvStart[numBlocks]);
+  }
+
+//! @brief Compute the sparsity pattern of the lower triangle of A
+//! (diagonal at the end of each row) from the element cache.
+void XC::ElementByElementLinSOE::setupSparsePattern(void)
+  {
+    std::vector<std::vector<int> > rows(size);
+    const size_t numEleBlocks= getNumElementBlocks();
+    for(size_t e= 0;e<numEleBlocks;e++)
+      {
+        const int *dofs= &eleDOFs[eleDOFsStart[e]];
+        const size_t n= eleDOFsStart[e+1]-eleDOFsStart[e];
+        for(size_t i= 0;i<n;i++)
+          for(size_t j= 0;j<n;j++)
+            if(dofs[j]<dofs[i])
+              rows[dofs[i]].push_back(dofs[j]);
+      }
+    rowStartL.resize(size+1);
+    colL.clear();
+    rowStartL[0]= 0;
+    for(int a= 0;a<size;a++)
+      {
+        std::vector<int> &row= rows[a];
+        std::sort(row.begin(),row.end());
+        row.erase(std::unique(row.begin(),row.end()),row.end());
+        colL.insert(colL.end(),row.begin(),row.end());
+        colL.push_back(a); // diagonal.
+        rowStartL[a+1]= colL.size();
+        std::vector<int>().swap(row);
+      }
+    valL.resize(colL.size());
+  }
+
+//! @brief Stores \p fact times the matrix \p m in the element
+//! contributions cache (entries with equation number outside
+//! the range are discarded). The diagonal and the diagonal node
+//! blocks of A are accumulated too (in matrix-free mode only
+//! these are stored).
+int XC::ElementByElementLinSOE::addA(const Matrix &m, const ID &id, double fact)
+  {
+    // check for a quick return 
+    if(fact == 0.0)  return 0;
+
+    const int idSize= id.Size();
+    if(idSize != m.noRows() && idSize != m.noCols())
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; matrix and ID not of similar sizes\n";
+        return -1;
+      }
+    std::vector<int> local;
+    local.reserve(idSize);
+    for(int i= 0;i<idSize;i++)
+      {
+        const int pos= id(i);
+        if(pos>=0 && pos<size)
+          {
+            local.push_back(i);
+            diagA(pos)+= fact*m(i,i);
+          }
+      }
+    const size_t n= local.size();
+    // diagonal blocks of the nodes.
+    if(!dofBlock.empty())
+      for(size_t i= 0;i<n;i++)
+        {
+          const int eqI= id(local[i]);
+          const int b= dofBlock[eqI];
+          if(b<0) continue;
+          const size_t nb= nodeBlockStart[b+1]-nodeBlockStart[b];
+          double *block= &nodeBlocks[nodeBlockInvStart[b]+dofLocal[eqI]*nb];
+          for(size_t j= 0;j<n;j++)
+            {
+              const int eqJ= id(local[j]);
+              if(dofBlock[eqJ]==b)
+                block[dofLocal[eqJ]]+= fact*m(local[i],local[j]);
+            }
+        }
+    if((n>0) && !matrixFree)
+      {
+        for(size_t i= 0;i<n;i++)
+          eleDOFs.push_back(id(local[i]));
+        for(size_t i= 0;i<n;i++)
+          for(size_t j= 0;j<n;j++)
+            eleValues.push_back(fact*m(local[i],local[j]));
+        eleDOFsStart.push_back(eleDOFs.size());
+        eleValuesStart.push_back(eleValues.size());
+      }
+    preconditionerReady= false;
+    return 0;
+  }
+
+//! @brief Clears the element contributions cache (keeps
+//! the allocated memory).
+void XC::ElementByElementLinSOE::zeroA(void)
+  {
+    eleDOFs.clear();
+    eleValues.clear();
+    eleDOFsStart.assign(1,0);
+    eleValuesStart.assign(1,0);
+    diagA.Zero();
+    std::fill(nodeBlocks.begin(),nodeBlocks.end(),0.0);
+    preconditionerReady= false;
+  }
+
+//! @brief Accumulates in \p Ap the product of the element blocks
+//! [first,last) by \p p.
+void XC::ElementByElementLinSOE::formApRange(const size_t &first,const size_t &last,const Vector &p, Vector &Ap) const
+  {
+    for(size_t e= first;e<last;e++)
+      {
+        const int *dofs= &eleDOFs[eleDOFsStart[e]];
+        const size_t n= eleDOFsStart[e+1]-eleDOFsStart[e];
+        const double *k= &eleValues[eleValuesStart[e]];
+        for(size_t i= 0;i<n;i++)
+          {
+            double s= 0.0;
+            for(size_t j= 0;j<n;j++)
+              s+= k[j]*p(dofs[j]);
+            Ap(dofs[i])+= s;
+            k+= n;
+          }
+      }
+  }
+
+//! @brief Adds to \p Ap the product of the matrix \p k (whose rows
+//! and columns correspond to the equations \p id) by \p p.
+static void add_product(const XC::Matrix &k,const XC::ID &id,const XC::Vector &p, XC::Vector &Ap)
+  {
+    const int n= id.Size();
+    const int sz= Ap.Size();
+    for(int i= 0;i<n;i++)
+      {
+        const int row= id(i);
+        if(row<0 || row>=sz) continue;
+        double s= 0.0;
+        for(int j= 0;j<n;j++)
+          {
+            const int col= id(j);
+            if(col>=0 && col<sz)
+              s+= k(i,j)*p(col);
+          }
+        Ap(row)+= s;
+      }
+  }
+
+//! @brief Computes \f$Ap= A p\f$ computing again the tangent
+//! of each DOF_Group and FE_Element (matrix-free mode).
+int XC::ElementByElementLinSOE::formApMatrixFree(const Vector &p, Vector &Ap)
+  {
+    AnalysisModel *theModel= getAnalysisModelPtr();
+    Integrator *theIntegrator= getIntegratorPtr();
+    if(!theModel || !theIntegrator)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; no analysis model or integrator." << std::endl;
+        return -1;
+      }
+    // nodal contributions (only the transient integrators have them).
+    if(dynamic_cast<TransientIntegrator *>(theIntegrator))
+      {
+        DOF_Group *dofPtr= nullptr;
+        DOF_GrpIter &theDOFGroups= theModel->getDOFGroups();
+        while((dofPtr= theDOFGroups()) != nullptr)
+          add_product(dofPtr->getTangent(theIntegrator),dofPtr->getID(),p,Ap);
+      }
+    FE_Element *elePtr= nullptr;
+    FE_EleIter &theEles= theModel->getFEs();
+    while((elePtr= theEles()) != nullptr)
+      add_product(elePtr->getTangent(theIntegrator),elePtr->getID(),p,Ap);
+    return 0;
+  }
+
+//! @brief Computes \f$Ap= A p\f$ element by element.
+//!
+//! The product is computed by the threads of the pool only if the
+//! element cache has at least parallelThreshold values (otherwise
+//! the synchronization costs more than the product itself).
+int XC::ElementByElementLinSOE::formAp(const Vector &p, Vector &Ap)
+  {
+    if(Ap.Size()!=size)
+      Ap.resize(size);
+    Ap.Zero();
+    if(matrixFree)
+      return formApMatrixFree(p,Ap);
+    const size_t numBlocks= getNumElementBlocks();
+    size_t nt= std::min(size_t(std::max(numThreads,1)),std::max(numBlocks,size_t(1)));
+    if(getCacheSize()<parallelThreshold)
+      nt= 1;
+    if(nt<2)
+      formApRange(0,numBlocks,p,Ap);
+    else
+      {
+        if(workers.getNumThreads()!=nt)
+          workers.resize(nt);
+        // each thread accumulates its own partial product.
+        threadBuffers.resize(nt);
+        const size_t chunk= (numBlocks+nt-1)/nt;
+        const std::function<void(size_t)> task= [&](size_t t)
+          {
+            Vector &buffer= threadBuffers[t];
+            if(buffer.Size()!=size)
+              buffer.resize(size);
+            buffer.Zero();
+            const size_t first= std::min(t*chunk,numBlocks);
+            const size_t last= std::min(first+chunk,numBlocks);
+            formApRange(first,last,p,buffer);
+          };
+        workers.run(nt,task);
+        for(size_t t= 0;t<nt;t++)
+          Ap.addVector(1.0,threadBuffers[t],1.0);
+      }
+    return 0;
+  }
+
+//! @brief Computes the inverse of the diagonal (returns -1 if
+//! there is a zero diagonal term).
+int XC::ElementByElementLinSOE::setupJacobi(void)
+  {
+    if(invDiagA.Size()!=size)
+      invDiagA.resize(size);
+    for(int i= 0;i<size;i++)
+      {
+        if(diagA(i)==0.0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+	              << "; zero diagonal term at equation: "
+		      << i << std::endl;
+            return -1;
+          }
+        invDiagA(i)= 1.0/diagA(i);
+      }
+    return 0;
+  }
+
+//! @brief Computes the inverses of the diagonal blocks of each node.
+int XC::ElementByElementLinSOE::setupBlockJacobi(void)
+  {
+    int retval= setupJacobi();
+    if(retval<0)
+      return retval;
+    const size_t numBlocks= nodeBlockStart.size()-1;
+    // invert the diagonal blocks of the nodes (assembled by addA).
+    nodeBlockInv.resize(nodeBlocks.size());
+    for(size_t b= 0;b<numBlocks;b++)
+      {
+        const int n= nodeBlockStart[b+1]-nodeBlockStart[b];
+        const size_t offset= nodeBlockInvStart[b];
+        Matrix block(n,n);
+        for(int i= 0;i<n;i++)
+          for(int j= 0;j<n;j++)
+            block(i,j)= nodeBlocks[offset+i*n+j];
+        Matrix inv(n,n);
+        if(block.Invert(inv)<0) // singular block: use the diagonal.
+          {
+            inv.Zero();
+            for(int i= 0;i<n;i++)
+              inv(i,i)= invDiagA(nodeBlockDOFs[nodeBlockStart[b]+i]);
+          }
+        for(int i= 0;i<n;i++)
+          for(int j= 0;j<n;j++)
+            nodeBlockInv[offset+i*n+j]= inv(i,j);
+      }
+    return retval;
+  }
+
+//! @brief Assembles the lower triangle of A (with its diagonal
+//! multiplied by 1+shift) in the incomplete Cholesky storage.
+void XC::ElementByElementLinSOE::assembleSparseCopy(const double &shift)
+  {
+    std::fill(valL.begin(),valL.end(),0.0);
+    const size_t numEleBlocks= getNumElementBlocks();
+    for(size_t e= 0;e<numEleBlocks;e++)
+      {
+        const int *dofs= &eleDOFs[eleDOFsStart[e]];
+        const size_t n= eleDOFsStart[e+1]-eleDOFsStart[e];
+        const double *k= &eleValues[eleValuesStart[e]];
+        for(size_t i= 0;i<n;i++)
+          {
+            const int row= dofs[i];
+            const std::vector<int>::const_iterator rowBegin= colL.begin()+rowStartL[row];
+            const std::vector<int>::const_iterator rowEnd= colL.begin()+rowStartL[row+1];
+            for(size_t j= 0;j<n;j++)
+              {
+                const int col= dofs[j];
+                if(col>row) continue;
+                std::vector<int>::const_iterator pos= std::lower_bound(rowBegin,rowEnd,col);
+                if(pos!=rowEnd && *pos==col)
+                  valL[pos-colL.begin()]+= k[i*n+j];
+              }
+          }
+      }
+    if(shift!=0.0)
+      for(int i= 0;i<size;i++)
+        valL[rowStartL[i+1]-1]*= (1.0+shift);
+  }
+
+//! @brief Computes the IC(0) factor of the assembled copy of A.
+int XC::ElementByElementLinSOE::factorIncompleteCholesky(void)
+  {
+    for(int i= 0;i<size;i++)
+      {
+        const size_t rowBegin= rowStartL[i];
+        const size_t diagPos= rowStartL[i+1]-1;
+        double d= valL[diagPos];
+        for(size_t p= rowBegin;p<diagPos;p++)
+          {
+            const int k= colL[p];
+            // dot product of the rows i and k up to column k.
+            double s= valL[p];
+            size_t pi= rowBegin;
+            size_t pk= rowStartL[k];
+            const size_t diagK= rowStartL[k+1]-1;
+            while(pi<p && pk<diagK)
+              {
+                if(colL[pi]==colL[pk])
+                  s-= valL[pi++]*valL[pk++];
+                else if(colL[pi]<colL[pk])
+                  pi++;
+                else
+                  pk++;
+              }
+            valL[p]= s/valL[diagK];
+            d-= valL[p]*valL[p];
+          }
+        if(d<=0.0)
+          return -1;
+        valL[diagPos]= sqrt(d);
+      }
+    return 0;
+  }
+
+//! @brief Computes the incomplete Cholesky factor. If the factorization
+//! breaks down the diagonal is increased and the factorization repeated.
+int XC::ElementByElementLinSOE::setupIncompleteCholesky(void)
+  {
+    if(matrixFree)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; the incomplete factorization needs the element"
+		  << " matrices (not available in matrix-free mode)."
+		  << std::endl;
+        return -1;
+      }
+    int retval= setupJacobi();
+    if(retval<0)
+      return retval;
+    if(rowStartL.size()!=size_t(size+1))
+      setupSparsePattern();
+    double shift= 0.0;
+    for(int attempt= 0;attempt<10;attempt++)
+      {
+        assembleSparseCopy(shift);
+        retval= factorIncompleteCholesky();
+        if(retval==0)
+          break;
+        shift= (shift==0.0) ? 1e-3 : 2.0*shift;
+      }
+    if(retval<0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; incomplete factorization failed." << std::endl;
+    return retval;
+  }
+
+//! @brief Computes the preconditioner for the current matrix.
+int XC::ElementByElementLinSOE::setupPreconditioner(void)
+  {
+    int retval= 0;
+    if(!preconditionerReady)
+      {
+        if(preconditioner==BLOCK_JACOBI)
+          retval= setupBlockJacobi();
+        else if(preconditioner==INCOMPLETE_CHOLESKY)
+          retval= setupIncompleteCholesky();
+        else
+          retval= setupJacobi();
+        preconditionerReady= (retval==0);
+      }
+    return retval;
+  }
+
+//! @brief Computes \f$z= M^{-1} r\f$ where M is the preconditioner.
+int XC::ElementByElementLinSOE::applyPreconditioner(const Vector &r, Vector &z) const
+  {
+    if(z.Size()!=size)
+      z.resize(size);
+    if(preconditioner==BLOCK_JACOBI)
+      {
+        for(int i= 0;i<size;i++) // equations without node block.
+          z(i)= r(i)*invDiagA(i);
+        const size_t numBlocks= nodeBlockStart.size()-1;
+        for(size_t b= 0;b<numBlocks;b++)
+          {
+            const size_t n= nodeBlockStart[b+1]-nodeBlockStart[b];
+            const int *dofs= &nodeBlockDOFs[nodeBlockStart[b]];
+            const double *inv= &nodeBlockInv[nodeBlockInvStart[b]];
+            for(size_t i= 0;i<n;i++)
+              {
+                double s= 0.0;
+                for(size_t j= 0;j<n;j++)
+                  s+= inv[i*n+j]*r(dofs[j]);
+                z(dofs[i])= s;
+              }
+          }
+      }
+    else if(preconditioner==INCOMPLETE_CHOLESKY)
+      {
+        // forward substitution: L y = r.
+        for(int i= 0;i<size;i++)
+          {
+            double s= r(i);
+            const size_t diagPos= rowStartL[i+1]-1;
+            for(size_t p= rowStartL[i];p<diagPos;p++)
+              s-= valL[p]*z(colL[p]);
+            z(i)= s/valL[diagPos];
+          }
+        // backward substitution: L^T z = y.
+        for(int i= size-1;i>=0;i--)
+          {
+            const size_t diagPos= rowStartL[i+1]-1;
+            const double zi= z(i)/valL[diagPos];
+            z(i)= zi;
+            for(size_t p= rowStartL[i];p<diagPos;p++)
+              z(colL[p])-= valL[p]*zi;
+          }
+      }
+    else
+      for(int i= 0;i<size;i++)
+        z(i)= r(i)*invDiagA(i);
+    return 0;
+  }
+
+//! @brief Sets the preconditioner type.
+void XC::ElementByElementLinSOE::setPreconditionerType(const PreconditionerType &tp)
+  {
+    if(tp!=preconditioner)
+      {
+        preconditioner= tp;
+        preconditionerReady= false;
+      }
+  }
+
+//! @brief Sets the preconditioner type ("jacobi", "block_jacobi"
+//! or "incomplete_cholesky").
+void XC::ElementByElementLinSOE::setPreconditioner(const std::string &nmb)
+  {
+    if(nmb=="jacobi")
+      setPreconditionerType(JACOBI);
+    else if(nmb=="block_jacobi")
+      setPreconditionerType(BLOCK_JACOBI);
+    else if(nmb=="incomplete_cholesky")
+      setPreconditionerType(INCOMPLETE_CHOLESKY);
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; unknown preconditioner: '" << nmb
+		<< "'. Available types: 'jacobi', 'block_jacobi'"
+		<< " and 'incomplete_cholesky'." << std::endl;
+  }
+
+//! @brief Returns the preconditioner type.
+std::string XC::ElementByElementLinSOE::getPreconditioner(void) const
+  {
+    std::string retval= "jacobi";
+    if(preconditioner==BLOCK_JACOBI)
+      retval= "block_jacobi";
+    else if(preconditioner==INCOMPLETE_CHOLESKY)
+      retval= "incomplete_cholesky";
+    return retval;
+  }
+
+//! @brief Sets the number of threads used to compute A*p.
+void XC::ElementByElementLinSOE::setNumThreads(const int &n)
+  { numThreads= std::max(n,1); }
+
+//! @brief Returns the number of threads used to compute A*p.
+int XC::ElementByElementLinSOE::getNumThreads(void) const
+  { return numThreads; }
+
+//! @brief Sets the minimum number of values in the element cache
+//! to compute A*p in parallel.
+void XC::ElementByElementLinSOE::setParallelThreshold(const size_t &n)
+  { parallelThreshold= n; }
+
+//! @brief Returns the minimum number of values in the element cache
+//! to compute A*p in parallel.
+size_t XC::ElementByElementLinSOE::getParallelThreshold(void) const
+  { return parallelThreshold; }
+
+//! @brief If true the element matrices are not stored (they're
+//! computed again each time A*p is evaluated).
+void XC::ElementByElementLinSOE::setMatrixFree(const bool &b)
+  {
+    if(b!=matrixFree)
+      {
+        matrixFree= b;
+        zeroA(); // the matrix must be formed again.
+      }
+  }
+
+//! @brief Returns true if the element matrices are not stored.
+bool XC::ElementByElementLinSOE::getMatrixFree(void) const
+  { return matrixFree; }
+
+//! @brief Returns the number of element blocks stored in the cache.
+size_t XC::ElementByElementLinSOE::getNumElementBlocks(void) const
+  { return eleDOFsStart.empty() ? 0 : eleDOFsStart.size()-1; }
+
+//! @brief Returns the number of values stored in the element cache.
+size_t XC::ElementByElementLinSOE::getCacheSize(void) const
+  { return eleValues.size(); }
+
+//! @brief Returns the number of iterations of the last solution.
+int XC::ElementByElementLinSOE::getNumIterations(void) const
+  {
+    int retval= 0;
+    const PCG_LinSolver *tmp= dynamic_cast<const PCG_LinSolver *>(const_cast<ElementByElementLinSOE *>(this)->getSolver());
+    if(tmp)
+      retval= tmp->getNumIterations();
+    return retval;
+  }
+
+//! @brief Returns the norm of the residual of the last solution.
+double XC::ElementByElementLinSOE::getResidualNorm(void) const
+  {
+    double retval= 0.0;
+    const PCG_LinSolver *tmp= dynamic_cast<const PCG_LinSolver *>(const_cast<ElementByElementLinSOE *>(this)->getSolver());
+    if(tmp)
+      retval= tmp->getResidualNorm();
+    return retval;
+  }
+
+int XC::ElementByElementLinSOE::sendSelf(CommParameters &cp)
+  { return 0; }
+
+int XC::ElementByElementLinSOE::recvSelf(const CommParameters &cp)
+  { return 0; }
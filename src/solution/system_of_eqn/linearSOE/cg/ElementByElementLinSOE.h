@@ -0,0 +1,143 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ElementByElementLinSOE.h
+
+#ifndef ElementByElementLinSOE_h
+#define ElementByElementLinSOE_h
+
+#include <solution/system_of_eqn/linearSOE/LinearSOEData.h>
+#include <utility/WorkerPool.h>
+#include <vector>
+
+namespace XC {
+class PCG_LinSolver;
+
+//! @ingroup SOE
+//
+//! @brief Element by element (unassembled) system of equations for
+//! iterative solvers.
+//!
+//! The matrix \f$A\f$ is not assembled: the element (and nodal)
+//! contributions received by addA are stored (as dense matrices) in a
+//! compact per-element cache and the product \f$A p\f$ is evaluated
+//! element by element (in parallel if numThreads > 1 and the cache is
+//! big enough). If matrixFree is true the element matrices are not
+//! stored at all: the tangent of each FE_Element (and DOF_Group) is
+//! computed again each time the product \f$A p\f$ is evaluated
+//! (serially, the elements are not thread safe). The SOE also builds the
+//! preconditioner used by PCG_LinSolver:
+//! - "jacobi": inverse of the diagonal of \f$A\f$.
+//! - "block_jacobi": inverse of the diagonal block of each node (DOF group).
+//! - "incomplete_cholesky": IC(0) factorization of an assembled sparse
+//!   copy of \f$A\f$ (the only case where \f$A\f$ is assembled;
+//!   not available in matrix-free mode).
+class ElementByElementLinSOE: public LinearSOEData
+  {
+  public:
+    enum PreconditionerType {JACOBI, BLOCK_JACOBI, INCOMPLETE_CHOLESKY};
+  private:
+    // element contributions cache.
+    std::vector<size_t> eleDOFsStart; //!< start of each element block in eleDOFs.
+    std::vector<int> eleDOFs; //!< equation numbers of the element blocks.
+    std::vector<size_t> eleValuesStart; //!< start of each element block in eleValues.
+    std::vector<double> eleValues; //!< element matrices (row major, already scaled).
+    Vector diagA; //!< diagonal of A.
+    Vector invDiagA; //!< inverse of the diagonal of A (Jacobi preconditioner).
+    bool matrixFree; //!< if true the element matrices are not stored.
+
+    PreconditionerType preconditioner; //!< preconditioner type.
+    bool preconditionerReady; //!< true if the preconditioner corresponds to the current A.
+    int numThreads; //!< number of threads used to compute A*p.
+    WorkerPool workers; //!< threads used to compute A*p (created when needed).
+    size_t parallelThreshold; //!< minimum number of values in the cache to compute A*p in parallel.
+    std::vector<Vector> threadBuffers; //!< partial products of each thread.
+
+    // block Jacobi data.
+    std::vector<size_t> nodeBlockStart; //!< start of each node block in nodeBlockDOFs.
+    std::vector<int> nodeBlockDOFs; //!< equation numbers of each node block.
+    std::vector<int> dofBlock; //!< node block of each equation (-1 if none).
+    std::vector<int> dofLocal; //!< position of each equation in its node block.
+    std::vector<size_t> nodeBlockInvStart; //!< start of each block in nodeBlocks and nodeBlockInv.
+    std::vector<double> nodeBlocks; //!< diagonal blocks of A (row major, assembled by addA).
+    std::vector<double> nodeBlockInv; //!< inverses of the node blocks (row major).
+
+    // incomplete Cholesky data (lower triangle, compressed rows, diagonal last).
+    std::vector<size_t> rowStartL; //!< start of each row.
+    std::vector<int> colL; //!< column indices.
+    std::vector<double> valL; //!< factor values.
+
+    void setupNodeBlocks(void);
+    void setupSparsePattern(void);
+    int setupJacobi(void);
+    int setupBlockJacobi(void);
+    int setupIncompleteCholesky(void);
+    void assembleSparseCopy(const double &);
+    int factorIncompleteCholesky(void);
+    void formApRange(const size_t &,const size_t &,const Vector &, Vector &) const;
+    int formApMatrixFree(const Vector &, Vector &);
+  protected:
+    virtual bool setSolver(LinearSOESolver *);
+
+    friend class AnalysisAggregation;
+    ElementByElementLinSOE(AnalysisAggregation *);
+    SystemOfEqn *getCopy(void) const;
+  public:
+    virtual int setSize(Graph &theGraph);
+    virtual int addA(const Matrix &, const ID &, double fact = 1.0);
+    virtual void zeroA(void);
+
+    int formAp(const Vector &p, Vector &Ap);
+    int setupPreconditioner(void);
+    int applyPreconditioner(const Vector &r, Vector &z) const;
+
+    void setPreconditionerType(const PreconditionerType &);
+    void setPreconditioner(const std::string &);
+    std::string getPreconditioner(void) const;
+    void setNumThreads(const int &);
+    int getNumThreads(void) const;
+    void setParallelThreshold(const size_t &);
+    size_t getParallelThreshold(void) const;
+    void setMatrixFree(const bool &);
+    bool getMatrixFree(void) const;
+    size_t getNumElementBlocks(void) const;
+    size_t getCacheSize(void) const;
+
+    int getNumIterations(void) const;
+    double getResidualNorm(void) const;
+
+    int sendSelf(CommParameters &);
+    int recvSelf(const CommParameters &);
+
+    friend class PCG_LinSolver;
+  };
+
+inline SystemOfEqn *ElementByElementLinSOE::getCopy(void) const
+  { return new ElementByElementLinSOE(*this); }
+} // end of XC namespace
+
+
+#endif
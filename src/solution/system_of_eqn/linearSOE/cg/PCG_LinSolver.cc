@@ -0,0 +1,188 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//PCG_LinSolver.cc
+
+#include "PCG_LinSolver.h"
+#include "ElementByElementLinSOE.h"
+#include <cmath>
+
+//! @brief Constructor.
+//!
+//! @param tol: relative tolerance for the residual norm.
+//! @param maxIter: maximum number of iterations.
+XC::PCG_LinSolver::PCG_LinSolver(const double &tol,const int &maxIter)
+  :LinearSOESolver(SOLVER_TAGS_PCG_LinSolver), theSOE(nullptr),
+   tolerance(tol), maxNumIterations(maxIter), numIterations(0),
+   residualNorm(0.0), totalNumIterations(0) {}
+
+//! @brief Sets the system of equations to solve.
+bool XC::PCG_LinSolver::setLinearSOE(LinearSOE *soe)
+  {
+    bool retval= false;
+    ElementByElementLinSOE *tmp= dynamic_cast<ElementByElementLinSOE *>(soe);
+    if(tmp)
+      {
+        theSOE= tmp;
+        retval= true;
+      }
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; not a suitable system of equations" << std::endl;
+    return retval;
+  }
+
+//! @brief Resizes the work vectors.
+int XC::PCG_LinSolver::setSize(void)
+  {
+    if(!theSOE)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; no system has been set.\n";
+        return -1;
+      }
+    const int n= theSOE->size;
+    if(r.Size() != n)
+      {
+        r.resize(n);
+        z.resize(n);
+        p.resize(n);
+        Ap.resize(n);
+        x.resize(n);
+      }
+    return 0;
+  }
+
+//! @brief Solves the system with the preconditioned conjugate
+//! gradient method (zero initial guess).
+int XC::PCG_LinSolver::solve(void)
+  {
+    if(!theSOE)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; no system has been set.\n";
+        return -1;
+      }
+    numIterations= 0;
+    residualNorm= 0.0;
+    if(theSOE->size == 0)
+      return 0;
+    setSize();
+
+    int retval= theSOE->setupPreconditioner();
+    if(retval<0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; can't build the preconditioner.\n";
+        return -2;
+      }
+
+    const Vector &b= theSOE->getB();
+    const double normB= b.Norm();
+    x.Zero();
+    if(normB == 0.0)
+      {
+        theSOE->setX(x);
+        return 0;
+      }
+    const double targetNorm= tolerance*normB;
+    r= b;
+    residualNorm= normB;
+    theSOE->applyPreconditioner(r,z);
+    p= z;
+    double rz= r^z;
+    while(residualNorm > targetNorm)
+      {
+        if(numIterations>=maxNumIterations)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; no convergence after " << numIterations
+		      << " iterations (residual norm: " << residualNorm
+		      << ", target: " << targetNorm << ").\n";
+            retval= -3;
+            break;
+          }
+        theSOE->formAp(p,Ap);
+        const double pAp= p^Ap;
+        if(pAp <= 0.0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; matrix is not positive definite"
+	              << " (p^T A p= " << pAp << ").\n";
+            retval= -4;
+            break;
+          }
+        const double alpha= rz/pAp;
+        x.addVector(1.0,p,alpha); // x+= alpha*p
+        r.addVector(1.0,Ap,-alpha); // r-= alpha*A*p
+        numIterations++;
+        residualNorm= r.Norm();
+        if(residualNorm <= targetNorm)
+          break;
+        theSOE->applyPreconditioner(r,z);
+        const double oldrz= rz;
+        rz= r^z;
+        const double beta= rz/oldrz;
+        p.addVector(beta,z,1.0); // p= z + beta*p
+      }
+    totalNumIterations+= numIterations;
+    theSOE->setX(x);
+    return retval;
+  }
+
+//! @brief Sets the relative tolerance.
+void XC::PCG_LinSolver::setTolerance(const double &d)
+  { tolerance= d; }
+
+//! @brief Returns the relative tolerance.
+double XC::PCG_LinSolver::getTolerance(void) const
+  { return tolerance; }
+
+//! @brief Sets the maximum number of iterations.
+void XC::PCG_LinSolver::setMaxNumIterations(const int &i)
+  { maxNumIterations= i; }
+
+//! @brief Returns the maximum number of iterations.
+int XC::PCG_LinSolver::getMaxNumIterations(void) const
+  { return maxNumIterations; }
+
+//! @brief Returns the number of iterations of the last solution.
+int XC::PCG_LinSolver::getNumIterations(void) const
+  { return numIterations; }
+
+//! @brief Returns the norm of the residual of the last solution.
+double XC::PCG_LinSolver::getResidualNorm(void) const
+  { return residualNorm; }
+
+//! @brief Returns the number of iterations since the solver creation.
+long int XC::PCG_LinSolver::getTotalNumIterations(void) const
+  { return totalNumIterations; }
+
+int XC::PCG_LinSolver::sendSelf(CommParameters &cp)
+  { return 0; }
+
+int XC::PCG_LinSolver::recvSelf(const CommParameters &cp)
+  { return 0; }
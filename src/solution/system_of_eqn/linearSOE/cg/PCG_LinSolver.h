@@ -0,0 +1,82 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//PCG_LinSolver.h
+
+#ifndef PCG_LinSolver_h
+#define PCG_LinSolver_h
+
+#include <solution/system_of_eqn/linearSOE/LinearSOESolver.h>
+
+namespace XC {
+class ElementByElementLinSOE;
+
+//! @ingroup LinearSolver
+//
+//! @brief Preconditioned conjugate gradient solver for
+//! ElementByElementLinSOE systems.
+//!
+//! The iteration stops when
+//! \f$||r|| \leq tolerance ||b||\f$ or when the maximum number of
+//! iterations is reached. The number of iterations and the residual
+//! norm of the last solution are available to the convergence tests
+//! (through the system of equations).
+class PCG_LinSolver: public LinearSOESolver
+  {
+  private:
+    ElementByElementLinSOE *theSOE;
+    double tolerance; //!< relative tolerance.
+    int maxNumIterations; //!< maximum number of iterations.
+    int numIterations; //!< number of iterations of the last solution.
+    double residualNorm; //!< norm of the residual of the last solution.
+    long int totalNumIterations; //!< number of iterations since creation.
+    Vector r, z, p, Ap, x;
+  protected:
+    friend class LinearSOE;
+    PCG_LinSolver(const double &tol= 1e-8,const int &maxIter= 10000);
+    virtual LinearSOESolver *getCopy(void) const;
+    virtual bool setLinearSOE(LinearSOE *);
+  public:
+    virtual int setSize(void);
+    virtual int solve(void);
+
+    void setTolerance(const double &);
+    double getTolerance(void) const;
+    void setMaxNumIterations(const int &);
+    int getMaxNumIterations(void) const;
+    int getNumIterations(void) const;
+    double getResidualNorm(void) const;
+    long int getTotalNumIterations(void) const;
+
+    int sendSelf(CommParameters &);
+    int recvSelf(const CommParameters &);
+  };
+
+inline LinearSOESolver *PCG_LinSolver::getCopy(void) const
+   { return new PCG_LinSolver(*this); }
+} // end of XC namespace
+
+#endif
@@ -122,6 +122,7 @@ bool XC::FullGenLinSOE::setSolver(LinearSOESolver *newSolver)
 int XC::FullGenLinSOE::setSize(Graph &theGraph)
   {
     int result = 0;
+    clearConstantA();
     size= checkSize(theGraph);
 
     const int size2= size*size;
@@ -224,6 +225,18 @@ void XC::FullGenLinSOE::zeroA(void)
     factored = false;
   }
 
+//! @brief Stores the current matrix as its constant part (see
+//! IncrementalIntegrator::formTangent).
+bool XC::FullGenLinSOE::storeConstantA(const int &firstVarEq)
+  {
+    storeConstantPart(A,firstVarEq);
+    return true;
+  }
+
+//! @brief Sets the matrix to its stored constant part.
+bool XC::FullGenLinSOE::restoreConstantA(void)
+  { return restoreConstantPart(A); }
+
 //! @brief Sends objects through the communicator.
 int XC::FullGenLinSOE::sendSelf(CommParameters &cp)
   {
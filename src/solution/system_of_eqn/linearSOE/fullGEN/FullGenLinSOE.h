@@ -123,6 +123,10 @@ class FullGenLinSOE : public FactoredSOEBase
     
     void zeroA(void);
     
+    virtual bool storeConstantA(const int &);
+    
+    virtual bool restoreConstantA(void);
+    
     friend class FullGenLinLapackSolver;    
 
     int sendSelf(CommParameters &);
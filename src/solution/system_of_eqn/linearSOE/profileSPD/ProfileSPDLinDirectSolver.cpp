@@ -62,6 +62,7 @@
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectSolver.h>
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSOE.h>
 #include <cmath>
+#include <algorithm>
 
 //! @brief Constructor. A unique class tag defined in classTags.h
 //! is passed to the base class constructor.
@@ -160,18 +161,37 @@ int XC::ProfileSPDLinDirectSolver::solve(void)
 	// if the matrix has not been factored already factor it into U^t D U
 	// storing D^-1 in invD as we go
 
-	const double &a00 = theSOE->A[0];
-	if(a00 <= 0.0)
+	// columns before firstColumnToFactor are already factored
+	// (see ProfileSPDLinSOE::restoreConstantA), so we only need
+	// to do the forward substitution for them.
+	const int firstCol= std::max(theSOE->firstColumnToFactor,0);
+	if(firstCol==0)
 	  {
-            std::cerr << getClassName() << "::" << __FUNCTION__
-		      << "; aii < 0 (i, aii): (0,0)\n"; 
-	    return(-2);
-	  }    
-	
-        invD[0] = 1.0/theSOE->A[0];	
+	    const double &a00 = theSOE->A[0];
+	    if(a00 <= 0.0)
+	      {
+		std::cerr << getClassName() << "::" << __FUNCTION__
+			  << "; aii < 0 (i, aii): (0,0)\n"; 
+		return(-2);
+	      }    
+	    invD[0] = 1.0/theSOE->A[0];
+	  }
+	else
+	  {
+	    for(int i=1; i<firstCol; i++)
+	      {
+		int rowitop = RowTop[i];	    
+		ajiPtr = topRowPtr[i];
+		bjPtr  = &X[rowitop];  
+		double tmp = 0;	    
+		for(int j=rowitop; j<i; j++) 
+		  tmp -= *ajiPtr++ * *bjPtr++; 
+		X[i] += tmp;
+	      }
+	  }
 	
 	// for every col across 
-	for(int i=1; i<theSize; i++)
+	for(int i=std::max(firstCol,1); i<theSize; i++)
 	  {
 	    int rowitop = RowTop[i];
 	    ajiPtr = topRowPtr[i];
@@ -240,6 +260,7 @@ int XC::ProfileSPDLinDirectSolver::solve(void)
 	  }
 
 	theSOE->factored = true;
+	theSOE->firstColumnToFactor= 0;
 	theSOE->numInt = 0;
 	
 	
@@ -94,6 +94,9 @@ class ProfileSPDLinDirectSolver : public ProfileSPDLinDirectBase
 
     
     virtual int factor(int n);
+    //! @brief The solver can resume the factorization from any column.
+    virtual bool supportsPartialFactorization(void) const
+      { return true; }
     virtual int setProfileSOE(ProfileSPDLinSOE &theSOE);
 
     int sendSelf(CommParameters &);
@@ -68,7 +68,8 @@
 //! @param owr: analysis aggregation that owns this object.
 XC::ProfileSPDLinSOE::ProfileSPDLinSOE(AnalysisAggregation *owr)
   :FactoredSOEBase(owr,LinSOE_TAGS_ProfileSPDLinSOE),
-   profileSize(0), isAcondensed(false), numInt(0) {}
+   profileSize(0), isAcondensed(false), numInt(0),
+   assembledFromConstantA(false), firstColumnToFactor(0) {}
 
 //! @brief Constructor.
 //!
@@ -76,7 +77,8 @@ XC::ProfileSPDLinSOE::ProfileSPDLinSOE(AnalysisAggregation *owr)
 //! @param classTag: identifier of the class.
 XC::ProfileSPDLinSOE::ProfileSPDLinSOE(AnalysisAggregation *owr,int classTag)
   :FactoredSOEBase(owr,classTag),
-   profileSize(0), isAcondensed(false), numInt(0) {}
+   profileSize(0), isAcondensed(false), numInt(0),
+   assembledFromConstantA(false), firstColumnToFactor(0) {}
 
 
 //! @brief Constructor.
@@ -94,7 +96,8 @@ XC::ProfileSPDLinSOE::ProfileSPDLinSOE(AnalysisAggregation *owr,int classTag)
 //! @param the_Solver: pointer to the solver to use.
 XC::ProfileSPDLinSOE::ProfileSPDLinSOE(AnalysisAggregation *owr,int N, int *iLoc,ProfileSPDLinSolver *the_Solver)
   :FactoredSOEBase(owr,LinSOE_TAGS_ProfileSPDLinSOE,N),
-   profileSize(0), isAcondensed(false), numInt(0)
+   profileSize(0), isAcondensed(false), numInt(0),
+   assembledFromConstantA(false), firstColumnToFactor(0)
   {
     size = N;
     profileSize= iLoc[N-1];
@@ -161,6 +164,9 @@ bool XC::ProfileSPDLinSOE::setSolver(LinearSOESolver *newSolver)
 int XC::ProfileSPDLinSOE::setSize(Graph &theGraph)
   {
     int result = 0;
+    clearConstantA();
+    assembledFromConstantA= false;
+    firstColumnToFactor= 0;
     size= checkSize(theGraph);
 
     // check we have enough space in iDiagLoc and iLastCol
@@ -324,6 +330,57 @@ void XC::ProfileSPDLinSOE::zeroA(void)
   {
     A.Zero();
     factored = false;
+    assembledFromConstantA= false;
+    firstColumnToFactor= 0;
+  }
+
+//! @brief Stores the current matrix as its constant part (see
+//! IncrementalIntegrator::formTangent).
+//!
+//! @param firstVarEq: first equation that receives variable
+//! contributions; the columns before it are equal to the
+//! constant part so, if the solver supports it, their factorization
+//! can be reused (see restoreConstantA).
+bool XC::ProfileSPDLinSOE::storeConstantA(const int &firstVarEq)
+  {
+    storeConstantPart(A,firstVarEq);
+    assembledFromConstantA= true;
+    firstColumnToFactor= 0;
+    return true;
+  }
+
+//! @brief Sets the matrix to its stored constant part.
+//!
+//! If the current matrix has been obtained from the constant part and
+//! it's already factored, the columns before the first variable equation
+//! are kept (they contain the factorization of the constant part) and
+//! only the following ones are restored, so the solver can resume the
+//! factorization from that column.
+bool XC::ProfileSPDLinSOE::restoreConstantA(void)
+  {
+    bool retval= false;
+    if(constantAStored && (A.Size()==constantA.Size()))
+      {
+        const ProfileSPDLinSolver *theSolver= dynamic_cast<const ProfileSPDLinSolver *>(getSolver());
+        const bool partial= factored && assembledFromConstantA && !isAcondensed && theSolver && theSolver->supportsPartialFactorization() && (firstVariableEq>0) && (firstVariableEq<size);
+        if(partial)
+          {
+            const int start= iDiagLoc(firstVariableEq-1); // FORTRAN indexing: end of the previous column.
+            const int end= iDiagLoc(size-1);
+            for(int i= start;i<end;i++)
+              A(i)= constantA(i);
+            firstColumnToFactor= firstVariableEq;
+          }
+        else
+          {
+            A= constantA;
+            firstColumnToFactor= 0;
+          }
+        factored= false;
+        assembledFromConstantA= true;
+        retval= true;
+      }
+    return retval;
   }
 
 
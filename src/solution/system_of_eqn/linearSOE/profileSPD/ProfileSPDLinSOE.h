@@ -123,6 +123,8 @@ class ProfileSPDLinSOE: public FactoredSOEBase
     ID iDiagLoc;
     bool isAcondensed;
     int numInt;
+    bool assembledFromConstantA; //!< true if A has been built from its stored constant part.
+    int firstColumnToFactor; //!< first column to factor (previous columns already factored).
   protected:
     virtual bool setSolver(LinearSOESolver *);
 
@@ -137,6 +139,8 @@ class ProfileSPDLinSOE: public FactoredSOEBase
     virtual int addA(const Matrix &, const ID &, double fact = 1.0);
     
     virtual void zeroA(void);
+    virtual bool storeConstantA(const int &);
+    virtual bool restoreConstantA(void);
 
     virtual int sendSelf(CommParameters &);
     virtual int recvSelf(const CommParameters &);
@@ -84,6 +84,10 @@ class ProfileSPDLinSolver: public virtual LinearSOESolver
 
     virtual int solve(void) = 0;
     virtual bool setLinearSOE(ProfileSPDLinSOE &theSOE);
+    //! @brief Return true if the solver can resume the factorization
+    //! from a given column (see ProfileSPDLinSOE::restoreConstantA).
+    virtual bool supportsPartialFactorization(void) const
+      { return false; }
   };
 } // end of XC namespace
 
@@ -92,6 +92,9 @@ class ProfileSPDLinSubstrSolver : public ProfileSPDLinDirectSolver,
     virtual LinearSOESolver *getCopy(void) const;
   public:
     int solve(void);
+    //! @brief Condensation doesn't support partial factorization.
+    virtual bool supportsPartialFactorization(void) const
+      { return false; }
     int condenseA(int numInt);
     int condenseRHS(int numInt, Vector *v =0);
     int computeCondensedMatVect(int numInt, const Vector &u);    
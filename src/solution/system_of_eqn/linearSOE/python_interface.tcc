@@ -22,7 +22,7 @@
 //python_interface.tcc
 
 class_<XC::LinearSOE, bases<XC::SystemOfEqn>, boost::noncopyable >("LinearSOE", no_init)
-.def("newSolver", &XC::LinearSOE::newSolver,return_internal_reference<>()," \n""newSolver(type)""Define the solver to be used.""Parameters: \n""type: type of solver. Available types: 'band_gen_lin_lapack_solver', 'band_spd_lin_lapack_solver', 'diagonal_direct_solver', 'distributed_diagonal_solver', 'full_gen_lin_lapack_solver', 'profile_spd_lin_direct_solver', 'profile_spd_lin_direct_block_solver', 'super_lu_solver', 'sym_sparse_lin_solver'" )
+.def("newSolver", &XC::LinearSOE::newSolver,return_internal_reference<>()," \n""newSolver(type)""Define the solver to be used.""Parameters: \n""type: type of solver. Available types: 'band_gen_lin_lapack_solver', 'band_spd_lin_lapack_solver', 'diagonal_direct_solver', 'distributed_diagonal_solver', 'full_gen_lin_lapack_solver', 'pcg_lin_solver', 'profile_spd_lin_direct_solver', 'profile_spd_lin_direct_block_solver', 'super_lu_solver', 'sym_sparse_lin_solver'" )
   ;
 
 class_<XC::LinearSOEData, bases<XC::LinearSOE>, boost::noncopyable >("LinearSOEData", no_init);
@@ -42,6 +42,17 @@ class_<XC::DiagonalSOE, bases<XC::FactoredSOEBase>, boost::noncopyable >("Diagon
 
 
 
+class_<XC::ElementByElementLinSOE, bases<XC::LinearSOEData>, boost::noncopyable >("ElementByElementLinSOE", no_init)
+  .add_property("preconditioner", &XC::ElementByElementLinSOE::getPreconditioner, &XC::ElementByElementLinSOE::setPreconditioner,"preconditioner type: 'jacobi', 'block_jacobi' or 'incomplete_cholesky'.")
+  .add_property("numThreads", &XC::ElementByElementLinSOE::getNumThreads, &XC::ElementByElementLinSOE::setNumThreads,"number of threads used to compute the matrix-vector products.")
+  .add_property("parallelThreshold", &XC::ElementByElementLinSOE::getParallelThreshold, &XC::ElementByElementLinSOE::setParallelThreshold,"minimum number of values in the element cache to compute the matrix-vector products in parallel.")
+  .add_property("matrixFree", &XC::ElementByElementLinSOE::getMatrixFree, &XC::ElementByElementLinSOE::setMatrixFree,"if true the element matrices are not stored (they are computed again for each matrix-vector product).")
+  .add_property("numElementBlocks", &XC::ElementByElementLinSOE::getNumElementBlocks,"number of element contributions stored.")
+  .add_property("cacheSize", &XC::ElementByElementLinSOE::getCacheSize,"number of matrix values stored in the element cache.")
+  .add_property("numIterations", &XC::ElementByElementLinSOE::getNumIterations,"number of iterations of the last solution.")
+  .add_property("residualNorm", &XC::ElementByElementLinSOE::getResidualNorm,"norm of the residual of the last solution.")
+    ;
+
 class_<XC::FullGenLinSOE, bases<XC::FactoredSOEBase>, boost::noncopyable >("FullGenLinSOE", no_init)
     ;
 
@@ -115,6 +126,14 @@ class_<XC::BandSPDLinLapackSolver, bases<XC::BandSPDLinSolver>, boost::noncopyab
 
 class_<XC::ConjugateGradientSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("ConjugateGradientSolver", no_init);
 
+class_<XC::PCG_LinSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("PCG_LinSolver", no_init)
+  .add_property("tolerance", &XC::PCG_LinSolver::getTolerance, &XC::PCG_LinSolver::setTolerance,"relative tolerance for the residual norm.")
+  .add_property("maxNumIterations", &XC::PCG_LinSolver::getMaxNumIterations, &XC::PCG_LinSolver::setMaxNumIterations,"maximum number of iterations.")
+  .add_property("numIterations", &XC::PCG_LinSolver::getNumIterations,"number of iterations of the last solution.")
+  .add_property("residualNorm", &XC::PCG_LinSolver::getResidualNorm,"norm of the residual of the last solution.")
+  .add_property("totalNumIterations", &XC::PCG_LinSolver::getTotalNumIterations,"number of iterations since the solver creation.")
+  ;
+
 class_<XC::DiagonalSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("DiagonalSolver", no_init);
 
 class_<XC::DiagonalDirectSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("DiagonalDirectSolver", no_init);
@@ -100,6 +100,10 @@ class DistributedSparseGenRowLinSolver;
     SystemOfEqn *getCopy(void) const;
   public:
     int setSize(Graph &theGraph);
+    //! @brief Constant part of the matrix not supported (the
+    //! matrix is completed with the contributions of other processes).
+    inline virtual bool storeConstantA(const int &)
+      { return false; }
     int addA(const Matrix &, const ID &, double fact = 1.0);
     int addB(const Vector &, const ID &, double fact = 1.0);
     
@@ -122,6 +122,7 @@ bool XC::SparseGenColLinSOE::setSolver(LinearSOESolver *newSolver)
 int XC::SparseGenColLinSOE::setSize(Graph &theGraph)
   {
     int result = 0;
+    clearConstantA();
     size= checkSize(theGraph);
 
     // fist iterate through the vertices of the graph to get nnz
@@ -83,6 +83,7 @@ bool XC::SparseGenRowLinSOE::setSolver(LinearSOESolver *newSolver)
 int XC::SparseGenRowLinSOE::setSize(Graph &theGraph)
   {
     int result = 0;
+    clearConstantA();
     size= checkSize(theGraph);
 
     // fist iterate through the vertices of the graph to get nnz
@@ -45,3 +45,15 @@ void XC::SparseGenSOEBase::zeroA(void)
     factored = false;
   }
 
+//! @brief Stores the current matrix as its constant part (see
+//! IncrementalIntegrator::formTangent).
+bool XC::SparseGenSOEBase::storeConstantA(const int &firstVarEq)
+  {
+    storeConstantPart(A,firstVarEq);
+    return true;
+  }
+
+//! @brief Sets the matrix to its stored constant part.
+bool XC::SparseGenSOEBase::restoreConstantA(void)
+  { return restoreConstantPart(A); }
+
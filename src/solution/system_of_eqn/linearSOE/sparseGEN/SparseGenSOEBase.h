@@ -46,6 +46,8 @@ class SparseGenSOEBase: public SparseSOEBase
 
   public:
     virtual void zeroA(void);
+    virtual bool storeConstantA(const int &);
+    virtual bool restoreConstantA(void);
   };
 } // end of XC namespace
 
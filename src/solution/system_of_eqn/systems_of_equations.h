@@ -68,6 +68,8 @@
 #include <solution/system_of_eqn/linearSOE/sparseGEN/SparseGenColLinSOE.h>
 #include <solution/system_of_eqn/linearSOE/sparseGEN/SparseGenRowLinSOE.h>
 #include <solution/system_of_eqn/linearSOE/cg/ConjugateGradientSolver.h>
+#include "solution/system_of_eqn/linearSOE/cg/ElementByElementLinSOE.h"
+#include "solution/system_of_eqn/linearSOE/cg/PCG_LinSolver.h"
 
 #include <solution/system_of_eqn/eigenSOE/EigenSOE.h>
 #include <solution/system_of_eqn/eigenSOE/ArpackSOE.h>
@@ -0,0 +1,234 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ObjectArena.cc
+
+#include "ObjectArena.h"
+#include <new>
+
+thread_local XC::ObjectArena *XC::ObjectArena::current= nullptr;
+
+//! @brief Constructor: makes the arena the current one of the
+//! calling thread.
+XC::ObjectArena::Scope::Scope(ObjectArena *arena)
+  : previous(current)
+  { current= arena; }
+
+//! @brief Destructor: restores the previous arena.
+XC::ObjectArena::Scope::~Scope(void)
+  { current= previous; }
+
+//! @brief Constructor.
+XC::ObjectArena::ObjectArena(const std::string &nmb)
+  : name(nmb), sizeClasses(maxObjectSize/alignment), numLiveObjects(0), bytesInUse(0), detached(false) {}
+
+//! @brief Destructor.
+XC::ObjectArena::~ObjectArena(void)
+  { free_chunks(); }
+
+//! @brief Return the index of the size class for the argument.
+size_t XC::ObjectArena::getSizeClass(const size_t &sz)
+  { return (sz+alignment-1)/alignment-1; }
+
+//! @brief Free the memory chunks.
+void XC::ObjectArena::free_chunks(void)
+  {
+    for(std::vector<char *>::iterator i= chunks.begin();i!=chunks.end();i++)
+      ::operator delete(*i);
+    chunks.clear();
+    for(std::vector<SizeClass>::iterator i= sizeClasses.begin();i!=sizeClasses.end();i++)
+      *i= SizeClass();
+  }
+
+//! @brief Return a block of memory of the size being passed
+//! as parameter (header included).
+void *XC::ObjectArena::allocate_block(const size_t &sz)
+  {
+    std::lock_guard<std::mutex> lock(mtx);
+    numLiveObjects++;
+    if(sz>maxObjectSize)
+      {
+        bytesInUse+= sz;
+        return ::operator new(sz);
+      }
+    const size_t idx= getSizeClass(sz);
+    const size_t blockSize= (idx+1)*alignment;
+    SizeClass &sc= sizeClasses[idx];
+    void *retval= nullptr;
+    if(sc.freeList)
+      {
+        retval= sc.freeList;
+        sc.freeList= sc.freeList->next;
+      }
+    else
+      {
+        if(sc.next+blockSize>sc.end)
+          {
+            char *chunk= static_cast<char *>(::operator new(chunkSize));
+            chunks.push_back(chunk);
+            sc.next= chunk;
+            sc.end= chunk+chunkSize;
+          }
+        retval= sc.next;
+        sc.next+= blockSize;
+      }
+    bytesInUse+= blockSize;
+    return retval;
+  }
+
+//! @brief Return the block of memory to the arena. If the arena
+//! has been detached from its owner and this is its last block
+//! the arena is deleted.
+//!
+//! @param p: pointer to the block.
+//! @param sz: size of the block (the same used in allocate_block).
+void XC::ObjectArena::deallocate_block(void *p,const size_t &sz)
+  {
+    bool destroy= false;
+    {
+      std::lock_guard<std::mutex> lock(mtx);
+      if(sz>maxObjectSize)
+        {
+          ::operator delete(p);
+          bytesInUse-= sz;
+        }
+      else
+        {
+          const size_t idx= getSizeClass(sz);
+          FreeBlock *block= static_cast<FreeBlock *>(p);
+          block->next= sizeClasses[idx].freeList;
+          sizeClasses[idx].freeList= block;
+          bytesInUse-= (idx+1)*alignment;
+        }
+      numLiveObjects--;
+      destroy= (detached && (numLiveObjects==0));
+    }
+    if(destroy)
+      delete this;
+  }
+
+//! @brief Return the current arena of the calling thread (nullptr
+//! if the objects are allocated from the global heap).
+XC::ObjectArena *XC::ObjectArena::getCurrent(void)
+  { return current; }
+
+//! @brief Return a block of memory for an object of the size
+//! being passed as parameter. The block comes from the current
+//! arena or, if there is none, from the global heap.
+void *XC::ObjectArena::allocate(size_t sz)
+  {
+    if(sz==0)
+      sz= 1;
+    const size_t total= sz+sizeof(BlockHeader);
+    ObjectArena *arena= current;
+    BlockHeader *block= nullptr;
+    if(arena)
+      block= static_cast<BlockHeader *>(arena->allocate_block(total));
+    else
+      block= static_cast<BlockHeader *>(::operator new(total));
+    block->arena= arena;
+    return block+1;
+  }
+
+//! @brief Return the memory of the object to the arena it
+//! comes from (or to the global heap).
+//!
+//! @param p: pointer to the object.
+//! @param sz: size of the object (the same used in allocate).
+void XC::ObjectArena::deallocate(void *p,size_t sz)
+  {
+    if(!p)
+      return;
+    if(sz==0)
+      sz= 1;
+    BlockHeader *block= static_cast<BlockHeader *>(p)-1;
+    ObjectArena *arena= block->arena;
+    if(arena)
+      arena->deallocate_block(block,sz+sizeof(BlockHeader));
+    else
+      ::operator delete(block);
+  }
+
+//! @brief Called by the owner of the arena instead of delete: the
+//! arena is deleted now if none of its objects is alive, otherwise
+//! it will be deleted with its last object.
+void XC::ObjectArena::detach(ObjectArena *arena)
+  {
+    if(!arena)
+      return;
+    bool destroy= false;
+    {
+      std::lock_guard<std::mutex> lock(arena->mtx);
+      arena->detached= true;
+      destroy= (arena->numLiveObjects==0);
+    }
+    if(destroy)
+      delete arena;
+  }
+
+//! @brief Release all the memory chunks if no object
+//! allocated from the arena remains alive. Return true
+//! if the memory has been released.
+bool XC::ObjectArena::release(void)
+  {
+    bool retval= false;
+    std::lock_guard<std::mutex> lock(mtx);
+    if(numLiveObjects==0)
+      {
+        free_chunks();
+        retval= true;
+      }
+    return retval;
+  }
+
+//! @brief Return the name of the arena.
+const std::string &XC::ObjectArena::getName(void) const
+  { return name; }
+
+//! @brief Return the number of objects allocated and not freed yet.
+size_t XC::ObjectArena::getNumLiveObjects(void) const
+  {
+    std::lock_guard<std::mutex> lock(mtx);
+    return numLiveObjects;
+  }
+
+//! @brief Return the memory used by the live objects.
+size_t XC::ObjectArena::getBytesInUse(void) const
+  {
+    std::lock_guard<std::mutex> lock(mtx);
+    return bytesInUse;
+  }
+
+//! @brief Return the memory reserved by the arena.
+size_t XC::ObjectArena::getBytesReserved(void) const
+  {
+    std::lock_guard<std::mutex> lock(mtx);
+    return chunks.size()*chunkSize;
+  }
+
+//! @brief Print stuff.
+void XC::ObjectArena::Print(std::ostream &os) const
+  {
+    os << "arena: " << name
+       << " live objects: " << getNumLiveObjects()
+       << " bytes in use: " << getBytesInUse()
+       << " bytes reserved: " << getBytesReserved() << std::endl;
+  }
@@ -0,0 +1,123 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ObjectArena.h
+
+#ifndef ObjectArena_h
+#define ObjectArena_h
+
+#include <cstddef>
+#include <vector>
+#include <string>
+#include <mutex>
+#include <iostream>
+
+namespace XC {
+
+//! @ingroup Utils
+//
+//! @brief Pool of memory for the small objects created when meshing
+//! (elements and their materials, sections and fibers).
+//!
+//! Each mesh owns an arena. The objects created while an arena is the
+//! current one of the thread (see Scope) are allocated from large
+//! chunks of memory, so the objects created consecutively (i. e. in
+//! mesh order) are contiguous in memory. The objects created out of
+//! any scope (seed elements, material prototypes,...) come from
+//! the global heap. Each block stores the arena it comes from, so it
+//! is returned to it no matter which arena is current when it's
+//! deleted. There is a free list for each size class, so freed blocks
+//! are reused by the next objects of the same size. When no object
+//! allocated from the arena remains alive, its chunks can be
+//! released in bulk (see release).
+class ObjectArena
+  {
+  public:
+    static const size_t alignment= 16; //!< alignment of the allocated blocks.
+    static const size_t maxObjectSize= 4096; //!< bigger objects are allocated with the global operator new (but still counted by the arena).
+    static const size_t chunkSize= 64*1024; //!< size of the memory chunks.
+
+    //! @brief Makes an arena the current one of the calling thread
+    //! while the object is alive.
+    class Scope
+      {
+        ObjectArena *previous; //!< arena to restore.
+        Scope(const Scope &);
+        Scope &operator=(const Scope &);
+      public:
+        explicit Scope(ObjectArena *);
+        ~Scope(void);
+      };
+  private:
+    //! @brief Block in a free list.
+    struct FreeBlock
+      { FreeBlock *next; };
+    //! @brief Header of each block (arena that owns it).
+    union BlockHeader
+      {
+        ObjectArena *arena;
+        char padding[alignment];
+      };
+    //! @brief Blocks with the same (rounded) size.
+    struct SizeClass
+      {
+        FreeBlock *freeList; //!< freed blocks.
+        char *next; //!< next free position in the current chunk.
+        char *end; //!< end of the current chunk.
+        SizeClass(void)
+          : freeList(nullptr), next(nullptr), end(nullptr) {}
+      };
+    std::string name; //!< arena name.
+    std::vector<SizeClass> sizeClasses; //!< one entry for each size class.
+    std::vector<char *> chunks; //!< memory chunks.
+    size_t numLiveObjects; //!< number of objects allocated and not freed yet.
+    size_t bytesInUse; //!< memory used by the live objects.
+    bool detached; //!< if true the owner is gone, the arena is deleted with its last object.
+    mutable std::mutex mtx; //!< protects this arena (an object can be deleted from any thread).
+    static thread_local ObjectArena *current; //!< arena used by the calling thread.
+
+    static size_t getSizeClass(const size_t &);
+    void free_chunks(void);
+    void *allocate_block(const size_t &);
+    void deallocate_block(void *,const size_t &);
+
+    ObjectArena(const ObjectArena &);
+    ObjectArena &operator=(const ObjectArena &);
+  public:
+    ObjectArena(const std::string &);
+    ~ObjectArena(void);
+
+    static ObjectArena *getCurrent(void);
+    static void *allocate(size_t);
+    static void deallocate(void *,size_t);
+    static void detach(ObjectArena *);
+    bool release(void);
+
+    const std::string &getName(void) const;
+    size_t getNumLiveObjects(void) const;
+    size_t getBytesInUse(void) const;
+    size_t getBytesReserved(void) const;
+    void Print(std::ostream &) const;
+  };
+
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,144 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//WorkerPool.cc
+
+#include "WorkerPool.h"
+
+//! @brief Constructor.
+//! @param numThreads: number of threads (including the calling one).
+XC::WorkerPool::WorkerPool(const size_t &numThreads)
+  : task(nullptr), numTasks(0), nextTask(0), numBusy(0), generation(0), stop(false)
+  { resize(numThreads); }
+
+//! @brief Copy constructor (creates its own threads).
+XC::WorkerPool::WorkerPool(const WorkerPool &other)
+  : task(nullptr), numTasks(0), nextTask(0), numBusy(0), generation(0), stop(false)
+  { resize(other.getNumThreads()); }
+
+//! @brief Assignment operator (keeps its own threads).
+XC::WorkerPool &XC::WorkerPool::operator=(const WorkerPool &other)
+  {
+    if(this!=&other)
+      resize(other.getNumThreads());
+    return *this;
+  }
+
+//! @brief Destructor.
+XC::WorkerPool::~WorkerPool(void)
+  { join(); }
+
+//! @brief Stops the worker threads and waits for them to finish.
+void XC::WorkerPool::join(void)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mtx);
+      stop= true;
+    }
+    startCond.notify_all();
+    for(std::vector<std::thread>::iterator i= workers.begin();i!=workers.end();i++)
+      i->join();
+    workers.clear();
+    stop= false;
+  }
+
+//! @brief Sets the number of threads (including the calling one).
+void XC::WorkerPool::resize(const size_t &numThreads)
+  {
+    const size_t numWorkers= (numThreads>1) ? numThreads-1 : 0;
+    if(numWorkers!=workers.size())
+      {
+        join();
+        for(size_t i= 0;i<numWorkers;i++)
+          workers.push_back(std::thread(&WorkerPool::workerLoop,this,generation));
+      }
+  }
+
+//! @brief Returns the number of threads (including the calling one).
+size_t XC::WorkerPool::getNumThreads(void) const
+  { return workers.size()+1; }
+
+//! @brief Executes the tasks of the current run until there are
+//! no more indexes left.
+void XC::WorkerPool::work(void)
+  {
+    for(;;)
+      {
+        size_t i= 0;
+        {
+          std::lock_guard<std::mutex> lock(mtx);
+          if(nextTask>=numTasks)
+            break;
+          i= nextTask++;
+        }
+        (*task)(i);
+      }
+  }
+
+//! @brief Loop executed by each worker thread.
+//! @param lastGeneration: run identifier when the thread was created.
+void XC::WorkerPool::workerLoop(size_t lastGeneration)
+  {
+    for(;;)
+      {
+        {
+          std::unique_lock<std::mutex> lock(mtx);
+          startCond.wait(lock,[&]{ return stop || (generation!=lastGeneration); });
+          if(stop)
+            return;
+          lastGeneration= generation;
+        }
+        work();
+        {
+          std::lock_guard<std::mutex> lock(mtx);
+          numBusy--;
+          if(numBusy==0)
+            doneCond.notify_all();
+        }
+      }
+  }
+
+//! @brief Calls f(i) for i in [0,n) distributing the calls between
+//! the threads of the pool. Returns when all the calls have finished.
+void XC::WorkerPool::run(const size_t &n,const std::function<void(size_t)> &f)
+  {
+    if(workers.empty() || (n<2))
+      {
+        for(size_t i= 0;i<n;i++)
+          f(i);
+      }
+    else
+      {
+        {
+          std::lock_guard<std::mutex> lock(mtx);
+          task= &f;
+          numTasks= n;
+          nextTask= 0;
+          numBusy= workers.size();
+          generation++;
+        }
+        startCond.notify_all();
+        work(); // the calling thread works too.
+        std::unique_lock<std::mutex> lock(mtx);
+        doneCond.wait(lock,[&]{ return numBusy==0; });
+        task= nullptr;
+      }
+  }
@@ -0,0 +1,73 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//WorkerPool.h
+
+#ifndef WorkerPool_h
+#define WorkerPool_h
+
+#include <cstddef>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+namespace XC {
+
+//! @ingroup Utils
+//
+//! @brief Persistent set of worker threads.
+//!
+//! The threads are created once (see resize) and wait for work between
+//! calls to run, so the cost of creating them is not paid each time a
+//! parallel loop is executed. The calling thread takes part in the
+//! work too, so a pool with n threads has n-1 workers.
+class WorkerPool
+  {
+    std::vector<std::thread> workers; //!< worker threads.
+    std::mutex mtx; //!< protects the members below.
+    std::condition_variable startCond; //!< signals new work (or stop).
+    std::condition_variable doneCond; //!< signals the end of the work.
+    const std::function<void(size_t)> *task; //!< task to execute.
+    size_t numTasks; //!< number of task indexes of the current run.
+    size_t nextTask; //!< next index to execute.
+    size_t numBusy; //!< number of workers still working on the current run.
+    size_t generation; //!< identifier of the current run.
+    bool stop; //!< true if the workers must finish.
+
+    void work(void);
+    void workerLoop(size_t);
+    void join(void);
+  public:
+    WorkerPool(const size_t &numThreads= 1);
+    WorkerPool(const WorkerPool &);
+    WorkerPool &operator=(const WorkerPool &);
+    ~WorkerPool(void);
+
+    void resize(const size_t &numThreads);
+    size_t getNumThreads(void) const;
+    void run(const size_t &,const std::function<void(size_t)> &);
+  };
+
+} // end of XC namespace
+
+#endif
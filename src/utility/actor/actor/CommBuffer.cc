@@ -0,0 +1,193 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//CommBuffer.cc
+
+#include "CommBuffer.h"
+#include "utility/matrix/ID.h"
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/Matrix.h"
+#include <cstring>
+#include <stdint.h>
+#include <iostream>
+
+//! @brief Header of each record.
+struct CommBufferRecordHeader
+  {
+    int32_t type; //!< record type.
+    int32_t dbTag; //!< database tag of the record.
+    uint64_t count; //!< number of items.
+  };
+
+//! @brief Returns the number of bytes rounded up to a multiple of 8.
+inline size_t comm_buffer_padded(const size_t &numBytes)
+  { return (numBytes+7)/8*8; }
+
+//! @brief Constructor.
+XC::CommBuffer::CommBuffer(void)
+  : numBytes(0), numRecords(0), previous(nullptr) {}
+
+//! @brief Removes the records.
+void XC::CommBuffer::clear(void)
+  {
+    data.clear();
+    numBytes= 0;
+    index.clear();
+    numRecords= 0;
+  }
+
+//! @brief Resizes the buffer to receive numDoubles values.
+void XC::CommBuffer::resize(const size_t &numDoubles)
+  {
+    index.clear();
+    numRecords= 0;
+    data.resize(numDoubles);
+    numBytes= numDoubles*sizeof(double);
+  }
+
+//! @brief Appends a record to the buffer.
+//!
+//! @param type: record type.
+//! @param dbTag: database tag of the record.
+//! @param src: pointer to the data.
+//! @param itemSize: size of each item.
+//! @param count: number of items.
+void XC::CommBuffer::append(const int &type,const int &dbTag,const void *src,const size_t &itemSize,const size_t &count)
+  {
+    const size_t dataBytes= itemSize*count;
+    const size_t recordBytes= sizeof(CommBufferRecordHeader)+comm_buffer_padded(dataBytes);
+    data.resize((numBytes+recordBytes)/sizeof(double));
+    char *pos= reinterpret_cast<char *>(data.data())+numBytes;
+    CommBufferRecordHeader hdr;
+    hdr.type= type;
+    hdr.dbTag= dbTag;
+    hdr.count= count;
+    memcpy(pos,&hdr,sizeof(hdr));
+    pos+= sizeof(hdr);
+    if(dataBytes>0)
+      memcpy(pos,src,dataBytes);
+    memset(pos+dataBytes,0,comm_buffer_padded(dataBytes)-dataBytes);
+    index[Key(type,dbTag)].pos.push_back(numBytes);
+    numRecords++;
+    numBytes+= recordBytes;
+  }
+
+//! @brief Builds the index of the records from the contents
+//! of the buffer (after receiving it).
+int XC::CommBuffer::buildIndex(void)
+  {
+    index.clear();
+    numRecords= 0;
+    const char *base= reinterpret_cast<const char *>(data.data());
+    size_t pos= 0;
+    while(pos<numBytes)
+      {
+        CommBufferRecordHeader hdr;
+        if(pos+sizeof(hdr)>numBytes)
+          {
+	    std::cerr << "CommBuffer::" << __FUNCTION__
+		      << "; corrupted buffer at position: "
+		      << pos << std::endl;
+            return -1;
+          }
+        memcpy(&hdr,base+pos,sizeof(hdr));
+        size_t itemSize= sizeof(double);
+        if(hdr.type==ID_RECORD)
+          itemSize= sizeof(int);
+        else if((hdr.type!=VECTOR_RECORD) && (hdr.type!=MATRIX_RECORD))
+          {
+	    std::cerr << "CommBuffer::" << __FUNCTION__
+		      << "; unknown record type: " << hdr.type
+		      << " at position: " << pos << std::endl;
+            return -1;
+          }
+        index[Key(hdr.type,hdr.dbTag)].pos.push_back(pos);
+        numRecords++;
+        pos+= sizeof(hdr)+comm_buffer_padded(itemSize*hdr.count);
+      }
+    if(pos!=numBytes)
+      {
+        std::cerr << "CommBuffer::" << __FUNCTION__
+                  << "; corrupted buffer (last record truncated)." << std::endl;
+        return -1;
+      }
+    return 0;
+  }
+
+//! @brief Copies the data of the next record with the given type
+//! and dbTag into the destination.
+//!
+//! @param type: record type.
+//! @param dbTag: database tag of the record.
+//! @param dest: pointer to the destination.
+//! @param itemSize: size of each item.
+//! @param count: number of items expected.
+int XC::CommBuffer::extract(const int &type,const int &dbTag,void *dest,const size_t &itemSize,const size_t &count) const
+  {
+    Index::const_iterator i= index.find(Key(type,dbTag));
+    if((i==index.end()) || (i->second.next>=i->second.pos.size()))
+      {
+	std::cerr << "CommBuffer::" << __FUNCTION__
+		  << "; record of type: " << type << " and dbTag: "
+                  << dbTag << " not found." << std::endl;
+        return -1;
+      }
+    const Positions &positions= i->second;
+    const char *pos= reinterpret_cast<const char *>(data.data())+positions.pos[positions.next];
+    positions.next++;
+    CommBufferRecordHeader hdr;
+    memcpy(&hdr,pos,sizeof(hdr));
+    if(hdr.count!=count)
+      {
+	std::cerr << "CommBuffer::" << __FUNCTION__
+		  << "; record of type: " << type << " and dbTag: "
+                  << dbTag << " has " << hdr.count
+                  << " items, " << count << " expected." << std::endl;
+        return -2;
+      }
+    if(count>0)
+      memcpy(dest,pos+sizeof(hdr),itemSize*count);
+    return 0;
+  }
+
+//! @brief Appends the ID to the buffer.
+void XC::CommBuffer::appendID(const int &dbTag,const ID &v)
+  { append(ID_RECORD,dbTag,v.getDataPtr(),sizeof(int),v.Size()); }
+
+//! @brief Appends the vector to the buffer.
+void XC::CommBuffer::appendVector(const int &dbTag,const Vector &v)
+  { append(VECTOR_RECORD,dbTag,v.getDataPtr(),sizeof(double),v.Size()); }
+
+//! @brief Appends the matrix to the buffer.
+void XC::CommBuffer::appendMatrix(const int &dbTag,const Matrix &m)
+  { append(MATRIX_RECORD,dbTag,m.getDataPtr(),sizeof(double),m.noRows()*m.noCols()); }
+
+//! @brief Reads the ID from the buffer.
+int XC::CommBuffer::extractID(const int &dbTag,ID &v) const
+  { return extract(ID_RECORD,dbTag,v.getDataPtr(),sizeof(int),v.Size()); }
+
+//! @brief Reads the vector from the buffer.
+int XC::CommBuffer::extractVector(const int &dbTag,Vector &v) const
+  { return extract(VECTOR_RECORD,dbTag,v.getDataPtr(),sizeof(double),v.Size()); }
+
+//! @brief Reads the matrix from the buffer.
+int XC::CommBuffer::extractMatrix(const int &dbTag,Matrix &m) const
+  { return extract(MATRIX_RECORD,dbTag,m.getDataPtr(),sizeof(double),m.noRows()*m.noCols()); }
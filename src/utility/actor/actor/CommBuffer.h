@@ -0,0 +1,99 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//CommBuffer.h
+                                                                        
+#ifndef CommBuffer_h
+#define CommBuffer_h
+
+#include <vector>
+#include <map>
+#include <cstddef>
+
+namespace XC {
+class ID;
+class Vector;
+class Matrix;
+
+//! @ingroup IPComm
+//
+//! @brief Contiguous buffer used to serialize a whole object graph
+//! that is sent (or stored) in a single operation.
+//!
+//! While a buffer is active (see CommParameters::beginBuffer) the
+//! IDs, vectors and matrices sent by the sendSelf methods are appended
+//! to the buffer as length-prefixed records (type, dbTag, number of
+//! items, data). On reception the records are located through an
+//! index (type, dbTag) -> positions so they are decoded directly into
+//! the destination objects. The channels that are not databases
+//! return zero as dbTag, so many records share the same key; they are
+//! extracted in the same order they were appended (the recvSelf
+//! methods read the data in the order the sendSelf methods wrote it).
+class CommBuffer
+  {
+  public:
+    enum RecordType {ID_RECORD= 1, VECTOR_RECORD= 2, MATRIX_RECORD= 3};
+  private:
+    typedef std::pair<int,int> Key; //!< (record type, dbTag)
+    //! @brief Positions of the records with the same key.
+    struct Positions
+      {
+        std::vector<size_t> pos; //!< position of each record in the buffer.
+        mutable size_t next; //!< next record to extract.
+        Positions(void)
+          : next(0) {}
+      };
+    typedef std::map<Key,Positions> Index;
+    std::vector<double> data; //!< storage (doubles to keep the records aligned).
+    size_t numBytes; //!< number of bytes used.
+    Index index; //!< position of the records in the buffer.
+    size_t numRecords; //!< number of records in the buffer.
+    CommBuffer *previous; //!< buffer active before this one.
+
+    friend class CommParameters;
+    void append(const int &,const int &,const void *,const size_t &,const size_t &);
+    int extract(const int &,const int &,void *,const size_t &,const size_t &) const;
+  public:
+    CommBuffer(void);
+    void clear(void);
+
+    inline size_t getNumBytes(void) const
+      { return numBytes; }
+    inline size_t getNumDoubles(void) const
+      { return numBytes/sizeof(double); }
+    inline size_t getNumRecords(void) const
+      { return numRecords; }
+    inline double *getDataPtr(void)
+      { return data.data(); }
+    void resize(const size_t &);
+    int buildIndex(void);
+
+    void appendID(const int &,const ID &);
+    void appendVector(const int &,const Vector &);
+    void appendMatrix(const int &,const Matrix &);
+    int extractID(const int &,ID &) const;
+    int extractVector(const int &,Vector &) const;
+    int extractMatrix(const int &,Matrix &) const;
+  };
+
+} // end of XC namespace
+
+#endif
@@ -40,17 +40,18 @@
 #include "PtrCommMetaData.h"
 #include "ArrayCommMetaData.h"
 #include "MatrixCommMetaData.h"
+#include "CommBuffer.h"
 #include "utility/actor/channel/Channel.h"
 #include "material/section/ResponseId.h"
 #include "utility/matrix/nDarray/BJtensor.h"
 
 //! @brief Constructor.
 XC::CommParameters::CommParameters(int cTag, Channel &theChannel)
-  : commitTag(cTag),canal(&theChannel),broker(nullptr) {}
+  : commitTag(cTag),canal(&theChannel),broker(nullptr),buffer(nullptr) {}
 
 //! @brief Constructor.
 XC::CommParameters::CommParameters(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
-  : commitTag(cTag),canal(&theChannel),broker(&theBroker) {}
+  : commitTag(cTag),canal(&theChannel),broker(&theBroker),buffer(nullptr) {}
 
 //! @brief Solicita al canal que devuelva un tag para la database.
 int XC::CommParameters::getDbTag(void) const
@@ -71,6 +72,11 @@ bool XC::CommParameters::isDatastore(void) const
 //! @brief Sends vector.
 int XC::CommParameters::sendID(const ID &v,const int &dataTag)
   {
+    if(buffer)
+      {
+        buffer->appendID(dataTag,v);
+        return 0;
+      }
     assert(canal);
     return canal->sendID(dataTag,commitTag,v);
   }
@@ -78,6 +84,8 @@ int XC::CommParameters::sendID(const ID &v,const int &dataTag)
 //! @brief Receives el vector.
 int XC::CommParameters::receiveID(ID &v,const int &dataTag) const
   {
+    if(buffer)
+      return buffer->extractID(dataTag,v);
     assert(canal);
     return canal->recvID(dataTag,commitTag,v);
   }
@@ -175,6 +183,11 @@ XC::MovableVector *XC::CommParameters::receiveMovableVectorPtr(MovableVector* &p
 //! @brief Send the matrix through the channel being passed as parameter.
 int XC::CommParameters::sendMatrix(const Matrix &v,const int &dataTag)
   {
+    if(buffer)
+      {
+        buffer->appendMatrix(dataTag,v);
+        return 0;
+      }
     assert(canal);
     return canal->sendMatrix(dataTag,commitTag,v);
   }
@@ -182,6 +195,8 @@ int XC::CommParameters::sendMatrix(const Matrix &v,const int &dataTag)
 //! @brief Receives the matrix through the channel being passed as parameter.
 int XC::CommParameters::receiveMatrix(Matrix &v,const int &dataTag) const
   {
+    if(buffer)
+      return buffer->extractMatrix(dataTag,v);
     assert(canal);
     return canal->recvMatrix(dataTag,commitTag,v);
   }
@@ -399,6 +414,11 @@ int XC::CommParameters::receiveIdData(DbTagData &data,const int &dataTag) const
 //! @brief Sends vector.
 int XC::CommParameters::sendVector(const Vector &v,const int &dataTag)
   {
+    if(buffer)
+      {
+        buffer->appendVector(dataTag,v);
+        return 0;
+      }
     assert(canal);
     return canal->sendVector(dataTag,commitTag,v);
   }
@@ -406,6 +426,8 @@ int XC::CommParameters::sendVector(const Vector &v,const int &dataTag)
 //! @brief Receives el vector.
 int XC::CommParameters::receiveVector(Vector &v,const int &dataTag) const
   {
+    if(buffer)
+      return buffer->extractVector(dataTag,v);
     assert(canal);
     return canal->recvVector(dataTag,commitTag,v);
   }
@@ -1083,6 +1105,125 @@ int XC::CommParameters::receiveMovable(MovableObject &mv,DbTagData &dt, const Co
     return res;
   }
 
+//! @brief Redirects the data sent from now on to the buffer
+//! being passed as parameter (see sendBuffer).
+void XC::CommParameters::openBuffer(CommBuffer &buf)
+  {
+    buf.clear();
+    buf.previous= buffer;
+    buffer= &buf;
+  }
+
+//! @brief Sends the contents of the buffer (opened with openBuffer)
+//! in one operation: an ID with the size of the buffer and the
+//! tag of the data and the data itself as a vector of doubles,
+//! both of them stored with the dbTag argument (so sending the
+//! same object again overwrites the previous data).
+//! @param dbTag: database tag of the buffer.
+int XC::CommParameters::sendBuffer(CommBuffer &buf,const int &dbTag)
+  {
+    if(buffer!=&buf)
+      {
+        std::cerr << "CommParameters::" << __FUNCTION__
+                  << "; the buffer is not the active one." << std::endl;
+        return -1;
+      }
+    buffer= buf.previous; // send through the previous route.
+    buf.previous= nullptr;
+    const int numDoubles= buf.getNumDoubles();
+    ID header(2);
+    header(0)= numDoubles;
+    header(1)= dbTag;
+    int res= sendID(header,dbTag);
+    if((res>=0) && (numDoubles>0))
+      {
+        const Vector tmp(buf.getDataPtr(),numDoubles); // no copy.
+        res+= sendVector(tmp,dbTag);
+      }
+    if(res<0)
+      std::cerr << "CommParameters::" << __FUNCTION__
+		<< "; failed to send buffer data\n";
+    buf.clear();
+    return res;
+  }
+
+//! @brief Receives a buffer (sent with sendBuffer) and makes it the
+//! source of the data received from now on (see closeBuffer).
+//! @param dbTag: database tag of the buffer.
+int XC::CommParameters::receiveBuffer(CommBuffer &buf,const int &dbTag) const
+  {
+    ID header(2);
+    int res= receiveID(header,dbTag);
+    if(res>=0)
+      {
+        const int numDoubles= header(0);
+        buf.resize(numDoubles);
+        if(numDoubles>0)
+          {
+            Vector tmp(buf.getDataPtr(),numDoubles); // no copy.
+            res+= receiveVector(tmp,header(1));
+          }
+        if(res>=0)
+          res+= buf.buildIndex();
+      }
+    if(res<0)
+      std::cerr << "CommParameters::" << __FUNCTION__
+		<< "; failed to receive buffer data\n";
+    else
+      {
+        buf.previous= buffer;
+        buffer= &buf;
+      }
+    return res;
+  }
+
+//! @brief Stops reading data from the buffer (opened with receiveBuffer).
+void XC::CommParameters::closeBuffer(CommBuffer &buf) const
+  {
+    if(buffer==&buf)
+      {
+        buffer= buf.previous;
+        buf.previous= nullptr;
+      }
+    else
+      std::cerr << "CommParameters::" << __FUNCTION__
+                << "; the buffer is not the active one." << std::endl;
+  }
+
+//! @brief Sends a movable object serializing all its data in
+//! a single buffer (see sendBuffer).
+//! @param meta: index where the object dbTag is stored.
+int XC::CommParameters::sendMovableBuffered(MovableObject &mv,DbTagData &dt, const CommMetaData &meta)
+  {
+    mv.setDbTag(*this);
+    const int dbTag= mv.getDbTag();
+    CommBuffer buf;
+    openBuffer(buf);
+    int res= mv.sendSelf(*this);
+    res+= sendBuffer(buf,dbTag);
+    dt.setDbTagDataPos(meta.getPosDbTag(), dbTag);
+    return res;
+  }
+
+//! @brief Receives a movable object sent with sendMovableBuffered.
+//! @param meta: index where the object dbTag is stored.
+int XC::CommParameters::receiveMovableBuffered(MovableObject &mv,DbTagData &dt, const CommMetaData &meta) const
+  {
+    const int dbTag= dt.getDbTagDataPos(meta.getPosDbTag());
+    mv.setDbTag(dbTag);
+    CommBuffer buf;
+    int res= receiveBuffer(buf,dbTag);
+    if(res>=0)
+      {
+        res+= mv.recvSelf(*this);
+        closeBuffer(buf);
+      }
+    if(res < 0)
+      std::cerr << "CommParamenters::" << __FUNCTION__
+		<< "; failed to receive movable data\n";
+    return res;
+  }
+
 //! @brief Sends a pointer to movable object through the channel being passed as parameter.
 //! @param meta: indexes where the flag and the dbTag are stored.
 int XC::CommParameters::sendMovablePtr(MovableObject *ptr,DbTagData &dt, const PtrCommMetaData &meta)
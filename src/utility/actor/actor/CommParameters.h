@@ -58,6 +58,7 @@ class CrdTransf;
 class CrdTransf2d;
 class CrdTransf3d;
 class BeamIntegration;
+class CommBuffer;
 
 //! @ingroup IPComm
 //
@@ -68,6 +69,7 @@ class CommParameters
     int commitTag;
     Channel *canal;
     FEM_ObjectBroker *broker;
+    mutable CommBuffer *buffer; //!< active buffer (nullptr if data goes directly to the channel).
   public:
     CommParameters(int cTag, Channel &);
     CommParameters(int cTag, Channel &, FEM_ObjectBroker &);
@@ -76,6 +78,13 @@ class CommParameters
       { return commitTag; }
     int getDbTag(void) const;
     bool isDatastore(void) const;
+    inline bool isBuffering(void) const
+      { return (buffer!=nullptr); }
+
+    void openBuffer(CommBuffer &);
+    int sendBuffer(CommBuffer &,const int &);
+    int receiveBuffer(CommBuffer &,const int &) const;
+    void closeBuffer(CommBuffer &) const;
     inline const Channel *getChannel(void) const
       { return canal; }
     inline Channel *getChannel(void)
@@ -186,6 +195,8 @@ class CommParameters
 
     int sendMovable(MovableObject &,DbTagData &, const CommMetaData &);
     int receiveMovable(MovableObject &,DbTagData &, const CommMetaData &) const;
+    int sendMovableBuffered(MovableObject &,DbTagData &, const CommMetaData &);
+    int receiveMovableBuffered(MovableObject &,DbTagData &, const CommMetaData &) const;
     int sendMovablePtr(MovableObject *ptr,DbTagData &, const PtrCommMetaData &);
     template <class MOV>
     MOV *receiveMovablePtr(MOV* &,DbTagData &, const PtrCommMetaData &) const;
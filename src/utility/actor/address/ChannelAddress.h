@@ -64,6 +64,7 @@
 
 #define SOCKET_TYPE 1
 #define MPI_TYPE    2
+#define SHARED_MEMORY_TYPE 3
 
 namespace XC {
 class ChannelAddress
@@ -0,0 +1,34 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SharedMemoryAddress.cc
+
+#include "utility/actor/address/SharedMemoryAddress.h"
+
+//! @brief Constructor.
+//!
+//! @param name: name of the shared memory segment.
+XC::SharedMemoryAddress::SharedMemoryAddress(const std::string &name)
+  : ChannelAddress(SHARED_MEMORY_TYPE), segmentName(name) {}
+
+//! @brief Returns the name of the shared memory segment.
+const std::string &XC::SharedMemoryAddress::getSegmentName(void) const
+  { return segmentName; }
@@ -0,0 +1,45 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SharedMemoryAddress.h
+
+#ifndef SharedMemoryAddress_h
+#define SharedMemoryAddress_h
+
+#include "utility/actor/address/ChannelAddress.h"
+#include <string>
+
+namespace XC {
+//! @ingroup IPComm
+//
+//! @brief Address of a SharedMemoryChannel (name of the shared
+//! memory segment used by the channel).
+class SharedMemoryAddress: public ChannelAddress
+  {
+  private:
+    std::string segmentName; //!< name of the shared memory segment.
+  public:
+    SharedMemoryAddress(const std::string &);
+    const std::string &getSegmentName(void) const;
+  };
+} // end of XC namespace
+
+#endif
@@ -141,3 +141,23 @@ int XC::Channel::receiveMovable(int commitTag, MovableObject &theObject, FEM_Obj
   }
 
 
+
+//! @brief Send \p theVector to the channel at the address
+//! last set (to call from Python).
+int XC::Channel::sendVectorPy(int dbTag, int commitTag, const Vector &theVector)
+  { return sendVector(dbTag,commitTag,theVector); }
+
+//! @brief Receive \p theVector from the channel at the address
+//! last set (to call from Python).
+int XC::Channel::recvVectorPy(int dbTag, int commitTag, Vector &theVector)
+  { return recvVector(dbTag,commitTag,theVector); }
+
+//! @brief Send \p theID to the channel at the address
+//! last set (to call from Python).
+int XC::Channel::sendIDPy(int dbTag, int commitTag, const ID &theID)
+  { return sendID(dbTag,commitTag,theID); }
+
+//! @brief Receive \p theID from the channel at the address
+//! last set (to call from Python).
+int XC::Channel::recvIDPy(int dbTag, int commitTag, ID &theID)
+  { return recvID(dbTag,commitTag,theID); }
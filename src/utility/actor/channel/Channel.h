@@ -228,6 +228,12 @@ class Channel: public CommandEntity
     //! or setNextAddress() operation. To return 0 if successful, a
     //! negative number if not.
     virtual int recvID(int dbTag, int commitTag,ID &theID, ChannelAddress *theAddress= nullptr) =0;      
+
+    // methods to send/receive from Python (last address).
+    int sendVectorPy(int dbTag, int commitTag, const Vector &);
+    int recvVectorPy(int dbTag, int commitTag, Vector &);
+    int sendIDPy(int dbTag, int commitTag, const ID &);
+    int recvIDPy(int dbTag, int commitTag, ID &);
   };
 
 //! @brief Send the objects on interval [first,last).
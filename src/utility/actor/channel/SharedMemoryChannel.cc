@@ -0,0 +1,636 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SharedMemoryChannel.cc
+
+#include "utility/actor/channel/SharedMemoryChannel.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/ID.h"
+#include "../message/Message.h"
+#include <atomic>
+#include <chrono>
+#include <sstream>
+#include <cstring>
+#include <cstdlib>
+#include <ctime>
+#include <stdint.h>
+extern "C" {
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sched.h>
+}
+
+//! @brief Header of the shared memory segment.
+struct alignas(64) XC::SharedMemoryChannel::SegmentHeader
+  {
+    uint32_t magic; //!< to check that the segment has been created by a SharedMemoryChannel.
+    uint32_t version; //!< layout version.
+    uint64_t session; //!< session identifier written by the owner.
+    uint64_t capacity; //!< capacity of each ring buffer.
+    std::atomic<int> ready; //!< segment initialized by its owner.
+    std::atomic<int> connected; //!< the other channel has opened the segment.
+    std::atomic<int> closed[2]; //!< channel closed (0: owner, 1: other).
+  };
+
+//! @brief Single-producer single-consumer ring buffer. The counters are
+//! the total number of bytes written (tail) and read (head) so the
+//! number of bytes available is tail-head. The data follows the structure.
+struct alignas(64) XC::SharedMemoryChannel::RingBuffer
+  {
+    alignas(64) std::atomic<uint64_t> head; //!< bytes read.
+    alignas(64) std::atomic<uint64_t> tail; //!< bytes written.
+    inline char *data(void)
+      { return reinterpret_cast<char *>(this)+sizeof(RingBuffer); }
+  };
+
+static const uint32_t shm_channel_magic= 0x58434d53; // "XCMS"
+static const uint32_t shm_channel_version= 2;
+
+//! @brief Waits for the other process (spins first, then yields the
+//! processor and finally sleeps).
+static void wait_for_peer(size_t &count)
+  {
+    count++;
+    if(count<1000)
+      {} // busy wait.
+    else if(count<2000)
+      sched_yield();
+    else
+      {
+        struct timespec ts;
+        ts.tv_sec= 0;
+        ts.tv_nsec= 20000;
+        nanosleep(&ts,nullptr);
+      }
+  }
+
+//! @brief Returns true if more than \p timeout seconds have elapsed
+//! since \p start (a non positive timeout means no limit).
+static bool timed_out(const std::chrono::steady_clock::time_point &start,const double &timeout)
+  {
+    if(timeout<=0.0)
+      return false;
+    const std::chrono::duration<double> elapsed= std::chrono::steady_clock::now()-start;
+    return (elapsed.count()>timeout);
+  }
+
+//! @brief Returns a new session identifier (never zero).
+static uint64_t new_session_id(void)
+  {
+    static std::atomic<uint64_t> counter(0);
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME,&ts);
+    uint64_t retval= (uint64_t(getpid())<<32) ^ (uint64_t(ts.tv_sec)<<20) ^ uint64_t(ts.tv_nsec) ^ (counter.fetch_add(1)<<48);
+    if(retval==0)
+      retval= 1;
+    return retval;
+  }
+
+//! @brief Returns the segment name (POSIX requires a leading slash).
+static std::string get_segment_name(const std::string &name)
+  {
+    std::string retval= name;
+    if(retval.empty() || retval[0]!='/')
+      retval= "/"+retval;
+    return retval;
+  }
+
+//! @brief Constructor of the channel that creates the segment.
+//!
+//! @param name: name of the shared memory segment.
+//! @param capacity: capacity in bytes of each ring buffer (rounded up to
+//! a power of two).
+XC::SharedMemoryChannel::SharedMemoryChannel(const std::string &name,const size_t &capacity)
+  : Channel(), segmentName(get_segment_name(name)), ringCapacity(4096), owner(true),
+    fd(-1), segment(nullptr), segmentSize(0), header(nullptr),
+    sendRing(nullptr), recvRing(nullptr), myAddress(segmentName),
+    session(new_session_id()), connectionTimeout(60.0)
+  {
+    while(ringCapacity<capacity)
+      ringCapacity*= 2;
+    shm_unlink(segmentName.c_str()); // remove stale segments.
+    fd= shm_open(segmentName.c_str(),O_CREAT|O_EXCL|O_RDWR,S_IRUSR|S_IWUSR);
+    if(fd<0)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; could not create shared memory segment: '"
+		  << segmentName << "'\n";
+        return;
+      }
+    segmentSize= getSegmentSize(ringCapacity);
+    if(ftruncate(fd,segmentSize)<0)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; could not set the size of the shared memory segment: '"
+		  << segmentName << "'\n";
+        return;
+      }
+    if(mapSegment()==0)
+      {
+        header= new(segment) SegmentHeader();
+        header->magic= shm_channel_magic;
+        header->version= shm_channel_version;
+        header->session= session;
+        header->capacity= ringCapacity;
+        header->connected.store(0);
+        header->closed[0].store(0);
+        header->closed[1].store(0);
+        char *base= reinterpret_cast<char *>(segment)+sizeof(SegmentHeader);
+        sendRing= new(base) RingBuffer();
+        recvRing= new(base+sizeof(RingBuffer)+ringCapacity) RingBuffer();
+        sendRing->head.store(0); sendRing->tail.store(0);
+        recvRing->head.store(0); recvRing->tail.store(0);
+        if(!header->ready.is_lock_free() || !sendRing->head.is_lock_free())
+	  std::cerr << getClassName() << "::" << __FUNCTION__
+		    << "; WARNING atomic operations are not lock free;"
+		    << " the channel can't be used between processes.\n";
+        header->ready.store(1,std::memory_order_release);
+      }
+  }
+
+//! @brief Constructor of the channel that opens the segment
+//! created by other process (see setUpConnection). Without session
+//! identifier the channel attaches to any segment with that name
+//! whose owner is alive and not connected yet; use fromProgramArgs
+//! to attach only to the segment of a given owner.
+//!
+//! @param name: name of the shared memory segment.
+XC::SharedMemoryChannel::SharedMemoryChannel(const std::string &name)
+  : Channel(), segmentName(get_segment_name(name)), ringCapacity(0), owner(false),
+    fd(-1), segment(nullptr), segmentSize(0), header(nullptr),
+    sendRing(nullptr), recvRing(nullptr), myAddress(segmentName),
+    session(0), connectionTimeout(60.0)
+  {}
+
+//! @brief Creates the channel that opens the segment from the
+//! string returned by the addToProgram method of its owner
+//! (" 3 segmentName session "). Returns nullptr if the string
+//! doesn't correspond to a shared memory channel.
+XC::SharedMemoryChannel *XC::SharedMemoryChannel::fromProgramArgs(const std::string &args)
+  {
+    SharedMemoryChannel *retval= nullptr;
+    std::istringstream iss(args);
+    int channelType= 0;
+    std::string name;
+    uint64_t sessionId= 0;
+    if((iss >> channelType >> name >> sessionId) && (channelType==3))
+      {
+        retval= new SharedMemoryChannel(name);
+        retval->session= sessionId;
+      }
+    else
+      std::cerr << "SharedMemoryChannel::" << __FUNCTION__
+		<< "; string: '" << args
+		<< "' doesn't describe a shared memory channel.\n";
+    return retval;
+  }
+
+//! @brief Destructor.
+XC::SharedMemoryChannel::~SharedMemoryChannel(void)
+  {
+    if(header)
+      header->closed[owner ? 0 : 1].store(1,std::memory_order_release);
+    unmapSegment();
+    if(owner)
+      shm_unlink(segmentName.c_str());
+  }
+
+//! @brief Returns the size of the segment for the capacity argument.
+size_t XC::SharedMemoryChannel::getSegmentSize(const size_t &capacity)
+  { return sizeof(SegmentHeader)+2*(sizeof(RingBuffer)+capacity); }
+
+//! @brief Maps the segment in memory.
+int XC::SharedMemoryChannel::mapSegment(void)
+  {
+    segment= mmap(nullptr,segmentSize,PROT_READ|PROT_WRITE,MAP_SHARED,fd,0);
+    if(segment==MAP_FAILED)
+      {
+        segment= nullptr;
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; could not map shared memory segment: '"
+		  << segmentName << "'\n";
+        return -1;
+      }
+    return 0;
+  }
+
+//! @brief Unmaps the segment.
+void XC::SharedMemoryChannel::unmapSegment(void)
+  {
+    if(segment)
+      munmap(segment,segmentSize);
+    segment= nullptr;
+    header= nullptr;
+    sendRing= nullptr;
+    recvRing= nullptr;
+    if(fd>=0)
+      close(fd);
+    fd= -1;
+  }
+
+//! @brief Returns the name of the shared memory segment.
+const std::string &XC::SharedMemoryChannel::getSegmentName(void) const
+  { return segmentName; }
+
+//! @brief Returns the capacity of each ring buffer.
+size_t XC::SharedMemoryChannel::getRingCapacity(void) const
+  { return ringCapacity; }
+
+//! @brief Returns the session identifier of the segment.
+uint64_t XC::SharedMemoryChannel::getSession(void) const
+  { return session; }
+
+//! @brief Returns the maximum time (in seconds) to wait for the
+//! other channel in setUpConnection.
+double XC::SharedMemoryChannel::getConnectionTimeout(void) const
+  { return connectionTimeout; }
+
+//! @brief Sets the maximum time (in seconds) to wait for the
+//! other channel in setUpConnection (non positive: wait forever).
+void XC::SharedMemoryChannel::setConnectionTimeout(const double &t)
+  { connectionTimeout= t; }
+
+//! @brief Returns the information needed by the remote process to
+//! contact this channel: type of the channel, name of the segment and
+//! session identifier (see fromProgramArgs).
+std::string XC::SharedMemoryChannel::getProgramArgs(void) const
+  {
+    std::ostringstream oss;
+    oss << " 3 " << segmentName << " " << session << " ";
+    return oss.str();
+  }
+
+//! @brief Returns the information needed by the remote process to
+//! contact this channel (see getProgramArgs).
+char *XC::SharedMemoryChannel::addToProgram(void)
+  {
+    const std::string tmp= getProgramArgs();
+    char *newStuff= (char *)malloc((tmp.size()+1)*sizeof(char));
+    strcpy(newStuff,tmp.c_str());
+    return newStuff;
+  }
+
+//! @brief Opens and maps the segment created by the owner
+//! (waits until it is created and initialized). Returns 1 if the
+//! owner has not created it yet, a negative number on error.
+int XC::SharedMemoryChannel::openSegment(void)
+  {
+    fd= shm_open(segmentName.c_str(),O_RDWR,S_IRUSR|S_IWUSR);
+    if(fd<0)
+      return 1;
+    struct stat st;
+    if((fstat(fd,&st)!=0) || (size_t(st.st_size)<sizeof(SegmentHeader)))
+      {
+        close(fd); fd= -1;
+        return 1; // not sized yet.
+      }
+    segmentSize= st.st_size;
+    if(mapSegment()!=0)
+      return -1;
+    header= reinterpret_cast<SegmentHeader *>(segment);
+    if(header->ready.load(std::memory_order_acquire)==0)
+      {
+        unmapSegment();
+        return 1; // not initialized yet.
+      }
+    if((header->magic!=shm_channel_magic) || (header->version!=shm_channel_version) || (getSegmentSize(header->capacity)!=segmentSize))
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; segment: '" << segmentName
+                  << "' not created by a shared memory channel.\n";
+        unmapSegment();
+        return -2;
+      }
+    return 0;
+  }
+
+//! @brief Returns true if the mapped segment can't be used by this
+//! channel: its owner has been closed, other channel is already
+//! connected to it or it belongs to other session.
+bool XC::SharedMemoryChannel::isStale(void) const
+  {
+    bool retval= false;
+    if(header->closed[0].load(std::memory_order_acquire))
+      retval= true;
+    else if(header->connected.load(std::memory_order_acquire))
+      retval= true;
+    else if((session!=0) && (header->session!=session))
+      retval= true;
+    return retval;
+  }
+
+//! @brief Establishes the connection between both channels.
+//!
+//! The owner waits until the other process opens the segment. The
+//! other channel waits until the segment is created and initialized
+//! ignoring stale segments (see isStale). Both sides give up after
+//! connectionTimeout seconds.
+int XC::SharedMemoryChannel::setUpConnection(void)
+  {
+    size_t count= 0;
+    const std::chrono::steady_clock::time_point start= std::chrono::steady_clock::now();
+    if(owner)
+      {
+        if(!header)
+          {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; shared memory segment not created.\n";
+            return -1;
+          }
+        while(header->connected.load(std::memory_order_acquire)==0)
+          {
+            if(timed_out(start,connectionTimeout))
+              {
+	        std::cerr << getClassName() << "::" << __FUNCTION__
+		          << "; timeout waiting for the other channel to open: '"
+                          << segmentName << "'\n";
+                return -3;
+              }
+            wait_for_peer(count);
+          }
+      }
+    else
+      {
+        if(!header)
+          {
+            while(true)
+              {
+                const int ok= openSegment();
+                if(ok<0)
+                  return ok;
+                else if((ok==0) && !isStale())
+                  {
+                    int notConnected= 0; // claim the segment.
+                    if(header->connected.compare_exchange_strong(notConnected,1,std::memory_order_acq_rel))
+                      break;
+                  }
+                if(ok==0)
+                  unmapSegment(); // stale segment, wait for a new one.
+                if(timed_out(start,connectionTimeout))
+                  {
+	            std::cerr << getClassName() << "::" << __FUNCTION__
+		              << "; timeout waiting for the segment: '"
+                              << segmentName << "' of session: "
+                              << session << std::endl;
+                    return -3;
+                  }
+                wait_for_peer(count);
+              }
+            session= header->session;
+            ringCapacity= header->capacity;
+            char *base= reinterpret_cast<char *>(segment)+sizeof(SegmentHeader);
+            recvRing= reinterpret_cast<RingBuffer *>(base);
+            sendRing= reinterpret_cast<RingBuffer *>(base+sizeof(RingBuffer)+ringCapacity);
+          }
+        header->connected.store(1,std::memory_order_release);
+      }
+    return 0;
+  }
+
+//! @brief Checks that the address corresponds to the channel
+//! at the other side of the segment.
+bool XC::SharedMemoryChannel::checkAddress(const ChannelAddress *theAddress,const std::string &methodName) const
+  {
+    bool retval= true;
+    if(theAddress)
+      {
+        const SharedMemoryAddress *tmp= dynamic_cast<const SharedMemoryAddress *>(theAddress);
+        if(!tmp || (theAddress->getType()!=SHARED_MEMORY_TYPE))
+          {
+	    std::cerr << getClassName() << "::" << methodName
+		      << "; a SharedMemoryChannel can only communicate"
+                      << " with a SharedMemoryChannel;"
+                      << " address given is not of type SharedMemoryAddress\n"; 
+            retval= false;
+          }
+        else if(get_segment_name(tmp->getSegmentName())!=segmentName)
+          {
+	    std::cerr << getClassName() << "::" << methodName
+		      << "; a SharedMemoryChannel can only communicate"
+                      << " with the channel at the other side of its segment.\n";
+            retval= false;
+          }
+      }
+    return retval;
+  }
+
+//! @brief Sets the address of the next message.
+int XC::SharedMemoryChannel::setNextAddress(const ChannelAddress &theAddress)
+  { return (checkAddress(&theAddress,__FUNCTION__) ? 0 : -1); }
+
+//! @brief Returns nullptr (the sender is always the other side of the segment).
+XC::ChannelAddress *XC::SharedMemoryChannel::getLastSendersAddress(void)
+  { return nullptr; }
+
+//! @brief Copies the data into the send ring buffer (waits
+//! if the buffer is full).
+int XC::SharedMemoryChannel::writeData(const char *src,size_t n)
+  {
+    if(!sendRing)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; connection not established.\n";
+        return -1;
+      }
+    const uint64_t mask= ringCapacity-1;
+    char *buf= sendRing->data();
+    const std::atomic<int> &peerClosed= header->closed[owner ? 1 : 0];
+    uint64_t tail= sendRing->tail.load(std::memory_order_relaxed);
+    size_t count= 0;
+    while(n>0)
+      {
+        const uint64_t head= sendRing->head.load(std::memory_order_acquire);
+        const size_t space= ringCapacity-(tail-head);
+        if(space==0)
+          {
+            if(peerClosed.load(std::memory_order_acquire))
+              {
+	        std::cerr << getClassName() << "::" << __FUNCTION__
+		          << "; the other channel has been closed.\n";
+                return -3;
+              }
+            wait_for_peer(count);
+            continue;
+          }
+        count= 0;
+        const size_t chunk= std::min(n,space);
+        const size_t pos= tail & mask;
+        const size_t first= std::min(chunk,size_t(ringCapacity-pos));
+        memcpy(buf+pos,src,first);
+        memcpy(buf,src+first,chunk-first);
+        tail+= chunk;
+        sendRing->tail.store(tail,std::memory_order_release);
+        src+= chunk;
+        n-= chunk;
+      }
+    return 0;
+  }
+
+//! @brief Copies the data from the receive ring buffer (waits
+//! until the data is available).
+int XC::SharedMemoryChannel::readData(char *dest,size_t n)
+  {
+    if(!recvRing)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; connection not established.\n";
+        return -1;
+      }
+    const uint64_t mask= ringCapacity-1;
+    const char *buf= recvRing->data();
+    const std::atomic<int> &peerClosed= header->closed[owner ? 1 : 0];
+    uint64_t head= recvRing->head.load(std::memory_order_relaxed);
+    size_t count= 0;
+    while(n>0)
+      {
+        const uint64_t tail= recvRing->tail.load(std::memory_order_acquire);
+        const size_t available= tail-head;
+        if(available==0)
+          {
+            if(peerClosed.load(std::memory_order_acquire))
+              {
+	        std::cerr << getClassName() << "::" << __FUNCTION__
+		          << "; the other channel has been closed.\n";
+                return -3;
+              }
+            wait_for_peer(count);
+            continue;
+          }
+        count= 0;
+        const size_t chunk= std::min(n,available);
+        const size_t pos= head & mask;
+        const size_t first= std::min(chunk,size_t(ringCapacity-pos));
+        memcpy(dest,buf+pos,first);
+        memcpy(dest+first,buf,chunk-first);
+        head+= chunk;
+        recvRing->head.store(head,std::memory_order_release);
+        dest+= chunk;
+        n-= chunk;
+      }
+    return 0;
+  }
+
+//! @brief Sends the object.
+int XC::SharedMemoryChannel::sendObj(int commitTag,MovableObject &theObject, ChannelAddress *theAddress) 
+  {
+    if(!checkAddress(theAddress,__FUNCTION__))
+      return -1;
+    return sendMovable(commitTag,theObject);
+  }
+
+//! @brief Receives the object.
+int XC::SharedMemoryChannel::recvObj(int commitTag, MovableObject &theObject, FEM_ObjectBroker &theBroker, ChannelAddress *theAddress)
+  {
+    if(!checkAddress(theAddress,__FUNCTION__))
+      return -1;
+    return receiveMovable(commitTag,theObject,theBroker);
+  }
+
+//! @brief Receives the message.
+int XC::SharedMemoryChannel::recvMsg(int dbTag, int commitTag, Message &msg, ChannelAddress *theAddress)
+  {
+    if(!checkDbTag(dbTag))
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; dbTag: " << dbTag << " already used." << std::endl;
+    if(!checkAddress(theAddress,__FUNCTION__))
+      return -1;
+    return readData(msg.data,msg.length);
+  }
+
+//! @brief Sends the message.
+int XC::SharedMemoryChannel::sendMsg(int dbTag, int commitTag, const Message &msg, ChannelAddress *theAddress)
+  {
+    if(!checkDbTag(dbTag))
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; dbTag: " << dbTag << " already used." << std::endl;
+    if(!checkAddress(theAddress,__FUNCTION__))
+      return -1;
+    return writeData(msg.data,msg.length);
+  }
+
+//! @brief Receives the matrix.
+int XC::SharedMemoryChannel::recvMatrix(int dbTag, int commitTag,Matrix &theMatrix, ChannelAddress *theAddress)
+  {
+    if(!checkDbTag(dbTag))
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; dbTag: " << dbTag << " already used." << std::endl;
+    if(!checkAddress(theAddress,__FUNCTION__))
+      return -1;
+    return readData(reinterpret_cast<char *>(theMatrix.getDataPtr()),theMatrix.getNumBytes());
+  }
+
+//! @brief Sends the matrix.
+int XC::SharedMemoryChannel::sendMatrix(int dbTag, int commitTag,const Matrix &theMatrix, ChannelAddress *theAddress)
+  {
+    if(!checkDbTag(dbTag))
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; dbTag: " << dbTag << " already used." << std::endl;
+    if(!checkAddress(theAddress,__FUNCTION__))
+      return -1;
+    return writeData(reinterpret_cast<const char *>(theMatrix.getDataPtr()),theMatrix.getNumBytes());
+  }
+
+//! @brief Receives the vector.
+int XC::SharedMemoryChannel::recvVector(int dbTag, int commitTag,Vector &theVector, ChannelAddress *theAddress)
+  {
+    if(!checkDbTag(dbTag))
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; dbTag: " << dbTag << " already used." << std::endl;
+    if(!checkAddress(theAddress,__FUNCTION__))
+      return -1;
+    return readData(reinterpret_cast<char *>(theVector.getDataPtr()),theVector.Size()*sizeof(double));
+  }
+
+//! @brief Sends the vector.
+int XC::SharedMemoryChannel::sendVector(int dbTag, int commitTag,const Vector &theVector, ChannelAddress *theAddress)
+  {
+    if(!checkDbTag(dbTag))
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; dbTag: " << dbTag << " already used." << std::endl;
+    if(!checkAddress(theAddress,__FUNCTION__))
+      return -1;
+    return writeData(reinterpret_cast<const char *>(theVector.getDataPtr()),theVector.Size()*sizeof(double));
+  }
+
+//! @brief Receives the ID.
+int XC::SharedMemoryChannel::recvID(int dbTag, int commitTag,ID &theID, ChannelAddress *theAddress)
+  {
+    if(!checkDbTag(dbTag))
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; dbTag: " << dbTag << " already used." << std::endl;
+    if(!checkAddress(theAddress,__FUNCTION__))
+      return -1;
+    return readData(reinterpret_cast<char *>(theID.getDataPtr()),theID.Size()*sizeof(int));
+  }
+
+//! @brief Sends the ID.
+int XC::SharedMemoryChannel::sendID(int dbTag, int commitTag,const ID &theID, ChannelAddress *theAddress)
+  {
+    if(!checkDbTag(dbTag))
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; dbTag: " << dbTag << " already used." << std::endl;
+    if(!checkAddress(theAddress,__FUNCTION__))
+      return -1;
+    return writeData(reinterpret_cast<const char *>(theID.getDataPtr()),theID.Size()*sizeof(int));
+  }
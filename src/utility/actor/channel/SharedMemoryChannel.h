@@ -0,0 +1,114 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SharedMemoryChannel.h
+
+#ifndef SharedMemoryChannel_h
+#define SharedMemoryChannel_h
+
+#include "utility/actor/channel/Channel.h"
+#include "utility/actor/address/SharedMemoryAddress.h"
+#include <string>
+#include <stdint.h>
+
+namespace XC {
+
+//! @ingroup IPComm
+//
+//! @brief Channel between two processes running on the same host
+//! implemented with a POSIX shared memory segment.
+//!
+//! The segment contains two single-producer single-consumer ring
+//! buffers (one for each direction). The data of the vectors, matrices,
+//! ID and messages is copied directly from (to) its storage into (from)
+//! the ring buffer so no system calls are needed to transfer it.
+//! As with TCP_Socket, communication is full-duplex between a pair of
+//! channels: the one that creates the segment (the one constructed with
+//! the segment size) and the one that opens it. The owner stamps the
+//! segment with a session identifier that travels with the string
+//! returned by addToProgram; the remote process builds its channel
+//! from that string (see fromProgramArgs) so it never attaches to a
+//! segment left behind by a previous run.
+class SharedMemoryChannel: public Channel
+  {
+  public:
+    struct SegmentHeader;
+    struct RingBuffer;
+  private:
+    std::string segmentName; //!< name of the shared memory segment.
+    size_t ringCapacity; //!< capacity (bytes) of each ring buffer.
+    bool owner; //!< true if this channel creates the segment.
+    int fd; //!< file descriptor of the segment.
+    void *segment; //!< address of the segment.
+    size_t segmentSize; //!< size of the segment.
+    SegmentHeader *header; //!< segment header.
+    RingBuffer *sendRing; //!< ring buffer to write to.
+    RingBuffer *recvRing; //!< ring buffer to read from.
+    SharedMemoryAddress myAddress; //!< address of this channel.
+    uint64_t session; //!< session identifier of the segment (0: accept any fresh segment).
+    double connectionTimeout; //!< maximum time (seconds) to wait in setUpConnection.
+
+    static size_t getSegmentSize(const size_t &);
+    int mapSegment(void);
+    int openSegment(void);
+    bool isStale(void) const;
+    void unmapSegment(void);
+    bool checkAddress(const ChannelAddress *,const std::string &) const;
+    int writeData(const char *,size_t);
+    int readData(char *,size_t);
+  public:
+    static const size_t defaultRingCapacity= 4*1024*1024; //!< default capacity of the ring buffers.
+    SharedMemoryChannel(const std::string &,const size_t &capacity);
+    SharedMemoryChannel(const std::string &);
+    ~SharedMemoryChannel(void);
+
+    static SharedMemoryChannel *fromProgramArgs(const std::string &);
+
+    const std::string &getSegmentName(void) const;
+    size_t getRingCapacity(void) const;
+    uint64_t getSession(void) const;
+    double getConnectionTimeout(void) const;
+    void setConnectionTimeout(const double &);
+
+    std::string getProgramArgs(void) const;
+    char *addToProgram(void);
+    int setUpConnection(void);
+    int setNextAddress(const ChannelAddress &);
+    ChannelAddress *getLastSendersAddress(void);
+
+    int sendObj(int commitTag, MovableObject &, ChannelAddress *theAddress= nullptr);
+    int recvObj(int commitTag, MovableObject &, FEM_ObjectBroker &, ChannelAddress *theAddress= nullptr);
+
+    int sendMsg(int dbTag, int commitTag, const Message &, ChannelAddress *theAddress= nullptr);
+    int recvMsg(int dbTag, int commitTag, Message &, ChannelAddress *theAddress= nullptr);
+
+    int sendMatrix(int dbTag, int commitTag, const Matrix &, ChannelAddress *theAddress= nullptr);
+    int recvMatrix(int dbTag, int commitTag, Matrix &, ChannelAddress *theAddress= nullptr);
+
+    int sendVector(int dbTag, int commitTag, const Vector &, ChannelAddress *theAddress= nullptr);
+    int recvVector(int dbTag, int commitTag, Vector &, ChannelAddress *theAddress= nullptr);
+
+    int sendID(int dbTag, int commitTag, const ID &, ChannelAddress *theAddress= nullptr);
+    int recvID(int dbTag, int commitTag, ID &, ChannelAddress *theAddress= nullptr);
+  };
+} // end of XC namespace
+
+#endif
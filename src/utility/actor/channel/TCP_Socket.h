@@ -88,14 +88,14 @@ class TCP_Socket : public Channel
     int connectType;
 
     char add[40];
-  protected:
-    unsigned int getPortNumber(void) const;
   public:
     TCP_Socket();        
     TCP_Socket(unsigned int);    
     TCP_Socket(unsigned int other_Port, char *other_InetAddr); 
     ~TCP_Socket();
 
+    unsigned int getPortNumber(void) const;
+
     char *addToProgram(void);
     
     virtual int setUpConnection(void);
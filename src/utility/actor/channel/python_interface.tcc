@@ -21,6 +21,29 @@
 //----------------------------------------------------------------------------
 //python_interface.tcc
 
-class_<XC::Channel, bases<CommandEntity>, boost::noncopyable  >("Channel", no_init);
+class_<XC::Channel, bases<CommandEntity>, boost::noncopyable  >("Channel", no_init)
+  .add_property("tag", &XC::Channel::getTag, "Return the channel identifier.")
+  .def("setUpConnection", &XC::Channel::setUpConnection, "Establish the connection with the channel at the other side.")
+  .def("sendVector", &XC::Channel::sendVectorPy, "sendVector(dbTag, commitTag, vector): send the vector.")
+  .def("recvVector", &XC::Channel::recvVectorPy, "recvVector(dbTag, commitTag, vector): receive the vector (its size must match the one sent).")
+  .def("sendID", &XC::Channel::sendIDPy, "sendID(dbTag, commitTag, id): send the integer vector.")
+  .def("recvID", &XC::Channel::recvIDPy, "recvID(dbTag, commitTag, id): receive the integer vector (its size must match the one sent).")
+  ;
 
+class_<XC::SharedMemoryChannel, bases<XC::Channel>, boost::noncopyable  >("SharedMemoryChannel", init<std::string, size_t>("SharedMemoryChannel(name, capacity): create the shared memory segment."))
+  .def(init<std::string>("SharedMemoryChannel(name): open the segment created by other process."))
+  .def("fromProgramArgs", &XC::SharedMemoryChannel::fromProgramArgs, return_value_policy<manage_new_object>(), "Return the channel that opens the segment described by the string returned by getProgramArgs.")
+  .staticmethod("fromProgramArgs")
+  .add_property("segmentName", make_function(&XC::SharedMemoryChannel::getSegmentName, return_value_policy<copy_const_reference>()), "Return the name of the shared memory segment.")
+  .add_property("ringCapacity", &XC::SharedMemoryChannel::getRingCapacity, "Return the capacity of each ring buffer.")
+  .add_property("session", &XC::SharedMemoryChannel::getSession, "Return the session identifier of the segment.")
+  .add_property("connectionTimeout", &XC::SharedMemoryChannel::getConnectionTimeout, &XC::SharedMemoryChannel::setConnectionTimeout, "Maximum time (seconds) to wait in setUpConnection.")
+  .def("getProgramArgs", &XC::SharedMemoryChannel::getProgramArgs, "Return the string that the remote process needs to open the channel (see fromProgramArgs).")
+  ;
 
+
+
+class_<XC::TCP_Socket, bases<XC::Channel>, boost::noncopyable  >("TCP_Socket", init<>("TCP_Socket(): socket that waits for the connection on the port given by the system (see portNumber)."))
+  .def(init<unsigned int, char *>("TCP_Socket(port, inetAddr): socket that connects with the one listening on port at inetAddr."))
+  .add_property("portNumber", &XC::TCP_Socket::getPortNumber, "Return the port number of the socket.")
+  ;
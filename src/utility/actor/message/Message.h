@@ -92,6 +92,7 @@ class Message
     friend class TCP_SocketNoDelay;
     friend class UDP_Socket;
     friend class MPI_Channel;
+    friend class SharedMemoryChannel;
   };
 } // end of XC namespace
 
@@ -912,6 +912,9 @@ XC::DataOutputHandler *XC::FEM_ObjectBroker::getPtrNewDataOutputHandler(int clas
         case DATAHANDLER_TAGS_DataOutputDatabaseHandler:
              return new DataOutputDatabaseHandler();
 
+        case DATAHANDLER_TAGS_DataOutputBinaryHandler:
+             return new DataOutputBinaryHandler();
+
         default:
              std::cerr << "FEM_ObjectBroker::getPtrNewDataOutputHandler - ";
              std::cerr << " - no XC::DataOutputHandler type exists for class tag ";
@@ -1038,6 +1041,9 @@ XC::EquiSolnAlgo *XC::FEM_ObjectBroker::getNewEquiSolnAlgo(int classTag)
         case EquiALGORITHM_TAGS_KrylovNewton:
              return new KrylovNewton(nullptr);
 
+        case EquiALGORITHM_TAGS_AdaptiveNewton:
+             return new AdaptiveNewton(nullptr);
+
 //         case EquiALGORITHM_TAGS_AcceleratedNewton:
 //              return new AcceleratedNewton();
 
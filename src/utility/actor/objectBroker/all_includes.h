@@ -243,12 +243,14 @@
 
 #include "utility/handler/DataOutputStreamHandler.h"
 #include "utility/handler/DataOutputFileHandler.h"
+#include "utility/handler/DataOutputBinaryHandler.h"
 #include "utility/handler/DataOutputDatabaseHandler.h"
 
 #include "utility/recorder/NodeRecorder.h"
 #include "utility/recorder/ElementRecorder.h"
 #include "utility/recorder/PropRecorder.h"
 #include "utility/recorder/NodePropRecorder.h"
+#include "utility/recorder/VtuRecorder.h"
 #include "utility/recorder/ElementPropRecorder.h"
 #include "utility/recorder/EnvelopeNodeRecorder.h"
 #include "utility/recorder/EnvelopeElementRecorder.h"
@@ -23,6 +23,9 @@
 
 #include "FEProblem.h"
 #include "python_interface.h"
+#include "utility/ObjectArena.h"
+#include "utility/actor/channel/SharedMemoryChannel.h"
+#include "utility/actor/channel/TCP_Socket.h"
 
 void export_utility(void)
   {
@@ -39,8 +42,17 @@ void export_utility(void)
         .add_property("tag", &XC::TaggedObject::getTag, &XC::TaggedObject::assignTag)
        ;
 
+    class_<XC::ObjectArena, boost::noncopyable >("ObjectArena", no_init)
+      .add_property("name", make_function(&XC::ObjectArena::getName, return_value_policy<copy_const_reference>()),"Return the name of the arena.")
+      .add_property("numLiveObjects", &XC::ObjectArena::getNumLiveObjects,"Return the number of objects allocated from the arena and not freed yet.")
+      .add_property("bytesInUse", &XC::ObjectArena::getBytesInUse,"Return the memory used by the live objects.")
+      .add_property("bytesReserved", &XC::ObjectArena::getBytesReserved,"Return the memory reserved by the arena.")
+      .def("release", &XC::ObjectArena::release,"Release the memory if no object allocated from the arena remains alive.")
+       ;
+
 #include "actor/channel/python_interface.tcc"
 #include "database/python_interface.tcc"
+#include "handler/python_interface.tcc"
 #include "recorder/python_interface.tcc"
 
   }
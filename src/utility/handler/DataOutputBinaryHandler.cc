@@ -0,0 +1,337 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//DataOutputBinaryHandler.cc
+
+#include "utility/handler/DataOutputBinaryHandler.h"
+#include <utility/matrix/Vector.h>
+#include "utility/actor/actor/CommMetaData.h"
+#include <sstream>
+#include <cstdint>
+
+//! @brief Constructor.
+//!
+//! @param theFileName: name of the .npy file.
+//! @param sp: if true write float32 values instead of float64.
+//! @param bio: if true the data is written by a background thread.
+//! @param cs: number of rows of each chunk.
+XC::DataOutputBinaryHandler::DataOutputBinaryHandler(const std::string &theFileName, bool sp, bool bio, size_t cs)
+  :DataOutputHandler(DATAHANDLER_TAGS_DataOutputBinaryHandler),
+   fileName(theFileName), singlePrecision(sp), backgroundIO(bio),
+   chunkSize(cs), numColumns(-1), numRows(0), stopIO(false)
+  {}
+
+//! @brief Destructor (writes the pending data).
+XC::DataOutputBinaryHandler::~DataOutputBinaryHandler(void)
+  { close(); }
+
+//! @brief Sets the name of the output file.
+void XC::DataOutputBinaryHandler::setFileName(const std::string &str)
+  { fileName= str; }
+
+//! @brief Returns the name of the output file.
+const std::string &XC::DataOutputBinaryHandler::getFileName(void) const
+  { return fileName; }
+
+//! @brief If true write float32 values instead of float64.
+void XC::DataOutputBinaryHandler::setSinglePrecision(const bool &b)
+  { singlePrecision= b; }
+
+//! @brief Returns true if the values are written as float32.
+bool XC::DataOutputBinaryHandler::getSinglePrecision(void) const
+  { return singlePrecision; }
+
+//! @brief If true the chunks are written by a background thread.
+void XC::DataOutputBinaryHandler::setBackgroundIO(const bool &b)
+  { backgroundIO= b; }
+
+//! @brief Returns true if the chunks are written by a background thread.
+bool XC::DataOutputBinaryHandler::getBackgroundIO(void) const
+  { return backgroundIO; }
+
+//! @brief Sets the number of rows of each chunk.
+void XC::DataOutputBinaryHandler::setChunkSize(const size_t &sz)
+  { chunkSize= std::max(sz,size_t(1)); }
+
+//! @brief Returns the number of rows of each chunk.
+size_t XC::DataOutputBinaryHandler::getChunkSize(void) const
+  { return chunkSize; }
+
+//! @brief Returns the header of the .npy file (format version 1.0). The
+//! header has a fixed size so it can be rewritten when the number of rows
+//! is known.
+std::string XC::DataOutputBinaryHandler::getHeader(void) const
+  {
+    const uint16_t one= 1;
+    const bool littleEndian= (*reinterpret_cast<const uint8_t *>(&one)==1);
+    std::ostringstream os;
+    os << "{'descr': '" << (littleEndian ? '<' : '>')
+       << (singlePrecision ? "f4" : "f8")
+       << "', 'fortran_order': False, 'shape': (" << numRows << ", "
+       << std::max(numColumns,0) << "), }";
+    const size_t headerSize= 128; // magic string, version and length included.
+    std::string dict= os.str();
+    dict.resize(headerSize-10-1,' ');
+    dict+= '\n';
+    std::string retval("\x93NUMPY\x01\x00",8);
+    const uint16_t len= dict.size();
+    retval+= static_cast<char>(len & 0xff);
+    retval+= static_cast<char>(len >> 8);
+    retval+= dict;
+    return retval;
+  }
+
+//! @brief Writes the header at the beginning of the output file.
+void XC::DataOutputBinaryHandler::writeHeader(void)
+  {
+    const std::string header= getHeader();
+    outputFile.seekp(0);
+    outputFile.write(header.data(),header.size());
+  }
+
+//! @brief Writes the chunk in the output file.
+void XC::DataOutputBinaryHandler::writeChunk(const std::string &chunk)
+  { outputFile.write(chunk.data(),chunk.size()); }
+
+//! @brief Sends the current chunk to the output file (or to the queue
+//! of the I/O thread).
+void XC::DataOutputBinaryHandler::flushChunk(void)
+  {
+    if(currentChunk.empty())
+      return;
+    if(ioThread.joinable())
+      {
+        {
+          std::lock_guard<std::mutex> lock(chunksMutex);
+          pendingChunks.push_back(std::string());
+          pendingChunks.back().swap(currentChunk);
+        }
+        chunksCondition.notify_one();
+      }
+    else
+      writeChunk(currentChunk);
+    currentChunk.clear();
+  }
+
+//! @brief Body of the I/O thread: writes the pending chunks until
+//! the handler is closed.
+void XC::DataOutputBinaryHandler::ioLoop(void)
+  {
+    std::string chunk;
+    while(true)
+      {
+        {
+          std::unique_lock<std::mutex> lock(chunksMutex);
+          chunksCondition.wait(lock,[this]{ return (stopIO || !pendingChunks.empty()); });
+          if(pendingChunks.empty()) // stopIO.
+            break;
+          chunk.swap(pendingChunks.front());
+          pendingChunks.pop_front();
+        }
+        writeChunk(chunk);
+      }
+  }
+
+//! @brief Launches the background I/O thread.
+void XC::DataOutputBinaryHandler::startIOThread(void)
+  {
+    stopIO= false;
+    ioThread= std::thread(&DataOutputBinaryHandler::ioLoop,this);
+  }
+
+//! @brief Waits until the I/O thread has written the pending chunks
+//! and ends it.
+void XC::DataOutputBinaryHandler::stopIOThread(void)
+  {
+    if(ioThread.joinable())
+      {
+        {
+          std::lock_guard<std::mutex> lock(chunksMutex);
+          stopIO= true;
+        }
+        chunksCondition.notify_one();
+        ioThread.join();
+      }
+  }
+
+//! @brief Opens the output file and writes the column descriptions.
+int XC::DataOutputBinaryHandler::open(const std::vector<std::string> &dataDescription)
+  {
+    if(fileName.empty())
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; no filename." << std::endl;
+        return -1;
+      }
+    close();
+    numColumns= dataDescription.size();
+    numRows= 0;
+    outputFile.open(fileName.c_str(),std::ios::out | std::ios::binary | std::ios::trunc);
+    if(!outputFile)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; could not open file: '" << fileName
+                  << "'." << std::endl;
+        numColumns= -1;
+        return -1;
+      }
+    const std::string header= getHeader();
+    outputFile.write(header.data(),header.size());
+
+    const std::string columnsFileName= fileName+".columns";
+    std::ofstream columnsFile(columnsFileName.c_str());
+    for(std::vector<std::string>::const_iterator i= dataDescription.begin();i!=dataDescription.end();i++)
+      columnsFile << *i << std::endl;
+
+    const size_t valueSize= (singlePrecision ? sizeof(float) : sizeof(double));
+    currentChunk.reserve(chunkSize*numColumns*valueSize);
+    if(backgroundIO)
+      startIOThread();
+    return 0;
+  }
+
+//! @brief Appends a row to the current chunk.
+int XC::DataOutputBinaryHandler::write(Vector &data) 
+  {
+    if(!outputFile.is_open() || numColumns < 0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; file not open or no data description has been set."
+                  << std::endl;
+        return -1;
+      }
+    if(data.Size() != numColumns)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; vector of size: " << data.Size()
+                  << " expected: " << numColumns << std::endl;
+        return -1;
+      }
+    if(singlePrecision)
+      for(int i= 0;i<numColumns;i++)
+        {
+          const float v= data(i);
+          currentChunk.append(reinterpret_cast<const char *>(&v),sizeof(float));
+        }
+    else
+      currentChunk.append(reinterpret_cast<const char *>(data.getDataPtr()),numColumns*sizeof(double));
+    numRows++;
+    if(numRows%chunkSize == 0)
+      flushChunk();
+    return 0;
+  }
+
+//! @brief Writes the pending data and updates the number of rows in
+//! the header, so the file can be read while the handler is open.
+int XC::DataOutputBinaryHandler::flush(void)
+  {
+    if(!outputFile.is_open())
+      return 0;
+    flushChunk();
+    stopIOThread(); // the header is written by this thread.
+    const std::streampos end= outputFile.tellp();
+    writeHeader();
+    outputFile.seekp(end);
+    outputFile.flush();
+    if(backgroundIO)
+      startIOThread();
+    int retval= 0;
+    if(!outputFile)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; error writing file: '" << fileName
+                  << "'." << std::endl;
+        retval= -1;
+      }
+    return retval;
+  }
+
+//! @brief Writes the pending data, updates the number of rows in
+//! the header and closes the file.
+int XC::DataOutputBinaryHandler::close(void)
+  {
+    if(!outputFile.is_open())
+      return 0;
+    flushChunk();
+    stopIOThread();
+    writeHeader();
+    const bool ok= outputFile.good();
+    outputFile.close();
+    int retval= 0;
+    if(!ok)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; error writing file: '" << fileName
+                  << "'." << std::endl;
+        retval= -1;
+      }
+    return retval;
+  }
+
+//! @brief Sends object members through the communicator being passed as parameter.
+int XC::DataOutputBinaryHandler::sendData(CommParameters &cp)
+  {
+    int res= cp.sendString(fileName,getDbTagData(),CommMetaData(0));
+    res+= cp.sendBools(singlePrecision,backgroundIO,getDbTagData(),CommMetaData(1));
+    res+= cp.sendInts(chunkSize,numColumns,getDbTagData(),CommMetaData(2));
+    return res;
+  }
+
+//! @brief Receives object members through the communicator being passed as parameter.
+int XC::DataOutputBinaryHandler::recvData(const CommParameters &cp)
+  {
+    int res= cp.receiveString(fileName,getDbTagData(),CommMetaData(0));
+    res+= cp.receiveBools(singlePrecision,backgroundIO,getDbTagData(),CommMetaData(1));
+    int cs= 0;
+    res+= cp.receiveInts(cs,numColumns,getDbTagData(),CommMetaData(2));
+    chunkSize= cs;
+    return res;
+  }
+
+//! @brief Send the object through the communicator argument.
+int XC::DataOutputBinaryHandler::sendSelf(CommParameters &cp)
+  {
+    inicComm(3);
+    setDbTag(cp);
+    const int dataTag= getDbTag();
+    int res= sendData(cp);
+
+    res+= cp.sendIdData(getDbTagData(),dataTag);
+    if(res < 0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; failed to send data.\n";
+    return res;
+  }
+
+//! @brief Receive the object through the communicator argument.
+int XC::DataOutputBinaryHandler::recvSelf(const CommParameters &cp)
+  {
+    inicComm(3);
+    const int dataTag= getDbTag();
+    int res= cp.receiveIdData(getDbTagData(),dataTag);
+
+    if(res<0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; failed to receive ids.\n";
+    else
+      res+= recvData(cp);
+    return res;
+  }
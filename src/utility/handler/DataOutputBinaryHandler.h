@@ -0,0 +1,99 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//DataOutputBinaryHandler.h
+
+#ifndef _DataOutputBinaryHandler
+#define _DataOutputBinaryHandler
+
+#include <utility/handler/DataOutputHandler.h>
+#include <fstream>
+#include <string>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace XC {
+
+//! @brief Writes the recorded data in a NumPy binary file (.npy).
+//!
+//! Each call to write adds a row of fixed width (float64 or float32)
+//! values. The rows are stored in chunks that are written to disk when
+//! full, either directly or by a background I/O thread so the
+//! recorders don't wait for the disk. The number of rows in the
+//! header is rewritten when the handler is closed. The column
+//! descriptions are written in a text file with the same name and
+//! the ".columns" extension.
+class DataOutputBinaryHandler: public DataOutputHandler
+  {
+  private:
+    std::string fileName; //!< name of the .npy file.
+    bool singlePrecision; //!< if true write float32 values instead of float64.
+    bool backgroundIO; //!< if true the chunks are written by a separate thread.
+    size_t chunkSize; //!< number of rows in each chunk.
+    int numColumns; //!< number of values in each row.
+    size_t numRows; //!< number of rows written.
+    std::ofstream outputFile;
+    std::string currentChunk; //!< rows not written yet.
+    std::deque<std::string> pendingChunks; //!< chunks waiting for the I/O thread.
+    std::thread ioThread; //!< background I/O thread.
+    std::mutex chunksMutex; //!< protects pendingChunks and stopIO.
+    std::condition_variable chunksCondition;
+    bool stopIO; //!< if true the I/O thread ends when there is no pending chunks.
+
+    std::string getHeader(void) const;
+    void writeHeader(void);
+    void writeChunk(const std::string &);
+    void flushChunk(void);
+    void ioLoop(void);
+    void startIOThread(void);
+    void stopIOThread(void);
+  protected:
+    int sendData(CommParameters &cp);
+    int recvData(const CommParameters &cp);
+
+  public:
+    DataOutputBinaryHandler(const std::string &fileName= "", bool singlePrecision= false, bool backgroundIO= false, size_t chunkSize= 1024);
+    ~DataOutputBinaryHandler(void);
+
+    void setFileName(const std::string &);
+    const std::string &getFileName(void) const;
+    void setSinglePrecision(const bool &);
+    bool getSinglePrecision(void) const;
+    void setBackgroundIO(const bool &);
+    bool getBackgroundIO(void) const;
+    void setChunkSize(const size_t &);
+    size_t getChunkSize(void) const;
+    inline size_t getNumRows(void) const
+      { return numRows; }
+
+    int open(const std::vector<std::string> &dataDescription);
+    int write(Vector &data);
+    int flush(void);
+    int close(void);
+
+    int sendSelf(CommParameters &);  
+    int recvSelf(const CommParameters &);
+  };
+} // end of XC namespace
+
+#endif
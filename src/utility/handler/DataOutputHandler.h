@@ -54,21 +54,41 @@
 #include <utility/actor/actor/MovableObject.h>
 #include "xc_utils/src/kernel/CommandEntity.h"
 #include <map>
+#include <mutex>
 
 namespace XC {
 class Vector;
 
+//! @brief Base class for the objects that write the data
+//! gathered by the recorders.
+//!
+//! Several recorders can share the same handler; the ones that
+//! are asynchronous write from their own threads, so they must
+//! lock the handler mutex (see getMutex) around each call.
 class DataOutputHandler: public MovableObject, public CommandEntity
   {
+  private:
+    std::mutex handlerMutex; //!< serializes the calls from the recorders.
   public:
     typedef std::map<std::string,DataOutputHandler *> map_output_handlers;
 
     DataOutputHandler(int classTag);
     inline virtual ~DataOutputHandler(void) {}
+    //! @brief Returns the mutex that serializes the use of
+    //! the handler by the recorders that share it.
+    inline std::mutex &getMutex(void)
+      { return handlerMutex; }
 
     //virtual int open(const std::vector<std::string> &dataDescription, int numData) =0;
     virtual int open(const std::vector<std::string> &dataDescription) =0;
     virtual int write(Vector &data) =0;
+    //! @brief Writes the pending data so the output is readable
+    //! while the handler is still open.
+    virtual int flush(void)
+      { return 0; }
+    //! @brief Flushes the pending data and closes the output.
+    virtual int close(void)
+      { return 0; }
   };
 } // end of XC namespace
 
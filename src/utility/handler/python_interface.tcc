@@ -0,0 +1,43 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//python_interface.tcc
+
+class_<XC::DataOutputHandler, bases<CommandEntity>, boost::noncopyable >("DataOutputHandler", no_init)
+  .def("flush",&XC::DataOutputHandler::flush,"Writes the pending data so the output can be read while the handler is still open.")
+  .def("close",&XC::DataOutputHandler::close,"Writes the pending data and closes the output.")
+  ;
+
+class_<XC::DataOutputStreamHandler, bases<XC::DataOutputHandler>, boost::noncopyable >("DataOutputStreamHandler", no_init)
+  ;
+
+class_<XC::DataOutputFileHandler, bases<XC::DataOutputHandler>, boost::noncopyable >("DataOutputFileHandler", no_init)
+  ;
+
+const std::string &(XC::DataOutputBinaryHandler::*getBinaryHandlerFileName)(void) const= &XC::DataOutputBinaryHandler::getFileName;
+class_<XC::DataOutputBinaryHandler, bases<XC::DataOutputHandler>, boost::noncopyable >("DataOutputBinaryHandler", no_init)
+  .add_property("fileName",make_function(getBinaryHandlerFileName,return_value_policy<copy_const_reference>()),&XC::DataOutputBinaryHandler::setFileName,"Name of the .npy file.")
+  .add_property("singlePrecision",&XC::DataOutputBinaryHandler::getSinglePrecision,&XC::DataOutputBinaryHandler::setSinglePrecision,"If true write float32 values instead of float64.")
+  .add_property("backgroundIO",&XC::DataOutputBinaryHandler::getBackgroundIO,&XC::DataOutputBinaryHandler::setBackgroundIO,"If true the data is written by a background thread.")
+  .add_property("chunkSize",&XC::DataOutputBinaryHandler::getChunkSize,&XC::DataOutputBinaryHandler::setChunkSize,"Number of rows written to disk at once.")
+  .add_property("numRows",&XC::DataOutputBinaryHandler::getNumRows,"Number of rows written.")
+  ;
+
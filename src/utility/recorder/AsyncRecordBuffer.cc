@@ -0,0 +1,107 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//AsyncRecordBuffer.cc
+
+#include <utility/recorder/AsyncRecordBuffer.h>
+
+//! @brief Constructor.
+//!
+//! @param f: function that processes each snapshot.
+//! @param numSlots: number of snapshots that can wait for the worker.
+XC::AsyncRecordBuffer::AsyncRecordBuffer(const consumer_function &f, size_t numSlots)
+  : slots(std::max(numSlots,size_t(1))), head(0), count(0), consumer(f), stop(false), numErrors(0)
+  {}
+
+//! @brief Destructor (processes the pending snapshots).
+XC::AsyncRecordBuffer::~AsyncRecordBuffer(void)
+  { stopWorker(); }
+
+//! @brief Body of the worker thread.
+void XC::AsyncRecordBuffer::run(void)
+  {
+    const size_t numSlots= slots.size();
+    while(true)
+      {
+        size_t tail= 0;
+        {
+          std::unique_lock<std::mutex> lock(mtx);
+          notEmpty.wait(lock,[this]{ return (stop || count>0); });
+          if(count==0) // stop.
+            break;
+          tail= (head+numSlots-count)%numSlots;
+        }
+        // the slot is still counted so the producer doesn't reuse it.
+        const int ok= consumer(slots[tail]);
+        {
+          std::lock_guard<std::mutex> lock(mtx);
+          if(ok<0)
+            numErrors++;
+          count--;
+        }
+        notFull.notify_all();
+      }
+  }
+
+//! @brief Copies the data in the next free slot (waits if all
+//! the slots are in use).
+void XC::AsyncRecordBuffer::push(const Vector &v)
+  {
+    std::unique_lock<std::mutex> lock(mtx);
+    if(!worker.joinable())
+      {
+        stop= false;
+        worker= std::thread(&AsyncRecordBuffer::run,this);
+      }
+    notFull.wait(lock,[this]{ return (count<slots.size()); });
+    slots[head]= v; // no allocation once the slot has the right size.
+    head= (head+1)%slots.size();
+    count++;
+    lock.unlock();
+    notEmpty.notify_one();
+  }
+
+//! @brief Waits until all the pending snapshots are processed.
+//!
+//! Returns -1 if the processing of any snapshot failed since
+//! the last call.
+int XC::AsyncRecordBuffer::flush(void)
+  {
+    std::unique_lock<std::mutex> lock(mtx);
+    notFull.wait(lock,[this]{ return (count==0); });
+    const int retval= (numErrors>0 ? -1 : 0);
+    numErrors= 0;
+    return retval;
+  }
+
+//! @brief Processes the pending snapshots and ends the worker thread.
+void XC::AsyncRecordBuffer::stopWorker(void)
+  {
+    if(worker.joinable())
+      {
+        {
+          std::lock_guard<std::mutex> lock(mtx);
+          stop= true;
+        }
+        notEmpty.notify_one();
+        worker.join();
+      }
+  }
@@ -0,0 +1,74 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//AsyncRecordBuffer.h
+                                                                        
+#ifndef AsyncRecordBuffer_h
+#define AsyncRecordBuffer_h
+
+#include <utility/matrix/Vector.h>
+#include <vector>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace XC {
+
+//! @ingroup Recorder
+//
+//! @brief Ring buffer of recorded data processed by a background thread.
+//!
+//! The recorder copies a snapshot of the data (a Vector) into the
+//! next free slot of the ring and returns immediately; a worker
+//! thread passes each slot, in order, to the consumer function
+//! (formatting and output). When all the slots are full the producer
+//! waits until the worker frees one (back-pressure).
+class AsyncRecordBuffer
+  {
+  public:
+    typedef std::function<int(Vector &)> consumer_function;
+  private:
+    std::vector<Vector> slots; //!< snapshots (reused once allocated).
+    size_t head; //!< next slot to fill.
+    size_t count; //!< number of slots waiting or being processed.
+    consumer_function consumer; //!< function that processes each snapshot.
+    std::thread worker; //!< background thread.
+    std::mutex mtx; //!< protects head, count and stop.
+    std::condition_variable notEmpty; //!< signals new snapshots.
+    std::condition_variable notFull; //!< signals processed snapshots.
+    bool stop; //!< if true the worker ends when there is no pending data.
+    size_t numErrors; //!< number of snapshots whose processing failed since the last flush.
+
+    void run(void);
+    void stopWorker(void);
+    AsyncRecordBuffer(const AsyncRecordBuffer &);
+    AsyncRecordBuffer &operator=(const AsyncRecordBuffer &);
+  public:
+    AsyncRecordBuffer(const consumer_function &, size_t numSlots= 16);
+    ~AsyncRecordBuffer(void);
+
+    void push(const Vector &);
+    int flush(void);
+  };
+} // end of XC namespace
+
+#endif
@@ -27,13 +27,74 @@
 //DomainRecorderBase.cc
 
 #include <utility/recorder/DomainRecorderBase.h>
+#include <utility/recorder/AsyncRecordBuffer.h>
 
 //! @brief Constructor.
 //!
 //! @param classTag: class identifier.
 //! @param ptr_dom: pointer to the domain.
 XC::DomainRecorderBase::DomainRecorderBase(int classTag,Domain *ptr_dom)
-  :Recorder(classTag),theDomain(ptr_dom) {}
+  :Recorder(classTag), asynchronous(true), asyncBuffer(nullptr), theDomain(ptr_dom) {}
+
+//! @brief Destructor.
+//!
+//! Derived classes that push snapshots must call flush in their
+//! destructors (processSnapshot is not available here).
+XC::DomainRecorderBase::~DomainRecorderBase(void)
+  {
+    if(asyncBuffer)
+      {
+        delete asyncBuffer;
+        asyncBuffer= nullptr;
+      }
+  }
+
+//! @brief If true, the snapshots are processed by a background
+//! thread.
+void XC::DomainRecorderBase::setAsynchronous(const bool &b)
+  {
+    if(!b)
+      flush();
+    asynchronous= b;
+  }
+
+//! @brief Returns true if the snapshots are processed by a background
+//! thread.
+bool XC::DomainRecorderBase::getAsynchronous(void) const
+  { return asynchronous; }
+
+//! @brief Processes the snapshot (now or in the background thread
+//! if the asynchronous flag is set).
+int XC::DomainRecorderBase::pushSnapshot(Vector &snapshot)
+  {
+    int retval= 0;
+    if(asynchronous)
+      {
+        if(!asyncBuffer)
+          asyncBuffer= new AsyncRecordBuffer([this](Vector &v){ return this->processSnapshot(v); });
+        asyncBuffer->push(snapshot);
+      }
+    else
+      retval= processSnapshot(snapshot);
+    return retval;
+  }
+
+//! @brief Waits until all the pending snapshots are processed.
+//!
+//! Returns a negative value if the processing of any of them
+//! has failed.
+int XC::DomainRecorderBase::flush(void)
+  {
+    int retval= 0;
+    if(asyncBuffer)
+      {
+        retval= asyncBuffer->flush();
+        if(retval<0)
+          std::cerr << getClassName() << "::" << __FUNCTION__
+                    << "; failed to write the recorded data." << std::endl;
+      }
+    return retval;
+  }
 
 //! @brief Set the link with the domain.
 int XC::DomainRecorderBase::setDomain(Domain &theDom)
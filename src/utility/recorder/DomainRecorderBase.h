@@ -33,18 +33,43 @@
 
 namespace XC {
 class Domain;
+class Vector;
+class AsyncRecordBuffer;
 
 //! @ingroup Recorder
 //
 //! @brief Base class for the recorders that store 
 //! a link with the domain.
+//!
+//! If the asynchronous flag is set (the default), the data
+//! gathered on each record call (the snapshot) is processed (formatted
+//! and written) by a background thread so the analysis doesn't wait
+//! for the output. Each asynchronous recorder has its own thread; the
+//! recorders that share an output handler lock it on each call (see
+//! HandlerRecorder). The errors are reported by flush.
 class DomainRecorderBase: public Recorder
   {
+  private:
+    bool asynchronous; //!< if true process the snapshots in a background thread.
+    AsyncRecordBuffer *asyncBuffer; //!< snapshots waiting to be processed.
+
+    DomainRecorderBase(const DomainRecorderBase &);
+    DomainRecorderBase &operator=(const DomainRecorderBase &);
   protected:
     Domain *theDomain;
 
+    int pushSnapshot(Vector &);
+    //! @brief Processes (formats and writes) the data gathered
+    //! in a record call.
+    virtual int processSnapshot(Vector &)
+      { return 0; }
   public:
     DomainRecorderBase(int classTag,Domain *ptr_dom= nullptr);
+    ~DomainRecorderBase(void);
+
+    void setAsynchronous(const bool &);
+    bool getAsynchronous(void) const;
+    int flush(void);
 
     int setDomain(Domain &theDomain);
     inline Domain *getDomain(void)
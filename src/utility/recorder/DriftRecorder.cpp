@@ -208,8 +208,7 @@ int XC::DriftRecorder::record(int commitTag, double timeStamp)
           data(i+timeOffset) = 0.0;
       }
 
-    theHandler->write(data);
-    return 0;
+    return writeData(data);
   }
 
 int XC::DriftRecorder::restart(void)
@@ -370,7 +369,7 @@ int XC::DriftRecorder::initialize(void)
     //
 
     if(theHandler)
-      theHandler->open(dbColumns);
+      openHandler(dbColumns);
 
     //
     // mark as having been done & return
@@ -136,7 +136,7 @@ int XC::ElementRecorder::record(int commitTag, double timeStamp)
         // send the response vector to the output handler for o/p
         //
 
-        theHandler->write(data);
+        result+= writeData(data);
       }
     // succesfull completion - return 0
     return result;
@@ -262,7 +262,7 @@ int XC::ElementRecorder::initialize(void)
     // call open in the handler with the data description
     //
 
-    theHandler->open(dbColumns);
+    openHandler(dbColumns);
 
     // create the vector to hold the data
     data= Vector(numDbColumns);
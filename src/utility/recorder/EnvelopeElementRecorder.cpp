@@ -104,8 +104,9 @@ XC::EnvelopeElementRecorder::~EnvelopeElementRecorder(void)
             int size = currentData->Size();
             for(int j=0; j<size; j++)
               (*currentData)(j) = (*data)(i,j);
-            theHandler->write(*currentData);
+            writeData(*currentData);
           }
+        flush();
       }
   }
 
@@ -405,7 +406,7 @@ int XC::EnvelopeElementRecorder::initialize(void)
     // call open in the handler with the data description
     //
 
-    theHandler->open(dbColumns);
+    openHandler(dbColumns);
 
     initializationDone = true;  
     return 0;
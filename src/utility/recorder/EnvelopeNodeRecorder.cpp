@@ -166,8 +166,9 @@ XC::EnvelopeNodeRecorder::~EnvelopeNodeRecorder(void)
             int size= currentData->Size();
             for(int j=0; j<size; j++)
 	      (*currentData)(j) = (*data)(i,j);
-            theHandler->write(*currentData);
+            writeData(*currentData);
           }
+        flush();
       }
   }
 
@@ -526,7 +527,7 @@ int XC::EnvelopeNodeRecorder::initialize(void)
   //
 
   if(theHandler != 0)
-    theHandler->open(dbColumns);
+    openHandler(dbColumns);
 
   initializationDone = true;
 
@@ -36,9 +36,76 @@ XC::HandlerRecorder::HandlerRecorder(int classTag)
 XC::HandlerRecorder::HandlerRecorder(int classTag,Domain &theDom,DataOutputHandler &theOutputHandler,bool tf)
   :DomainRecorderBase(classTag,&theDom), theHandler(&theOutputHandler), initializationDone(false), echoTimeFlag(tf) {}
 
-//! @brief Sets de data output handler
+//! @brief Destructor (writes the pending data and closes the
+//! output handler).
+XC::HandlerRecorder::~HandlerRecorder(void)
+  {
+    flush();
+    if(theHandler)
+      {
+        std::lock_guard<std::mutex> lock(theHandler->getMutex());
+        theHandler->close();
+      }
+  }
+
+//! @brief Sets de data output handler (the previous one is
+//! closed).
 void XC::HandlerRecorder::SetOutputHandler(DataOutputHandler *tH)
-  { theHandler= tH; }
+  {
+    flush();
+    if(theHandler && (theHandler!=tH))
+      {
+        std::lock_guard<std::mutex> lock(theHandler->getMutex());
+        theHandler->close();
+      }
+    theHandler= tH;
+  }
+
+//! @brief Waits until all the pending snapshots are processed and
+//! makes the output handler write its buffered data.
+int XC::HandlerRecorder::flush(void)
+  {
+    int retval= DomainRecorderBase::flush();
+    if(theHandler)
+      {
+        std::lock_guard<std::mutex> lock(theHandler->getMutex());
+        retval+= theHandler->flush();
+      }
+    return retval;
+  }
+
+//! @brief Writes the data using the output handler (the handler
+//! is locked so the recorders that share it can write from
+//! their own threads).
+int XC::HandlerRecorder::processSnapshot(Vector &data)
+  {
+    int retval= -1;
+    if(theHandler)
+      {
+        std::lock_guard<std::mutex> lock(theHandler->getMutex());
+        retval= theHandler->write(data);
+      }
+    return retval;
+  }
+
+//! @brief Opens the output handler once the pending data has been
+//! written.
+int XC::HandlerRecorder::openHandler(const std::vector<std::string> &dataDescription)
+  {
+    int retval= -1;
+    flush();
+    if(theHandler)
+      {
+        std::lock_guard<std::mutex> lock(theHandler->getMutex());
+        retval= theHandler->open(dataDescription);
+      }
+    return retval;
+  }
+
+//! @brief Sends the data to the output handler (through the background
+//! thread if the recorder is asynchronous).
+int XC::HandlerRecorder::writeData(Vector &data)
+  { return pushSnapshot(data); }
 
 
 //! @brief Sends objet through the communicator being passed as parameter.
@@ -48,11 +48,18 @@ class HandlerRecorder: public DomainRecorderBase
   protected:
     int sendData(CommParameters &);  
     int receiveData(const CommParameters &);
+    int processSnapshot(Vector &);
+    int openHandler(const std::vector<std::string> &);
+    int writeData(Vector &);
 
   public:
     HandlerRecorder(int classTag);
     HandlerRecorder(int classTag, Domain &theDomain, DataOutputHandler &theOutputHandler,bool timeFlag);
+    ~HandlerRecorder(void);
     void SetOutputHandler(DataOutputHandler *tH);
+    inline DataOutputHandler *getOutputHandler(void)
+      { return theHandler; }
+    int flush(void);
 
   };
 } // end of XC namespace
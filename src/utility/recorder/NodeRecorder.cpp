@@ -181,6 +181,30 @@ void XC::NodeRecorder::setupDataFlag(const std::string &dataToStore)
       }
   }
 
+//! @brief Sets the tags of the nodes to record.
+void XC::NodeRecorder::setNodes(const ID &nodes)
+  {
+    if(theNodalTags)
+      {
+        delete theNodalTags;
+        theNodalTags= nullptr;
+      }
+    setup_nodes(nodes);
+    initializationDone= false;
+  }
+
+//! @brief Sets the DOFs to record.
+void XC::NodeRecorder::setDofs(const ID &dofs)
+  {
+    if(theDofs)
+      {
+        delete theDofs;
+        theDofs= nullptr;
+      }
+    setup_dofs(dofs);
+    initializationDone= false;
+  }
+
 XC::NodeRecorder::NodeRecorder(void)
   :NodeRecorderBase(RECORDER_TAGS_NodeRecorder),
    response(0),sensitivity(0)
@@ -447,7 +471,7 @@ int XC::NodeRecorder::record(int commitTag, double timeStamp)
             }
         }
       // insert the data into the database
-      theHandler->write(response);
+      return writeData(response);
     }
     return 0;
   }
@@ -618,7 +642,7 @@ int XC::NodeRecorder::initialize(void)
     //
 
     if(theHandler != 0)
-      theHandler->open(dbColumns);
+      openHandler(dbColumns);
 
     initializationDone = true;
     return 0;
@@ -94,6 +94,8 @@ class NodeRecorder: public NodeRecorderBase
 		 double deltaT = 0.0, bool echoTimeFlag = true); 
 
     void setupDataFlag(const std::string &dataToStore);
+    void setNodes(const ID &);
+    void setDofs(const ID &);
     int record(int commitTag, double timeStamp);
 
     int sendSelf(CommParameters &);  
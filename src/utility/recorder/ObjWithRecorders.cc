@@ -64,6 +64,7 @@
 #include <utility/recorder/PatternRecorder.h>
 #include <utility/recorder/NodePropRecorder.h>
 #include <utility/recorder/ElementPropRecorder.h>
+#include <utility/recorder/VtuRecorder.h>
 
 
 #include "boost/any.hpp"
@@ -151,6 +152,11 @@ XC::Recorder *XC::ObjWithRecorders::newRecorder(const std::string &cod,DataOutpu
         ElementPropRecorder *tmp= new ElementPropRecorder(get_domain_ptr());
         retval= tmp;
       }
+    else if(cod == "vtu_recorder")
+      {
+        VtuRecorder *tmp= new VtuRecorder(get_domain_ptr());
+        retval= tmp;
+      }
     else
       std::cerr << "Recorder type: '" << cod
                 << "' unknown." << std::endl;
@@ -163,7 +169,10 @@ XC::Recorder *XC::ObjWithRecorders::newRecorder(const std::string &cod,DataOutpu
 XC::ObjWithRecorders::~ObjWithRecorders(void)
   {
     for(lista_recorders::iterator i= theRecorders.begin();i!= theRecorders.end(); i++)
-      delete *i; 
+      {
+        (*i)->flush();
+        delete *i;
+      }
     theRecorders.erase(theRecorders.begin(),theRecorders.end());
   }
 
@@ -191,14 +200,27 @@ int XC::ObjWithRecorders::record(int cTag, double timeStamp)
 void XC::ObjWithRecorders::restart(void)
   {
     for(lista_recorders::iterator i= theRecorders.begin();i!= theRecorders.end(); i++)
-      (*i)->restart();
+      {
+        (*i)->flush();
+        (*i)->restart();
+      }
+  }
+
+//! @brief Waits until the recorders have written all their data.
+void XC::ObjWithRecorders::flushRecorders(void)
+  {
+    for(lista_recorders::iterator i= theRecorders.begin();i!= theRecorders.end(); i++)
+      (*i)->flush();
   }
 
 //! @brief Remove the recorders.
 int XC::ObjWithRecorders::removeRecorders(void)
   {
     for(lista_recorders::iterator i= theRecorders.begin();i!= theRecorders.end(); i++)
-      delete *i; 
+      {
+        (*i)->flush();
+        delete *i;
+      }
     theRecorders.erase(theRecorders.begin(),theRecorders.end());
     return 0;
   }
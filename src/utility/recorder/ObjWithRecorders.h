@@ -75,6 +75,7 @@ class ObjWithRecorders: public CommandEntity
       { return theRecorders.end(); }
     virtual int record(int track, double timeStamp= 0.0);
     void restart(void);
+    void flushRecorders(void);
     virtual int removeRecorders(void);
     void setLinks(Domain *dom);
     void SetOutputHandlers(DataOutputHandler::map_output_handlers *oh);
@@ -76,6 +76,11 @@ int XC::Recorder::playback(int)
 int XC::Recorder::restart(void)
   { return 0; }
 
+//! @brief Waits until all the recorded data has been written. Invoked
+//! at the end of each analysis.
+int XC::Recorder::flush(void)
+  { return 0; }
+
 int XC::Recorder::setDomain(Domain &theDomain)
   { return 0; }
 
@@ -95,6 +95,7 @@ class Recorder: public MovableObject, public CommandEntity
     virtual int record(int commitTag, double timeStamp) =0;
     virtual int playback(int commitTag);
     virtual int restart(void);
+    virtual int flush(void);
     virtual int setDomain(Domain &theDomain);
     virtual int sendSelf(CommParameters &);  
     virtual int recvSelf(const CommParameters &);
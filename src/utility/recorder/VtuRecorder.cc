@@ -0,0 +1,568 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//VtuRecorder.cc
+
+#include <utility/recorder/VtuRecorder.h>
+#include <domain/domain/Domain.h>
+#include <domain/mesh/node/Node.h>
+#include <domain/mesh/node/NodeIter.h>
+#include <domain/mesh/element/Element.h>
+#include <domain/mesh/element/ElementIter.h>
+#include "domain/mesh/element/utils/NodePtrsWithIDs.h"
+#include "domain/mesh/element/utils/Information.h"
+#include <utility/recorder/response/Response.h>
+#include "preprocessor/set_mgmt/SetMeshComp.h"
+#include "xc_basic/src/text/text_string.h"
+#include <boost/python/extract.hpp>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <map>
+#include <algorithm>
+#include <cstdint>
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+//! @brief Closing tags of the .pvd file.
+const std::string XC::VtuRecorder::pvdTail= "  </Collection>\n</VTKFile>\n";
+
+//! @brief Constructor.
+XC::VtuRecorder::VtuRecorder(Domain *ptr_dom)
+  :DomainRecorderBase(RECORDER_TAGS_VtuRecorder,ptr_dom), fileName("results"),
+   compressed(false), deltaT(0.0), nextTimeStampToRecord(0.0),
+   nodeTags(), elemTags(), pointData(1,"disp"), cellData(),
+   initialized(false), counter(0) {}
+
+//! @brief Destructor.
+XC::VtuRecorder::~VtuRecorder(void)
+  {
+    flush();
+    freeResponses();
+  }
+
+//! @brief Deletes the element response objects.
+void XC::VtuRecorder::freeResponses(void)
+  {
+    for(std::vector<std::vector<Response *> >::iterator i= responses.begin();i!=responses.end();i++)
+      for(std::vector<Response *>::iterator j= i->begin();j!=i->end();j++)
+        if(*j)
+          delete *j;
+    responses.clear();
+  }
+
+//! @brief Sets the base name of the output files (the recorder
+//! writes fileName.pvd and fileName_NNNNNN.vtu).
+void XC::VtuRecorder::setFileName(const std::string &str)
+  { fileName= str; }
+
+//! @brief Returns the base name of the output files.
+const std::string &XC::VtuRecorder::getFileName(void) const
+  { return fileName; }
+
+//! @brief If true the data arrays are compressed with zlib (ignored
+//! if XC has been built without zlib).
+void XC::VtuRecorder::setCompressed(const bool &b)
+  {
+    if(b && !compressionAvailable())
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; XC has been built without zlib, the data"
+                  << " will be written uncompressed." << std::endl;
+        compressed= false;
+      }
+    else
+      compressed= b;
+  }
+
+//! @brief Returns true if the data arrays are compressed with zlib.
+bool XC::VtuRecorder::getCompressed(void) const
+  { return compressed; }
+
+//! @brief Returns true if XC has been built with zlib (so the data
+//! arrays can be compressed).
+bool XC::VtuRecorder::compressionAvailable(void)
+  {
+#ifdef HAVE_ZLIB
+    return true;
+#else
+    return false;
+#endif
+  }
+
+//! @brief Sets the time interval between records.
+void XC::VtuRecorder::setDeltaT(const double &d)
+  { deltaT= d; }
+
+//! @brief Returns the time interval between records.
+double XC::VtuRecorder::getDeltaT(void) const
+  { return deltaT; }
+
+//! @brief Sets the nodes to record.
+void XC::VtuRecorder::setNodes(const ID &tags)
+  {
+    nodeTags= tags;
+    initialized= false;
+  }
+
+//! @brief Sets the elements to record (their nodes are recorded too).
+void XC::VtuRecorder::setElements(const ID &tags)
+  {
+    elemTags= tags;
+    initialized= false;
+  }
+
+//! @brief Restricts the output to the nodes and elements of the set.
+void XC::VtuRecorder::setSet(const SetMeshComp &s)
+  {
+    nodeTags= ID(s.getNodes().getTags());
+    elemTags= ID(s.getElements().getTags());
+    initialized= false;
+  }
+
+//! @brief Sets the nodal responses to record (disp, vel, accel or
+//! reaction).
+void XC::VtuRecorder::setPointData(const boost::python::list &l)
+  {
+    const size_t sz= len(l);
+    pointData.resize(sz);
+    for(size_t i=0; i<sz; i++)
+      pointData[i]= boost::python::extract<std::string>(l[i]);
+  }
+
+//! @brief Sets the element responses to record. Each item contains
+//! the arguments passed to Element::setResponse separated by
+//! spaces (i.e. "force" or "section 1 deformation").
+void XC::VtuRecorder::setCellData(const boost::python::list &l)
+  {
+    const size_t sz= len(l);
+    cellData.resize(sz);
+    for(size_t i=0; i<sz; i++)
+      cellData[i]= boost::python::extract<std::string>(l[i]);
+    initialized= false;
+  }
+
+//! @brief Sets the domain.
+int XC::VtuRecorder::setDomain(Domain &dom)
+  {
+    flush();
+    initialized= false;
+    return DomainRecorderBase::setDomain(dom);
+  }
+
+//! @brief Appends to the string argument the block of data
+//! as expected in the appended section of a VTK XML file
+//! (header_type="UInt64").
+void XC::VtuRecorder::encode(const void *data, size_t numBytes, std::string &out) const
+  {
+    const char *src= static_cast<const char *>(data);
+    if(!compressed)
+      {
+        const uint64_t sz= numBytes;
+        out.append(reinterpret_cast<const char *>(&sz),sizeof(sz));
+        out.append(src,numBytes);
+      }
+#ifdef HAVE_ZLIB
+    else
+      {
+        // header: number of blocks, block size, size of the last
+        // (partial) block and compressed size of each block.
+        const size_t blockSize= 32768;
+        const size_t numBlocks= (numBytes+blockSize-1)/blockSize;
+        std::vector<uint64_t> header(3+numBlocks,0);
+        header[0]= numBlocks;
+        header[1]= blockSize;
+        header[2]= numBytes%blockSize;
+        std::string blocks;
+        std::vector<Bytef> buffer(compressBound(blockSize));
+        for(size_t i=0; i<numBlocks; i++)
+          {
+            const size_t offset= i*blockSize;
+            const size_t sz= std::min(blockSize,numBytes-offset);
+            uLongf compressedSize= buffer.size();
+            compress2(buffer.data(),&compressedSize,reinterpret_cast<const Bytef *>(src+offset),sz,Z_BEST_SPEED);
+            header[3+i]= compressedSize;
+            blocks.append(reinterpret_cast<const char *>(buffer.data()),compressedSize);
+          }
+        out.append(reinterpret_cast<const char *>(header.data()),header.size()*sizeof(uint64_t));
+        out.append(blocks);
+      }
+#endif
+  }
+
+//! @brief Returns the XML description of an appended data array.
+std::string XC::VtuRecorder::dataArrayXML(const std::string &type, const std::string &name, size_t numComponents, size_t offset) const
+  {
+    std::ostringstream os;
+    os << "        <DataArray type=\"" << type << "\"";
+    if(!name.empty())
+      os << " Name=\"" << name << "\"";
+    os << " NumberOfComponents=\"" << numComponents
+       << "\" format=\"appended\" offset=\"" << offset << "\"/>\n";
+    return os.str();
+  }
+
+//! @brief Returns the name of the file for the i-th step.
+std::string XC::VtuRecorder::getStepFileName(size_t i) const
+  {
+    std::ostringstream os;
+    os << fileName << '_' << std::setw(6) << std::setfill('0') << i << ".vtu";
+    return os.str();
+  }
+
+//! @brief Collects the nodes and elements to record, encodes
+//! the mesh topology and creates the element responses.
+int XC::VtuRecorder::initialize(void)
+  {
+    if(!theDomain)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; undefined domain." << std::endl;
+        return -1;
+      }
+    flush(); // the topology is used by processSnapshot.
+    nodes.clear();
+    elements.clear();
+    freeResponses();
+    
+    if(nodeTags.Size()==0 && elemTags.Size()==0) // whole domain.
+      {
+        Node *theNode= nullptr;
+        NodeIter &theNodes= theDomain->getNodes();
+        while((theNode= theNodes()) != nullptr)
+          nodes.push_back(theNode);
+        Element *theEle= nullptr;
+        ElementIter &theElements= theDomain->getElements();
+        while((theEle= theElements()) != nullptr)
+          elements.push_back(theEle);
+      }
+    else
+      {
+        for(int i= 0;i<nodeTags.Size();i++)
+          {
+            Node *theNode= theDomain->getNode(nodeTags(i));
+            if(theNode)
+              nodes.push_back(theNode);
+            else
+              std::cerr << getClassName() << "::" << __FUNCTION__
+                        << "; node: " << nodeTags(i)
+                        << " not found, ignored." << std::endl;
+          }
+        for(int i= 0;i<elemTags.Size();i++)
+          {
+            Element *theEle= theDomain->getElement(elemTags(i));
+            if(theEle)
+              elements.push_back(theEle);
+            else
+              std::cerr << getClassName() << "::" << __FUNCTION__
+                        << "; element: " << elemTags(i)
+                        << " not found, ignored." << std::endl;
+          }
+      }
+
+    // the elements whose nodes are not in the domain are discarded.
+    std::vector<Element *> validElements;
+    validElements.reserve(elements.size());
+    for(std::vector<Element *>::const_iterator i= elements.begin();i!=elements.end();i++)
+      {
+        const ID &eNodes= (*i)->getNodePtrs().getExternalNodes();
+        bool ok= true;
+        for(int j= 0;j<eNodes.Size();j++)
+          if(!theDomain->getNode(eNodes(j)))
+            {
+              std::cerr << getClassName() << "::" << __FUNCTION__
+                        << "; node: " << eNodes(j) << " of element: "
+                        << (*i)->getTag() << " not found, element ignored."
+                        << std::endl;
+              ok= false;
+              break;
+            }
+        if(ok)
+          validElements.push_back(*i);
+      }
+    elements.swap(validElements);
+
+    // position of each node in the points array.
+    std::map<int,int64_t> nodeIndex;
+    for(size_t i= 0;i<nodes.size();i++)
+      nodeIndex[nodes[i]->getTag()]= i;
+
+    // connectivity (nodes of the elements not in the list are added).
+    std::vector<int64_t> connectivity;
+    std::vector<int64_t> offsets(elements.size());
+    std::vector<uint8_t> types(elements.size());
+    for(size_t i= 0;i<elements.size();i++)
+      {
+        const Element *theEle= elements[i];
+        const ID &eNodes= theEle->getNodePtrs().getExternalNodes();
+        for(int j= 0;j<eNodes.Size();j++)
+          {
+            const int tag= eNodes(j);
+            std::map<int,int64_t>::const_iterator k= nodeIndex.find(tag);
+            if(k==nodeIndex.end())
+              {
+                const int64_t idx= nodes.size();
+                nodes.push_back(theDomain->getNode(tag));
+                nodeIndex[tag]= idx;
+                connectivity.push_back(idx);
+              }
+            else
+              connectivity.push_back(k->second);
+          }
+        offsets[i]= connectivity.size();
+        types[i]= theEle->getVtkCellType();
+      }
+
+    std::vector<double> points(3*nodes.size());
+    for(size_t i= 0;i<nodes.size();i++)
+      {
+        const Vector pos= nodes[i]->getCrds3d();
+        points[3*i]= pos(0);
+        points[3*i+1]= pos(1);
+        points[3*i+2]= pos(2);
+      }
+
+    topologyData.clear();
+    std::ostringstream os;
+    os << "      <Points>\n" << dataArrayXML("Float64","",3,topologyData.size());
+    encode(points.data(),points.size()*sizeof(double),topologyData);
+    os << "      </Points>\n      <Cells>\n" << dataArrayXML("Int64","connectivity",1,topologyData.size());
+    encode(connectivity.data(),connectivity.size()*sizeof(int64_t),topologyData);
+    os << dataArrayXML("Int64","offsets",1,topologyData.size());
+    encode(offsets.data(),offsets.size()*sizeof(int64_t),topologyData);
+    os << dataArrayXML("UInt8","types",1,topologyData.size());
+    encode(types.data(),types.size()*sizeof(uint8_t),topologyData);
+    os << "      </Cells>\n";
+    topologyXML= os.str();
+
+    // element responses.
+    responses.resize(cellData.size());
+    for(size_t i= 0;i<cellData.size();i++)
+      {
+        const std::deque<std::string> fields= separa_cadena(cellData[i]," ");
+        const std::vector<std::string> args(fields.begin(),fields.end());
+        responses[i].resize(elements.size(),nullptr);
+        for(size_t j= 0;j<elements.size();j++)
+          {
+            Information eleInfo(1.0);
+            responses[i][j]= elements[j]->setResponse(args,eleInfo);
+          }
+      }
+    initialized= true;
+    return 0;
+  }
+
+//! @brief Fills the values vector with the nodal response argument
+//! and returns the number of components (the largest size of the nodal
+//! vectors; the shorter ones are padded with zeros).
+size_t XC::VtuRecorder::getPointArray(const std::string &name, std::vector<double> &values) const
+  {
+    const Vector &(Node::*response)(void) const= &Node::getDisp;
+    if(name=="vel")
+      response= &Node::getVel;
+    else if(name=="accel")
+      response= &Node::getAccel;
+    else if(name=="reaction")
+      response= &Node::getReaction;
+    else if(name!="disp")
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; unknown nodal response: '" << name
+                << "' displacements written instead." << std::endl;
+    size_t numComponents= 1;
+    for(std::vector<Node *>::const_iterator i= nodes.begin();i!=nodes.end();i++)
+      numComponents= std::max(numComponents,size_t(((*i)->*response)().Size()));
+    values.assign(numComponents*nodes.size(),0.0);
+    for(size_t i= 0;i<nodes.size();i++)
+      {
+        const Vector &v= (nodes[i]->*response)();
+        for(int j= 0;j<v.Size();j++)
+          values[i*numComponents+j]= v(j);
+      }
+    return numComponents;
+  }
+
+//! @brief Fills the values vector with the element responses
+//! and returns the number of components (the largest size of the
+//! response vectors; the shorter ones are padded with zeros).
+size_t XC::VtuRecorder::getCellArray(std::vector<Response *> &eResponses, std::vector<double> &values) const
+  {
+    size_t numComponents= 1;
+    for(std::vector<Response *>::iterator i= eResponses.begin();i!=eResponses.end();i++)
+      if(*i)
+        {
+          (*i)->getResponse();
+          numComponents= std::max(numComponents,size_t((*i)->getInformation().getData().Size()));
+        }
+    values.assign(numComponents*eResponses.size(),0.0);
+    for(size_t i= 0;i<eResponses.size();i++)
+      if(eResponses[i])
+        {
+          const Vector &v= eResponses[i]->getInformation().getData();
+          for(int j= 0;j<v.Size();j++)
+            values[i*numComponents+j]= v(j);
+        }
+    return numComponents;
+  }
+
+//! @brief Appends the step file to the time index (.pvd file). The
+//! closing tags are overwritten on each call so the file is always
+//! complete.
+int XC::VtuRecorder::writePVD(double timeStamp, const std::string &stepFileName)
+  {
+    const std::string pvdFileName= fileName+".pvd";
+    std::fstream out;
+    if(counter==0)
+      {
+        out.open(pvdFileName.c_str(),std::ios::out | std::ios::trunc);
+        out << "<?xml version=\"1.0\"?>\n"
+            << "<VTKFile type=\"Collection\" version=\"0.1\">\n"
+            << "  <Collection>\n";
+      }
+    else
+      {
+        out.open(pvdFileName.c_str(),std::ios::in | std::ios::out);
+        out.seekp(-static_cast<std::streamoff>(pvdTail.size()),std::ios::end);
+      }
+    if(!out)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; can't open file: '" << pvdFileName
+                  << "'." << std::endl;
+        return -1;
+      }
+    // file names in the .pvd are relative to its location.
+    const size_t pos= stepFileName.find_last_of('/');
+    const std::string relativeName= (pos==std::string::npos) ? stepFileName : stepFileName.substr(pos+1);
+    out << "    <DataSet timestep=\"" << std::setprecision(12) << timeStamp
+        << "\" part=\"0\" file=\"" << relativeName << "\"/>\n"
+        << pvdTail;
+    return 0;
+  }
+
+//! @brief Gathers the point and cell data of the current step and
+//! sends it to processSnapshot (which encodes and writes it). The
+//! snapshot contains the time, the number of components of each array
+//! and the array values.
+int XC::VtuRecorder::record(int commitTag, double timeStamp)
+  {
+    if(deltaT != 0.0 && timeStamp < nextTimeStampToRecord)
+      return 0;
+    if(deltaT != 0.0) 
+      nextTimeStampToRecord= timeStamp + deltaT;
+    if(!initialized)
+      if(initialize()<0)
+        return -1;
+
+    // if need nodal reactions get the domain to calculate them
+    // before we iterate over the nodes
+    if(std::find(pointData.begin(),pointData.end(),"reaction")!=pointData.end())
+      theDomain->calculateNodalReactions(false,1e-4);
+
+    const size_t numArrays= pointData.size()+cellData.size();
+    std::vector<double> values;
+    snapshotValues.assign(1+numArrays,0.0);
+    snapshotValues[0]= timeStamp;
+    for(size_t i= 0;i<pointData.size();i++)
+      {
+        snapshotValues[1+i]= getPointArray(pointData[i],values);
+        snapshotValues.insert(snapshotValues.end(),values.begin(),values.end());
+      }
+    for(size_t i= 0;i<cellData.size();i++)
+      {
+        snapshotValues[1+pointData.size()+i]= getCellArray(responses[i],values);
+        snapshotValues.insert(snapshotValues.end(),values.begin(),values.end());
+      }
+    Vector snapshot(snapshotValues.data(),snapshotValues.size());
+    return pushSnapshot(snapshot);
+  }
+
+//! @brief Writes the .vtu file for the snapshot argument and appends
+//! it to the .pvd file.
+int XC::VtuRecorder::processSnapshot(Vector &snapshot)
+  {
+    const double timeStamp= snapshot(0);
+    const size_t numArrays= pointData.size()+cellData.size();
+    size_t pos= 1+numArrays; // first value of the current array.
+    std::string stepData;
+    std::ostringstream pointXML;
+    std::ostringstream cellXML;
+    for(size_t i= 0;i<numArrays;i++)
+      {
+        const size_t numComponents= snapshot(1+i);
+        const bool isPointArray= (i<pointData.size());
+        const size_t numValues= numComponents*(isPointArray ? nodes.size() : elements.size());
+        if(isPointArray)
+          pointXML << dataArrayXML("Float64",pointData[i],numComponents,topologyData.size()+stepData.size());
+        else
+          {
+            std::string name= cellData[i-pointData.size()];
+            std::replace(name.begin(),name.end(),' ','_');
+            cellXML << dataArrayXML("Float64",name,numComponents,topologyData.size()+stepData.size());
+          }
+        encode(snapshot.getDataPtr()+pos,numValues*sizeof(double),stepData);
+        pos+= numValues;
+      }
+
+    const std::string stepFileName= getStepFileName(counter);
+    std::ofstream out(stepFileName.c_str(),std::ios::out | std::ios::binary);
+    if(!out)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; can't open file: '" << stepFileName
+                  << "'." << std::endl;
+        return -1;
+      }
+    const uint16_t one= 1;
+    const bool littleEndian= (*reinterpret_cast<const uint8_t *>(&one)==1);
+    out << "<?xml version=\"1.0\"?>\n"
+        << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\""
+        << (littleEndian ? "LittleEndian" : "BigEndian")
+        << "\" header_type=\"UInt64\"";
+    if(compressed)
+      out << " compressor=\"vtkZLibDataCompressor\"";
+    out << ">\n  <UnstructuredGrid>\n"
+        << "    <Piece NumberOfPoints=\"" << nodes.size()
+        << "\" NumberOfCells=\"" << elements.size() << "\">\n"
+        << topologyXML
+        << "      <PointData>\n" << pointXML.str() << "      </PointData>\n"
+        << "      <CellData>\n" << cellXML.str() << "      </CellData>\n"
+        << "    </Piece>\n  </UnstructuredGrid>\n"
+        << "  <AppendedData encoding=\"raw\">\n   _";
+    out.write(topologyData.data(),topologyData.size());
+    out.write(stepData.data(),stepData.size());
+    out << "\n  </AppendedData>\n</VTKFile>\n";
+    out.close();
+
+    const int retval= writePVD(timeStamp,stepFileName);
+    counter++;
+    return retval;
+  }
+
+//! @brief Restarts the recorder (next record call overwrites the
+//! previous files).
+int XC::VtuRecorder::restart(void)
+  {
+    flush();
+    counter= 0;
+    nextTimeStampToRecord= 0.0;
+    return 0;
+  }
@@ -0,0 +1,110 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//VtuRecorder.h
+                                                                        
+#ifndef VtuRecorder_h
+#define VtuRecorder_h
+
+#include <utility/recorder/DomainRecorderBase.h>
+#include <utility/matrix/ID.h>
+#include <vector>
+#include <string>
+#include <boost/python/list.hpp>
+
+namespace XC {
+class Node;
+class Element;
+class Response;
+class SetMeshComp;
+
+//! @ingroup Recorder
+//
+//! @brief Writes the results of the analysis in VTK XML
+//! unstructured grid files (one .vtu file for each recorded step)
+//! and a ParaView data file (.pvd) that indexes them by time.
+//!
+//! The array data is written in binary appended format (raw or
+//! zlib compressed). The mesh topology (points, connectivity,
+//! offsets and cell types) is encoded only once and reused in
+//! all the steps; only the point and cell data are gathered on
+//! each record call, the encoding and output are done by
+//! processSnapshot (in a background thread if the recorder is
+//! asynchronous).
+class VtuRecorder: public DomainRecorderBase
+  {
+  private:
+    std::string fileName; //!< base name of the output files.
+    bool compressed; //!< if true compress the data with zlib.
+    double deltaT; //!< time interval between records.
+    double nextTimeStampToRecord; //!< time of the next record.
+    ID nodeTags; //!< nodes to record (all if empty).
+    ID elemTags; //!< elements to record (all if empty).
+    std::vector<std::string> pointData; //!< nodal responses to record (disp, vel, accel or reaction).
+    std::vector<std::string> cellData; //!< element responses to record (arguments for setResponse).
+
+    bool initialized; //!< true if the topology is already encoded.
+    std::vector<Node *> nodes; //!< recorded nodes.
+    std::vector<Element *> elements; //!< recorded elements.
+    std::vector<std::vector<Response *> > responses; //!< element responses (one vector for each cellData item).
+    std::string topologyXML; //!< description of the topology arrays.
+    std::string topologyData; //!< encoded topology arrays.
+    size_t counter; //!< number of files written.
+    std::vector<double> snapshotValues; //!< data gathered in the last record call.
+
+    static const std::string pvdTail;
+
+    void encode(const void *, size_t, std::string &) const;
+    std::string dataArrayXML(const std::string &, const std::string &, size_t, size_t) const;
+    std::string getStepFileName(size_t) const;
+    void freeResponses(void);
+    int initialize(void);
+    size_t getPointArray(const std::string &, std::vector<double> &) const;
+    size_t getCellArray(std::vector<Response *> &, std::vector<double> &) const;
+    int writePVD(double, const std::string &);
+  protected:
+    int processSnapshot(Vector &);
+  public:
+    VtuRecorder(Domain *ptr_dom= nullptr);
+    ~VtuRecorder(void);
+
+    void setFileName(const std::string &);
+    const std::string &getFileName(void) const;
+    void setCompressed(const bool &);
+    bool getCompressed(void) const;
+    static bool compressionAvailable(void);
+    void setDeltaT(const double &);
+    double getDeltaT(void) const;
+    void setNodes(const ID &);
+    void setElements(const ID &);
+    void setSet(const SetMeshComp &);
+    void setPointData(const boost::python::list &);
+    void setCellData(const boost::python::list &);
+    inline size_t getNumFiles(void) const
+      { return counter; }
+
+    int record(int commitTag, double timeStamp);
+    int restart(void);
+    int setDomain(Domain &);
+  };
+} // end of XC namespace
+
+#endif
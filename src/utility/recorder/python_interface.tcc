@@ -30,7 +30,10 @@ class_<XC::Recorder, bases<CommandEntity>, boost::noncopyable >("Recorder", no_i
 
 //class_<XC::DatastoreRecorder, bases<XC::Recorder>, boost::noncopyable >("DatastoreRecorder", no_init);
 
-class_<XC::DomainRecorderBase, bases<XC::Recorder>, boost::noncopyable >("DomainRecorderBase", no_init);
+class_<XC::DomainRecorderBase, bases<XC::Recorder>, boost::noncopyable >("DomainRecorderBase", no_init)
+  .add_property("asynchronous",&XC::DomainRecorderBase::getAsynchronous,&XC::DomainRecorderBase::setAsynchronous,"If true, the recorded data is formatted and written by a background thread.")
+  .def("flush",&XC::DomainRecorderBase::flush,"Waits until all the recorded data has been written; returns a negative value if any of it could not be written.")
+  ;
 
 //class_<XC::FilePlotter , bases<XC::Recorder>, boost::noncopyable >("FilePlotter", no_init);
 
@@ -55,13 +58,32 @@ class_<XC::ElementPropRecorder, bases<XC::PropRecorder>, boost::noncopyable >("E
   .def("setElements",&XC::ElementPropRecorder::setElements,"Assigns elements to the recorder.")
   ;
 
+const std::string &(XC::VtuRecorder::*getVtuFileName)(void) const= &XC::VtuRecorder::getFileName;
+class_<XC::VtuRecorder, bases<XC::DomainRecorderBase>, boost::noncopyable >("VtuRecorder", no_init)
+  .add_property("fileName",make_function(getVtuFileName,return_value_policy<copy_const_reference>()),&XC::VtuRecorder::setFileName,"Base name of the output files (fileName.pvd and fileName_NNNNNN.vtu).")
+  .add_property("compressed",&XC::VtuRecorder::getCompressed,&XC::VtuRecorder::setCompressed,"If true, compress the binary data with zlib.")
+  .def("compressionAvailable",&XC::VtuRecorder::compressionAvailable,"Return true if XC has been built with zlib (so the data can be compressed).")
+  .staticmethod("compressionAvailable")
+  .add_property("deltaT",&XC::VtuRecorder::getDeltaT,&XC::VtuRecorder::setDeltaT,"Time interval between records.")
+  .add_property("numFiles",&XC::VtuRecorder::getNumFiles,"Number of .vtu files written.")
+  .def("setNodes",&XC::VtuRecorder::setNodes,"Assigns the nodes to record.")
+  .def("setElements",&XC::VtuRecorder::setElements,"Assigns the elements to record (their nodes are recorded too).")
+  .def("setSet",&XC::VtuRecorder::setSet,"Restricts the output to the nodes and elements of the set.")
+  .def("setPointData",&XC::VtuRecorder::setPointData,"Nodal responses to record: list with any of 'disp', 'vel', 'accel' and 'reaction'.")
+  .def("setCellData",&XC::VtuRecorder::setCellData,"Element responses to record: list of setResponse arguments (i.e. ['force','stress']).")
+  ;
+
 // class_<XC::YsVisual , bases<XC::Recorder>, boost::noncopyable >("YsVisual", no_init);
 
 // class_<XC::DamageRecorder, bases<XC::DomainRecorderBase>, boost::noncopyable >("DamageRecorder", no_init);
 
 // class_<XC::GSA_Recorder, bases<XC::DomainRecorderBase>, boost::noncopyable >("GSA_Recorder", no_init);
 
- class_<XC::HandlerRecorder, bases<XC::DomainRecorderBase>, boost::noncopyable >("HandlerRecorder", no_init);
+ XC::DataOutputHandler *(XC::HandlerRecorder::*getRecorderOutputHandler)(void)= &XC::HandlerRecorder::getOutputHandler;
+ class_<XC::HandlerRecorder, bases<XC::DomainRecorderBase>, boost::noncopyable >("HandlerRecorder", no_init)
+  .add_property("outputHandler",make_function(getRecorderOutputHandler,return_internal_reference<>()),&XC::HandlerRecorder::SetOutputHandler,"Output handler that writes the recorded data (the previous one is closed).")
+  .def("flush",&XC::HandlerRecorder::flush,"Waits until all the recorded data has been written by the output handler; returns a negative value if any of it could not be written.")
+   ;
 
 // class_<XC::MaxNodeDispRecorder, bases<XC::DomainRecorderBase>, boost::noncopyable >("MaxNodeDispRecorder", no_init);
 
@@ -75,7 +97,11 @@ class_<XC::ElementRecorderBase, bases<XC::MeshCompRecorder>, boost::noncopyable
 
 class_<XC::NodeRecorderBase, bases<XC::MeshCompRecorder>, boost::noncopyable >("NodeRecorderBase", no_init);
 
-class_<XC::NodeRecorder, bases<XC::NodeRecorderBase>, boost::noncopyable >("NodeRecorder", no_init);
+class_<XC::NodeRecorder, bases<XC::NodeRecorderBase>, boost::noncopyable >("NodeRecorder", no_init)
+  .def("setNodes",&XC::NodeRecorder::setNodes,"Assigns the tags of the nodes to record.")
+  .def("setDofs",&XC::NodeRecorder::setDofs,"Assigns the DOFs to record.")
+  .def("setData",&XC::NodeRecorder::setupDataFlag,"Response to record: 'disp', 'vel', 'accel', 'reaction',...")
+  ;
 
 class_<XC::EnvelopeNodeRecorder, bases<XC::NodeRecorderBase>, boost::noncopyable >("EnvelopeNodeRecorder", no_init);
 
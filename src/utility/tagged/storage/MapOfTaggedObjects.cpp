@@ -114,35 +114,30 @@ int XC::MapOfTaggedObjects::setSize(int newSize)
 
 //! @brief Adds a component to the container.
 //!
-//! To add the object \p newComponent to the container. First checks to
-//! see if an element with a similar tag already exists in the map. If
-//! not, the pointer to \p newElement is added to the map using the
-//! insert() method. A check is then made to ensure that the object
-//! has been added. (This is done as insert() returns no error flag).
+//! To add the object \p newComponent to the container. If the tag is
+//! greater than the last one in the map (the usual case when numbering
+//! nodes and elements in ascending order) the pointer is inserted at
+//! the end of the map without searching, which is amortized constant
+//! time. Otherwise the position of the tag is searched in the map
+//! (lower_bound, logarithmic time) and, if there is no object with a
+//! similar tag, the pointer to \p newElement is inserted using that
+//! position as hint.
 //! Returns \p true if successful. If not successful, a warning is raised
 //! and false is returned. Note that the map template does not allow items with
 //! duplicate keys to be added. 
 bool XC::MapOfTaggedObjects::addComponent(TaggedObject *newComponent)
   {
-    int tag = newComponent->getTag();
+    const int tag= newComponent->getTag();
 
     // check if the ele already in map, if not we add
-    iterator theEle = theMap.find(tag);
-    if(theEle==end())
+    iterator theEle= end();
+    if(!theMap.empty() && (theMap.rbegin()->first>=tag))
+      theEle= theMap.lower_bound(tag);
+    if((theEle==end()) || (theEle->first!=tag))
       {
         newComponent->set_owner(this);
-	theMap.insert(value_type(tag,newComponent));
+	theMap.insert(theEle,value_type(tag,newComponent));
         transmitIDs= true; //Component added.
-		      
-	// check if sucessfully added 
-	theEle = theMap.find(tag);
-	if(theEle == theMap.end())
-         {
-	   std::cerr << getClassName() << "::" << __FUNCTION__
-		     << "; map STL failed to add object with tag : " << 
-	     newComponent->getTag() << "\n";
-	   return false;
-	 }
       }
     // if ele already there map cannot add even if allowMultiple is true
     // as the map template does not allow multiple entries wih the same tag
@@ -48,7 +48,13 @@ const int XC::TaggedObjectStorage::posDbTag3;
 //! @param owr: object owner (this object is somewhat contained by).
 //! @param tag: name for this container.
 XC::TaggedObjectStorage::TaggedObjectStorage(CommandEntity *owr,const std::string &contrName)
-  : CommandEntity(owr), MovableObject(0), containerName(contrName), transmitIDs(true) {}
+  : CommandEntity(owr), MovableObject(0), containerName(contrName), transmitIDs(true), bufferedComm(false), bufferDbTag(0) {}
+
+//! @brief If the argument is true the objects are serialized
+//! in a single buffer that is sent in one operation (instead of
+//! sending the data of each object separately).
+void XC::TaggedObjectStorage::setBufferedComm(const bool &b)
+  { bufferedComm= b; }
 
 //! @brief Copy the components from the container into this one.
 void XC::TaggedObjectStorage::copy(const TaggedObjectStorage &other)
@@ -137,7 +143,7 @@ const XC::ID &XC::TaggedObjectStorage::getObjTags(void) const
 //! of the class members.
 XC::DbTagData &XC::TaggedObjectStorage::getDbTagData(void) const
   {
-    static DbTagData retval(5);
+    static DbTagData retval(7);
     return retval;
   }
 
@@ -258,19 +264,31 @@ int XC::TaggedObjectStorage::sendData(CommParameters &cp)
     int res= 0;
     if(sz>0)
       {
-        res+= sendObjects(cp);
+        if(bufferedComm)
+          {
+            if(bufferDbTag==0) // the same tag on every send.
+              bufferDbTag= cp.getDbTag();
+            CommBuffer buf;
+            cp.openBuffer(buf);
+            res+= sendObjects(cp);
+            res+= cp.sendBuffer(buf,bufferDbTag);
+          }
+        else
+          res+= sendObjects(cp);
         if(transmitIDs)
           {
             res+= sendObjectTags(cp);
             transmitIDs= false; //Ya se han enviado.
           }
       }
+    setDbTagDataPos(5,(bufferedComm && (sz>0)) ? 1 : 0);
+    setDbTagDataPos(6,bufferDbTag);
     return res;
   }
 
 int XC::TaggedObjectStorage::sendSelf(CommParameters &cp)
   {
-    inicComm(5);
+    inicComm(7);
     int res= sendData(cp);
 
     const int dbTag= getDbTag(cp);
@@ -63,6 +63,7 @@
 #include "xc_utils/src/kernel/CommandEntity.h"
 #include "utility/matrix/ID.h"
 #include "utility/actor/actor/MovableObject.h"
+#include "utility/actor/actor/CommBuffer.h"
 
 namespace XC {
 class TaggedObject;
@@ -101,6 +102,8 @@ class TaggedObjectStorage: public CommandEntity, public MovableObject
   protected:
     std::string containerName; //!< Container name.
     bool transmitIDs;
+    bool bufferedComm; //!< if true the objects are sent in a single buffer (see CommBuffer).
+    int bufferDbTag; //!< database tag of the buffer (allocated on first send).
     DbTagData &getDbTagData(void) const;
 
     template <class T>
@@ -151,6 +154,9 @@ class TaggedObjectStorage: public CommandEntity, public MovableObject
     const ID &getObjTags(void) const;
     bool getTransmitIDsFlag(void) const
       { return transmitIDs; }
+    void setBufferedComm(const bool &);
+    bool getBufferedComm(void) const
+      { return bufferedComm; }
     virtual int sendData(CommParameters &);
     template <class T>
     int recibe(int dbTag,const CommParameters &,T *(FEM_ObjectBroker::*p)(int));
@@ -216,7 +222,18 @@ int TaggedObjectStorage::receiveData(const CommParameters &cp,T *(FEM_ObjectBrok
             recibeObjectTags(sz,cp);
             res+= this->createObjects(cp,ptrFunc);
           }
-        res+= this->receiveObjects(cp);
+        if(getDbTagDataPos(5)!=0) // objects sent in a single buffer.
+          {
+            CommBuffer buf;
+            res+= cp.receiveBuffer(buf,getDbTagDataPos(6));
+            if(res>=0)
+              {
+                res+= this->receiveObjects(cp);
+                cp.closeBuffer(buf);
+              }
+          }
+        else
+          res+= this->receiveObjects(cp);
       }
     return res;
   }
@@ -225,7 +242,7 @@ int TaggedObjectStorage::receiveData(const CommParameters &cp,T *(FEM_ObjectBrok
 template <class T>
 int TaggedObjectStorage::recibe(int dbTag,const CommParameters &cp,T *(FEM_ObjectBroker::*ptrFunc)(int))
   {
-    inicComm(5);
+    inicComm(7);
     setDbTag(dbTag);
     int res= cp.receiveIdData(getDbTagData(),getDbTag());
     if(res<0)
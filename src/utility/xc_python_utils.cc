@@ -32,6 +32,9 @@
 #include "utility/matrix/Vector.h"
 #include "utility/matrix/Matrix.h"
 #include "xc_utils/src/kernel/python_utils.h"
+#include <boost/python/object.hpp>
+#include <cstring>
+#include <type_traits>
 
 
 boost::python::list XC::xc_id_to_py_list(const XC::ID &id)
@@ -117,3 +120,200 @@ m_double XC::m_double_from_py_object(const boost::python::object &o)
       }
     return retval;
   }
+
+//! @brief Return the value of type T stored in the address
+//! being passed as parameter with the format of the buffer.
+template <class T>
+bool read_py_buffer_item(const char *ptr,const char &fmt,T &value)
+  {
+    bool retval= true;
+    switch(fmt)
+      {
+      case 'd':
+        value= static_cast<T>(*reinterpret_cast<const double *>(ptr));
+        break;
+      case 'f':
+        value= static_cast<T>(*reinterpret_cast<const float *>(ptr));
+        break;
+      case 'b':
+        value= static_cast<T>(*reinterpret_cast<const signed char *>(ptr));
+        break;
+      case 'B':
+        value= static_cast<T>(*reinterpret_cast<const unsigned char *>(ptr));
+        break;
+      case 'h':
+        value= static_cast<T>(*reinterpret_cast<const short *>(ptr));
+        break;
+      case 'H':
+        value= static_cast<T>(*reinterpret_cast<const unsigned short *>(ptr));
+        break;
+      case 'i':
+        value= static_cast<T>(*reinterpret_cast<const int *>(ptr));
+        break;
+      case 'I':
+        value= static_cast<T>(*reinterpret_cast<const unsigned int *>(ptr));
+        break;
+      case 'l':
+        value= static_cast<T>(*reinterpret_cast<const long *>(ptr));
+        break;
+      case 'L':
+        value= static_cast<T>(*reinterpret_cast<const unsigned long *>(ptr));
+        break;
+      case 'q':
+        value= static_cast<T>(*reinterpret_cast<const long long *>(ptr));
+        break;
+      case 'Q':
+        value= static_cast<T>(*reinterpret_cast<const unsigned long long *>(ptr));
+        break;
+      default:
+        retval= false;
+      }
+    return retval;
+  }
+
+//! @brief Return true if the buffer format corresponds to an integer type.
+inline bool is_py_integer_format(const char &fmt)
+  { return (strchr("bBhHiIlLqQ",fmt)!=nullptr); }
+
+//! @brief Return false if an integer value is expected and the
+//! item is a floating point number (boost::python would truncate it
+//! silently).
+template <class T>
+inline bool check_py_item_type(const boost::python::object &item)
+  { return !(std::is_integral<T>::value && PyFloat_Check(item.ptr())); }
+
+//! @brief Copy the contents of the one or two-dimensional array
+//! being passed as parameter (NumPy array or any object supporting the
+//! buffer protocol or, otherwise, a sequence of sequences) in the
+//! vector (row-major order).
+//!
+//! @param o: python object.
+//! @param data: vector to fill.
+//! @param nRows: number of rows of the array.
+//! @param nCols: number of columns of the array (1 for one-dimensional arrays).
+template <class T>
+bool vector_from_py_array(const boost::python::object &o,std::vector<T> &data,size_t &nRows,size_t &nCols)
+  {
+    bool retval= false;
+    nRows= 0; nCols= 0;
+    data.clear();
+    PyObject *obj= o.ptr();
+    if(PyObject_CheckBuffer(obj))
+      {
+        Py_buffer view;
+        if(PyObject_GetBuffer(obj,&view,PyBUF_RECORDS_RO)==0)
+          {
+            const char *format= (view.format ? view.format : "B");
+            if((*format=='@') || (*format=='=') || (*format=='<') || (*format=='!'))
+              format++;
+            if((view.ndim<1) || (view.ndim>2) || (strlen(format)!=1))
+              std::cerr << __FUNCTION__
+                        << "; one or two-dimensional array of numbers expected." << std::endl;
+            else if(std::is_integral<T>::value && !is_py_integer_format(*format))
+              std::cerr << __FUNCTION__
+                        << "; array of integers expected, got data type: '"
+                        << view.format << "'." << std::endl;
+            else
+              {
+                nRows= view.shape[0];
+                nCols= (view.ndim==2 ? view.shape[1] : 1);
+                const Py_ssize_t rowStride= view.strides[0];
+                const Py_ssize_t colStride= (view.ndim==2 ? view.strides[1] : 0);
+                data.resize(nRows*nCols);
+                retval= true;
+                const char *buf= static_cast<const char *>(view.buf);
+                for(size_t i= 0;(i<nRows) && retval;i++)
+                  for(size_t j= 0;(j<nCols) && retval;j++)
+                    retval= read_py_buffer_item(buf+i*rowStride+j*colStride,*format,data[i*nCols+j]);
+                if(!retval)
+                  {
+                    std::cerr << __FUNCTION__
+                              << "; unsupported array data type: '"
+                              << view.format << "'." << std::endl;
+                    data.clear();
+                    nRows= 0; nCols= 0;
+                  }
+              }
+            PyBuffer_Release(&view);
+          }
+        else
+          PyErr_Clear();
+      }
+    else //sequence of sequences.
+      {
+        nRows= boost::python::len(o);
+        retval= true;
+        for(size_t i= 0;i<nRows;i++)
+          {
+            boost::python::object row= o[i];
+            boost::python::extract<T> x(row);
+            std::vector<T> values;
+            if(x.check())
+              {
+                retval= check_py_item_type<T>(row);
+                if(retval)
+                  values.push_back(x());
+              }
+            else
+              for(size_t j= 0, sz= boost::python::len(row);(j<sz) && retval;j++)
+                {
+                  boost::python::object item= row[j];
+                  retval= check_py_item_type<T>(item);
+                  if(retval)
+                    values.push_back(boost::python::extract<T>(item));
+                }
+            if(!retval)
+              {
+                std::cerr << __FUNCTION__
+                          << "; integer values expected." << std::endl;
+                break;
+              }
+            if(i==0)
+              {
+                nCols= values.size();
+                data.reserve(nRows*nCols);
+              }
+            else if(values.size()!=nCols)
+              {
+                std::cerr << __FUNCTION__
+                          << "; all the rows must have the same number of values."
+                          << std::endl;
+                retval= false;
+                break;
+              }
+            data.insert(data.end(),values.begin(),values.end());
+          }
+        if(!retval)
+          {
+            data.clear();
+            nRows= 0; nCols= 0;
+          }
+      }
+    return retval;
+  }
+
+//! @brief Copy the contents of the array (i.e. NumPy array of shape
+//! (nRows,nCols)) in the vector.
+bool XC::vector_double_from_py_array(const boost::python::object &o,std::vector<double> &data,size_t &nRows,size_t &nCols)
+  { return vector_from_py_array(o,data,nRows,nCols); }
+
+//! @brief Copy the contents of the array (i.e. NumPy array of shape
+//! (nRows,nCols)) in the vector.
+bool XC::vector_int_from_py_array(const boost::python::object &o,std::vector<int> &data,size_t &nRows,size_t &nCols)
+  { return vector_from_py_array(o,data,nRows,nCols); }
+
+//! @brief Return a read-only memoryview of the array being passed as
+//! parameter (no copy is made, so the view is valid only while
+//! the array exists). From Python the values can be read
+//! with numpy.frombuffer(view, dtype= numpy.float64).
+//!
+//! @param ptr: pointer to the first value.
+//! @param sz: number of values.
+boost::python::object XC::py_memoryview_from_doubles(const double *ptr,const size_t &sz)
+  {
+    static double empty= 0.0;
+    Py_buffer view;
+    void *buf= const_cast<double *>(sz>0 ? ptr : &empty);
+    PyBuffer_FillInfo(&view,nullptr,buf,sz*sizeof(double),1,PyBUF_SIMPLE);
+    return boost::python::object(boost::python::handle<>(PyMemoryView_FromBuffer(&view)));
+  }
@@ -36,6 +36,9 @@ boost::python::list xc_id_to_py_list(const XC::ID &);
 std::vector<double> vector_double_from_py_object(const boost::python::object &);
 std::vector<int> vector_int_from_py_object(const boost::python::object &);
 m_double m_double_from_py_object(const boost::python::object &);
+bool vector_double_from_py_array(const boost::python::object &,std::vector<double> &,size_t &,size_t &);
+bool vector_int_from_py_array(const boost::python::object &,std::vector<int> &,size_t &,size_t &);
+boost::python::object py_memoryview_from_doubles(const double *,const size_t &);
 
 } // end of XC namespace
 #endif
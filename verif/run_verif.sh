@@ -151,6 +151,8 @@ python tests/elements/shell/test_corot_shell_mitc4_02.py
 python tests/elements/shell/test_corot_shell_mitc4_03.py
 python tests/elements/shell/test_corot_shell_mitc4_04.py
 python tests/elements/shell/test_shell_mitc4_natural_coordinates_01.py
+python tests/elements/shell/shared_matrices_test_01.py
+python tests/elements/shell/shell_kernel_test_01.py
 python tests/elements/shell/test_transformInternalForces.py
 
 echo "$BLEU" "  Solid elements tests." "$NORMAL"
@@ -169,6 +171,18 @@ python tests/elements/kill_elements_02.py
 
 echo "$BLEU" "Solver tests." "$NORMAL"
 python tests/solution/superlu_solver_test_01.py
+python tests/solution/pcg_solver_test_01.py
+python tests/solution/pcg_solver_test_02.py
+python tests/solution/tangent_cache_test_01.py
+python tests/solution/tangent_cache_test_02.py
+python tests/solution/subdomain_threads_test_01.py
+python tests/solution/element_timing_test_01.py
+python tests/solution/graph_partitioner_test_01.py
+python tests/solution/nodal_state_store_test_01.py
+python tests/solution/nodal_state_store_test_02.py
+python tests/solution/adaptive_newton_test_01.py
+python tests/solution/adaptive_newton_test_02.py
+python tests/solution/variable_time_step_test_01.py
 
 #Constraint handlers tests.
 echo "$BLEU" "  Constraint handler tests." "$NORMAL"
@@ -176,7 +190,10 @@ python tests/solution/constraint_handler/plain_handler_test_01.py
 python tests/solution/constraint_handler/transformation_handler_test_01.py
 python tests/solution/constraint_handler/transformation_handler_test_02.py
 python tests/solution/constraint_handler/transformation_handler_test_03.py
+python tests/solution/constraint_handler/transformation_handler_test_04.py
+python tests/solution/constraint_handler/transformation_handler_test_05.py
 python tests/solution/constraint_handler/lagrange_handler_test_01.py
+python tests/solution/constraint_handler/penalty_handler_test_01.py
 
 #Eigenvalues.
 echo "$BLEU" "  Eigenvalue solution tests." "$NORMAL"
@@ -248,6 +265,9 @@ python tests/preprocessor/test_surface_meshing_02.py
 python tests/preprocessor/test_surface_meshing_03.py
 python tests/preprocessor/test_surface_meshing_04.py
 python tests/preprocessor/test_surface_meshing_05.py
+python tests/preprocessor/test_surface_meshing_06.py
+python tests/preprocessor/object_arena_test_01.py
+python tests/preprocessor/bulk_model_test_01.py
 echo "$BLEU" "  Sets handling tests." "$NORMAL"
 python tests/preprocessor/sets/test_exist_set.py
 python tests/preprocessor/sets/mueve_set.py
@@ -331,6 +351,9 @@ python tests/materials/uniaxial/test_elasticpp_material_01.py
 python tests/materials/uniaxial/test_steel01.py
 python tests/materials/uniaxial/test_steel02.py
 python tests/materials/uniaxial/test_steel02_prestressing.py
+python tests/materials/uniaxial/material_state_store_test_01.py
+python tests/materials/uniaxial/material_state_store_test_02.py
+python tests/materials/uniaxial/material_state_store_test_03.py
 python tests/materials/uniaxial/test_concrete01.py
 python tests/materials/uniaxial/test_concrete02_01.py
 python tests/materials/uniaxial/test_concrete02_02.py
@@ -362,6 +385,7 @@ python tests/materials/uniaxial/py_simple1_test.py
 #nD Materials
 echo "$BLEU" "  nD materials tests." "$NORMAL"
 python tests/materials/test_elastic_isotropic_plane_strain_2d_01.py
+python tests/materials/test_elastic_isotropic_plane_strain_2d_02.py
 python tests/materials/test_elastic_isotropic_plane_stress_2d_01.py
 python tests/materials/test_elastic_isotropic_3d_01.py
 
@@ -485,6 +509,8 @@ python tests/materials/sia263/test_coefs_fatique_SIA263.py
 
 echo "$BLEU" "  Plate and membrane materials." "$NORMAL"
 python tests/materials/test_material_elastic_membrane_plate_section_01.py
+python tests/materials/test_membrane_plate_fiber_section_01.py
+python tests/materials/test_membrane_plate_fiber_section_02.py
 python tests/materials/test_material_elastic_plate_section_01.py
 python tests/materials/test_inercia_torsion_cajon.py
 
@@ -532,13 +558,26 @@ python tests/database/test_database_12.py
 python tests/database/test_database_13.py
 python tests/database/test_database_14.py
 python tests/database/test_database_15.py
+python tests/database/test_database_16.py
 python tests/database/sqlite_test_01.py
 python tests/database/sqlite_test_02.py
 python tests/database/sqlite_test_03.py
 python tests/database/readln_test_01.py
 
+echo "$BLEU" "Reliability tests." "$NORMAL"
+python tests/reliability/random_number_generator_test_01.py
+python tests/reliability/ddm_gradient_test_01.py
+python tests/reliability/ddm_gradient_test_02.py
+
 echo "$BLEU" "Verifiyng misc. utilities." "$NORMAL"
 python tests/utility/rcond.py
+python tests/utility/vtu_recorder_test_01.py
+python tests/utility/vtu_recorder_test_02.py
+python tests/utility/binary_handler_test_01.py
+python tests/utility/async_recorder_test_01.py
+python tests/utility/async_recorder_test_02.py
+python tests/utility/shared_memory_channel_test_01.py
+python tests/utility/channel_comm_test_01.py
 
 echo "$BLEU" "Verifiying routines for rough calculations,..." "$NORMAL"
 python tests/rough_calculations/test_punzo01.py
@@ -560,6 +599,7 @@ python tests/rough_calculations/masonryBridgeVerif_test01_minim.py
 #Postprocess tests
 echo "$BLEU" "Verifiying routines for post processing." "$NORMAL"
 python tests/postprocess/test_export_shell_internal_forces.py
+python tests/postprocess/test_results_store_01.py
 echo "$BLEU" "  limit state checking." "$NORMAL"
 python tests/postprocess/limit_state_checking/test_shell_normal_stresses_uls_checking.py
 python tests/postprocess/limit_state_checking/test_shear_uls_checking.py
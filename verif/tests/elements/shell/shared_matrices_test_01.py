@@ -0,0 +1,141 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Inclined square plate with a point load at its center (example 2-005
+# of the SAP 2000 verification manual rotated around the x axis) meshed
+# with identical ShellMITC4 elements that share their stiffness matrix
+# in local axes (useSharedElementMatrices). Checks that:
+#   - the first element computes the matrix and the other ones find it
+#     in the cache (one matrix, nElems-1 hits).
+#   - the shared matrix rotated to global axes equals the stiffness
+#     computed by each element when the matrices are not shared.
+#   - clearing the cache makes the elements compute it again.
+#   - the deflection under the load matches the reference value.
+
+from __future__ import division
+import math
+import xc_base
+import geom
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+NumDivI= 8
+NumDivJ= 8
+CooMax= 2
+E= 17472000 # Elastic modulus en lb/in2
+nu= 0.3 # Poisson's ratio
+thickness= 0.0001 # Cross section depth expressed in inches.
+ptLoad= 0.0004 # Punctual load in lb.
+angle= math.radians(30) # Slope of the plate.
+normal= [0.0,-math.sin(angle),math.cos(angle)] # Plate normal.
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+mesh= feProblem.getDomain.getMesh
+mesh.useSharedElementMatrices= True
+nodes.newSeedNode()
+
+# Materials definition
+memb1= typical_materials.defElasticMembranePlateSection(preprocessor, "memb1",E,nu,0.0,thickness)
+
+seedElemHandler= preprocessor.getElementHandler.seedElemHandler
+seedElemHandler.defaultMaterial= "memb1"
+seedElemHandler.defaultTag= 1
+elem= seedElemHandler.newElement("ShellMITC4",xc.ID([0,0,0,0]))
+
+y= CooMax*math.cos(angle)
+z= CooMax*math.sin(angle)
+points= preprocessor.getMultiBlockTopology.getPoints
+pt= points.newPntIDPos3d(1,geom.Pos3d(0.0,0.0,0.0))
+pt= points.newPntIDPos3d(2,geom.Pos3d(CooMax,0.0,0.0))
+pt= points.newPntIDPos3d(3,geom.Pos3d(CooMax,y,z))
+pt= points.newPntIDPos3d(4,geom.Pos3d(0.0,y,z))
+surfaces= preprocessor.getMultiBlockTopology.getSurfaces
+surfaces.defaultTag= 1
+s= surfaces.newQuadSurfacePts(1,2,3,4)
+s.nDivI= NumDivI
+s.nDivJ= NumDivJ
+
+f1= preprocessor.getSets.getSet("f1")
+f1.genMesh(xc.meshDir.I)
+nElems= s.getNumElements
+
+def getStiffnesses():
+  ''' Return the values of the tangent stiffness of each element.'''
+  retval= list()
+  for e in f1.getElements:
+    K= e.getTangentStiff()
+    retval.append([K(i,j) for i in range(0,24) for j in range(0,24)])
+  return retval
+
+# Stiffness from the shared matrix.
+numShared0= mesh.getNumSharedElementMatrices # nothing computed yet.
+KShared= getStiffnesses()
+numShared1= mesh.getNumSharedElementMatrices
+numHits1= mesh.getNumSharedElementMatricesHits
+
+# Stiffness computed by each element.
+mesh.useSharedElementMatrices= False
+KElem= getStiffnesses()
+kMax= max(max(abs(x) for x in K) for K in KElem)
+errK= max(max(abs(KShared[k][i]-KElem[k][i]) for i in range(0,len(KElem[k]))) for k in range(0,len(KElem)))/kMax
+
+# Once cleared, the elements compute the matrix again.
+mesh.useSharedElementMatrices= True
+getStiffnesses()
+mesh.clearSharedElementMatrices()
+numShared2= mesh.getNumSharedElementMatrices
+
+# Constraints
+sides= s.getEdges
+for l in sides:
+  for i in l.getEdge.getNodeTags():
+    modelSpace.fixNode000_FFF(i)
+
+# Loads definition
+loadHandler= preprocessor.getLoadHandler
+lPatterns= loadHandler.getLoadPatterns
+ts= lPatterns.newTimeSeries("constant_ts","ts")
+lPatterns.currentTimeSeries= "ts"
+lp0= lPatterns.newLoadPattern("default","0")
+node= s.getNodeIJK(1,NumDivI//2+1,NumDivJ//2+1)
+lp0.newNodalLoad(node.tag,xc.Vector([-ptLoad*normal[0],-ptLoad*normal[1],-ptLoad*normal[2],0,0,0]))
+lPatterns.addToDomain("0")
+
+# Solution procedure
+analisis= predefined_solutions.simple_static_linear(feProblem)
+result= analisis.analyze(1)
+numShared3= mesh.getNumSharedElementMatrices
+
+disp= node.getDisp
+UN= disp[0]*normal[0]+disp[1]*normal[1]+disp[2]*normal[2]
+UNTeor= -11.6
+ratio1= abs((UN-UNTeor)/UNTeor)
+
+'''
+print "UN= ",UN
+print "ratio1= ",ratio1
+print "errK= ",errK
+print "numShared0= ",numShared0
+print "numShared1= ",numShared1
+print "numHits1= ",numHits1
+print "numShared2= ",numShared2
+print "numShared3= ",numShared3
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (result==0) & (ratio1<6e-3) & (errK<1e-12) & (nElems==64) & (numShared0==0) & (numShared1==1) & (numHits1==nElems-1) & (numShared2==0) & (numShared3==1):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,158 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Residual and stiffness of a ShellMITC4 and a ShellNL element under
+# constant membrane strain and constant curvature states. The reference
+# values are the consistent nodal forces of the constant stress
+# resultants (both elements must pass these patch tests exactly):
+#   - membrane state (u= e*x): n11= E*h/(1-nu^2)*e, n22= nu*n11.
+#   - bending state (w= k*x^2/2, thetaY= -k*x): m11= D*k, m22= nu*m11.
+# Checks also that the stiffness matrix is symmetric, that K*u equals
+# the residual and that the rigid body modes don't produce forces.
+
+from __future__ import division
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 2.1e6 # Young modulus.
+nu= 0.3 # Poisson's ratio.
+h= 0.1 # Thickness.
+a= 2.0 # Element length (x axis).
+b= 1.0 # Element width (y axis).
+e= 1e-4 # Membrane strain.
+k= 1e-3 # Curvature.
+
+n11= E*h/(1-nu**2)*e
+n22= nu*n11
+D= E*h**3/(12*(1-nu**2))
+m11= D*k
+m22= nu*m11
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+
+memb1= typical_materials.defElasticMembranePlateSection(preprocessor, "memb1",E,nu,0.0,h)
+elements= preprocessor.getElementHandler
+elements.defaultMaterial= "memb1"
+
+# ShellMITC4: corners counterclockwise.
+mitc4Pos= [(0,0),(a,0),(a,b),(0,b)]
+mitc4Nodes= list()
+for p in mitc4Pos:
+  mitc4Nodes.append(nodes.newNodeXYZ(p[0],p[1],0.0))
+mitc4= elements.newElement("ShellMITC4",xc.ID([n.tag for n in mitc4Nodes]))
+
+# ShellNL: corners, midside nodes and center node.
+shellNLPos= mitc4Pos+[(a/2,0),(a,b/2),(a/2,b),(0,b/2),(a/2,b/2)]
+shellNLNodes= list()
+for p in shellNLPos:
+  shellNLNodes.append(nodes.newNodeXYZ(p[0],p[1],0.0))
+shellNL= elements.newElement("ShellNL",xc.ID([n.tag for n in shellNLNodes]))
+
+def edgeWeight(t, length, numNodesPerEdge):
+  ''' Integral along an edge of the shape function of the node at t
+      divided by the edge length.'''
+  if(numNodesPerEdge==2):
+    return 0.5
+  if(abs(t)<1e-12 or abs(t-length)<1e-12):
+    return 1/6
+  return 4/6
+
+def intDerivs(pos, numNodesPerEdge):
+  ''' Return the integral over the element of the x and y derivatives
+      of the shape function of each node.'''
+  retval= list()
+  for p in pos:
+    intNx= 0.0
+    if(abs(p[0]-a)<1e-12):
+      intNx= b*edgeWeight(p[1],b,numNodesPerEdge)
+    elif(abs(p[0])<1e-12):
+      intNx= -b*edgeWeight(p[1],b,numNodesPerEdge)
+    intNy= 0.0
+    if(abs(p[1]-b)<1e-12):
+      intNy= a*edgeWeight(p[0],a,numNodesPerEdge)
+    elif(abs(p[1])<1e-12):
+      intNy= -a*edgeWeight(p[0],a,numNodesPerEdge)
+    retval.append((intNx,intNy))
+  return retval
+
+def membraneDisp(x,y):
+  return [e*x,0,0,0,0,0]
+def membraneResid(intNx,intNy):
+  return [n11*intNx,n22*intNy,0,0,0,0]
+def bendingDisp(x,y):
+  return [0,0,k*x**2/2,0,-k*x,0]
+def bendingResid(intNx,intNy):
+  return [0,0,0,m22*intNy,-m11*intNx,0]
+
+theta= 1e-3 # rigid body rotation.
+rigidModes= [lambda x,y: [0,0,1e-3,0,0,0], # z translation.
+             lambda x,y: [-theta*y,theta*x,0,0,0,theta], # rotation around z.
+             lambda x,y: [0,0,theta*y,theta,0,0]] # rotation around x.
+
+def setDisp(elemNodes, dispFunction):
+  ''' Impose the displacement field on the nodes and return
+      the vector of nodal displacements of the element.'''
+  retval= list()
+  for n in elemNodes:
+    p= n.getInitialPos3d
+    u= dispFunction(p.x,p.y)
+    n.setTrialDisp(xc.Vector(u))
+    retval.extend(u)
+  return retval
+
+def prod(K, u):
+  return [sum(K(i,j)*u[j] for j in range(0,len(u))) for i in range(0,len(u))]
+
+def relErr(v, vRef, scale):
+  return max(abs(v[i]-vRef[i]) for i in range(0,len(v)))/scale
+
+def check(elem, elemNodes, pos, numNodesPerEdge):
+  ''' Return the maximum relative error of the patch tests.'''
+  derivs= intDerivs(pos, numNodesPerEdge)
+  err= 0.0
+  for dispFunction, residFunction, scale in [(membraneDisp, membraneResid, n11*b),(bendingDisp, bendingResid, m11*b)]:
+    u= setDisp(elemNodes, dispFunction)
+    R= elem.getResistingForce()
+    R= [R[i] for i in range(0,len(u))]
+    RRef= list()
+    for d in derivs:
+      RRef.extend(residFunction(d[0],d[1]))
+    K= elem.getTangentStiff()
+    err= max(err,relErr(R,RRef,scale),relErr(prod(K,u),RRef,scale))
+  # Symmetry and rigid body modes.
+  n= len(u)
+  kMax= max(abs(K(i,i)) for i in range(0,n))
+  err= max(err,max(abs(K(i,j)-K(j,i)) for i in range(0,n) for j in range(0,n))/kMax)
+  for dispFunction in rigidModes:
+    u= setDisp(elemNodes, dispFunction)
+    uMax= max(abs(x) for x in u)
+    err= max(err,max(abs(x) for x in prod(K,u))/(kMax*uMax))
+  setDisp(elemNodes, lambda x,y: [0,0,0,0,0,0])
+  return err
+
+errMITC4= check(mitc4, mitc4Nodes, mitc4Pos, 2)
+errShellNL= check(shellNL, shellNLNodes, shellNLPos, 3)
+
+'''
+print "errMITC4= ",errMITC4
+print "errShellNL= ",errShellNL
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (errMITC4<1e-9) & (errShellNL<1e-9):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,60 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Stress and tangent of the ElasticIsotropicPlaneStrain2D material under
+# a trial strain. The stress must be computed from the strain stored by
+# the material (the one returned by getStrain).
+
+from __future__ import division
+import xc_base
+import geom
+import xc
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 30e6 # Young modulus (psi)
+nu= 0.3 # Poisson's ratio
+rho= 0.0 # Density
+eps= [1e-4,-2e-4,3e-4] # Trial strain (eps_xx, eps_yy, gamma_xy).
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+elast2d= typical_materials.defElasticIsotropicPlaneStrain(preprocessor, "elast2d",E,nu,rho)
+elast2d.setTrialStrain(xc.Vector(eps))
+strain= elast2d.getStrain()
+strain= [strain[i] for i in range(0,3)]
+stress= elast2d.getStress()
+stress= [stress[i] for i in range(0,3)]
+D= elast2d.getTangent()
+D= [[D(i,j) for j in range(0,3)] for i in range(0,3)]
+
+# Closed-form values.
+mu= E/(2*(1+nu))
+lam= E*nu/((1+nu)*(1-2*nu))
+DTeor= [[lam+2*mu, lam, 0.0], [lam, lam+2*mu, 0.0], [0.0, 0.0, mu]]
+stressTeor= [sum(DTeor[i][j]*eps[j] for j in range(0,3)) for i in range(0,3)]
+
+errStrain= max(abs(strain[i]-eps[i]) for i in range(0,3))/max(abs(x) for x in eps)
+errStress= max(abs(stress[i]-stressTeor[i]) for i in range(0,3))/max(abs(x) for x in stressTeor)
+errTangent= max(abs(D[i][j]-DTeor[i][j]) for i in range(0,3) for j in range(0,3))/(lam+2*mu)
+
+'''
+print "strain= ",strain
+print "stress= ",stress
+print "stressTeor= ",stressTeor
+print "errStrain= ",errStrain
+print "errStress= ",errStress
+print "errTangent= ",errTangent
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (errStrain<1e-15) & (errStress<1e-12) & (errTangent<1e-12):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
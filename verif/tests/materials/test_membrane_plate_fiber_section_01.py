@@ -0,0 +1,79 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Tangent stiffness of a membrane plate fiber section made of J2
+# plasticity fibers. The section is stretched and bent so only the
+# fibers on one face yield and the membrane-bending coupling terms don't
+# vanish. Checks that:
+#   - the coupling terms of the tangent satisfy T(i,j)= -T(j,i) (the
+#     strain of a fiber is e-z*k and the moments are the integral of
+#     z*sigma), so the (0,4) term can't be zero while (4,0) isn't.
+#   - the column of the tangent that corresponds to the curvature k22
+#     matches the central finite difference of the stress resultant.
+
+from __future__ import division
+import xc_base
+import geom
+import xc
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 210000 # Young modulus (MPa).
+nu= 0.3 # Poisson's ratio.
+fy= 275 # Yield stress (MPa).
+alpha= 0.01 # Strain-hardening ratio.
+h= 0.2 # Thickness (m).
+deformation= [1e-3,0.0,0.0,0.01,0.0,0.0,0.0,0.0] # Membrane strain and curvature.
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+j2= typical_materials.defJ2PlateFibre(preprocessor, "j2",E,nu,fy,alpha)
+section= typical_materials.defMembranePlateFiberSection(preprocessor, "section",h,"j2")
+
+def getResponse(d):
+  ''' Return the stress resultant and the tangent of the section
+      for the deformation being passed as parameter.'''
+  section.sectionDeformation= xc.Vector(d)
+  R= section.getStressResultant()
+  R= [R[i] for i in range(0,8)]
+  T= section.getTangentStiffness()
+  T= [[T(i,j) for j in range(0,8)] for i in range(0,8)]
+  return R, T
+
+R, T= getResponse(deformation)
+
+# Membrane-bending coupling.
+tMax= max(abs(T[i][j]) for i in range(0,3) for j in range(3,6))
+errCoupling= max(abs(T[i][j]+T[j][i]) for i in range(0,3) for j in range(3,6))/tMax
+ratio04= abs(T[0][4])/tMax
+
+# Finite differences.
+delta= 1e-6
+dPlus= list(deformation); dPlus[4]+= delta
+dMinus= list(deformation); dMinus[4]-= delta
+RPlus, TPlus= getResponse(dPlus)
+RMinus, TMinus= getResponse(dMinus)
+column4= [(RPlus[i]-RMinus[i])/(2*delta) for i in range(0,8)]
+errFD= max(abs(column4[i]-T[i][4]) for i in range(0,8))/max(abs(T[i][4]) for i in range(0,8))
+
+'''
+print "R= ",R
+print "T[0]= ",T[0]
+print "T[4]= ",T[4]
+print "errCoupling= ",errCoupling
+print "ratio04= ",ratio04
+print "column4= ",column4
+print "errFD= ",errFD
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (errCoupling<1e-12) & (ratio04>1e-3) & (errFD<1e-4):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
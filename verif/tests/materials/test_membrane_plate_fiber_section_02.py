@@ -0,0 +1,104 @@
+# -*- coding: utf-8 -*-
+# home made test
+# The membrane plate fiber section evaluates its five J2 plasticity
+# fibers with a single batched call. Five stand-alone J2 plate fiber
+# materials are driven, one point at a time, through the same fiber
+# strains along a loading, unloading and reverse loading path. Checks
+# that the stress resultant and the tangent of the section match the
+# ones integrated from the stand-alone materials.
+
+from __future__ import division
+import math
+import xc_base
+import geom
+import xc
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 210000 # Young modulus (MPa).
+nu= 0.3 # Poisson's ratio.
+fy= 275 # Yield stress (MPa).
+alpha= 0.01 # Strain-hardening ratio.
+h= 0.2 # Thickness (m).
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+j2= typical_materials.defJ2PlateFibre(preprocessor, "j2",E,nu,fy,alpha)
+section= typical_materials.defMembranePlateFiberSection(preprocessor, "section",h,"j2")
+fibers= [typical_materials.defJ2PlateFibre(preprocessor, "fiber"+str(i),E,nu,fy,alpha) for i in range(0,5)]
+
+# Integration through the thickness (see MembranePlateFiberSection.cpp).
+sg= [-1, -0.65465367, 0, 0.65465367, 1]
+wg= [0.1, 0.5444444444, 0.7111111111, 0.5444444444, 0.1]
+root56= math.sqrt(5/6)
+
+def integrate(d):
+  ''' Set the fiber strains that correspond to the section deformation
+      d on the stand-alone materials and return the stress resultant
+      and the tangent integrated from their stresses and tangents.'''
+  R= [0.0]*8
+  T= [[0.0]*8 for i in range(0,8)]
+  for i in range(0,5):
+    z= 0.5*h*sg[i]
+    w= 0.5*h*wg[i]
+    # Aeps: fiber strain from section deformation. Asig: the transpose
+    # of Aeps but with +z for the moments.
+    Aeps= [[0.0]*8 for k in range(0,5)]
+    Asig= [[0.0]*5 for k in range(0,8)]
+    for k in range(0,3):
+      Aeps[k][k]= 1.0; Aeps[k][k+3]= -z
+      Asig[k][k]= 1.0; Asig[k+3][k]= z
+    for k in range(3,5):
+      Aeps[k][k+3]= root56
+      Asig[k+3][k]= root56
+    strain= [sum(Aeps[k][j]*d[j] for j in range(0,8)) for k in range(0,5)]
+    fibers[i].setTrialStrain(xc.Vector(strain))
+    s= fibers[i].getStress()
+    s= [s[k] for k in range(0,5)]
+    D= fibers[i].getTangent()
+    D= [[D(k,l) for l in range(0,5)] for k in range(0,5)]
+    for m in range(0,8):
+      R[m]+= w*sum(Asig[m][k]*s[k] for k in range(0,5))
+      for n in range(0,8):
+        T[m][n]+= w*sum(Asig[m][k]*D[k][l]*Aeps[l][n] for k in range(0,5) for l in range(0,5))
+  return R, T
+
+def relErr(a, b):
+  ''' Relative difference between two lists.'''
+  return max(abs(a[i]-b[i]) for i in range(0,len(a)))/max(abs(x) for x in b)
+
+d1= [1e-3,0.5e-3,0.2e-3,0.01,-0.005,0.002,1e-4,-1e-4] # Fibers on one face yield.
+path= [d1, [2*x for x in d1], [0.5*x for x in d1], [-2*x for x in d1]]
+errR= 0.0
+errT= 0.0
+for d in path:
+  section.sectionDeformation= xc.Vector(d)
+  R= section.getStressResultant()
+  R= [R[i] for i in range(0,8)]
+  T= section.getTangentStiffness()
+  T= [T(i,j) for i in range(0,8) for j in range(0,8)]
+  RPoint, TPoint= integrate(d)
+  TPoint= [TPoint[i][j] for i in range(0,8) for j in range(0,8)]
+  errR= max(errR,relErr(R,RPoint))
+  errT= max(errT,relErr(T,TPoint))
+  section.commitState()
+  for f in fibers:
+    f.commitState()
+
+'''
+print "errR= ",errR
+print "errT= ",errT
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (errR<1e-12) & (errT<1e-12):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,117 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Two steel bars (Steel01 and Steel02) loaded beyond the yield point.
+# Checks that keeping the state variables of the materials in the
+# contiguous storage of the mesh (useMaterialStateStore) gives the same
+# results than the default (each material commits its own state).
+
+from __future__ import division
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+L= 1.0 # Bar length (m)
+E= 200e9 # Elastic modulus (Pa)
+fy= 275e6 # Yield stress (Pa)
+b= 0.01 # Strain-hardening ratio.
+A= 1e-4 # Bar area (m2)
+P= 3.0*fy*A # Load (both bars yield)
+
+def solve(useStore):
+  ''' Solve the model and return the displacement of the loaded node
+      and the number of materials in the store.'''
+  feProblem= xc.FEProblem()
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+  nodes.defaultTag= 1 #First node number.
+  nod= nodes.newNodeXY(0.0,0.0)
+  nod= nodes.newNodeXY(L,0.0)
+
+  # Materials definition
+  typical_materials.defSteel01(preprocessor, "steel01",E,fy,b)
+  typical_materials.defSteel02(preprocessor, "steel02",E,fy,b,0.0)
+
+  # Elements definition
+  elements= preprocessor.getElementHandler
+  elements.dimElem= 2 # Dimension of element space
+  elements.defaultTag= 1 #Tag for the next element.
+  elements.defaultMaterial= "steel01"
+  truss= elements.newElement("Truss",xc.ID([1,2]))
+  truss.area= A
+  elements.defaultMaterial= "steel02"
+  truss= elements.newElement("Truss",xc.ID([1,2]))
+  truss.area= A
+
+  # Constraints
+  constraints= preprocessor.getBoundaryCondHandler
+  spc= constraints.newSPConstraint(1,0,0.0)
+  spc= constraints.newSPConstraint(1,1,0.0)
+  spc= constraints.newSPConstraint(2,1,0.0)
+
+  # Loads definition
+  loadHandler= preprocessor.getLoadHandler
+  lPatterns= loadHandler.getLoadPatterns
+  ts= lPatterns.newTimeSeries("linear_ts","ts")
+  lPatterns.currentTimeSeries= "ts"
+  lp0= lPatterns.newLoadPattern("default","0")
+  lp0.newNodalLoad(2,xc.Vector([P,0]))
+  lPatterns.addToDomain("0")
+
+  mesh= feProblem.getDomain.getMesh
+  mesh.useMaterialStateStore= useStore
+
+  # Solution procedure
+  solu= feProblem.getSoluProc
+  solCtrl= solu.getSoluControl
+  solModels= solCtrl.getModelWrapperContainer
+  sm= solModels.newModelWrapper("sm")
+  numberer= sm.newNumberer("default_numberer")
+  numberer.useAlgorithm("simple")
+  cHandler= sm.newConstraintHandler("plain_handler")
+  analysisAggregations= solCtrl.getAnalysisAggregationContainer
+  analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+  solAlgo= analysisAggregation.newSolutionAlgorithm("newton_raphson_soln_algo")
+  convTest= analysisAggregation.newConvergenceTest("norm_unbalance_conv_test")
+  convTest.tol= 1.0e-6
+  convTest.maxNumIter= 20
+  integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+  integ.dLambda1= 0.1
+  soe= analysisAggregation.newSystemOfEqn("band_gen_lin_soe")
+  solver= soe.newSolver("band_gen_lin_lapack_solver")
+  analysis= solu.newAnalysis("static_analysis","analysisAggregation","")
+  result= analysis.analyze(10)
+
+  return result, nodes.getNode(2).getDisp[0], mesh.getNumMaterialsInStateStore
+
+result0, delta0, numInStore0= solve(False)
+result1, delta1, numInStore1= solve(True)
+
+ratio1= abs(delta1-delta0)/abs(delta0)
+# Yielding of the bars.
+ratio2= delta0/(fy/E*L)
+
+'''
+print "delta0= ",delta0
+print "delta1= ",delta1
+print "ratio1= ",ratio1
+print "ratio2= ",ratio2
+print "numInStore0= ",numInStore0
+print "numInStore1= ",numInStore1
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (ratio1<1e-12) & (ratio2>1.5) & (numInStore0==0) & (numInStore1==2) & (result0==0) & (result1==0):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
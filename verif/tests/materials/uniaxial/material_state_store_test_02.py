@@ -0,0 +1,162 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Two Steel01 bars in parallel (only the first one yields) loaded and
+# then unloaded keeping the state of the materials in the contiguous
+# storage of the mesh (useMaterialStateStore). The steps that cross
+# from one branch of the stress-strain curve to another fail (a single
+# iteration is allowed), so the domain is reverted to its last
+# committed state and the step is repeated in two halves.
+# Checks that the reverted state is the committed one and that the
+# displacements under the maximum load and the residual displacement
+# match the closed-form values.
+
+from __future__ import division
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+L= 1.0 # Bar length (m)
+E= 200e9 # Elastic modulus (Pa)
+fy1= 275e6 # Yield stress of the first bar (Pa)
+fy2= 1.5*fy1 # Yield stress of the second bar (Pa)
+b= 0.01 # Strain-hardening ratio.
+A= 1e-4 # Bar area (m2)
+P= 2.3*fy1*A # Load (only the first bar yields)
+
+feProblem= xc.FEProblem()
+feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages about failed steps.
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+nodes.defaultTag= 1 #First node number.
+nod= nodes.newNodeXY(0.0,0.0)
+nod= nodes.newNodeXY(L,0.0)
+
+# Materials definition
+typical_materials.defSteel01(preprocessor, "steel1",E,fy1,b)
+typical_materials.defSteel01(preprocessor, "steel2",E,fy2,b)
+
+# Elements definition
+elements= preprocessor.getElementHandler
+elements.dimElem= 2 # Dimension of element space
+elements.defaultTag= 1 #Tag for the next element.
+elements.defaultMaterial= "steel1"
+truss1= elements.newElement("Truss",xc.ID([1,2]))
+truss1.area= A
+elements.defaultMaterial= "steel2"
+truss2= elements.newElement("Truss",xc.ID([1,2]))
+truss2.area= A
+
+# Constraints
+constraints= preprocessor.getBoundaryCondHandler
+spc= constraints.newSPConstraint(1,0,0.0)
+spc= constraints.newSPConstraint(1,1,0.0)
+spc= constraints.newSPConstraint(2,1,0.0)
+
+# Loads definition
+loadHandler= preprocessor.getLoadHandler
+lPatterns= loadHandler.getLoadPatterns
+ts= lPatterns.newTimeSeries("linear_ts","ts")
+lPatterns.currentTimeSeries= "ts"
+lp0= lPatterns.newLoadPattern("default","0")
+lp0.newNodalLoad(2,xc.Vector([P,0]))
+lPatterns.addToDomain("0")
+
+mesh= feProblem.getDomain.getMesh
+mesh.useMaterialStateStore= True
+
+# Solution procedure
+solu= feProblem.getSoluProc
+solCtrl= solu.getSoluControl
+solModels= solCtrl.getModelWrapperContainer
+sm= solModels.newModelWrapper("sm")
+numberer= sm.newNumberer("default_numberer")
+numberer.useAlgorithm("simple")
+cHandler= sm.newConstraintHandler("plain_handler")
+analysisAggregations= solCtrl.getAnalysisAggregationContainer
+analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+solAlgo= analysisAggregation.newSolutionAlgorithm("newton_raphson_soln_algo")
+convTest= analysisAggregation.newConvergenceTest("norm_unbalance_conv_test")
+convTest.tol= 1.0e-6
+integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+soe= analysisAggregation.newSystemOfEqn("band_gen_lin_soe")
+solver= soe.newSolver("band_gen_lin_lapack_solver")
+analysis= solu.newAnalysis("static_analysis","analysisAggregation","")
+
+node2= nodes.getNode(2)
+def getState():
+  ''' Return the displacement of the loaded node and the strain
+      and stress of the bars.'''
+  retval= [node2.getDisp[0]]
+  for e in [truss1, truss2]:
+    mat= e.getMaterial()
+    retval.extend([mat.getStrain(), mat.getStress()])
+  return retval
+
+def stateError(s0, s1):
+  ''' Return the relative difference between the states.'''
+  scale= [fy1/E*L, fy1/E, fy1, fy1/E, fy1]
+  return max(abs(s1[i]-s0[i])/scale[i] for i in range(0,len(s0)))
+
+numFailures= 0
+revertErr= 0.0
+def advance(dLambda, numSteps):
+  ''' Advance the load factor in numSteps steps. The steps that
+      don't converge in one iteration are repeated in two halves.'''
+  global numFailures, revertErr
+  retval= 0
+  for i in range(0,numSteps):
+    committed= getState()
+    integ.dLambda1= dLambda
+    convTest.maxNumIter= 1
+    result= analysis.analyze(1)
+    if(result!=0):
+      numFailures+= 1
+      revertErr= max(revertErr,stateError(committed,getState()))
+      integ.dLambda1= dLambda/2.0
+      convTest.maxNumIter= 10
+      result= analysis.analyze(2)
+    retval+= abs(result)
+  return retval
+
+result= advance(0.25,4) # loading.
+deltaMax= node2.getDisp[0]
+result+= advance(-0.25,4) # unloading.
+deltaRes= node2.getDisp[0]
+
+# Closed-form values.
+epsMax= (P/A-fy1+b*fy1)/(E*(1+b))
+deltaMaxTeor= epsMax*L
+deltaResTeor= (epsMax-P/(2*E*A))*L
+
+ratio1= abs(deltaMax-deltaMaxTeor)/deltaMaxTeor
+ratio2= abs(deltaRes-deltaResTeor)/deltaResTeor
+numInStore= mesh.getNumMaterialsInStateStore
+
+'''
+print "deltaMax= ",deltaMax
+print "deltaMaxTeor= ",deltaMaxTeor
+print "ratio1= ",ratio1
+print "deltaRes= ",deltaRes
+print "deltaResTeor= ",deltaResTeor
+print "ratio2= ",ratio2
+print "numFailures= ",numFailures
+print "revertErr= ",revertErr
+print "numInStore= ",numInStore
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (result==0) & (ratio1<1e-9) & (ratio2<1e-9) & (numFailures>=2) & (revertErr<1e-12) & (numInStore==2):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,133 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Two concrete bars (Concrete01 and Concrete02) compressed beyond the
+# linear range and then unloaded. Checks that keeping the state
+# variables of the materials in the contiguous storage of the mesh
+# (useMaterialStateStore) gives the same results than the default (each
+# material commits its own state) and that the maximum shortening
+# matches the closed-form value (both materials share the parabolic
+# envelope in compression).
+
+from __future__ import division
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+L= 1.0 # Bar length (m)
+epsc0= -0.002 # Strain at maximum strength.
+fpc= -30e6 # Compressive strength (Pa).
+fpcu= -25e6 # Crushing strength (Pa).
+epscu= -0.0035 # Strain at crushing strength.
+A= 1e-2 # Bar area (m2)
+P= 1.6*fpc*A # Load (each bar reaches 0.8*fpc)
+
+def solve(useStore):
+  ''' Solve the model and return the displacement of the loaded node
+      under the maximum load and after unloading and the number of
+      materials in the store.'''
+  feProblem= xc.FEProblem()
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+  nodes.defaultTag= 1 #First node number.
+  nod= nodes.newNodeXY(0.0,0.0)
+  nod= nodes.newNodeXY(L,0.0)
+
+  # Materials definition
+  typical_materials.defConcrete01(preprocessor, "concrete01",epsc0,fpc,fpcu,epscu)
+  typical_materials.defConcrete02(preprocessor, "concrete02",epsc0,fpc,fpcu,epscu,0.1,3e6,1.5e9)
+
+  # Elements definition
+  elements= preprocessor.getElementHandler
+  elements.dimElem= 2 # Dimension of element space
+  elements.defaultTag= 1 #Tag for the next element.
+  elements.defaultMaterial= "concrete01"
+  truss= elements.newElement("Truss",xc.ID([1,2]))
+  truss.area= A
+  elements.defaultMaterial= "concrete02"
+  truss= elements.newElement("Truss",xc.ID([1,2]))
+  truss.area= A
+
+  # Constraints
+  constraints= preprocessor.getBoundaryCondHandler
+  spc= constraints.newSPConstraint(1,0,0.0)
+  spc= constraints.newSPConstraint(1,1,0.0)
+  spc= constraints.newSPConstraint(2,1,0.0)
+
+  # Loads definition
+  loadHandler= preprocessor.getLoadHandler
+  lPatterns= loadHandler.getLoadPatterns
+  ts= lPatterns.newTimeSeries("linear_ts","ts")
+  lPatterns.currentTimeSeries= "ts"
+  lp0= lPatterns.newLoadPattern("default","0")
+  lp0.newNodalLoad(2,xc.Vector([P,0]))
+  lPatterns.addToDomain("0")
+
+  mesh= feProblem.getDomain.getMesh
+  mesh.useMaterialStateStore= useStore
+
+  # Solution procedure
+  solu= feProblem.getSoluProc
+  solCtrl= solu.getSoluControl
+  solModels= solCtrl.getModelWrapperContainer
+  sm= solModels.newModelWrapper("sm")
+  numberer= sm.newNumberer("default_numberer")
+  numberer.useAlgorithm("simple")
+  cHandler= sm.newConstraintHandler("plain_handler")
+  analysisAggregations= solCtrl.getAnalysisAggregationContainer
+  analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+  solAlgo= analysisAggregation.newSolutionAlgorithm("newton_raphson_soln_algo")
+  convTest= analysisAggregation.newConvergenceTest("norm_unbalance_conv_test")
+  convTest.tol= 1.0e-6
+  convTest.maxNumIter= 20
+  integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+  soe= analysisAggregation.newSystemOfEqn("band_gen_lin_soe")
+  solver= soe.newSolver("band_gen_lin_lapack_solver")
+  analysis= solu.newAnalysis("static_analysis","analysisAggregation","")
+  integ.dLambda1= 0.1
+  result= abs(analysis.analyze(10)) # loading.
+  deltaMax= nodes.getNode(2).getDisp[0]
+  integ.dLambda1= -0.1
+  result+= abs(analysis.analyze(10)) # unloading.
+  deltaRes= nodes.getNode(2).getDisp[0]
+
+  return result, deltaMax, deltaRes, mesh.getNumMaterialsInStateStore
+
+result0, deltaMax0, deltaRes0, numInStore0= solve(False)
+result1, deltaMax1, deltaRes1, numInStore1= solve(True)
+
+# Closed-form value (sigma= fpc*(2*eta-eta**2) with eta= eps/epsc0).
+deltaMaxTeor= epsc0*(1.0-(1.0-P/(2*fpc*A))**0.5)*L
+
+ratio1= abs(deltaMax1-deltaMax0)/abs(deltaMax0)
+ratio2= abs(deltaRes1-deltaRes0)/abs(deltaRes0)
+ratio3= abs(deltaMax0-deltaMaxTeor)/abs(deltaMaxTeor)
+
+'''
+print "deltaMax0= ",deltaMax0
+print "deltaMax1= ",deltaMax1
+print "deltaMaxTeor= ",deltaMaxTeor
+print "deltaRes0= ",deltaRes0
+print "deltaRes1= ",deltaRes1
+print "ratio1= ",ratio1
+print "ratio2= ",ratio2
+print "ratio3= ",ratio3
+print "numInStore0= ",numInStore0
+print "numInStore1= ",numInStore1
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (ratio1<1e-12) & (ratio2<1e-12) & (ratio3<1e-6) & (deltaRes0<0.0) & (numInStore0==0) & (numInStore1==2) & (result0==0) & (result1==0):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,135 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Checks that the internal forces and displacements written by
+# LimitStateData.saveAll in the binary results store are the same
+# than those written in the CSV files, and the queries of the
+# results store reader.
+
+from __future__ import division
+import os
+import csv
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+from actions import combinations as combs
+from postprocess import limit_state_data as lsd
+from postprocess import results_store
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+L= 2.0 # Length of each element.
+F= 10e3 # Load.
+
+feProblem= xc.FEProblem()
+feProblem.errFileName= "/tmp/erase.err" # Don't print errors.
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+nodes.defaultTag= 1 #First node number.
+nod= nodes.newNodeXYZ(0.0,0.0,0.0)
+nod= nodes.newNodeXYZ(L,0.0,0.0)
+nod= nodes.newNodeXYZ(2*L,0.0,0.0)
+
+lin= modelSpace.newLinearCrdTransf("lin",xc.Vector([0,1,0]))
+scc= typical_materials.defElasticSection3d(preprocessor,"scc",A=0.01,E=2.1e11,G=8.1e10,Iz=2e-5,Iy=1e-5,J=3e-5)
+
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "lin"
+elements.defaultMaterial= "scc"
+elements.defaultTag= 1 #Tag for next element.
+beam1= elements.newElement("ElasticBeam3d",xc.ID([1,2]))
+beam2= elements.newElement("ElasticBeam3d",xc.ID([2,3]))
+
+modelSpace.fixNode000_000(1)
+
+# Loads definition
+loadHandler= preprocessor.getLoadHandler
+lPatterns= loadHandler.getLoadPatterns
+ts= lPatterns.newTimeSeries("constant_ts","ts")
+lPatterns.currentTimeSeries= "ts"
+lc1= lPatterns.newLoadPattern("default","lc1")
+lc1.newNodalLoad(3,xc.Vector([0,0,-F,0,0,0]))
+lc2= lPatterns.newLoadPattern("default","lc2")
+lc2.newNodalLoad(3,xc.Vector([F,F,0,F*L,0,0]))
+lc2.newNodalLoad(2,xc.Vector([0,0,F,0,0,0]))
+
+# Load combinations
+combContainer= combs.CombContainer()
+combContainer.ULS.perm.add('ELU01', '1.35*lc1')
+combContainer.ULS.perm.add('ELU02', '1.35*lc1+1.5*lc2')
+totalSet= preprocessor.getSets.getSet('total')
+lsd.LimitStateData.internal_forces_results_directory= '/tmp/'
+limitState= lsd.normalStressesResistance
+limitState.saveAll(feProblem,combContainer,totalSet)
+
+def relErr(a,b):
+  ''' Relative difference (the CSV files are written with a
+      limited number of digits).'''
+  return abs(a-b)/max(abs(a),abs(b),1e-9)
+
+def readCSV(fileName):
+  ''' Return a dictionary with the values of each (combination, tag,
+      section) or (combination, tag) read from the CSV file.'''
+  retval= dict()
+  with open(fileName,'r') as f:
+    listing= csv.reader(f)
+    listing.next()
+    for row in listing:
+      if(len(row)>0):
+        row= [x.strip() for x in row]
+        if(len(row)==9): # internal forces.
+          retval[(row[0],int(row[1]),int(row[2]))]= [float(x) for x in row[3:]]
+        else: # displacements.
+          retval[(row[0],int(row[1]))]= [float(x) for x in row[2:] if len(x)>0]
+  return retval
+
+csvIntForces= readCSV(limitState.getInternalForcesFileName())
+csvDisplacements= readCSV(limitState.getDisplacementsFileName())
+
+reader= results_store.ResultsStoreReader(limitState.getResultsStoreFileName())
+# Internal forces.
+(combNames,combIdx,elemTags,sections,values)= reader.getInternalForces()
+numIntForcesRows= len(elemTags)
+err= 0.0
+for i, tag, sect, v in zip(combIdx,elemTags,sections,values):
+  ref= csvIntForces[(combNames[i],int(tag),int(sect))]
+  for a, b in zip(ref,v):
+    err= max(err,relErr(a,b))
+# Displacements.
+(combNames,combIdx,nodeTags,sections,values)= reader.getDisplacements()
+numDispRows= len(nodeTags)
+for i, tag, v in zip(combIdx,nodeTags,values):
+  ref= csvDisplacements[(combNames[i],int(tag))]
+  for a, b in zip(ref,v):
+    err= max(err,relErr(a,b))
+# Filtered query.
+(combNames,combIdx,elemTags,sections,values)= reader.getInternalForces(elementTags= [beam2.tag],combNames= ['ELU02'])
+filterOk= (combNames==['ELU02']) & (len(elemTags)==2) & (min(elemTags)==beam2.tag) & (max(elemTags)==beam2.tag)
+
+# Without CSV files.
+limitState.saveAll(feProblem,combContainer,totalSet,writeCSV= False)
+noCSV= not os.path.exists(limitState.getInternalForcesFileName())
+noCSV= noCSV & (not os.path.exists(limitState.getDisplacementsFileName()))
+storeOk= os.path.exists(limitState.getResultsStoreFileName())
+
+'''
+print "numIntForcesRows= ", numIntForcesRows
+print "numDispRows= ", numDispRows
+print "err= ", err
+print "filterOk= ", filterOk
+print "noCSV= ", noCSV
+print "storeOk= ", storeOk
+'''
+
+fname= os.path.basename(__file__)
+from miscUtils import LogMessages as lmsg
+if (numIntForcesRows==len(csvIntForces)) & (numDispRows==len(csvDisplacements)) & (err<1e-4) & filterOk & noCSV & storeOk:
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
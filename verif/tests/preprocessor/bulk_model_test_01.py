@@ -0,0 +1,93 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Checks the creation of nodes and elements in bulk from arrays
+# of coordinates and connectivities (the elements are allocated
+# from the memory arena of the mesh, as the ones created one by one).
+
+import numpy
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 2.1e6 # Young modulus.
+L= 10.0 # Length of the chain.
+NumDiv= 100
+
+# Problem type
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+
+# Nodes from a NumPy array.
+nodes.defaultTag= 1 #First node number.
+coords= numpy.zeros((NumDiv+1,2))
+coords[:,0]= numpy.linspace(0.0,L,NumDiv+1)
+nodeTags= nodes.newNodes(coords)
+nextNodeTag= nodes.defaultTag
+
+# Materials
+elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+
+# Elements from a list of lists with explicit tags.
+mesh= preprocessor.getDomain.getMesh
+mesh.useObjectArena= True
+numLiveObjectsBefore= mesh.objectArena.numLiveObjects
+elements= preprocessor.getElementHandler
+elements.defaultMaterial= "elast"
+elements.dimElem= 2
+connectivity= [[nodeTags[i],nodeTags[i+1]] for i in range(0,NumDiv)]
+elemTags= elements.newElements("Truss",connectivity,[1000+i for i in range(0,NumDiv)])
+nextElemTag= elements.defaultTag
+numLiveObjectsAfter= mesh.objectArena.numLiveObjects
+# Wrong connectivity (missing node), nothing must be created.
+wrongTags= elements.newElements("Truss",[[1,NumDiv+1000]])
+# Floating point connectivity or tags (i.e. 1.5 would be truncated to 1),
+# nothing must be created.
+floatConnTags= elements.newElements("Truss",numpy.array([[1.0,2.5]]))
+floatConnListTags= elements.newElements("Truss",[[1,2.5]])
+floatTags= elements.newElements("Truss",numpy.array([[1,2]],dtype= numpy.int32),numpy.array([5000.5]))
+
+total= preprocessor.getSets.getSet("total")
+numNodes= total.getNodes.size
+numElements= total.getElements.size
+numNodesDom= preprocessor.getDomain.getMesh.getNumNodes()
+numElementsDom= preprocessor.getDomain.getMesh.getNumElements()
+
+ok= (len(nodeTags)==NumDiv+1) and (nodeTags[0]==1) and (nextNodeTag==NumDiv+2)
+ok= ok and (len(elemTags)==NumDiv) and (elemTags[NumDiv-1]==1000+NumDiv-1) and (nextElemTag==1000+NumDiv)
+ok= ok and (len(wrongTags)==0)
+ok= ok and (len(floatConnTags)==0) and (len(floatConnListTags)==0) and (len(floatTags)==0)
+ok= ok and (numNodes==NumDiv+1) and (numElements==NumDiv)
+ok= ok and (numNodesDom==NumDiv+1) and (numElementsDom==NumDiv)
+ok= ok and (numLiveObjectsBefore==0) and (numLiveObjectsAfter>=NumDiv)
+lastNode= nodes.getNode(nodeTags[NumDiv])
+ok= ok and (abs(lastNode.getInitialPos3d.x-L)<1e-12)
+lastElem= elements.getElement(elemTags[NumDiv-1])
+extNodes= lastElem.getNodes.getExternalNodes
+ok= ok and (extNodes[0]==nodeTags[NumDiv-1]) and (extNodes[1]==nodeTags[NumDiv])
+
+'''
+print "numNodes= ",numNodes
+print "numElements= ",numElements
+print "nextNodeTag= ",nextNodeTag
+print "nextElemTag= ",nextElemTag
+print "numLiveObjectsBefore= ",numLiveObjectsBefore
+print "numLiveObjectsAfter= ",numLiveObjectsAfter
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if ok:
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,100 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Checks that the elements created by the mesher (and their materials)
+# are allocated from the memory arena of the mesh, that the seed element
+# and the material prototypes are not, so the arena memory is released
+# when the model is deleted, and that each problem has its own arena.
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 30e6 # Young modulus (psi)
+nu= 0.3 # Poisson's ratio
+rho= 0.0 # Density
+NumDivI= 10
+NumDivJ= 10
+
+def buildModel(useObjectArena):
+  ''' Mesh a square with quad elements; return the problem, the
+      number of live objects in the arena before and after meshing
+      and the number of elements.'''
+  feProblem= xc.FEProblem()
+  preprocessor=  feProblem.getPreprocessor
+  mesh= feProblem.getDomain.getMesh
+  mesh.useObjectArena= useObjectArena
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+  nodes.newSeedNode()
+
+  # Materials definition
+  elast2d= typical_materials.defElasticIsotropicPlaneStress(preprocessor, "elast2d",E,nu,rho)
+
+  seedElemHandler= preprocessor.getElementHandler.seedElemHandler
+  seedElemHandler.defaultMaterial= "elast2d"
+  elem= seedElemHandler.newElement("FourNodeQuad",xc.ID([0,0,0,0]))
+
+  points= preprocessor.getMultiBlockTopology.getPoints
+  pt1= points.newPntFromPos3d(geom.Pos3d(0.0,0.0,0.0))
+  pt2= points.newPntFromPos3d(geom.Pos3d(1.0,0.0,0.0))
+  pt3= points.newPntFromPos3d(geom.Pos3d(1.0,1.0,0.0))
+  pt4= points.newPntFromPos3d(geom.Pos3d(0.0,1.0,0.0))
+  surfaces= preprocessor.getMultiBlockTopology.getSurfaces
+  s= surfaces.newQuadSurfacePts(pt1.tag,pt2.tag,pt3.tag,pt4.tag)
+  s.nDivI= NumDivI
+  s.nDivJ= NumDivJ
+
+  numLiveObjectsBefore= mesh.objectArena.numLiveObjects
+  s.genMesh(xc.meshDir.I)
+  numLiveObjectsAfter= mesh.objectArena.numLiveObjects
+  numElem= preprocessor.getSets.getSet("total").getElements.size
+  return feProblem, numLiveObjectsBefore, numLiveObjectsAfter, numElem
+
+# Elements allocated from the arena (one object for each element
+# plus the copies of its materials).
+feProblem1, numLiveObjects0, numLiveObjects1, numElem= buildModel(True)
+arena1= feProblem1.getDomain.getMesh.objectArena
+bytesReserved1= arena1.bytesReserved
+
+# Elements allocated from the heap in other problem (doesn't
+# touch the arena of the first one).
+feProblem2, numLiveObjects2, numLiveObjects3, numElem2= buildModel(False)
+numLiveObjects4= arena1.numLiveObjects
+
+# The seed element and the material prototypes are not in the
+# arena, so its memory is released when the mesh is deleted.
+feProblem1.clearAll()
+numLiveObjects5= arena1.numLiveObjects
+bytesReserved5= arena1.bytesReserved
+
+'''
+print "numLiveObjects0= ", numLiveObjects0
+print "numLiveObjects1= ", numLiveObjects1
+print "numLiveObjects2= ", numLiveObjects2
+print "numLiveObjects3= ", numLiveObjects3
+print "numLiveObjects4= ", numLiveObjects4
+print "numLiveObjects5= ", numLiveObjects5
+print "numElem= ", numElem
+print "bytesReserved1= ", bytesReserved1
+print "bytesReserved5= ", bytesReserved5
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+ok= (numElem==NumDivI*NumDivJ) & (numElem2==numElem)
+ok= ok & (numLiveObjects0==0) & (numLiveObjects1>=5*numElem) & (bytesReserved1>0)
+ok= ok & (numLiveObjects2==0) & (numLiveObjects3==0) & (numLiveObjects4==numLiveObjects1)
+ok= ok & (numLiveObjects5==0) & (bytesReserved5==0)
+if ok:
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
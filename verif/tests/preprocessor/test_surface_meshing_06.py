@@ -0,0 +1,133 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Same model as test_surface_meshing_02.py meshed using several threads.
+# Checks that the tags, positions and connectivity of the nodes and
+# elements are the same than those obtained by the serial meshing.
+from __future__ import division
+import xc_base
+import geom
+import xc
+import math
+import os
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+CooMaxX= 3
+CooMaxY= 1
+E= 30e6 # Young modulus (psi)
+nu= 0.3 # Poisson's ratio
+rho= 0.0 # Density
+#feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+
+def genMesh(numThreads):
+  ''' Mesh the model using the number of threads being passed as
+      parameter and return the node positions and the element
+      connectivity (indexed by tag), the number of nodes in the
+      domain, the first tags and the result of conciliaNDivs.'''
+  # Problem type
+  feProblem= xc.FEProblem()
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+
+  modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+  nodes.newSeedNode()
+
+  elast= typical_materials.defElasticMaterial(preprocessor, "elast",3000)
+  elast2d= typical_materials.defElasticIsotropicPlaneStress(preprocessor, "elast2d",E,nu,rho)
+
+  seedElemHandler= preprocessor.getElementHandler.seedElemHandler
+  seedElemHandler.defaultMaterial= "elast2d"
+  elem= seedElemHandler.newElement("FourNodeQuad",xc.ID([0,0,0,0]))
+
+  points= preprocessor.getMultiBlockTopology.getPoints
+  pt1= points.newPntFromPos3d(geom.Pos3d(0.0,0.0,0.0))
+  pt2= points.newPntFromPos3d(geom.Pos3d(CooMaxX/3.0,0.0,0.0))
+  pt3= points.newPntFromPos3d(geom.Pos3d(CooMaxX*2/3.0,0.0,0.0))
+  pt4= points.newPntFromPos3d(geom.Pos3d(CooMaxX,0.0,0.0))
+  pt5= points.newPntFromPos3d(geom.Pos3d(0.0,CooMaxY,0.0))
+  pt6= points.newPntFromPos3d(geom.Pos3d(CooMaxX/3.0,CooMaxY,0.0))
+  pt7= points.newPntFromPos3d(geom.Pos3d(CooMaxX*2/3.0,CooMaxY,0.0))
+  pt8= points.newPntFromPos3d(geom.Pos3d(CooMaxX,CooMaxY,0.0))
+
+  surfaces= preprocessor.getMultiBlockTopology.getSurfaces
+  s1= surfaces.newQuadSurfacePts(pt1.tag,pt2.tag,pt6.tag,pt5.tag)
+  s1.nDivI= 1
+  s1.nDivJ= 1
+
+  s2= surfaces.newQuadSurfacePts(pt2.tag,pt3.tag,pt7.tag,pt6.tag)
+  s2.nDivI= 2
+  s2.nDivJ= 1
+
+  divsOk= surfaces.conciliaNDivs()
+
+  s3= surfaces.newQuadSurfacePts(pt3.tag,pt4.tag,pt8.tag,pt7.tag)
+  s3.nDivI= 5
+  s3.nDivJ= 5
+
+  divsOk= divsOk & surfaces.conciliaNDivs()
+
+  preprocessor.getMultiBlockTopology.numThreads= numThreads
+  firstNodeTag= nodes.defaultTag
+  elements= preprocessor.getElementHandler
+  firstElemTag= elements.defaultTag
+  total= preprocessor.getSets.getSet("total")
+  feProblem.setVerbosityLevel(0) #Dont print warning messages about element seed.
+  total.genMesh(xc.meshDir.I)
+  feProblem.setVerbosityLevel(1) #Print warnings again 
+
+  nodePos= dict()
+  for n in total.getNodes:
+    pos= n.getInitialPos3d
+    nodePos[n.tag]= (pos.x,pos.y,pos.z)
+  elemNodes= dict()
+  for e in total.getElements:
+    extNodes= e.getNodes.getExternalNodes
+    elemNodes[e.tag]= list(extNodes)
+  numNodesDom= preprocessor.getDomain.getMesh.getNumNodes()
+  return nodePos, elemNodes, numNodesDom, nodes.defaultTag-firstNodeTag, elements.defaultTag-firstElemTag, divsOk
+
+nodePos1, elemNodes1, numNodesDom1, numNodeTags1, numElemTags1, divsOk1= genMesh(1)
+nodePos4, elemNodes4, numNodesDom4, numNodeTags4, numElemTags4, divsOk4= genMesh(4)
+
+numNodes= len(nodePos4)
+numElem= len(elemNodes4)
+
+ratio1= abs(numNodes-54)
+ratio2= abs(numElem-40)
+# Nodes and elements are numbered consecutively.
+ratio3= abs(numNodeTags4-numNodes)
+ratio4= abs(numElemTags4-numElem)
+ratio5= abs(numNodesDom4-numNodes)
+# Same tags, positions and connectivity than the serial meshing.
+sameTags= (sorted(nodePos1.keys())==sorted(nodePos4.keys())) and (sorted(elemNodes1.keys())==sorted(elemNodes4.keys()))
+ratio6= 0.0
+if(sameTags):
+  for tag in nodePos1:
+    p1= nodePos1[tag]; p4= nodePos4[tag]
+    ratio6= max(ratio6,abs(p1[0]-p4[0])+abs(p1[1]-p4[1])+abs(p1[2]-p4[2]))
+sameConnectivity= sameTags and (elemNodes1==elemNodes4)
+
+'''
+print "numNodes= ",numNodes
+print "numElem= ",numElem
+print "ratio3= ",ratio3
+print "ratio4= ",ratio4
+print "ratio5= ",ratio5
+print "sameTags= ",sameTags
+print "ratio6= ",ratio6
+print "sameConnectivity= ",sameConnectivity
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (ratio1<=1e-10) & (ratio2<=1e-10) & (ratio3==0) & (ratio4==0) & (ratio5==0) & divsOk1 & divsOk4 & sameTags & (ratio6<1e-12) & sameConnectivity:
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
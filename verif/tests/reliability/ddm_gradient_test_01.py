@@ -0,0 +1,54 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Gradient of a limit-state function computed by the direct
+# differentiation evaluator compared with the closed-form one. The
+# random variable x_1 appears three times in the expression, its
+# derivative must be counted only once.
+
+from __future__ import division
+import xc_base
+import geom
+import xc
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+feProblem= xc.FEProblem()
+reliabilityDomain= xc.ReliabilityDomain()
+x1= reliabilityDomain.newNormalRV(1,2.0,1.0)
+x2= reliabilityDomain.newNormalRV(2,1.5,0.5)
+# g= x1^2+3*x1*x2-x2
+lsf= reliabilityDomain.newLimitStateFunction(1,'{x_1}*{x_1}+3.0*{x_1}*{x_2}-{x_2}')
+reliabilityDomain.tagOfActiveLimitStateFunction= 1
+
+gradGEvaluator= xc.DirectDifferentiationGradGEvaluator(reliabilityDomain,feProblem.getDomain)
+
+x= xc.Vector([2.0,1.5])
+g= x[0]**2+3.0*x[0]*x[1]-x[1]
+gradGEvaluator.computeGradG(g,x)
+gradG= gradGEvaluator.getGradG
+
+gradGTeor= [2.0*x[0]+3.0*x[1], 3.0*x[0]-1.0]
+ratio1= abs(gradG[0]-gradGTeor[0])/gradGTeor[0]
+ratio2= abs(gradG[1]-gradGTeor[1])/gradGTeor[1]
+# No nodal responses in the expression: no sensitivity analysis needed.
+numSensitivityAnalyses= gradGEvaluator.getNumberOfSensitivityAnalyses
+
+'''
+print "tokenized expression: ", lsf.tokenizedExpression
+print "gradG= ", gradG
+print "gradGTeor= ", gradGTeor
+print "ratio1= ", ratio1
+print "ratio2= ", ratio2
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (ratio1<1e-3) & (ratio2<1e-3) & (numSensitivityAnalyses==0):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
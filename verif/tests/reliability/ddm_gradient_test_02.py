@@ -0,0 +1,131 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Gradient of a displacement-based limit-state function computed by the
+# direct differentiation evaluator. A truss loaded at its free end, the
+# random variables are the area of the truss (x_1, mapped on the element
+# by a positioner) and the allowed displacement (x_2):
+#   g= x_2-u, u= P*L/(E*x_1)
+#   dg/dx_1= P*L/(E*x_1^2), dg/dx_2= 1
+# The response sensitivity du/dx_1 is obtained by the sensitivity
+# algorithm reusing the tangent factored by the analysis.
+
+from __future__ import division
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 2.1e11 # Young modulus (Pa)
+A= 1e-3 # Truss area (m2)
+L= 2.0 # Truss length (m)
+P= 1e5 # Load (N)
+uMax= 2e-3 # Allowed displacement (m)
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+nodes.defaultTag= 1 #First node number.
+nod= nodes.newNodeXY(0.0,0.0)
+nod= nodes.newNodeXY(L,0.0)
+
+# Materials definition
+elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+
+# Elements definition
+elements= preprocessor.getElementHandler
+elements.dimElem= 2 # Dimension of element space
+elements.defaultMaterial= "elast"
+elements.defaultTag= 1 #Tag for the next element.
+truss= elements.newElement("Truss",xc.ID([1,2]))
+truss.area= A
+
+# Constraints
+constraints= preprocessor.getBoundaryCondHandler
+spc= constraints.newSPConstraint(1,0,0.0)
+spc= constraints.newSPConstraint(1,1,0.0)
+spc= constraints.newSPConstraint(2,1,0.0)
+
+# Loads definition
+loadHandler= preprocessor.getLoadHandler
+lPatterns= loadHandler.getLoadPatterns
+ts= lPatterns.newTimeSeries("constant_ts","ts")
+lPatterns.currentTimeSeries= "ts"
+lp0= lPatterns.newLoadPattern("default","0")
+lp0.newNodalLoad(2,xc.Vector([P,0]))
+lPatterns.addToDomain("0")
+
+# Solution procedure
+solu= feProblem.getSoluProc
+solCtrl= solu.getSoluControl
+solModels= solCtrl.getModelWrapperContainer
+sm= solModels.newModelWrapper("sm")
+numberer= sm.newNumberer("default_numberer")
+numberer.useAlgorithm("simple")
+cHandler= sm.newConstraintHandler("plain_handler")
+analysisAggregations= solCtrl.getAnalysisAggregationContainer
+analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+solAlgo= analysisAggregation.newSolutionAlgorithm("linear_soln_algo")
+integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+soe= analysisAggregation.newSystemOfEqn("band_gen_lin_soe")
+solver= soe.newSolver("band_gen_lin_lapack_solver")
+analysis= solu.newAnalysis("static_analysis","analysisAggregation","")
+result= analysis.analyze(1)
+
+# Reliability model.
+reliabilityDomain= xc.ReliabilityDomain()
+x1= reliabilityDomain.newNormalRV(1,A,0.1*A)
+x2= reliabilityDomain.newNormalRV(2,uMax,0.1*uMax)
+positioner= reliabilityDomain.newRandomVariablePositioner(1,1,truss,"A")
+lsf= reliabilityDomain.newLimitStateFunction(1,'{x_2}-{u_2_1}')
+reliabilityDomain.tagOfActiveLimitStateFunction= 1
+
+# Sensitivities computed on demand (analysis type 3) with respect to
+# the random variables.
+sensIntegrator= xc.StaticSensitivityIntegrator(analysisAggregation)
+sensAlgorithm= xc.SensitivityAlgorithm(reliabilityDomain,solAlgo,sensIntegrator,3)
+gradGEvaluator= xc.DirectDifferentiationGradGEvaluator(reliabilityDomain,feProblem.getDomain,sensAlgorithm)
+
+x= xc.Vector([A,uMax])
+u= nodes.getNode(2).getDisp[0]
+g= uMax-u
+gradGEvaluator.computeGradG(g,x)
+gradG= gradGEvaluator.getGradG
+reuseTangent= sensAlgorithm.reuseTangent
+gradGEvaluator.computeGradG(g,x) # same point: sensitivities not recomputed.
+numSensitivityAnalyses= gradGEvaluator.getNumberOfSensitivityAnalyses
+DgDdispl= gradGEvaluator.getDgDdispl
+
+uTeor= P*L/(E*A)
+gradGTeor= [P*L/(E*A**2), 1.0]
+ratio1= abs(u-uTeor)/uTeor
+ratio2= abs(gradG[0]-gradGTeor[0])/gradGTeor[0]
+ratio3= abs(gradG[1]-gradGTeor[1])/gradGTeor[1]
+ratio4= abs(DgDdispl(0,0)-2)+abs(DgDdispl(0,1)-1)+abs(DgDdispl(0,2)+1)
+
+'''
+print "u= ", u
+print "gradG= ", gradG
+print "gradGTeor= ", gradGTeor
+print "ratio1= ", ratio1
+print "ratio2= ", ratio2
+print "ratio3= ", ratio3
+print "ratio4= ", ratio4
+print "reuseTangent= ", reuseTangent
+print "numSensitivityAnalyses= ", numSensitivityAnalyses
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (result==0) & (ratio1<1e-12) & (ratio2<1e-9) & (ratio3<1e-9) & (ratio4<1e-9) & reuseTangent & (numSensitivityAnalyses==1):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,79 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Reproducibility of the counter-based random number generator used
+# by SamplingAnalysis: the numbers of a stream (sample) depend only on
+# the seed and the stream number, not on the order in which the
+# streams are visited. The C standard library generator doesn't
+# support streams.
+
+from __future__ import division
+import xc_base
+import geom
+import xc
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+seed= 7
+numRV= 4
+
+def sample(generator,k,seed= 0):
+  ''' Return the standard normal numbers of the sample k.'''
+  generator.setStream(k)
+  generator.generate_nIndependentStdNormalNumbers(numRV,seed)
+  return list(generator.getGeneratedNumbers)
+
+# Samples 1 to 10 in order.
+gen1= xc.CounterBasedRandGenerator(seed)
+samples1= [sample(gen1,k) for k in range(1,11)]
+
+# Same samples in reverse order (other generator, same seed).
+gen2= xc.CounterBasedRandGenerator(seed)
+samples2= [sample(gen2,k) for k in range(10,0,-1)]
+samples2.reverse()
+
+# Restart at sample 6 reseeding the generator.
+gen3= xc.CounterBasedRandGenerator(1)
+restart= sample(gen3,6,seed)
+
+# Another seed.
+gen4= xc.CounterBasedRandGenerator(seed+1)
+other= sample(gen4,1)
+
+# Mean and variance of the uniform numbers.
+n= 10000
+gen1.setStream(100)
+gen1.generate_nIndependentUniformNumbers(n,0.0,1.0,0)
+u= list(gen1.getGeneratedNumbers)
+mean= sum(u)/n
+var= sum([(x-mean)**2 for x in u])/(n-1)
+
+stdLib= xc.CStdLibRandGenerator()
+stdLibStream= stdLib.setStream(1)
+
+ok1= (samples1==samples2)
+ok2= (restart==samples1[5])
+ok3= (other!=samples1[0]) & (samples1[0]!=samples1[1])
+ratio1= abs(mean-0.5)/0.5
+ratio2= abs(var-1/12.0)*12.0
+
+'''
+print "samples1[0]= ",samples1[0]
+print "other= ",other
+print "mean= ",mean
+print "var= ",var
+print "ratio1= ",ratio1
+print "ratio2= ",ratio2
+print "stdLibStream= ",stdLibStream
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if ok1 & ok2 & ok3 & (ratio1<0.02) & (ratio2<0.05) & (min(u)>0.0) & (max(u)<1.0) & (stdLibStream<0):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
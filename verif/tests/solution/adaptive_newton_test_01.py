@@ -0,0 +1,126 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Two Steel01 bars in parallel loaded beyond the yield point of both
+# solved with the adaptive Newton algorithm. When a bar yields the
+# iterations with the last factorization contract slowly so the
+# algorithm refactors the tangent. Checks the displacement against the
+# closed-form value, that each new tangent (except the one formed at
+# the beginning of each step) corresponds to a decision logged in the
+# convergence test and that the log keeps only the last decisions
+# when its maximum size is reduced.
+
+from __future__ import division
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+L= 1.0 # Bar length (m)
+E= 200e9 # Elastic modulus (Pa)
+fy1= 275e6 # Yield stress of the first bar (Pa)
+fy2= 1.5*fy1 # Yield stress of the second bar (Pa)
+b= 0.01 # Strain-hardening ratio.
+A= 1e-4 # Bar area (m2)
+P= 3.0*fy1*A # Load (both bars yield)
+numSteps= 10
+
+feProblem= xc.FEProblem()
+feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages about big strains.
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+nodes.defaultTag= 1 #First node number.
+nod= nodes.newNodeXY(0.0,0.0)
+nod= nodes.newNodeXY(L,0.0)
+
+# Materials definition
+typical_materials.defSteel01(preprocessor, "steel1",E,fy1,b)
+typical_materials.defSteel01(preprocessor, "steel2",E,fy2,b)
+
+# Elements definition
+elements= preprocessor.getElementHandler
+elements.dimElem= 2 # Dimension of element space
+elements.defaultTag= 1 #Tag for the next element.
+elements.defaultMaterial= "steel1"
+truss= elements.newElement("Truss",xc.ID([1,2]))
+truss.area= A
+elements.defaultMaterial= "steel2"
+truss= elements.newElement("Truss",xc.ID([1,2]))
+truss.area= A
+
+# Constraints
+constraints= preprocessor.getBoundaryCondHandler
+spc= constraints.newSPConstraint(1,0,0.0)
+spc= constraints.newSPConstraint(1,1,0.0)
+spc= constraints.newSPConstraint(2,1,0.0)
+
+# Loads definition
+loadHandler= preprocessor.getLoadHandler
+lPatterns= loadHandler.getLoadPatterns
+ts= lPatterns.newTimeSeries("linear_ts","ts")
+lPatterns.currentTimeSeries= "ts"
+lp0= lPatterns.newLoadPattern("default","0")
+lp0.newNodalLoad(2,xc.Vector([P,0]))
+lPatterns.addToDomain("0")
+
+# Solution procedure
+solu= feProblem.getSoluProc
+solCtrl= solu.getSoluControl
+solModels= solCtrl.getModelWrapperContainer
+sm= solModels.newModelWrapper("sm")
+numberer= sm.newNumberer("default_numberer")
+numberer.useAlgorithm("simple")
+cHandler= sm.newConstraintHandler("plain_handler")
+analysisAggregations= solCtrl.getAnalysisAggregationContainer
+analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+solAlgo= analysisAggregation.newSolutionAlgorithm("adaptive_newton_soln_algo")
+solAlgo.useCostModel= False # Don't depend on the measured times.
+convTest= analysisAggregation.newConvergenceTest("norm_unbalance_conv_test")
+convTest.tol= 1.0e-6
+convTest.maxNumIter= 50
+integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+integ.dLambda1= 1.0/numSteps
+soe= analysisAggregation.newSystemOfEqn("band_gen_lin_soe")
+solver= soe.newSolver("band_gen_lin_lapack_solver")
+analysis= solu.newAnalysis("static_analysis","analysisAggregation","")
+result= analysis.analyze(numSteps)
+
+delta= nodes.getNode(2).getDisp[0]
+# Closed-form value (both bars in the hardening branch).
+deltaTeor= (P/A-(1-b)*(fy1+fy2))/(2*b*E)*L
+ratio1= abs(delta-deltaTeor)/deltaTeor
+
+numRefactorizations= solAlgo.numRefactorizations
+numKrylovIterations= solAlgo.numKrylovIterations
+log= list(convTest.algorithmLog)
+numLoggedRefactorizations= len([msg for msg in log if 'refactoring' in msg])
+
+# Keep only the last decision.
+convTest.algorithmLogMaxSize= 1
+trimmedLog= list(convTest.algorithmLog)
+
+'''
+print "delta= ",delta
+print "deltaTeor= ",deltaTeor
+print "ratio1= ",ratio1
+print "numRefactorizations= ",numRefactorizations
+print "numKrylovIterations= ",numKrylovIterations
+for msg in log:
+  print msg
+print "trimmedLog= ",trimmedLog
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (result==0) & (ratio1<1e-9) & (numRefactorizations==numSteps+numLoggedRefactorizations) & (numLoggedRefactorizations>0) & (numKrylovIterations>0) & (trimmedLog==log[-1:]):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
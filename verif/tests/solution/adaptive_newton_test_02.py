@@ -0,0 +1,147 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Steel01 bar loaded beyond the yield point and then unloaded. At the
+# beginning of the unloading the tangent of the material is the
+# hardening one, so the first Newton iteration overshoots and the
+# residual grows with a fresh tangent. Without line search the Newton
+# iterations cycle between the elastic and the hardening branches and
+# the step fails. With a line search the adaptive Newton algorithm
+# enables it for the rest of the step and converges. Checks the
+# decisions logged and the residual displacement against the
+# closed-form value.
+
+from __future__ import division
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+L= 1.0 # Bar length (m)
+E= 200e9 # Elastic modulus (Pa)
+fy= 275e6 # Yield stress (Pa)
+b= 0.01 # Strain-hardening ratio.
+A= 1e-4 # Bar area (m2)
+P= 1.5*fy*A # Load.
+numSteps= 10
+
+feProblem= xc.FEProblem()
+feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages about big strains and failed steps.
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+nodes.defaultTag= 1 #First node number.
+nod= nodes.newNodeXY(0.0,0.0)
+nod= nodes.newNodeXY(L,0.0)
+
+# Materials definition
+typical_materials.defSteel01(preprocessor, "steel",E,fy,b)
+
+# Elements definition
+elements= preprocessor.getElementHandler
+elements.dimElem= 2 # Dimension of element space
+elements.defaultTag= 1 #Tag for the next element.
+elements.defaultMaterial= "steel"
+truss= elements.newElement("Truss",xc.ID([1,2]))
+truss.area= A
+
+# Constraints
+constraints= preprocessor.getBoundaryCondHandler
+spc= constraints.newSPConstraint(1,0,0.0)
+spc= constraints.newSPConstraint(1,1,0.0)
+spc= constraints.newSPConstraint(2,1,0.0)
+
+# Loads definition
+loadHandler= preprocessor.getLoadHandler
+lPatterns= loadHandler.getLoadPatterns
+ts= lPatterns.newTimeSeries("linear_ts","ts")
+lPatterns.currentTimeSeries= "ts"
+lp0= lPatterns.newLoadPattern("default","0")
+lp0.newNodalLoad(2,xc.Vector([P,0]))
+lPatterns.addToDomain("0")
+
+# Solution procedure
+solu= feProblem.getSoluProc
+solCtrl= solu.getSoluControl
+solModels= solCtrl.getModelWrapperContainer
+sm= solModels.newModelWrapper("sm")
+numberer= sm.newNumberer("default_numberer")
+numberer.useAlgorithm("simple")
+cHandler= sm.newConstraintHandler("plain_handler")
+analysisAggregations= solCtrl.getAnalysisAggregationContainer
+analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+solAlgo= analysisAggregation.newSolutionAlgorithm("adaptive_newton_soln_algo")
+solAlgo.useCostModel= False # Don't depend on the measured times.
+solAlgo.setLineSearch("none") # No line search.
+convTest= analysisAggregation.newConvergenceTest("norm_unbalance_conv_test")
+convTest.tol= 1.0e-6
+convTest.maxNumIter= 50
+integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+soe= analysisAggregation.newSystemOfEqn("band_gen_lin_soe")
+solver= soe.newSolver("band_gen_lin_lapack_solver")
+analysis= solu.newAnalysis("static_analysis","analysisAggregation","")
+
+node2= nodes.getNode(2)
+
+# Loading.
+integ.dLambda1= 1.0/numSteps
+result0= analysis.analyze(numSteps)
+deltaMax= node2.getDisp[0]
+
+# Unloading without line search (must fail).
+hasLineSearch1= solAlgo.hasLineSearch
+convTest.clearAlgorithmLog()
+integ.dLambda1= -1.0/numSteps
+result1= analysis.analyze(numSteps)
+deltaFailure= node2.getDisp[0] # Reverted to the committed state.
+log1= list(convTest.algorithmLog)
+numNoLineSearch= len([msg for msg in log1 if 'no line search defined' in msg])
+
+# Unloading with line search.
+solAlgo.setLineSearch("initial_interpolated_line_search")
+hasLineSearch2= solAlgo.hasLineSearch
+solAlgo.resetStatistics()
+convTest.clearAlgorithmLog()
+result2= analysis.analyze(numSteps)
+deltaRes= node2.getDisp[0]
+log2= list(convTest.algorithmLog)
+numLineSearchEnabled= len([msg for msg in log2 if 'line search enabled' in msg])
+numLineSearches= solAlgo.numLineSearches
+
+# Closed-form values.
+epsMax= fy/E+(P/A-fy)/(b*E)
+deltaMaxTeor= epsMax*L
+deltaResTeor= (epsMax-P/(A*E))*L
+ratio1= abs(deltaMax-deltaMaxTeor)/deltaMaxTeor
+ratio2= abs(deltaFailure-deltaMax)/deltaMaxTeor
+ratio3= abs(deltaRes-deltaResTeor)/deltaResTeor
+
+'''
+print "deltaMax= ",deltaMax
+print "deltaMaxTeor= ",deltaMaxTeor
+print "ratio1= ",ratio1
+print "result1= ",result1
+print "ratio2= ",ratio2
+print "numNoLineSearch= ",numNoLineSearch
+print "deltaRes= ",deltaRes
+print "deltaResTeor= ",deltaResTeor
+print "ratio3= ",ratio3
+print "numLineSearchEnabled= ",numLineSearchEnabled
+print "numLineSearches= ",numLineSearches
+for msg in log2:
+  print msg
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (result0==0) & (ratio1<1e-9) & (not hasLineSearch1) & (result1!=0) & (ratio2<1e-12) & (numNoLineSearch>0) & hasLineSearch2 & (result2==0) & (ratio3<1e-9) & (numLineSearchEnabled==1) & (numLineSearches>0):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
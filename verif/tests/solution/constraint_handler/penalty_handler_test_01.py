@@ -0,0 +1,105 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Cantilever solved for several load cases (one of them with an
+# imposed displacement) reusing the same analysis. Checks that the
+# penalty constraint handler updates the single freedom constraints
+# when the load patterns are added to or removed from the domain.
+
+from __future__ import division
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 2.1e6 # Young modulus.
+I= 1e-4 # Moment of inertia of the beam.
+A= 1e-2 # Area of the beam.
+L= 5.0 # Beam length.
+P= -1e3 # Load at the tip.
+d= -0.05 # Imposed displacement at the tip.
+NumDiv= 4
+
+# Problem type
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+nodes.defaultTag= 1 #First node number.
+for i in range(0,NumDiv+1):
+  nod= nodes.newNodeXY(i*L/NumDiv,0.0)
+tipNode= nodes.defaultTag-1
+
+# Geometric transformations
+lin= modelSpace.newLinearCrdTransf("lin")
+# Materials
+section= typical_materials.defElasticSection2d(preprocessor, "section",A,E,I)
+
+# Elements definition
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "lin"
+elements.defaultMaterial= "section"
+elements.defaultTag= 1 #Tag for next element.
+for i in range(1,NumDiv+1):
+  beam2d= elements.newElement("ElasticBeam2d",xc.ID([i,i+1]))
+
+# Constraints
+modelSpace.fixNode000(1)
+
+# Loads definition
+loadHandler= preprocessor.getLoadHandler
+lPatterns= loadHandler.getLoadPatterns
+ts= lPatterns.newTimeSeries("constant_ts","ts")
+lPatterns.currentTimeSeries= "ts"
+lp0= lPatterns.newLoadPattern("default","0")
+lp0.newNodalLoad(tipNode,xc.Vector([0,P,0]))
+lp1= lPatterns.newLoadPattern("default","1")
+spc= lp1.newSPConstraint(tipNode,1,d) # Imposed displacement.
+
+# Solution procedure (penalty constraint handler).
+analysis= predefined_solutions.simple_static_linear(feProblem)
+
+deltaTeor= P*L**3/(3*E*I)
+# Load case 0.
+lPatterns.addToDomain("0")
+result= analysis.analyze(1)
+delta0= nodes.getNode(tipNode).getDisp[1]
+lp0.removeFromDomain()
+# Load case 1 (imposed displacement).
+lPatterns.addToDomain("1")
+result+= analysis.analyze(1)
+delta1= nodes.getNode(tipNode).getDisp[1]
+lp1.removeFromDomain()
+# Load case 0 again (the constraint must be gone).
+lPatterns.addToDomain("0")
+result+= analysis.analyze(1)
+delta2= nodes.getNode(tipNode).getDisp[1]
+
+ratio0= abs(delta0-deltaTeor)/abs(deltaTeor)
+ratio1= abs(delta1-d)/abs(d)
+ratio2= abs(delta2-deltaTeor)/abs(deltaTeor)
+
+'''
+print "delta0= ",delta0
+print "deltaTeor= ",deltaTeor
+print "ratio0= ",ratio0
+print "delta1= ",delta1
+print "ratio1= ",ratio1
+print "delta2= ",delta2
+print "ratio2= ",ratio2
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (abs(ratio0)<1e-9) & (abs(ratio1)<1e-9) & (abs(ratio2)<1e-9) & (result==0):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,160 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Dynamic response sensitivity with the transformation constraint
+# handler (same model as transformation_handler_test_04.py). The
+# Newmark sensitivity integrator asks the elements for their damping
+# and mass forces, which the transformation handler computes in the
+# work vectors of TransformationFE. The random variables are the
+# areas of the trusses, for each direction:
+#   u(t)= P/k*(1-cos(w*t)), k= E*A/L, w= sqrt(k/m)
+#   du/dA= k/A*du/dk= P/(k*A)*(w*t/2*sin(w*t)-(1-cos(w*t)))
+
+from __future__ import division
+import math
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+m= 1.0 # Total mass (kg)
+Tx= 1.0 # Natural period in x (s)
+Ty= 0.5 # Natural period in y (s)
+wx= 2*math.pi/Tx
+wy= 2*math.pi/Ty
+kx= m*wx**2 # Stiffness in x (N/m)
+ky= m*wy**2 # Stiffness in y (N/m)
+L= 1.0 # Truss length (m)
+A= 1.0 # Truss area (m2)
+Px= 10.0 # Load in x (N)
+Py= -5.0 # Load in y (N)
+dT= 1e-3 # Time step (s)
+numSteps= 500
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+nodes.defaultTag= 1 #First node number.
+nod1= nodes.newNodeXY(-L,0.0)
+nod2= nodes.newNodeXY(0.0,0.0) # retained node.
+nod3= nodes.newNodeXY(0.0,0.0) # constrained node.
+nod4= nodes.newNodeXY(0.0,-L)
+nod2.mass= xc.Matrix([[m/2.0,0],[0,m/2.0]])
+nod3.mass= xc.Matrix([[m/2.0,0],[0,m/2.0]])
+
+# Materials definition
+elastX= typical_materials.defElasticMaterial(preprocessor, "elastX",kx*L/A)
+elastY= typical_materials.defElasticMaterial(preprocessor, "elastY",ky*L/A)
+
+# Elements definition
+elements= preprocessor.getElementHandler
+elements.dimElem= 2 # Dimension of element space
+elements.defaultTag= 1 #Tag for the next element.
+elements.defaultMaterial= "elastX"
+trussX= elements.newElement("Truss",xc.ID([nod1.tag,nod2.tag]))
+trussX.area= A
+elements.defaultMaterial= "elastY"
+trussY= elements.newElement("Truss",xc.ID([nod4.tag,nod3.tag]))
+trussY.area= A
+
+# Constraints
+constraints= preprocessor.getBoundaryCondHandler
+for n in [nod1,nod4]:
+  spc= constraints.newSPConstraint(n.tag,0,0.0)
+  spc= constraints.newSPConstraint(n.tag,1,0.0)
+eqDOF= constraints.newEqualDOF(nod2.tag,nod3.tag,xc.ID([0,1]))
+
+# Loads definition
+loadHandler= preprocessor.getLoadHandler
+lPatterns= loadHandler.getLoadPatterns
+ts= lPatterns.newTimeSeries("constant_ts","ts")
+lPatterns.currentTimeSeries= "ts"
+lp0= lPatterns.newLoadPattern("default","0")
+lp0.newNodalLoad(nod2.tag,xc.Vector([Px,0]))
+lp0.newNodalLoad(nod3.tag,xc.Vector([0,Py]))
+lPatterns.addToDomain("0")
+
+# Solution procedure
+solu= feProblem.getSoluProc
+solCtrl= solu.getSoluControl
+solModels= solCtrl.getModelWrapperContainer
+sm= solModels.newModelWrapper("sm")
+numberer= sm.newNumberer("default_numberer")
+numberer.useAlgorithm("rcm")
+cHandler= sm.newConstraintHandler("transformation_constraint_handler")
+analysisAggregations= solCtrl.getAnalysisAggregationContainer
+analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+solAlgo= analysisAggregation.newSolutionAlgorithm("newton_raphson_soln_algo")
+ctest= analysisAggregation.newConvergenceTest("norm_disp_incr_conv_test")
+ctest.tol= 1.0e-9
+ctest.maxNumIter= 10
+integ= analysisAggregation.newIntegrator("newmark_sensitivity_integrator",xc.Vector([0.5,0.25]))
+soe= analysisAggregation.newSystemOfEqn("band_gen_lin_soe")
+solver= soe.newSolver("band_gen_lin_lapack_solver")
+analysis= solu.newAnalysis("direct_integration_analysis","analysisAggregation","")
+
+# Reliability model.
+reliabilityDomain= xc.ReliabilityDomain()
+x1= reliabilityDomain.newNormalRV(1,A,0.1*A)
+x2= reliabilityDomain.newNormalRV(2,A,0.1*A)
+positionerX= reliabilityDomain.newRandomVariablePositioner(1,1,trussX,"A")
+positionerY= reliabilityDomain.newRandomVariablePositioner(2,2,trussY,"A")
+# Sensitivities computed on demand (analysis type 3) with respect to
+# the random variables.
+sensAlgorithm= xc.SensitivityAlgorithm(reliabilityDomain,solAlgo,integ,3)
+
+def dudA(P,k,w,t):
+  return P/(k*A)*(w*t/2.0*math.sin(w*t)-(1.0-math.cos(w*t)))
+
+result= 0
+errX= 0.0
+errY= 0.0
+maxSensX= 0.0
+maxSensY= 0.0
+crossSens= 0.0
+eqSensErr= 0.0
+for i in range(1,numSteps+1):
+  result+= analysis.analyze(1,dT)
+  result+= sensAlgorithm.computeSensitivities()
+  t= i*dT
+  sensX= nod2.getDispSensitivity(1,1)
+  sensY= nod2.getDispSensitivity(2,2)
+  errX= max(errX,abs(sensX-dudA(Px,kx,wx,t)))
+  errY= max(errY,abs(sensY-dudA(Py,ky,wy,t)))
+  maxSensX= max(maxSensX,abs(dudA(Px,kx,wx,t)))
+  maxSensY= max(maxSensY,abs(dudA(Py,ky,wy,t)))
+  crossSens= max(crossSens,abs(nod2.getDispSensitivity(1,2))+abs(nod2.getDispSensitivity(2,1)))
+  eqSensErr= max(eqSensErr,abs(nod3.getDispSensitivity(1,1)-sensX)+abs(nod3.getDispSensitivity(2,2)-sensY))
+
+errX/= maxSensX
+errY/= maxSensY
+crossSens/= min(maxSensX,maxSensY)
+eqSensErr/= min(maxSensX,maxSensY)
+ux= nod2.getDisp[0]
+uy= nod3.getDisp[1]
+t= numSteps*dT
+dispErr= abs(ux-Px/kx*(1.0-math.cos(wx*t)))/abs(Px/kx)+abs(uy-Py/ky*(1.0-math.cos(wy*t)))/abs(Py/ky)
+
+'''
+print "result= ", result
+print "errX= ", errX
+print "errY= ", errY
+print "crossSens= ", crossSens
+print "eqSensErr= ", eqSensErr
+print "dispErr= ", dispErr
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (result==0) & (errX<1e-2) & (errY<1e-2) & (crossSens<1e-10) & (eqSensErr<1e-10) & (dispErr<1e-2):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,96 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Measurement of the time spent in the update of each element
+# (used as element cost by the domain partitioners).
+
+from __future__ import division
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 2.1e6 # Young modulus.
+I= 1e-4 # Moment of inertia of the beam.
+A= 1e-2 # Area of the beam.
+L= 5.0 # Beam length.
+P= -1e3 # Load at the tip.
+NumDiv= 4
+
+# Problem type
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+nodes.defaultTag= 1 #First node number.
+for i in range(0,NumDiv+1):
+  nod= nodes.newNodeXY(i*L/NumDiv,0.0)
+tipNode= nodes.defaultTag-1
+
+# Geometric transformations
+lin= modelSpace.newLinearCrdTransf("lin")
+# Materials
+section= typical_materials.defElasticSection2d(preprocessor, "section",A,E,I)
+
+# Elements definition
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "lin"
+elements.defaultMaterial= "section"
+elements.defaultTag= 1 #Tag for next element.
+for i in range(1,NumDiv+1):
+  beam2d= elements.newElement("ElasticBeam2d",xc.ID([i,i+1]))
+
+# Constraints
+modelSpace.fixNode000(1)
+
+# Loads definition
+loadHandler= preprocessor.getLoadHandler
+lPatterns= loadHandler.getLoadPatterns
+ts= lPatterns.newTimeSeries("constant_ts","ts")
+lPatterns.currentTimeSeries= "ts"
+lp0= lPatterns.newLoadPattern("default","0")
+lp0.newNodalLoad(tipNode,xc.Vector([0,P,0]))
+lPatterns.addToDomain("0")
+
+mesh= feProblem.getDomain.getMesh
+mesh.elementTiming= True
+
+# Solution
+solu= feProblem.getSoluProc
+solCtrl= solu.getSoluControl
+solModels= solCtrl.getModelWrapperContainer
+sm= solModels.newModelWrapper("sm")
+cHandler= sm.newConstraintHandler("plain_handler")
+numberer= sm.newNumberer("default_numberer")
+numberer.useAlgorithm("simple")
+analysisAggregations= solCtrl.getAnalysisAggregationContainer
+analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+solAlgo= analysisAggregation.newSolutionAlgorithm("linear_soln_algo")
+integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+soe= analysisAggregation.newSystemOfEqn("band_spd_lin_soe")
+solver= soe.newSolver("band_spd_lin_lapack_solver")
+analysis= solu.newAnalysis("static_analysis","analysisAggregation","")
+result= analysis.analyze(1)
+
+costs= [mesh.getElementCost(i) for i in range(1,NumDiv+1)]
+measured= (min(costs)>0.0)
+mesh.resetElementCosts()
+reset= (mesh.getElementCost(1)==0.0)
+
+'''
+print "costs= ",costs
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if measured & reset & (result==0):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
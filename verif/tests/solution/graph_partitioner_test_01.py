@@ -0,0 +1,98 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Partition of the element graph of a strip of quads with the
+# built-in multilevel partitioner (used when XC is built without
+# METIS) and with the default one.
+
+from __future__ import division
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+NumDivI= 40 # Number of elements along the strip.
+NumDivJ= 4 # Number of elements across the strip.
+numParts= 4
+
+# Problem type
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+nodes.defaultTag= 1 #First node number.
+for i in range(0,NumDivI+1):
+  for j in range(0,NumDivJ+1):
+    nod= nodes.newNodeXY(float(i),float(j))
+
+def nodeTag(i,j):
+  return i*(NumDivJ+1)+j+1
+
+elast2d= typical_materials.defElasticIsotropicPlaneStress(preprocessor, "elast2d",30e6,0.3,0.0)
+elements= preprocessor.getElementHandler
+elements.defaultMaterial= "elast2d"
+elements.defaultTag= 1
+position= dict() # (i,j) indexes of each element.
+for i in range(0,NumDivI):
+  for j in range(0,NumDivJ):
+    quad= elements.newElement("FourNodeQuad",xc.ID([nodeTag(i,j),nodeTag(i+1,j),nodeTag(i+1,j+1),nodeTag(i,j+1)]))
+    position[quad.tag]= (i,j)
+
+mesh= feProblem.getDomain.getMesh
+numElements= mesh.getNumElements()
+
+def checkPartition(parts):
+  ''' Return true if all the elements have a valid part, the parts
+      are balanced and the number of element pairs that share a node
+      and belong to different parts is near the optimum (three cuts
+      across the strip).'''
+  if(len(parts)!=numElements):
+    return False
+  count= [0]*numParts
+  for tag in parts:
+    p= parts[tag]
+    if((p<1) or (p>numParts)):
+      return False
+    count[p-1]+= 1
+  maxCount= max(count)
+  balanced= (min(count)>0) and (maxCount<=1.1*numElements/numParts)
+  cut= 0
+  tags= dict((position[tag],tag) for tag in position)
+  for tag in parts:
+    i,j= position[tag]
+    for di,dj in [(1,-1),(1,0),(1,1),(0,1)]:
+      other= tags.get((i+di,j+dj))
+      if(other and (parts[other]!=parts[tag])):
+        cut+= 1
+  optimumCut= (numParts-1)*(NumDivJ+2*(NumDivJ-1))
+  return balanced and (cut<=2*optimumCut)
+
+multilevel= xc.MultilevelPartitioner()
+multilevel.coarsenTo= 10
+multilevel.imbalance= 1.05
+multilevelOk= checkPartition(mesh.getElementPartitions(multilevel,numParts))
+
+default= xc.newGraphPartitioner('default')
+defaultOk= checkPartition(mesh.getElementPartitions(default,numParts))
+
+unknown= xc.newGraphPartitioner('nonexistent')
+
+'''
+print "multilevelOk= ",multilevelOk
+print "defaultOk= ",defaultOk
+print "unknown= ",unknown
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if multilevelOk & defaultOk & (unknown==None) & (multilevel.imbalance==1.05):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
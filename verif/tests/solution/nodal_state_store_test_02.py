@@ -0,0 +1,134 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Cantilever solved for two load cases keeping the displacements of the
+# nodes in the contiguous arrays of the mesh (useNodalStateStore). Before
+# each load case the unloaded state is restored from a database, so the
+# nodes receive their displacements again while they are in the store
+# (the store must be rebuilt). Checks also that revertToLastCommit
+# restores the trial displacements in the store.
+
+from __future__ import division
+import os
+import numpy
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 2.1e6 # Young modulus.
+I= 1e-4 # Moment of inertia of the beam.
+A= 1e-2 # Area of the beam.
+L= 5.0 # Beam length.
+PA= -1e3 # Load at the tip (load case A).
+PB= 2.5e3 # Load at the tip (load case B).
+NumDiv= 4
+
+# Problem type
+feProblem= xc.FEProblem()
+feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+nodes.defaultTag= 1 #First node number.
+for i in range(0,NumDiv+1):
+  nod= nodes.newNodeXY(i*L/NumDiv,0.0)
+tipNode= nodes.getNode(nodes.defaultTag-1)
+
+# Geometric transformations
+lin= modelSpace.newLinearCrdTransf("lin")
+# Materials
+section= typical_materials.defElasticSection2d(preprocessor, "section",A,E,I)
+
+# Elements definition
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "lin"
+elements.defaultMaterial= "section"
+elements.defaultTag= 1 #Tag for next element.
+for i in range(1,NumDiv+1):
+  beam2d= elements.newElement("ElasticBeam2d",xc.ID([i,i+1]))
+
+# Constraints
+modelSpace.fixNode000(1)
+
+# Loads definition
+loadHandler= preprocessor.getLoadHandler
+lPatterns= loadHandler.getLoadPatterns
+ts= lPatterns.newTimeSeries("constant_ts","ts")
+lPatterns.currentTimeSeries= "ts"
+lpA= lPatterns.newLoadPattern("default","A")
+lpA.newNodalLoad(tipNode.tag,xc.Vector([0,PA,0]))
+lpB= lPatterns.newLoadPattern("default","B")
+lpB.newNodalLoad(tipNode.tag,xc.Vector([0,PB,0]))
+
+mesh= feProblem.getDomain.getMesh
+mesh.useNodalStateStore= True
+
+analysis= predefined_solutions.simple_static_linear(feProblem)
+
+os.system("rm -r -f /tmp/nodal_state_store_test_02.db")
+db= feProblem.newDatabase("BerkeleyDB","/tmp/nodal_state_store_test_02.db")
+db.save(100) # Unloaded state.
+
+def committedDispFromStore(node):
+  ''' Return the committed displacements of the node read from
+      the arrays of the store.'''
+  store= mesh.getNodalStateStore
+  tags= list(store.nodeTags)
+  offset= list(store.nodeOffsets)[tags.index(node.tag)]
+  committedDisp= numpy.frombuffer(store.disp.getVector(1),dtype= numpy.float64)
+  return committedDisp[offset:offset+3]
+
+def solve(lpName):
+  ''' Restore the unloaded state, solve the load case and return
+      the tip deflection and the difference with the value in the store.'''
+  preprocessor.resetLoadCase()
+  db.restore(100)
+  lPatterns.addToDomain(lpName)
+  result= analysis.analyze(1)
+  lPatterns.removeFromDomain(lpName)
+  delta= tipNode.getDisp[1]
+  err= abs(committedDispFromStore(tipNode)[1]-delta)
+  return result, delta, err
+
+resultA, deltaA, errA= solve("A")
+resultB, deltaB, errB= solve("B")
+
+# Revert a trial displacement.
+tipNode.setTrialDisp(xc.Vector([1.0,2.0,3.0]))
+feProblem.getDomain.revertToLastCommit()
+store= mesh.getNodalStateStore
+offset= list(store.nodeOffsets)[list(store.nodeTags).index(tipNode.tag)]
+trialDisp= numpy.frombuffer(store.disp.getVector(0),dtype= numpy.float64)
+errRevert= abs(trialDisp[offset+1]-deltaB)+abs(tipNode.getDisp[1]-deltaB)
+
+kBeam= 3*E*I/L**3
+ratio1= abs(deltaA-PA/kBeam)/abs(PA/kBeam)
+ratio2= abs(deltaB-PB/kBeam)/abs(PB/kBeam)
+numNodes= store.numNodes
+
+'''
+print "deltaA= ",deltaA
+print "deltaB= ",deltaB
+print "ratio1= ",ratio1
+print "ratio2= ",ratio2
+print "errA= ",errA
+print "errB= ",errB
+print "errRevert= ",errRevert
+print "numNodes= ",numNodes
+'''
+
+os.system("rm -r -f /tmp/nodal_state_store_test_02.db")
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (resultA==0) & (resultB==0) & (ratio1<1e-9) & (ratio2<1e-9) & (errA<1e-15) & (errB<1e-15) & (errRevert<1e-15) & (numNodes==NumDiv+1):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
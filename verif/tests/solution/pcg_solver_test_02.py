@@ -0,0 +1,127 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Square plate with a point load at its center (example 2-005 of
+# the SAP 2000 verification manual) solved with the element by element
+# PCG solver using the Jacobi and block Jacobi preconditioners, with
+# the element matrices stored (product computed by several threads)
+# and in matrix-free mode.
+
+from __future__ import division
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+NumDivI= 8
+NumDivJ= 8
+CooMax= 2
+E= 17472000 # Elastic modulus en lb/in2
+nu= 0.3 # Poisson's ratio
+thickness= 0.0001 # Cross section depth expressed in inches.
+ptLoad= 0.0004 # Punctual load in lb.
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+nodes.newSeedNode()
+
+# Materials definition
+memb1= typical_materials.defElasticMembranePlateSection(preprocessor, "memb1",E,nu,0.0,thickness)
+
+seedElemHandler= preprocessor.getElementHandler.seedElemHandler
+seedElemHandler.defaultMaterial= "memb1"
+seedElemHandler.defaultTag= 1
+elem= seedElemHandler.newElement("ShellMITC4",xc.ID([0,0,0,0]))
+
+points= preprocessor.getMultiBlockTopology.getPoints
+pt= points.newPntIDPos3d(1,geom.Pos3d(0.0,0.0,0.0))
+pt= points.newPntIDPos3d(2,geom.Pos3d(CooMax,0.0,0.0))
+pt= points.newPntIDPos3d(3,geom.Pos3d(CooMax,CooMax,0.0))
+pt= points.newPntIDPos3d(4,geom.Pos3d(0.0,CooMax,0.0))
+surfaces= preprocessor.getMultiBlockTopology.getSurfaces
+surfaces.defaultTag= 1
+s= surfaces.newQuadSurfacePts(1,2,3,4)
+s.nDivI= NumDivI
+s.nDivJ= NumDivJ
+
+f1= preprocessor.getSets.getSet("f1")
+f1.genMesh(xc.meshDir.I)
+
+# Constraints
+sides= s.getEdges
+for l in sides:
+  for i in l.getEdge.getNodeTags():
+    modelSpace.fixNode000_FFF(i)
+
+# Loads definition
+loadHandler= preprocessor.getLoadHandler
+lPatterns= loadHandler.getLoadPatterns
+ts= lPatterns.newTimeSeries("constant_ts","ts")
+lPatterns.currentTimeSeries= "ts"
+lp0= lPatterns.newLoadPattern("default","0")
+node= s.getNodeIJK(1,NumDivI//2+1,NumDivJ//2+1)
+lp0.newNodalLoad(node.tag,xc.Vector([0,0,-ptLoad,0,0,0]))
+lPatterns.addToDomain("0")
+
+# Solution procedure
+solu= feProblem.getSoluProc
+solCtrl= solu.getSoluControl
+solModels= solCtrl.getModelWrapperContainer
+sm= solModels.newModelWrapper("sm")
+cHandler= sm.newConstraintHandler("plain_handler")
+numberer= sm.newNumberer("default_numberer")
+numberer.useAlgorithm("simple")
+analysisAggregations= solCtrl.getAnalysisAggregationContainer
+analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+solAlgo= analysisAggregation.newSolutionAlgorithm("linear_soln_algo")
+integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+soe= analysisAggregation.newSystemOfEqn("ebe_lin_soe")
+soe.numThreads= 4
+soe.parallelThreshold= 0 # compute the products in parallel even for this small model.
+solver= soe.newSolver("pcg_lin_solver")
+solver.tolerance= 1e-12
+analysis= solu.newAnalysis("static_analysis","analysisAggregation","")
+
+# (preconditioner, matrixFree) combinations to check.
+cases= [("jacobi",False), ("block_jacobi",False), ("jacobi",True), ("block_jacobi",True)]
+results= []
+displacements= []
+iterations= []
+for preconditioner, matrixFree in cases:
+  feProblem.getDomain.revertToStart()
+  soe.preconditioner= preconditioner
+  soe.matrixFree= matrixFree
+  results.append(analysis.analyze(1))
+  displacements.append(node.getDisp[2])
+  iterations.append(solver.numIterations)
+cacheSize= soe.cacheSize # nothing stored in matrix-free mode.
+
+UNTeor= -11.6
+ratio1= abs((displacements[0]-UNTeor)/UNTeor)
+ratio2= 0.0
+for u in displacements[1:]:
+  ratio2= max(ratio2,abs((u-displacements[0])/displacements[0]))
+
+'''
+print "displacements= ",displacements
+print "iterations= ",iterations
+print "ratio1= ",ratio1
+print "ratio2= ",ratio2
+print "cacheSize= ",cacheSize
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (ratio1<6e-3) & (ratio2<1e-8) & (results==[0,0,0,0]) & (min(iterations)>0) & (cacheSize==0):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
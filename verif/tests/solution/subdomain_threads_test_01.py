@@ -0,0 +1,39 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Checks the switch that sets the number of threads used by the
+# partitioned domains to process their subdomains (one thread means
+# the sequential path, which is the default).
+
+import xc_base
+import geom
+import xc
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+default= xc.PartitionedDomain.getDefaultNumThreads()
+xc.PartitionedDomain.setDefaultNumThreads(1) # sequential.
+sequential= xc.PartitionedDomain.getDefaultNumThreads()
+xc.PartitionedDomain.setDefaultNumThreads(0) # clamped to one.
+clamped= xc.PartitionedDomain.getDefaultNumThreads()
+xc.PartitionedDomain.setDefaultNumThreads(4)
+four= xc.PartitionedDomain.getDefaultNumThreads()
+xc.PartitionedDomain.setDefaultNumThreads(default)
+
+'''
+print "default= ", default
+print "sequential= ", sequential
+print "clamped= ", clamped
+print "four= ", four
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (default==1) & (sequential==1) & (clamped==1) & (four==4):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,110 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Cantilever with an elastic spring at its tip, solved in several
+# steps reusing the tangent of the elastic beam elements.
+
+from __future__ import division
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 2.1e6 # Young modulus.
+I= 1e-4 # Moment of inertia of the beam.
+A= 1e-2 # Area of the beam.
+L= 5.0 # Beam length.
+ks= 5e3 # Stiffness of the spring.
+P= -1e3 # Load at the tip.
+NumDiv= 4
+
+# Problem type
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+nodes.defaultTag= 1 #First node number.
+for i in range(0,NumDiv+1):
+  nod= nodes.newNodeXY(i*L/NumDiv,0.0)
+tipNode= nodes.defaultTag-1
+nod= nodes.newNodeXY(L,-1.0) # Spring support.
+springNode= nodes.defaultTag-1
+
+# Geometric transformations
+lin= modelSpace.newLinearCrdTransf("lin")
+# Materials
+section= typical_materials.defElasticSection2d(preprocessor, "section",A,E,I)
+spring= typical_materials.defElasticMaterial(preprocessor, "spring",ks)
+
+# Elements definition
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "lin"
+elements.defaultMaterial= "section"
+elements.defaultTag= 1 #Tag for next element.
+for i in range(1,NumDiv+1):
+  beam2d= elements.newElement("ElasticBeam2d",xc.ID([i,i+1]))
+elements.defaultMaterial= "spring"
+elements.dimElem= 2
+truss= elements.newElement("Truss",xc.ID([tipNode,springNode]))
+truss.area= 1.0
+
+# Constraints
+modelSpace.fixNode000(1)
+modelSpace.fixNode000(springNode)
+
+# Loads definition
+loadHandler= preprocessor.getLoadHandler
+lPatterns= loadHandler.getLoadPatterns
+ts= lPatterns.newTimeSeries("linear_ts","ts")
+lPatterns.currentTimeSeries= "ts"
+lp0= lPatterns.newLoadPattern("default","0")
+lp0.newNodalLoad(tipNode,xc.Vector([0,P,0]))
+lPatterns.addToDomain("0")
+
+# Solution procedure
+solu= feProblem.getSoluProc
+solCtrl= solu.getSoluControl
+solModels= solCtrl.getModelWrapperContainer
+sm= solModels.newModelWrapper("sm")
+cHandler= sm.newConstraintHandler("plain_handler")
+numberer= sm.newNumberer("default_numberer")
+numberer.useAlgorithm("simple")
+analysisAggregations= solCtrl.getAnalysisAggregationContainer
+analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+solAlgo= analysisAggregation.newSolutionAlgorithm("newton_raphson_soln_algo")
+convTest= analysisAggregation.newConvergenceTest("norm_unbalance_conv_test")
+convTest.tol= 1.0e-9
+convTest.maxNumIter= 10
+integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+integ.dLambda1= 0.25
+integ.useTangentCache= True
+soe= analysisAggregation.newSystemOfEqn("profile_spd_lin_soe")
+solver= soe.newSolver("profile_spd_lin_direct_solver")
+analysis= solu.newAnalysis("static_analysis","analysisAggregation","")
+result= analysis.analyze(4)
+
+# Stiffness of the cantilever and the spring in parallel.
+kBeam= 3*E*I/L**3
+deltaTeor= P/(kBeam+ks)
+delta= nodes.getNode(tipNode).getDisp[1]
+ratio1= abs(delta-deltaTeor)/abs(deltaTeor)
+
+'''
+print "delta= ",delta
+print "deltaTeor= ",deltaTeor
+print "ratio1= ",ratio1
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (abs(ratio1)<1e-9) & (result==0):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,117 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Checks that the cached tangent is discarded when the analysis model
+# is rebuilt: a second cantilever is added to the model in the middle
+# of the analysis (the FE_Elements are created again).
+
+from __future__ import division
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 2.1e6 # Young modulus.
+I= 1e-4 # Moment of inertia of the beam.
+A= 1e-2 # Area of the beam.
+L= 5.0 # Beam length.
+P= -1e3 # Load at the tip.
+NumDiv= 4
+
+# Problem type
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+
+# Geometric transformations
+lin= modelSpace.newLinearCrdTransf("lin")
+# Materials
+section= typical_materials.defElasticSection2d(preprocessor, "section",A,E,I)
+
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "lin"
+elements.defaultMaterial= "section"
+loadHandler= preprocessor.getLoadHandler
+lPatterns= loadHandler.getLoadPatterns
+
+def defCantilever(y):
+  ''' Defines a cantilever at the height y and returns the tag
+      of its tip node.'''
+  firstNode= nodes.defaultTag
+  for i in range(0,NumDiv+1):
+    nod= nodes.newNodeXY(i*L/NumDiv,y)
+  for i in range(firstNode,firstNode+NumDiv):
+    beam2d= elements.newElement("ElasticBeam2d",xc.ID([i,i+1]))
+  modelSpace.fixNode000(firstNode)
+  return nodes.defaultTag-1
+
+# First cantilever, loaded proportionally to the pseudo-time.
+nodes.defaultTag= 1 #First node number.
+elements.defaultTag= 1 #Tag for next element.
+tipNode1= defCantilever(0.0)
+ts= lPatterns.newTimeSeries("linear_ts","ts")
+lPatterns.currentTimeSeries= "ts"
+lp0= lPatterns.newLoadPattern("default","0")
+lp0.newNodalLoad(tipNode1,xc.Vector([0,P,0]))
+lPatterns.addToDomain("0")
+
+# Solution procedure
+solu= feProblem.getSoluProc
+solCtrl= solu.getSoluControl
+solModels= solCtrl.getModelWrapperContainer
+sm= solModels.newModelWrapper("sm")
+cHandler= sm.newConstraintHandler("plain_handler")
+numberer= sm.newNumberer("default_numberer")
+numberer.useAlgorithm("simple")
+analysisAggregations= solCtrl.getAnalysisAggregationContainer
+analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+solAlgo= analysisAggregation.newSolutionAlgorithm("newton_raphson_soln_algo")
+convTest= analysisAggregation.newConvergenceTest("norm_unbalance_conv_test")
+convTest.tol= 1.0e-9
+convTest.maxNumIter= 10
+integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+integ.dLambda1= 0.25
+integ.useTangentCache= True
+soe= analysisAggregation.newSystemOfEqn("profile_spd_lin_soe")
+solver= soe.newSolver("profile_spd_lin_direct_solver")
+analysis= solu.newAnalysis("static_analysis","analysisAggregation","")
+result1= analysis.analyze(2)
+
+# Second cantilever (constant load) added in the middle of the analysis.
+tipNode2= defCantilever(2.0)
+ts2= lPatterns.newTimeSeries("constant_ts","ts2")
+lPatterns.currentTimeSeries= "ts2"
+lp1= lPatterns.newLoadPattern("default","1")
+lp1.newNodalLoad(tipNode2,xc.Vector([0,P,0]))
+lPatterns.addToDomain("1")
+result2= analysis.analyze(2)
+
+kBeam= 3*E*I/L**3
+deltaTeor= P/kBeam
+delta1= nodes.getNode(tipNode1).getDisp[1]
+delta2= nodes.getNode(tipNode2).getDisp[1]
+ratio1= abs(delta1-deltaTeor)/abs(deltaTeor)
+ratio2= abs(delta2-deltaTeor)/abs(deltaTeor)
+
+'''
+print "delta1= ",delta1
+print "delta2= ",delta2
+print "deltaTeor= ",deltaTeor
+print "ratio1= ",ratio1
+print "ratio2= ",ratio2
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (ratio1<1e-9) & (ratio2<1e-9) & (result1==0) & (result2==0):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,132 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Undamped single degree of freedom oscillator under a step load
+# (u(t)= P/k*(1-cos(w*t))). The time step is controlled by the
+# estimated local truncation error and the recorders are called at
+# output times that don't coincide with the analysis steps (the
+# nodal response is interpolated at those times). The relative error
+# estimate of the first step (starting from rest) exceeds the tolerance
+# even with the minimum time step, so the step must be accepted.
+
+from __future__ import division
+import math
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+m= 1.0 # Mass (kg)
+T= 1.0 # Natural period (s)
+w= 2*math.pi/T # Natural circular frequency (rad/s)
+k= m*w**2 # Stiffness (N/m)
+L= 1.0 # Spring length (m)
+A= 1.0 # Spring area (m2)
+E= k*L/A # Elastic modulus of the spring material.
+P= 10.0 # Load (N)
+errorTolerance= 1e-5
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+nodes.defaultTag= 1 #First node number.
+nod1= nodes.newNodeXY(0.0,0.0)
+nod2= nodes.newNodeXY(L,0.0)
+nod2.mass= xc.Matrix([[m,0],[0,m]])
+
+# Materials definition
+elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+
+# Elements definition
+elements= preprocessor.getElementHandler
+elements.dimElem= 2 # Dimension of element space
+elements.defaultMaterial= "elast"
+elements.defaultTag= 1 #Tag for the next element.
+truss= elements.newElement("Truss",xc.ID([1,2]))
+truss.area= A
+
+# Constraints
+constraints= preprocessor.getBoundaryCondHandler
+spc= constraints.newSPConstraint(1,0,0.0)
+spc= constraints.newSPConstraint(1,1,0.0)
+spc= constraints.newSPConstraint(2,1,0.0)
+
+# Loads definition
+loadHandler= preprocessor.getLoadHandler
+lPatterns= loadHandler.getLoadPatterns
+ts= lPatterns.newTimeSeries("constant_ts","ts")
+lPatterns.currentTimeSeries= "ts"
+lp0= lPatterns.newLoadPattern("default","0")
+lp0.newNodalLoad(2,xc.Vector([P,0]))
+lPatterns.addToDomain("0")
+
+# Recorder
+times= []
+displacements= []
+recorder= feProblem.getDomain.newRecorder("node_prop_recorder",None);
+recorder.setNodes(xc.ID([2]))
+recorder.callbackRecord= "times.append(recorder.getLastTimeStamp); displacements.append(self.getDisp[0])"
+
+# Solution procedure
+solu= feProblem.getSoluProc
+solCtrl= solu.getSoluControl
+solModels= solCtrl.getModelWrapperContainer
+sm= solModels.newModelWrapper("sm")
+numberer= sm.newNumberer("default_numberer")
+numberer.useAlgorithm("simple")
+cHandler= sm.newConstraintHandler("plain_handler")
+analysisAggregations= solCtrl.getAnalysisAggregationContainer
+analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+solAlgo= analysisAggregation.newSolutionAlgorithm("newton_raphson_soln_algo")
+ctest= analysisAggregation.newConvergenceTest("norm_disp_incr_conv_test")
+ctest.tol= 1.0e-9
+ctest.maxNumIter= 10
+integ= analysisAggregation.newIntegrator("newmark_integrator",xc.Vector([0.5,0.25]))
+soe= analysisAggregation.newSystemOfEqn("band_gen_lin_soe")
+solver= soe.newSolver("band_gen_lin_lapack_solver")
+analysis= solu.newAnalysis("variable_time_step_direct_integration_analysis","analysisAggregation","")
+analysis.errorTolerance= errorTolerance
+outputTimes= [0.05+0.1*i for i in range(0,10)]
+analysis.setOutputTimes(outputTimes)
+result= analysis.analyze(100,0.01,1e-4,0.05,3)
+
+# Recorded values at the output times.
+timeErr= 0.0
+dispErr= 0.0
+for t, u in zip(times, displacements):
+  uTeor= P/k*(1.0-math.cos(w*t))
+  dispErr= max(dispErr,abs(u-uTeor))
+for t, tOut in zip(times, outputTimes):
+  timeErr= max(timeErr,abs(t-tOut))
+dispErr/= P/k
+
+# The state of the node at the end of the analysis must be
+# the committed one (not the interpolated one).
+tEnd= feProblem.getDomain.getTimeTracker.getCommittedTime
+uEnd= P/k*(1.0-math.cos(w*tEnd))
+ratio= abs(nod2.getDisp[0]-uEnd)/(P/k)
+
+'''
+print "times= ", times
+print "displacements= ", displacements
+print "timeErr= ", timeErr
+print "dispErr= ", dispErr
+print "tEnd= ", tEnd
+print "ratio= ", ratio
+print "errorTolerance= ", analysis.errorTolerance
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (result==0) & (len(times)==len(outputTimes)) & (timeErr<1e-12) & (dispErr<2e-2) & (ratio<2e-2) & (analysis.errorTolerance==errorTolerance):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
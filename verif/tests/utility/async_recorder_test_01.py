@@ -0,0 +1,149 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Cantilever solved in several steps with asynchronous node recorders
+# (each one formats and writes its data in a background thread). The
+# recorders are asynchronous by default. The recorder whose output
+# can't be written must report the error when flushed; the other one
+# must write the displacements of all the steps.
+
+from __future__ import division
+import os
+import ast
+import struct
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 2.1e6 # Young modulus.
+I= 1e-4 # Moment of inertia of the beam.
+A= 1e-2 # Area of the beam.
+L= 5.0 # Beam length.
+P= -1e3 # Load at the tip.
+NumDiv= 4
+NumSteps= 4
+
+# Problem type
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+nodes.defaultTag= 1 #First node number.
+for i in range(0,NumDiv+1):
+  nod= nodes.newNodeXY(i*L/NumDiv,0.0)
+tipNode= nodes.defaultTag-1
+
+# Geometric transformations
+lin= modelSpace.newLinearCrdTransf("lin")
+# Materials
+section= typical_materials.defElasticSection2d(preprocessor, "section",A,E,I)
+
+# Elements definition
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "lin"
+elements.defaultMaterial= "section"
+elements.defaultTag= 1 #Tag for next element.
+for i in range(1,NumDiv+1):
+  beam2d= elements.newElement("ElasticBeam2d",xc.ID([i,i+1]))
+
+# Constraints
+modelSpace.fixNode000(1)
+
+# Loads definition
+loadHandler= preprocessor.getLoadHandler
+lPatterns= loadHandler.getLoadPatterns
+ts= lPatterns.newTimeSeries("linear_ts","ts")
+lPatterns.currentTimeSeries= "ts"
+lp0= lPatterns.newLoadPattern("default","0")
+lp0.newNodalLoad(tipNode,xc.Vector([0,P,0]))
+lPatterns.addToDomain("0")
+
+# Recorders
+def newRecorder(fileName):
+  ''' Asynchronous recorder of the tip displacements.'''
+  handler= feProblem.newOutputHandler("binary_handler",fileName)
+  recorder= feProblem.getDomain.newRecorder("node_recorder",handler)
+  defaultAsync= recorder.asynchronous
+  recorder.asynchronous= True
+  recorder.setNodes(xc.ID([tipNode]))
+  recorder.setDofs(xc.ID([0,1,2]))
+  recorder.setData('disp')
+  return recorder, defaultAsync
+
+goodFileName= '/tmp/async_recorder_test_01.npy'
+goodRecorder, defaultAsync= newRecorder(goodFileName)
+badRecorder, defaultAsync2= newRecorder('/tmp/async_recorder_test_01_no_such_dir/bad.npy')
+
+# Solution procedure
+solu= feProblem.getSoluProc
+solCtrl= solu.getSoluControl
+solModels= solCtrl.getModelWrapperContainer
+sm= solModels.newModelWrapper("sm")
+cHandler= sm.newConstraintHandler("plain_handler")
+numberer= sm.newNumberer("default_numberer")
+numberer.useAlgorithm("simple")
+analysisAggregations= solCtrl.getAnalysisAggregationContainer
+analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+solAlgo= analysisAggregation.newSolutionAlgorithm("newton_raphson_soln_algo")
+convTest= analysisAggregation.newConvergenceTest("norm_unbalance_conv_test")
+convTest.tol= 1.0e-9
+convTest.maxNumIter= 10
+integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+integ.dLambda1= 1.0/NumSteps
+soe= analysisAggregation.newSystemOfEqn("band_gen_lin_soe")
+solver= soe.newSolver("band_gen_lin_lapack_solver")
+analysis= solu.newAnalysis("static_analysis","analysisAggregation","")
+result= analysis.analyze(NumSteps)
+
+goodFlush= goodRecorder.flush()
+badFlush= badRecorder.flush()
+badFlush2= badRecorder.flush() # errors are reported once.
+
+def readNpy(fName):
+  ''' Return the shape and the values of the .npy file.'''
+  data= open(fName,'rb').read()
+  if(data[0:6]!='\x93NUMPY'):
+    return None, []
+  headerLength= struct.unpack('<H',data[8:10])[0]
+  header= ast.literal_eval(data[10:10+headerLength].strip())
+  shape= header['shape']
+  numValues= shape[0]*shape[1]
+  values= struct.unpack(header['descr'][0]+'%dd' % numValues,data[10+headerLength:10+headerLength+8*numValues])
+  return shape, values
+
+deltaTeor= P*L**3/(3*E*I)
+def checkValues(shape, values):
+  ''' Compare the recorded tip displacements with the theoretical ones.'''
+  retval= (shape==(NumSteps,3))
+  if(retval):
+    for i in range(0,NumSteps):
+      delta= values[3*i+1]
+      lmbd= (i+1)/NumSteps
+      retval= retval and (abs(delta-lmbd*deltaTeor)<1e-9*abs(deltaTeor))
+  return retval
+
+shape, values= readNpy(goodFileName)
+ok= checkValues(shape, values)
+
+'''
+print "defaultAsync= ",defaultAsync
+print "goodFlush= ",goodFlush
+print "badFlush= ",badFlush
+print "badFlush2= ",badFlush2
+print "shape= ",shape
+print "values= ",values
+'''
+
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if defaultAsync & defaultAsync2 & (goodFlush==0) & (badFlush<0) & (badFlush2==0) & ok & (result==0):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,173 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Cantilever solved in several steps with two asynchronous node
+# recorders (the default) that share the same output handler: one
+# records the displacements of the tip and the other the ones of
+# the node at mid-span. Each recorder writes from its own thread,
+# the handler must receive whole rows.
+# The handler is opened (and the file truncated) by each recorder
+# on its first record, so the first row of the recorder that opens
+# it first may be lost; all the other rows must be written once.
+
+from __future__ import division
+import os
+import ast
+import struct
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 2.1e6 # Young modulus.
+I= 1e-4 # Moment of inertia of the beam.
+A= 1e-2 # Area of the beam.
+L= 5.0 # Beam length.
+P= -1e3 # Load at the tip.
+NumDiv= 4
+NumSteps= 50
+
+# Problem type
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+nodes.defaultTag= 1 #First node number.
+for i in range(0,NumDiv+1):
+  nod= nodes.newNodeXY(i*L/NumDiv,0.0)
+tipNode= nodes.defaultTag-1
+midNode= tipNode-NumDiv//2
+
+# Geometric transformations
+lin= modelSpace.newLinearCrdTransf("lin")
+# Materials
+section= typical_materials.defElasticSection2d(preprocessor, "section",A,E,I)
+
+# Elements definition
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "lin"
+elements.defaultMaterial= "section"
+elements.defaultTag= 1 #Tag for next element.
+for i in range(1,NumDiv+1):
+  beam2d= elements.newElement("ElasticBeam2d",xc.ID([i,i+1]))
+
+# Constraints
+modelSpace.fixNode000(1)
+
+# Loads definition
+loadHandler= preprocessor.getLoadHandler
+lPatterns= loadHandler.getLoadPatterns
+ts= lPatterns.newTimeSeries("linear_ts","ts")
+lPatterns.currentTimeSeries= "ts"
+lp0= lPatterns.newLoadPattern("default","0")
+lp0.newNodalLoad(tipNode,xc.Vector([0,P,0]))
+lPatterns.addToDomain("0")
+
+# Recorders
+fileName= '/tmp/async_recorder_test_02.npy'
+handler= feProblem.newOutputHandler("binary_handler",fileName)
+def newRecorder(nodeTag):
+  ''' Recorder of the displacements of the node.'''
+  recorder= feProblem.getDomain.newRecorder("node_recorder",handler)
+  recorder.setNodes(xc.ID([nodeTag]))
+  recorder.setDofs(xc.ID([0,1,2]))
+  recorder.setData('disp')
+  return recorder
+
+tipRecorder= newRecorder(tipNode)
+midRecorder= newRecorder(midNode)
+defaultAsync= tipRecorder.asynchronous and midRecorder.asynchronous
+
+# Solution procedure
+solu= feProblem.getSoluProc
+solCtrl= solu.getSoluControl
+solModels= solCtrl.getModelWrapperContainer
+sm= solModels.newModelWrapper("sm")
+cHandler= sm.newConstraintHandler("plain_handler")
+numberer= sm.newNumberer("default_numberer")
+numberer.useAlgorithm("simple")
+analysisAggregations= solCtrl.getAnalysisAggregationContainer
+analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+solAlgo= analysisAggregation.newSolutionAlgorithm("newton_raphson_soln_algo")
+convTest= analysisAggregation.newConvergenceTest("norm_unbalance_conv_test")
+convTest.tol= 1.0e-9
+convTest.maxNumIter= 10
+integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+integ.dLambda1= 1.0/NumSteps
+soe= analysisAggregation.newSystemOfEqn("band_gen_lin_soe")
+solver= soe.newSolver("band_gen_lin_lapack_solver")
+analysis= solu.newAnalysis("static_analysis","analysisAggregation","")
+result= analysis.analyze(NumSteps)
+
+tipFlush= tipRecorder.flush()
+midFlush= midRecorder.flush()
+
+def readNpy(fName):
+  ''' Return the shape and the values of the .npy file.'''
+  data= open(fName,'rb').read()
+  if(data[0:6]!='\x93NUMPY'):
+    return None, []
+  headerLength= struct.unpack('<H',data[8:10])[0]
+  header= ast.literal_eval(data[10:10+headerLength].strip())
+  shape= header['shape']
+  numValues= shape[0]*shape[1]
+  values= struct.unpack(header['descr'][0]+'%dd' % numValues,data[10+headerLength:10+headerLength+8*numValues])
+  return shape, values
+
+# Theoretical deflections and rotations.
+def theoreticalDisp(x):
+  ''' Deflection and rotation at x under the full load.'''
+  return P*x**2*(3*L-x)/(6*E*I), P*x*(2*L-x)/(2*E*I)
+deltaTip, thetaTip= theoreticalDisp(L)
+deltaMid, thetaMid= theoreticalDisp((midNode-1)*L/NumDiv)
+
+def findRow(delta, theta):
+  ''' Return the (node, step) pair of the recorded displacements.'''
+  for i in range(0,NumSteps):
+    lmbd= (i+1)/NumSteps
+    for n, d, t in [(tipNode,deltaTip,thetaTip),(midNode,deltaMid,thetaMid)]:
+      if((abs(delta-lmbd*d)<1e-9*abs(deltaTip)) and (abs(theta-lmbd*t)<1e-9*abs(thetaTip))):
+        return (n,i+1)
+  return None
+
+shape, values= readNpy(fileName)
+count= dict()
+unknownRows= 0
+if(shape):
+  for i in range(0,shape[0]):
+    key= findRow(values[3*i+1],values[3*i+2])
+    if(key):
+      count[key]= count.get(key,0)+1
+    else:
+      unknownRows+= 1
+
+ok= (shape!=None) and (shape[1]==3) and (unknownRows==0)
+if(ok):
+  for n in [tipNode,midNode]:
+    for step in range(2,NumSteps+1):
+      ok= ok and (count.get((n,step),0)==1)
+  firstRows= count.get((tipNode,1),0)+count.get((midNode,1),0)
+  ok= ok and (firstRows>=1) and (firstRows<=2)
+  ok= ok and (count.get((tipNode,1),0)<=1) and (count.get((midNode,1),0)<=1)
+
+'''
+print "defaultAsync= ",defaultAsync
+print "tipFlush= ",tipFlush
+print "midFlush= ",midFlush
+print "shape= ",shape
+print "unknownRows= ",unknownRows
+print "count= ",count
+'''
+
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if defaultAsync & (tipFlush==0) & (midFlush==0) & ok & (result==0):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,143 @@
+# -*- coding: utf-8 -*-
+# home made test
+'''Send the model to other process through a TCP socket and through
+   a shared memory channel (nodes and elements serialized in a single
+   buffer). These channels are not databases (their dbTag is always
+   zero) so the records of the buffer must be decoded in the order
+   they were written.'''
+
+import os
+import time
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+# Material properties
+E= 2.1e6*9.81/1e-4 # Elastic modulus (Pa)
+nu= 0.3 # Poisson's ratio
+G= E/(2*(1+nu)) # Shear modulus
+
+# Cross section properties (IPE-80)
+A= 7.64e-4 # Cross section area (m2)
+Iy= 80.1e-8 # Cross section moment of inertia (m4)
+Iz= 8.49e-8 # Cross section moment of inertia (m4)
+J= 0.721e-8 # Cross section torsion constant (m4)
+
+# Geometry
+L= 1.5 # Bar length (m)
+NumDiv= 4
+
+# Load
+F= 1.5e3 # Load magnitude (kN)
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+
+# Problem type
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+nodes.defaultTag= 1 #First node number.
+for i in range(0,NumDiv+1):
+  nod= nodes.newNodeXYZ(i*L/NumDiv,0.0,0.0)
+
+lin= modelSpace.newLinearCrdTransf("lin",xc.Vector([0,1,0]))
+
+# Materials definition
+scc= typical_materials.defElasticSection3d(preprocessor, "scc",A,E,G,Iz,Iy,J)
+
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "lin"
+elements.defaultMaterial= "scc"
+elements.defaultTag= 1 #Tag for next element.
+for i in range(1,NumDiv+1):
+  beam3d= elements.newElement("ElasticBeam3d",xc.ID([i,i+1]));
+
+modelSpace.fixNode000_000(1)
+
+loadHandler= preprocessor.getLoadHandler
+lPatterns= loadHandler.getLoadPatterns
+ts= lPatterns.newTimeSeries("constant_ts","ts")
+lPatterns.currentTimeSeries= "ts"
+lp0= lPatterns.newLoadPattern("default","0")
+lp0.newNodalLoad(NumDiv+1,xc.Vector([F,0,0,0,0,0]))
+lPatterns.addToDomain("0")
+
+# Send nodes and elements in a single buffer.
+mesh= feProblem.getDomain.getMesh
+mesh.bufferedComm= True
+
+# Solution
+analisis= predefined_solutions.simple_static_linear(feProblem)
+result= analisis.analyze(1)
+
+deltateor= (F*L/(E*A))
+
+def check_received(channel):
+  ''' Receive the model in a new problem and check the results
+      (runs in the child process).'''
+  ok= (channel.setUpConnection()==0)
+  receiver= xc.FEProblem()
+  receiver.setVerbosityLevel(0) #Dont print warning messages
+                                #about pointers to material.
+  ok= ok and (receiver.receiveModel(channel,0)>=0)
+  receiver.setVerbosityLevel(1)
+  if(ok):
+    prep= receiver.getPreprocessor
+    numNodes= prep.getDomain.getMesh.getNumNodes()
+    numElements= prep.getDomain.getMesh.getNumElements()
+    delta= prep.getNodeHandler.getNode(NumDiv+1).getDisp[0]
+    elem= prep.getElementHandler.getElement(NumDiv)
+    elem.getResistingForce()
+    ok= (numNodes==NumDiv+1) and (numElements==NumDiv)
+    ok= ok and (abs(delta/deltateor-1.0)<1e-5) and (abs(elem.getN1/F-1.0)<1e-5)
+  return ok
+
+def send_to_child(channel, remoteChannelFactory):
+  ''' Fork a process that receives the model and checks it;
+      returns true if both sides succeed.'''
+  pid= os.fork()
+  if(pid==0):
+    ok= False
+    try:
+      ok= check_received(remoteChannelFactory())
+    finally:
+      os._exit(0 if ok else 1)
+  res= channel.setUpConnection()
+  res+= feProblem.sendModel(channel,0)
+  childStatus= os.waitpid(pid,0)[1]
+  return (res>=0) and (childStatus==0)
+
+# TCP socket.
+server= xc.TCP_Socket()
+port= server.portNumber
+def tcp_client():
+  time.sleep(0.2) # give time to the server to listen.
+  return xc.TCP_Socket(port,'127.0.0.1')
+tcpOk= send_to_child(server,tcp_client)
+
+# Shared memory channel.
+owner= xc.SharedMemoryChannel('/xc_channel_comm_'+str(os.getpid()),64*1024)
+programArgs= owner.getProgramArgs()
+shmOk= send_to_child(owner,lambda: xc.SharedMemoryChannel.fromProgramArgs(programArgs))
+
+'''
+print "result= ",result
+print "tcpOk= ",tcpOk
+print "shmOk= ",shmOk
+   '''
+
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (result==0) & tcpOk & shmOk:
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,84 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Round trip through a shared memory channel: the child process
+# opens the channel from the string returned by getProgramArgs,
+# receives a vector and an ID and sends them back doubled.
+# Checks also that a channel of other session doesn't attach to
+# the segment.
+
+from __future__ import division
+import os
+import xc_base
+import geom
+import xc
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+segmentName= '/xc_shm_test_'+str(os.getpid())
+n= 100000 # greater than the ring capacity to force several turns.
+values= [float(i)/3.0 for i in range(0,n)]
+tags= [1,5,7,11]
+
+owner= xc.SharedMemoryChannel(segmentName,64*1024)
+programArgs= owner.getProgramArgs()
+
+# A channel of other session must not attach to this segment.
+wrongArgs= ' 3 '+segmentName+' '+str(owner.session+1)+' '
+stranger= xc.SharedMemoryChannel.fromProgramArgs(wrongArgs)
+stranger.connectionTimeout= 0.2
+strangerResult= stranger.setUpConnection()
+
+pid= os.fork()
+if(pid==0):
+  # child process: remote side of the channel.
+  ok= 0
+  remote= xc.SharedMemoryChannel.fromProgramArgs(programArgs)
+  ok+= abs(remote.setUpConnection())
+  v= xc.Vector([0.0]*n)
+  ok+= abs(remote.recvVector(0,0,v))
+  id= xc.ID([0]*len(tags))
+  ok+= abs(remote.recvID(0,0,id))
+  for i in range(0,n):
+    v[i]*= 2.0
+  for i in range(0,len(tags)):
+    id[i]*= 2
+  ok+= abs(remote.sendVector(0,0,v))
+  ok+= abs(remote.sendID(0,0,id))
+  os._exit(min(ok,100))
+
+result= owner.setUpConnection()
+result+= owner.sendVector(0,0,xc.Vector(values))
+result+= owner.sendID(0,0,xc.ID(tags))
+v= xc.Vector([0.0]*n)
+result+= owner.recvVector(0,0,v)
+id= xc.ID([0]*len(tags))
+result+= owner.recvID(0,0,id)
+childStatus= os.waitpid(pid,0)[1]
+
+err= 0.0
+for i in range(0,n):
+  err+= (v[i]-2.0*values[i])**2
+idOk= True
+for i in range(0,len(tags)):
+  idOk= idOk and (id[i]==2*tags[i])
+
+'''
+print 'programArgs= ', programArgs
+print 'strangerResult= ', strangerResult
+print 'result= ', result
+print 'childStatus= ', childStatus
+print 'err= ', err
+print 'idOk= ', idOk
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (strangerResult<0) & (result==0) & (childStatus==0) & (err<1e-12) & idOk:
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,118 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Cantilever solved in several steps writing the results in
+# VTK XML unstructured grid files (.vtu) indexed by a .pvd file.
+
+from __future__ import division
+import os
+import struct
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 2.1e6 # Young modulus.
+I= 1e-4 # Moment of inertia of the beam.
+A= 1e-2 # Area of the beam.
+L= 5.0 # Beam length.
+P= -1e3 # Load at the tip.
+NumDiv= 4
+NumSteps= 4
+
+# Problem type
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+nodes.defaultTag= 1 #First node number.
+for i in range(0,NumDiv+1):
+  nod= nodes.newNodeXY(i*L/NumDiv,0.0)
+tipNode= nodes.defaultTag-1
+
+# Geometric transformations
+lin= modelSpace.newLinearCrdTransf("lin")
+# Materials
+section= typical_materials.defElasticSection2d(preprocessor, "section",A,E,I)
+
+# Elements definition
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "lin"
+elements.defaultMaterial= "section"
+elements.defaultTag= 1 #Tag for next element.
+for i in range(1,NumDiv+1):
+  beam2d= elements.newElement("ElasticBeam2d",xc.ID([i,i+1]))
+
+# Constraints
+modelSpace.fixNode000(1)
+
+# Loads definition
+loadHandler= preprocessor.getLoadHandler
+lPatterns= loadHandler.getLoadPatterns
+ts= lPatterns.newTimeSeries("linear_ts","ts")
+lPatterns.currentTimeSeries= "ts"
+lp0= lPatterns.newLoadPattern("default","0")
+lp0.newNodalLoad(tipNode,xc.Vector([0,P,0]))
+lPatterns.addToDomain("0")
+
+# Recorder
+fileName= '/tmp/vtu_recorder_test_01'
+recorder= feProblem.getDomain.newRecorder("vtu_recorder",None)
+recorder.fileName= fileName
+recorder.setPointData(['disp','reaction'])
+
+# Solution procedure
+solu= feProblem.getSoluProc
+solCtrl= solu.getSoluControl
+solModels= solCtrl.getModelWrapperContainer
+sm= solModels.newModelWrapper("sm")
+cHandler= sm.newConstraintHandler("plain_handler")
+numberer= sm.newNumberer("default_numberer")
+numberer.useAlgorithm("simple")
+analysisAggregations= solCtrl.getAnalysisAggregationContainer
+analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+solAlgo= analysisAggregation.newSolutionAlgorithm("newton_raphson_soln_algo")
+convTest= analysisAggregation.newConvergenceTest("norm_unbalance_conv_test")
+convTest.tol= 1.0e-9
+convTest.maxNumIter= 10
+integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+integ.dLambda1= 1.0/NumSteps
+soe= analysisAggregation.newSystemOfEqn("band_gen_lin_soe")
+solver= soe.newSolver("band_gen_lin_lapack_solver")
+analysis= solu.newAnalysis("static_analysis","analysisAggregation","")
+result= analysis.analyze(NumSteps)
+
+# Read the tip displacement from the last .vtu file (raw appended data).
+numFiles= recorder.numFiles
+pvd= open(fileName+'.pvd').read()
+numDataSets= pvd.count('<DataSet')
+vtu= open(fileName+'_%06d.vtu' % (numFiles-1),'rb').read()
+pos= vtu.find('Name="disp"')
+offset= int(vtu[vtu.find('offset="',pos)+8:vtu.find('"/>',pos)])
+appended= vtu.find('_',vtu.find('<AppendedData'))+1+offset
+numBytes= struct.unpack('<Q',vtu[appended:appended+8])[0]
+disp= struct.unpack('<%dd' % (numBytes//8),vtu[appended+8:appended+8+numBytes])
+delta= disp[3*(tipNode-1)+1] # three components for each node.
+deltaTeor= P*L**3/(3*E*I)
+ratio1= abs(delta-deltaTeor)/abs(deltaTeor)
+
+'''
+print "numFiles= ",numFiles
+print "numDataSets= ",numDataSets
+print "delta= ",delta
+print "deltaTeor= ",deltaTeor
+print "ratio1= ",ratio1
+'''
+
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (numFiles==NumSteps) & (numDataSets==NumSteps) & (abs(ratio1)<1e-9) & (result==0):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
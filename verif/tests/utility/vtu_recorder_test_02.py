@@ -0,0 +1,148 @@
+# -*- coding: utf-8 -*-
+# home made test
+# Compressed (zlib) VTK XML output of some elements of a cantilever.
+# The data arrays are decompressed and compared with the node
+# positions and displacements. The tag of a non-existent element is
+# included in the list of recorded elements (it must be ignored).
+
+from __future__ import division
+import os
+import struct
+import zlib
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 2.1e6 # Young modulus.
+I= 1e-4 # Moment of inertia of the beam.
+A= 1e-2 # Area of the beam.
+L= 5.0 # Beam length.
+P= -1e3 # Load at the tip.
+NumDiv= 4
+
+# Problem type
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+nodes.defaultTag= 1 #First node number.
+for i in range(0,NumDiv+1):
+  nod= nodes.newNodeXY(i*L/NumDiv,0.0)
+tipNode= nodes.defaultTag-1
+
+# Geometric transformations
+lin= modelSpace.newLinearCrdTransf("lin")
+# Materials
+section= typical_materials.defElasticSection2d(preprocessor, "section",A,E,I)
+
+# Elements definition
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "lin"
+elements.defaultMaterial= "section"
+elements.defaultTag= 1 #Tag for next element.
+for i in range(1,NumDiv+1):
+  beam2d= elements.newElement("ElasticBeam2d",xc.ID([i,i+1]))
+
+# Constraints
+modelSpace.fixNode000(1)
+
+# Loads definition
+loadHandler= preprocessor.getLoadHandler
+lPatterns= loadHandler.getLoadPatterns
+ts= lPatterns.newTimeSeries("constant_ts","ts")
+lPatterns.currentTimeSeries= "ts"
+lp0= lPatterns.newLoadPattern("default","0")
+lp0.newNodalLoad(tipNode,xc.Vector([0,P,0]))
+lPatterns.addToDomain("0")
+
+# Recorder of the two last elements (and a non-existent one).
+fileName= '/tmp/vtu_recorder_test_02'
+recorder= feProblem.getDomain.newRecorder("vtu_recorder",None)
+recorder.fileName= fileName
+recorder.compressed= True
+recorder.setElements(xc.ID([NumDiv-1,NumDiv,1000]))
+recorder.setPointData(['disp'])
+
+# Solution procedure
+solu= feProblem.getSoluProc
+solCtrl= solu.getSoluControl
+solModels= solCtrl.getModelWrapperContainer
+sm= solModels.newModelWrapper("sm")
+cHandler= sm.newConstraintHandler("plain_handler")
+numberer= sm.newNumberer("default_numberer")
+numberer.useAlgorithm("simple")
+analysisAggregations= solCtrl.getAnalysisAggregationContainer
+analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+solAlgo= analysisAggregation.newSolutionAlgorithm("linear_soln_algo")
+integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+soe= analysisAggregation.newSystemOfEqn("band_gen_lin_soe")
+solver= soe.newSolver("band_gen_lin_lapack_solver")
+analysis= solu.newAnalysis("static_analysis","analysisAggregation","")
+result= analysis.analyze(1)
+
+vtu= open(fileName+'_%06d.vtu' % 0,'rb').read()
+appendedStart= vtu.find('_',vtu.find('<AppendedData'))+1
+compressedFile= (vtu.find('compressor="vtkZLibDataCompressor"')>=0)
+
+def readArray(pos, fmt, itemSize):
+  ''' Read the data array whose description starts at pos.'''
+  offset= int(vtu[vtu.find('offset="',pos)+8:vtu.find('"/>',pos)])
+  start= appendedStart+offset
+  if(compressedFile):
+    numBlocks= struct.unpack('<Q',vtu[start:start+8])[0]
+    header= struct.unpack('<%dQ' % (3+numBlocks),vtu[start:start+8*(3+numBlocks)])
+    data= ''
+    blockStart= start+8*(3+numBlocks)
+    for i in range(0,numBlocks):
+      sz= header[3+i]
+      data+= zlib.decompress(vtu[blockStart:blockStart+sz])
+      blockStart+= sz
+  else:
+    numBytes= struct.unpack('<Q',vtu[start:start+8])[0]
+    data= vtu[start+8:start+8+numBytes]
+  return struct.unpack('<%d%s' % (len(data)//itemSize,fmt),data)
+
+numPoints= int(vtu[vtu.find('NumberOfPoints="')+16:vtu.find('"',vtu.find('NumberOfPoints="')+16)])
+numCells= int(vtu[vtu.find('NumberOfCells="')+15:vtu.find('"',vtu.find('NumberOfCells="')+15)])
+points= readArray(vtu.find('<Points>'),'d',8)
+connectivity= readArray(vtu.find('Name="connectivity"'),'q',8)
+disp= readArray(vtu.find('Name="disp"'),'d',8)
+
+# Compare with the nodes of the recorded elements.
+err= 0.0
+for i in range(0,len(connectivity)):
+  idx= connectivity[i]
+  nodeTag= NumDiv-1+i//2+(i%2) # nodes of the elements NumDiv-1 and NumDiv.
+  node= nodes.getNode(nodeTag)
+  pos= node.getInitialPos3d
+  err+= (points[3*idx]-pos.x)**2+(points[3*idx+1]-pos.y)**2
+  err+= (disp[3*idx]-node.getDisp[0])**2+(disp[3*idx+1]-node.getDisp[1])**2+(disp[3*idx+2]-node.getDisp[2])**2
+deltaTeor= P*L**3/(3*E*I)
+tipDisp= max(disp[3*i+1] for i in range(0,numPoints), key= abs)
+ratio1= abs(tipDisp-deltaTeor)/abs(deltaTeor)
+
+'''
+print "compressionAvailable= ",xc.VtuRecorder.compressionAvailable()
+print "compressedFile= ",compressedFile
+print "numPoints= ",numPoints
+print "numCells= ",numCells
+print "connectivity= ",connectivity
+print "err= ",err
+print "ratio1= ",ratio1
+'''
+
+fname= os.path.basename(__file__)
+from miscUtils import LogMessages as lmsg
+compressionOk= (compressedFile==xc.VtuRecorder.compressionAvailable()) & (recorder.compressed==compressedFile)
+if (result==0) & compressionOk & (numPoints==3) & (numCells==2) & (len(connectivity)==4) & (err<1e-20) & (ratio1<1e-9):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')